@@ -0,0 +1,96 @@
+#define _DEFAULT_SOURCE
+#define _GNU_SOURCE
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#elif defined(__arm__) && defined(__linux__)
+#include <stdio.h>
+#include <string.h>
+#endif
+
+#include "ophh_cpu.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+/* XCR0 tells whether the OS saves the YMM state on context switch;
+ * AVX must not be used unless both the XMM and YMM bits are set. */
+static unsigned int xgetbv0(void)
+{
+	unsigned int eax, edx;
+	__asm__ volatile (".byte 0x0f, 0x01, 0xd0" : "=a"(eax), "=d"(edx) : "c"(0));
+	return eax;
+}
+
+static unsigned int probe(void)
+{
+	unsigned int eax, ebx, ecx, edx;
+	unsigned int ret = 0;
+
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+		return 0;
+	if (edx & bit_SSE2)
+		ret |= OPHH_CPU_SSE2;
+	if (ecx & bit_SSE4_1)
+		ret |= OPHH_CPU_SSE4_1;
+	if ((ecx & bit_OSXSAVE) && (ecx & bit_AVX) && (xgetbv0() & 6) == 6) {
+		ret |= OPHH_CPU_AVX;
+		if (ecx & bit_FMA)
+			ret |= OPHH_CPU_FMA;
+		if (__get_cpuid_max(0, 0) >= 7) {
+			__cpuid_count(7, 0, eax, ebx, ecx, edx);
+			if (ebx & bit_AVX2)
+				ret |= OPHH_CPU_AVX2;
+		}
+	}
+	return ret;
+}
+
+#elif defined(__aarch64__)
+
+/* Advanced SIMD is mandatory on AArch64 */
+static unsigned int probe(void)
+{
+	return OPHH_CPU_NEON;
+}
+
+#elif defined(__arm__) && defined(__linux__)
+
+static unsigned int probe(void)
+{
+	unsigned int ret = 0;
+	char buf[512];
+	FILE *cpuinfo = fopen("/proc/cpuinfo", "r");
+
+	if (!cpuinfo)
+		return 0;
+	while (fgets(buf, sizeof(buf), cpuinfo)) {
+		if (!strncmp(buf, "Features", 8) && strstr(buf, " neon")) {
+			ret |= OPHH_CPU_NEON;
+			break;
+		}
+	}
+	fclose(cpuinfo);
+	return ret;
+}
+
+#else
+
+static unsigned int probe(void)
+{
+	return 0;
+}
+
+#endif
+
+unsigned int ophh_cpu_flags(void)
+{
+	/* Benign race: every thread computes the same value */
+	static volatile int probed = 0;
+	static volatile unsigned int flags = 0;
+
+	if (!probed) {
+		flags = probe();
+		probed = 1;
+	}
+	return flags;
+}
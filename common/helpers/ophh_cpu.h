@@ -0,0 +1,17 @@
+#pragma once
+
+#ifndef _OPHH_CPU_H_
+#define _OPHH_CPU_H_
+
+#define OPHH_CPU_SSE2	0x0001
+#define OPHH_CPU_SSE4_1	0x0002
+#define OPHH_CPU_AVX	0x0004
+#define OPHH_CPU_AVX2	0x0008
+#define OPHH_CPU_FMA	0x0010
+#define OPHH_CPU_NEON	0x0100
+
+/* Instruction set extensions usable on this CPU (OPHH_CPU_* bits).
+ * Probed once; later calls return the cached value. */
+unsigned int ophh_cpu_flags(void);
+
+#endif /* _OPHH_CPU_H_ */
@@ -0,0 +1,175 @@
+#ifndef _WIN32
+#define _DEFAULT_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <errno.h>
+#include <stdlib.h>
+
+#include "ophh_thread.h"
+
+struct thread_start {
+	void (*fn)(void *);
+	void *arg;
+};
+
+#ifdef _WIN32
+
+static DWORD WINAPI thread_entry(LPVOID _p)
+{
+	struct thread_start ts = *(struct thread_start *)_p;
+	free(_p);
+	ts.fn(ts.arg);
+	return 0;
+}
+
+int ophh_thread_start(ophh_thread_t *_t, void (*_fn)(void *), void *_arg)
+{
+	struct thread_start *ts = malloc(sizeof(*ts));
+	DWORD id;
+
+	if (!ts)
+		return -1;
+	ts->fn = _fn;
+	ts->arg = _arg;
+	*_t = CreateThread(NULL, 0, thread_entry, ts, 0, &id);
+	if (!*_t) {
+		free(ts);
+		return -1;
+	}
+	return 0;
+}
+
+void ophh_thread_join(ophh_thread_t *_t)
+{
+	WaitForSingleObject(*_t, INFINITE);
+	CloseHandle(*_t);
+}
+
+void ophh_mutex_init(ophh_mutex_t *_m)
+{
+	InitializeCriticalSection(_m);
+}
+
+void ophh_mutex_free(ophh_mutex_t *_m)
+{
+	DeleteCriticalSection(_m);
+}
+
+void ophh_mutex_lock(ophh_mutex_t *_m)
+{
+	EnterCriticalSection(_m);
+}
+
+void ophh_mutex_unlock(ophh_mutex_t *_m)
+{
+	LeaveCriticalSection(_m);
+}
+
+int ophh_sem_init(ophh_sem_t *_s, unsigned int _value)
+{
+	*_s = CreateSemaphore(NULL, _value, 0x7FFFFFFF, NULL);
+	return *_s ? 0 : -1;
+}
+
+void ophh_sem_free(ophh_sem_t *_s)
+{
+	CloseHandle(*_s);
+}
+
+void ophh_sem_post(ophh_sem_t *_s)
+{
+	ReleaseSemaphore(*_s, 1, NULL);
+}
+
+void ophh_sem_wait(ophh_sem_t *_s)
+{
+	WaitForSingleObject(*_s, INFINITE);
+}
+
+int ophh_sem_trywait(ophh_sem_t *_s)
+{
+	return WaitForSingleObject(*_s, 0) == WAIT_OBJECT_0;
+}
+
+#else /* _WIN32 */
+
+static void *thread_entry(void *_p)
+{
+	struct thread_start ts = *(struct thread_start *)_p;
+	free(_p);
+	ts.fn(ts.arg);
+	return NULL;
+}
+
+int ophh_thread_start(ophh_thread_t *_t, void (*_fn)(void *), void *_arg)
+{
+	struct thread_start *ts = malloc(sizeof(*ts));
+
+	if (!ts)
+		return -1;
+	ts->fn = _fn;
+	ts->arg = _arg;
+	if (pthread_create(_t, NULL, thread_entry, ts)) {
+		free(ts);
+		return -1;
+	}
+	return 0;
+}
+
+void ophh_thread_join(ophh_thread_t *_t)
+{
+	pthread_join(*_t, NULL);
+}
+
+void ophh_mutex_init(ophh_mutex_t *_m)
+{
+	pthread_mutex_init(_m, NULL);
+}
+
+void ophh_mutex_free(ophh_mutex_t *_m)
+{
+	pthread_mutex_destroy(_m);
+}
+
+void ophh_mutex_lock(ophh_mutex_t *_m)
+{
+	pthread_mutex_lock(_m);
+}
+
+void ophh_mutex_unlock(ophh_mutex_t *_m)
+{
+	pthread_mutex_unlock(_m);
+}
+
+int ophh_sem_init(ophh_sem_t *_s, unsigned int _value)
+{
+	return sem_init(_s, 0, _value);
+}
+
+void ophh_sem_free(ophh_sem_t *_s)
+{
+	sem_destroy(_s);
+}
+
+void ophh_sem_post(ophh_sem_t *_s)
+{
+	sem_post(_s);
+}
+
+void ophh_sem_wait(ophh_sem_t *_s)
+{
+	while (sem_wait(_s) == -1 && errno == EINTR)
+		continue;
+}
+
+int ophh_sem_trywait(ophh_sem_t *_s)
+{
+	int r;
+
+	while ((r = sem_trywait(_s)) == -1 && errno == EINTR)
+		continue;
+	return r == 0;
+}
+
+#endif /* _WIN32 */
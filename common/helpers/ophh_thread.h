@@ -0,0 +1,44 @@
+#pragma once
+
+#ifndef _OPHH_THREAD_H_
+#define _OPHH_THREAD_H_
+
+#ifdef _WIN32
+
+#include <windows.h>
+
+typedef HANDLE ophh_thread_t;
+typedef CRITICAL_SECTION ophh_mutex_t;
+typedef HANDLE ophh_sem_t;
+
+#else
+
+#include <pthread.h>
+#include <semaphore.h>
+
+typedef pthread_t ophh_thread_t;
+typedef pthread_mutex_t ophh_mutex_t;
+typedef sem_t ophh_sem_t;
+
+#endif /* _WIN32 */
+
+/* Minimal thread, mutex and counting semaphore wrappers
+ * (pthreads on Linux, Win32 API on Windows).
+ * Functions returning int give 0 on success. */
+
+int ophh_thread_start(ophh_thread_t *_t, void (*_fn)(void *), void *_arg);
+void ophh_thread_join(ophh_thread_t *_t);
+
+void ophh_mutex_init(ophh_mutex_t *_m);
+void ophh_mutex_free(ophh_mutex_t *_m);
+void ophh_mutex_lock(ophh_mutex_t *_m);
+void ophh_mutex_unlock(ophh_mutex_t *_m);
+
+int ophh_sem_init(ophh_sem_t *_s, unsigned int _value);
+void ophh_sem_free(ophh_sem_t *_s);
+void ophh_sem_post(ophh_sem_t *_s);
+void ophh_sem_wait(ophh_sem_t *_s);
+/* Non-blocking wait: returns 1 if the count was taken, 0 if it was zero. */
+int ophh_sem_trywait(ophh_sem_t *_s);
+
+#endif /* _OPHH_THREAD_H_ */
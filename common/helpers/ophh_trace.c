@@ -0,0 +1,142 @@
+#ifndef _WIN32
+#define _DEFAULT_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "ophh_trace.h"
+
+#define TRACE_RING	(1 << 16)	/* events kept, power of two */
+
+struct trace_ev {
+	unsigned long long ts;	/* ns */
+	unsigned long long dur;	/* ns, 0 for instant */
+	unsigned int id;
+	int pt;
+};
+
+static const char *const tr_name[OPHH_TR_POINTS] = {
+	"capture", "preprocess", "encode", "encrypt", "send",
+	"receive", "decrypt", "queue", "decode", "resample", "play"
+};
+
+volatile int ophh_trace_on = 0;
+
+static struct trace_ev ring[TRACE_RING];
+static volatile unsigned int ring_pos;
+static unsigned long long t_start;
+
+unsigned long long ophh_trace_ns(void)
+{
+#ifdef _WIN32
+	static LARGE_INTEGER freq;
+	LARGE_INTEGER c;
+
+	if (!freq.QuadPart)
+		QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&c);
+	return (unsigned long long)(c.QuadPart / freq.QuadPart) * 1000000000ULL +
+		(unsigned long long)(c.QuadPart % freq.QuadPart) * 1000000000ULL / freq.QuadPart;
+#else
+	struct timespec t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (unsigned long long)t.tv_sec * 1000000000ULL + t.tv_nsec;
+#endif
+}
+
+/* claim next ring slot; main thread and encoder worker may race here */
+static struct trace_ev *slot(void)
+{
+	unsigned int i;
+
+#ifdef _WIN32
+	i = (unsigned int)InterlockedIncrement((volatile LONG *)&ring_pos) - 1;
+#else
+	i = __atomic_fetch_add(&ring_pos, 1, __ATOMIC_RELAXED);
+#endif
+	return ring + (i & (TRACE_RING - 1));
+}
+
+void ophh_trace_event(unsigned int _id, int _pt, unsigned long long _t)
+{
+	unsigned long long now = ophh_trace_ns();
+	struct trace_ev *e = slot();
+
+	if (!_t)
+		_t = now;
+	e->ts = _t;
+	e->dur = now - _t;
+	e->id = _id;
+	e->pt = _pt;
+}
+
+void ophh_trace_mark(unsigned int _id, int _pt, unsigned long long _ts)
+{
+	struct trace_ev *e = slot();
+
+	e->ts = _ts;
+	e->dur = 0;
+	e->id = _id;
+	e->pt = _pt;
+}
+
+void ophh_trace_start(void)
+{
+	ophh_trace_on = 0;
+	memset(ring, 0, sizeof(ring));
+	ring_pos = 0;
+	t_start = ophh_trace_ns();
+	ophh_trace_on = 1;
+}
+
+int ophh_trace_dump(const char *_file)
+{
+	FILE *f;
+	unsigned int i, n, first;
+	struct trace_ev *e;
+	int pid, cnt = 0;
+
+	ophh_trace_on = 0;
+	f = fopen(_file, "wt");
+	if (!f)
+		return -1;
+
+	n = ring_pos;
+	first = (n > TRACE_RING) ? n - TRACE_RING : 0;
+
+	fprintf(f, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+	/* one process per direction, one track per stage */
+	fprintf(f, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"TX\"}},\n");
+	fprintf(f, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":2,\"args\":{\"name\":\"RX\"}}");
+	for (i = 0; i < OPHH_TR_POINTS; i++)
+		fprintf(f, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+			(i < OPHH_TR_RECV) ? 1 : 2, i + 1, tr_name[i]);
+
+	for (i = first; i < n; i++) {
+		e = ring + (i & (TRACE_RING - 1));
+		if (e->pt < 0 || e->pt >= OPHH_TR_POINTS || e->ts < t_start)
+			continue;
+		pid = (e->pt < OPHH_TR_RECV) ? 1 : 2;
+		fprintf(f, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,",
+			tr_name[e->pt], (pid == 1) ? "tx" : "rx", pid, e->pt + 1,
+			(e->ts - t_start) / 1000.0);
+		if (e->dur)
+			fprintf(f, "\"ph\":\"X\",\"dur\":%.3f,", e->dur / 1000.0);
+		else
+			fprintf(f, "\"ph\":\"i\",\"s\":\"t\",");
+		fprintf(f, "\"args\":{\"pkt\":%u}}", e->id);
+		cnt++;
+	}
+	fprintf(f, "\n]}\n");
+	fclose(f);
+	return cnt;
+}
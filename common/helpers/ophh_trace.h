@@ -0,0 +1,50 @@
+#pragma once
+
+#ifndef _OPHH_TRACE_H_
+#define _OPHH_TRACE_H_
+
+/* Per-packet pipeline tracing.  Stages of a voice packet are recorded with
+ * nanosecond timestamps into a lock-free in-memory ring and dumped on
+ * request as Chrome/Perfetto trace JSON (chrome://tracing, ui.perfetto.dev).
+ * While tracing is off every trace point costs one flag test. */
+
+enum ophh_trace_point {
+	/* outgoing packet */
+	OPHH_TR_CAPTURE,	/* frame grabbed (instant) */
+	OPHH_TR_PREPROC,	/* noise suppression, AGC, VAD */
+	OPHH_TR_ENCODE,
+	OPHH_TR_ENCRYPT,
+	OPHH_TR_SEND,
+	/* incoming packet */
+	OPHH_TR_RECV,
+	OPHH_TR_DECRYPT,
+	OPHH_TR_QUEUE,		/* stored to packet buffer (instant) */
+	OPHH_TR_DECODE,
+	OPHH_TR_RESAMPLE,
+	OPHH_TR_PLAY,		/* first sample leaves the device (instant) */
+	OPHH_TR_POINTS
+};
+
+extern volatile int ophh_trace_on;
+
+/* Monotonic clock in nanoseconds. */
+unsigned long long ophh_trace_ns(void);
+
+/* Start of a stage: timestamp while tracing, 0 otherwise. */
+#define OPHH_TRACE_T() (ophh_trace_on ? ophh_trace_ns() : 0ULL)
+
+/* Stage _pt of packet _id that began at _t ends now (_t==0: instant now). */
+#define OPHH_TRACE(_id, _pt, _t) \
+	do { if (ophh_trace_on) ophh_trace_event((_id), (_pt), (_t)); } while (0)
+
+void ophh_trace_event(unsigned int _id, int _pt, unsigned long long _t);
+/* Instant event at given time (may lie in the future, e.g. playout). */
+void ophh_trace_mark(unsigned int _id, int _pt, unsigned long long _ts);
+
+/* Clear the ring and enable tracing. */
+void ophh_trace_start(void);
+/* Disable tracing and write recorded events to _file.
+ * Returns number of events written or -1. */
+int ophh_trace_dump(const char *_file);
+
+#endif /* _OPHH_TRACE_H_ */
@@ -1,5 +1,14 @@
 #include <stdint.h>
 
+/* take byte order from the compiler when the build does not force one */
+#if !defined(M_BIG_ENDIAN) && !defined(M_LITTLE_ENDIAN) && defined(__BYTE_ORDER__)
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define M_BIG_ENDIAN
+#else
+#define M_LITTLE_ENDIAN
+#endif
+#endif
+
 #if defined(M_BIG_ENDIAN) && !defined(M_LITTLE_ENDIAN)
 
 #define htons(A) (A)
@@ -16,7 +25,7 @@
 		(((uint32_t)(A) & 0x0000ff00) << 8) | \
 		(((uint32_t)(A) & 0x000000ff) << 24))
 #define ntohs htons
-#define ntohl htohl
+#define ntohl htonl
 
 #else
 
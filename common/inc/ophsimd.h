@@ -0,0 +1,97 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/*
+ Four lane float and two lane double helpers shared by the hand-vectorised
+ encoder kernels of the float codecs (G.729, AMR, CELP).  The build selects
+ the SSE2 or the AArch64 NEON version with _USE_SSE2 or _USE_NEON (see
+ Makefile-simd.inc); OPH_SIMD_V4 is defined when one of them is in use and
+ the codecs keep their plain C loops otherwise.
+*/
+
+#pragma once
+
+#ifndef _OPHSIMD_H_
+#define _OPHSIMD_H_
+
+#if defined(_USE_SSE2)
+
+#include <emmintrin.h>
+
+#define OPH_SIMD_V4
+
+typedef __m128 v4f;
+
+#define v4_load(p) _mm_loadu_ps(p)
+#define v4_store(p, v) _mm_storeu_ps((p), (v))
+#define v4_zero() _mm_setzero_ps()
+#define v4_set1(x) _mm_set1_ps(x)
+#define v4_add(a, b) _mm_add_ps((a), (b))
+#define v4_sub(a, b) _mm_sub_ps((a), (b))
+#define v4_mul(a, b) _mm_mul_ps((a), (b))
+#define v4_div(a, b) _mm_div_ps((a), (b))
+
+/* Lane 3 of a followed by lanes 0 to 2 of b */
+#define v4_ext3(a, b) \
+	_mm_shuffle_ps(_mm_shuffle_ps((a), (b), _MM_SHUFFLE(0, 0, 3, 3)), \
+		       (b), _MM_SHUFFLE(2, 1, 2, 0))
+
+/* Sum of the four lanes */
+static inline float v4_sum(v4f a)
+{
+	a = _mm_add_ps(a, _mm_movehl_ps(a, a));
+	a = _mm_add_ss(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)));
+	return _mm_cvtss_f32(a);
+}
+
+/* Nonzero if a > b in any lane */
+#define v4_any_gt(a, b) _mm_movemask_ps(_mm_cmpgt_ps((a), (b)))
+
+typedef __m128d v2d;
+
+#define v2_store(p, v) _mm_storeu_pd((p), (v))
+#define v2_set1(x) _mm_set1_pd(x)
+#define v2_add(a, b) _mm_add_pd((a), (b))
+
+/* Lanes 0 and 1, or 2 and 3, of a float vector widened to double */
+#define v2_cvt_lo(a) _mm_cvtps_pd(a)
+#define v2_cvt_hi(a) _mm_cvtps_pd(_mm_movehl_ps((a), (a)))
+
+#elif defined(_USE_NEON) && defined(__aarch64__)
+
+#include <arm_neon.h>
+
+#define OPH_SIMD_V4
+
+typedef float32x4_t v4f;
+
+#define v4_load(p) vld1q_f32(p)
+#define v4_store(p, v) vst1q_f32((p), (v))
+#define v4_zero() vdupq_n_f32(0.0f)
+#define v4_set1(x) vdupq_n_f32(x)
+#define v4_add(a, b) vaddq_f32((a), (b))
+#define v4_sub(a, b) vsubq_f32((a), (b))
+#define v4_mul(a, b) vmulq_f32((a), (b))
+#define v4_div(a, b) vdivq_f32((a), (b))
+
+/* Lane 3 of a followed by lanes 0 to 2 of b */
+#define v4_ext3(a, b) vextq_f32((a), (b), 3)
+
+/* Sum of the four lanes */
+#define v4_sum(a) vaddvq_f32(a)
+
+/* Nonzero if a > b in any lane */
+#define v4_any_gt(a, b) vmaxvq_u32(vcgtq_f32((a), (b)))
+
+typedef float64x2_t v2d;
+
+#define v2_store(p, v) vst1q_f64((p), (v))
+#define v2_set1(x) vdupq_n_f64(x)
+#define v2_add(a, b) vaddq_f64((a), (b))
+
+/* Lanes 0 and 1, or 2 and 3, of a float vector widened to double */
+#define v2_cvt_lo(a) vcvt_f64_f32(vget_low_f32(a))
+#define v2_cvt_hi(a) vcvt_high_f64_f32(a)
+
+#endif
+
+#endif /* _OPHSIMD_H_ */
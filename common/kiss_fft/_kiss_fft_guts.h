@@ -153,6 +153,127 @@ struct kiss_fft_state {
                (x)->i = spx_cos_norm((phase)-32768);\
 }while(0)
 
+/* Two complex values per vector register.  Only the single precision build
+   uses this, with instructions every x86-64 or AArch64 CPU has, so no run
+   time check is needed.  The operations are those of C_MUL/C_ADD/C_SUB in
+   the same order, so results match the scalar code. */
+#if !defined(FIXED_POINT) && !defined(USE_SIMD) && !defined(KISS_FFT_NO_VEC)
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define KISS_FFT_VEC
+typedef __m128 kf_vcpx;
+
+#define KF_VLOAD(p) _mm_loadu_ps((const float *)(p))
+#define KF_VSTORE(p,v) _mm_storeu_ps((float *)(p), (v))
+#define KF_VADD(a,b) _mm_add_ps((a), (b))
+#define KF_VSUB(a,b) _mm_sub_ps((a), (b))
+
+#define KF_VSCALE(a,s) _mm_mul_ps((a), _mm_set1_ps(s))
+
+/* p[0] and p[stride] */
+static inline kf_vcpx kf_vload2(const kiss_fft_cpx * p, size_t stride)
+{
+	return _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)p),
+			    (const __m64 *)(p + stride));
+}
+
+static inline void kf_vstore2(kiss_fft_cpx * p, size_t stride, kf_vcpx v)
+{
+	_mm_storel_pi((__m64 *)p, v);
+	_mm_storeh_pi((__m64 *)(p + stride), v);
+}
+
+/* p[0] in both halves */
+static inline kf_vcpx kf_vdup(const kiss_fft_cpx * p)
+{
+	return _mm_castpd_ps(_mm_load1_pd((const double *)p));
+}
+
+/* Flips the sign of the real (re = 1) or imaginary (re = 0) parts.  The
+   multiply by -1 is exact; the usual sign bit XOR got both variants merged
+   into one by GCC 12 under -ffast-math. */
+static inline kf_vcpx kf_vneg(kf_vcpx a, int re)
+{
+	return _mm_mul_ps(a, re ? _mm_setr_ps(-1.f, 1.f, -1.f, 1.f)
+			  : _mm_setr_ps(1.f, -1.f, 1.f, -1.f));
+}
+
+/* Swaps the real and imaginary parts */
+static inline kf_vcpx kf_vswap(kf_vcpx a)
+{
+	return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+/* Swaps the two complex values */
+static inline kf_vcpx kf_vrev(kf_vcpx a)
+{
+	return _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 0, 3, 2));
+}
+
+static inline kf_vcpx kf_vcmul(kf_vcpx a, kf_vcpx b)
+{
+	__m128 br = _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 0, 0));
+	__m128 bi = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 1, 1));
+	return _mm_add_ps(_mm_mul_ps(a, br),
+			  kf_vneg(_mm_mul_ps(kf_vswap(a), bi), 1));
+}
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define KISS_FFT_VEC
+typedef float32x4_t kf_vcpx;
+
+#define KF_VLOAD(p) vld1q_f32((const float *)(p))
+#define KF_VSTORE(p,v) vst1q_f32((float *)(p), (v))
+#define KF_VADD(a,b) vaddq_f32((a), (b))
+#define KF_VSUB(a,b) vsubq_f32((a), (b))
+
+#define KF_VSCALE(a,s) vmulq_n_f32((a), (s))
+
+static inline kf_vcpx kf_vload2(const kiss_fft_cpx * p, size_t stride)
+{
+	return vcombine_f32(vld1_f32((const float *)p),
+			    vld1_f32((const float *)(p + stride)));
+}
+
+static inline void kf_vstore2(kiss_fft_cpx * p, size_t stride, kf_vcpx v)
+{
+	vst1_f32((float *)p, vget_low_f32(v));
+	vst1_f32((float *)(p + stride), vget_high_f32(v));
+}
+
+static inline kf_vcpx kf_vdup(const kiss_fft_cpx * p)
+{
+	float32x2_t v = vld1_f32((const float *)p);
+	return vcombine_f32(v, v);
+}
+
+static inline kf_vcpx kf_vneg(kf_vcpx a, int re)
+{
+	static const float mre[4] = { -1.f, 1.f, -1.f, 1.f };
+	static const float mim[4] = { 1.f, -1.f, 1.f, -1.f };
+	return vmulq_f32(a, vld1q_f32(re ? mre : mim));
+}
+
+static inline kf_vcpx kf_vswap(kf_vcpx a)
+{
+	return vrev64q_f32(a);
+}
+
+static inline kf_vcpx kf_vrev(kf_vcpx a)
+{
+	return vextq_f32(a, a, 2);
+}
+
+static inline kf_vcpx kf_vcmul(kf_vcpx a, kf_vcpx b)
+{
+	float32x4_t br = vtrn1q_f32(b, b);
+	float32x4_t bi = vtrn2q_f32(b, b);
+	return vaddq_f32(vmulq_f32(a, br),
+			 kf_vneg(vmulq_f32(kf_vswap(a), bi), 1));
+}
+#endif
+#endif
+
 /* a debugging function */
 #define pcpx(c)\
     fprintf(stderr,"%g + %gi\n",(double)((c)->r),(double)((c)->i) )
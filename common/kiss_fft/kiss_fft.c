@@ -27,6 +27,27 @@ THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
  fixed or floating point complex numbers.  It also delares the kf_ internal functions.
  */
 
+#ifdef KISS_FFT_VEC
+/* Radix-2 butterflies for two consecutive j at a time.  In floating point
+   both directions of kf_bfly2 compute the same thing. */
+static int kf_bfly2_vec(kiss_fft_cpx * Fout, const size_t fstride,
+			const kiss_fft_cpx * tw, int m)
+{
+	kf_vcpx t, f;
+	int j;
+
+	for (j = 0; j + 2 <= m; j += 2) {
+		t = kf_vcmul(KF_VLOAD(Fout + m),
+			     kf_vload2(tw + j * fstride, fstride));
+		f = KF_VLOAD(Fout);
+		KF_VSTORE(Fout + m, KF_VSUB(f, t));
+		KF_VSTORE(Fout, KF_VADD(f, t));
+		Fout += 2;
+	}
+	return j;
+}
+#endif
+
 static void kf_bfly2(kiss_fft_cpx * Fout,
 		     const size_t fstride,
 		     const kiss_fft_cfg st, int m, int N, int mm)
@@ -39,9 +60,15 @@ static void kf_bfly2(kiss_fft_cpx * Fout,
 		kiss_fft_cpx *Fout_beg = Fout;
 		for (i = 0; i < N; i++) {
 			Fout = Fout_beg + i * mm;
-			Fout2 = Fout + m;
 			tw1 = st->twiddles;
-			for (j = 0; j < m; j++) {
+			j = 0;
+#ifdef KISS_FFT_VEC
+			j = kf_bfly2_vec(Fout, fstride, tw1, m);
+			Fout += j;
+			tw1 += j * fstride;
+#endif
+			Fout2 = Fout + m;
+			for (; j < m; j++) {
 				/* Almost the same as the code path below, except that we divide the input by two
 				   (while keeping the best accuracy possible) */
 				spx_word32_t tr, ti;
@@ -77,9 +104,15 @@ static void kf_bfly2(kiss_fft_cpx * Fout,
 		kiss_fft_cpx *Fout_beg = Fout;
 		for (i = 0; i < N; i++) {
 			Fout = Fout_beg + i * mm;
-			Fout2 = Fout + m;
 			tw1 = st->twiddles;
-			for (j = 0; j < m; j++) {
+			j = 0;
+#ifdef KISS_FFT_VEC
+			j = kf_bfly2_vec(Fout, fstride, tw1, m);
+			Fout += j;
+			tw1 += j * fstride;
+#endif
+			Fout2 = Fout + m;
+			for (; j < m; j++) {
 				C_MUL(t, *Fout2, *tw1);
 				tw1 += fstride;
 				C_SUB(*Fout2, *Fout, t);
@@ -91,6 +124,39 @@ static void kf_bfly2(kiss_fft_cpx * Fout,
 	}
 }
 
+#ifdef KISS_FFT_VEC
+/* Radix-4 butterflies for two consecutive j at a time; returns how many of
+   the m butterflies were done, the caller finishes the odd one */
+static int kf_bfly4_vec(kiss_fft_cpx * Fout, const size_t fstride,
+			const kiss_fft_cpx * tw, int m, int inverse)
+{
+	kf_vcpx s0, s1, s2, s3, s4, s5, f;
+	int j;
+
+	for (j = 0; j + 2 <= m; j += 2) {
+		s0 = kf_vcmul(KF_VLOAD(Fout + m),
+			      kf_vload2(tw + j * fstride, fstride));
+		s1 = kf_vcmul(KF_VLOAD(Fout + 2 * m),
+			      kf_vload2(tw + 2 * j * fstride, 2 * fstride));
+		s2 = kf_vcmul(KF_VLOAD(Fout + 3 * m),
+			      kf_vload2(tw + 3 * j * fstride, 3 * fstride));
+		f = KF_VLOAD(Fout);
+		s5 = KF_VSUB(f, s1);
+		f = KF_VADD(f, s1);
+		s3 = KF_VADD(s0, s2);
+		s4 = KF_VSUB(s0, s2);
+		KF_VSTORE(Fout + 2 * m, KF_VSUB(f, s3));
+		KF_VSTORE(Fout, KF_VADD(f, s3));
+		/* s4 times -i (forward) or +i (inverse) */
+		s4 = kf_vneg(kf_vswap(s4), inverse);
+		KF_VSTORE(Fout + m, KF_VADD(s5, s4));
+		KF_VSTORE(Fout + 3 * m, KF_VSUB(s5, s4));
+		Fout += 2;
+	}
+	return j;
+}
+#endif
+
 static void kf_bfly4(kiss_fft_cpx * Fout,
 		     const size_t fstride,
 		     const kiss_fft_cfg st, int m, int N, int mm)
@@ -106,7 +172,16 @@ static void kf_bfly4(kiss_fft_cpx * Fout,
 		for (i = 0; i < N; i++) {
 			Fout = Fout_beg + i * mm;
 			tw3 = tw2 = tw1 = st->twiddles;
-			for (j = 0; j < m; j++) {
+			j = 0;
+#ifdef KISS_FFT_VEC
+			j = kf_bfly4_vec(Fout, fstride, st->twiddles, m,
+					 st->inverse);
+			Fout += j;
+			tw1 += j * fstride;
+			tw2 += j * fstride * 2;
+			tw3 += j * fstride * 3;
+#endif
+			for (; j < m; j++) {
 				C_MUL(scratch[0], Fout[m], *tw1);
 				C_MUL(scratch[1], Fout[m2], *tw2);
 				C_MUL(scratch[2], Fout[m3], *tw3);
@@ -133,7 +208,16 @@ static void kf_bfly4(kiss_fft_cpx * Fout,
 		for (i = 0; i < N; i++) {
 			Fout = Fout_beg + i * mm;
 			tw3 = tw2 = tw1 = st->twiddles;
-			for (j = 0; j < m; j++) {
+			j = 0;
+#ifdef KISS_FFT_VEC
+			j = kf_bfly4_vec(Fout, fstride, st->twiddles, m,
+					 st->inverse);
+			Fout += j;
+			tw1 += j * fstride;
+			tw2 += j * fstride * 2;
+			tw3 += j * fstride * 3;
+#endif
+			for (; j < m; j++) {
 				C_MUL4(scratch[0], Fout[m], *tw1);
 				C_MUL4(scratch[1], Fout[m2], *tw2);
 				C_MUL4(scratch[2], Fout[m3], *tw3);
@@ -286,6 +370,55 @@ static void kf_bfly5(kiss_fft_cpx * Fout,
 }
 
 /* perform the butterfly for one stage of a mixed radix FFT */
+#ifdef KISS_FFT_VEC
+/* Two radix-5 butterfly groups side by side, the one at Fout in the low
+   half and the one mm further in the high half.  They share the twiddles,
+   which is what makes the m == 1 stages (the common case) vectorizable. */
+static void kf_bfly5_vec(kiss_fft_cpx * Fout, const size_t fstride,
+			 const kiss_fft_cfg st, int m, int mm)
+{
+	kiss_fft_cpx *tw = st->twiddles;
+	const kiss_fft_cpx ya = tw[fstride * m];
+	const kiss_fft_cpx yb = tw[fstride * 2 * m];
+	kf_vcpx s0, s1, s2, s3, s4, s5, s6, s7, s8, s9, s10, s11, s12;
+	int u;
+
+	for (u = 0; u < m; ++u) {
+		kiss_fft_cpx *F = Fout + u;
+
+		s0 = kf_vload2(F, mm);
+		s1 = kf_vcmul(kf_vload2(F + m, mm), kf_vdup(&tw[u * fstride]));
+		s2 = kf_vcmul(kf_vload2(F + 2 * m, mm),
+			      kf_vdup(&tw[2 * u * fstride]));
+		s3 = kf_vcmul(kf_vload2(F + 3 * m, mm),
+			      kf_vdup(&tw[3 * u * fstride]));
+		s4 = kf_vcmul(kf_vload2(F + 4 * m, mm),
+			      kf_vdup(&tw[4 * u * fstride]));
+
+		s7 = KF_VADD(s1, s4);
+		s10 = KF_VSUB(s1, s4);
+		s8 = KF_VADD(s2, s3);
+		s9 = KF_VSUB(s2, s3);
+
+		kf_vstore2(F, mm, KF_VADD(s0, KF_VADD(s7, s8)));
+
+		s5 = KF_VADD(KF_VADD(s0, KF_VSCALE(s7, ya.r)),
+			     KF_VSCALE(s8, yb.r));
+		s6 = kf_vneg(KF_VADD(KF_VSCALE(kf_vswap(s10), ya.i),
+				     KF_VSCALE(kf_vswap(s9), yb.i)), 0);
+		kf_vstore2(F + m, mm, KF_VSUB(s5, s6));
+		kf_vstore2(F + 4 * m, mm, KF_VADD(s5, s6));
+
+		s11 = KF_VADD(KF_VADD(s0, KF_VSCALE(s7, yb.r)),
+			      KF_VSCALE(s8, ya.r));
+		s12 = kf_vneg(KF_VSUB(KF_VSCALE(kf_vswap(s9), ya.i),
+				      KF_VSCALE(kf_vswap(s10), yb.i)), 0);
+		kf_vstore2(F + 2 * m, mm, KF_VADD(s11, s12));
+		kf_vstore2(F + 3 * m, mm, KF_VSUB(s11, s12));
+	}
+}
+#endif
+
 static void kf_bfly_generic(kiss_fft_cpx * Fout,
 			    const size_t fstride,
 			    const kiss_fft_cfg st, int m, int p)
@@ -436,7 +569,12 @@ void kf_work(kiss_fft_cpx * Fout,
 		kf_bfly4(Fout, fstride, st, m, N, m2);
 		break;
 	case 5:
-		for (i = 0; i < N; i++) {
+		i = 0;
+#ifdef KISS_FFT_VEC
+		for (; i + 2 <= N; i += 2)
+			kf_bfly5_vec(Fout_beg + i * m2, fstride, st, m, m2);
+#endif
+		for (; i < N; i++) {
 			Fout = Fout_beg + i * m2;
 			kf_bfly5(Fout, fstride, st, m);
 		}
@@ -549,3 +687,53 @@ void kiss_fft(kiss_fft_cfg cfg, const kiss_fft_cpx * fin, kiss_fft_cpx * fout)
 {
 	kiss_fft_stride(cfg, fin, fout, 1);
 }
+
+/* Shared plans (see kiss_fft_shared) */
+#define KISS_FFT_SHARED 8
+
+static struct {
+	kiss_fft_cfg st;
+	int refs;
+} kf_shared[KISS_FFT_SHARED];
+
+kiss_fft_cfg kiss_fft_shared(int nfft, int inverse_fft)
+{
+	int i, slot = -1;
+	kiss_fft_cfg st;
+
+	for (i = 0; i < KISS_FFT_SHARED; i++) {
+		st = kf_shared[i].st;
+		if (!st) {
+			if (slot < 0)
+				slot = i;
+		} else if (st->nfft == nfft && st->inverse == inverse_fft) {
+			kf_shared[i].refs++;
+			return st;
+		}
+	}
+	st = kiss_fft_alloc(nfft, inverse_fft, NULL, NULL);
+	/* table full: plan stays private, kiss_fft_release() frees it */
+	if (st && slot >= 0) {
+		kf_shared[slot].st = st;
+		kf_shared[slot].refs = 1;
+	}
+	return st;
+}
+
+void kiss_fft_release(kiss_fft_cfg cfg)
+{
+	int i;
+
+	if (!cfg)
+		return;
+	for (i = 0; i < KISS_FFT_SHARED; i++) {
+		if (kf_shared[i].st == cfg) {
+			if (--kf_shared[i].refs == 0) {
+				kf_shared[i].st = NULL;
+				kiss_fft_free(cfg);
+			}
+			return;
+		}
+	}
+	kiss_fft_free(cfg);
+}
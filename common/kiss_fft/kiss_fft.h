@@ -97,6 +97,17 @@ extern "C" {
    buffer and can be simply free()d when no longer needed*/
 #define kiss_fft_free speex_free
 
+/*
+ Shared read-only plan for (nfft, inverse_fft), reference counted.
+ All users of the same size and direction get the same state, so the
+ twiddles are computed and stored once per process. kiss_fft() never
+ writes to the state, so a shared plan may be used concurrently.
+ Release with kiss_fft_release(), not free(). Getting and releasing
+ plans is not thread-safe: do it where codec instances are created.
+ * */
+	kiss_fft_cfg kiss_fft_shared(int nfft, int inverse_fft);
+	void kiss_fft_release(kiss_fft_cfg cfg);
+
 /*
  Cleans up some memory that gets managed internally. Not necessary to call, but it might clean up 
  your compiler output to call this before you exit.
@@ -44,25 +44,35 @@ kiss_fftr_cfg kiss_fftr_alloc(int nfft, int inverse_fft, void *mem,
 	}
 	nfft >>= 1;
 
-	kiss_fft_alloc(nfft, inverse_fft, NULL, &subsize);
-	memneeded =
-	    sizeof(struct kiss_fftr_state) + subsize +
-	    sizeof(kiss_fft_cpx) * (nfft * 2);
-
 	if (lenmem == NULL) {
+		/* own buffers only, complex sub-FFT is a shared plan */
+		memneeded =
+		    sizeof(struct kiss_fftr_state) +
+		    sizeof(kiss_fft_cpx) * (nfft * 2);
 		st = (kiss_fftr_cfg) KISS_FFT_MALLOC(memneeded);
+		if (!st)
+			return NULL;
+		st->substate = kiss_fft_shared(nfft, inverse_fft);
+		if (!st->substate) {
+			speex_free(st);
+			return NULL;
+		}
+		st->tmpbuf = (kiss_fft_cpx *) (st + 1);
 	} else {
+		kiss_fft_alloc(nfft, inverse_fft, NULL, &subsize);
+		memneeded =
+		    sizeof(struct kiss_fftr_state) + subsize +
+		    sizeof(kiss_fft_cpx) * (nfft * 2);
 		if (*lenmem >= memneeded)
 			st = (kiss_fftr_cfg) mem;
 		*lenmem = memneeded;
+		if (!st)
+			return NULL;
+		st->substate = (kiss_fft_cfg) (st + 1);	/*just beyond kiss_fftr_state struct */
+		st->tmpbuf = (kiss_fft_cpx *) (((char *)st->substate) + subsize);
+		kiss_fft_alloc(nfft, inverse_fft, st->substate, &subsize);
 	}
-	if (!st)
-		return NULL;
-
-	st->substate = (kiss_fft_cfg) (st + 1);	/*just beyond kiss_fftr_state struct */
-	st->tmpbuf = (kiss_fft_cpx *) (((char *)st->substate) + subsize);
 	st->super_twiddles = st->tmpbuf + nfft;
-	kiss_fft_alloc(nfft, inverse_fft, st->substate, &subsize);
 
 #ifdef FIXED_POINT
 	for (i = 0; i < nfft; ++i) {
@@ -83,6 +93,15 @@ kiss_fftr_cfg kiss_fftr_alloc(int nfft, int inverse_fft, void *mem,
 	return st;
 }
 
+void kiss_fftr_free(kiss_fftr_cfg st)
+{
+	if (!st)
+		return;
+	if (st->substate != (kiss_fft_cfg) (st + 1))
+		kiss_fft_release(st->substate);
+	speex_free(st);
+}
+
 void kiss_fftr(kiss_fftr_cfg st, const kiss_fft_scalar * timedata,
 	       kiss_fft_cpx * freqdata)
 {
@@ -211,7 +230,24 @@ void kiss_fftr2(kiss_fftr_cfg st, const kiss_fft_scalar * timedata,
 	freqdata[0] = tdc.r + tdc.i;
 	freqdata[2 * ncfft - 1] = tdc.r - tdc.i;
 
-	for (k = 1; k <= ncfft / 2; ++k) {
+	k = 1;
+#ifdef KISS_FFT_VEC
+	/* Bins k, k+1 and their mirrors ncfft-k, ncfft-k-1 at once.  When k+1
+	   is the middle bin both stores hit it, the mirrored one last, as in
+	   the scalar loop. */
+	for (; k + 1 <= ncfft / 2; k += 2) {
+		kf_vcpx a, b, f1, f2, tw;
+		a = KF_VLOAD(st->tmpbuf + k);
+		b = kf_vrev(KF_VLOAD(st->tmpbuf + ncfft - k - 1));
+		f2 = KF_VADD(a, kf_vneg(b, 1));
+		f1 = KF_VADD(a, kf_vneg(b, 0));
+		tw = kf_vcmul(f2, KF_VLOAD(st->super_twiddles + k));
+		KF_VSTORE(freqdata + 2 * k - 1, KF_VSCALE(KF_VADD(f1, tw), .5f));
+		KF_VSTORE(freqdata + 2 * (ncfft - k - 1) - 1,
+			  kf_vrev(kf_vneg(KF_VSCALE(KF_VSUB(f1, tw), .5f), 0)));
+	}
+#endif
+	for (; k <= ncfft / 2; ++k) {
 		/*fpk    = st->tmpbuf[k]; 
 		   fpnk.r =   st->tmpbuf[ncfft-k].r;
 		   fpnk.i = - st->tmpbuf[ncfft-k].i;
@@ -299,7 +335,21 @@ void kiss_fftri2(kiss_fftr_cfg st, const kiss_fft_scalar * freqdata,
 	st->tmpbuf[0].i = freqdata[0] - freqdata[2 * ncfft - 1];
 	/*C_FIXDIV(st->tmpbuf[0],2); */
 
-	for (k = 1; k <= ncfft / 2; ++k) {
+	k = 1;
+#ifdef KISS_FFT_VEC
+	for (; k + 1 <= ncfft / 2; k += 2) {
+		kf_vcpx fk, fnkc, fek, fok;
+		fk = KF_VLOAD(freqdata + 2 * k - 1);
+		fnkc = kf_vneg(kf_vrev(KF_VLOAD(freqdata + 2 * (ncfft - k - 1) - 1)),
+			       0);
+		fek = KF_VADD(fk, fnkc);
+		fok = kf_vcmul(KF_VSUB(fk, fnkc), KF_VLOAD(st->super_twiddles + k));
+		KF_VSTORE(st->tmpbuf + k, KF_VADD(fek, fok));
+		KF_VSTORE(st->tmpbuf + ncfft - k - 1,
+			  kf_vrev(kf_vneg(KF_VSUB(fek, fok), 0)));
+	}
+#endif
+	for (; k <= ncfft / 2; ++k) {
 		kiss_fft_cpx fk, fnkc, fek, fok, tmp;
 		fk.r = freqdata[2 * k - 1];
 		fk.i = freqdata[2 * k];
@@ -47,7 +47,11 @@ extern "C" {
  output timedata has nfft scalar points
 */
 
-#define kiss_fftr_free speex_free
+/*
+ Frees state from kiss_fftr_alloc(nfft, inverse_fft, NULL, NULL): the complex
+ sub-FFT of such state is a shared plan (see kiss_fft_shared).
+*/
+	void kiss_fftr_free(kiss_fftr_cfg st);
 
 #ifdef __cplusplus
 }
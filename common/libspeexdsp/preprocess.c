@@ -69,6 +69,14 @@
 #include "math_approx.h"
 #include "os_support.h"
 
+#ifndef FIXED_POINT
+#if defined(_USE_SSE2)
+#include "preprocess_sse.h"
+#elif defined(_USE_NEON) && defined(__aarch64__)
+#include "preprocess_neon.h"
+#endif
+#endif
+
 #define LOUDNESS_EXP 5.f
 #define AMP_SCALE .001f
 #define AMP_SCALE_1 1000.f
@@ -413,19 +421,21 @@ static void compute_gain_floor(int noise_suppress, int effective_echo_suppress,
    which multiplied by xi/(1+xi) is the optimal gain
    in the loudness domain ( sqrt[amplitude] )
 */
+static const float hypergeom_table[21] = {
+	0.82157f, 1.02017f, 1.20461f, 1.37534f, 1.53363f, 1.68092f,
+	    1.81865f,
+	1.94811f, 2.07038f, 2.18638f, 2.29688f, 2.40255f, 2.50391f,
+	    2.60144f,
+	2.69551f, 2.78647f, 2.87458f, 2.96015f, 3.04333f, 3.12431f,
+	    3.20326f
+};
+
 static inline spx_word32_t hypergeom_gain(spx_word32_t xx)
 {
 	int ind;
 	float integer, frac;
 	float x;
-	static const float table[21] = {
-		0.82157f, 1.02017f, 1.20461f, 1.37534f, 1.53363f, 1.68092f,
-		    1.81865f,
-		1.94811f, 2.07038f, 2.18638f, 2.29688f, 2.40255f, 2.50391f,
-		    2.60144f,
-		2.69551f, 2.78647f, 2.87458f, 2.96015f, 3.04333f, 3.12431f,
-		    3.20326f
-	};
+	const float *table = hypergeom_table;
 	x = EXPIN_SCALING_1 * xx;
 	integer = floor(2 * x);
 	ind = (int)integer;
@@ -438,6 +448,110 @@ static inline spx_word32_t hypergeom_gain(spx_word32_t xx)
 			       frac * table[ind + 1]) / sqrt(x + .0001f);
 }
 
+#ifdef OVERRIDE_PREPROCESS_V4
+/* The per-bin loops of speex_preprocess_run() four bins at a time.  Each
+   returns how many bins it did; the scalar loop finishes the rest. */
+
+static inline v4f hypergeom_gain4(v4f xx)
+{
+	int ind[4];
+	const float *table = hypergeom_table;
+	v4f x = v4_mul(v4_set1(EXPIN_SCALING_1), xx);
+	v4f x2 = v4_add(x, x);
+	/* Lanes outside [0,20) are replaced below; clamping keeps the table
+	   reads in bounds.  floor() equals truncation once clamped to >= 0. */
+	v4f integer = v4_trunc(v4_min(v4_max(x2, v4_set1(0.f)),
+				      v4_set1(19.f)), ind);
+	v4f frac = v4_sub(x2, integer);
+	v4f lo = v4_setr(table[ind[0]], table[ind[1]], table[ind[2]],
+			 table[ind[3]]);
+	v4f hi = v4_setr(table[ind[0] + 1], table[ind[1] + 1],
+			 table[ind[2] + 1], table[ind[3] + 1]);
+	v4f g = v4_div(v4_add(v4_mul(v4_sub(v4_set1(1.f), frac), lo),
+			      v4_mul(frac, hi)),
+		       v4_sqrt(v4_add(x, v4_set1(.0001f))));
+	g = v4_sel(v4_ge(x2, v4_set1(20.f)),
+		   v4_add(v4_set1(1.f), v4_div(v4_set1(.1296f), x)), g);
+	g = v4_sel(v4_lt(x2, v4_set1(0.f)), v4_set1(1.f), g);
+	return v4_mul(v4_set1(FRAC_SCALING), g);
+}
+
+static int update_noise_v4(const int *update_prob, const spx_word32_t * ps,
+			   spx_word32_t * noise, spx_word16_t beta,
+			   spx_word16_t beta_1, int len)
+{
+	int i;
+	for (i = 0; i + 4 <= len; i += 4) {
+		v4f n = v4_load(noise + i);
+		v4f p = v4_load(ps + i);
+		v4m upd = v4_or(v4_zero_i(update_prob + i), v4_lt(p, n));
+		v4f nn = v4_add(v4_mul(v4_set1(beta_1), n),
+				v4_mul(v4_set1(beta), p));
+		v4_store(noise + i, v4_sel(upd, v4_max(nn, v4_set1(0.f)), n));
+	}
+	return i;
+}
+
+static int update_snr_v4(const spx_word32_t * ps, const spx_word32_t * noise,
+			 const spx_word32_t * echo_noise,
+			 const spx_word32_t * reverb_estimate,
+			 const spx_word32_t * old_ps, spx_word16_t * post,
+			 spx_word16_t * prior, int len)
+{
+	int i;
+	const v4f one = v4_set1(1.f);
+	const v4f hundred = v4_set1(100.f);
+	for (i = 0; i + 4 <= len; i += 4) {
+		v4f old = v4_load(old_ps + i);
+		v4f tot_noise = v4_add(v4_add(v4_add(one, v4_load(noise + i)),
+					      v4_load(echo_noise + i)),
+				       v4_load(reverb_estimate + i));
+		v4f po = v4_min(v4_sub(v4_div(v4_load(ps + i), tot_noise), one),
+				hundred);
+		v4f r = v4_div(old, v4_add(old, tot_noise));
+		v4f gamma = v4_add(v4_set1(.1f), v4_mul(v4_set1(.89f),
+							v4_mul(r, r)));
+		v4f pr = v4_add(v4_mul(gamma, v4_max(po, v4_set1(0.f))),
+				v4_mul(v4_sub(one, gamma),
+				       v4_div(old, tot_noise)));
+		v4_store(post + i, po);
+		v4_store(prior + i, v4_min(pr, hundred));
+	}
+	return i;
+}
+
+static int linear_gain_v4(SpeexPreprocessState * st, const spx_word32_t * ps,
+			  int len)
+{
+	int i;
+	const v4f one = v4_set1(1.f);
+	for (i = 0; i + 4 <= len; i += 4) {
+		v4f prior = v4_load(st->prior + i);
+		v4f prior_ratio = v4_div(prior, v4_add(prior, one));
+		v4f theta = v4_mul(prior_ratio, v4_add(one, v4_load(st->post + i)));
+		v4f g = v4_min(one, v4_mul(prior_ratio, hypergeom_gain4(theta)));
+		v4f bark = v4_load(st->gain + i);
+		v4f gain_floor = v4_load(st->gain_floor + i);
+		v4f p = v4_load(st->gain2 + i);
+		v4f tmp;
+
+		/* Constrain the gain to be close to the Bark scale gain */
+		g = v4_sel(v4_lt(bark, v4_mul(v4_set1(.333f), g)),
+			   v4_mul(v4_set1(3.f), bark), g);
+		v4_store(st->old_ps + i,
+			 v4_add(v4_mul(v4_set1(.2f), v4_load(st->old_ps + i)),
+				v4_mul(v4_mul(v4_set1(.8f), v4_mul(g, g)),
+				       v4_load(ps + i))));
+		g = v4_max(g, gain_floor);
+		v4_store(st->gain + i, g);
+		tmp = v4_add(v4_mul(p, v4_sqrt(g)),
+			     v4_mul(v4_sub(one, p), v4_sqrt(gain_floor)));
+		v4_store(st->gain2 + i, v4_mul(tmp, tmp));
+	}
+	return i;
+}
+#endif
+
 static inline spx_word16_t qcurve(spx_word16_t x)
 {
 	return 1.f / (1.f + .15f / (SNR_SCALING_1 * x));
@@ -878,7 +992,11 @@ EXPORT int speex_preprocess_run(SpeexPreprocessState * st, spx_int16_t * x)
 	 */
 
 	/* Update the noise estimate for the frequencies where it can be */
-	for (i = 0; i < N; i++) {
+	i = 0;
+#ifdef OVERRIDE_PREPROCESS_V4
+	i = update_noise_v4(st->update_prob, st->ps, st->noise, beta, beta_1, N);
+#endif
+	for (; i < N; i++) {
 		if (!st->update_prob[i]
 		    || st->ps[i] < PSHR32(st->noise[i], NOISE_SHIFT))
 			st->noise[i] =
@@ -896,7 +1014,12 @@ EXPORT int speex_preprocess_run(SpeexPreprocessState * st, spx_int16_t * x)
 			st->old_ps[i] = ps[i];
 
 	/* Compute a posteriori SNR */
-	for (i = 0; i < N + M; i++) {
+	i = 0;
+#ifdef OVERRIDE_PREPROCESS_V4
+	i = update_snr_v4(ps, st->noise, st->echo_noise, st->reverb_estimate,
+			  st->old_ps, st->post, st->prior, N + M);
+#endif
+	for (; i < N + M; i++) {
 		spx_word16_t gamma;
 
 		/* Total noise estimate including residual echo and reverberation */
@@ -1065,7 +1188,11 @@ EXPORT int speex_preprocess_run(SpeexPreprocessState * st, spx_int16_t * x)
 					 st->gain_floor);
 
 		/* Compute gain according to the Ephraim-Malah algorithm -- linear frequency */
-		for (i = 0; i < N; i++) {
+		i = 0;
+#ifdef OVERRIDE_PREPROCESS_V4
+		i = linear_gain_v4(st, ps, N);
+#endif
+		for (; i < N; i++) {
 			spx_word32_t MM;
 			spx_word32_t theta;
 			spx_word16_t prior_ratio;
@@ -0,0 +1,74 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/**
+   @file preprocess_neon.h
+   @brief Four lane float helpers for the preprocessor (AArch64 NEON version)
+*/
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+   
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+   
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+   
+   - Neither the name of the Xiph.org Foundation nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+   
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE FOUNDATION OR
+   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <arm_neon.h>
+
+#define OVERRIDE_PREPROCESS_V4
+
+typedef float32x4_t v4f;
+typedef uint32x4_t v4m;
+
+#define v4_load(p) vld1q_f32(p)
+#define v4_store(p, v) vst1q_f32((p), (v))
+#define v4_set1(x) vdupq_n_f32(x)
+#define v4_add(a, b) vaddq_f32((a), (b))
+#define v4_sub(a, b) vsubq_f32((a), (b))
+#define v4_mul(a, b) vmulq_f32((a), (b))
+#define v4_div(a, b) vdivq_f32((a), (b))
+#define v4_sqrt(a) vsqrtq_f32(a)
+#define v4_min(a, b) vminq_f32((a), (b))
+#define v4_max(a, b) vmaxq_f32((a), (b))
+#define v4_lt(a, b) vcltq_f32((a), (b))
+#define v4_ge(a, b) vcgeq_f32((a), (b))
+#define v4_or(a, b) vorrq_u32((a), (b))
+#define v4_sel(m, a, b) vbslq_f32((m), (a), (b))
+
+static inline v4f v4_setr(float a, float b, float c, float d)
+{
+	const float v[4] = { a, b, c, d };
+	return vld1q_f32(v);
+}
+
+static inline v4m v4_zero_i(const int *p)
+{
+	return vceqq_s32(vld1q_s32(p), vdupq_n_s32(0));
+}
+
+static inline v4f v4_trunc(v4f a, int *idx)
+{
+	int32x4_t i = vcvtq_s32_f32(a);
+	vst1q_s32(idx, i);
+	return vcvtq_f32_s32(i);
+}
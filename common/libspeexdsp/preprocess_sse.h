@@ -0,0 +1,81 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/**
+   @file preprocess_sse.h
+   @brief Four lane float helpers for the preprocessor (SSE2 version)
+*/
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+   
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+   
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+   
+   - Neither the name of the Xiph.org Foundation nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+   
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE FOUNDATION OR
+   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <xmmintrin.h>
+
+#include <emmintrin.h>
+
+#define OVERRIDE_PREPROCESS_V4
+
+typedef __m128 v4f;
+typedef __m128 v4m;
+
+#define v4_load(p) _mm_loadu_ps(p)
+#define v4_store(p, v) _mm_storeu_ps((p), (v))
+#define v4_set1(x) _mm_set1_ps(x)
+#define v4_setr(a, b, c, d) _mm_setr_ps((a), (b), (c), (d))
+#define v4_add(a, b) _mm_add_ps((a), (b))
+#define v4_sub(a, b) _mm_sub_ps((a), (b))
+#define v4_mul(a, b) _mm_mul_ps((a), (b))
+#define v4_div(a, b) _mm_div_ps((a), (b))
+#define v4_sqrt(a) _mm_sqrt_ps(a)
+#define v4_min(a, b) _mm_min_ps((a), (b))
+#define v4_max(a, b) _mm_max_ps((a), (b))
+#define v4_lt(a, b) _mm_cmplt_ps((a), (b))
+#define v4_ge(a, b) _mm_cmpge_ps((a), (b))
+#define v4_or(a, b) _mm_or_ps((a), (b))
+
+/* m ? a : b, lane by lane */
+static inline v4f v4_sel(v4m m, v4f a, v4f b)
+{
+	return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+}
+
+/* Lanes where the int at p is zero */
+static inline v4m v4_zero_i(const int *p)
+{
+	return _mm_castsi128_ps(_mm_cmpeq_epi32
+				(_mm_loadu_si128((const __m128i *)p),
+				 _mm_setzero_si128()));
+}
+
+/* Truncates toward zero, storing the integers to idx and returning them
+   as floats */
+static inline v4f v4_trunc(v4f a, int *idx)
+{
+	__m128i i = _mm_cvttps_epi32(a);
+	_mm_storeu_si128((__m128i *)idx, i);
+	return _mm_cvtepi32_ps(i);
+}
@@ -120,6 +120,31 @@ static void speex_free(void *ptr)
 #include "resample_neon.h"
 #endif
 
+#ifdef _USE_AVX
+#include <ophh_cpu.h>
+#include "resample_avx.h"
+
+/* Set by speex_resampler_init_frac(); all threads store the same value */
+static int resample_use_avx = 0;
+
+/* The inline SSE versions stay as the fallback; naming them in parentheses
+   keeps the preprocessor from expanding the macro recursively */
+#define inner_product_single(a, b, len) \
+	(resample_use_avx ? inner_product_single_avx(a, b, len) : \
+	 (inner_product_single)(a, b, len))
+#define interpolate_product_single(a, b, len, oversample, frac) \
+	(resample_use_avx ? \
+	 interpolate_product_single_avx(a, b, len, oversample, frac) : \
+	 (interpolate_product_single)(a, b, len, oversample, frac))
+#define inner_product_double(a, b, len) \
+	(resample_use_avx ? inner_product_double_avx(a, b, len) : \
+	 (inner_product_double)(a, b, len))
+#define interpolate_product_double(a, b, len, oversample, frac) \
+	(resample_use_avx ? \
+	 interpolate_product_double_avx(a, b, len, oversample, frac) : \
+	 (interpolate_product_double)(a, b, len, oversample, frac))
+#endif
+
 /* Numer of elements to allocate on the stack */
 #ifdef VAR_ARRAYS
 #define FIXED_STACK_ALLOC 8192
@@ -967,6 +992,9 @@ EXPORT SpeexResamplerState *speex_resampler_init_frac(spx_uint32_t nb_channels,
 			*err = RESAMPLER_ERR_INVALID_ARG;
 		return NULL;
 	}
+#ifdef _USE_AVX
+	resample_use_avx = (ophh_cpu_flags() & OPHH_CPU_AVX) != 0;
+#endif
 	st = (SpeexResamplerState *) speex_alloc(sizeof(SpeexResamplerState));
 	st->initialised = 0;
 	st->started = 0;
@@ -0,0 +1,158 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/**
+   @file resample_avx.c
+   @brief Resampler inner loops for AVX capable CPUs
+*/
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+   
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+   
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+   
+   - Neither the name of the Xiph.org Foundation nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+   
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE FOUNDATION OR
+   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef _USE_AVX
+
+#include <xmmintrin.h>
+#include <immintrin.h>
+#include <defs.h>
+#include "arch.h"
+#include "resample_avx.h"
+
+static inline float hsum128(__m128 sum)
+{
+	float ret;
+	sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+	sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x55));
+	_mm_store_ss(&ret, sum);
+	return ret;
+}
+
+static inline double hsum256d(__m256d sum)
+{
+	double ret;
+	__m128d s = _mm_add_pd(_mm256_castpd256_pd128(sum),
+			       _mm256_extractf128_pd(sum, 1));
+	s = _mm_add_sd(s, _mm_unpackhi_pd(s, s));
+	_mm_store_sd(&ret, s);
+	return ret;
+}
+
+/* Two taps per register: a[i] against the four phases at b[i*oversample]
+   in the low lane, a[i+1] against b[(i+1)*oversample] in the high lane */
+static inline __m256 interp_taps(const float *a, const float *b,
+				 const spx_uint32_t oversample)
+{
+	__m256 av = _mm256_blend_ps(_mm256_broadcast_ss(a),
+				    _mm256_broadcast_ss(a + 1), 0xF0);
+	__m256 bv = _mm256_insertf128_ps(_mm256_castps128_ps256
+					 (_mm_loadu_ps(b)),
+					 _mm_loadu_ps(b + oversample), 1);
+	return _mm256_mul_ps(av, bv);
+}
+
+float inner_product_single_avx(const float *a, const float *b,
+			       unsigned int len)
+{
+	unsigned int i = 0;
+	__m256 sum0 = _mm256_setzero_ps();
+	__m256 sum1 = _mm256_setzero_ps();
+	for (; i + 16 <= len; i += 16) {
+		sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_loadu_ps(a + i),
+							 _mm256_loadu_ps(b + i)));
+		sum1 =
+		    _mm256_add_ps(sum1,
+				  _mm256_mul_ps(_mm256_loadu_ps(a + i + 8),
+						_mm256_loadu_ps(b + i + 8)));
+	}
+	if (i < len)
+		sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_loadu_ps(a + i),
+							 _mm256_loadu_ps(b + i)));
+	sum0 = _mm256_add_ps(sum0, sum1);
+	return hsum128(_mm_add_ps(_mm256_castps256_ps128(sum0),
+				  _mm256_extractf128_ps(sum0, 1)));
+}
+
+float interpolate_product_single_avx(const float *a, const float *b,
+				     unsigned int len,
+				     const spx_uint32_t oversample,
+				     float *frac)
+{
+	unsigned int i;
+	__m256 sum0 = _mm256_setzero_ps();
+	__m256 sum1 = _mm256_setzero_ps();
+	__m128 sum;
+	for (i = 0; i < len; i += 4) {
+		sum0 = _mm256_add_ps(sum0, interp_taps(a + i, b + i * oversample,
+						       oversample));
+		sum1 = _mm256_add_ps(sum1, interp_taps(a + i + 2,
+						       b + (i + 2) * oversample,
+						       oversample));
+	}
+	sum0 = _mm256_add_ps(sum0, sum1);
+	sum = _mm_add_ps(_mm256_castps256_ps128(sum0),
+			 _mm256_extractf128_ps(sum0, 1));
+	return hsum128(_mm_mul_ps(_mm_loadu_ps(frac), sum));
+}
+
+double inner_product_double_avx(const float *a, const float *b,
+				unsigned int len)
+{
+	unsigned int i;
+	__m256d sum = _mm256_setzero_pd();
+	__m256 t;
+	for (i = 0; i < len; i += 8) {
+		t = _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+		sum = _mm256_add_pd(sum,
+				    _mm256_cvtps_pd(_mm256_castps256_ps128(t)));
+		sum = _mm256_add_pd(sum,
+				    _mm256_cvtps_pd(_mm256_extractf128_ps(t, 1)));
+	}
+	return hsum256d(sum);
+}
+
+double interpolate_product_double_avx(const float *a, const float *b,
+				      unsigned int len,
+				      const spx_uint32_t oversample,
+				      float *frac)
+{
+	unsigned int i;
+	__m256d sum = _mm256_setzero_pd();
+	__m256 t;
+	for (i = 0; i < len; i += 2) {
+		t = interp_taps(a + i, b + i * oversample, oversample);
+		sum = _mm256_add_pd(sum,
+				    _mm256_cvtps_pd(_mm256_castps256_ps128(t)));
+		sum = _mm256_add_pd(sum,
+				    _mm256_cvtps_pd(_mm256_extractf128_ps(t, 1)));
+	}
+	return hsum256d(_mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(frac)), sum));
+}
+
+#endif
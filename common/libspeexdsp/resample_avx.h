@@ -0,0 +1,58 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/**
+   @file resample_avx.h
+   @brief Resampler functions (AVX version, selected at run time)
+*/
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+   
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+   
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+   
+   - Neither the name of the Xiph.org Foundation nor the names of its
+   contributors may be used to endorse or promote products derived from
+   this software without specific prior written permission.
+   
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE FOUNDATION OR
+   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <xmmintrin.h>
+
+#ifndef RESAMPLE_AVX_H
+#define RESAMPLE_AVX_H
+
+/* Same contract as the SSE versions: len is a multiple of 8 (filt_len is
+   always rounded that way).  These live in resample_avx.c, the only object
+   built with -mavx, and must only be called once the CPU and OS are known
+   to support AVX. */
+float inner_product_single_avx(const float *a, const float *b,
+			       unsigned int len);
+float interpolate_product_single_avx(const float *a, const float *b,
+				     unsigned int len,
+				     const spx_uint32_t oversample,
+				     float *frac);
+double inner_product_double_avx(const float *a, const float *b,
+				unsigned int len);
+double interpolate_product_double_avx(const float *a, const float *b,
+				      unsigned int len,
+				      const spx_uint32_t oversample,
+				      float *frac);
+
+#endif
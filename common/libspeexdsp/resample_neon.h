@@ -40,6 +40,84 @@
 
 #include <arm_neon.h>
 
+#if defined(__aarch64__)
+/* The inline assembly below is ARMv7 only; AArch64 gets intrinsics for the
+   floating point build, which is the one used here */
+#ifdef FLOATING_POINT
+
+#define OVERRIDE_INNER_PRODUCT_SINGLE
+/* Only works when len % 8 == 0 */
+static inline float inner_product_single(const float *a, const float *b,
+					 unsigned int len)
+{
+	unsigned int i;
+	float32x4_t sum0 = vdupq_n_f32(0);
+	float32x4_t sum1 = vdupq_n_f32(0);
+	for (i = 0; i < len; i += 8) {
+		sum0 = vmlaq_f32(sum0, vld1q_f32(a + i), vld1q_f32(b + i));
+		sum1 = vmlaq_f32(sum1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+	}
+	return vaddvq_f32(vaddq_f32(sum0, sum1));
+}
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_SINGLE
+static inline float interpolate_product_single(const float *a, const float *b,
+					       unsigned int len,
+					       const spx_uint32_t oversample,
+					       float *frac)
+{
+	unsigned int i;
+	float32x4_t sum0 = vdupq_n_f32(0);
+	float32x4_t sum1 = vdupq_n_f32(0);
+	for (i = 0; i < len; i += 2) {
+		sum0 = vmlaq_n_f32(sum0, vld1q_f32(b + i * oversample), a[i]);
+		sum1 = vmlaq_n_f32(sum1, vld1q_f32(b + (i + 1) * oversample),
+				   a[i + 1]);
+	}
+	return vaddvq_f32(vmulq_f32(vld1q_f32(frac), vaddq_f32(sum0, sum1)));
+}
+
+#define OVERRIDE_INNER_PRODUCT_DOUBLE
+static inline double inner_product_double(const float *a, const float *b,
+					  unsigned int len)
+{
+	unsigned int i;
+	float32x4_t t;
+	float64x2_t sum0 = vdupq_n_f64(0);
+	float64x2_t sum1 = vdupq_n_f64(0);
+	for (i = 0; i < len; i += 4) {
+		t = vmulq_f32(vld1q_f32(a + i), vld1q_f32(b + i));
+		sum0 = vaddq_f64(sum0, vcvt_f64_f32(vget_low_f32(t)));
+		sum1 = vaddq_f64(sum1, vcvt_high_f64_f32(t));
+	}
+	return vaddvq_f64(vaddq_f64(sum0, sum1));
+}
+
+#define OVERRIDE_INTERPOLATE_PRODUCT_DOUBLE
+static inline double interpolate_product_double(const float *a, const float *b,
+						unsigned int len,
+						const spx_uint32_t oversample,
+						float *frac)
+{
+	unsigned int i;
+	float32x4_t t;
+	float32x4_t f = vld1q_f32(frac);
+	float64x2_t sum0 = vdupq_n_f64(0);
+	float64x2_t sum1 = vdupq_n_f64(0);
+	for (i = 0; i < len; i++) {
+		t = vmulq_n_f32(vld1q_f32(b + i * oversample), a[i]);
+		sum0 = vaddq_f64(sum0, vcvt_f64_f32(vget_low_f32(t)));
+		sum1 = vaddq_f64(sum1, vcvt_high_f64_f32(t));
+	}
+	sum0 = vmulq_f64(sum0, vcvt_f64_f32(vget_low_f32(f)));
+	sum1 = vmulq_f64(sum1, vcvt_high_f64_f32(f));
+	return vaddvq_f64(vaddq_f64(sum0, sum1));
+}
+
+#endif
+
+#else /* __aarch64__ */
+
 #ifdef FIXED_POINT
 #ifdef __thumb2__
 static inline int32_t saturate_32bit_to_16bit(int32_t a)
@@ -210,3 +288,5 @@ static inline float inner_product_single(const float *a, const float *b,
 	return ret;
 }
 #endif
+
+#endif /* __aarch64__ */
@@ -2,6 +2,9 @@
 
 #include <stdint.h>
 
+/* Number of class A bits (leading the orderings below) for each speech mode */
+int16_t classA_bits[] = { 42, 49, 55, 58, 61, 75, 65, 81 };
+
 /* Subjective importance of the speech encoded bits */
 int16_t order_MR475[] = {
 	0, 0x80,
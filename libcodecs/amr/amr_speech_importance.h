@@ -18,5 +18,8 @@ extern int16_t order_MR102[];
 extern int16_t order_MR122[];
 extern int16_t order_MRDTX[];
 
+/* Number of class A bits (leading the orderings above) for each speech mode */
+extern int16_t classA_bits[];
+
 #endif /* _AMR_SPEECH_IMPORTANCE_H_ */
 
@@ -130,7 +130,8 @@ void Decoder_Interface_exit(void *state)
 }
 
 //decode using mode and bfi flag=1 (for replace lossed packets)
-//or alternatively bad frame is synth=0 or four zeroes 
+//or alternatively bad frame is synth=0 or four zeroes
+//bfi=2 marks speech block rebuilt by AMR_classA_serial
 void AMR_decode(void *st, uint8_t mode, uint8_t * serial, int16_t * synth, int bfi)
 {
 
@@ -191,6 +192,8 @@ void AMR_decode(void *st, uint8_t mode, uint8_t * serial, int16_t * synth, int b
 		bfi = 1;	//set bfi if zeroed data (or ommited)
 	if (bfi == 1)
 		frame_type = RX_SPEECH_BAD;	//set type for CN generation
+	else if (bfi == 2)
+		frame_type = RX_SPEECH_DEGRADED;	//rebuilt from class A bits
 
 	//unpack bits ro parameters
 	memzero(prm, PRMNO_MR122 * sizeof(int16_t));
@@ -245,3 +248,64 @@ void AMR_decode(void *st, uint8_t mode, uint8_t * serial, int16_t * synth, int b
 	s->prev_mode = speech_mode;
 }
 
+
+//rebuild speech block of mode (up to 31 bytes) from class A bits extracted
+//by AMR_classA: the missing bits are filled pseudorandomly, so fixed
+//codebook excitation stays noise-like; decode the block with bfi=2
+void AMR_classA_serial(uint8_t mode, uint8_t * classa, uint8_t * serial)
+{
+	//Number of parameters for each mode
+	uint8_t prmno_m[8] = { PRMNO_MR475, PRMNO_MR515, PRMNO_MR59,
+		PRMNO_MR67, PRMNO_MR74, PRMNO_MR795, PRMNO_MR102, PRMNO_MR122
+	};
+
+	//Number of bits in parameters for each mode
+	const int16_t *bitno_m[8] = { bitno_MR475, bitno_MR515, bitno_MR59,
+		bitno_MR67, bitno_MR74, bitno_MR795, bitno_MR102, bitno_MR122
+	};
+
+	//Subjective importance of bits for each mode
+	const int16_t *order_m[8] = { order_MR475, order_MR515, order_MR59,
+		order_MR67, order_MR74, order_MR795, order_MR102, order_MR122
+	};
+
+	//Encodec blocks length in byte for each mode
+	uint8_t bl_size_m[8] = { 12, 13, 15, 17, 19, 20, 26, 31 };
+
+	uint8_t prmno = prmno_m[mode];
+	const int16_t *bitno = bitno_m[mode];
+	const int16_t *order = order_m[mode];
+	int16_t nbits = classA_bits[mode];
+	int16_t prm[PRMNO_MR122];	//parameters of the block
+	uint32_t seed = 12345;	//noise generator seeded by class A bits
+	int i, j;
+	int16_t bits;		//bits counter
+
+	for (i = 0; i < ((nbits + 7) >> 3); i++)
+		seed = seed * 31 + classa[i];
+
+	//random parameters
+	for (i = 0; i < prmno; i++) {
+		seed = seed * 1103515245 + 12345;
+		prm[i] = (int16_t) (seed >> 16) & (((int16_t) 1 << bitno[i]) - 1);
+	}
+
+	//put class A bits on their places
+	for (i = 0; i < nbits; i++) {
+		if (classa[i >> 3] & ((uint8_t) 1 << (i & 7)))
+			prm[order[2 * i]] |= order[2 * i + 1];
+		else
+			prm[order[2 * i]] &= ~order[2 * i + 1];
+	}
+
+	//pack parameters to bits
+	memzero(serial, bl_size_m[mode]);
+	bits = 1;		//first bit is no-SID flag=0
+	for (i = 0; i < prmno; i++) {
+		for (j = 0; j < bitno[i]; j++) {
+			if (prm[i] & ((int16_t) 1 << j))
+				serial[bits >> 3] |= ((uint8_t) 1 << (bits & 0x07));
+			bits++;
+		}
+	}
+}
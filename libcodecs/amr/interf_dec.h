@@ -44,4 +44,6 @@ void Decoder_Interface_exit(void *state);
 
 void AMR_decode(void *st, uint8_t mode, uint8_t * serial, int16_t * synth,
 		int bfi);
+
+void AMR_classA_serial(uint8_t mode, uint8_t * classa, uint8_t * serial);
 #endif /* _interf_dec_h_ */
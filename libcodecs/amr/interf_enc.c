@@ -251,3 +251,54 @@ int AMR_encode(void *st, uint8_t mode, int16_t * speech, uint8_t * serial,
 	}
 }
 
+
+//extract class A bits (the most important by subjective order) of speech
+//block packed by AMR_encode in mode, for sending them as partial redundancy
+//return class A block length in bytes (0 for SID block)
+int AMR_classA(uint8_t mode, uint8_t * serial, uint8_t * classa)
+{
+	//Number of parameters for each mode
+	uint8_t prmno_m[8] = { PRMNO_MR475, PRMNO_MR515, PRMNO_MR59,
+		PRMNO_MR67, PRMNO_MR74, PRMNO_MR795, PRMNO_MR102, PRMNO_MR122
+	};
+
+	//Number of bits in parameters for each mode
+	const int16_t *bitno_m[8] = { bitno_MR475, bitno_MR515, bitno_MR59,
+		bitno_MR67, bitno_MR74, bitno_MR795, bitno_MR102, bitno_MR122
+	};
+
+	//Subjective importance of bits for each mode
+	const int16_t *order_m[8] = { order_MR475, order_MR515, order_MR59,
+		order_MR67, order_MR74, order_MR795, order_MR102, order_MR122
+	};
+
+	uint8_t prmno = prmno_m[mode];
+	const int16_t *bitno = bitno_m[mode];
+	const int16_t *order = order_m[mode];
+	int16_t nbits = classA_bits[mode];
+	int16_t prm[PRMNO_MR122];	//parameters of the block
+	int i, j;
+	int16_t bits;		//bits counter
+
+	if (0x01 & serial[0])	//SID block: nothing to protect
+		return 0;
+
+	//unpack bits to parameters
+	memzero(prm, PRMNO_MR122 * sizeof(int16_t));
+	bits = 1;		//skip first bit (SID flag)
+	for (i = 0; i < prmno; i++) {
+		for (j = 0; j < bitno[i]; j++) {
+			if (serial[bits >> 3] & (((uint8_t) 1) << (bits & 7)))
+				prm[i] |= ((int16_t) 1 << j);
+			bits++;
+		}
+	}
+
+	//pack class A bits in order of importance
+	memzero(classa, (nbits + 7) >> 3);
+	for (i = 0; i < nbits; i++)
+		if (prm[order[2 * i]] & order[2 * i + 1])
+			classa[i >> 3] |= ((uint8_t) 1 << (i & 7));
+
+	return (nbits + 7) >> 3;
+}
@@ -47,5 +47,7 @@ void Encoder_Interface_exit(void *state);
 
 int AMR_encode(void *st, uint8_t mode, int16_t * speech, uint8_t * serial,
 	       int force_speech);
+
+int AMR_classA(uint8_t mode, uint8_t * serial, uint8_t * classa);
 #endif /* _interf_enc_h_ */
 
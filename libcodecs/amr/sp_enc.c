@@ -31,6 +31,8 @@
 #include "sp_enc.h"
 #include "rom_enc.h"
 #include <ophtools.h>
+
+#include <ophsimd.h>
 /*
  * Definition of structures used in encoding process
  */
@@ -1997,8 +1999,32 @@ static void comp_corr(float sig[], int32_t L_frame, int32_t lag_max, int32_t
 	int32_t i, j;
 	float *p, *p1;
 	float T0;
+#ifdef OPH_SIMD_V4
+	v4f t, T0v;
+
+	/*
+	 * Four lags per vector, lane k holding lag i - k. Every lane adds
+	 * its products in the same groups of four as the loop below.
+	 */
+	for (i = lag_max; i - 3 >= lag_min; i -= 4) {
+		p = sig;
+		p1 = &sig[-i];
+		T0v = v4_set1(0.0F);
+
+		for (j = 0; j < L_frame; j = j + 4, p += 4, p1 += 4) {
+			t = v4_mul(v4_set1(p[0]), v4_load(&p1[0]));
+			t = v4_add(t, v4_mul(v4_set1(p[1]), v4_load(&p1[1])));
+			t = v4_add(t, v4_mul(v4_set1(p[2]), v4_load(&p1[2])));
+			t = v4_add(t, v4_mul(v4_set1(p[3]), v4_load(&p1[3])));
+			T0v = v4_add(T0v, t);
+		}
+		v4_store(&corr[-i], T0v);
+	}
+#else
+	i = lag_max;
+#endif
 
-	for (i = lag_max; i >= lag_min; i--) {
+	for (; i >= lag_min; i--) {
 		p = sig;
 		p1 = &sig[-i];
 		T0 = 0.0F;
@@ -2910,11 +2936,75 @@ static void getRange(int32_t T0, int16_t delta_low, int16_t delta_range,
 static void Norm_Corr(float exc[], float xn[], float h[], int32_t t_min,
 		      int32_t t_max, float corr_norm[])
 {
-	float exc_temp[L_SUBFR];
 	float *p_exc;
 	float corr, norm;
-	float sum;
 	int32_t i, j, k;
+#ifdef OPH_SIMD_V4
+	float hz[L_SUBFR + 4];
+	v4f ek, en, cr, y[L_SUBFR / 4];
+
+	k = -t_min;
+	p_exc = &exc[-t_min];
+
+	/*
+	 * Yk(n) stays in ten registers, four n per register. The
+	 * convolution adds the products of lane n in the order of the
+	 * scalar loop; h[] is padded in front with zeros so lanes with
+	 * n < i add nothing.
+	 */
+	for (j = 0; j < 4; j++)
+		hz[j] = 0.0F;
+	for (j = 0; j < L_SUBFR; j++)
+		hz[j + 4] = h[j];
+	for (j = 0; j < L_SUBFR / 4; j++)
+		y[j] = v4_set1(0.0F);
+
+	for (i = 0; i < L_SUBFR; i++) {
+		ek = v4_set1(p_exc[i]);
+		for (j = i >> 2; j < L_SUBFR / 4; j++)
+			y[j] = v4_add(y[j],
+				      v4_mul(ek, v4_load(&hz[4 + 4 * j - i])));
+	}
+
+	/* h(0) is not used by the update, Yk(0) = u(-k) */
+	hz[4] = 0.0F;
+
+	/* loop for every possible period */
+	for (i = t_min; i <= t_max; i++) {
+		en = v4_set1(0.0F);
+		cr = v4_set1(0.0F);
+		for (j = 0; j < L_SUBFR / 4; j++) {
+			en = v4_add(en, v4_mul(y[j], y[j]));
+			cr = v4_add(cr, v4_mul(v4_load(&xn[4 * j]), y[j]));
+		}
+		norm = v4_sum(en);
+
+		if (norm == 0)
+			norm = 1.0;
+		else
+			norm = (float) (1.0 / (sqrt(norm)));
+
+		corr = v4_sum(cr);
+
+		/* R(k) */
+		corr_norm[i] = corr * norm;
+
+		/* Yk(n) = Yk-1(n-1) + u(-k) * h(n), one lane up across registers */
+		if (i != t_max) {
+			k--;
+			ek = v4_set1(exc[k]);
+
+			for (j = L_SUBFR / 4 - 1; j > 0; j--)
+				y[j] = v4_add(v4_ext3(y[j - 1], y[j]),
+					      v4_mul(ek,
+						     v4_load(&hz[4 + 4 * j])));
+			y[0] = v4_add(v4_ext3(ek, y[0]),
+				      v4_mul(ek, v4_load(&hz[4])));
+		}
+	}
+#else
+	float exc_temp[L_SUBFR];
+	float sum;
 
 	k = -t_min;
 	p_exc = &exc[-t_min];
@@ -2961,6 +3051,7 @@ static void Norm_Corr(float exc[], float xn[], float h[], int32_t t_min,
 			exc_temp[0] = exc[k];
 		}
 	}
+#endif
 }
 
 /*
@@ -3923,6 +4014,7 @@ static void cl_ltp(int32_t * T0_prev_subframe, float * gp, enum Mode mode,
 	}
 }
 
+#ifndef OPH_SIMD_V4
 /*
  * DotProduct
  *
@@ -3949,6 +4041,7 @@ static float DotProduct(float * x, float * y, int32_t len)
 		acc += x[i] * y[i];
 	return (acc);
 }
+#endif
 
 /*
  * cor_h_x
@@ -3968,11 +4061,38 @@ static float DotProduct(float * x, float * y, int32_t len)
 static void cor_h_x(float h[], float x[], float dn[])
 {
 	int32_t i;
+#ifdef OPH_SIMD_V4
+	float xz[2 * L_CODE];
+	v4f hk, acc[L_CODE / 4];
+	int32_t k;
+
+	for (i = 0; i < L_CODE; i++) {
+		xz[i] = x[i];
+		xz[i + L_CODE] = 0.0F;
+	}
+	for (i = 0; i < L_CODE; i += 4)
+		acc[i >> 2] = v4_set1(0.0F);
+
+	/*
+	 * dn[i] for four i per vector, adding h[k] * x[k + i] in the order
+	 * DotProduct() does; lanes past the end of x[] only add zeros.
+	 */
+	for (k = 0; k < L_CODE; k++) {
+		hk = v4_set1(h[k]);
+		for (i = 0; i < L_CODE - k; i += 4)
+			acc[i >> 2] =
+			    v4_add(acc[i >> 2], v4_mul(hk, v4_load(&xz[k + i])));
+	}
+	for (i = 0; i < L_CODE; i += 4)
+		v4_store(&dn[i], acc[i >> 2]);
+	dn[0] = (float) Dotproduct40(h, x);
+#else
 
 	dn[0] = (float) Dotproduct40(h, x);
 
 	for (i = 1; i < L_CODE; i++)
 		dn[i] = (float) DotProduct(h, &x[i], L_CODE - i);
+#endif
 }
 
 /*
@@ -4033,6 +4153,70 @@ static void set_sign(float dn[], float sign[], float dn2[], int16_t n)
 	return;
 }
 
+/*
+ * The codebook searches read rr[][] along the tracks of interleaved
+ * pulse positions. cor_h() stores position p of a codebook with n tracks
+ * at index TRACK_IDX(p, n) of both the rows and the columns, so a track
+ * is a run of consecutive floats in every row, and moving one position
+ * along a track moves by 1 within a row, by L_CODE across rows and by
+ * L_CODE + 1 along the diagonal.
+ */
+#define TRACK_IDX(p, n) (((p) % (n)) * (L_CODE / (n)) + (p) / (n))
+
+/*
+ * cor_diag
+ *
+ *
+ * Parameters:
+ *    h                I: h[]
+ *    c                O: running sums along the diagonals
+ *
+ * Function:
+ *    Computes the running sums along the diagonals of the correlation
+ *    matrix of h[]:
+ *       c[n][s] = sum(m = 0..n) h[m] * h[m + s]     for n + s < L_CODE.
+ *    Four shifts share a register and the ten registers of a row are
+ *    independent, so the adds overlap.
+ *
+ * Returns:
+ *    void
+ */
+static void cor_diag(float h[], float c[][L_CODE])
+{
+	int32_t n, s;
+#ifdef OPH_SIMD_V4
+	float hz[2 * L_CODE];
+	v4f hn, cor[L_CODE / 4];
+
+	for (n = 0; n < L_CODE; n++) {
+		hz[n] = h[n];
+		hz[n + L_CODE] = 0.0F;
+	}
+	for (s = 0; s < L_CODE; s += 4)
+		cor[s >> 2] = v4_set1(0.0F);
+
+	/* lanes past n + s = L_CODE - 1 only add zeros and are not read */
+	for (n = 0; n < L_CODE; n++) {
+		hn = v4_set1(hz[n]);
+		for (s = 0; s < L_CODE - n; s += 4) {
+			cor[s >> 2] =
+			    v4_add(cor[s >> 2], v4_mul(hn, v4_load(&hz[n + s])));
+			v4_store(&c[n][s], cor[s >> 2]);
+		}
+	}
+#else
+	float sum;
+
+	for (s = 0; s < L_CODE; s++) {
+		sum = 0.0F;
+		for (n = 0; n < L_CODE - s; n++) {
+			sum += h[n] * h[n + s];
+			c[n][s] = sum;
+		}
+	}
+#endif
+}
+
 /*
  * cor_h
  *
@@ -4041,298 +4225,42 @@ static void set_sign(float dn[], float sign[], float dn2[], int16_t n)
  *    h                I: h[]
  *    sign             I: sign information
  *    rr               O: correlations
+ *    n_track          I: number of tracks of the codebook
  *
  * Function:
  *    Computes correlations of h[] needed for the codebook search,
  *    and includes the sign information into the correlations.
+ *    rr[][] is stored track by track, see TRACK_IDX().
  *
  * Returns:
  *    void
  */
-static void cor_h(float h[], float sign[], float rr[][L_CODE])
+static void cor_h(float h[], float sign[], float rr[][L_CODE],
+		  int32_t n_track)
 {
-	float sum;
-	float *prr, *ph, *ph_max;
-	float *rrj, *rri, *signi, *signj;
-	int32_t ii, total_loops, four_loops;
+	float c[L_CODE][L_CODE];
+	int32_t idx[L_CODE];
+	int32_t i, j;
 
-	sum = 0.0F;
+	cor_diag(h, c);
 
-	/* Compute diagonal matrix of autocorrelation of h */
-	rr[0][0] = (float) Dotproduct40(h, h);
-	prr = &rr[39][39];
-	ph = &h[0];
-	ph_max = ph + 39;
+	for (i = 0; i < L_CODE; i++)
+		idx[i] = TRACK_IDX(i, n_track);
 
 	/*
-	 * speed optimization of code:
-	 * for (k=0; k<m; k++)
-	 * {
-	 * sum += h[k]*h[k];
-	 * rr[i][i] = sum;
-	 * i--;
-	 * }
+	 * rr[i][j] for j >= i is the sum along diagonal j - i up to
+	 * h[L_CODE - 1 - j], which is where the recursion of the reference
+	 * code stops for that element.
 	 */
-	do {
-		sum += *ph * *ph;
-		ph++;
-		*prr = sum;
-		prr -= 41;
-		sum += *ph * *ph;
-		ph++;
-		*prr = sum;
-		prr -= 41;
-		sum += *ph * *ph;
-		ph++;
-		*prr = sum;
-		prr -= 41;
-		sum += *ph * *ph;
-		ph++;
-		*prr = sum;
-		prr -= 41;
-		sum += *ph * *ph;
-		ph++;
-		*prr = sum;
-		prr -= 41;
-		sum += *ph * *ph;
-		ph++;
-		*prr = sum;
-		prr -= 41;
-		sum += *ph * *ph;
-		ph++;
-		*prr = sum;
-		prr -= 41;
-		sum += *ph * *ph;
-		ph++;
-		*prr = sum;
-		prr -= 41;
-		sum += *ph * *ph;
-		ph++;
-		*prr = sum;
-		prr -= 41;
-		sum += *ph * *ph;
-		ph++;
-		*prr = sum;
-		prr -= 41;
-		sum += *ph * *ph;
-		ph++;
-		*prr = sum;
-		prr -= 41;
-		sum += *ph * *ph;
-		ph++;
-		*prr = sum;
-		prr -= 41;
-		sum += *ph * *ph;
-		ph++;
-		*prr = sum;
-		prr -= 41;
-	} while (ph < ph_max);
+	for (i = 0; i < L_CODE; i++) {
+		rr[idx[i]][idx[i]] = c[L_CODE - 1 - i][0];
 
-	/*
-	 * Compute upper & bottom symmetric matrix of autocorrelation of h.
-	 */
-	/* speed optimization of code:
-	 * for (ii=1; ii<L_CODE; ii++)
-	 * {
-	 * j = m;
-	 * i = j - ii;
-	 * sum = (float)0.0;
-	 * for ( k = 0; k < (L_CODE-ii); k++ )
-	 * {
-	 * sum += h[k]*h[k+ii];
-	 * rr[i][j] = rr[j][i] = (sum*sign[i]*sign[j]);
-	 * i--; j--;
-	 * }
-	 * }
-	 */
-	ii = 1;
-
-	for (total_loops = 9; total_loops >= 0; total_loops--) {
-		rrj = rri = &rr[39][39];
-		rrj -= ii;
-		rri = (rri - 40 * ii);
-		signi = signj = &sign[39];
-		signi -= ii;
-		sum = 0.0F;
-		ph = &h[0];
-
-		for (four_loops = 0; four_loops < total_loops; four_loops++) {
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * *signi * *signj;
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * *signi * *signj;
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * *signi * *signj;
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * *signi * *signj;
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-		}
-		sum += *ph * *(ph + ii);
-		ph++;
-		*rri = *rrj = sum * *signi * *signj;
-		rri -= 41;
-		rrj -= 41;
-		signi--;
-		signj--;
-		sum += *ph * *(ph + ii);
-		ph++;
-		*rri = *rrj = sum * *signi * *signj;
-		rri -= 41;
-		rrj -= 41;
-		signi--;
-		signj--;
-		sum += *ph * *(ph + ii);
-		*rri = *rrj = sum * *signi * *signj;
-		ii++;
-		rrj = rri = &rr[39][39];
-		rrj -= ii;
-		rri = (rri - 40 * ii);
-		signi = signj = &sign[39];
-		signi -= ii;
-		sum = 0.0F;
-		ph = &h[0];
-
-		for (four_loops = 0; four_loops < total_loops; four_loops++) {
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * *signi * *signj;
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * *signi * *signj;
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * *signi * *signj;
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * *signi * *signj;
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-		}
-		sum += *ph * *(ph + ii);
-		ph++;
-		*rri = *rrj = sum * *signi * *signj;
-		rri -= 41;
-		rrj -= 41;
-		signi--;
-		signj--;
-		sum += *ph * *(ph + ii);
-		*rri = *rrj = sum * *signi * *signj;
-		ii++;
-		rrj = rri = &rr[39][39];
-		rrj -= ii;
-		rri = (rri - 40 * ii);
-		signi = signj = &sign[39];
-		signi -= ii;
-		sum = 0.0F;
-		ph = &h[0];
-
-		for (four_loops = 0; four_loops < total_loops; four_loops++) {
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * *signi * *signj;
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * *signi * *signj;
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * *signi * *signj;
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * *signi * *signj;
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-		}
-		sum += *ph * *(ph + ii);
-		*rri = *rrj = sum * *signi * *signj;
-		ii++;
-		rrj = rri = &rr[39][39];
-		rrj -= ii;
-		rri = (rri - 40 * ii);
-		signi = signj = &sign[39];
-		signi -= ii;
-		sum = 0.0F;
-		ph = &h[0];
-
-		for (four_loops = 0; four_loops < total_loops; four_loops++) {
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * (*signi) * (*signj);
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * *signi * *signj;
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * *signi * *signj;
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-			sum += *ph * *(ph + ii);
-			ph++;
-			*rri = *rrj = sum * *signi * *signj;
-			rri -= 41;
-			rrj -= 41;
-			signi--;
-			signj--;
-		}
-		ii++;
+		for (j = i + 1; j < L_CODE; j++) {
+			rr[idx[i]][idx[j]] = rr[idx[j]][idx[i]] =
+			    c[L_CODE - 1 - j][j - i] * sign[i] * sign[j];
+		}
 	}
-	return;
+	rr[0][0] = (float) Dotproduct40(h, h);
 }
 
 /*
@@ -4380,7 +4308,8 @@ static void search_2i40_9bits(int16_t subNr, float dn[], float rr[][L_CODE],
 			      int32_t codvec[])
 {
 	float ps0, ps1, psk, alp, alp0, alp1, alpk, sq, sq1;
-	int32_t i0, i1, ix, i;
+	float *rr0;
+	int32_t i0, i1, j1, ix, i;
 	int16_t ipos[2];
 	int16_t track1;
 
@@ -4399,7 +4328,8 @@ static void search_2i40_9bits(int16_t subNr, float dn[], float rr[][L_CODE],
 		/* i0 loop: try 8 positions       */
 		for (i0 = ipos[0]; i0 < L_CODE; i0 += STEP) {
 			ps0 = dn[i0];
-			alp0 = rr[i0][i0];
+			rr0 = rr[TRACK_IDX(i0, NB_TRACK)];
+			alp0 = rr0[TRACK_IDX(i0, NB_TRACK)];
 
 			/* i1 loop: 8 positions */
 			sq = -1;
@@ -4407,8 +4337,9 @@ static void search_2i40_9bits(int16_t subNr, float dn[], float rr[][L_CODE],
 			ix = ipos[1];
 
 			for (i1 = ipos[1]; i1 < L_CODE; i1 += STEP) {
+				j1 = TRACK_IDX(i1, NB_TRACK);
 				ps1 = ps0 + dn[i1];
-				alp1 = alp0 + rr[i1][i1] + 2.0F * rr[i0][i1];
+				alp1 = alp0 + rr[j1][j1] + 2.0F * rr0[j1];
 				sq1 = ps1 * ps1;
 
 				if ((alp * sq1) > (sq * alp1)) {
@@ -4565,7 +4496,7 @@ static void code_2i40_9bits(int16_t subNr, float x[], float h[], int32_t T0,
 		}
 	cor_h_x(h, x, dn);
 	set_sign(dn, dn_sign, dn2, 8);
-	cor_h(h, dn_sign, rr);
+	cor_h(h, dn_sign, rr, NB_TRACK);
 	search_2i40_9bits(subNr, dn, rr, codvec);
 	build_code_2i40_9bits(subNr, codvec, dn_sign, code, h, y, anap);
 
@@ -4600,7 +4531,8 @@ static void search_2i40_11bits(float dn[], float rr[][L_CODE], int32_t
 {
 	double alpk, alp, alp0, alp1;
 	float psk, ps0, ps1, sq, sq1;
-	int32_t i, i0, i1, ix = 0;
+	float *rr0;
+	int32_t i, i0, i1, j1, ix = 0;
 	int16_t ipos[2];
 	int16_t track1, track2;
 
@@ -4625,7 +4557,8 @@ static void search_2i40_11bits(float dn[], float rr[][L_CODE], int32_t
 			 */
 			for (i0 = ipos[0]; i0 < L_CODE; i0 += STEP) {
 				ps0 = dn[i0];
-				alp0 = rr[i0][i0] * 0.25F;
+				rr0 = rr[TRACK_IDX(i0, NB_TRACK)];
+				alp0 = rr0[TRACK_IDX(i0, NB_TRACK)] * 0.25F;
 
 				/*
 				 * i1 loop: 8 positions.
@@ -4635,11 +4568,12 @@ static void search_2i40_11bits(float dn[], float rr[][L_CODE], int32_t
 				ix = ipos[1];
 
 				for (i1 = ipos[1]; i1 < L_CODE; i1 += STEP) {
+					j1 = TRACK_IDX(i1, NB_TRACK);
 					ps1 = ps0 + dn[i1];
 
 					/* alp1 = alp0 + rr[i0][i1] + 1/2*rr[i1][i1]; */
-					alp1 = alp0 + rr[i1][i1] * 0.25F;
-					alp1 += rr[i0][i1] * 0.5F;
+					alp1 = alp0 + rr[j1][j1] * 0.25F;
+					alp1 += rr0[j1] * 0.5F;
 					sq1 = ps1 * ps1;
 
 					if ((alp * sq1) > (sq * alp1)) {
@@ -4794,7 +4728,7 @@ static void code_2i40_11bits(float x[], float h[], int32_t T0, float
 	}
 	cor_h_x(h, x, dn);
 	set_sign(dn, dn_sign, dn2, 8);
-	cor_h(h, dn_sign, rr);
+	cor_h(h, dn_sign, rr, NB_TRACK);
 	search_2i40_11bits(dn, rr, codvec);
 	build_code_2i40_11bits(codvec, dn_sign, code, h, y, anap);
 
@@ -4832,7 +4766,7 @@ static void search_3i40(float dn[], float dn2[], float rr[][L_CODE],
 	float psk, ps0, ps1, sq, sq1, alpk, alp, alp0, alp1, ps = 0.0F;
 	float *rr2, *rr1, *rr0, *pdn, *pdn_max;
 	int32_t ipos[3];
-	int32_t i0, i1, i2, ix, i, pos, track1, track2;
+	int32_t i0, i1, i2, j0, j1, j2, ix, i, pos, track1, track2;
 
 	psk = -1.0F;
 	alpk = 1.0F;
@@ -4850,7 +4784,8 @@ static void search_3i40(float dn[], float dn2[], float rr[][L_CODE],
 				for (i0 = ipos[0]; i0 < L_CODE; i0 += STEP) {
 					if (dn2[i0] >= 0) {
 						ps0 = dn[i0];
-						alp0 = rr[i0][i0];
+						j0 = TRACK_IDX(i0, NB_TRACK);
+						alp0 = rr[j0][j0];
 
 						/* i1 loop: 8 positions */
 						sq = -1.0F;
@@ -4858,8 +4793,9 @@ static void search_3i40(float dn[], float dn2[], float rr[][L_CODE],
 						ps = 0.0F;
 						ix = ipos[1];
 						i1 = ipos[1];
-						rr1 = &rr[i1][i1];
-						rr0 = &rr[i0][i1];
+						j1 = TRACK_IDX(i1, NB_TRACK);
+						rr1 = &rr[j1][j1];
+						rr0 = &rr[j0][j1];
 						pdn = &dn[i1];
 						pdn_max = &dn[L_CODE];
 
@@ -4879,9 +4815,8 @@ static void search_3i40(float dn[], float dn2[], float rr[][L_CODE],
 								    (pdn - dn);
 							}
 							pdn += STEP;
-							rr1 +=
-							    (40 * STEP + STEP);
-							rr0 += STEP;
+							rr1 += L_CODE + 1;
+							rr0++;
 						} while (pdn < pdn_max);
 						i1 = ix;
 
@@ -4892,9 +4827,11 @@ static void search_3i40(float dn[], float dn2[], float rr[][L_CODE],
 						alp = 1.0F;
 						ix = ipos[2];
 						i2 = ipos[2];
-						rr2 = &rr[i2][i2];
-						rr1 = &rr[i1][i2];
-						rr0 = &rr[i0][i2];
+						j1 = TRACK_IDX(i1, NB_TRACK);
+						j2 = TRACK_IDX(i2, NB_TRACK);
+						rr2 = &rr[j2][j2];
+						rr1 = &rr[j1][j2];
+						rr0 = &rr[j0][j2];
 						pdn = &dn[i2];
 
 						do {
@@ -4913,10 +4850,9 @@ static void search_3i40(float dn[], float dn2[], float rr[][L_CODE],
 								    (pdn - dn);
 							}
 							pdn += STEP;
-							rr2 +=
-							    (40 * STEP + STEP);
-							rr1 += STEP;
-							rr0 += STEP;
+							rr2 += L_CODE + 1;
+							rr1++;
+							rr0++;
 						} while (pdn < pdn_max);
 						i2 = ix;
 
@@ -5073,7 +5009,7 @@ static void code_3i40_14bits(float x[], float h[], int32_t T0, float
 	}
 	cor_h_x(h, x, dn);
 	set_sign(dn, dn_sign, dn2, 6);
-	cor_h(h, dn_sign, rr);
+	cor_h(h, dn_sign, rr, NB_TRACK);
 	search_3i40(dn, dn2, rr, codvec);
 
 	/* function result */
@@ -5090,6 +5026,61 @@ static void code_3i40_14bits(float x[], float h[], int32_t T0, float
 	}
 }
 
+#ifdef OPH_SIMD_V4
+/*
+ * search_4i40_terms
+ *
+ *
+ * Parameters:
+ *    ps0               I: correlation of the pulses already placed
+ *    alp0              I: energy of the pulses already placed
+ *    dn_t              I: dn[] in track order
+ *    dg                I: diagonal of rr[][] in track order
+ *    dg_scale          I: weight of the diagonal
+ *    rows              I: rows of rr[][] of the pulses already placed
+ *    nr                I: number of rows
+ *    r_scale           I: weight of the rows
+ *    j                 I: first position of the track, in track order
+ *    ps1               O: correlation for each position of the track
+ *    sq1               O: squared correlation for each position
+ *    alp1              O: energy for each position
+ *
+ * Function:
+ *    Forms the terms of the 8 position loops of search_4i40() for a
+ *    whole track at once. They are formed and added in the same order
+ *    and precision as the scalar loop, which then only compares them.
+ *
+ * Returns:
+ *    void
+ */
+static void search_4i40_terms(float ps0, double alp0, float dn_t[],
+			      float dg[], float dg_scale, float *rows[],
+			      int32_t nr, float r_scale, int32_t j,
+			      float ps1[], float sq1[], double alp1[])
+{
+	v4f ps, t;
+	v2d lo, hi;
+	int32_t k, m;
+
+	for (k = 0; k < L_CODE / NB_TRACK; k += 4) {
+		ps = v4_add(v4_set1(ps0), v4_load(&dn_t[j + k]));
+		v4_store(&ps1[k], ps);
+		v4_store(&sq1[k], v4_mul(ps, ps));
+		t = v4_mul(v4_load(&dg[j + k]), v4_set1(dg_scale));
+		lo = v2_add(v2_set1(alp0), v2_cvt_lo(t));
+		hi = v2_add(v2_set1(alp0), v2_cvt_hi(t));
+
+		for (m = 0; m < nr; m++) {
+			t = v4_mul(v4_load(&rows[m][j + k]), v4_set1(r_scale));
+			lo = v2_add(lo, v2_cvt_lo(t));
+			hi = v2_add(hi, v2_cvt_hi(t));
+		}
+		v2_store(&alp1[k], lo);
+		v2_store(&alp1[k + 2], hi);
+	}
+}
+#endif
+
 /*
  * search_4i40
  *
@@ -5112,8 +5103,25 @@ static void search_4i40(float dn[], float dn2[], float rr[][L_CODE],
 {
 	double alpk, alp, alp0, alp1;
 	float ps, psk, ps0, ps1, sq, sq1;
+	float *rr0, *rr1, *rr2;
 	int32_t ipos[4];
-	int32_t i0, i1, i2, i3, ix, i, pos, track;
+	int32_t i0, i1, i2, i3, j0, j1, j2, j3, ix, i, pos, track;
+#ifdef OPH_SIMD_V4
+	float dn_t[L_CODE], dg[L_CODE], t_ps[L_CODE / NB_TRACK],
+	    t_sq[L_CODE / NB_TRACK];
+	double t_alp[L_CODE / NB_TRACK];
+	float *rows[3];
+
+	/*
+	 * The loops over 8 positions below take their terms from
+	 * search_4i40_terms() and only do the comparisons themselves.
+	 */
+	for (i = 0; i < L_CODE; i++) {
+		j0 = TRACK_IDX(i, NB_TRACK);
+		dn_t[j0] = dn[i];
+		dg[j0] = rr[j0][j0];
+	}
+#endif
 
 	/* Default value */
 	psk = -1;
@@ -5139,8 +5147,10 @@ static void search_4i40(float dn[], float dn2[], float rr[][L_CODE],
 			 */
 			for (i0 = ipos[0]; i0 < L_CODE; i0 += STEP) {
 				if (dn2[i0] >= 0) {
+					j0 = TRACK_IDX(i0, NB_TRACK);
+					rr0 = rr[j0];
 					ps0 = dn[i0];
-					alp0 = rr[i0][i0] * 0.25F;
+					alp0 = rr0[j0] * 0.25F;
 
 					/*
 					 * i1 loop: 8 positions.
@@ -5149,16 +5159,28 @@ static void search_4i40(float dn[], float dn2[], float rr[][L_CODE],
 					alp = 1;
 					ps = 0;
 					ix = ipos[1];
+					j1 = TRACK_IDX(ipos[1], NB_TRACK);
+#ifdef OPH_SIMD_V4
+					rows[0] = rr0;
+					search_4i40_terms(ps0, alp0, dn_t, dg, 0.25F,
+							  rows, 1, 0.5F, j1, t_ps,
+							  t_sq, t_alp);
+#endif
 
 					for (i1 = ipos[1]; i1 < L_CODE;
-					     i1 += STEP) {
+					     i1 += STEP, j1++) {
+#ifdef OPH_SIMD_V4
+						ps1 = t_ps[j1 & 7];
+						alp1 = t_alp[j1 & 7];
+						sq1 = t_sq[j1 & 7];
+#else
 						ps1 = ps0 + dn[i1];
 
 						/* alp1 = alp0 + rr[i0][i1] + 1/2*rr[i1][i1]; */
-						alp1 =
-						    alp0 + rr[i1][i1] * 0.25F;
-						alp1 = alp1 + rr[i0][i1] * 0.5F;
+						alp1 = alp0 + rr[j1][j1] * 0.25F;
+						alp1 = alp1 + rr0[j1] * 0.5F;
 						sq1 = ps1 * ps1;
+#endif
 
 						if ((alp * sq1) > (sq * alp1)) {
 							sq = sq1;
@@ -5168,6 +5190,7 @@ static void search_4i40(float dn[], float dn2[], float rr[][L_CODE],
 						}
 					}
 					i1 = ix;
+					rr1 = rr[TRACK_IDX(i1, NB_TRACK)];
 
 					/*
 					 * i2 loop: 8 positions.
@@ -5178,17 +5201,30 @@ static void search_4i40(float dn[], float dn2[], float rr[][L_CODE],
 					alp = 1;
 					ps = 0;
 					ix = ipos[2];
+					j2 = TRACK_IDX(ipos[2], NB_TRACK);
+#ifdef OPH_SIMD_V4
+					rows[0] = rr1;
+					rows[1] = rr0;
+					search_4i40_terms(ps0, alp0, dn_t, dg, 0.0625F,
+							  rows, 2, 0.125F, j2, t_ps,
+							  t_sq, t_alp);
+#endif
 
 					for (i2 = ipos[2]; i2 < L_CODE;
-					     i2 += STEP) {
+					     i2 += STEP, j2++) {
+#ifdef OPH_SIMD_V4
+						ps1 = t_ps[j2 & 7];
+						alp1 = t_alp[j2 & 7];
+						sq1 = t_sq[j2 & 7];
+#else
 						ps1 = ps0 + dn[i2];
 
 						/* alp1 = alp0 + rr[i0][i2] + rr[i1][i2] + 1/2*rr[i2][i2]; */
-						alp1 =
-						    alp0 + rr[i2][i2] * 0.0625F;
-						alp1 += rr[i1][i2] * 0.125F;
-						alp1 += rr[i0][i2] * 0.125F;
+						alp1 = alp0 + rr[j2][j2] * 0.0625F;
+						alp1 += rr1[j2] * 0.125F;
+						alp1 += rr0[j2] * 0.125F;
 						sq1 = ps1 * ps1;
+#endif
 
 						if ((alp * sq1) > (sq * alp1)) {
 							sq = sq1;
@@ -5198,6 +5234,7 @@ static void search_4i40(float dn[], float dn2[], float rr[][L_CODE],
 						}
 					}
 					i2 = ix;
+					rr2 = rr[TRACK_IDX(i2, NB_TRACK)];
 
 					/*
 					 * i3 loop: 8 positions
@@ -5207,18 +5244,31 @@ static void search_4i40(float dn[], float dn2[], float rr[][L_CODE],
 					sq = -1;
 					alp = 1;
 					ix = ipos[3];
+					j3 = TRACK_IDX(ipos[3], NB_TRACK);
+#ifdef OPH_SIMD_V4
+					rows[0] = rr2;
+					rows[1] = rr1;
+					rows[2] = rr0;
+					search_4i40_terms(ps0, alp0, dn_t, dg, 0.0625F,
+							  rows, 3, 0.125F, j3, t_ps,
+							  t_sq, t_alp);
+#endif
 
 					for (i3 = ipos[3]; i3 < L_CODE;
-					     i3 += STEP) {
+					     i3 += STEP, j3++) {
+#ifdef OPH_SIMD_V4
+						alp1 = t_alp[j3 & 7];
+						sq1 = t_sq[j3 & 7];
+#else
 						ps1 = ps0 + dn[i3];
 
 						/* alp1 = alp0 + rr[i0][i3] + rr[i1][i3] + rr[i2][i3] + 1/2*rr[i3][i3]; */
-						alp1 =
-						    alp0 + rr[i3][i3] * 0.0625F;
-						alp1 += rr[i2][i3] * 0.125F;
-						alp1 += rr[i1][i3] * 0.125F;
-						alp1 += rr[i0][i3] * 0.125F;
+						alp1 = alp0 + rr[j3][j3] * 0.0625F;
+						alp1 += rr2[j3] * 0.125F;
+						alp1 += rr1[j3] * 0.125F;
+						alp1 += rr0[j3] * 0.125F;
 						sq1 = ps1 * ps1;
+#endif
 
 						if ((alp * sq1) > (sq * alp1)) {
 							sq = sq1;
@@ -5377,7 +5427,7 @@ static void code_4i40_17bits(float x[], float h[], int32_t T0, float
 	}
 	cor_h_x(h, x, dn);
 	set_sign(dn, dn_sign, dn2, 4);
-	cor_h(h, dn_sign, rr);
+	cor_h(h, dn_sign, rr, NB_TRACK);
 	search_4i40(dn, dn2, rr, codvec);
 	build_code_4i40(codvec, dn_sign, code, h, y, anap);
 
@@ -5459,6 +5509,7 @@ static void set_sign12k2(float dn[], float cn[], float sign[], int32_t
 		b[i] = cor;
 	}
 	max_of_all = -1;
+	ipos[0] = 0;
 
 	for (i = 0; i < nb_track; i++) {
 		max = -1;
@@ -5501,6 +5552,77 @@ static void set_sign12k2(float dn[], float cn[], float sign[], int32_t
 	}
 }
 
+/*
+ * search_pulse_pair
+ *
+ *
+ * Parameters:
+ *    ps1               I: correlation of the pulses placed so far
+ *    alp1              I: energy of the pulses placed so far
+ *    dn_t              I: dn[] along the track of the second pulse
+ *    rrv               I: energy terms along the track of the second pulse
+ *    r                 I: row of rr[][] of the first pulse along that track
+ *    n                 I: number of positions to try
+ *    sq                B: best squared correlation so far
+ *    alp               B: energy of the best so far
+ *    ps                B: correlation of the best so far
+ *
+ * Function:
+ *    Inner loop of the pulse pair searches in search_8i40() and
+ *    search_10i40(). With the vector helpers four positions are
+ *    screened at once; the test is the one of the scalar loop, so
+ *    a group is only skipped when none of its positions would win.
+ *
+ * Returns:
+ *    index along the track of the new best, -1 if none
+ */
+static int32_t search_pulse_pair(float ps1, float alp1, float dn_t[],
+				 float rrv[], float r[], int32_t n, float *sq,
+				 float *alp, float *ps)
+{
+	float ps2, sq2, alp2, sq_max, alp_max, ps_max;
+	int32_t j, best;
+#ifdef OPH_SIMD_V4
+	v4f ps2v, alp2v;
+#endif
+
+	sq_max = *sq;
+	alp_max = *alp;
+	ps_max = *ps;
+	best = -1;
+
+	for (j = 0; j < n; j++) {
+#ifdef OPH_SIMD_V4
+		if (((j & 3) == 0) && (j + 4 <= n)) {
+			ps2v = v4_add(v4_set1(ps1), v4_load(&dn_t[j]));
+			alp2v = v4_add(v4_add(v4_set1(alp1), v4_load(&rrv[j])),
+				       v4_mul(v4_set1(2.0F), v4_load(&r[j])));
+
+			if (!v4_any_gt(v4_mul(v4_set1(alp_max),
+					      v4_mul(ps2v, ps2v)),
+				       v4_mul(v4_set1(sq_max), alp2v))) {
+				j += 3;
+				continue;
+			}
+		}
+#endif
+		ps2 = ps1 + dn_t[j];
+		sq2 = ps2 * ps2;
+		alp2 = alp1 + rrv[j] + 2.0F * r[j];
+
+		if ((alp_max * sq2) > (sq_max * alp2)) {
+			sq_max = sq2;
+			ps_max = ps2;
+			alp_max = alp2;
+			best = j;
+		}
+	}
+	*sq = sq_max;
+	*alp = alp_max;
+	*ps = ps_max;
+	return best;
+}
+
 /*
  * search_4i40
  *
@@ -5522,15 +5644,18 @@ static void set_sign12k2(float dn[], float cn[], float sign[], int32_t
 static void search_8i40(float dn[], float rr[][L_CODE], int32_t ipos[],
 			int32_t pos_max[], int32_t codvec[])
 {
-	float rrv[L_CODE];
-	float psk, ps, ps0, ps1, ps2, sq, sq2, alpk, alp, alp0, alp1, alp2;
-	float *p_r, *p_r0, *p_r1, *p_r2, *p_r3, *p_r4, *p_r5, *p_r6, *p_r7,
-	    *p_r8;
-	float *p_rrv, *p_rrv0, *p_dn, *p_dn0, *p_dn1, *p_dn_max;
-	int32_t i0, i1, i2, i3, i4, i5, i6, i7, j, k, ia, ib, i, pos;
+	float rrv[L_CODE], dn_t[L_CODE];
+	float psk, ps, ps0, ps1, sq, alpk, alp, alp0, alp1;
+	float *p_r, *p_r0, *p_r1, *p_r2, *p_r3, *p_r4, *p_r5, *p_r6, *p_r7;
+	float *p_rrv, *p_rrv0, *p_dn0, *p_dn1, *p_dn_max, *p_dn_t;
+	int32_t i0, i1, i2, i3, i4, i5, i6, i7, j, k, ia, ib, i, pos, nb, ix;
 
 	p_dn_max = &dn[39];
 
+	/* dn[] in track order for the inner loops */
+	for (i = 0; i < L_CODE; i++)
+		dn_t[TRACK_IDX(i, NB_TRACK_MR102)] = dn[i];
+
 	/* fix i0 on maximum of correlation position */
 	i0 = pos_max[ipos[0]];
 
@@ -5542,7 +5667,7 @@ static void search_8i40(float dn[], float rr[][L_CODE], int32_t ipos[],
 	for (i = 0; i < 8; i++) {
 		codvec[i] = i;
 	}
-	p_r = &rr[i0][i0];
+	p_r = &rr[TRACK_IDX(i0, NB_TRACK_MR102)][TRACK_IDX(i0, NB_TRACK_MR102)];
 
 	for (i = 1; i < 5; i++) {
 		i1 = pos_max[ipos[1]];
@@ -5553,112 +5678,73 @@ static void search_8i40(float dn[], float rr[][L_CODE], int32_t ipos[],
 		i6 = ipos[6];
 		i7 = ipos[7];
 		ps0 = dn[i0] + dn[i1];
-		alp0 = *p_r + rr[i1][i1] + 2.0F * rr[i0][i1];
+		k = TRACK_IDX(i1, NB_TRACK_MR102);
+		alp0 = *p_r + rr[k][k]
+		    + 2.0F * rr[TRACK_IDX(i0, NB_TRACK_MR102)][k];
 
 		/* i2 and i3 loop */
-		p_rrv = &rrv[i3];
-		p_r0 = &rr[i0][i3];
-		p_r1 = &rr[i1][i3];
-		p_r3 = &rr[i3][i3];
-		*p_rrv = *p_r3 + 2.0F * (*p_r0 + *p_r1);
-		*(p_rrv + 4) = *(p_r3 + 164) + 2.0F * (*(p_r0 + 4) + *(p_r1 + 4)
-		    );
-		*(p_rrv + 8) = *(p_r3 + 328) + 2.0F * (*(p_r0 + 8) + *(p_r1 + 8)
-		    );
-		*(p_rrv + 12) =
-		    *(p_r3 + 492) + 2.0F * (*(p_r0 + 12) + *(p_r1 + 12));
-		*(p_rrv + 16) =
-		    *(p_r3 + 656) + 2.0F * (*(p_r0 + 16) + *(p_r1 + 16));
-		*(p_rrv + 20) =
-		    *(p_r3 + 820) + 2.0F * (*(p_r0 + 20) + *(p_r1 + 20));
-		*(p_rrv + 24) =
-		    *(p_r3 + 984) + 2.0F * (*(p_r0 + 24) + *(p_r1 + 24));
-		*(p_rrv + 28) =
-		    *(p_r3 + 1148) + 2.0F * (*(p_r0 + 28) + *(p_r1 + 28));
-		*(p_rrv + 32) =
-		    *(p_r3 + 1312) + 2.0F * (*(p_r0 + 32) + *(p_r1 + 32));
-		*(p_rrv + 36) =
-		    *(p_r3 + 1476) + 2.0F * (*(p_r0 + 36) + *(p_r1 + 36));
+		p_rrv = &rrv[TRACK_IDX(i3, NB_TRACK_MR102)];
+		p_r0 = &rr[TRACK_IDX(i0, NB_TRACK_MR102)]
+		    [TRACK_IDX(i3, NB_TRACK_MR102)];
+		p_r1 = &rr[TRACK_IDX(i1, NB_TRACK_MR102)]
+		    [TRACK_IDX(i3, NB_TRACK_MR102)];
+		p_r3 = &rr[TRACK_IDX(i3, NB_TRACK_MR102)]
+		    [TRACK_IDX(i3, NB_TRACK_MR102)];
+		for (j = 0; j < L_CODE / NB_TRACK_MR102; j++)
+			p_rrv[j] = p_r3[(L_CODE + 1) * j]
+			    + 2.0F * (p_r0[j] + p_r1[j]);
 		sq = -1;
 		alp = 1;
 		ps = 0;
 		ia = i2;
 		ib = i3;
-		p_r0 = &rr[i0][i2];
-		p_r1 = &rr[i1][i2];
-		p_r2 = &rr[i2][i2];
-		p_r3 = &rr[i2][i3];
+		p_r0 = &rr[TRACK_IDX(i0, NB_TRACK_MR102)]
+		    [TRACK_IDX(i2, NB_TRACK_MR102)];
+		p_r1 = &rr[TRACK_IDX(i1, NB_TRACK_MR102)]
+		    [TRACK_IDX(i2, NB_TRACK_MR102)];
+		p_r2 = &rr[TRACK_IDX(i2, NB_TRACK_MR102)]
+		    [TRACK_IDX(i2, NB_TRACK_MR102)];
+		p_r3 = &rr[TRACK_IDX(i2, NB_TRACK_MR102)]
+		    [TRACK_IDX(i3, NB_TRACK_MR102)];
 		p_dn0 = dn + i2;
 		p_dn1 = dn + i3;
-		p_rrv0 = rrv + i3;
+		p_rrv0 = rrv + TRACK_IDX(i3, NB_TRACK_MR102);
+		p_dn_t = &dn_t[TRACK_IDX(i3, NB_TRACK_MR102)];
+		nb = (int32_t) (p_dn_max - p_dn1 + 3) / 4;
 
 		do {
 			ps1 = ps0 + *p_dn0;
 			alp1 = alp0 + *p_r2 + 2.0F * (*p_r0 + *p_r1);
-			p_rrv = p_rrv0;
-			p_dn = p_dn1;
-			p_r4 = p_r3;
-
-			do {
-				ps2 = ps1 + *p_dn;
-				sq2 = ps2 * ps2;
-				alp2 = alp1 + *p_rrv + 2.0F * *p_r4;
-
-				if ((alp * sq2) > (sq * alp2)) {
-					sq = sq2;
-					ps = ps2;
-					alp = alp2;
-					ia = p_dn0 - dn;
-					ib = p_dn - dn;
-				}
-				p_rrv += 4;
-				p_dn += 4;
-				p_r4 += 4;
-			} while (p_dn < p_dn_max);
+			ix = search_pulse_pair(ps1, alp1, p_dn_t, p_rrv0,
+					       p_r3, nb, &sq, &alp, &ps);
+			if (ix >= 0) {
+				ia = (p_dn0 - dn);
+				ib = (p_dn1 - dn + 4 * ix);
+			}
 			p_dn0 += 4;
-			p_r0 += 4;
-			p_r1 += 4;
-			p_r2 += 164;
-			p_r3 += 160;
+			p_r0++;
+			p_r1++;
+			p_r2 += L_CODE + 1;
+			p_r3 += L_CODE;
 		} while (p_dn0 <= p_dn_max);
 		i2 = ia;
 		i3 = ib;
 
 		/* i4 and i5 loop */
-		p_rrv = rrv + i5;
-		p_r0 = &rr[i0][i5];
-		p_r1 = &rr[i1][i5];
-		p_r2 = &rr[i2][i5];
-		p_r3 = &rr[i3][i5];
-		p_r5 = &rr[i5][i5];
-		*p_rrv = *p_r5 + 2.0F * (*p_r0 + *p_r1 + *p_r2 + *p_r3);
-		*(p_rrv + 4) = *(p_r5 + 164) + 2.0F * (*(p_r0 + 4) + *(p_r1 + 4)
-						       + *(p_r2 + 4) + *(p_r3 +
-									 4));
-		*(p_rrv + 8) = *(p_r5 + 328) + 2.0F * (*(p_r0 + 8) + *(p_r1 + 8)
-						       + *(p_r2 + 8) + *(p_r3 +
-									 8));
-		*(p_rrv + 12) =
-		    *(p_r5 + 492) + 2.0F * (*(p_r0 + 12) + *(p_r1 + 12) +
-					    *(p_r2 + 12) + *(p_r3 + 12));
-		*(p_rrv + 16) =
-		    *(p_r5 + 656) + 2.0F * (*(p_r0 + 16) + *(p_r1 + 16) +
-					    *(p_r2 + 16) + *(p_r3 + 16));
-		*(p_rrv + 20) =
-		    *(p_r5 + 820) + 2.0F * (*(p_r0 + 20) + *(p_r1 + 20) +
-					    *(p_r2 + 20) + *(p_r3 + 20));
-		*(p_rrv + 24) =
-		    *(p_r5 + 984) + 2.0F * (*(p_r0 + 24) + *(p_r1 + 24) +
-					    *(p_r2 + 24) + *(p_r3 + 24));
-		*(p_rrv + 28) =
-		    *(p_r5 + 1148) + 2.0F * (*(p_r0 + 28) + *(p_r1 + 28) +
-					     *(p_r2 + 28) + *(p_r3 + 28));
-		*(p_rrv + 32) =
-		    *(p_r5 + 1312) + 2.0F * (*(p_r0 + 32) + *(p_r1 + 32) +
-					     *(p_r2 + 32) + *(p_r3 + 32));
-		*(p_rrv + 36) =
-		    *(p_r5 + 1476) + 2.0F * (*(p_r0 + 36) + *(p_r1 + 36) +
-					     *(p_r2 + 36) + *(p_r3 + 36));
+		p_rrv = rrv + TRACK_IDX(i5, NB_TRACK_MR102);
+		p_r0 = &rr[TRACK_IDX(i0, NB_TRACK_MR102)]
+		    [TRACK_IDX(i5, NB_TRACK_MR102)];
+		p_r1 = &rr[TRACK_IDX(i1, NB_TRACK_MR102)]
+		    [TRACK_IDX(i5, NB_TRACK_MR102)];
+		p_r2 = &rr[TRACK_IDX(i2, NB_TRACK_MR102)]
+		    [TRACK_IDX(i5, NB_TRACK_MR102)];
+		p_r3 = &rr[TRACK_IDX(i3, NB_TRACK_MR102)]
+		    [TRACK_IDX(i5, NB_TRACK_MR102)];
+		p_r5 = &rr[TRACK_IDX(i5, NB_TRACK_MR102)]
+		    [TRACK_IDX(i5, NB_TRACK_MR102)];
+		for (j = 0; j < L_CODE / NB_TRACK_MR102; j++)
+			p_rrv[j] = p_r5[(L_CODE + 1) * j]
+			    + 2.0F * (p_r0[j] + p_r1[j] + p_r2[j] + p_r3[j]);
 
 		/* Default value */
 		ps0 = ps;
@@ -5670,100 +5756,64 @@ static void search_8i40(float dn[], float rr[][L_CODE], int32_t ipos[],
 		ib = i5;
 		p_dn0 = dn + i4;
 		p_dn1 = dn + i5;
-		p_r0 = &rr[i0][i4];
-		p_r1 = &rr[i1][i4];
-		p_r2 = &rr[i2][i4];
-		p_r3 = &rr[i3][i4];
-		p_r4 = &rr[i4][i4];
-		p_r5 = &rr[i4][i5];
-		p_rrv0 = rrv + i5;
+		p_r0 = &rr[TRACK_IDX(i0, NB_TRACK_MR102)]
+		    [TRACK_IDX(i4, NB_TRACK_MR102)];
+		p_r1 = &rr[TRACK_IDX(i1, NB_TRACK_MR102)]
+		    [TRACK_IDX(i4, NB_TRACK_MR102)];
+		p_r2 = &rr[TRACK_IDX(i2, NB_TRACK_MR102)]
+		    [TRACK_IDX(i4, NB_TRACK_MR102)];
+		p_r3 = &rr[TRACK_IDX(i3, NB_TRACK_MR102)]
+		    [TRACK_IDX(i4, NB_TRACK_MR102)];
+		p_r4 = &rr[TRACK_IDX(i4, NB_TRACK_MR102)]
+		    [TRACK_IDX(i4, NB_TRACK_MR102)];
+		p_r5 = &rr[TRACK_IDX(i4, NB_TRACK_MR102)]
+		    [TRACK_IDX(i5, NB_TRACK_MR102)];
+		p_rrv0 = rrv + TRACK_IDX(i5, NB_TRACK_MR102);
+		p_dn_t = &dn_t[TRACK_IDX(i5, NB_TRACK_MR102)];
+		nb = (int32_t) (p_dn_max - p_dn1 + 4) / 4;
 
 		do {
 			ps1 = ps0 + *p_dn0;
 			alp1 =
 			    alp0 + *p_r4 + 2.0F * (*p_r0 + *p_r1 + *p_r2 +
 						   *p_r3);
-			p_dn = p_dn1;
-			p_r6 = p_r5;
-			p_rrv = p_rrv0;
-
-			do {
-				ps2 = ps1 + *p_dn;
-				sq2 = ps2 * ps2;
-				alp2 = alp1 + *p_rrv + 2.0F * *p_r6;
-
-				if ((alp * sq2) > (sq * alp2)) {
-					sq = sq2;
-					ps = ps2;
-					alp = alp2;
-					ia = p_dn0 - dn;
-					ib = p_dn - dn;
-				}
-				p_dn += 4;
-				p_rrv += 4;
-				p_r6 += 4;
-			} while (p_dn <= p_dn_max);
-			p_r0 += 4;
-			p_r1 += 4;
-			p_r2 += 4;
-			p_r3 += 4;
-			p_r4 += 164;
-			p_r5 += 160;
+			ix = search_pulse_pair(ps1, alp1, p_dn_t, p_rrv0,
+					       p_r5, nb, &sq, &alp, &ps);
+			if (ix >= 0) {
+				ia = (p_dn0 - dn);
+				ib = (p_dn1 - dn + 4 * ix);
+			}
+			p_r0++;
+			p_r1++;
+			p_r2++;
+			p_r3++;
+			p_r4 += L_CODE + 1;
+			p_r5 += L_CODE;
 			p_dn0 += 4;
 		} while (p_dn0 < p_dn_max);
 		i4 = ia;
 		i5 = ib;
 
 		/* i6 and i7 loop */
-		p_rrv = rrv + i7;
-		p_r0 = &rr[i0][i7];
-		p_r1 = &rr[i1][i7];
-		p_r2 = &rr[i2][i7];
-		p_r3 = &rr[i3][i7];
-		p_r4 = &rr[i4][i7];
-		p_r5 = &rr[i5][i7];
-		p_r7 = &rr[i7][i7];
-		*p_rrv =
-		    *p_r7 + 2.0F * (*p_r0 + *p_r1 + *p_r2 + *p_r3 + *p_r4 +
-				    *p_r5);
-		*(p_rrv + 4) = *(p_r7 + 164) + 2.0F * (*(p_r0 + 4) + *(p_r1 + 4)
-						       + *(p_r2 + 4) + *(p_r3 +
-									 4) +
-						       *(p_r4 + 4) + *(p_r5 +
-								       4));
-		*(p_rrv + 8) = *(p_r7 + 328) + 2.0F * (*(p_r0 + 8) + *(p_r1 + 8)
-						       + *(p_r2 + 8) + *(p_r3 +
-									 8) +
-						       *(p_r4 + 8) + *(p_r5 +
-								       8));
-		*(p_rrv + 12) =
-		    *(p_r7 + 492) + 2.0F * (*(p_r0 + 12) + *(p_r1 + 12) +
-					    *(p_r2 + 12) + *(p_r3 + 12) +
-					    *(p_r4 + 12) + *(p_r5 + 12));
-		*(p_rrv + 16) =
-		    *(p_r7 + 656) + 2.0F * (*(p_r0 + 16) + *(p_r1 + 16) +
-					    *(p_r2 + 16) + *(p_r3 + 16) +
-					    *(p_r4 + 16) + *(p_r5 + 16));
-		*(p_rrv + 20) =
-		    *(p_r7 + 820) + 2.0F * (*(p_r0 + 20) + *(p_r1 + 20) +
-					    *(p_r2 + 20) + *(p_r3 + 20) +
-					    *(p_r4 + 20) + *(p_r5 + 20));
-		*(p_rrv + 24) =
-		    *(p_r7 + 984) + 2.0F * (*(p_r0 + 24) + *(p_r1 + 24) +
-					    *(p_r2 + 24) + *(p_r3 + 24) +
-					    *(p_r4 + 24) + *(p_r5 + 24));
-		*(p_rrv + 28) =
-		    *(p_r7 + 1148) + 2.0F * (*(p_r0 + 28) + *(p_r1 + 28) +
-					     *(p_r2 + 28) + *(p_r3 + 28) +
-					     *(p_r4 + 28) + *(p_r5 + 28));
-		*(p_rrv + 32) =
-		    *(p_r7 + 1312) + 2.0F * (*(p_r0 + 32) + *(p_r1 + 32) +
-					     *(p_r2 + 32) + *(p_r3 + 32) +
-					     *(p_r4 + 32) + *(p_r5 + 32));
-		*(p_rrv + 36) =
-		    *(p_r7 + 1476) + 2.0F * (*(p_r0 + 36) + *(p_r1 + 36) +
-					     *(p_r2 + 36) + *(p_r3 + 36) +
-					     *(p_r4 + 36) + *(p_r5 + 36));
+		p_rrv = rrv + TRACK_IDX(i7, NB_TRACK_MR102);
+		p_r0 = &rr[TRACK_IDX(i0, NB_TRACK_MR102)]
+		    [TRACK_IDX(i7, NB_TRACK_MR102)];
+		p_r1 = &rr[TRACK_IDX(i1, NB_TRACK_MR102)]
+		    [TRACK_IDX(i7, NB_TRACK_MR102)];
+		p_r2 = &rr[TRACK_IDX(i2, NB_TRACK_MR102)]
+		    [TRACK_IDX(i7, NB_TRACK_MR102)];
+		p_r3 = &rr[TRACK_IDX(i3, NB_TRACK_MR102)]
+		    [TRACK_IDX(i7, NB_TRACK_MR102)];
+		p_r4 = &rr[TRACK_IDX(i4, NB_TRACK_MR102)]
+		    [TRACK_IDX(i7, NB_TRACK_MR102)];
+		p_r5 = &rr[TRACK_IDX(i5, NB_TRACK_MR102)]
+		    [TRACK_IDX(i7, NB_TRACK_MR102)];
+		p_r7 = &rr[TRACK_IDX(i7, NB_TRACK_MR102)]
+		    [TRACK_IDX(i7, NB_TRACK_MR102)];
+		for (j = 0; j < L_CODE / NB_TRACK_MR102; j++)
+			p_rrv[j] = p_r7[(L_CODE + 1) * j]
+			    + 2.0F * (p_r0[j] + p_r1[j] + p_r2[j] + p_r3[j] +
+				       p_r4[j] + p_r5[j]);
 
 		/* Default value */
 		ps0 = ps;
@@ -5774,48 +5824,45 @@ static void search_8i40(float dn[], float rr[][L_CODE], int32_t ipos[],
 		ib = i7;
 		p_dn0 = dn + i6;
 		p_dn1 = dn + i7;
-		p_r0 = &rr[i0][i6];
-		p_r1 = &rr[i1][i6];
-		p_r2 = &rr[i2][i6];
-		p_r3 = &rr[i3][i6];
-		p_r4 = &rr[i4][i6];
-		p_r5 = &rr[i5][i6];
-		p_r6 = &rr[i6][i6];
-		p_r7 = &rr[i6][i7];
-		p_rrv0 = rrv + i7;
+		p_r0 = &rr[TRACK_IDX(i0, NB_TRACK_MR102)]
+		    [TRACK_IDX(i6, NB_TRACK_MR102)];
+		p_r1 = &rr[TRACK_IDX(i1, NB_TRACK_MR102)]
+		    [TRACK_IDX(i6, NB_TRACK_MR102)];
+		p_r2 = &rr[TRACK_IDX(i2, NB_TRACK_MR102)]
+		    [TRACK_IDX(i6, NB_TRACK_MR102)];
+		p_r3 = &rr[TRACK_IDX(i3, NB_TRACK_MR102)]
+		    [TRACK_IDX(i6, NB_TRACK_MR102)];
+		p_r4 = &rr[TRACK_IDX(i4, NB_TRACK_MR102)]
+		    [TRACK_IDX(i6, NB_TRACK_MR102)];
+		p_r5 = &rr[TRACK_IDX(i5, NB_TRACK_MR102)]
+		    [TRACK_IDX(i6, NB_TRACK_MR102)];
+		p_r6 = &rr[TRACK_IDX(i6, NB_TRACK_MR102)]
+		    [TRACK_IDX(i6, NB_TRACK_MR102)];
+		p_r7 = &rr[TRACK_IDX(i6, NB_TRACK_MR102)]
+		    [TRACK_IDX(i7, NB_TRACK_MR102)];
+		p_rrv0 = rrv + TRACK_IDX(i7, NB_TRACK_MR102);
+		p_dn_t = &dn_t[TRACK_IDX(i7, NB_TRACK_MR102)];
+		nb = (int32_t) (p_dn_max - p_dn1 + 4) / 4;
 
 		do {
 			ps1 = ps0 + *p_dn0;
 			alp1 =
 			    alp0 + *p_r6 + 2.0F * (*p_r0 + *p_r1 + *p_r2 +
 						   *p_r3 + *p_r4 + *p_r5);
-			p_dn = p_dn1;
-			p_r8 = p_r7;
-			p_rrv = p_rrv0;
-
-			do {
-				ps2 = ps1 + *p_dn;
-				sq2 = ps2 * ps2;
-				alp2 = alp1 + *p_rrv + 2.0F * *p_r8;
-
-				if ((alp * sq2) > (sq * alp2)) {
-					sq = sq2;
-					alp = alp2;
-					ia = p_dn0 - dn;
-					ib = p_dn - dn;
-				}
-				p_dn += 4;
-				p_rrv += 4;
-				p_r8 += 4;
-			} while (p_dn <= p_dn_max);
-			p_r0 += 4;
-			p_r1 += 4;
-			p_r2 += 4;
-			p_r3 += 4;
-			p_r4 += 4;
-			p_r5 += 4;
-			p_r6 += 164;
-			p_r7 += 160;
+			ix = search_pulse_pair(ps1, alp1, p_dn_t, p_rrv0,
+					       p_r7, nb, &sq, &alp, &ps);
+			if (ix >= 0) {
+				ia = (p_dn0 - dn);
+				ib = (p_dn1 - dn + 4 * ix);
+			}
+			p_r0++;
+			p_r1++;
+			p_r2++;
+			p_r3++;
+			p_r4++;
+			p_r5++;
+			p_r6 += L_CODE + 1;
+			p_r7 += L_CODE;
 			p_dn0 += 4;
 		} while (p_dn0 < p_dn_max);
 
@@ -6127,7 +6174,7 @@ static void code_8i40_31bits(float x[], float cn[], float h[],
 
 	cor_h_x(h, x, dn);
 	set_sign12k2(dn, cn, sign, pos_max, NB_TRACK_MR102, ipos, STEP_MR102);
-	cor_h(h, sign, rr);
+	cor_h(h, sign, rr, NB_TRACK_MR102);
 	search_8i40(dn, rr, ipos, pos_max, codvec);
 	build_code_8i40_31bits(codvec, sign, code, h, y, linear_signs,
 			       linear_codewords);
@@ -6181,15 +6228,20 @@ static void code_8i40_31bits(float x[], float cn[], float h[],
 static void search_10i40(float dn[], float rr[][L_CODE], int32_t ipos[],
 			 int32_t pos_max[], int32_t codvec[])
 {
-	float rrv[L_CODE];
-	float psk, ps, ps0, ps1, ps2, sq, sq2, alpk, alp, alp0, alp1, alp2;
+	float rrv[L_CODE], dn_t[L_CODE];
+	float psk, ps, ps0, ps1, sq, alpk, alp, alp0, alp1;
 	float *p_r, *p_r0, *p_r1, *p_r2, *p_r3, *p_r4, *p_r5, *p_r6, *p_r7,
-	    *p_r8, *p_r9, *p_r10;
-	float *p_rrv, *p_rrv0, *p_dn, *p_dn0, *p_dn1, *p_dn_max;
+	    *p_r8, *p_r9;
+	float *p_rrv, *p_rrv0, *p_dn0, *p_dn1, *p_dn_max, *p_dn_t;
 	int32_t i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, j, k, ia, ib, i, pos;
+	int32_t nb, ix;
 
 	p_dn_max = &dn[39];
 
+	/* dn[] in track order for the inner loops */
+	for (i = 0; i < L_CODE; i++)
+		dn_t[TRACK_IDX(i, NB_TRACK)] = dn[i];
+
 	/* fix i0 on maximum of correlation position */
 	i0 = pos_max[ipos[0]];
 
@@ -6200,7 +6252,7 @@ static void search_10i40(float dn[], float rr[][L_CODE], int32_t ipos[],
 	for (i = 0; i < 10; i++) {
 		codvec[i] = i;
 	}
-	p_r = &rr[i0][i0];
+	p_r = &rr[TRACK_IDX(i0, NB_TRACK)][TRACK_IDX(i0, NB_TRACK)];
 
 	for (i = 1; i < 5; i++) {
 		i1 = pos_max[ipos[1]];
@@ -6213,102 +6265,60 @@ static void search_10i40(float dn[], float rr[][L_CODE], int32_t ipos[],
 		i8 = ipos[8];
 		i9 = ipos[9];
 		ps0 = dn[i0] + dn[i1];
-		alp0 = *p_r + rr[i1][i1] + 2.0F * rr[i0][i1];
+		k = TRACK_IDX(i1, NB_TRACK);
+		alp0 = *p_r + rr[k][k] + 2.0F * rr[TRACK_IDX(i0, NB_TRACK)][k];
 
 		/* i2 and i3 loop */
-		p_rrv = &rrv[i3];
-		p_r0 = &rr[i0][i3];
-		p_r1 = &rr[i1][i3];
-		p_r3 = &rr[i3][i3];
-		*p_rrv = *p_r3 + 2.0F * (*p_r0 + *p_r1);
-		*(p_rrv + 5) = *(p_r3 + 205) + 2.0F * (*(p_r0 + 5) + *(p_r1 + 5)
-		    );
-		*(p_rrv + 10) =
-		    *(p_r3 + 410) + 2.0F * (*(p_r0 + 10) + *(p_r1 + 10));
-		*(p_rrv + 15) =
-		    *(p_r3 + 615) + 2.0F * (*(p_r0 + 15) + *(p_r1 + 15));
-		*(p_rrv + 20) =
-		    *(p_r3 + 820) + 2.0F * (*(p_r0 + 20) + *(p_r1 + 20));
-		*(p_rrv + 25) =
-		    *(p_r3 + 1025) + 2.0F * (*(p_r0 + 25) + *(p_r1 + 25));
-		*(p_rrv + 30) =
-		    *(p_r3 + 1230) + 2.0F * (*(p_r0 + 30) + *(p_r1 + 30));
-		*(p_rrv + 35) =
-		    *(p_r3 + 1435) + 2.0F * (*(p_r0 + 35) + *(p_r1 + 35));
+		p_rrv = &rrv[TRACK_IDX(i3, NB_TRACK)];
+		p_r0 = &rr[TRACK_IDX(i0, NB_TRACK)][TRACK_IDX(i3, NB_TRACK)];
+		p_r1 = &rr[TRACK_IDX(i1, NB_TRACK)][TRACK_IDX(i3, NB_TRACK)];
+		p_r3 = &rr[TRACK_IDX(i3, NB_TRACK)][TRACK_IDX(i3, NB_TRACK)];
+		for (j = 0; j < L_CODE / NB_TRACK; j++)
+			p_rrv[j] = p_r3[(L_CODE + 1) * j]
+			    + 2.0F * (p_r0[j] + p_r1[j]);
 		sq = -1;
 		alp = 1;
 		ps = 0;
 		ia = i2;
 		ib = i3;
-		p_r0 = &rr[i0][i2];
-		p_r1 = &rr[i1][i2];
-		p_r2 = &rr[i2][i2];
-		p_r3 = &rr[i2][i3];
+		p_r0 = &rr[TRACK_IDX(i0, NB_TRACK)][TRACK_IDX(i2, NB_TRACK)];
+		p_r1 = &rr[TRACK_IDX(i1, NB_TRACK)][TRACK_IDX(i2, NB_TRACK)];
+		p_r2 = &rr[TRACK_IDX(i2, NB_TRACK)][TRACK_IDX(i2, NB_TRACK)];
+		p_r3 = &rr[TRACK_IDX(i2, NB_TRACK)][TRACK_IDX(i3, NB_TRACK)];
 		p_dn0 = dn + i2;
 		p_dn1 = dn + i3;
-		p_rrv0 = rrv + i3;
+		p_rrv0 = rrv + TRACK_IDX(i3, NB_TRACK);
+		p_dn_t = &dn_t[TRACK_IDX(i3, NB_TRACK)];
+		nb = (int32_t) (p_dn_max - p_dn1 + 4) / 5;
 
 		do {
 			ps1 = ps0 + *p_dn0;
 			alp1 = alp0 + *p_r2 + 2.0F * (*p_r0 + *p_r1);
-			p_rrv = p_rrv0;
-			p_dn = p_dn1;
-			p_r4 = p_r3;
-
-			do {
-				ps2 = ps1 + *p_dn;
-				sq2 = ps2 * ps2;
-				alp2 = alp1 + *p_rrv + 2.0F * *p_r4;
-
-				if ((alp * sq2) > (sq * alp2)) {
-					sq = sq2;
-					ps = ps2;
-					alp = alp2;
-					ia = (int16_t) (p_dn0 - dn);
-					ib = (int16_t) (p_dn - dn);
-				}
-				p_rrv += 5;
-				p_dn += 5;
-				p_r4 += 5;
-			} while (p_dn < p_dn_max);
+			ix = search_pulse_pair(ps1, alp1, p_dn_t, p_rrv0,
+					       p_r3, nb, &sq, &alp, &ps);
+			if (ix >= 0) {
+				ia = (int16_t) (p_dn0 - dn);
+				ib = (int16_t) (p_dn1 - dn + 5 * ix);
+			}
 			p_dn0 += 5;
-			p_r0 += 5;
-			p_r1 += 5;
-			p_r2 += 205;
-			p_r3 += 200;
+			p_r0++;
+			p_r1++;
+			p_r2 += L_CODE + 1;
+			p_r3 += L_CODE;
 		} while (p_dn0 <= p_dn_max);
 		i2 = ia;
 		i3 = ib;
 
 		/* i4 and i5 loop */
-		p_rrv = rrv + i5;
-		p_r0 = &rr[i0][i5];
-		p_r1 = &rr[i1][i5];
-		p_r2 = &rr[i2][i5];
-		p_r3 = &rr[i3][i5];
-		p_r5 = &rr[i5][i5];
-		*p_rrv = *p_r5 + 2.0F * (*p_r0 + *p_r1 + *p_r2 + *p_r3);
-		*(p_rrv + 5) = *(p_r5 + 205) + 2.0F * (*(p_r0 + 5) + *(p_r1 + 5)
-						       + *(p_r2 + 5) + *(p_r3 +
-									 5));
-		*(p_rrv + 10) =
-		    *(p_r5 + 410) + 2.0F * (*(p_r0 + 10) + *(p_r1 + 10) +
-					    *(p_r2 + 10) + *(p_r3 + 10));
-		*(p_rrv + 15) =
-		    *(p_r5 + 615) + 2.0F * (*(p_r0 + 15) + *(p_r1 + 15) +
-					    *(p_r2 + 15) + *(p_r3 + 15));
-		*(p_rrv + 20) =
-		    *(p_r5 + 820) + 2.0F * (*(p_r0 + 20) + *(p_r1 + 20) +
-					    *(p_r2 + 20) + *(p_r3 + 20));
-		*(p_rrv + 25) =
-		    *(p_r5 + 1025) + 2.0F * (*(p_r0 + 25) + *(p_r1 + 25) +
-					     *(p_r2 + 25) + *(p_r3 + 25));
-		*(p_rrv + 30) =
-		    *(p_r5 + 1230) + 2.0F * (*(p_r0 + 30) + *(p_r1 + 30) +
-					     *(p_r2 + 30) + *(p_r3 + 30));
-		*(p_rrv + 35) =
-		    *(p_r5 + 1435) + 2.0F * (*(p_r0 + 35) + *(p_r1 + 35) +
-					     *(p_r2 + 35) + *(p_r3 + 35));
+		p_rrv = rrv + TRACK_IDX(i5, NB_TRACK);
+		p_r0 = &rr[TRACK_IDX(i0, NB_TRACK)][TRACK_IDX(i5, NB_TRACK)];
+		p_r1 = &rr[TRACK_IDX(i1, NB_TRACK)][TRACK_IDX(i5, NB_TRACK)];
+		p_r2 = &rr[TRACK_IDX(i2, NB_TRACK)][TRACK_IDX(i5, NB_TRACK)];
+		p_r3 = &rr[TRACK_IDX(i3, NB_TRACK)][TRACK_IDX(i5, NB_TRACK)];
+		p_r5 = &rr[TRACK_IDX(i5, NB_TRACK)][TRACK_IDX(i5, NB_TRACK)];
+		for (j = 0; j < L_CODE / NB_TRACK; j++)
+			p_rrv[j] = p_r5[(L_CODE + 1) * j]
+			    + 2.0F * (p_r0[j] + p_r1[j] + p_r2[j] + p_r3[j]);
 
 		/* Default value */
 		ps0 = ps;
@@ -6320,91 +6330,51 @@ static void search_10i40(float dn[], float rr[][L_CODE], int32_t ipos[],
 		ib = i5;
 		p_dn0 = dn + i4;
 		p_dn1 = dn + i5;
-		p_r0 = &rr[i0][i4];
-		p_r1 = &rr[i1][i4];
-		p_r2 = &rr[i2][i4];
-		p_r3 = &rr[i3][i4];
-		p_r4 = &rr[i4][i4];
-		p_r5 = &rr[i4][i5];
-		p_rrv0 = rrv + i5;
+		p_r0 = &rr[TRACK_IDX(i0, NB_TRACK)][TRACK_IDX(i4, NB_TRACK)];
+		p_r1 = &rr[TRACK_IDX(i1, NB_TRACK)][TRACK_IDX(i4, NB_TRACK)];
+		p_r2 = &rr[TRACK_IDX(i2, NB_TRACK)][TRACK_IDX(i4, NB_TRACK)];
+		p_r3 = &rr[TRACK_IDX(i3, NB_TRACK)][TRACK_IDX(i4, NB_TRACK)];
+		p_r4 = &rr[TRACK_IDX(i4, NB_TRACK)][TRACK_IDX(i4, NB_TRACK)];
+		p_r5 = &rr[TRACK_IDX(i4, NB_TRACK)][TRACK_IDX(i5, NB_TRACK)];
+		p_rrv0 = rrv + TRACK_IDX(i5, NB_TRACK);
+		p_dn_t = &dn_t[TRACK_IDX(i5, NB_TRACK)];
+		nb = (int32_t) (p_dn_max - p_dn1 + 5) / 5;
 
 		do {
 			ps1 = ps0 + *p_dn0;
 			alp1 =
 			    alp0 + *p_r4 + 2.0F * (*p_r0 + *p_r1 + *p_r2 +
 						   *p_r3);
-			p_dn = p_dn1;
-			p_r6 = p_r5;
-			p_rrv = p_rrv0;
-
-			do {
-				ps2 = ps1 + *p_dn;
-				sq2 = ps2 * ps2;
-				alp2 = alp1 + *p_rrv + 2.0F * *p_r6;
-
-				if ((alp * sq2) > (sq * alp2)) {
-					sq = sq2;
-					ps = ps2;
-					alp = alp2;
-					ia = (int16_t) (p_dn0 - dn);
-					ib = (int16_t) (p_dn - dn);
-				}
-				p_dn += 5;
-				p_rrv += 5;
-				p_r6 += 5;
-			} while (p_dn <= p_dn_max);
-			p_r0 += 5;
-			p_r1 += 5;
-			p_r2 += 5;
-			p_r3 += 5;
-			p_r4 += 205;
-			p_r5 += 200;
+			ix = search_pulse_pair(ps1, alp1, p_dn_t, p_rrv0,
+					       p_r5, nb, &sq, &alp, &ps);
+			if (ix >= 0) {
+				ia = (int16_t) (p_dn0 - dn);
+				ib = (int16_t) (p_dn1 - dn + 5 * ix);
+			}
+			p_r0++;
+			p_r1++;
+			p_r2++;
+			p_r3++;
+			p_r4 += L_CODE + 1;
+			p_r5 += L_CODE;
 			p_dn0 += 5;
 		} while (p_dn0 < p_dn_max);
 		i4 = ia;
 		i5 = ib;
 
 		/* i6 and i7 loop */
-		p_rrv = rrv + i7;
-		p_r0 = &rr[i0][i7];
-		p_r1 = &rr[i1][i7];
-		p_r2 = &rr[i2][i7];
-		p_r3 = &rr[i3][i7];
-		p_r4 = &rr[i4][i7];
-		p_r5 = &rr[i5][i7];
-		p_r7 = &rr[i7][i7];
-		*p_rrv =
-		    *p_r7 + 2.0F * (*p_r0 + *p_r1 + *p_r2 + *p_r3 + *p_r4 +
-				    *p_r5);
-		*(p_rrv + 5) = *(p_r7 + 205) + 2.0F * (*(p_r0 + 5) + *(p_r1 + 5)
-						       + *(p_r2 + 5) + *(p_r3 +
-									 5) +
-						       *(p_r4 + 5) + *(p_r5 +
-								       5));
-		*(p_rrv + 10) =
-		    *(p_r7 + 410) + 2.0F * (*(p_r0 + 10) + *(p_r1 + 10) +
-					    *(p_r2 + 10) + *(p_r3 + 10) +
-					    *(p_r4 + 10) + *(p_r5 + 10));
-		*(p_rrv + 15) =
-		    *(p_r7 + 615) + 2.0F * (*(p_r0 + 15) + *(p_r1 + 15) +
-					    *(p_r2 + 15) + *(p_r3 + 15) +
-					    *(p_r4 + 15) + *(p_r5 + 15));
-		*(p_rrv + 20) =
-		    *(p_r7 + 820) + 2.0F * (*(p_r0 + 20) + *(p_r1 + 20) +
-					    *(p_r2 + 20) + *(p_r3 + 20) +
-					    *(p_r4 + 20) + *(p_r5 + 20));
-		*(p_rrv + 25) =
-		    *(p_r7 + 1025) + 2.0F * (*(p_r0 + 25) + *(p_r1 + 25) +
-					     *(p_r2 + 25) + *(p_r3 + 25) +
-					     *(p_r4 + 25) + *(p_r5 + 25));
-		*(p_rrv + 30) =
-		    *(p_r7 + 1230) + 2.0F * (*(p_r0 + 30) + *(p_r1 + 30) +
-					     *(p_r2 + 30) + *(p_r3 + 30) +
-					     *(p_r4 + 30) + *(p_r5 + 30));
-		*(p_rrv + 35) =
-		    *(p_r7 + 1435) + 2.0F * (*(p_r0 + 35) + *(p_r1 + 35) +
-					     *(p_r2 + 35) + *(p_r3 + 35) +
-					     *(p_r4 + 35) + *(p_r5 + 35));
+		p_rrv = rrv + TRACK_IDX(i7, NB_TRACK);
+		p_r0 = &rr[TRACK_IDX(i0, NB_TRACK)][TRACK_IDX(i7, NB_TRACK)];
+		p_r1 = &rr[TRACK_IDX(i1, NB_TRACK)][TRACK_IDX(i7, NB_TRACK)];
+		p_r2 = &rr[TRACK_IDX(i2, NB_TRACK)][TRACK_IDX(i7, NB_TRACK)];
+		p_r3 = &rr[TRACK_IDX(i3, NB_TRACK)][TRACK_IDX(i7, NB_TRACK)];
+		p_r4 = &rr[TRACK_IDX(i4, NB_TRACK)][TRACK_IDX(i7, NB_TRACK)];
+		p_r5 = &rr[TRACK_IDX(i5, NB_TRACK)][TRACK_IDX(i7, NB_TRACK)];
+		p_r7 = &rr[TRACK_IDX(i7, NB_TRACK)][TRACK_IDX(i7, NB_TRACK)];
+		for (j = 0; j < L_CODE / NB_TRACK; j++)
+			p_rrv[j] = p_r7[(L_CODE + 1) * j]
+			    + 2.0F * (p_r0[j] + p_r1[j] + p_r2[j] + p_r3[j] +
+				       p_r4[j] + p_r5[j]);
 
 		/* Default value */
 		ps0 = ps;
@@ -6416,105 +6386,57 @@ static void search_10i40(float dn[], float rr[][L_CODE], int32_t ipos[],
 		ib = i7;
 		p_dn0 = dn + i6;
 		p_dn1 = dn + i7;
-		p_r0 = &rr[i0][i6];
-		p_r1 = &rr[i1][i6];
-		p_r2 = &rr[i2][i6];
-		p_r3 = &rr[i3][i6];
-		p_r4 = &rr[i4][i6];
-		p_r5 = &rr[i5][i6];
-		p_r6 = &rr[i6][i6];
-		p_r7 = &rr[i6][i7];
-		p_rrv0 = rrv + i7;
+		p_r0 = &rr[TRACK_IDX(i0, NB_TRACK)][TRACK_IDX(i6, NB_TRACK)];
+		p_r1 = &rr[TRACK_IDX(i1, NB_TRACK)][TRACK_IDX(i6, NB_TRACK)];
+		p_r2 = &rr[TRACK_IDX(i2, NB_TRACK)][TRACK_IDX(i6, NB_TRACK)];
+		p_r3 = &rr[TRACK_IDX(i3, NB_TRACK)][TRACK_IDX(i6, NB_TRACK)];
+		p_r4 = &rr[TRACK_IDX(i4, NB_TRACK)][TRACK_IDX(i6, NB_TRACK)];
+		p_r5 = &rr[TRACK_IDX(i5, NB_TRACK)][TRACK_IDX(i6, NB_TRACK)];
+		p_r6 = &rr[TRACK_IDX(i6, NB_TRACK)][TRACK_IDX(i6, NB_TRACK)];
+		p_r7 = &rr[TRACK_IDX(i6, NB_TRACK)][TRACK_IDX(i7, NB_TRACK)];
+		p_rrv0 = rrv + TRACK_IDX(i7, NB_TRACK);
+		p_dn_t = &dn_t[TRACK_IDX(i7, NB_TRACK)];
+		nb = (int32_t) (p_dn_max - p_dn1 + 5) / 5;
 
 		do {
 			ps1 = ps0 + *p_dn0;
 			alp1 =
 			    alp0 + *p_r6 + 2.0F * (*p_r0 + *p_r1 + *p_r2 +
 						   *p_r3 + *p_r4 + *p_r5);
-			p_dn = p_dn1;
-			p_r8 = p_r7;
-			p_rrv = p_rrv0;
-
-			do {
-				ps2 = ps1 + *p_dn;
-				sq2 = ps2 * ps2;
-				alp2 = alp1 + *p_rrv + 2.0F * *p_r8;
-
-				if ((alp * sq2) > (sq * alp2)) {
-					sq = sq2;
-					ps = ps2;
-					alp = alp2;
-					ia = (int16_t) (p_dn0 - dn);
-					ib = (int16_t) (p_dn - dn);
-				}
-				p_dn += 5;
-				p_rrv += 5;
-				p_r8 += 5;
-			} while (p_dn <= p_dn_max);
-			p_r0 += 5;
-			p_r1 += 5;
-			p_r2 += 5;
-			p_r3 += 5;
-			p_r4 += 5;
-			p_r5 += 5;
-			p_r6 += 205;
-			p_r7 += 200;
+			ix = search_pulse_pair(ps1, alp1, p_dn_t, p_rrv0,
+					       p_r7, nb, &sq, &alp, &ps);
+			if (ix >= 0) {
+				ia = (int16_t) (p_dn0 - dn);
+				ib = (int16_t) (p_dn1 - dn + 5 * ix);
+			}
+			p_r0++;
+			p_r1++;
+			p_r2++;
+			p_r3++;
+			p_r4++;
+			p_r5++;
+			p_r6 += L_CODE + 1;
+			p_r7 += L_CODE;
 			p_dn0 += 5;
 		} while (p_dn0 < p_dn_max);
 		i6 = ia;
 		i7 = ib;
 
 		/* i8 and i9 loop */
-		p_rrv = rrv + i9;
-		p_r0 = &rr[i0][i9];
-		p_r1 = &rr[i1][i9];
-		p_r2 = &rr[i2][i9];
-		p_r3 = &rr[i3][i9];
-		p_r4 = &rr[i4][i9];
-		p_r5 = &rr[i5][i9];
-		p_r6 = &rr[i6][i9];
-		p_r7 = &rr[i7][i9];
-		p_r9 = &rr[i9][i9];
-		*p_rrv =
-		    *p_r9 + 2.0F * (*p_r0 + *p_r1 + *p_r2 + *p_r3 + *p_r4 +
-				    *p_r5 + *p_r6 + *p_r7);
-		*(p_rrv + 5) = *(p_r9 + 205) + 2.0F * (*(p_r0 + 5) + *(p_r1 + 5)
-						       + *(p_r2 + 5) + *(p_r3 +
-									 5) +
-						       *(p_r4 + 5) + *(p_r5 +
-								       5) +
-						       *(p_r6 + 5) + *(p_r7 +
-								       5));
-		*(p_rrv + 10) =
-		    *(p_r9 + 410) + 2.0F * (*(p_r0 + 10) + *(p_r1 + 10) +
-					    *(p_r2 + 10) + *(p_r3 + 10) +
-					    *(p_r4 + 10) + *(p_r5 + 10) +
-					    *(p_r6 + 10) + *(p_r7 + 10));
-		*(p_rrv + 15) =
-		    *(p_r9 + 615) + 2.0F * (*(p_r0 + 15) + *(p_r1 + 15) +
-					    *(p_r2 + 15) + *(p_r3 + 15) +
-					    *(p_r4 + 15) + *(p_r5 + 15) +
-					    *(p_r6 + 15) + *(p_r7 + 15));
-		*(p_rrv + 20) =
-		    *(p_r9 + 820) + 2.0F * (*(p_r0 + 20) + *(p_r1 + 20) +
-					    *(p_r2 + 20) + *(p_r3 + 20) +
-					    *(p_r4 + 20) + *(p_r5 + 20) +
-					    *(p_r6 + 20) + *(p_r7 + 20));
-		*(p_rrv + 25) =
-		    *(p_r9 + 1025) + 2.0F * (*(p_r0 + 25) + *(p_r1 + 25) +
-					     *(p_r2 + 25) + *(p_r3 + 25) +
-					     *(p_r4 + 25) + *(p_r5 + 25) +
-					     *(p_r6 + 25) + *(p_r7 + 25));
-		*(p_rrv + 30) =
-		    *(p_r9 + 1230) + 2.0F * (*(p_r0 + 30) + *(p_r1 + 30) +
-					     *(p_r2 + 30) + *(p_r3 + 30) +
-					     *(p_r4 + 30) + *(p_r5 + 30) +
-					     *(p_r6 + 30) + *(p_r7 + 30));
-		*(p_rrv + 35) =
-		    *(p_r9 + 1435) + 2.0F * (*(p_r0 + 35) + *(p_r1 + 35) +
-					     *(p_r2 + 35) + *(p_r3 + 35) +
-					     *(p_r4 + 35) + *(p_r5 + 35) +
-					     *(p_r6 + 35) + *(p_r7 + 35));
+		p_rrv = rrv + TRACK_IDX(i9, NB_TRACK);
+		p_r0 = &rr[TRACK_IDX(i0, NB_TRACK)][TRACK_IDX(i9, NB_TRACK)];
+		p_r1 = &rr[TRACK_IDX(i1, NB_TRACK)][TRACK_IDX(i9, NB_TRACK)];
+		p_r2 = &rr[TRACK_IDX(i2, NB_TRACK)][TRACK_IDX(i9, NB_TRACK)];
+		p_r3 = &rr[TRACK_IDX(i3, NB_TRACK)][TRACK_IDX(i9, NB_TRACK)];
+		p_r4 = &rr[TRACK_IDX(i4, NB_TRACK)][TRACK_IDX(i9, NB_TRACK)];
+		p_r5 = &rr[TRACK_IDX(i5, NB_TRACK)][TRACK_IDX(i9, NB_TRACK)];
+		p_r6 = &rr[TRACK_IDX(i6, NB_TRACK)][TRACK_IDX(i9, NB_TRACK)];
+		p_r7 = &rr[TRACK_IDX(i7, NB_TRACK)][TRACK_IDX(i9, NB_TRACK)];
+		p_r9 = &rr[TRACK_IDX(i9, NB_TRACK)][TRACK_IDX(i9, NB_TRACK)];
+		for (j = 0; j < L_CODE / NB_TRACK; j++)
+			p_rrv[j] = p_r9[(L_CODE + 1) * j]
+			    + 2.0F * (p_r0[j] + p_r1[j] + p_r2[j] + p_r3[j] +
+				       p_r4[j] + p_r5[j] + p_r6[j] + p_r7[j]);
 
 		/* Default value */
 		ps0 = ps;
@@ -6525,17 +6447,19 @@ static void search_10i40(float dn[], float rr[][L_CODE], int32_t ipos[],
 		ib = i9;
 		p_dn0 = dn + i8;
 		p_dn1 = dn + i9;
-		p_r0 = &rr[i0][i8];
-		p_r1 = &rr[i1][i8];
-		p_r2 = &rr[i2][i8];
-		p_r3 = &rr[i3][i8];
-		p_r4 = &rr[i4][i8];
-		p_r5 = &rr[i5][i8];
-		p_r6 = &rr[i6][i8];
-		p_r7 = &rr[i7][i8];
-		p_r8 = &rr[i8][i8];
-		p_r9 = &rr[i8][i9];
-		p_rrv0 = rrv + i9;
+		p_r0 = &rr[TRACK_IDX(i0, NB_TRACK)][TRACK_IDX(i8, NB_TRACK)];
+		p_r1 = &rr[TRACK_IDX(i1, NB_TRACK)][TRACK_IDX(i8, NB_TRACK)];
+		p_r2 = &rr[TRACK_IDX(i2, NB_TRACK)][TRACK_IDX(i8, NB_TRACK)];
+		p_r3 = &rr[TRACK_IDX(i3, NB_TRACK)][TRACK_IDX(i8, NB_TRACK)];
+		p_r4 = &rr[TRACK_IDX(i4, NB_TRACK)][TRACK_IDX(i8, NB_TRACK)];
+		p_r5 = &rr[TRACK_IDX(i5, NB_TRACK)][TRACK_IDX(i8, NB_TRACK)];
+		p_r6 = &rr[TRACK_IDX(i6, NB_TRACK)][TRACK_IDX(i8, NB_TRACK)];
+		p_r7 = &rr[TRACK_IDX(i7, NB_TRACK)][TRACK_IDX(i8, NB_TRACK)];
+		p_r8 = &rr[TRACK_IDX(i8, NB_TRACK)][TRACK_IDX(i8, NB_TRACK)];
+		p_r9 = &rr[TRACK_IDX(i8, NB_TRACK)][TRACK_IDX(i9, NB_TRACK)];
+		p_rrv0 = rrv + TRACK_IDX(i9, NB_TRACK);
+		p_dn_t = &dn_t[TRACK_IDX(i9, NB_TRACK)];
+		nb = (int32_t) (p_dn_max - p_dn1 + 5) / 5;
 
 		do {
 			ps1 = ps0 + *p_dn0;
@@ -6543,35 +6467,22 @@ static void search_10i40(float dn[], float rr[][L_CODE], int32_t ipos[],
 			    alp0 + *p_r8 + 2.0F * (*p_r0 + *p_r1 + *p_r2 +
 						   *p_r3 + *p_r4 + *p_r5 +
 						   *p_r6 + *p_r7);
-			p_dn = p_dn1;
-			p_r10 = p_r9;
-			p_rrv = p_rrv0;
-
-			do {
-				ps2 = ps1 + *p_dn;
-				sq2 = ps2 * ps2;
-				alp2 = alp1 + *p_rrv + 2.0F * *p_r10;
-
-				if ((alp * sq2) > (sq * alp2)) {
-					sq = sq2;
-					alp = alp2;
-					ia = (int16_t) (p_dn0 - dn);
-					ib = (int16_t) (p_dn - dn);
-				}
-				p_dn += 5;
-				p_rrv += 5;
-				p_r10 += 5;
-			} while (p_dn <= p_dn_max);
-			p_r0 += 5;
-			p_r1 += 5;
-			p_r2 += 5;
-			p_r3 += 5;
-			p_r4 += 5;
-			p_r5 += 5;
-			p_r6 += 5;
-			p_r7 += 5;
-			p_r8 += 205;
-			p_r9 += 200;
+			ix = search_pulse_pair(ps1, alp1, p_dn_t, p_rrv0,
+					       p_r9, nb, &sq, &alp, &ps);
+			if (ix >= 0) {
+				ia = (int16_t) (p_dn0 - dn);
+				ib = (int16_t) (p_dn1 - dn + 5 * ix);
+			}
+			p_r0++;
+			p_r1++;
+			p_r2++;
+			p_r3++;
+			p_r4++;
+			p_r5++;
+			p_r6++;
+			p_r7++;
+			p_r8 += L_CODE + 1;
+			p_r9 += L_CODE;
 			p_dn0 += 5;
 		} while (p_dn0 < p_dn_max);
 
@@ -6853,7 +6764,7 @@ static void code_10i40_35bits(float x[], float cn[], float h[],
 	set_sign12k2(dn, cn, sign, pos_max, NB_TRACK, ipos, STEP);
 
 	/* Matrix of correlations */
-	cor_h(h, sign, rr);
+	cor_h(h, sign, rr, NB_TRACK);
 	search_10i40(dn, rr, ipos, pos_max, codvec);
 	build_code_10i40_35bits(codvec, sign, code, h, y, anap);
 
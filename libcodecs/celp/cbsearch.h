@@ -101,27 +101,186 @@
 
 #define LEN		30	/* length of truncated impulse response */
 
+#include <ophsimd.h>
+
+/*  Backward filter e0 through the truncated impulse response (l even) */
+static void cbtarget(int l, float d[])
+{
+	int j, k;
+#ifdef OPH_SIMD_V4
+	float e[MAXL + LEN + 4];
+	v4f acc;
+
+	for (j = 0; j < l; j++)
+		e[j] = e0[j];
+	for (; j < l + LEN + 4; j++)
+		e[j] = 0.0;
+	for (j = 0; j < l; j += 4) {
+		acc = v4_zero();
+		for (k = 0; k < LEN; k++)
+			acc = v4_add(acc, v4_mul(v4_set1(h[k]), v4_load(&e[j + k])));
+		v4_store(&d[j], acc);
+	}
+#else
+	float s;
+
+	for (j = 0; j < l; j++) {
+		s = 0.0;
+		for (k = 0; k < LEN && j + k < l; k++)
+			s += e0[j + k] * h[k];
+		d[j] = s;
+	}
+#endif
+}
+
+/*  Correlations of code words starting at x[2q], q = q0, ..., MAXNCSIZE-1,
+    with the backward filtered target d (even and odd samples summed
+    separately to keep four independent accumulators) */
+static void cbcorr(int l, int q0, const float d[], float cor[])
+{
+	int q, t;
+#ifdef OPH_SIMD_V4
+	v4f de, dd, e0a, o0a, e1a, o1a;
+
+	for (q = q0; q < MAXNCSIZE; q += 8) {
+		e0a = o0a = e1a = o1a = v4_zero();
+		for (t = 0; t < l / 2; t++) {
+			de = v4_set1(d[2 * t]);
+			dd = v4_set1(d[2 * t + 1]);
+			e0a = v4_add(e0a, v4_mul(v4_load(&xe[q + t]), de));
+			o0a = v4_add(o0a, v4_mul(v4_load(&xo[q + t]), dd));
+			e1a = v4_add(e1a, v4_mul(v4_load(&xe[q + t + 4]), de));
+			o1a = v4_add(o1a, v4_mul(v4_load(&xo[q + t + 4]), dd));
+		}
+		v4_store(&cor[q], v4_add(e0a, o0a));
+		v4_store(&cor[q + 4], v4_add(e1a, o1a));
+	}
+#else
+	float se, so;
+
+	for (q = q0; q < MAXNCSIZE; q++) {
+		se = so = 0.0;
+		for (t = 0; t < l / 2; t++) {
+			se += xe[q + t] * d[2 * t];
+			so += xo[q + t] * d[2 * t + 1];
+		}
+		cor[q] = se + so;
+	}
+#endif
+}
+
+/*  End correct the convolution for a new nonzero sample ex = +1 or -1:
+    y(i-1) = y(i-1) + ex*h(i),  i = 1, ..., len-1  (ex*h is exact) */
+static void cbshift(float y[], float ex)
+{
+	int i = 0;
+#ifdef OPH_SIMD_V4
+	v4f e = v4_set1(ex);
+
+	for (; i + 4 < LEN; i += 4)
+		v4_store(&y[i], v4_add(v4_load(&y[i]),
+				       v4_mul(e, v4_load(&h[i + 1]))));
+#endif
+	for (; i < LEN - 1; i++)
+		y[i] += ex * h[i + 1];
+}
+
+static float cbenergy(const float y[], int l)
+{
+	int i = 0;
+	float eng = 0.0;
+#ifdef OPH_SIMD_V4
+	v4f acc = v4_zero();
+
+	for (; i + 4 <= l; i += 4)
+		acc = v4_add(acc, v4_mul(v4_load(&y[i]), v4_load(&y[i])));
+	eng = v4_sum(acc);
+#endif
+	for (; i < l; i++)
+		eng += y[i] * y[i];
+	return eng;
+}
+
+/*  match = cor*cgain with cgain = cor/eng, for q = q0, ..., MAXNCSIZE-1 */
+static void cbmatch(int q0, const float cor[], float eng[])
+{
+	int q;
+#ifdef OPH_SIMD_V4
+	v4f c;
+
+	for (q = q0; q < MAXNCSIZE; q += 4) {
+		c = v4_load(&cor[q]);
+		v4_store(&eng[q], v4_mul(c, v4_div(c, v4_load(&eng[q]))));
+	}
+#else
+	for (q = q0; q < MAXNCSIZE; q++)
+		eng[q] = cor[q] * (cor[q] / eng[q]);
+#endif
+}
+
 static void cbsearch(int l, float v[])
 {
-	int i, codeword;
-	float emax, gain[MAXNCSIZE], err[MAXNCSIZE];
+	int i, j, m, q, codeword;
+	float emax, err, gain, eng, *y;
+	float d[MAXL + 4], corq[MAXNCSIZE + 7], engq[MAXNCSIZE + 7];
+	static float ybuf[2 * MAXNCSIZE + MAXL];
+	const float *ex;
 
-	/*            *find gain and -error term for each code word           */
-	/*            *and search for best code word (max -error term)        */
-	/*            *(codewords are overlapped by shifts of -2              */
-	/*            * along the code vector x)                              */
-	/*            *NOTE: gain(i) & err(i) can be replaced by scalars      */
+	/*            *correlations of all code words with e0                 */
+	cbtarget(l, d);
+	cbcorr(l, MAXNCSIZE - ncsize, d, corq);
+
+	/*            *convolution of the first code word with the            */
+	/*            *truncated impulse response, skipping zero samples      */
 	codeword = 2 * MAXNCSIZE - 2;
+	ex = &x[codeword];
+	y = &ybuf[2 * (ncsize - 1)];
+	for (i = 0; i < l; i++)
+		y[i] = 0.0;
+	for (i = 0; i < l; i++) {
+		if (ex[i] != 0.0)
+			for (j = 0; j < l - i && j < LEN; j++)
+				y[i + j] += ex[i] * h[j];
+	}
+
+	/*            *energy of each filtered code word                      */
+	/*            *(codewords are overlapped by shifts of -2              */
+	/*            * along the code vector x, y moves down by one          */
+	/*            * sample per end correction)                            */
+	eng = cbenergy(y, l);
+	for (m = 0; m < ncsize; m++) {
+		if (m) {
+			codeword -= 2;
+			ex = &x[codeword];
+			if (ex[1] != 0.0)
+				cbshift(y, ex[1]);
+			*--y = ex[1] * h[0];
+			if (ex[0] != 0.0)
+				cbshift(y, ex[0]);
+			*--y = ex[0] * h[0];
+
+			/* *end correct energy (y[l], y[l+1] just left the window) */
+			if (ex[0] == 0.0 && ex[1] == 0.0)
+				eng = eng - y[l] * y[l] - y[l + 1] * y[l + 1];
+			else
+				eng = cbenergy(y, l);
+		}
+		if (eng <= 0.0)
+			eng = 1.0;
+		engq[MAXNCSIZE - 1 - m] = eng;
+	}
+
+	/*            *-error term for each code word, in place of engq       */
+	cbmatch(MAXNCSIZE - ncsize, corq, engq);
+
+	/*            *search for best code word (max -error term)            */
 	cbindex = 1;
-	gain[0] = cgain(&x[codeword], l, TRUE, LEN, &err[0]);
-	emax = *err;
-	codeword -= 2;
-	for (i = 1; i < ncsize; i++) {
-		gain[i] = cgain(&x[codeword], l, FALSE, LEN, &err[i]);
-		codeword -= 2;
-		if (err[i] >= emax) {
-			emax = err[i];
-			cbindex = i + 1;
+	emax = engq[MAXNCSIZE - 1];
+	for (m = 1; m < ncsize; m++) {
+		q = MAXNCSIZE - 1 - m;
+		if (engq[q] >= emax) {
+			emax = engq[q];
+			cbindex = m + 1;
 		}
 	}
 
@@ -134,18 +293,17 @@ static void cbsearch(int l, float v[])
 	/*            *OPTIONAL (may be useful for integer DSPs)              */
 	/*            *given best code word, recompute its gain to            */
 	/*            *correct any accumulated errors in recursions           */
-	gain[cbindex - 1] = cgain(&x[codeword], l, TRUE, l, &err[cbindex - 1]);
+	gain = cgain(&x[codeword], l, TRUE, l, &err);
 
 	/* *constrained excitation                                            */
 	if (mxsw)
-		mexcite3(&gain[cbindex - 1]);
+		mexcite3(&gain);
 
 	/*            *gain quantization, UNNECESSARY for closed-loop quant   */
 
 	if (strncmp(cbgtype, "none", 4) != 0) {
 		if (cbgbits == 5) {
-			gain[cbindex - 1] =
-			    gainencode(gain[cbindex - 1], &gindex);
+			gain = gainencode(gain, &gindex);
 		} else {
 #ifdef CELPDIAG
 			fprintf(stderr, "cbsearch: not quantizing cbgain\n");
@@ -157,7 +315,7 @@ static void cbsearch(int l, float v[])
 	/*            *call VDECODE?                                          */
 
 	for (i = 0; i < l; i++)
-		v[i] = gain[cbindex - 1] * x[i + codeword];
+		v[i] = gain * x[i + codeword];
 }
 
 #undef LEN
@@ -57,6 +57,9 @@ static const float x[MAXCODE] = {
 #include "codebook.h"
 };
 
+/*	Even and odd samples of the stochastic code book (cbsearch) */
+static float xe[MAXNCSIZE + MAXL / 2 + 7], xo[MAXNCSIZE + MAXL / 2 + 7];
+
 /*  	Pitch delay coding tables for bit assignment:
     	    pdencode.h for encoding, pddecode.h for decoding */
 static const int pdencode[MAXPD] = {
@@ -199,6 +202,12 @@ void celp_init(int prot)
 	for (i = 0; i < MAXPD; i++) {
 		pdtabi[pdencode[i]] = i;
 	}
+
+	/* Split the stochastic code book for the code book search */
+	for (i = 0; 2 * i < MAXCODE; i++) {
+		xe[i] = x[2 * i];
+		xo[i] = 2 * i + 1 < MAXCODE ? x[2 * i + 1] : 0.0;
+	}
 }
 
 /*  CELP_ENCODE  --  Encode a 240 sample frame of audio in CELP.  */
@@ -121,10 +121,10 @@ struct CODEC2 *CODEC2_WIN32SUPPORT codec2_create(int mode)
 	c2->hpf_states[0] = c2->hpf_states[1] = 0.0;
 	for (i = 0; i < 2 * N; i++)
 		c2->Sn_[i] = 0;
-	c2->fft_fwd_cfg = kiss_fft_alloc(FFT_ENC, 0, NULL, NULL);
+	c2->fft_fwd_cfg = kiss_fft_shared(FFT_ENC, 0);
 	make_analysis_window(c2->fft_fwd_cfg, c2->w, c2->W);
 	make_synthesis_window(c2->Pn);
-	c2->fft_inv_cfg = kiss_fft_alloc(FFT_DEC, 1, NULL, NULL);
+	c2->fft_inv_cfg = kiss_fft_shared(FFT_DEC, 1);
 	quantise_init();
 	c2->prev_Wo_enc = 0.0;
 	c2->bg_est = 0.0;
@@ -176,8 +176,8 @@ void CODEC2_WIN32SUPPORT codec2_destroy(struct CODEC2 *c2)
 {
 	assert(c2 != NULL);
 	nlp_destroy(c2->nlp);
-	free(c2->fft_fwd_cfg);
-	free(c2->fft_inv_cfg);
+	kiss_fft_release(c2->fft_fwd_cfg);
+	kiss_fft_release(c2->fft_inv_cfg);
 	free(c2);
 }
 
@@ -160,7 +160,7 @@ void *nlp_create(int m		/* analysis window size */
 	for (i = 0; i < NLP_NTAP; i++)
 		nlp->mem_fir[i] = 0.0;
 
-	nlp->fft_cfg = kiss_fft_alloc(PE_FFT_SIZE, 0, NULL, NULL);
+	nlp->fft_cfg = kiss_fft_shared(PE_FFT_SIZE, 0);
 	assert(nlp->fft_cfg != NULL);
 
 	return (void *)nlp;
@@ -180,7 +180,7 @@ void nlp_destroy(void *nlp_state)
 	assert(nlp_state != NULL);
 	nlp = (NLP *) nlp_state;
 
-	free(nlp->fft_cfg);
+	kiss_fft_release(nlp->fft_cfg);
 	free(nlp_state);
 }
 
@@ -17,1091 +17,19 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "g723_const.h"
-
-extern int Overflow;
-extern int Carry;
-
-#define MAX_32 (int32_t)0x7fffffffL
-#define MIN_32 (int32_t)0x80000000L
-
-#define MAX_16 (int16_t)0x7fff
-#define MIN_16 (int16_t)0x8000
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Local Functions                                                         |
- |___________________________________________________________________________|
-*/
-int16_t sature(int32_t L_var1);
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Constants and Globals                                                   |
- |___________________________________________________________________________|
-*/
-int Overflow = 0;
-int Carry = 0;
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Functions                                                               |
- |___________________________________________________________________________|
-*/
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : extract_l                                               |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   Return the 16 LSB of L_var1.                                            |
- |                                                                           |
- |   Complexity weight : 1                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    L_var1                                                                 |
- |             32 bit long signed integer (int32_t ) whose value falls in the |
- |             range : 0x8000 0000 <= L_var1 <= 0x7fff ffff.                 |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    var_out                                                                |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var_out <= 0x0000 7fff.                |
- |___________________________________________________________________________|
-*/
-
-int16_t g723_extract_l(int32_t L_var1)
-{
-	int16_t var_out;
-
-	var_out = (int16_t) L_var1;
-	return (var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : sature                                                  |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |    Limit the 32 bit input to the range of a 16 bit word.                  |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    L_var1                                                                 |
- |             32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var1 <= 0x7fff ffff.                 |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    var_out                                                                |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var_out <= 0x0000 7fff.                |
- |___________________________________________________________________________|
-*/
-
-int16_t sature(int32_t L_var1)
-{
-	int16_t var_out;
-
-	if (L_var1 > 0X00007fffL) {
-		Overflow = 1;
-		var_out = MAX_16;
-	} else {
-		if (L_var1 < (int32_t) 0xffff8000L) {
-			Overflow = 1;
-			var_out = MIN_16;
-		} else {
-			Overflow = 0;
-			var_out = g723_extract_l(L_var1);
-		}
-	}
-	return (var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : add                                                     |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |    Performs the addition (var1+var2) with overflow control and saturation;|
- |    the 16 bit result is set at +32767 when overflow occurs or at -32768   |
- |    when underflow occurs.                                                 |
- |                                                                           |
- |   Complexity weight : 1                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    var1                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |    var2                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    var_out                                                                |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var_out <= 0x0000 7fff.                |
- |___________________________________________________________________________|
-*/
-
-int16_t g723_add(int16_t var1, int16_t var2)
-{
-	int16_t var_out;
-	int32_t L_somme;
-
-	L_somme = (int32_t) var1 + (int32_t) var2;
-	var_out = sature(L_somme);
-	return (var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : sub                                                     |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |    Performs the subtraction (var1+var2) with overflow control and satu-   |
- |    ration; the 16 bit result is set at +32767 when overflow occurs or at  |
- |    -32768 when underflow occurs.                                          |
- |                                                                           |
- |   Complexity weight : 1                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    var1                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |    var2                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    var_out                                                                |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var_out <= 0x0000 7fff.                |
- |___________________________________________________________________________|
-*/
-
-int16_t g723_sub(int16_t var1, int16_t var2)
-{
-	int16_t var_out;
-	int32_t L_diff;
-
-	L_diff = (int32_t) var1 - (int32_t) var2;
-	var_out = sature(L_diff);
-	return (var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : abs_s                                                   |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |    Absolute value of var1; g723_abs_s(-32768) = 32767.                         |
- |                                                                           |
- |   Complexity weight : 1                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    var1                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    var_out                                                                |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0x0000 0000 <= var_out <= 0x0000 7fff.                |
- |___________________________________________________________________________|
-*/
-
-int16_t g723_abs_s(int16_t var1)
-{
-	int16_t var_out;
-
-	if (var1 == (int16_t) 0X8000) {
-		var_out = MAX_16;
-	} else {
-		if (var1 < 0) {
-			var_out = -var1;
-		} else {
-			var_out = var1;
-		}
-	}
-
-	return (var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : shl                                                     |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   Arithmetically shift the 16 bit input var1 left var2 positions.Zero fill|
- |   the var2 LSB of the result. If var2 is negative, arithmetically shift   |
- |   var1 right by -var2 with sign extension. Saturate the result in case of |
- |   underflows or overflows.                                                |
- |                                                                           |
- |   Complexity weight : 1                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    var1                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |    var2                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    var_out                                                                |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var_out <= 0x0000 7fff.                |
- |___________________________________________________________________________|
-*/
-int16_t g723_shr(int16_t var1, int16_t var2);
-int16_t g723_shl(int16_t var1, int16_t var2)
-{
-	int16_t var_out;
-	int32_t L_result;
-
-	if (var2 < 0) {
-		var_out = g723_shr(var1, (int16_t) - var2);
-	} else {
-		L_result = (int32_t) var1 *((int32_t) 1 << var2);
-		if (((var2 > 15) && (var1 != 0)) ||
-		    (L_result != (int32_t) ((int16_t) L_result))) {
-			Overflow = 1;
-			var_out = (var1 > 0) ? MAX_16 : MIN_16;
-		} else {
-			var_out = g723_extract_l(L_result);
-		}
-	}
-
-	return (var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : shr                                                     |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   Arithmetically shift the 16 bit input var1 right var2 positions with    |
- |   sign extension. If var2 is negative, arithmetically shift var1 left by  |
- |   -var2 with sign extension. Saturate the result in case of underflows or |
- |   overflows.                                                              |
- |                                                                           |
- |   Complexity weight : 1                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    var1                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |    var2                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    var_out                                                                |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var_out <= 0x0000 7fff.                |
- |___________________________________________________________________________|
-*/
-
-int16_t g723_shr(int16_t var1, int16_t var2)
-{
-	int16_t var_out;
-
-	if (var2 < 0) {
-		var_out = g723_shl(var1, (int16_t) - var2);
-	} else {
-		if (var2 >= 15) {
-			var_out =
-			    (var1 < (int16_t) 0) ? (int16_t) - 1 : (int16_t) 0;
-		} else {
-			if (var1 < 0) {
-				var_out = ~((~var1) >> var2);
-			} else {
-				var_out = var1 >> var2;
-			}
-		}
-	}
-
-	return (var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : mult                                                    |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |    Performs the multiplication of var1 by var2 and gives a 16 bit result  |
- |    which is scaled i.e.:                                                  |
- |             g723_mult(var1,var2) = g723_shr((var1 times var2),15) and               |
- |             g723_mult(-32768,-32768) = 32767.                                  |
- |                                                                           |
- |   Complexity weight : 1                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    var1                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |    var2                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    var_out                                                                |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var_out <= 0x0000 7fff.                |
- |___________________________________________________________________________|
-*/
-
-int16_t g723_mult(int16_t var1, int16_t var2)
-{
-	int16_t var_out;
-	int32_t L_produit;
-
-	L_produit = (int32_t) var1 *(int32_t) var2;
-
-	L_produit = (L_produit & (int32_t) 0xffff8000L) >> 15;
-
-	if (L_produit & (int32_t) 0x00010000L) {
-		L_produit |= (int32_t) 0xffff0000L;
-	}
-	var_out = sature(L_produit);
-	return (var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : L_mult                                                  |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   L_mult is the 32 bit result of the multiplication of var1 times var2    |
- |   with one shift left i.e.:                                               |
- |        L_g723_mult(var1,var2) = g723_shl((var1 times var2),1) and                   |
- |        L_g723_mult(-32768,-32768) = 2147483647.                                |
- |                                                                           |
- |   Complexity weight : 1                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    var1                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |    var2                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    L_var_out                                                              |
- |             32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var_out <= 0x7fff ffff.              |
- |___________________________________________________________________________|
-*/
-
-int32_t L_g723_mult(int16_t var1, int16_t var2)
-{
-	int32_t L_var_out;
-
-	L_var_out = (int32_t) var1 *(int32_t) var2;
-	if (L_var_out != (int32_t) 0x40000000L) {
-		L_var_out *= 2L;
-	} else {
-		Overflow = 1;
-		L_var_out = MAX_32;
-	}
-
-	return (L_var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : negate                                                  |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   Negate var1 with saturation, saturate in the case where input is -32768:|
- |                g723_negate(var1) = g723_sub(0,var1).                                |
- |                                                                           |
- |   Complexity weight : 1                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    var1                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    var_out                                                                |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var_out <= 0x0000 7fff.                |
- |___________________________________________________________________________|
-*/
-
-int16_t g723_negate(int16_t var1)
-{
-	int16_t var_out;
-
-	var_out = (var1 == MIN_16) ? MAX_16 : -var1;
-	return (var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : extract_h                                               |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   Return the 16 MSB of L_var1.                                            |
- |                                                                           |
- |   Complexity weight : 1                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    L_var1                                                                 |
- |             32 bit long signed integer (int32_t ) whose value falls in the |
- |             range : 0x8000 0000 <= L_var1 <= 0x7fff ffff.                 |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    var_out                                                                |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var_out <= 0x0000 7fff.                |
- |___________________________________________________________________________|
-*/
-
-int16_t g723_extract_h(int32_t L_var1)
-{
-	int16_t var_out;
-
-	var_out = (int16_t) (L_var1 >> 16);
-	return (var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : L_add                                                   |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   32 bits addition of the two 32 bits variables (L_var1+L_var2) with      |
- |   overflow control and saturation; the result is set at +214783647 when   |
- |   overflow occurs or at -214783648 when underflow occurs.                 |
- |                                                                           |
- |   Complexity weight : 2                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    L_var1   32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var3 <= 0x7fff ffff.                 |
- |                                                                           |
- |    L_var2   32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var3 <= 0x7fff ffff.                 |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    L_var_out                                                              |
- |             32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var_out <= 0x7fff ffff.              |
- |___________________________________________________________________________|
-*/
-
-int32_t L_g723_add(int32_t L_var1, int32_t L_var2)
-{
-	int32_t L_var_out;
-
-	L_var_out = L_var1 + L_var2;
-
-	if (((L_var1 ^ L_var2) & MIN_32) == 0L) {
-		if ((L_var_out ^ L_var1) & MIN_32) {
-			L_var_out = (L_var1 < 0L) ? MIN_32 : MAX_32;
-			Overflow = 1;
-		}
-	}
-	return (L_var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : round                                                   |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   Round the lower 16 bits of the 32 bit input number into its MS 16 bits  |
- |   with saturation. Shift the resulting bits right by 16 and return the 16 |
- |   bit number:                                                             |
- |               round(L_var1) = g723_extract_h(L_g723_add(L_var1,32768))              |
- |                                                                           |
- |   Complexity weight : 1                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    L_var1                                                                 |
- |             32 bit long signed integer (int32_t ) whose value falls in the |
- |             range : 0x8000 0000 <= L_var1 <= 0x7fff ffff.                 |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    var_out                                                                |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var_out <= 0x0000 7fff.                |
- |___________________________________________________________________________|
-*/
-
-int16_t round_(int32_t L_var1)
-{
-	int16_t var_out;
-	int32_t L_arrondi;
-
-	L_arrondi = L_g723_add(L_var1, (int32_t) 0x00008000L);
-	var_out = g723_extract_h(L_arrondi);
-	return (var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : L_mac                                                   |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   Multiply var1 by var2 and shift the result left by 1. Add the 32 bit    |
- |   result to L_var3 with saturation, return a 32 bit result:               |
- |        g723_L_mac(L_var3,var1,var2) = L_g723_add(L_var3,(L_g723_mult(var1,var2)).        |
- |                                                                           |
- |   Complexity weight : 1                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    L_var3   32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var3 <= 0x7fff ffff.                 |
- |                                                                           |
- |    var1                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |    var2                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    L_var_out                                                              |
- |             32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var_out <= 0x7fff ffff.              |
- |___________________________________________________________________________|
-*/
-
-int32_t g723_L_mac(int32_t L_var3, int16_t var1, int16_t var2)
-{
-	int32_t L_var_out;
-	int32_t L_produit;
-
-	L_produit = L_g723_mult(var1, var2);
-	L_var_out = L_g723_add(L_var3, L_produit);
-	return (L_var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : L_sub                                                   |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   32 bits subtraction of the two 32 bits variables (L_var1-L_var2) with   |
- |   overflow control and saturation; the result is set at +214783647 when   |
- |   overflow occurs or at -214783648 when underflow occurs.                 |
- |                                                                           |
- |   Complexity weight : 2                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    L_var1   32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var3 <= 0x7fff ffff.                 |
- |                                                                           |
- |    L_var2   32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var3 <= 0x7fff ffff.                 |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    L_var_out                                                              |
- |             32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var_out <= 0x7fff ffff.              |
- |___________________________________________________________________________|
-*/
-
-int32_t L_g723_sub(int32_t L_var1, int32_t L_var2)
-{
-	int32_t L_var_out;
-
-	L_var_out = L_var1 - L_var2;
-
-	if (((L_var1 ^ L_var2) & MIN_32) != 0L) {
-		if ((L_var_out ^ L_var1) & MIN_32) {
-			L_var_out = (L_var1 < 0L) ? MIN_32 : MAX_32;
-			Overflow = 1;
-		}
-	}
-	return (L_var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : L_negate                                                |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   Negate the 32 bit variable L_var1 with saturation; saturate in the case |
- |   where input is -2147483648 (0x8000 0000).                               |
- |                                                                           |
- |   Complexity weight : 2                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    L_var1   32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var3 <= 0x7fff ffff.                 |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    L_var_out                                                              |
- |             32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var_out <= 0x7fff ffff.              |
- |___________________________________________________________________________|
-*/
-
-int32_t L_g723_negate(int32_t L_var1)
-{
-	int32_t L_var_out;
-
-	L_var_out = (L_var1 == MIN_32) ? MAX_32 : -L_var1;
-	return (L_var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : mult_r                                                  |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   Same as mult with rounding, i.e.:                                       |
- |     g723_mult_r(var1,var2) = g723_shr(((var1*var2) + 16384),15) and                 |
- |     g723_mult_r(-32768,-32768) = 32767.                                        |
- |                                                                           |
- |   Complexity weight : 2                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    var1                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |    var2                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    var_out                                                                |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var_out <= 0x0000 7fff.                |
- |___________________________________________________________________________|
-*/
-
-int16_t g723_mult_r(int16_t var1, int16_t var2)
-{
-	int16_t var_out;
-	int32_t L_produit_arr;
-
-	L_produit_arr = (int32_t) var1 *(int32_t) var2;	/* product */
-	L_produit_arr += (int32_t) 0x00004000L;	/* round */
-	L_produit_arr &= (int32_t) 0xffff8000L;
-	L_produit_arr >>= 15;	/* shift */
-
-	if (L_produit_arr & (int32_t) 0x00010000L) {
-		/* sign extend when necessary */
-		L_produit_arr |= (int32_t) 0xffff0000L;
-	}
-
-	var_out = sature(L_produit_arr);
-	return (var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : L_shl                                                   |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   Arithmetically shift the 32 bit input L_var1 left var2 positions. Zero  |
- |   fill the var2 LSB of the result. If var2 is negative, L_var1 right by   |
- |   -var2 arithmetically shift with sign extension. Saturate the result in  |
- |   case of underflows or overflows.                                        |
- |                                                                           |
- |   Complexity weight : 2                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    L_var1   32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var3 <= 0x7fff ffff.                 |
- |                                                                           |
- |    var2                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    L_var_out                                                              |
- |             32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var_out <= 0x7fff ffff.              |
- |___________________________________________________________________________|
-*/
-int32_t L_g723_shr(int32_t L_var1, int16_t var2);
-int32_t L_g723_shl(int32_t L_var1, int16_t var2)
-{
-	int32_t L_var_out = 0L;
-
-	if (var2 <= (int16_t) 0) {
-		L_var_out = L_g723_shr(L_var1, (int16_t) - var2);
-	} else {
-		for (; var2 > (int16_t) 0; var2--) {
-			if (L_var1 > (int32_t) 0X3fffffffL) {
-				Overflow = 1;
-				L_var_out = MAX_32;
-				break;
-			} else {
-				if (L_var1 < (int32_t) 0xc0000000L) {
-					Overflow = 1;
-					L_var_out = MIN_32;
-					break;
-				}
-			}
-			L_var1 *= 2L;
-			L_var_out = L_var1;
-		}
-	}
-	return (L_var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : L_shr                                                   |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   Arithmetically shift the 32 bit input L_var1 right var2 positions with  |
- |   sign extension. If var2 is negative, arithmetically shift L_var1 left   |
- |   by -var2 and zero fill the var2 LSB of the result. Saturate the result  |
- |   in case of underflows or overflows.                                     |
- |                                                                           |
- |   Complexity weight : 2                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    L_var1   32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var3 <= 0x7fff ffff.                 |
- |                                                                           |
- |    var2                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    L_var_out                                                              |
- |             32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var_out <= 0x7fff ffff.              |
- |___________________________________________________________________________|
-*/
-
-int32_t L_g723_shr(int32_t L_var1, int16_t var2)
-{
-	int32_t L_var_out;
-
-	if (var2 < (int16_t) 0) {
-		L_var_out = L_g723_shl(L_var1, (int16_t) - var2);
-	} else {
-		if (var2 >= (int16_t) 31) {
-			L_var_out = (L_var1 < 0L) ? -1L : 0L;
-		} else {
-			if (L_var1 < 0L) {
-				L_var_out = ~((~L_var1) >> var2);
-			} else {
-				L_var_out = L_var1 >> var2;
-			}
-		}
-	}
-	return (L_var_out);
-}
-
-int32_t g723_L_msu(int32_t L_var3, int16_t var1, int16_t var2);
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : L_deposit_h                                             |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   Deposit the 16 bit var1 into the 16 MS bits of the 32 bit output. The   |
- |   16 LS bits of the output are zeroed.                                    |
- |                                                                           |
- |   Complexity weight : 2                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    var1                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    L_var_out                                                              |
- |             32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= var_out <= 0x7fff 0000.                |
- |___________________________________________________________________________|
-*/
-
-int32_t g723_L_deposit_h(int16_t var1)
-{
-	int32_t L_var_out;
-
-	L_var_out = (int32_t) var1 << 16;
-	return (L_var_out);
-}
-
-/*___________________________________________________________________________
- |                                                                           |
- |   Function Name : L_deposit_l                                             |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   Deposit the 16 bit var1 into the 16 LS bits of the 32 bit output. The   |
- |   16 MS bits of the output are sign extended.                             |
- |                                                                           |
- |   Complexity weight : 2                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    var1                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    L_var_out                                                              |
- |             32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0xFFFF 8000 <= var_out <= 0x0000 7fff.                |
- |___________________________________________________________________________|
-*/
-
-int32_t g723_L_deposit_l(int16_t var1)
-{
-	int32_t L_var_out;
-
-	L_var_out = (int32_t) var1;
-	return (L_var_out);
-}
+#include "basop.h"
 
 /*___________________________________________________________________________
  |                                                                           |
- |   Function Name : L_abs                                                   |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |    Absolute value of L_var1; Saturate in case where the input is          |
- |                                                               -214783648  |
- |                                                                           |
- |   Complexity weight : 3                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    L_var1                                                                 |
- |             32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= var1 <= 0x7fff ffff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    L_var_out                                                              |
- |             32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x0000 0000 <= var_out <= 0x7fff ffff.                |
+ |   Constants and Globals                                                   |
  |___________________________________________________________________________|
 */
 
-int32_t g723_L_abs(int32_t L_var1)
-{
-	int32_t L_var_out;
-
-	if (L_var1 == MIN_32) {
-		L_var_out = MAX_32;
-	} else {
-		if (L_var1 < 0L) {
-			L_var_out = -L_var1;
-		} else {
-			L_var_out = L_var1;
-		}
-	}
-
-	return (L_var_out);
-}
-
 /*___________________________________________________________________________
  |                                                                           |
- |   Function Name : L_msu                                                   |
- |                                                                           |
- |   Purpose :                                                               |
- |                                                                           |
- |   Multiply var1 by var2 and shift the result left by 1. Subtract the 32   |
- |   bit result to L_var3 with saturation, return a 32 bit result:           |
- |        g723_L_msu(L_var3,var1,var2) = L_g723_sub(L_var3,(L_g723_mult(var1,var2)).        |
- |                                                                           |
- |   Complexity weight : 1                                                   |
- |                                                                           |
- |   Inputs :                                                                |
- |                                                                           |
- |    L_var3   32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var3 <= 0x7fff ffff.                 |
- |                                                                           |
- |    var1                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |    var2                                                                   |
- |             16 bit short signed integer (int16_t) whose value falls in the |
- |             range : 0xffff 8000 <= var1 <= 0x0000 7fff.                   |
- |                                                                           |
- |   Outputs :                                                               |
- |                                                                           |
- |    none                                                                   |
- |                                                                           |
- |   Return Value :                                                          |
- |                                                                           |
- |    L_var_out                                                              |
- |             32 bit long signed integer (int32_t) whose value falls in the  |
- |             range : 0x8000 0000 <= L_var_out <= 0x7fff ffff.              |
+ |   Functions                                                               |
  |___________________________________________________________________________|
 */
-
-int32_t g723_L_msu(int32_t L_var3, int16_t var1, int16_t var2)
-{
-	int32_t L_var_out;
-	int32_t L_produit;
-
-	L_produit = L_g723_mult(var1, var2);
-	L_var_out = L_g723_sub(L_var3, L_produit);
-	return (L_var_out);
-}
-
 /*___________________________________________________________________________
  |                                                                           |
  |   Function Name : norm_s                                                  |
@@ -1387,13 +315,3 @@ int16_t div_l(int32_t L_num, int16_t den)
 		return var_out;
 	}
 }
-
-/*---------------------------------------------------------------------------*
- *  Function  i_g723_mult()                                                        *
- *  ~~~~~~~~~~~~~~~~~                                                        *
- * Integer multiplication.                                                   *
- *--------------------------------------------------------------------------*/
-int16_t i_g723_mult(int16_t a, int16_t b)
-{
-	return a * b;
-}
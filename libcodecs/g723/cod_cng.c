@@ -32,17 +32,13 @@
 #include <stdlib.h>
 
 #include "g723_const.h"
+#include "basop.h"
 
 extern int16_t Durbin(int16_t * Lpc, int16_t * Corr, int16_t Err,
 		      int16_t * Pk2);
 extern int16_t Qua_SidGain(int16_t * Ener, int16_t * shEner, int16_t nq);
-extern int16_t g723_abs_s(int16_t var1);	/* Short abs,           1 */
-extern int16_t g723_sub(int16_t var1, int16_t var2);	/* Short sub,           1 */
 
-extern VADSTATDEF VadStat;
-extern CODSTATDEF CodStat;
 
-extern int16_t g723_shr(int16_t var1, int16_t var2);	/* Short shift right,   1 */
 
 #define NbPulsBlk          11	/* Nb of pulses in 2-subframes blocks         */
 
@@ -51,31 +47,19 @@ extern int32_t Lsp_Qnt(int16_t * CurrLsp, int16_t * PrevLsp);
 extern void Lsp_Inq(int16_t * Lsp, int16_t * PrevLsp, int32_t LspId,
 		    int16_t Crc);
 extern int16_t Dec_SidGain(int16_t i_gain);
-extern int16_t g723_extract_h(int32_t L_var1);	/* Extract high,        1 */
-extern int32_t L_g723_add(int32_t L_var1, int32_t L_var2);	/* Long add,        2 */
-extern int32_t L_g723_mult(int16_t var1, int16_t var2);	/* Long mult,           1 */
-extern void Calc_Exc_Rand(int16_t cur_gain, int16_t * PrevExc,
+extern void Calc_Exc_Rand(enum Crate WrkRate, int16_t cur_gain,
+	int16_t * PrevExc,
 			  int16_t * DataExc,
 			  int16_t * nRandom, LINEDEF * Line);
 extern void Lsp_Int(int16_t * QntLpc, int16_t * CurrLsp, int16_t * PrevLsp);
-extern int16_t g723_add(int16_t var1, int16_t var2);	/* Short add,           1 */
-extern int32_t g723_L_deposit_l(int16_t var1);	/* 16 bit var1 -> LSB,     2 */
-extern int32_t L_g723_shl(int32_t L_var1, int16_t var2);	/* Long shift left,     2 */
-extern int16_t g723_norm_l(int32_t L_var1);	/* Long norm,            30 */
-extern int16_t g723_extract_l(int32_t L_var1);	/* Extract low,         1 */
-extern int32_t L_g723_shr(int32_t L_var1, int16_t var2);	/* Long shift right,    2 */
-extern int32_t g723_L_mac(int32_t L_var3, int16_t var1, int16_t var2);	/* Mac,    1 */
-extern int16_t round_(int32_t L_var1);	/* Round,               1 */
-extern int16_t g723_mult_r(int16_t var1, int16_t var2);	/* Mult with round,     2 */
 
 /* Declaration of local functions */
-static void ComputePastAvFilter(int16_t * Coeff);
+static void ComputePastAvFilter(CODCNGDEF * CodCng, int16_t * Coeff);
 static void CalcRC(int16_t * Coeff, int16_t * RC, int16_t * shRC);
 static int LpcDiff(int16_t * RC, int16_t shRC, int16_t * Acf,
 		    int16_t alpha);
 
 /* Global Variables */
-CODCNGDEF CodCng;
 
 /*
 **
@@ -92,24 +76,24 @@ CODCNGDEF CodCng;
 ** Return value:    None
 **
 */
-void Init_Cod_Cng(void)
+void Init_Cod_Cng(CODCNGDEF * CodCng)
 {
 	int i;
 
-	CodCng.CurGain = 0;
+	CodCng->CurGain = 0;
 
 	for (i = 0; i < SizAcf; i++)
-		CodCng.Acf[i] = 0;
+		CodCng->Acf[i] = 0;
 
 	for (i = 0; i <= NbAvAcf; i++)
-		CodCng.ShAcf[i] = 40;
+		CodCng->ShAcf[i] = 40;
 
 	for (i = 0; i < LpcOrder; i++)
-		CodCng.SidLpc[i] = 0;
+		CodCng->SidLpc[i] = 0;
 
-	CodCng.PastFtyp = 1;
+	CodCng->PastFtyp = 1;
 
-	CodCng.RandSeed = 12345;
+	CodCng->RandSeed = 12345;
 
 	return;
 }
@@ -144,7 +128,7 @@ void Init_Cod_Cng(void)
 ** Return value:       None
 **
 */
-void Cod_Cng(int16_t * DataExc, int16_t * Ftyp, LINEDEF * Line,
+void Cod_Cng(G723ENCDEF * st, int16_t * DataExc, int16_t * Ftyp, LINEDEF * Line,
 	     int16_t * QntLpc)
 {
 
@@ -153,45 +137,51 @@ void Cod_Cng(int16_t * DataExc, int16_t * Ftyp, LINEDEF * Line,
 	int16_t temp;
 	int i;
 
+	CODSTATDEF *CodStat = &st->CodStat;
+	VADSTATDEF *VadStat = &st->VadStat;
+	CODCNGDEF *CodCng = &st->CodCng;
+
 	/*
 	 * Update Ener
 	 */
 	for (i = NbAvGain - 1; i >= 1; i--) {
-		CodCng.Ener[i] = CodCng.Ener[i - 1];
+		CodCng->Ener[i] = CodCng->Ener[i - 1];
 	}
 
 	/*
 	 * Compute LPC filter of present frame
 	 */
-	CodCng.Ener[0] = Durbin(curCoeff, &CodCng.Acf[1], CodCng.Acf[0], &temp);
+	CodCng->Ener[0] = Durbin(curCoeff, &CodCng->Acf[1], CodCng->Acf[0],
+		&temp);
 
 	/*
 	 * if first frame of silence => SID frame
 	 */
-	if (CodCng.PastFtyp == 1) {
+	if (CodCng->PastFtyp == 1) {
 		*Ftyp = 2;
-		CodCng.NbEner = 1;
+		CodCng->NbEner = 1;
 		curQGain =
-		    Qua_SidGain(CodCng.Ener, CodCng.ShAcf, CodCng.NbEner);
+		    Qua_SidGain(CodCng->Ener, CodCng->ShAcf, CodCng->NbEner);
 	}
 
 	else {
-		CodCng.NbEner++;
-		if (CodCng.NbEner > NbAvGain)
-			CodCng.NbEner = NbAvGain;
+		CodCng->NbEner++;
+		if (CodCng->NbEner > NbAvGain)
+			CodCng->NbEner = NbAvGain;
 		curQGain =
-		    Qua_SidGain(CodCng.Ener, CodCng.ShAcf, CodCng.NbEner);
+		    Qua_SidGain(CodCng->Ener, CodCng->ShAcf, CodCng->NbEner);
 
 		/*
 		 * Compute stationarity of current filter
 		 * versus reference filter
 		 */
-		if (LpcDiff(CodCng.RC, CodCng.ShRC, CodCng.Acf, *CodCng.Ener) ==
+		if (LpcDiff(CodCng->RC, CodCng->ShRC, CodCng->Acf,
+			*CodCng->Ener) ==
 		    0) {
 			/* transmit SID frame */
 			*Ftyp = 2;
 		} else {
-			temp = g723_abs_s(g723_sub(curQGain, CodCng.IRef));
+			temp = g723_abs_s(g723_sub(curQGain, CodCng->IRef));
 			if (temp > ThreshGain) {
 				*Ftyp = 2;
 			} else {
@@ -213,36 +203,37 @@ void Cod_Cng(int16_t * DataExc, int16_t * Ftyp, LINEDEF * Line,
 		 * else SID filter = past average filter
 		 */
 		/* Compute past average filter */
-		ComputePastAvFilter(CodCng.SidLpc);
+		ComputePastAvFilter(CodCng, CodCng->SidLpc);
 
 		/* If adaptation enabled, fill noise filter */
-		if (!VadStat.Aen) {
+		if (!VadStat->Aen) {
 			for (i = 0; i < LpcOrder; i++)
-				VadStat.NLpc[i] = CodCng.SidLpc[i];
+				VadStat->NLpc[i] = CodCng->SidLpc[i];
 		}
 
 		/* Compute autocorr. of past average filter coefficients */
-		CalcRC(CodCng.SidLpc, CodCng.RC, &CodCng.ShRC);
+		CalcRC(CodCng->SidLpc, CodCng->RC, &CodCng->ShRC);
 
-		if (LpcDiff(CodCng.RC, CodCng.ShRC, CodCng.Acf, *CodCng.Ener) ==
+		if (LpcDiff(CodCng->RC, CodCng->ShRC, CodCng->Acf,
+			*CodCng->Ener) ==
 		    0) {
 			for (i = 0; i < LpcOrder; i++) {
-				CodCng.SidLpc[i] = curCoeff[i];
+				CodCng->SidLpc[i] = curCoeff[i];
 			}
-			CalcRC(curCoeff, CodCng.RC, &CodCng.ShRC);
+			CalcRC(curCoeff, CodCng->RC, &CodCng->ShRC);
 		}
 
 		/*
 		 * Compute SID frame codes
 		 */
 		/* Compute LspSid */
-		AtoLsp(CodCng.LspSid, CodCng.SidLpc, CodStat.PrevLsp);
-		Line->LspId = Lsp_Qnt(CodCng.LspSid, CodStat.PrevLsp);
-		Lsp_Inq(CodCng.LspSid, CodStat.PrevLsp, Line->LspId, 0);
+		AtoLsp(CodCng->LspSid, CodCng->SidLpc, CodStat->PrevLsp);
+		Line->LspId = Lsp_Qnt(CodCng->LspSid, CodStat->PrevLsp);
+		Lsp_Inq(CodCng->LspSid, CodStat->PrevLsp, Line->LspId, 0);
 
 		Line->Sfs[0].Mamp = curQGain;
-		CodCng.IRef = curQGain;
-		CodCng.SidGain = Dec_SidGain(CodCng.IRef);
+		CodCng->IRef = curQGain;
+		CodCng->SidGain = Dec_SidGain(CodCng->IRef);
 
 	}
 
@@ -250,29 +241,29 @@ void Cod_Cng(int16_t * DataExc, int16_t * Ftyp, LINEDEF * Line,
 	/*
 	 * Compute new excitation
 	 */
-	if (CodCng.PastFtyp == 1) {
-		CodCng.CurGain = CodCng.SidGain;
+	if (CodCng->PastFtyp == 1) {
+		CodCng->CurGain = CodCng->SidGain;
 	} else {
-		CodCng.CurGain =
+		CodCng->CurGain =
 		    g723_extract_h(L_g723_add
-				   (L_g723_mult(CodCng.CurGain, 0x7000),
-				    L_g723_mult(CodCng.SidGain, 0x1000)));
+				   (L_g723_mult(CodCng->CurGain, 0x7000),
+				    L_g723_mult(CodCng->SidGain, 0x1000)));
 	}
-	Calc_Exc_Rand(CodCng.CurGain, CodStat.PrevExc, DataExc,
-		      &CodCng.RandSeed, Line);
+	Calc_Exc_Rand(st->WrkRate, CodCng->CurGain, CodStat->PrevExc, DataExc,
+		      &CodCng->RandSeed, Line);
 
 	/*
 	 * Interpolate LSPs and update PrevLsp
 	 */
-	Lsp_Int(QntLpc, CodCng.LspSid, CodStat.PrevLsp);
+	Lsp_Int(QntLpc, CodCng->LspSid, CodStat->PrevLsp);
 	for (i = 0; i < LpcOrder; i++) {
-		CodStat.PrevLsp[i] = CodCng.LspSid[i];
+		CodStat->PrevLsp[i] = CodCng->LspSid[i];
 	}
 
 	/*
 	 * Output & save frame type info
 	 */
-	CodCng.PastFtyp = *Ftyp;
+	CodCng->PastFtyp = *Ftyp;
 	return;
 }
 
@@ -294,7 +285,7 @@ void Cod_Cng(int16_t * DataExc, int16_t * Ftyp, LINEDEF * Line,
 ** Return value:       None
 **
 */
-void Update_Acf(int16_t * Acf_sf, int16_t * ShAcf_sf)
+void Update_Acf(CODCNGDEF * CodCng, int16_t * Acf_sf, int16_t * ShAcf_sf)
 {
 
 	int i, i_subfr;
@@ -304,12 +295,12 @@ void Update_Acf(int16_t * Acf_sf, int16_t * ShAcf_sf)
 	int32_t L_acc0;
 
 	/* Update Acf and ShAcf */
-	ptr2 = CodCng.Acf + SizAcf;
+	ptr2 = CodCng->Acf + SizAcf;
 	ptr1 = ptr2 - LpcOrderP1;
 	for (i = LpcOrderP1; i < SizAcf; i++)
 		*(--ptr2) = *(--ptr1);
 	for (i = NbAvAcf; i >= 1; i--)
-		CodCng.ShAcf[i] = CodCng.ShAcf[i - 1];
+		CodCng->ShAcf[i] = CodCng->ShAcf[i - 1];
 
 	/* Search ShAcf_sf min for current frame */
 	sh1 = ShAcf_sf[0];
@@ -338,10 +329,10 @@ void Update_Acf(int16_t * Acf_sf, int16_t * ShAcf_sf)
 	if (temp < 0)
 		temp = 0;
 	for (i = 0; i <= LpcOrder; i++) {
-		CodCng.Acf[i] = g723_extract_l(L_g723_shr(L_temp[i], temp));
+		CodCng->Acf[i] = g723_extract_l(L_g723_shr(L_temp[i], temp));
 	}
 
-	CodCng.ShAcf[0] = g723_sub(sh1, temp);
+	CodCng->ShAcf[0] = g723_sub(sh1, temp);
 
 	return;
 }
@@ -365,7 +356,7 @@ void Update_Acf(int16_t * Acf_sf, int16_t * ShAcf_sf)
 ** Return value:       None
 **
 */
-void ComputePastAvFilter(int16_t * Coeff)
+void ComputePastAvFilter(CODCNGDEF * CodCng, int16_t * Coeff)
 {
 	int i, j;
 	int16_t *ptr_Acf;
@@ -375,9 +366,9 @@ void ComputePastAvFilter(int16_t * Coeff)
 	int32_t L_acc0;
 
 	/* Search ShAcf min */
-	sh1 = CodCng.ShAcf[1];
+	sh1 = CodCng->ShAcf[1];
 	for (i = 2; i <= NbAvAcf; i++) {
-		temp = CodCng.ShAcf[i];
+		temp = CodCng->ShAcf[i];
 		if (temp < sh1)
 			sh1 = temp;
 	}
@@ -387,9 +378,9 @@ void ComputePastAvFilter(int16_t * Coeff)
 	for (j = 0; j <= LpcOrder; j++)
 		L_sumAcf[j] = 0;
 
-	ptr_Acf = CodCng.Acf + LpcOrderP1;
+	ptr_Acf = CodCng->Acf + LpcOrderP1;
 	for (i = 1; i <= NbAvAcf; i++) {
-		temp = g723_sub(sh1, CodCng.ShAcf[i]);
+		temp = g723_sub(sh1, CodCng->ShAcf[i]);
 		for (j = 0; j <= LpcOrder; j++) {
 			L_acc0 = g723_L_deposit_l(*ptr_Acf++);
 			L_acc0 = L_g723_shl(L_acc0, temp);	/* shift right if temp<0 */
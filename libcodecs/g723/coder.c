@@ -26,6 +26,7 @@
 #include <ophtools.h>
 
 #include "g723_const.h"
+#include "basop.h"
 /*
   This file includes the coder main functions
 */
@@ -38,29 +39,28 @@ extern float mips_test[TESTMIPSNUM];
 #endif				//TEST_MIPS
 //end    -----------------------------------add by haiping 2009-06-19
 
-CODSTATDEF CodStat;
 extern int16_t LspDcTable[LpcOrder];
-extern VADSTATDEF VadStat;
-extern CODCNGDEF CodCng;
-
-extern int16_t g723_add(int16_t var1, int16_t var2);	/* Short add,           1 */
-extern int16_t g723_shl(int16_t var1, int16_t var2);	/* Short shift left,    1 */
-extern void Rem_Dc(int16_t * Dpnt);
-extern void Comp_Lpc(int16_t * UnqLpc, int16_t * PrevDat, int16_t * DataBuff);
-extern void Find_Fcbk(int16_t * Dpnt, int16_t * ImpResp, LINEDEF * Line,
+
+extern void Rem_Dc(CODSTATDEF * CodStat, int UseHp, int16_t * Dpnt);
+extern void Comp_Lpc(CODSTATDEF * CodStat, CODCNGDEF * CodCng, int16_t * UnqLpc,
+	int16_t * PrevDat, int16_t * DataBuff);
+extern void Find_Fcbk(enum Crate WrkRate, int16_t * extra, int16_t * Dpnt,
+	int16_t * ImpResp, LINEDEF * Line,
 		      int16_t Sfc);
 extern PWDEF Comp_Pw(int16_t * Dpnt, int16_t Start, int16_t Olp);
 extern void AtoLsp(int16_t * LspVect, int16_t * Lpc, int16_t * PrevLsp);
-extern int Comp_Vad(int16_t * Dpnt);
+extern int Comp_Vad(VADSTATDEF * VadStat, CODSTATDEF * CodStat, int UseVx,
+	int16_t * Dpnt);
 extern int32_t Lsp_Qnt(int16_t * CurrLsp, int16_t * PrevLsp);
 extern void Mem_Shift(int16_t * PrevDat, int16_t * DataBuff);
 extern void Wght_Lpc(int16_t * PerLpc, int16_t * UnqLpc);
-extern void Error_Wght(int16_t * Dpnt, int16_t * PerLpc);
+extern void Error_Wght(CODSTATDEF * CodStat, int16_t * Dpnt, int16_t * PerLpc);
 extern int16_t Vec_Norm(int16_t * Vect, int16_t Len);
 extern int16_t Estim_Pitch(int16_t * Dpnt, int16_t Start);
 
-extern void Init_Cod_Cng(void);
-extern void Cod_Cng(int16_t * DataExc, int16_t * Ftyp, LINEDEF * Line,
+extern void Init_Cod_Cng(CODCNGDEF * CodCng);
+extern void Cod_Cng(G723ENCDEF * st, int16_t * DataExc, int16_t * Ftyp,
+	LINEDEF * Line,
 		    int16_t * QntLpc);
 extern void Filt_Pw(int16_t * DataBuff, int16_t * Dpnt, int16_t Start,
 		    PWDEF Pw);
@@ -69,15 +69,21 @@ extern void Lsp_Inq(int16_t * Lsp, int16_t * PrevLsp, int32_t LspId,
 extern void Lsp_Int(int16_t * QntLpc, int16_t * CurrLsp, int16_t * PrevLsp);
 extern void Comp_Ir(int16_t * ImpResp, int16_t * QntLpc, int16_t * PerLpc,
 		    PWDEF Pw);
-extern void Update_Err(int16_t Olp, int16_t AcLg, int16_t AcGn);
-extern void Upd_Ring(int16_t * Dpnt, int16_t * QntLpc, int16_t * PerLpc,
+extern void Update_Err(CODSTATDEF * CodStat, enum Crate WrkRate, int16_t Olp,
+	int16_t AcLg, int16_t AcGn);
+extern void Upd_Ring(CODSTATDEF * CodStat, int16_t * Dpnt, int16_t * QntLpc,
+	int16_t * PerLpc,
 		     int16_t * PrevErr);
-extern void Sub_Ring(int16_t * Dpnt, int16_t * QntLpc, int16_t * PerLpc,
+extern void Sub_Ring(CODSTATDEF * CodStat, int16_t * Dpnt, int16_t * QntLpc,
+	int16_t * PerLpc,
 		     int16_t * PrevErr, PWDEF Pw);
-extern void Find_Acbk(int16_t * Tv, int16_t * ImpResp, int16_t * PrevExc,
+extern void Find_Acbk(CODSTATDEF * CodStat, enum Crate WrkRate, int16_t * Tv,
+	int16_t * ImpResp, int16_t * PrevExc,
 		      LINEDEF * Line, int16_t Sfc);
-extern void Line_Pack(LINEDEF * Line, char *Vout, int16_t Ftyp);
-extern void Decod_Acbk(int16_t * Tv, int16_t * PrevExc, int16_t Olp,
+extern void Line_Pack(enum Crate WrkRate, LINEDEF * Line, char *Vout,
+	int16_t Ftyp);
+extern void Decod_Acbk(enum Crate WrkRate, int16_t * Tv, int16_t * PrevExc,
+	int16_t Olp,
 		       int16_t Lid,
 		       int16_t Gid);
 
@@ -97,20 +103,20 @@ extern void Decod_Acbk(int16_t * Tv, int16_t * PrevExc, int16_t Olp,
 ** Return value:    None
 **
 */
-void Init_Coder(void)
+void Init_Coder(CODSTATDEF * CodStat)
 {
 	int i;
 
 	/* Initialize encoder data structure with zeros */
-	memzero(&CodStat, sizeof(CODSTATDEF));
+	memzero(CodStat, sizeof(CODSTATDEF));
 
 	/* Initialize the previously decoded LSP vector to the DC vector */
 	for (i = 0; i < LpcOrder; i++)
-		CodStat.PrevLsp[i] = LspDcTable[i];
+		CodStat->PrevLsp[i] = LspDcTable[i];
 
 	/* Initialize the taming procedure */
 	for (i = 0; i < SizErr; i++)
-		CodStat.Err[i] = Err0;
+		CodStat->Err[i] = Err0;
 
 	return;
 }
@@ -141,7 +147,7 @@ void Init_Coder(void)
 
 #include <stdint.h>
 
-int Coder(int16_t * DataBuff, char *Vout)
+int Coder(G723ENCDEF * st, int16_t * DataBuff, char *Vout)
 {
 	int i, j;
 
@@ -166,6 +172,10 @@ int Coder(int16_t * DataBuff, char *Vout)
 
 	int16_t Ftyp;
 
+	CODSTATDEF *CodStat = &st->CodStat;
+	VADSTATDEF *VadStat = &st->VadStat;
+	CODCNGDEF *CodCng = &st->CodCng;
+
 	/*
 	   Coder Start
 	 */
@@ -177,7 +187,7 @@ int Coder(int16_t * DataBuff, char *Vout)
 	test_start = cycles();
 #endif				//TEST_MIPS
 
-	Rem_Dc(DataBuff);
+	Rem_Dc(CodStat, st->UseHp, DataBuff);
 
 #ifdef TEST_MIPS
 	test_temp = cycles() - test_start;
@@ -191,7 +201,7 @@ int Coder(int16_t * DataBuff, char *Vout)
 	test_start = cycles();
 #endif				//TEST_MIPS
 
-	Comp_Lpc(UnqLpc, CodStat.PrevDat, DataBuff);
+	Comp_Lpc(CodStat, CodCng, UnqLpc, CodStat->PrevDat, DataBuff);
 
 #ifdef TEST_MIPS
 	test_temp = cycles() - test_start;
@@ -205,7 +215,7 @@ int Coder(int16_t * DataBuff, char *Vout)
 	test_start = cycles();
 #endif				//TEST_MIPS
 
-	AtoLsp(LspVect, &UnqLpc[LpcOrder * (SubFrames - 1)], CodStat.PrevLsp);
+	AtoLsp(LspVect, &UnqLpc[LpcOrder * (SubFrames - 1)], CodStat->PrevLsp);
 
 #ifdef TEST_MIPS
 	test_temp = cycles() - test_start;
@@ -220,7 +230,7 @@ int Coder(int16_t * DataBuff, char *Vout)
 	test_start = cycles();
 #endif				//TEST_MIPS
 
-	Ftyp = (int16_t) Comp_Vad(DataBuff);
+	Ftyp = (int16_t) Comp_Vad(VadStat, CodStat, st->UseVx, DataBuff);
 
 #ifdef TEST_MIPS
 	test_temp = cycles() - test_start;
@@ -234,7 +244,7 @@ int Coder(int16_t * DataBuff, char *Vout)
 	test_start = cycles();
 #endif				//TEST_MIPS
 
-	Line.LspId = Lsp_Qnt(LspVect, CodStat.PrevLsp);
+	Line.LspId = Lsp_Qnt(LspVect, CodStat->PrevLsp);
 
 #ifdef TEST_MIPS
 	test_temp = cycles() - test_start;
@@ -247,7 +257,7 @@ int Coder(int16_t * DataBuff, char *Vout)
 	test_start = cycles();
 #endif				//TEST_MIPS
 
-	Mem_Shift(CodStat.PrevDat, DataBuff);
+	Mem_Shift(CodStat->PrevDat, DataBuff);
 
 #ifdef TEST_MIPS
 	test_temp = cycles() - test_start;
@@ -274,7 +284,7 @@ int Coder(int16_t * DataBuff, char *Vout)
 	test_start = cycles();
 #endif				//TEST_MIPS
 
-	Error_Wght(DataBuff, PerLpc);
+	Error_Wght(CodStat, DataBuff, PerLpc);
 
 #ifdef TEST_MIPS
 	test_temp = cycles() - test_start;
@@ -305,7 +315,7 @@ int Coder(int16_t * DataBuff, char *Vout)
 #endif				//TEST_MIPS
 
 	for (i = 0; i < PitchMax; i++)
-		Dpnt[i] = CodStat.PrevWgt[i];
+		Dpnt[i] = CodStat->PrevWgt[i];
 	for (i = 0; i < Frame; i++)
 		Dpnt[PitchMax + i] = DataBuff[i];
 
@@ -337,7 +347,7 @@ int Coder(int16_t * DataBuff, char *Vout)
 
 	for (i = 0; i < SubFrames / 2; i++) {
 		Line.Olp[i] = Estim_Pitch(Dpnt, (int16_t) j);
-		VadStat.Polp[i + 2] = Line.Olp[i];
+		VadStat->Polp[i + 2] = Line.Olp[i];
 		j += 2 * SubFrLen;
 	}
 
@@ -362,21 +372,22 @@ int Coder(int16_t * DataBuff, char *Vout)
 
 		/* Save PrevWgt */
 		for (i = 0; i < PitchMax; i++)
-			CodStat.PrevWgt[i] = DataBuff[i + Frame - PitchMax];
+			CodStat->PrevWgt[i] = DataBuff[i + Frame - PitchMax];
 
 		/* CodCng => Ftyp = 0 (untransmitted) or 2 (SID) */
-		Cod_Cng(DataBuff, &Ftyp, &Line, QntLpc);
+		Cod_Cng(st, DataBuff, &Ftyp, &Line, QntLpc);
 
 		/* Update the ringing delays */
 		Dpnt = DataBuff;
 		for (i = 0; i < SubFrames; i++) {
 
 			/* Update exc_err */
-			Update_Err(Line.Olp[i >> 1], Line.Sfs[i].AcLg,
+			Update_Err(CodStat, st->WrkRate, Line.Olp[i >> 1],
+				Line.Sfs[i].AcLg,
 				   Line.Sfs[i].AcGn);
 
-			Upd_Ring(Dpnt, &QntLpc[i * LpcOrder],
-				 &PerLpc[i * 2 * LpcOrder], CodStat.PrevErr);
+			Upd_Ring(CodStat, Dpnt, &QntLpc[i * LpcOrder],
+				 &PerLpc[i * 2 * LpcOrder], CodStat->PrevErr);
 			Dpnt += SubFrLen;
 		}
 
@@ -407,13 +418,13 @@ int Coder(int16_t * DataBuff, char *Vout)
 
 		/* Reload the buffer */
 		for (i = 0; i < PitchMax; i++)
-			Dpnt[i] = CodStat.PrevWgt[i];
+			Dpnt[i] = CodStat->PrevWgt[i];
 		for (i = 0; i < Frame; i++)
 			Dpnt[PitchMax + i] = DataBuff[i];
 
 		/* Save PrevWgt */
 		for (i = 0; i < PitchMax; i++)
-			CodStat.PrevWgt[i] = Dpnt[Frame + i];
+			CodStat->PrevWgt[i] = Dpnt[Frame + i];
 
 		/* Apply the Harmonic filter */
 		j = 0;
@@ -424,14 +435,14 @@ int Coder(int16_t * DataBuff, char *Vout)
 		free((char *)Dpnt);
 
 		/* Inverse quantization of the LSP */
-		Lsp_Inq(LspVect, CodStat.PrevLsp, Line.LspId, Line.Crc);
+		Lsp_Inq(LspVect, CodStat->PrevLsp, Line.LspId, Line.Crc);
 
 		/* Interpolate the Lsp vectors */
-		Lsp_Int(QntLpc, LspVect, CodStat.PrevLsp);
+		Lsp_Int(QntLpc, LspVect, CodStat->PrevLsp);
 
 		/* Copy the LSP vector for the next frame */
 		for (i = 0; i < LpcOrder; i++)
-			CodStat.PrevLsp[i] = LspVect[i];
+			CodStat->PrevLsp[i] = LspVect[i];
 
 #ifdef TEST_MIPS
 		test_temp = cycles() - test_start;
@@ -468,8 +479,8 @@ int Coder(int16_t * DataBuff, char *Vout)
 			test_start = cycles();
 #endif				//TEST_MIPS
 
-			Sub_Ring(Dpnt, &QntLpc[i * LpcOrder],
-				 &PerLpc[i * 2 * LpcOrder], CodStat.PrevErr,
+			Sub_Ring(CodStat, Dpnt, &QntLpc[i * LpcOrder],
+				 &PerLpc[i * 2 * LpcOrder], CodStat->PrevErr,
 				 Pw[i]);
 
 #ifdef TEST_MIPS
@@ -485,7 +496,8 @@ int Coder(int16_t * DataBuff, char *Vout)
 			test_start = cycles();
 #endif				//TEST_MIPS
 
-			Find_Acbk(Dpnt, ImpResp, CodStat.PrevExc, &Line,
+			Find_Acbk(CodStat, st->WrkRate, Dpnt, ImpResp,
+				CodStat->PrevExc, &Line,
 				  (int16_t) i);
 
 #ifdef TEST_MIPS
@@ -500,7 +512,8 @@ int Coder(int16_t * DataBuff, char *Vout)
 			test_start = cycles();
 #endif				//TEST_MIPS
 
-			Find_Fcbk(Dpnt, ImpResp, &Line, (int16_t) i);
+			Find_Fcbk(st->WrkRate, &st->extra, Dpnt, ImpResp, &Line,
+				(int16_t) i);
 
 #ifdef TEST_MIPS
 			test_temp = cycles() - test_start;
@@ -514,7 +527,8 @@ int Coder(int16_t * DataBuff, char *Vout)
 			test_start = cycles();
 #endif				//TEST_MIPS
 
-			Decod_Acbk(ImpResp, CodStat.PrevExc, Line.Olp[i >> 1],
+			Decod_Acbk(st->WrkRate, ImpResp, CodStat->PrevExc,
+				Line.Olp[i >> 1],
 				   Line.Sfs[i].AcLg, Line.Sfs[i].AcGn);
 
 #ifdef TEST_MIPS
@@ -529,13 +543,13 @@ int Coder(int16_t * DataBuff, char *Vout)
 #endif				//TEST_MIPS
 
 			for (j = SubFrLen; j < PitchMax; j++)
-				CodStat.PrevExc[j - SubFrLen] =
-				    CodStat.PrevExc[j];
+				CodStat->PrevExc[j - SubFrLen] =
+				    CodStat->PrevExc[j];
 
 			for (j = 0; j < SubFrLen; j++) {
 				Dpnt[j] = g723_shl(Dpnt[j], (int16_t) 1);
 				Dpnt[j] = g723_add(Dpnt[j], ImpResp[j]);
-				CodStat.PrevExc[PitchMax - SubFrLen + j] =
+				CodStat->PrevExc[PitchMax - SubFrLen + j] =
 				    Dpnt[j];
 			}
 
@@ -551,7 +565,8 @@ int Coder(int16_t * DataBuff, char *Vout)
 			test_start = cycles();
 #endif				//TEST_MIPS
 
-			Update_Err(Line.Olp[i >> 1], Line.Sfs[i].AcLg,
+			Update_Err(CodStat, st->WrkRate, Line.Olp[i >> 1],
+				Line.Sfs[i].AcLg,
 				   Line.Sfs[i].AcGn);
 
 #ifdef TEST_MIPS
@@ -567,8 +582,8 @@ int Coder(int16_t * DataBuff, char *Vout)
 			test_start = cycles();
 #endif				//TEST_MIPS
 
-			Upd_Ring(Dpnt, &QntLpc[i * LpcOrder],
-				 &PerLpc[i * 2 * LpcOrder], CodStat.PrevErr);
+			Upd_Ring(CodStat, Dpnt, &QntLpc[i * LpcOrder],
+				 &PerLpc[i * 2 * LpcOrder], CodStat->PrevErr);
 
 #ifdef TEST_MIPS
 			test_temp = cycles() - test_start;
@@ -582,8 +597,8 @@ int Coder(int16_t * DataBuff, char *Vout)
 		/*
 		   // Save Vad information and reset CNG random generator
 		 */
-		CodCng.PastFtyp = 1;
-		CodCng.RandSeed = 12345;
+		CodCng->PastFtyp = 1;
+		CodCng->RandSeed = 12345;
 
 	}			/* End of active frame case */
 
@@ -593,7 +608,7 @@ int Coder(int16_t * DataBuff, char *Vout)
 	test_start = cycles();
 #endif				//TEST_MIPS
 
-	Line_Pack(&Line, Vout, Ftyp);
+	Line_Pack(st->WrkRate, &Line, Vout, Ftyp);
 
 #ifdef TEST_MIPS
 	test_temp = cycles() - test_start;
@@ -24,19 +24,16 @@
 #include <stdlib.h>
 
 #include "g723_const.h"
+#include "basop.h"
 /* Global Variable */
-DECCNGDEF DecCng;
 extern int16_t LspDcTable[LpcOrder];
-extern DECSTATDEF DecStat;
 
 extern void Lsp_Inq(int16_t * Lsp, int16_t * PrevLsp, int32_t LspId,
 		    int16_t Crc);
 extern int16_t Qua_SidGain(int16_t * Ener, int16_t * shEner, int16_t nq);
-extern int16_t g723_extract_h(int32_t L_var1);	/* Extract high,        1 */
-extern int32_t L_g723_add(int32_t L_var1, int32_t L_var2);	/* Long add,        2 */
 
-extern int32_t L_g723_mult(int16_t var1, int16_t var2);	/* Long mult,           1 */
-extern void Calc_Exc_Rand(int16_t cur_gain, int16_t * PrevExc,
+extern void Calc_Exc_Rand(enum Crate WrkRate, int16_t cur_gain,
+	int16_t * PrevExc,
 			  int16_t * DataExc,
 			  int16_t * nRandom, LINEDEF * Line);
 extern void Lsp_Int(int16_t * QntLpc, int16_t * CurrLsp, int16_t * PrevLsp);
@@ -57,15 +54,15 @@ extern int16_t Dec_SidGain(int16_t i_gain);
 ** Return value:    None
 **
 */
-void Init_Dec_Cng(void)
+void Init_Dec_Cng(DECCNGDEF * DecCng)
 {
 	int i;
 
-	DecCng.PastFtyp = 1;
-	DecCng.SidGain = 0;
+	DecCng->PastFtyp = 1;
+	DecCng->SidGain = 0;
 	for (i = 0; i < LpcOrder; i++)
-		DecCng.LspSid[i] = LspDcTable[i];
-	DecCng.RandSeed = 12345;
+		DecCng->LspSid[i] = LspDcTable[i];
+	DecCng->RandSeed = 12345;
 	return;
 }
 
@@ -97,22 +94,25 @@ void Init_Dec_Cng(void)
 ** Return value:       None
 **
 */
-void Dec_Cng(int16_t Ftyp, LINEDEF * Line, int16_t * DataExc,
+void Dec_Cng(G723DECDEF * st, int16_t Ftyp, LINEDEF * Line, int16_t * DataExc,
 	     int16_t * QntLpc)
 {
 
 	int16_t temp;
 	int i;
 
+	DECSTATDEF *DecStat = &st->DecStat;
+	DECCNGDEF *DecCng = &st->DecCng;
+
 	if (Ftyp == 2) {
 
 		/*
 		 * SID Frame decoding
 		 */
-		DecCng.SidGain = Dec_SidGain(Line->Sfs[0].Mamp);
+		DecCng->SidGain = Dec_SidGain(Line->Sfs[0].Mamp);
 
 		/* Inverse quantization of the LSP */
-		Lsp_Inq(DecCng.LspSid, DecStat.PrevLsp, Line->LspId, 0);
+		Lsp_Inq(DecCng->LspSid, DecStat->PrevLsp, Line->LspId, 0);
 	}
 
 	else {
@@ -120,35 +120,36 @@ void Dec_Cng(int16_t Ftyp, LINEDEF * Line, int16_t * DataExc,
 /*
  * non SID Frame
  */
-		if (DecCng.PastFtyp == 1) {
+		if (DecCng->PastFtyp == 1) {
 
 			/*
 			 * Case of 1st SID frame erased : quantize-decode
-			 * energy estimate stored in DecCng.SidGain
-			 * scaling factor in DecCng.CurGain
+			 * energy estimate stored in DecCng->SidGain
+			 * scaling factor in DecCng->CurGain
 			 */
-			temp = Qua_SidGain(&DecCng.SidGain, &DecCng.CurGain, 0);
-			DecCng.SidGain = Dec_SidGain(temp);
+			temp = Qua_SidGain(&DecCng->SidGain, &DecCng->CurGain,
+				0);
+			DecCng->SidGain = Dec_SidGain(temp);
 		}
 	}
 
-	if (DecCng.PastFtyp == 1) {
-		DecCng.CurGain = DecCng.SidGain;
+	if (DecCng->PastFtyp == 1) {
+		DecCng->CurGain = DecCng->SidGain;
 	} else {
-		DecCng.CurGain =
+		DecCng->CurGain =
 		    g723_extract_h(L_g723_add
-				   (L_g723_mult(DecCng.CurGain, 0x7000),
-				    L_g723_mult(DecCng.SidGain, 0x1000)));
+				   (L_g723_mult(DecCng->CurGain, 0x7000),
+				    L_g723_mult(DecCng->SidGain, 0x1000)));
 	}
-	Calc_Exc_Rand(DecCng.CurGain, DecStat.PrevExc, DataExc,
-		      &DecCng.RandSeed, Line);
+	Calc_Exc_Rand(st->WrkRate, DecCng->CurGain, DecStat->PrevExc, DataExc,
+		      &DecCng->RandSeed, Line);
 
 	/* Interpolate the Lsp vectors */
-	Lsp_Int(QntLpc, DecCng.LspSid, DecStat.PrevLsp);
+	Lsp_Int(QntLpc, DecCng->LspSid, DecStat->PrevLsp);
 
 	/* Copy the LSP vector for the next frame */
 	for (i = 0; i < LpcOrder; i++)
-		DecStat.PrevLsp[i] = DecCng.LspSid[i];
+		DecStat->PrevLsp[i] = DecCng->LspSid[i];
 
 	return;
 }
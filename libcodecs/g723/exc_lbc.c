@@ -12,6 +12,7 @@
 **  Computing Open loop Pitch lag:
 **
 **      Estim_Pitch()
+**      Cor_NoSat()
 **
 **  Harmonic noise weighting:
 **
@@ -65,38 +66,13 @@
 #include <ophtools.h>
 
 #include "g723_const.h"
+#include "basop.h"
 #include "lbccodec.h"
-extern int32_t g723_L_mac(int32_t L_var3, int16_t var1, int16_t var2);	/* Mac,    1 */
-extern int16_t g723_sub(int16_t var1, int16_t var2);	/* Short sub,           1 */
-extern int32_t g723_L_msu(int32_t L_var3, int16_t var1, int16_t var2);	/* Msu,    1 */
-extern int16_t g723_norm_l(int32_t L_var1);	/* Long norm,            30 */
-extern int32_t L_g723_shl(int32_t L_var1, int16_t var2);	/* Long shift left,     2 */
-extern int16_t g723_shl(int16_t var1, int16_t var2);	/* Short shift left,    1 */
-//extern int32_t L_g723_shl(int32_t L_var1, int16_t var2); /* Long shift left,     2 */
-extern int16_t round_(int32_t L_var1);	/* Round,               1 */
-extern int16_t g723_mult_r(int16_t var1, int16_t var2);	/* Mult with round,     2 */
-extern int32_t L_g723_mult(int16_t var1, int16_t var2);	/* Long mult,           1 */
-extern int16_t g723_add(int16_t var1, int16_t var2);	/* Short add,           1 */
-extern int32_t L_g723_add(int32_t L_var1, int32_t L_var2);	/* Long add,        2 */
-extern int16_t g723_extract_h(int32_t L_var1);	/* Extract high,        1 */
-extern int16_t g723_shr(int16_t var1, int16_t var2);	/* Short shift right,   1 */
-extern int32_t L_g723_negate(int32_t L_var1);	/* Long negate,     2 */
-extern int32_t L_g723_shr(int32_t L_var1, int16_t var2);	/* Long shift right,    2 */
-extern int32_t g723_L_abs(int32_t L_var1);	/* Long abs,              3 */
-extern int16_t g723_mult_r(int16_t var1, int16_t var2);	/* Mult with round,     2 */
-extern int32_t L_g723_sub(int32_t L_var1, int32_t L_var2);	/* Long sub,        2 */
-extern int16_t div_s(int16_t var1, int16_t var2);	/* Short division,       18 */
-extern int32_t g723_L_deposit_h(int16_t var1);	/* 16 bit var1 -> MSB,     2 */
-extern int16_t i_g723_mult(int16_t a, int16_t b);
-
-extern int16_t g723_mult(int16_t var1, int16_t var2);	/* Short mult,          1 */
-extern int16_t Test_Err(int16_t Lag1, int16_t Lag2);
+
+extern int16_t Test_Err(CODSTATDEF * CodStat, int16_t Lag1, int16_t Lag2);
 
 //extern void  Gen_Trn( int16_t *Dst, int16_t *Src, int16_t Olp );
 //extern int16_t search_T0 ( int16_t T0, int16_t Gid, int16_t *gain_T0);
-extern int16_t g723_extract_l(int32_t L_var1);	/* Extract low,         1 */
-extern int16_t g723_negate(int16_t var1);	/* Short negate,        1 */
-extern int16_t g723_abs_s(int16_t var1);	/* Short abs,           1 */
 
 extern int32_t CombinatorialTable[MaxPulseNum][SubFrLen / Sgrid];
 extern int16_t Nb_puls[4];
@@ -107,46 +83,52 @@ extern int16_t epsi170[170];
 extern int16_t gain170[170];
 extern int16_t tabgain170[170];
 
-extern int16_t div_l(int32_t, int16_t);
 extern int16_t Sqrt_lbc(int32_t Num);
 
 extern int16_t Rand_lbc(int16_t * p);
 extern int16_t Vec_Norm(int16_t * Vect, int16_t Len);
 extern int16_t *AcbkGainTablePtr[2];
-extern enum Crate WrkRate;
 
 int16_t Estim_Pitch(int16_t * Dpnt, int16_t Start);
+int16_t Cor_NoSat(int16_t * Dpnt, int16_t Len, int16_t WinLen);
 PWDEF Comp_Pw(int16_t * Dpnt, int16_t Start, int16_t Olp);
 void Filt_Pw(int16_t * DataBuff, int16_t * Dpnt, int16_t Start, PWDEF Pw);
-void Find_Fcbk(int16_t * Dpnt, int16_t * ImpResp, LINEDEF * Line,
+void Find_Fcbk(enum Crate WrkRate, int16_t * extra, int16_t * Dpnt,
+	int16_t * ImpResp, LINEDEF * Line,
 	       int16_t Sfc);
 void Gen_Trn(int16_t * Dst, int16_t * Src, int16_t Olp);
 void Find_Best(BESTDEF * Best, int16_t * Tv, int16_t * ImpResp, int16_t Np,
 	       int16_t Olp);
 void Fcbk_Pack(int16_t * Dpnt, SFSDEF * Sfs, BESTDEF * Best, int16_t Np);
-void Fcbk_Unpk(int16_t * Tv, SFSDEF Sfs, int16_t Olp, int16_t Sfc);
-void Find_Acbk(int16_t * Tv, int16_t * ImpResp, int16_t * PrevExc, LINEDEF
+void Fcbk_Unpk(enum Crate WrkRate, int16_t * Tv, SFSDEF Sfs, int16_t Olp,
+	int16_t Sfc);
+void Find_Acbk(CODSTATDEF * CodStat, enum Crate WrkRate, int16_t * Tv,
+	int16_t * ImpResp, int16_t * PrevExc, LINEDEF
 	       * Line, int16_t Sfc);
 void Get_Rez(int16_t * Tv, int16_t * PrevExc, int16_t Lag);
-void Decod_Acbk(int16_t * Tv, int16_t * PrevExc, int16_t Olp, int16_t Lid,
+void Decod_Acbk(enum Crate WrkRate, int16_t * Tv, int16_t * PrevExc,
+	int16_t Olp, int16_t Lid,
 		int16_t Gid);
 int16_t Comp_Info(int16_t * Buff, int16_t Olp, int16_t * Gain,
 		  int16_t * ShGain);
 void Regen(int16_t * DataBuff, int16_t * Buff, int16_t Lag, int16_t Gain,
 	   int16_t Ecount, int16_t * Sd);
-PFDEF Comp_Lpf(int16_t * Buff, int16_t Olp, int16_t Sfc);
+PFDEF Comp_Lpf(enum Crate WrkRate, int16_t * Buff, int16_t Olp, int16_t Sfc);
 int16_t Find_B(int16_t * Buff, int16_t Olp, int16_t Sfc);
 int16_t Find_F(int16_t * Buff, int16_t Olp, int16_t Sfc);
-PFDEF Get_Ind(int16_t Ind, int16_t Ten, int16_t Ccr, int16_t Enr);
+PFDEF Get_Ind(enum Crate WrkRate, int16_t Ind, int16_t Ten, int16_t Ccr,
+	int16_t Enr);
 void Filt_Lpf(int16_t * Tv, int16_t * Buff, PFDEF Pf, int16_t Sfc);
-void reset_max_time(void);
+void reset_max_time(int16_t * extra);
 int16_t search_T0(int16_t T0, int16_t Gid, int16_t * gain_T0);
-int16_t ACELP_LBC_code(int16_t X[], int16_t h[], int16_t T0, int16_t code[],
+int16_t ACELP_LBC_code(int16_t * extra, int16_t X[], int16_t h[], int16_t T0,
+	int16_t code[],
 		      int16_t * gain, int16_t * shift, int16_t * sign,
 		      int16_t gain_T0);
 void Cor_h(int16_t * H, int16_t * rr);
 void Cor_h_X(int16_t h[], int16_t X[], int16_t D[]);
-int16_t D4i64_LBC(int16_t Dn[], int16_t rr[], int16_t h[], int16_t cod[],
+int16_t D4i64_LBC(int16_t * extra, int16_t Dn[], int16_t rr[], int16_t h[],
+	int16_t cod[],
 		 int16_t y[], int16_t * code_shift, int16_t * sign);
 int16_t G_code(int16_t X[], int16_t Y[], int16_t * gain_q);
 
@@ -189,6 +171,12 @@ int16_t Estim_Pitch(int16_t * Dpnt, int16_t Start)
 	int16_t Mnr = (int16_t) 0x7fff;
 
 	int16_t Pr;
+	int16_t NoSat;
+
+	/* The crosses are plain sums when no window can saturate them */
+	NoSat = Cor_NoSat(&Dpnt[Start - (PitchMax - 3)],
+			  (int16_t) (PitchMax - 3 + 2 * SubFrLen),
+			  (int16_t) (2 * SubFrLen));
 
 	/* Init the energy estimate */
 	Pr = Start - (int16_t) PitchMin + (int16_t) 1;
@@ -209,8 +197,16 @@ int16_t Estim_Pitch(int16_t * Dpnt, int16_t Start)
 
 		/*  Compute the cross */
 		Acc0 = (int32_t) 0;
-		for (j = 0; j < 2 * SubFrLen; j++)
-			Acc0 = g723_L_mac(Acc0, Dpnt[Start + j], Dpnt[Pr + j]);
+		if (NoSat) {
+			for (j = 0; j < 2 * SubFrLen; j++)
+				Acc0 += Dpnt[Start + j] * Dpnt[Pr + j];
+			Acc0 *= 2;
+		} else {
+			for (j = 0; j < 2 * SubFrLen; j++)
+				Acc0 =
+				    g723_L_mac(Acc0, Dpnt[Start + j],
+					       Dpnt[Pr + j]);
+		}
 
 		if (Acc0 > (int32_t) 0) {
 
@@ -290,6 +286,50 @@ int16_t Estim_Pitch(int16_t * Dpnt, int16_t Start)
 	return Indx;
 }
 
+/*
+**
+** Function:        Cor_NoSat()
+**
+** Description:     Tells whether the crosscorrelations of windows taken
+**                  from a vector can saturate when accumulated with
+**                  g723_L_mac().  Any partial sum of such a chain is
+**                  bounded by the energies of the two windows
+**                  (2|x.y| <= x.x + y.y), so when every window has an
+**                  energy below 2^30 the chain equals the plain integer
+**                  sum and no sample is -32768.
+**
+** Links to text:   None
+**
+** Arguments:
+**
+**  int16_t *Dpnt    Vector the windows are taken from
+**  int16_t Len      Length of the vector
+**  int16_t WinLen   Length of each window
+**
+** Outputs:         None
+**
+** Return value:
+**
+**  int16_t      1 if no window energy reaches 2^30, 0 otherwise
+**
+*/
+int16_t Cor_NoSat(int16_t * Dpnt, int16_t Len, int16_t WinLen)
+{
+	int i;
+	int64_t Acc0;
+
+	Acc0 = (int64_t) 0;
+	for (i = 0; i < (int)Len; i++) {
+		Acc0 += Dpnt[i] * Dpnt[i];
+		if (i >= (int)WinLen)
+			Acc0 -= Dpnt[i - WinLen] * Dpnt[i - WinLen];
+		if (Acc0 >= (int64_t) 0x40000000L)
+			return (int16_t) 0;
+	}
+
+	return (int16_t) 1;
+}
+
 /*
 **
 ** Function:        Comp_Pw()
@@ -495,7 +535,8 @@ void Filt_Pw(int16_t * DataBuff, int16_t * Dpnt, int16_t Start, PWDEF Pw)
 ** Return value:        None
 **
 */
-void Find_Fcbk(int16_t * Dpnt, int16_t * ImpResp, LINEDEF * Line,
+void Find_Fcbk(enum Crate WrkRate, int16_t * extra, int16_t * Dpnt,
+	int16_t * ImpResp, LINEDEF * Line,
 	       int16_t Sfc)
 {
 	int i;
@@ -540,7 +581,7 @@ void Find_Fcbk(int16_t * Dpnt, int16_t * ImpResp, LINEDEF * Line,
 					     (*Line).Sfs[Sfc].AcGn, &gain_T0);
 
 			(*Line).Sfs[Sfc].Ppos =
-			    ACELP_LBC_code(Dpnt, ImpResp, T0_acelp, Dpnt,
+			    ACELP_LBC_code(extra, Dpnt, ImpResp, T0_acelp, Dpnt,
 					   &(*Line).Sfs[Sfc].Mamp,
 					   &(*Line).Sfs[Sfc].Grid,
 					   &(*Line).Sfs[Sfc].Pamp, gain_T0);
@@ -635,15 +676,18 @@ void Find_Best(BESTDEF * Best, int16_t * Tv, int16_t * ImpResp, int16_t Np,
 	       int16_t Olp)
 {
 
-	int i, j, k, l;
+	int i, j, k, l, m;
 	BESTDEF Temp;
 
 	int16_t Exp;
 	int16_t MaxAmpId;
 	int16_t MaxAmp;
 	int32_t Acc0, Acc1, Acc2;
+	int16_t NoSat;
 
 	int16_t Imr[SubFrLen];
+	int16_t PulPos[MaxPulseNum];
+	int16_t PulAmp[MaxPulseNum];
 	int16_t OccPos[SubFrLen];
 	int16_t ImrCorr[SubFrLen];
 	int32_t ErrBlk[SubFrLen];
@@ -668,6 +712,13 @@ void Find_Best(BESTDEF * Best, int16_t * Tv, int16_t * ImpResp, int16_t Np,
 	for (i = 0; i < SubFrLen; i++)
 		Acc0 = g723_L_mac(Acc0, OccPos[i], OccPos[i]);
 
+	/*
+	 * An unsaturated energy bounds every correlation of the vector with
+	 * itself or with another unsaturated one (|x.y| <= (x.x + y.y) / 2),
+	 * so those are done as plain integer sums.
+	 */
+	NoSat = (Acc0 != MAX_32);
+
 	Exp = g723_norm_l(Acc0);
 	Acc0 = L_g723_shl(Acc0, Exp);
 	ImrCorr[0] = round_(Acc0);
@@ -675,18 +726,39 @@ void Find_Best(BESTDEF * Best, int16_t * Tv, int16_t * ImpResp, int16_t Np,
 	/* Compute all the other */
 	for (i = 1; i < SubFrLen; i++) {
 		Acc0 = (int32_t) 0;
-		for (j = i; j < SubFrLen; j++)
-			Acc0 = g723_L_mac(Acc0, OccPos[j], OccPos[j - i]);
+		if (NoSat) {
+			for (j = i; j < SubFrLen; j++)
+				Acc0 += OccPos[j] * OccPos[j - i];
+			Acc0 *= 2;
+		} else {
+			for (j = i; j < SubFrLen; j++)
+				Acc0 =
+				    g723_L_mac(Acc0, OccPos[j], OccPos[j - i]);
+		}
 		Acc0 = L_g723_shl(Acc0, Exp);
 		ImrCorr[i] = round_(Acc0);
 	}
 
 	/* Cross correlation with the signal */
+	Acc0 = (int32_t) 0;
+	Acc1 = (int32_t) 0;
+	for (i = 0; i < SubFrLen; i++) {
+		Acc0 = g723_L_mac(Acc0, Tv[i], Tv[i]);
+		Acc1 = g723_L_mac(Acc1, Imr[i], Imr[i]);
+	}
+	NoSat = (Acc0 != MAX_32) && (Acc1 != MAX_32);
+
 	Exp = g723_sub(Exp, 4);
 	for (i = 0; i < SubFrLen; i++) {
 		Acc0 = (int32_t) 0;
-		for (j = i; j < SubFrLen; j++)
-			Acc0 = g723_L_mac(Acc0, Tv[j], Imr[j - i]);
+		if (NoSat) {
+			for (j = i; j < SubFrLen; j++)
+				Acc0 += Tv[j] * Imr[j - i];
+			Acc0 *= 2;
+		} else {
+			for (j = i; j < SubFrLen; j++)
+				Acc0 = g723_L_mac(Acc0, Tv[j], Imr[j - i]);
+		}
 		ErrBlk[i] = L_g723_shl(Acc0, Exp);
 	}
 
@@ -778,12 +850,23 @@ void Find_Best(BESTDEF * Best, int16_t * Tv, int16_t * ImpResp, int16_t Np,
 			for (j = 0; j < Np; j++)
 				OccPos[Temp.Ploc[j]] = Temp.Pamp[j];
 
-			for (l = SubFrLen - 1; l >= 0; l--) {
+			/* Only the Np pulses contribute to the convolution, */
+			/* the zero terms leave the L_mac() chain unchanged  */
+			m = 0;
+			for (j = 0; j < SubFrLen; j++) {
+				if (OccPos[j] != (int16_t) 0) {
+					PulPos[m] = (int16_t) j;
+					PulAmp[m] = OccPos[j];
+					m++;
+				}
+			}
+
+			for (l = 0; l < SubFrLen; l++) {
 				Acc0 = (int32_t) 0;
-				for (j = 0; j <= l; j++)
+				for (j = 0; j < m && PulPos[j] <= l; j++)
 					Acc0 =
-					    g723_L_mac(Acc0, OccPos[j],
-						       Imr[l - j]);
+					    g723_L_mac(Acc0, PulAmp[j],
+						       Imr[l - PulPos[j]]);
 				Acc0 = L_g723_shl(Acc0, (int16_t) 2);
 				OccPos[l] = g723_extract_h(Acc0);
 			}
@@ -897,7 +980,8 @@ void Fcbk_Pack(int16_t * Dpnt, SFSDEF * Sfs, BESTDEF * Best, int16_t Np)
 ** Return value:    None
 **
 */
-void Fcbk_Unpk(int16_t * Tv, SFSDEF Sfs, int16_t Olp, int16_t Sfc)
+void Fcbk_Unpk(enum Crate WrkRate, int16_t * Tv, SFSDEF Sfs, int16_t Olp,
+	int16_t Sfc)
 {
 	int i, j;
 
@@ -1034,7 +1118,8 @@ void Fcbk_Unpk(int16_t * Tv, SFSDEF Sfs, int16_t Olp, int16_t Sfc)
 ** Return value:    None
 **
 */
-void Find_Acbk(int16_t * Tv, int16_t * ImpResp, int16_t * PrevExc, LINEDEF
+void Find_Acbk(CODSTATDEF * CodStat, enum Crate WrkRate, int16_t * Tv,
+	int16_t * ImpResp, int16_t * PrevExc, LINEDEF
 	       * Line, int16_t Sfc)
 {
 	int i, j, k, l;
@@ -1059,6 +1144,9 @@ void Find_Acbk(int16_t * Tv, int16_t * ImpResp, int16_t * PrevExc, LINEDEF
 	int16_t Lag1, Lag2;
 	int16_t off_filt;
 
+	int32_t HAbs, GAbs, Lim;
+	int16_t TvNoSat, NoSat;
+
 	memzero(CorBuf,
 		4 * (2 * ClPitchOrd + ClPitchOrd * (ClPitchOrd - 1) / 2) * sizeof(int32_t));
 
@@ -1076,6 +1164,21 @@ void Find_Acbk(int16_t * Tv, int16_t * ImpResp, int16_t * PrevExc, LINEDEF
 			Olp = (int16_t) (PitchMax - 5);
 	}
 
+	/*
+	 * The sums below are done in plain integers whenever a bound shows
+	 * that no partial sum can saturate, which gives the same result as
+	 * the L_mac() chains.  The filtering is bounded by the absolute sum
+	 * of the impulse response, the correlations by the energies of the
+	 * two vectors (|x.y| <= (x.x + y.y) / 2).
+	 */
+	HAbs = (int32_t) 0;
+	Acc1 = (int32_t) 0;
+	for (i = 0; i < SubFrLen; i++) {
+		HAbs += abs(ImpResp[i]);
+		Acc1 = g723_L_mac(Acc1, Tv[i], Tv[i]);
+	}
+	TvNoSat = (Acc1 != MAX_32);
+
 	lPnt = CorBuf;
 	for (k = 0; k < (int)Hb; k++) {
 
@@ -1083,13 +1186,28 @@ void Find_Acbk(int16_t * Tv, int16_t * ImpResp, int16_t * PrevExc, LINEDEF
 		Get_Rez(RezBuf, PrevExc,
 			(int16_t) (Olp - (int16_t) Pstep + k));
 
+		Lim = (int32_t) 0;
+		for (i = 0; i < SubFrLen + ClPitchOrd - 1; i++) {
+			if (abs(RezBuf[i]) > Lim)
+				Lim = abs(RezBuf[i]);
+		}
+		NoSat = ((int64_t) Lim * HAbs <= (MAX_32 - 0x8000L) / 2);
+
 		/* Filter the last one using the impulse response */
 		for (i = 0; i < SubFrLen; i++) {
 			Acc0 = (int32_t) 0;
-			for (j = 0; j <= i; j++)
-				Acc0 =
-				    g723_L_mac(Acc0, RezBuf[ClPitchOrd - 1 + j],
-					       ImpResp[i - j]);
+			if (NoSat) {
+				for (j = 0; j <= i; j++)
+					Acc0 += RezBuf[ClPitchOrd - 1 + j] *
+					    ImpResp[i - j];
+				Acc0 *= 2;
+			} else {
+				for (j = 0; j <= i; j++)
+					Acc0 =
+					    g723_L_mac(Acc0,
+						       RezBuf[ClPitchOrd - 1 + j],
+						       ImpResp[i - j]);
+			}
 			FltBuf[ClPitchOrd - 1][i] = round_(Acc0);
 		}
 
@@ -1104,40 +1222,56 @@ void Find_Acbk(int16_t * Tv, int16_t * ImpResp, int16_t * PrevExc, LINEDEF
 			}
 		}
 
-		/* Compute the cross with the signal */
+		/* Compute the energies (stored after the crosses) */
+		NoSat = TvNoSat;
 		for (i = 0; i < ClPitchOrd; i++) {
 			Acc1 = (int32_t) 0;
-			for (j = 0; j < SubFrLen; j++) {
-				Acc0 = L_g723_mult(Tv[j], FltBuf[i][j]);
+			for (j = 0; j < SubFrLen; j++)
 				Acc1 =
-				    L_g723_add(Acc1,
-					       L_g723_shr(Acc0, (int16_t) 1));
-			}
-			*lPnt++ = L_g723_shl(Acc1, (int16_t) 1);
+				    g723_L_mac(Acc1, FltBuf[i][j],
+					       FltBuf[i][j]);
+			lPnt[ClPitchOrd + i] = Acc1;
+			if (Acc1 == MAX_32)
+				NoSat = 0;
 		}
 
-		/* Compute the energies */
+		/* Compute the cross with the signal */
 		for (i = 0; i < ClPitchOrd; i++) {
 			Acc1 = (int32_t) 0;
-			for (j = 0; j < SubFrLen; j++)
-				Acc1 =
-				    g723_L_mac(Acc1, FltBuf[i][j],
-					       FltBuf[i][j]);
-			*lPnt++ = Acc1;
+			if (NoSat) {
+				for (j = 0; j < SubFrLen; j++)
+					Acc1 += Tv[j] * FltBuf[i][j];
+			} else {
+				for (j = 0; j < SubFrLen; j++) {
+					Acc0 = L_g723_mult(Tv[j], FltBuf[i][j]);
+					Acc1 =
+					    L_g723_add(Acc1,
+						       L_g723_shr(Acc0,
+								  (int16_t) 1));
+				}
+			}
+			lPnt[i] = L_g723_shl(Acc1, (int16_t) 1);
 		}
+		lPnt += 2 * ClPitchOrd;
 
 		/* Compute the between crosses */
 		for (i = 1; i < ClPitchOrd; i++) {
 			for (j = 0; j < i; j++) {
 				Acc1 = (int32_t) 0;
-				for (l = 0; l < SubFrLen; l++) {
-					Acc0 =
-					    L_g723_mult(FltBuf[i][l],
-							FltBuf[j][l]);
-					Acc1 =
-					    L_g723_add(Acc1,
-						       L_g723_shr(Acc0,
-								  (int16_t) 1));
+				if (NoSat) {
+					for (l = 0; l < SubFrLen; l++)
+						Acc1 += FltBuf[i][l] *
+						    FltBuf[j][l];
+				} else {
+					for (l = 0; l < SubFrLen; l++) {
+						Acc0 =
+						    L_g723_mult(FltBuf[i][l],
+								FltBuf[j][l]);
+						Acc1 =
+						    L_g723_add(Acc1,
+							       L_g723_shr(Acc0,
+									  (int16_t) 1));
+					}
 				}
 				*lPnt++ = L_g723_shl(Acc1, (int16_t) 2);
 			}
@@ -1162,7 +1296,7 @@ void Find_Acbk(int16_t * Tv, int16_t * ImpResp, int16_t * PrevExc, LINEDEF
 	/* Test potential error */
 	Lag1 = Olp - (int16_t) Pstep;
 	Lag2 = Olp - (int16_t) Pstep + Hb - (int16_t) 1;
-	off_filt = Test_Err(Lag1, Lag2);
+	off_filt = Test_Err(CodStat, Lag1, Lag2);
 	Bound[0] = NbFilt085_min + g723_shl(off_filt, 2);
 	if (Bound[0] > NbFilt085)
 		Bound[0] = NbFilt085;
@@ -1191,16 +1325,36 @@ void Find_Acbk(int16_t * Tv, int16_t * ImpResp, int16_t * PrevExc, LINEDEF
 
 		sPnt = AcbkGainTablePtr[l];
 
+		/* A gain vector whose absolute sum is at most Lim cannot */
+		/* saturate the error sum; the tables hold no -32768      */
+		Lim = (int32_t) 0;
+		for (j = 0; j < 20; j++) {
+			if (abs(CorVct[k * 20 + j]) > Lim)
+				Lim = abs(CorVct[k * 20 + j]);
+		}
+		Lim = (Lim == 0) ? MAX_32 : MAX_32 / Lim;
+
 		for (i = 0; i < (int)Bound[l]; i++) {
 
 			Acc0 = (int32_t) 0;
+			GAbs = (int32_t) 0;
 			for (j = 0; j < 20; j++)
-				Acc0 =
-				    L_g723_add(Acc0,
-					       L_g723_shr(L_g723_mult
-							  (CorVct[k * 20 + j],
-							   *sPnt++),
-							  (int16_t) 1));
+				GAbs += abs(sPnt[j]);
+
+			if (GAbs <= Lim) {
+				for (j = 0; j < 20; j++)
+					Acc0 += CorVct[k * 20 + j] * sPnt[j];
+				sPnt += 20;
+			} else {
+				for (j = 0; j < 20; j++)
+					Acc0 =
+					    L_g723_add(Acc0,
+						       L_g723_shr(L_g723_mult
+								  (CorVct
+								   [k * 20 + j],
+								   *sPnt++),
+								  (int16_t) 1));
+			}
 
 			if (Acc0 > Acc1) {
 				Acc1 = Acc0;
@@ -1222,7 +1376,7 @@ void Find_Acbk(int16_t * Tv, int16_t * ImpResp, int16_t * PrevExc, LINEDEF
 	(*Line).Olp[g723_shr(Sfc, (int16_t) 1)] = Olp;
 
 	/* Decode the Acbk contribution and subtract it */
-	Decod_Acbk(RezBuf, PrevExc, Olp, Lid, Gid);
+	Decod_Acbk(WrkRate, RezBuf, PrevExc, Olp, Lid, Gid);
 
 	for (i = 0; i < SubFrLen; i++) {
 		Acc0 = g723_L_deposit_h(Tv[i]);
@@ -1303,7 +1457,8 @@ void Get_Rez(int16_t * Tv, int16_t * PrevExc, int16_t Lag)
 ** Return value:    None
 **
 */
-void Decod_Acbk(int16_t * Tv, int16_t * PrevExc, int16_t Olp, int16_t Lid,
+void Decod_Acbk(enum Crate WrkRate, int16_t * Tv, int16_t * PrevExc,
+	int16_t Olp, int16_t Lid,
 		int16_t Gid)
 {
 	int i, j;
@@ -1528,7 +1683,7 @@ void Regen(int16_t * DataBuff, int16_t * Buff, int16_t Lag, int16_t Gain,
 **                                           PF.ScGn    Pitch Postfilter scaling gain
 **                                           PF.Indx    Pitch postfilter lag
 */
-PFDEF Comp_Lpf(int16_t * Buff, int16_t Olp, int16_t Sfc)
+PFDEF Comp_Lpf(enum Crate WrkRate, int16_t * Buff, int16_t Olp, int16_t Sfc)
 {
 	int i, j;
 
@@ -1623,10 +1778,10 @@ PFDEF Comp_Lpf(int16_t * Buff, int16_t Olp, int16_t Sfc)
 
 	/* Select the best pair */
 	if ((Bindx != (int16_t) 0) && (Findx == (int16_t) 0))
-		Pf = Get_Ind(Bindx, Scr[0], Scr[1], Scr[2]);
+		Pf = Get_Ind(WrkRate, Bindx, Scr[0], Scr[1], Scr[2]);
 
 	if ((Bindx == (int16_t) 0) && (Findx != (int16_t) 0))
-		Pf = Get_Ind(Findx, Scr[0], Scr[3], Scr[4]);
+		Pf = Get_Ind(WrkRate, Findx, Scr[0], Scr[3], Scr[4]);
 
 	if ((Bindx != (int16_t) 0) && (Findx != (int16_t) 0)) {
 		Exp = g723_mult_r(Scr[1], Scr[1]);
@@ -1634,9 +1789,9 @@ PFDEF Comp_Lpf(int16_t * Buff, int16_t Olp, int16_t Sfc)
 		Exp = g723_mult_r(Scr[3], Scr[3]);
 		Acc1 = L_g723_mult(Exp, Scr[2]);
 		if (Acc0 > Acc1)
-			Pf = Get_Ind(Bindx, Scr[0], Scr[1], Scr[2]);
+			Pf = Get_Ind(WrkRate, Bindx, Scr[0], Scr[1], Scr[2]);
 		else
-			Pf = Get_Ind(Findx, Scr[0], Scr[3], Scr[4]);
+			Pf = Get_Ind(WrkRate, Findx, Scr[0], Scr[3], Scr[4]);
 	}
 
 	return Pf;
@@ -1788,7 +1943,8 @@ int16_t Find_F(int16_t * Buff, int16_t Olp, int16_t Sfc)
 **         int16_t   ScGn    Pitch postfilter scaling gain
 **
 */
-PFDEF Get_Ind(int16_t Ind, int16_t Ten, int16_t Ccr, int16_t Enr)
+PFDEF Get_Ind(enum Crate WrkRate, int16_t Ind, int16_t Ten, int16_t Ccr,
+	int16_t Enr)
 {
 	int32_t Acc0, Acc1;
 	int16_t Exp;
@@ -1922,7 +2078,8 @@ void Filt_Lpf(int16_t * Tv, int16_t * Buff, PFDEF Pf, int16_t Sfc)
 **   int16_t index            Innovative codebook index
 **
 */
-int16_t ACELP_LBC_code(int16_t X[], int16_t h[], int16_t T0, int16_t code[],
+int16_t ACELP_LBC_code(int16_t * extra, int16_t X[], int16_t h[], int16_t T0,
+	int16_t code[],
 		      int16_t * ind_gain, int16_t * shift, int16_t * sign,
 		      int16_t gain_T0)
 {
@@ -1956,7 +2113,7 @@ int16_t ACELP_LBC_code(int16_t X[], int16_t h[], int16_t T0, int16_t code[],
 	 *    output filtered codeword
 	 */
 
-	index = D4i64_LBC(Dn, rr, h, tmp_code, rr, shift, sign);
+	index = D4i64_LBC(extra, Dn, rr, h, tmp_code, rr, shift, sign);
 
 	/*
 	 * Compute innovation vector gain.
@@ -2396,10 +2553,9 @@ void Cor_h_X(int16_t h[], int16_t X[], int16_t D[])
 **  Return value:           None
 **
 */
-static int16_t extra;
-void reset_max_time(void)
+void reset_max_time(int16_t * extra)
 {
-	extra = 120;
+	*extra = 120;
 	return;
 }
 
@@ -2445,7 +2601,8 @@ void reset_max_time(void)
 **      int16_t   Index of selected codevector
 **
 */
-int16_t D4i64_LBC(int16_t Dn[], int16_t rr[], int16_t h[], int16_t cod[],
+int16_t D4i64_LBC(int16_t * extra, int16_t Dn[], int16_t rr[], int16_t h[],
+	int16_t cod[],
 		 int16_t y[], int16_t * code_shift, int16_t * sign)
 {
 	int16_t i0, i1, i2, i3, ip0, ip1, ip2, ip3;
@@ -2654,7 +2811,7 @@ int16_t D4i64_LBC(int16_t Dn[], int16_t rr[], int16_t h[], int16_t cod[],
 	shif = 0;
 	psc = 0;
 	alpha = 32767;
-	time = g723_add(max_time, extra);
+	time = g723_add(max_time, *extra);
 
 	/* Four loops to search innovation code. */
 
@@ -2787,7 +2944,7 @@ int16_t D4i64_LBC(int16_t Dn[], int16_t rr[], int16_t h[], int16_t cod[],
 
  end_search:
 
-	extra = time;
+	*extra = time;
 
 	/* Set the sign of impulses */
 
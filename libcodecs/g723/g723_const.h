@@ -350,4 +350,23 @@ typedef struct {
 	int16_t SidGain;
 	int16_t RandSeed;
 } DECCNGDEF;
+
+/* Encoder instance */
+typedef struct g723_enc {
+	CODSTATDEF CodStat;
+	VADSTATDEF VadStat;
+	CODCNGDEF CodCng;
+	enum Crate WrkRate;
+	int UseHp;
+	int UseVx;
+	int16_t extra;
+} G723ENCDEF;
+
+/* Decoder instance */
+typedef struct g723_dec {
+	DECSTATDEF DecStat;
+	DECCNGDEF DecCng;
+	enum Crate WrkRate;
+	int UsePf;
+} G723DECDEF;
 #endif
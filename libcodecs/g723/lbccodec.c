@@ -34,70 +34,84 @@
 #include "g723_const.h"
 #include "lbccodec.h"
 
-extern void Init_Vad(void);
-extern void Init_Coder(void);
-extern void Init_Decod(void);
-extern void Init_Cod_Cng(void);
-extern void Init_Dec_Cng(void);
-extern int Coder(int16_t * DataBuff, char *Vout);
-extern int Decod(int16_t * DataBuff, char *Vinp, int16_t Crc);
-extern void reset_max_time(void);
-
-unsigned int before = 0;
-unsigned int temp;
-unsigned int max_diff[10];
-
-//end ------------------------------------add by haiping 2009-06-17
-/* Global variables */
-enum Wmode WrkMode = Both;
-enum Crate WrkRate = Rate63;
-
-int PackedFrameSize[2] = {
-	24,
-	20
-};
-
-int UseHp = True;
-int UsePf = True;
-int UseVx = False;
-int UsePr = True;
-
-void g723_i(int rate, int dtx)
+extern void Init_Vad(VADSTATDEF * VadStat);
+extern void Init_Coder(CODSTATDEF * CodStat);
+extern void Init_Decod(DECSTATDEF * DecStat);
+extern void Init_Cod_Cng(CODCNGDEF * CodCng);
+extern void Init_Dec_Cng(DECCNGDEF * DecCng);
+extern int Coder(G723ENCDEF * st, int16_t * DataBuff, char *Vout);
+extern int Decod(G723DECDEF * st, int16_t * DataBuff, char *Vinp,
+		 int16_t Crc);
+extern void reset_max_time(int16_t * extra);
+
+struct g723_enc *g723_enc_init(int rate, int dtx)
 {
+	G723ENCDEF *st;
+
+	st = (G723ENCDEF *) calloc(1, sizeof(G723ENCDEF));
+	if (!st)
+		return 0;
 
-	WrkMode = Both;
 	if (!rate)
-		WrkRate = Rate63;
+		st->WrkRate = Rate63;
 	else
-		WrkRate = Rate53;
+		st->WrkRate = Rate53;
+	st->UseHp = True;
 	if (dtx)
-		UseVx = True;
+		st->UseVx = True;
 	else
-		UseVx = False;
+		st->UseVx = False;
 
 	/*
-	   Init coder and the decoder
+	   Init coder
 	 */
-	Init_Coder();
-	Init_Decod();
+	Init_Coder(&st->CodStat);
 
 	/* Init Comfort Noise Functions */
-	if (UseVx) {
-		Init_Vad();
-		Init_Cod_Cng();
+	if (st->UseVx) {
+		Init_Vad(&st->VadStat);
+		Init_Cod_Cng(&st->CodCng);
 	}
-	Init_Dec_Cng();
 
+	return st;
+}
+
+void g723_enc_exit(struct g723_enc *st)
+{
+	free(st);
+}
+
+struct g723_dec *g723_dec_init(void)
+{
+	G723DECDEF *st;
+
+	st = (G723DECDEF *) calloc(1, sizeof(G723DECDEF));
+	if (!st)
+		return 0;
+
+	/* The decoder follows the rate of each received frame */
+	st->WrkRate = Rate63;
+	st->UsePf = True;
+
+	Init_Decod(&st->DecStat);
+	Init_Dec_Cng(&st->DecCng);
+
+	return st;
+}
+
+void g723_dec_exit(struct g723_dec *st)
+{
+	free(st);
 }
 
 //encode 240 short linear samples (30 mS) 
 //to 20/24 bytes or 4 bytes silency descriptor
 //return packet length: 24(Rate63), 20(Rate53), 4(Noise), 0(Iddle)
-int g723_e(short *sp, unsigned char *buf)
+int g723_e(struct g723_enc *st, short *sp, unsigned char *buf)
 {
-	if (WrkRate == Rate53)
-		reset_max_time();
-	Coder(sp, (char *)buf);
+	if (st->WrkRate == Rate53)
+		reset_max_time(&st->extra);
+	Coder(st, sp, (char *)buf);
 	//return (*buf)&3;
 
 	//type 0(Rate63), 1(Rate53), 2(Noise), 3(Iddle)
@@ -119,7 +133,7 @@ int g723_e(short *sp, unsigned char *buf)
 }
 
 //decode 20/24 bytes or 4 bytes silency to 240 short linear samples (30 mS)
-void g723_d(unsigned char *buf, short *sp)
+void g723_d(struct g723_dec *st, unsigned char *buf, short *sp)
 {
-	Decod(sp, (char *)buf, (int16_t) 0);
+	Decod(st, sp, (char *)buf, (int16_t) 0);
 }
@@ -17,14 +17,23 @@
     Universite de Sherbrooke.  All rights reserved.
 */
 
-//init codec: rate: 0-Rate63, 1-Rate53
+struct g723_enc;
+struct g723_dec;
+
+//create encoder: rate: 0-Rate63, 1-Rate53
 //dtx 1-enable (produce 4 bytes frames of silency)
-void g723_i(int rate, int dtx);
+//return 0 on allocation failure
+struct g723_enc *g723_enc_init(int rate, int dtx);
+void g723_enc_exit(struct g723_enc *st);
 
 //encode 240 short linear samples (30 mS) 
 //to 20/24 bytes or 4 bytes silency
-//return 0(Rate63), 1(Rate53), 2(Silency), 3(Error)
-int g723_e(short *sp, unsigned char *buf);
+//return packet length: 24(Rate63), 20(Rate53), 4(Noise), 0(Iddle)
+int g723_e(struct g723_enc *st, short *sp, unsigned char *buf);
+
+//create decoder, return 0 on allocation failure
+struct g723_dec *g723_dec_init(void);
+void g723_dec_exit(struct g723_dec *st);
 
 //decode 20/24 bytes or 4 bytes silency to 240 short linear samples (30 mS)
-void g723_d(unsigned char *buf, short *sp);
+void g723_d(struct g723_dec *st, unsigned char *buf, short *sp);
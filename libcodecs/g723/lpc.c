@@ -45,42 +45,21 @@
 #include <stdio.h>
 
 #include "g723_const.h"
+#include "basop.h"
 #include "lbccodec.h"
 
 extern int16_t PerFiltZeroTable[LpcOrder];
 extern int16_t PerFiltPoleTable[LpcOrder];
-extern CODSTATDEF CodStat;
-extern DECSTATDEF DecStat;
 extern int16_t PostFiltZeroTable[LpcOrder];
 extern int16_t PostFiltPoleTable[LpcOrder];
 extern int16_t HammingWindowTable[LpcFrame];
 extern int16_t BinomialWindowTable[LpcOrder];
-extern int UsePf;
 
 extern int16_t Vec_Norm(int16_t * Vect, int16_t Len);
-extern int16_t g723_mult_r(int16_t var1, int16_t var2);	/* Mult with round,     2 */
-extern int32_t L_g723_mult(int16_t var1, int16_t var2);	/* Long mult,           1 */
-extern int32_t L_g723_shr(int32_t L_var1, int16_t var2);	/* Long shift right,    2 */
-extern int32_t L_g723_add(int32_t L_var1, int32_t L_var2);	/* Long add,        2 */
-extern int16_t g723_norm_l(int32_t L_var1);	/* Long norm,            30 */
-extern int32_t L_g723_shl(int32_t L_var1, int16_t var2);	/* Long shift left,     2 */
-extern int16_t round_(int32_t L_var1);	/* Round,               1 */
-extern int32_t L_mls(int32_t, int16_t);	/* Wght ?? */
-extern int16_t g723_add(int16_t var1, int16_t var2);	/* Short add,           1 */
-extern int16_t g723_shl(int16_t var1, int16_t var2);	/* Short shift left,    1 */
 
 int16_t Durbin(int16_t * Lpc, int16_t * Corr, int16_t Err, int16_t * Pk2);
-extern void Update_Acf(int16_t * Acfsf, int16_t * Shsf);
-
-extern int32_t g723_L_deposit_h(int16_t var1);	/* 16 bit var1 -> MSB,     2 */
-extern int32_t g723_L_msu(int32_t L_var3, int16_t var1, int16_t var2);	/* Msu,    1 */
-extern int32_t g723_L_abs(int32_t L_var1);	/* Long abs,              3 */
-extern int16_t div_l(int32_t, int16_t);
-extern int16_t g723_negate(int16_t var1);	/* Short negate,        1 */
-extern int32_t g723_L_mac(int32_t L_var3, int16_t var1, int16_t var2);	/* Mac,    1 */
-extern int16_t g723_sub(int16_t var1, int16_t var2);	/* Short sub,           1 */
-extern int16_t g723_extract_h(int32_t L_var1);	/* Extract high,        1 */
-extern int16_t g723_mult(int16_t var1, int16_t var2);	/* Short mult,          1 */
+extern void Update_Acf(CODCNGDEF * CodCng, int16_t * Acfsf, int16_t * Shsf);
+
 /*
 **
 ** Function:        Comp_Lpc()
@@ -111,7 +90,8 @@ extern int16_t g723_mult(int16_t var1, int16_t var2);	/* Short mult,          1
 ** Return value:    None
 **
 */
-void Comp_Lpc(int16_t * UnqLpc, int16_t * PrevDat, int16_t * DataBuff)
+void Comp_Lpc(CODSTATDEF * CodStat, CODCNGDEF * CodCng, int16_t * UnqLpc,
+	int16_t * PrevDat, int16_t * DataBuff)
 {
 	int i, j, k;
 
@@ -206,27 +186,27 @@ void Comp_Lpc(int16_t * UnqLpc, int16_t * PrevDat, int16_t * DataBuff)
 		 * coefficients
 		 */
 		Durbin(&UnqLpc[k * LpcOrder], &curAcf[1], curAcf[0], &Pk2);
-		CodStat.SinDet <<= 1;
+		CodStat->SinDet <<= 1;
 		if (Pk2 > 0x799a) {
-			CodStat.SinDet++;
+			CodStat->SinDet++;
 		}
 		curAcf += LpcOrderP1;
 	}
 
 	/* Update sine detector */
-	CodStat.SinDet &= 0x7fff;
+	CodStat->SinDet &= 0x7fff;
 
-	j = CodStat.SinDet;
+	j = CodStat->SinDet;
 	k = 0;
 	for (i = 0; i < 15; i++) {
 		k += j & 1;
 		j >>= 1;
 	}
 	if (k >= 14)
-		CodStat.SinDet |= 0x8000;
+		CodStat->SinDet |= 0x8000;
 
 	/* Update CNG Acf memories */
-	Update_Acf(Acf_sf, ShAcf_sf);
+	Update_Acf(CodCng, Acf_sf, ShAcf_sf);
 
 }
 
@@ -421,7 +401,7 @@ void Wght_Lpc(int16_t * PerLpc, int16_t * UnqLpc)
 ** Return value:    None
 **
 */
-void Error_Wght(int16_t * Dpnt, int16_t * PerLpc)
+void Error_Wght(CODSTATDEF * CodStat, int16_t * Dpnt, int16_t * PerLpc)
 {
 	int i, j, k;
 
@@ -442,12 +422,12 @@ void Error_Wght(int16_t * Dpnt, int16_t * PerLpc)
 			for (j = 0; j < LpcOrder; j++)
 				Acc0 =
 				    g723_L_msu(Acc0, PerLpc[j],
-					       CodStat.WghtFirDl[j]);
+					       CodStat->WghtFirDl[j]);
 
 			/* Update memory */
 			for (j = LpcOrder - 1; j > 0; j--)
-				CodStat.WghtFirDl[j] = CodStat.WghtFirDl[j - 1];
-			CodStat.WghtFirDl[0] = *Dpnt;
+				CodStat->WghtFirDl[j] = CodStat->WghtFirDl[j - 1];
+			CodStat->WghtFirDl[0] = *Dpnt;
 
 			/*
 			 * Do the IIR part
@@ -456,14 +436,14 @@ void Error_Wght(int16_t * Dpnt, int16_t * PerLpc)
 			/* Filter */
 			for (j = 0; j < LpcOrder; j++)
 				Acc0 = g723_L_mac(Acc0, PerLpc[LpcOrder + j],
-						  CodStat.WghtIirDl[j]);
+						  CodStat->WghtIirDl[j]);
 			for (j = LpcOrder - 1; j > 0; j--)
-				CodStat.WghtIirDl[j] = CodStat.WghtIirDl[j - 1];
+				CodStat->WghtIirDl[j] = CodStat->WghtIirDl[j - 1];
 			Acc0 = L_g723_shl(Acc0, (int16_t) 2);
 
 			/* Update memory */
-			CodStat.WghtIirDl[0] = round_(Acc0);
-			*Dpnt++ = CodStat.WghtIirDl[0];
+			CodStat->WghtIirDl[0] = round_(Acc0);
+			*Dpnt++ = CodStat->WghtIirDl[0];
 		}
 		PerLpc += 2 * LpcOrder;
 	}
@@ -604,7 +584,8 @@ void Comp_Ir(int16_t * ImpResp, int16_t * QntLpc, int16_t * PerLpc,
 ** Return value:    None
 **
 */
-void Sub_Ring(int16_t * Dpnt, int16_t * QntLpc, int16_t * PerLpc, int16_t
+void Sub_Ring(CODSTATDEF * CodStat, int16_t * Dpnt, int16_t * QntLpc,
+	int16_t * PerLpc, int16_t
 	      * PrevErr, PWDEF Pw)
 {
 	int i, j;
@@ -621,8 +602,8 @@ void Sub_Ring(int16_t * Dpnt, int16_t * QntLpc, int16_t * PerLpc, int16_t
 		Temp[i] = PrevErr[i];
 
 	for (i = 0; i < LpcOrder; i++) {
-		FirDl[i] = CodStat.RingFirDl[i];
-		IirDl[i] = CodStat.RingIirDl[i];
+		FirDl[i] = CodStat->RingFirDl[i];
+		IirDl[i] = CodStat->RingIirDl[i];
 	}
 
 	/*
@@ -712,7 +693,8 @@ void Sub_Ring(int16_t * Dpnt, int16_t * QntLpc, int16_t * PerLpc, int16_t
 ** Return value:    None
 **
 */
-void Upd_Ring(int16_t * Dpnt, int16_t * QntLpc, int16_t * PerLpc,
+void Upd_Ring(CODSTATDEF * CodStat, int16_t * Dpnt, int16_t * QntLpc,
+	int16_t * PerLpc,
 	      int16_t * PrevErr)
 {
 	int i, j;
@@ -741,7 +723,7 @@ void Upd_Ring(int16_t * Dpnt, int16_t * QntLpc, int16_t * PerLpc,
 		 */
 		for (j = 0; j < LpcOrder; j++)
 			Acc0 =
-			    g723_L_mac(Acc0, QntLpc[j], CodStat.RingFirDl[j]);
+			    g723_L_mac(Acc0, QntLpc[j], CodStat->RingFirDl[j]);
 		Acc1 = L_g723_shl(Acc0, (int16_t) 2);
 
 		Dpnt[i] = g723_shl(round_(Acc1), (int16_t) 1);
@@ -753,27 +735,27 @@ void Upd_Ring(int16_t * Dpnt, int16_t * QntLpc, int16_t * PerLpc,
 		/* FIR part */
 		for (j = 0; j < LpcOrder; j++)
 			Acc0 =
-			    g723_L_msu(Acc0, PerLpc[j], CodStat.RingFirDl[j]);
+			    g723_L_msu(Acc0, PerLpc[j], CodStat->RingFirDl[j]);
 
 		/* Update FIR memory */
 		for (j = LpcOrder - 1; j > 0; j--)
-			CodStat.RingFirDl[j] = CodStat.RingFirDl[j - 1];
-		CodStat.RingFirDl[0] = round_(Acc1);
+			CodStat->RingFirDl[j] = CodStat->RingFirDl[j - 1];
+		CodStat->RingFirDl[0] = round_(Acc1);
 
 		/* IIR part */
 		for (j = 0; j < LpcOrder; j++)
 			Acc0 =
 			    g723_L_mac(Acc0, PerLpc[LpcOrder + j],
-				       CodStat.RingIirDl[j]);
+				       CodStat->RingIirDl[j]);
 		Acc0 = L_g723_shl(Acc0, (int16_t) 2);
 
 		/* Update IIR memory */
 		for (j = LpcOrder - 1; j > 0; j--)
-			CodStat.RingIirDl[j] = CodStat.RingIirDl[j - 1];
-		CodStat.RingIirDl[0] = round_(Acc0);
+			CodStat->RingIirDl[j] = CodStat->RingIirDl[j - 1];
+		CodStat->RingIirDl[0] = round_(Acc0);
 
 		/* Update harmonic noise shaping memory */
-		PrevErr[PitchMax - SubFrLen + i] = CodStat.RingIirDl[0];
+		PrevErr[PitchMax - SubFrLen + i] = CodStat->RingIirDl[0];
 	}
 }
 
@@ -805,7 +787,7 @@ subframe (10 words)
 ** Return value:    None
 **
 */
-void Synt(int16_t * Dpnt, int16_t * Lpc)
+void Synt(DECSTATDEF * DecStat, int UsePf, int16_t * Dpnt, int16_t * Lpc)
 {
 	int i, j;
 
@@ -828,24 +810,24 @@ void Synt(int16_t * Dpnt, int16_t * Lpc)
 
 		/* Filter */
 		for (j = 0; j < LpcOrder; j++)
-			Acc0 = g723_L_mac(Acc0, Lpc[j], DecStat.SyntIirDl[j]);
+			Acc0 = g723_L_mac(Acc0, Lpc[j], DecStat->SyntIirDl[j]);
 
 		/* Update memory */
 		for (j = LpcOrder - 1; j > 0; j--)
-			DecStat.SyntIirDl[j] = DecStat.SyntIirDl[j - 1];
+			DecStat->SyntIirDl[j] = DecStat->SyntIirDl[j - 1];
 
 		Acc0 = L_g723_shl(Acc0, (int16_t) 2);
 
-		DecStat.SyntIirDl[0] = round_(Acc0);
+		DecStat->SyntIirDl[0] = round_(Acc0);
 
 		/*
 		 * Scale output if postfilter is off.  (Otherwise output is
 		 * scaled by the gain scaling unit.)
 		 */
 		if (UsePf)
-			Dpnt[i] = DecStat.SyntIirDl[0];
+			Dpnt[i] = DecStat->SyntIirDl[0];
 		else
-			Dpnt[i] = g723_shl(DecStat.SyntIirDl[0], (int16_t) 1);
+			Dpnt[i] = g723_shl(DecStat->SyntIirDl[0], (int16_t) 1);
 
 	}
 
@@ -885,7 +867,7 @@ subframe (10 words)
 ** Return value: Input vector energy
 **
 */
-int32_t Spf(int16_t * Tv, int16_t * Lpc)
+int32_t Spf(DECSTATDEF * DecStat, int16_t * Tv, int16_t * Lpc)
 {
 	int i, j;
 
@@ -955,12 +937,12 @@ int32_t Spf(int16_t * Tv, int16_t * Lpc)
 	/*
 	 * Compute the compensation filter parameter and update the memory
 	 */
-	Acc0 = g723_L_deposit_h(DecStat.Park);
-	Acc0 = g723_L_msu(Acc0, DecStat.Park, (int16_t) 0x2000);
+	Acc0 = g723_L_deposit_h(DecStat->Park);
+	Acc0 = g723_L_msu(Acc0, DecStat->Park, (int16_t) 0x2000);
 	Acc0 = g723_L_mac(Acc0, Tmp, (int16_t) 0x2000);
-	DecStat.Park = round_(Acc0);
+	DecStat->Park = round_(Acc0);
 
-	Tmp = g723_mult(DecStat.Park, PreCoef);
+	Tmp = g723_mult(DecStat->Park, PreCoef);
 	Tmp &= (int16_t) 0xfffc;
 
 	/*
@@ -981,31 +963,31 @@ int32_t Spf(int16_t * Tv, int16_t * Lpc)
 		/* FIR part */
 		for (j = 0; j < LpcOrder; j++)
 			Acc0 =
-			    g723_L_msu(Acc0, FirCoef[j], DecStat.PostFirDl[j]);
+			    g723_L_msu(Acc0, FirCoef[j], DecStat->PostFirDl[j]);
 
 		/* Update FIR memory */
 		for (j = LpcOrder - 1; j > 0; j--)
-			DecStat.PostFirDl[j] = DecStat.PostFirDl[j - 1];
-		DecStat.PostFirDl[0] = Tv[i];
+			DecStat->PostFirDl[j] = DecStat->PostFirDl[j - 1];
+		DecStat->PostFirDl[0] = Tv[i];
 
 		/* IIR part */
 		for (j = 0; j < LpcOrder; j++)
 			Acc0 =
-			    g723_L_mac(Acc0, IirCoef[j], DecStat.PostIirDl[j]);
+			    g723_L_mac(Acc0, IirCoef[j], DecStat->PostIirDl[j]);
 
 		/* Update IIR memory */
 		for (j = LpcOrder - 1; j > 0; j--)
-			DecStat.PostIirDl[j] = DecStat.PostIirDl[j - 1];
+			DecStat->PostIirDl[j] = DecStat->PostIirDl[j - 1];
 
 		Acc0 = L_g723_shl(Acc0, (int16_t) 2);
 		Acc1 = Acc0;
 
-		DecStat.PostIirDl[0] = round_(Acc0);
+		DecStat->PostIirDl[0] = round_(Acc0);
 
 		/*
 		 * Compensation filter
 		 */
-		Acc1 = g723_L_mac(Acc1, DecStat.PostIirDl[1], Tmp);
+		Acc1 = g723_L_mac(Acc1, DecStat->PostIirDl[1], Tmp);
 
 		Tv[i] = round_(Acc1);
 	}
@@ -55,6 +55,7 @@
 #include <ophtools.h>
 
 #include "g723_const.h"
+#include "basop.h"
 
 extern int16_t *BandQntTable[LspQntBands];
 extern int16_t BandInfoTable[LspQntBands][2];
@@ -62,38 +63,10 @@ extern int16_t LspDcTable[LpcOrder];
 extern int16_t CosineTable[CosineTableSize];
 extern int16_t BandExpTable[LpcOrder];
 
-#define MIN_16 (int16_t)0x8000
-#define MAX_16 (int16_t)0x7fff
 #define  CosineTableSize   512
 
-extern int16_t g723_mult_r(int16_t var1, int16_t var2);	/* Mult with round,     2 */
-extern int16_t round_(int32_t L_var1);	/* Round,               1 */
-extern int32_t L_mls(int32_t, int16_t);	/* Wght ?? */
-extern int32_t L_g723_mult(int16_t var1, int16_t var2);	/* Long mult,           1 */
-extern int16_t g723_negate(int16_t var1);	/* Short negate,        1 */
-extern int32_t L_g723_negate(int32_t L_var1);	/* Long negate,     2 */
 extern void LsptoA(int16_t * Lsp);
-extern int16_t g723_shr(int16_t var1, int16_t var2);	/* Short shift right,   1 */
-extern int32_t L_g723_shr(int32_t L_var1, int16_t var2);	/* Long shift right,    2 */
-extern int16_t g723_shl(int16_t var1, int16_t var2);	/* Short shift left,    1 */
-extern int32_t L_g723_shl(int32_t L_var1, int16_t var2);	/* Long shift left,     2 */
-extern int16_t g723_add(int16_t var1, int16_t var2);	/* Short add,           1 */
-extern int32_t L_g723_add(int32_t L_var1, int32_t L_var2);	/* Long add,        2 */
-extern int16_t g723_sub(int16_t var1, int16_t var2);	/* Short sub,           1 */
-extern int32_t L_g723_sub(int32_t L_var1, int32_t L_var2);	/* Long sub,        2 */
-extern int16_t div_s(int16_t var1, int16_t var2);	/* Short division,       18 */
 extern int32_t Lsp_Svq(int16_t * Tv, int16_t * Wvect);
-extern int32_t g723_L_msu(int32_t L_var3, int16_t var1, int16_t var2);	/* Msu,    1 */
-extern int16_t g723_extract_h(int32_t L_var1);	/* Extract high,        1 */
-extern int16_t div_l(int32_t, int16_t);
-extern int32_t g723_L_mac(int32_t L_var3, int16_t var1, int16_t var2);	/* Mac,    1 */
-extern int32_t g723_L_deposit_h(int16_t var1);	/* 16 bit var1 -> MSB,     2 */
-//extern int32_t L_g723_sub(int32_t L_var1, int32_t L_var2);   /* Long sub,        2 */
-extern int32_t g723_L_abs(int32_t L_var1);	/* Long abs,              3 */
-extern int16_t g723_norm_l(int32_t L_var1);	/* Long norm,            30 */
-//extern int32_t L_g723_shl(int32_t L_var1, int16_t var2); /* Long shift left,     2 */
-//extern int32_t g723_L_mac(int32_t L_var3, int16_t var1, int16_t var2); /* Mac,    1 */
-extern int16_t g723_norm_s(int16_t var1);	/* Short norm,           15 */
 
 /*
 **
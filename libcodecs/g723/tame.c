@@ -29,30 +29,13 @@
 
 #include "lbccodec.h"
 #include "g723_const.h"
+#include "basop.h"
 
-extern int UseHp;
-extern int UsePf;
-extern int UseVx;
-extern enum Wmode WrkMode;
-extern enum Crate WrkRate;
 extern int16_t tabgain85[85];
 extern int16_t tabgain170[170];
-extern CODSTATDEF CodStat;
-
-extern int32_t L_mls(int32_t, int16_t);	/* Wght ?? */
-extern int32_t L_g723_add(int32_t L_var1, int32_t L_var2);	/* Long add,        2 */
-extern int16_t g723_mult(int16_t var1, int16_t var2);	/* Short mult,          1 */
-extern int16_t g723_add(int16_t var1, int16_t var2);	/* Short add,           1 */
-extern int16_t g723_sub(int16_t var1, int16_t var2);	/* Short sub,           1 */
 
 #define NbPulsBlk          11	/* Nb of pulses in 2-subframes blocks         */
 
-extern int16_t g723_shl(int16_t var1, int16_t var2);	/* Short shift left,    1 */
-extern int32_t L_g723_shl(int32_t L_var1, int16_t var2);	/* Long shift left,     2 */
-extern int32_t L_g723_sub(int32_t L_var1, int32_t L_var2);	/* Long sub,        2 */
-extern int32_t L_g723_negate(int32_t L_var1);	/* Long negate,     2 */
-extern int32_t L_g723_shr(int32_t L_var1, int16_t var2);	/* Long shift right,    2 */
-extern int16_t g723_extract_l(int32_t L_var1);	/* Extract low,         1 */
 /*
 **
 ** Function:        Update_Err()
@@ -78,7 +61,8 @@ extern int16_t g723_extract_l(int32_t L_var1);	/* Extract low,         1 */
 **
 */
 
-void Update_Err(int16_t Olp, int16_t AcLg, int16_t AcGn)
+void Update_Err(CODSTATDEF * CodStat, enum Crate WrkRate, int16_t Olp,
+	int16_t AcLg, int16_t AcGn)
 {
 	int16_t *ptr_tab;
 	int16_t i, iz, temp1, temp2;
@@ -99,7 +83,7 @@ void Update_Err(int16_t Olp, int16_t AcLg, int16_t AcGn)
 	beta = ptr_tab[(int)AcGn];	/* beta = gain * 8192 */
 
 	if (Lag <= (SubFrLen / 2)) {
-		Worst0 = L_mls(CodStat.Err[0], beta);
+		Worst0 = L_mls(CodStat->Err[0], beta);
 		Worst0 = L_g723_shl(Worst0, 2);
 		Worst0 = L_g723_add(Err0, Worst0);
 		Worst1 = Worst0;
@@ -112,10 +96,10 @@ void Update_Err(int16_t Olp, int16_t AcLg, int16_t AcGn)
 		if (temp2 != Lag) {
 
 			if (iz == 1) {
-				Worst0 = L_mls(CodStat.Err[0], beta);
+				Worst0 = L_mls(CodStat->Err[0], beta);
 				Worst0 = L_g723_shl(Worst0, 2);
 				Worst0 = L_g723_add(Err0, Worst0);
-				Worst1 = L_mls(CodStat.Err[1], beta);
+				Worst1 = L_mls(CodStat->Err[1], beta);
 				Worst1 = L_g723_shl(Worst1, 2);
 				Worst1 = L_g723_add(Err0, Worst1);
 				if (Worst0 > Worst1)
@@ -125,35 +109,35 @@ void Update_Err(int16_t Olp, int16_t AcLg, int16_t AcGn)
 			}
 
 			else {
-				Worst0 = L_mls(CodStat.Err[iz - 2], beta);
+				Worst0 = L_mls(CodStat->Err[iz - 2], beta);
 				Worst0 = L_g723_shl(Worst0, 2);
 				Worst0 = L_g723_add(Err0, Worst0);
-				L_temp = L_mls(CodStat.Err[iz - 1], beta);
+				L_temp = L_mls(CodStat->Err[iz - 1], beta);
 				L_temp = L_g723_shl(L_temp, 2);
 				L_temp = L_g723_add(Err0, L_temp);
 				if (L_temp > Worst0)
 					Worst0 = L_temp;
-				Worst1 = L_mls(CodStat.Err[iz], beta);
+				Worst1 = L_mls(CodStat->Err[iz], beta);
 				Worst1 = L_g723_shl(Worst1, 2);
 				Worst1 = L_g723_add(Err0, Worst1);
 				if (L_temp > Worst1)
 					Worst1 = L_temp;
 			}
 		} else {	/* Lag % SubFrLen = 0 */
-			Worst0 = L_mls(CodStat.Err[iz - 1], beta);
+			Worst0 = L_mls(CodStat->Err[iz - 1], beta);
 			Worst0 = L_g723_shl(Worst0, 2);
 			Worst0 = L_g723_add(Err0, Worst0);
-			Worst1 = L_mls(CodStat.Err[iz], beta);
+			Worst1 = L_mls(CodStat->Err[iz], beta);
 			Worst1 = L_g723_shl(Worst1, 2);
 			Worst1 = L_g723_add(Err0, Worst1);
 		}
 	}
 
 	for (i = 4; i >= 2; i--) {
-		CodStat.Err[i] = CodStat.Err[i - 2];
+		CodStat->Err[i] = CodStat->Err[i - 2];
 	}
-	CodStat.Err[0] = Worst0;
-	CodStat.Err[1] = Worst1;
+	CodStat->Err[0] = Worst0;
+	CodStat->Err[1] = Worst1;
 
 	return;
 }
@@ -184,7 +168,7 @@ void Update_Err(int16_t Olp, int16_t AcLg, int16_t AcGn)
 **  int16_t          index iTest used to compute Acbk number of filters
 */
 
-int16_t Test_Err(int16_t Lag1, int16_t Lag2)
+int16_t Test_Err(CODSTATDEF * CodStat, int16_t Lag1, int16_t Lag2)
 {
 
 	int i, i1, i2;
@@ -202,13 +186,13 @@ int16_t Test_Err(int16_t Lag1, int16_t Lag2)
 
 	Err_max = -1L;
 	for (i = zone2; i >= zone1; i--) {
-		Acc = L_g723_sub(CodStat.Err[i], Err_max);
+		Acc = L_g723_sub(CodStat->Err[i], Err_max);
 		if (Acc > 0L) {
-			Err_max = CodStat.Err[i];
+			Err_max = CodStat->Err[i];
 		}
 	}
 	Acc = L_g723_sub(Err_max, ThreshErr);
-	if ((Acc > 0L) || (CodStat.SinDet < 0)) {
+	if ((Acc > 0L) || (CodStat->SinDet < 0)) {
 		iTest = 0;
 	} else {
 		Acc = L_g723_negate(Acc);
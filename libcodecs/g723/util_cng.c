@@ -32,6 +32,7 @@
 #include <stdlib.h>
 
 #include "g723_const.h"
+#include "basop.h"
 
 extern int16_t base[3];
 extern int16_t nfact[4];
@@ -39,34 +40,13 @@ extern int16_t Nb_puls[4];
 
 extern int32_t L_bseg[3];
 
-extern int16_t g723_shr(int16_t var1, int16_t var2);	/* Short shift right,   1 */
-extern int16_t g723_add(int16_t var1, int16_t var2);	/* Short add,           1 */
-extern int16_t g723_shl(int16_t var1, int16_t var2);	/* Short shift left,    1 */
-extern int16_t g723_sub(int16_t var1, int16_t var2);	/* Short sub,           1 */
-
-extern void Decod_Acbk(int16_t * Tv, int16_t * PrevExc, int16_t Olp,
+extern void Decod_Acbk(enum Crate WrkRate, int16_t * Tv, int16_t * PrevExc,
+	int16_t Olp,
 		       int16_t Lid,
 		       int16_t Gid);
 
-extern int16_t g723_abs_s(int16_t var1);	/* Short abs,           1 */
-extern int16_t g723_norm_s(int16_t var1);	/* Short norm,           15 */
-extern int32_t g723_L_mac(int32_t L_var3, int16_t var1, int16_t var2);	/* Mac,    1 */
-extern int16_t g723_extract_h(int32_t L_var1);	/* Extract high,        1 */
-extern int32_t L_g723_shl(int32_t L_var1, int16_t var2);	/* Long shift left,     2 */
-extern int32_t L_g723_mult(int16_t var1, int16_t var2);	/* Long mult,           1 */
-extern int32_t L_g723_shr(int32_t L_var1, int16_t var2);	/* Long shift right,    2 */
-extern int16_t g723_extract_l(int32_t L_var1);	/* Extract low,         1 */
-extern int32_t L_g723_sub(int32_t L_var1, int32_t L_var2);	/* Long sub,        2 */
-extern int32_t L_mls(int32_t, int16_t);	/* Wght ?? */
-extern int32_t g723_L_msu(int32_t L_var3, int16_t var1, int16_t var2);	/* Msu,    1 */
-extern int32_t L_g723_negate(int32_t L_var1);	/* Long negate,     2 */
-extern int16_t g723_negate(int16_t var1);	/* Short negate,        1 */
 extern int16_t Sqrt_lbc(int32_t Num);
-extern int16_t g723_mult(int16_t var1, int16_t var2);	/* Short mult,          1 */
 extern int16_t Rand_lbc(int16_t * p);
-extern int32_t g723_L_deposit_l(int16_t var1);	/* 16 bit var1 -> LSB,     2 */
-extern int32_t L_g723_add(int32_t L_var1, int32_t L_var2);	/* Long add,        2 */
-extern int16_t g723_mult_r(int16_t var1, int16_t var2);
 
 /* Declaration of local functions */
 static int16_t random_number(int16_t number_max_p1, int16_t * nRandom);
@@ -98,7 +78,8 @@ static int16_t random_number(int16_t number_max_p1, int16_t * nRandom);
 ** Return value:       None
 **
 */
-void Calc_Exc_Rand(int16_t curGain, int16_t * PrevExc, int16_t * DataExc,
+void Calc_Exc_Rand(enum Crate WrkRate, int16_t curGain, int16_t * PrevExc,
+	int16_t * DataExc,
 		   int16_t * nRandom, LINEDEF * Line)
 {
 	int i, i_subfr, iblk;
@@ -177,9 +158,9 @@ void Calc_Exc_Rand(int16_t curGain, int16_t * PrevExc, int16_t * DataExc,
 	for (iblk = 0; iblk < SubFrames / 2; iblk++) {
 
 		/* decode LTP only */
-		Decod_Acbk(curExc, &PrevExc[0], Line->Olp[iblk],
+		Decod_Acbk(WrkRate, curExc, &PrevExc[0], Line->Olp[iblk],
 			   Line->Sfs[i_subfr].AcLg, Line->Sfs[i_subfr].AcGn);
-		Decod_Acbk(&curExc[SubFrLen], &PrevExc[SubFrLen],
+		Decod_Acbk(WrkRate, &curExc[SubFrLen], &PrevExc[SubFrLen],
 			   Line->Olp[iblk], Line->Sfs[i_subfr + 1].AcLg,
 			   Line->Sfs[i_subfr + 1].AcGn);
 
@@ -46,36 +46,13 @@
 #include <stdio.h>
 
 #include "g723_const.h"
-extern int UseHp;
-extern CODSTATDEF CodStat;
-extern DECSTATDEF DecStat;
-extern enum Crate WrkRate;
+#include "basop.h"
 
-extern void Line_Pack(LINEDEF * Line, char *Vout, int16_t Ftyp);
+extern void Line_Pack(enum Crate WrkRate, LINEDEF * Line, char *Vout,
+	int16_t Ftyp);
 extern int32_t Ser2Par(int16_t ** Pnt, int Count);
-extern int16_t g723_add(int16_t var1, int16_t var2);	/* Short add,           1 */
-
-extern int32_t L_g723_mult(int16_t var1, int16_t var2);	/* Long mult,           1 */
-extern int32_t g723_L_mac(int32_t L_var3, int16_t var1, int16_t var2);	/* Mac,    1 */
-extern int32_t L_mls(int32_t, int16_t);	/* Wght ?? */
-extern int32_t L_g723_add(int32_t L_var1, int32_t L_var2);	/* Long add,        2 */
-extern int16_t round_(int32_t L_var1);	/* Round,               1 */
-extern int16_t g723_mult_r(int16_t var1, int16_t var2);	/* Mult with round,     2 */
-extern int16_t g723_shr(int16_t var1, int16_t var2);	/* Short shift right,   1 */
-extern int32_t L_g723_shr(int32_t L_var1, int16_t var2);	/* Long shift right,    2 */
-extern int16_t g723_abs_s(int16_t var1);	/* Short abs,           1 */
-extern int16_t g723_norm_s(int16_t var1);	/* Short norm,           15 */
-//extern int32_t L_g723_shr(int32_t L_var1, int16_t var2); /* Long shift right,    2 */
-extern int16_t g723_extract_l(int32_t L_var1);	/* Extract low,         1 */
-extern int16_t g723_sub(int16_t var1, int16_t var2);	/* Short sub,           1 */
+
 extern int16_t *Par2Ser(int32_t Inp, int16_t * Pnt, int BitNum);
-extern int16_t g723_norm_l(int32_t L_var1);	/* Long norm,            30 */
-extern int32_t L_g723_shl(int32_t L_var1, int16_t var2);	/* Long shift left,     2 */
-extern int16_t g723_extract_h(int32_t L_var1);	/* Extract high,        1 */
-extern int16_t div_l(int32_t, int16_t);
-extern int32_t g723_L_deposit_h(int16_t var1);	/* 16 bit var1 -> MSB,     2 */
-extern int32_t g723_L_msu(int32_t L_var3, int16_t var1, int16_t var2);	/* Msu,    1 */
-extern int32_t g723_L_deposit_l(int16_t var1);	/* 16 bit var1 -> LSB,     2 */
 /*
 **
 ** Function:        Rem_Dc()
@@ -100,7 +77,7 @@ extern int32_t g723_L_deposit_l(int16_t var1);	/* 16 bit var1 -> LSB,     2 */
 ** Return value:    None
 **
 */
-void Rem_Dc(int16_t * Dpnt)
+void Rem_Dc(CODSTATDEF * CodStat, int UseHp, int16_t * Dpnt)
 {
 	int i;
 
@@ -112,13 +89,13 @@ void Rem_Dc(int16_t * Dpnt)
 			/* Do the Fir and scale by 2 */
 			Acc0 = L_g723_mult(Dpnt[i], (int16_t) 0x4000);
 			Acc0 =
-			    g723_L_mac(Acc0, CodStat.HpfZdl, (int16_t) 0xc000);
-			CodStat.HpfZdl = Dpnt[i];
+			    g723_L_mac(Acc0, CodStat->HpfZdl, (int16_t) 0xc000);
+			CodStat->HpfZdl = Dpnt[i];
 
 			/* Do the Iir part */
-			Acc1 = L_mls(CodStat.HpfPdl, (int16_t) 0x7f00);
+			Acc1 = L_mls(CodStat->HpfPdl, (int16_t) 0x7f00);
 			Acc0 = L_g723_add(Acc0, Acc1);
-			CodStat.HpfPdl = Acc0;
+			CodStat->HpfPdl = Acc0;
 			Dpnt[i] = round_(Acc0);
 		}
 	} else {
@@ -265,7 +242,7 @@ void Mem_Shift(int16_t * PrevDat, int16_t * DataBuff)
 ** Return value:    None
 **
 */
-void Line_Pack(LINEDEF * Line, char *Vout, int16_t Ftyp)
+void Line_Pack(enum Crate WrkRate, LINEDEF * Line, char *Vout, int16_t Ftyp)
 {
 	int i;
 	int BitCount;
@@ -481,7 +458,7 @@ int16_t *Par2Ser(int32_t Inp, int16_t * Pnt, int BitNum)
 **     SFSDEF   Sfs[SubFrames]
 **
 */
-LINEDEF Line_Unpk(char *Vinp, int16_t * Ftyp, int16_t Crc)
+LINEDEF Line_Unpk(enum Crate * WrkRate, char *Vinp, int16_t * Ftyp, int16_t Crc)
 {
 	int i;
 	int16_t BitStream[192];
@@ -527,7 +504,7 @@ LINEDEF Line_Unpk(char *Vinp, int16_t * Ftyp, int16_t Crc)
 	*Ftyp = 1;
 
 	/* Decode the bit-rate */
-	WrkRate = (Info == 0) ? Rate63 : Rate53;
+	*WrkRate = (Info == 0) ? Rate63 : Rate53;
 
 	/* Decode the adaptive codebook lags */
 	Temp = Ser2Par(&Bsp, 7);
@@ -566,7 +543,7 @@ LINEDEF Line_Unpk(char *Vinp, int16_t * Ftyp, int16_t Crc)
 
 		Line.Sfs[i].Tran = 0;
 		Bound_AcGn = NbFilt170;
-		if ((WrkRate == Rate63) && (Line.Olp[i >> 1] < (SubFrLen - 2))) {
+		if ((*WrkRate == Rate63) && (Line.Olp[i >> 1] < (SubFrLen - 2))) {
 			Line.Sfs[i].Tran = (int16_t) (Temp >> 11);
 			Temp &= 0x000007ffL;
 			Bound_AcGn = NbFilt085;
@@ -766,7 +743,7 @@ int16_t Rand_lbc(int16_t * p)
 ** Return value:    None
 **
 */
-void Scale(int16_t * Tv, int32_t Sen)
+void Scale(DECSTATDEF * DecStat, int16_t * Tv, int32_t Sen)
 {
 	int i;
 
@@ -807,14 +784,14 @@ void Scale(int16_t * Tv, int32_t Sen)
 	for (i = 0; i < SubFrLen; i++) {
 
 		/* Update gain */
-		Acc0 = g723_L_deposit_h(DecStat.Gain);
-		Acc0 = g723_L_msu(Acc0, DecStat.Gain, (int16_t) 0x0800);
+		Acc0 = g723_L_deposit_h(DecStat->Gain);
+		Acc0 = g723_L_msu(Acc0, DecStat->Gain, (int16_t) 0x0800);
 		Acc0 = g723_L_mac(Acc0, SfGain, (int16_t) 0x0800);
-		DecStat.Gain = round_(Acc0);
+		DecStat->Gain = round_(Acc0);
 
 		Exp =
-		    g723_add(DecStat.Gain,
-			     g723_shr(DecStat.Gain, (int16_t) 4));
+		    g723_add(DecStat->Gain,
+			     g723_shr(DecStat->Gain, (int16_t) 4));
 
 		Acc0 = L_g723_mult(Tv[i], Exp);
 		Acc0 = L_g723_shl(Acc0, (int16_t) 4);
@@ -20,11 +20,17 @@
 #include "ld8cp.h"
 #include "tabld8cp.h"
 
+#include <ophsimd.h>
+
 /* prototypes of local functions */
+static void cor_diag(float h[],	/* (i)     :Impulse response of filters */
+		     float c[][L_SUBFR]	/* (o)     :Running sums along diagonals */
+    );
 static void cor_h_cp(float * H,	/* (i)     :Impulse response of filters */
 		     float * rr,	/* (o)     :Correlations of H[]         */
 		     int rate);
 static int d4i40_17(		/* (o)    : Index of pulses positions.               */
+			   int *extra,	/* (i/o)  : Search time left over from last subframe */
 			   float Dn[],	/* (i)    : Correlations between h[] and Xn[].       */
 			   float rr[],	/* (i)    : Correlations of impulse response h[].    */
 			   float h[],	/* (i)    : Impulse response of filters.             */
@@ -33,6 +39,17 @@ static int d4i40_17(		/* (o)    : Index of pulses positions.               */
 			   int *sign,	/* (o)    : Signs of 4 pulses.                       */
 			   int i_subfr	/* (i)    : subframe flag                            */
     );
+static int d4i40_pulse4(	/* (o)    : Best position index or -1            */
+			       float ps2,	/* (i)    : Correlation of the first 3 pulses    */
+			       float alp2,	/* (i)    : Energy of the first 3 pulses         */
+			       float dn_t[],	/* (i)    : dn[] on the track of pulse 4         */
+			       float rr_t[],	/* (i)    : Energy of pulse 4 on its track       */
+			       float r0[],	/* (i)    : Corr. of pulse 4 with pulse 0        */
+			       float r1[],	/* (i)    : Corr. of pulse 4 with pulse 1        */
+			       float r2[],	/* (i)    : Corr. of pulse 4 with pulse 2        */
+			       float *psc,	/* (i/o)  : Best correlation squared so far      */
+			       float *alpha	/* (i/o)  : Energy of the best codeword so far   */
+    );
 static void cor_h_vec(float h[],	/* (i) scaled impulse response */
 		      float vec[],	/* (i) vector to correlate with h[] */
 		      int track,	/* (i) track to use */
@@ -81,6 +98,7 @@ static void build_code(int codvec[],	/* (i)  : positions of each pulse */
 static int pack3(int index1, int index2, int index3);
 
 int ACELP_codebook(		/* (o)     :index of pulses positions    */
+			  int *extra,	/* (i/o)   :Search time carry-over       */
 			  float x[],	/* (i)     :Target vector                */
 			  float h[],	/* (i)     :Impulse response of filters  */
 			  int t0,	/* (i)     :Pitch lag                    */
@@ -116,7 +134,7 @@ int ACELP_codebook(		/* (o)     :index of pulses positions    */
                             * Find innovative codebook.                                       *
     *-----------------------------------------------------------------*/
 
-	index = d4i40_17(dn, rr, h, code, y, sign, i_subfr);
+	index = d4i40_17(extra, dn, rr, h, code, y, sign, i_subfr);
 
     /*------------------------------------------------------*
     * - Add the fixed-gain pitch contribution to code[].    *
@@ -521,6 +539,56 @@ int ACELP_codebook64(		/* (o)     :Index of pulses positions    */
 	return index;
 }
 
+/*--------------------------------------------------------------------------*
+*  Function  cor_diag()                                                    *
+*  ~~~~~~~~~~~~~~~~~~~~                                                    *
+* Running sums along the diagonals of the correlation matrix of h[]:       *
+*     c[n][s] = sum(m = 0..n) h[m] * h[m + s]     for n + s < L_SUBFR.     *
+* Every element cor_h_cp() and cor_h_e() store is one of these partial     *
+* sums, taken in the same order, so they read it from c[][] instead of     *
+* running their short serial chains. Four shifts share a register and the  *
+* ten registers of a row are independent, so the adds overlap.             *
+*--------------------------------------------------------------------------*/
+
+static void cor_diag(float h[],	/* (i) :Impulse response of filters   */
+		     float c[][L_SUBFR]	/* (o) :Running sums along diagonals */
+    )
+{
+	int n, s;
+#ifdef OPH_SIMD_V4
+	float hz[2 * L_SUBFR];
+	v4f hn, cor[L_SUBFR / 4];
+
+	for (n = 0; n < L_SUBFR; n++) {
+		hz[n] = h[n];
+		hz[n + L_SUBFR] = (float) 0.;
+	}
+	for (s = 0; s < L_SUBFR; s += 4)
+		cor[s >> 2] = v4_set1((float) 0.);
+
+	/* lanes past n + s = L_SUBFR - 1 only add zeros and are not read */
+	for (n = 0; n < L_SUBFR; n++) {
+		hn = v4_set1(hz[n]);
+		for (s = 0; s < L_SUBFR - n; s += 4) {
+			cor[s >> 2] =
+			    v4_add(cor[s >> 2], v4_mul(hn, v4_load(&hz[n + s])));
+			v4_store(&c[n][s], cor[s >> 2]);
+		}
+	}
+#else
+	float cor;
+
+	for (s = 0; s < L_SUBFR; s++) {
+		cor = (float) 0.;
+		for (n = 0; n < L_SUBFR - s; n++) {
+			cor += h[n] * h[n + s];
+			c[n][s] = cor;
+		}
+	}
+#endif
+	return;
+}
+
 /*--------------------------------------------------------------------------*
 *  Function  cor_h()                                                       *
 *  ~~~~~~~~~~~~~~~~~                                                       *
@@ -538,11 +606,14 @@ static void cor_h_cp(float * h,	/* (i) :Impulse response of filters */
 
 	float *p0, *p1, *p2, *p3, *p4;
 
-	float *ptr_hd, *ptr_hf, *ptr_h1, *ptr_h2;
+	float c[L_SUBFR][L_SUBFR];
+	float *ptr_c, *ptr_cf;
 	float cor;
 	int i, k, ldec, l_fin_sup, l_fin_inf;
 	int lsym;
 
+	cor_diag(h, c);
+
 	/* Init pointers */
 	rri0i0 = rr;
 	rri1i1 = rri0i0 + NB_POS;
@@ -569,27 +640,26 @@ static void cor_h_cp(float * h,	/* (i) :Impulse response of filters */
 	p3 = rri3i3 + NB_POS - 1;
 	p4 = rri4i4 + NB_POS - 1;
 
-	ptr_h1 = h;
-	cor = (float) 0.0;
+	ptr_c = &c[0][0];
 	for (i = 0; i < NB_POS; i++) {
-		cor += *ptr_h1 * *ptr_h1;
-		ptr_h1++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p4-- = cor;
 
-		cor += *ptr_h1 * *ptr_h1;
-		ptr_h1++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p3-- = cor;
 
-		cor += *ptr_h1 * *ptr_h1;
-		ptr_h1++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p2-- = cor;
 
-		cor += *ptr_h1 * *ptr_h1;
-		ptr_h1++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p1-- = cor;
 
-		cor += *ptr_h1 * *ptr_h1;
-		ptr_h1++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p0-- = cor;
 	}
 
@@ -601,8 +671,7 @@ static void cor_h_cp(float * h,	/* (i) :Impulse response of filters */
 	l_fin_inf = l_fin_sup - 1;
 	ldec = NB_POS + 1;
 
-	ptr_hd = h;
-	ptr_hf = ptr_hd + 1;
+	ptr_cf = &c[0][1];
 
 	for (k = 0; k < NB_POS; k++) {
 
@@ -611,35 +680,28 @@ static void cor_h_cp(float * h,	/* (i) :Impulse response of filters */
 		p2 = rri1i2 + l_fin_sup;
 		p1 = rri0i1 + l_fin_sup;
 		p0 = rri0i4 + l_fin_inf;
-		cor = (float) 0.0;
-		ptr_h1 = ptr_hd;
-		ptr_h2 = ptr_hf;
+		ptr_c = ptr_cf;
 
 		for (i = k + 1; i < NB_POS; i++) {
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			if (rate == G729D)
 				*p4 = cor;
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p3 = cor;
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p2 = cor;
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p1 = cor;
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			if (rate == G729)
 				*p0 = cor;
 
@@ -649,37 +711,32 @@ static void cor_h_cp(float * h,	/* (i) :Impulse response of filters */
 			p1 -= ldec;
 			p0 -= ldec;
 		}
-		cor += *ptr_h1 * *ptr_h2;
-		ptr_h1++;
-		ptr_h2++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		if (rate == G729D)
 			*p4 = cor;
-		cor += *ptr_h1 * *ptr_h2;
-		ptr_h1++;
-		ptr_h2++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p3 = cor;
 
-		cor += *ptr_h1 * *ptr_h2;
-		ptr_h1++;
-		ptr_h2++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p2 = cor;
 
-		cor += *ptr_h1 * *ptr_h2;
-		ptr_h1++;
-		ptr_h2++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p1 = cor;
 
 		l_fin_sup -= NB_POS;
 		l_fin_inf--;
-		ptr_hf += STEP;
+		ptr_cf += STEP;
 	}
 
     /*---------------------------------------------------------------------*
     * Compute elements of: rri2i4[], rri1i3[], rri0i2[], rri1i4[], rri0i3 *
     *---------------------------------------------------------------------*/
 
-	ptr_hd = h;
-	ptr_hf = ptr_hd + 2;
+	ptr_cf = &c[0][2];
 	l_fin_sup = MSIZE - 1;
 	l_fin_inf = l_fin_sup - 1;
 	for (k = 0; k < NB_POS; k++) {
@@ -690,34 +747,27 @@ static void cor_h_cp(float * h,	/* (i) :Impulse response of filters */
 		p1 = rri1i4 + l_fin_inf;
 		p0 = rri0i3 + l_fin_inf;
 
-		cor = (float) 0.0;
-		ptr_h1 = ptr_hd;
-		ptr_h2 = ptr_hf;
+		ptr_c = ptr_cf;
 		for (i = k + 1; i < NB_POS; i++) {
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p4 = cor;
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p3 = cor;
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p2 = cor;
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p1 = cor;
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p0 = cor;
 
 			p4 -= ldec;
@@ -726,32 +776,28 @@ static void cor_h_cp(float * h,	/* (i) :Impulse response of filters */
 			p1 -= ldec;
 			p0 -= ldec;
 		}
-		cor += *ptr_h1 * *ptr_h2;
-		ptr_h1++;
-		ptr_h2++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p4 = cor;
 
-		cor += *ptr_h1 * *ptr_h2;
-		ptr_h1++;
-		ptr_h2++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p3 = cor;
 
-		cor += *ptr_h1 * *ptr_h2;
-		ptr_h1++;
-		ptr_h2++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p2 = cor;
 
 		l_fin_sup -= NB_POS;
 		l_fin_inf--;
-		ptr_hf += STEP;
+		ptr_cf += STEP;
 	}
 
     /*----------------------------------------------------------------------*
     * Compute elements of: rri1i4[], rri0i3[], rri2i4[], rri1i3[], rri0i2  *
     *----------------------------------------------------------------------*/
 
-	ptr_hd = h;
-	ptr_hf = ptr_hd + 3;
+	ptr_cf = &c[0][3];
 	l_fin_sup = MSIZE - 1;
 	l_fin_inf = l_fin_sup - 1;
 	for (k = 0; k < NB_POS; k++) {
@@ -762,34 +808,27 @@ static void cor_h_cp(float * h,	/* (i) :Impulse response of filters */
 		p1 = rri1i3 + l_fin_inf;
 		p0 = rri0i2 + l_fin_inf;
 
-		ptr_h1 = ptr_hd;
-		ptr_h2 = ptr_hf;
-		cor = (float) 0.0;
+		ptr_c = ptr_cf;
 		for (i = k + 1; i < NB_POS; i++) {
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p4 = cor;
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p3 = cor;
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p2 = cor;
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p1 = cor;
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p0 = cor;
 
 			p4 -= ldec;
@@ -798,27 +837,24 @@ static void cor_h_cp(float * h,	/* (i) :Impulse response of filters */
 			p1 -= ldec;
 			p0 -= ldec;
 		}
-		cor += *ptr_h1 * *ptr_h2;
-		ptr_h1++;
-		ptr_h2++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p4 = cor;
 
-		cor += *ptr_h1 * *ptr_h2;
-		ptr_h1++;
-		ptr_h2++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p3 = cor;
 
 		l_fin_sup -= NB_POS;
 		l_fin_inf--;
-		ptr_hf += STEP;
+		ptr_cf += STEP;
 	}
 
     /*----------------------------------------------------------------------*
     * Compute elements of: rri0i4[], rri2i3[], rri1i2[], rri0i1[]          *
     *----------------------------------------------------------------------*/
 
-	ptr_hd = h;
-	ptr_hf = ptr_hd + 4;
+	ptr_cf = &c[0][4];
 	l_fin_sup = MSIZE - 1;
 	l_fin_inf = l_fin_sup - 1;
 	for (k = 0; k < NB_POS; k++) {
@@ -831,35 +867,28 @@ static void cor_h_cp(float * h,	/* (i) :Impulse response of filters */
 		p1 = rri1i2 + l_fin_inf;
 		p0 = rri0i1 + l_fin_inf;
 
-		ptr_h1 = ptr_hd;
-		ptr_h2 = ptr_hf;
-		cor = (float) 0.;
+		ptr_c = ptr_cf;
 		for (i = k + 1; i < NB_POS; i++) {
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			if (rate == G729)
 				*p3 = cor;
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			if (rate == G729D)
 				*p3 = cor;
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p2 = cor;
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p1 = cor;
 
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p0 = cor;
 
 			p3 -= ldec;
@@ -867,15 +896,14 @@ static void cor_h_cp(float * h,	/* (i) :Impulse response of filters */
 			p1 -= ldec;
 			p0 -= ldec;
 		}
-		cor += *ptr_h1 * *ptr_h2;
-		ptr_h1++;
-		ptr_h2++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		if (rate == G729)
 			*p3 = cor;
 
 		l_fin_sup -= NB_POS;
 		l_fin_inf--;
-		ptr_hf += STEP;
+		ptr_cf += STEP;
 	}
 
     /*----------------------------------------------------------------------*/
@@ -888,65 +916,39 @@ static void cor_h_cp(float * h,	/* (i) :Impulse response of filters */
 			*p0 = *rri1i1++;
 			p0 += ldec;
 		}
-		ptr_hd = h;
-		ptr_hf = ptr_hd + 5;
+		ptr_cf = &c[0][5];
 		l_fin_sup = MSIZE - 1;
 		l_fin_inf = l_fin_sup - NB_POS;
 		lsym = 7;
 		for (k = 1; k < NB_POS; k++) {
 			p0 = rri0i2 + l_fin_inf;
-			ptr_h1 = ptr_hd;
-			ptr_h2 = ptr_hf;
-			cor = (float) 0.;
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
-			cor += *ptr_h1 * *ptr_h2;
-			ptr_h1++;
-			ptr_h2++;
+			ptr_c = ptr_cf + 3 * L_SUBFR;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p0 = *(p0 + lsym) = cor;
 			p0 -= ldec;
 			for (i = k + 1; i < NB_POS; i++) {
-				cor += *ptr_h1 * *ptr_h2;
-				ptr_h1++;
-				ptr_h2++;
-				cor += *ptr_h1 * *ptr_h2;
-				ptr_h1++;
-				ptr_h2++;
-				cor += *ptr_h1 * *ptr_h2;
-				ptr_h1++;
-				ptr_h2++;
-				cor += *ptr_h1 * *ptr_h2;
-				ptr_h1++;
-				ptr_h2++;
-				cor += *ptr_h1 * *ptr_h2;
-				ptr_h1++;
-				ptr_h2++;
+				ptr_c += 4 * L_SUBFR;
+				cor = *ptr_c;
+				ptr_c += L_SUBFR;
 				*p0 = *(p0 + lsym) = cor;
 
 				p0 -= ldec;
 			}
 			l_fin_inf -= NB_POS;
-			ptr_hf += 5;
+			ptr_cf += 5;
 			lsym += 7;
 		}
 	}
 	return;
 }
 
-static int extra;
-
 /*----------------------------------------------------------------------------
 * d4i40_17 - algebraic codebook search 17 bits; 4 pulses 40 sampleframe
 *----------------------------------------------------------------------------
 */
 static int d4i40_17(		/* output: pulse positions                          */
+			   int *extra,	/* in/out: search time carried between subframes    */
 			   float dn[],	/* input : backward filtered target vector          */
 			   float rr[],	/* input : autocorrelations of impulse response h[] */
 			   float h[],	/* input : impulse response of filters              */
@@ -970,17 +972,18 @@ static int d4i40_17(		/* output: pulse positions                          */
     */
 	int i0, i1, i2, i3, ip0, ip1, ip2, ip3;
 	int i, j, time;
-	float ps0, ps1, ps2, ps3, alp0, alp1, alp2, alp3;
-	float ps3c, psc, alpha;
+	float ps0, ps1, ps2, alp0, alp1, alp2;
+	float psc, alpha;
 	float average, max0, max1, max2, thres;
 	float p_sign[L_SUBFR];
+	float dn3[NB_POS], dn4[NB_POS];
 
 	float *rri0i0, *rri1i1, *rri2i2, *rri3i3, *rri4i4;
 	float *rri0i1, *rri0i2, *rri0i3, *rri0i4;
 	float *rri1i2, *rri1i3, *rri1i4;
 	float *rri2i3, *rri2i4;
 
-	float *ptr_ri0i0, *ptr_ri1i1, *ptr_ri2i2, *ptr_ri3i3, *ptr_ri4i4;
+	float *ptr_ri0i0, *ptr_ri1i1, *ptr_ri2i2;
 	float *ptr_ri0i1, *ptr_ri0i2, *ptr_ri0i3, *ptr_ri0i4;
 	float *ptr_ri1i2, *ptr_ri1i3, *ptr_ri1i4;
 	float *ptr_ri2i3, *ptr_ri2i4;
@@ -1008,7 +1011,7 @@ static int d4i40_17(		/* output: pulse positions                          */
     *-----------------------------------------------------------------------*
     */
 	if (i_subfr == 0)
-		extra = 30;
+		*extra = 30;
 
     /*----------------------------------------------------------------------*
     * Chose the signs of the impulses.                                      *
@@ -1022,6 +1025,10 @@ static int d4i40_17(		/* output: pulse positions                          */
 			dn[i] = -dn[i];
 		}
 	}
+	for (i = 0; i < NB_POS; i++) {
+		dn3[i] = dn[3 + i * STEP];
+		dn4[i] = dn[4 + i * STEP];
+	}
 
     /*-------------------------------------------------------------------*
     * - Compute the search threshold after three pulses                 *
@@ -1111,7 +1118,7 @@ static int d4i40_17(		/* output: pulse positions                          */
 	ip3 = 3;
 	psc = (float) 0.0;
 	alpha = (float) 1000000.0;
-	time = MAX_TIME + extra;
+	time = MAX_TIME + *extra;
 
 	/* Four loops to search innovation code. */
 	ptr_ri0i0 = rri0i0;	/* Init. pointers that depend on first loop */
@@ -1144,64 +1151,32 @@ static int d4i40_17(		/* output: pulse positions                          */
 				    (float) 2.0 *(*ptr_ri0i2++ + *ptr_ri1i2++);
 
 				if (ps2 > thres) {
-					ptr_ri3i3 = rri3i3;	/* Init. pointers that depend on 4th loop */
-
-					for (i3 = 3; i3 < L_SUBFR; i3 += STEP) {
-						ps3 = ps2 + dn[i3];
-						alp3 =
-						    alp2 + *ptr_ri3i3++ +
-						    (float) 2.0 *(*ptr_ri1i3++ +
-							      *ptr_ri0i3++ +
-							      *ptr_ri2i3++);
-
-						ps3c = ps3 * ps3;
-						if ((ps3c * alpha) >
-						    (psc * alp3)) {
-							psc = ps3c;
-							alpha = alp3;
-							ip0 = i0;
-							ip1 = i1;
-							ip2 = i2;
-							ip3 = i3;
-						}
-					}	/*  end of for i3 = */
-
-					ptr_ri0i3 -= NB_POS;
-					ptr_ri1i3 -= NB_POS;
-
-					ptr_ri4i4 = rri4i4;	/* Init. pointers that depend on 4th loop */
-
-					for (i3 = 4; i3 < L_SUBFR; i3 += STEP) {
-						ps3 = ps2 + dn[i3];
-						alp3 =
-						    alp2 + *ptr_ri4i4++ +
-						    (float) 2.0 *(*ptr_ri1i4++ +
-							      *ptr_ri0i4++ +
-							      *ptr_ri2i4++);
-
-						ps3c = ps3 * ps3;
-						if ((ps3c * alpha) >
-						    (psc * alp3)) {
-							psc = ps3c;
-							alpha = alp3;
-							ip0 = i0;
-							ip1 = i1;
-							ip2 = i2;
-							ip3 = i3;
-						}
-					}	/*  end of for i3 = */
-					ptr_ri0i4 -= NB_POS;
-					ptr_ri1i4 -= NB_POS;
+					i = d4i40_pulse4(ps2, alp2, dn3, rri3i3,
+							 ptr_ri0i3, ptr_ri1i3,
+							 ptr_ri2i3, &psc, &alpha);
+					if (i >= 0) {
+						ip0 = i0;
+						ip1 = i1;
+						ip2 = i2;
+						ip3 = 3 + i * STEP;
+					}
+					i = d4i40_pulse4(ps2, alp2, dn4, rri4i4,
+							 ptr_ri0i4, ptr_ri1i4,
+							 ptr_ri2i4, &psc, &alpha);
+					if (i >= 0) {
+						ip0 = i0;
+						ip1 = i1;
+						ip2 = i2;
+						ip3 = 4 + i * STEP;
+					}
 
 					time--;
 					if (time <= 0)
 						goto end_search;	/* Maximum time finish */
 
-				} /* end of if >thres */
-				else {
-					ptr_ri2i3 += NB_POS;
-					ptr_ri2i4 += NB_POS;
-				}
+				}	/* end of if >thres */
+				ptr_ri2i3 += NB_POS;
+				ptr_ri2i4 += NB_POS;
 
 			}	/* end of for i2 = */
 
@@ -1219,7 +1194,7 @@ static int d4i40_17(		/* output: pulse positions                          */
 
  end_search:
 
-	extra = time;
+	*extra = time;
 
 	/* Find the codeword corresponding to the selected positions */
 
@@ -1287,6 +1262,71 @@ static int d4i40_17(		/* output: pulse positions                          */
 	return i;
 }
 
+/*----------------------------------------------------------------------------
+* d4i40_pulse4 - fourth pulse loop of d4i40_17() for one track
+*----------------------------------------------------------------------------
+* Returns the index of the last of the 8 positions that improved the
+* criterion, -1 if none did. Four positions are scored at a time; when none
+* of them beats the best codeword so far, which is the common case, they
+* are skipped without the scalar compares. Otherwise the four are compared
+* one after the other as in the reference loop, so the result is the same.
+*----------------------------------------------------------------------------
+*/
+static int d4i40_pulse4(float ps2, float alp2, float dn_t[], float rr_t[],
+			float r0[], float r1[], float r2[], float *psc,
+			float *alpha)
+{
+	int k, ip;
+	float ps3c, alp3;
+#ifdef OPH_SIMD_V4
+	int i;
+	float v_ps3c[4], v_alp3[4];
+	v4f vps, valp;
+#else
+	float ps3;
+#endif
+
+	ip = -1;
+#ifdef OPH_SIMD_V4
+	for (k = 0; k < NB_POS; k += 4) {
+		vps = v4_add(v4_set1(ps2), v4_load(&dn_t[k]));
+		vps = v4_mul(vps, vps);
+		valp = v4_add(v4_add(v4_set1(alp2), v4_load(&rr_t[k])),
+			      v4_mul(v4_set1((float) 2.0),
+				     v4_add(v4_add(v4_load(&r1[k]),
+						   v4_load(&r0[k])),
+					    v4_load(&r2[k]))));
+		if (!v4_any_gt(v4_mul(vps, v4_set1(*alpha)),
+			       v4_mul(v4_set1(*psc), valp)))
+			continue;
+		v4_store(v_ps3c, vps);
+		v4_store(v_alp3, valp);
+		for (i = 0; i < 4; i++) {
+			ps3c = v_ps3c[i];
+			alp3 = v_alp3[i];
+			if ((ps3c * *alpha) > (*psc * alp3)) {
+				*psc = ps3c;
+				*alpha = alp3;
+				ip = k + i;
+			}
+		}
+	}
+#else
+	for (k = 0; k < NB_POS; k++) {
+		ps3 = ps2 + dn_t[k];
+		alp3 = alp2 + rr_t[k] + (float) 2.0 *(r1[k] + r0[k] + r2[k]);
+
+		ps3c = ps3 * ps3;
+		if ((ps3c * *alpha) > (*psc * alp3)) {
+			*psc = ps3c;
+			*alpha = alp3;
+			ip = k;
+		}
+	}
+#endif
+	return ip;
+}
+
 /*-------------------------------------------------------------------*
 * Function  ACELP_12i40_44bits()                                    *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~                                    *
@@ -1735,16 +1775,60 @@ static void search_ixiy(int track_x,	/* (i) track of pulse 1 */
     )
 {
 	int i, j, pos;
-	float ps1, ps2, sq, sqk;
+	float ps1, sq, sqk;
 	float alp1, alp2, alpk;
 	float *p0, *p1, *p2;
 	float s;
+#ifdef OPH_SIMD_V4
+	int k;
+	float dn_y[NB_POS], v_sq[4], v_alp2[4];
+	v4f vps, valp;
+#else
+	float ps2;
+#endif
 
 	p0 = cor_x;
 	p1 = cor_y;
 	p2 = rrixiy[track_x];
 	sqk = (float) - 1.;
 	alpk = (float) 1.;
+#ifdef OPH_SIMD_V4
+	/* Score 4 positions of pulse 2 at a time; only when one of them beats
+	   the best pair so far are they compared in turn as below. */
+	for (k = 0; k < NB_POS; k++)
+		dn_y[k] = dn[track_y + k * STEP];
+	for (i = track_x; i < L_SUBFR; i += STEP) {
+		ps1 = *ps + dn[i];
+		alp1 = *alp + *p0++;
+		pos = -1;
+		for (k = 0; k < NB_POS; k += 4, p2 += 4) {
+			vps = v4_add(v4_set1(ps1), v4_load(&dn_y[k]));
+			vps = v4_mul(vps, vps);
+			valp = v4_add(v4_add(v4_set1(alp1), v4_load(&p1[k])),
+				      v4_load(p2));
+			if (!v4_any_gt(v4_sub(v4_mul(v4_set1(alpk), vps),
+					      v4_mul(v4_set1(sqk), valp)),
+				       v4_set1((float) 0.)))
+				continue;
+			v4_store(v_sq, vps);
+			v4_store(v_alp2, valp);
+			for (j = 0; j < 4; j++) {
+				sq = v_sq[j];
+				alp2 = v_alp2[j];
+				s = (alpk * sq) - (sqk * alp2);
+				if (s > (float) 0.) {
+					sqk = sq;
+					alpk = alp2;
+					pos = track_y + (k + j) * STEP;
+				}
+			}
+		}
+		if (pos >= 0) {
+			*ix = i;
+			*iy = pos;
+		}
+	}
+#else
 	for (i = track_x; i < L_SUBFR; i += STEP) {
 		ps1 = *ps + dn[i];
 		alp1 = *alp + *p0++;
@@ -1766,6 +1850,7 @@ static void search_ixiy(int track_x,	/* (i) track of pulse 1 */
 			*iy = pos;
 		}
 	}
+#endif
 	*ps += dn[*ix] + dn[*iy];
 	*alp = alpk;
 
@@ -1849,13 +1934,15 @@ static void cor_h_e(float sign[],	/* (i) : sign vector                 */
     )
 {
 	int i, j, k, pos;
-	float *ptr_h1, *ptr_h2, *ptr_hf, *psign;
+	float c[L_SUBFR][L_SUBFR];
+	float *ptr_c, *ptr_cf, *psign;
 	float *p0, *p1, *p2, *p3, *p4;
 	float cor;
 
 	for (i = 0; i < L_SUBFR; i++) {
 		h_inv[i] = -h[i];
 	}
+	cor_diag(h, c);
 
     /*------------------------------------------------------------*
     * Compute rrixix[][] needed for the codebook search.         *
@@ -1869,23 +1956,22 @@ static void cor_h_e(float sign[],	/* (i) : sign vector                 */
 	p2 = &rrixix[2][NB_POS - 1];
 	p3 = &rrixix[3][NB_POS - 1];
 	p4 = &rrixix[4][NB_POS - 1];
-	ptr_h1 = h;
-	cor = (float) 0.;
+	ptr_c = &c[0][0];
 	for (i = 0; i < NB_POS; i++) {
-		cor += (*ptr_h1) * (*ptr_h1);
-		ptr_h1++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p4-- = cor;
-		cor += (*ptr_h1) * (*ptr_h1);
-		ptr_h1++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p3-- = cor;
-		cor += (*ptr_h1) * (*ptr_h1);
-		ptr_h1++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p2-- = cor;
-		cor += (*ptr_h1) * (*ptr_h1);
-		ptr_h1++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p1-- = cor;
-		cor += (*ptr_h1) * (*ptr_h1);
-		ptr_h1++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p0-- = cor;
 	}
 
@@ -1904,36 +1990,29 @@ static void cor_h_e(float sign[],	/* (i) : sign vector                 */
     *------------------------------------------------------------*/
 	/* storage order --> i3i4, i2i3, i1i2, i0i1, i4i0 */
 	pos = MSIZE - 1;
-	ptr_hf = h + 1;
+	ptr_cf = &c[0][1];
 	for (k = 0; k < NB_POS; k++) {
 		p4 = &rrixiy[3][pos];
 		p3 = &rrixiy[2][pos];
 		p2 = &rrixiy[1][pos];
 		p1 = &rrixiy[0][pos];
 		p0 = &rrixiy[4][pos - NB_POS];
-		cor = (float) 0.;
-		ptr_h1 = h;
-		ptr_h2 = ptr_hf;
+		ptr_c = ptr_cf;
 		for (i = k + 1; i < NB_POS; i++) {
-			cor += (*ptr_h1) * (*ptr_h2);
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p4 = cor;
-			cor += (*ptr_h1) * (*ptr_h2);
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p3 = cor;
-			cor += (*ptr_h1) * (*ptr_h2);
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p2 = cor;
-			cor += (*ptr_h1) * (*ptr_h2);
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p1 = cor;
-			cor += (*ptr_h1) * (*ptr_h2);
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p0 = cor;
 			p4 -= (NB_POS + 1);
 			p3 -= (NB_POS + 1);
@@ -1942,29 +2021,25 @@ static void cor_h_e(float sign[],	/* (i) : sign vector                 */
 			p0 -= (NB_POS + 1);
 		}
 
-		cor += (*ptr_h1) * (*ptr_h2);
-		ptr_h1++;
-		ptr_h2++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p4 = cor;
-		cor += (*ptr_h1) * (*ptr_h2);
-		ptr_h1++;
-		ptr_h2++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p3 = cor;
-		cor += (*ptr_h1) * (*ptr_h2);
-		ptr_h1++;
-		ptr_h2++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p2 = cor;
-		cor += (*ptr_h1) * (*ptr_h2);
-		ptr_h1++;
-		ptr_h2++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p1 = cor;
 		pos -= NB_POS;
-		ptr_hf += STEP;
+		ptr_cf += STEP;
 	}
 
 	/* storage order --> i4i0, i3i4, i2i3, i1i2, i0i1 */
 	pos = MSIZE - 1;
-	ptr_hf = h + 4;
+	ptr_cf = &c[0][4];
 	for (k = 0; k < NB_POS; k++) {
 		p4 = &rrixiy[4][pos];
 		p3 = &rrixiy[3][pos - 1];
@@ -1972,29 +2047,22 @@ static void cor_h_e(float sign[],	/* (i) : sign vector                 */
 		p1 = &rrixiy[1][pos - 1];
 		p0 = &rrixiy[0][pos - 1];
 
-		cor = (float) 0.;
-		ptr_h1 = h;
-		ptr_h2 = ptr_hf;
+		ptr_c = ptr_cf;
 		for (i = k + 1; i < NB_POS; i++) {
-			cor += (*ptr_h1) * (*ptr_h2);
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p4 = cor;
-			cor += (*ptr_h1) * (*ptr_h2);
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p3 = cor;
-			cor += (*ptr_h1) * (*ptr_h2);
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p2 = cor;
-			cor += (*ptr_h1) * (*ptr_h2);
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p1 = cor;
-			cor += (*ptr_h1) * (*ptr_h2);
-			ptr_h1++;
-			ptr_h2++;
+			cor = *ptr_c;
+			ptr_c += L_SUBFR;
 			*p0 = cor;
 
 			p4 -= (NB_POS + 1);
@@ -2003,12 +2071,11 @@ static void cor_h_e(float sign[],	/* (i) : sign vector                 */
 			p1 -= (NB_POS + 1);
 			p0 -= (NB_POS + 1);
 		}
-		cor += (*ptr_h1) * (*ptr_h2);
-		ptr_h1++;
-		ptr_h2++;
+		cor = *ptr_c;
+		ptr_c += L_SUBFR;
 		*p4 = cor;
 		pos--;
-		ptr_hf += STEP;
+		ptr_cf += STEP;
 	}
 
     /*------------------------------------------------------------*
@@ -40,7 +40,8 @@ static void calc_stat(float gpred_b, float gpred_f, int mode,
 /*                    BACKWARD <--> FORWARD DECISION                      */
 /* ---------------------------------------------------------------------- */
 
-void set_lpc_mode(float * signal_ptr,	/* I   Input signal */
+void set_lpc_mode(int count_mode[2],	/* I/O Forward / backward frame counts */
+		  float * signal_ptr,	/* I   Input signal */
 		  float * a_fwd,	/* I   Forward LPC filter */
 		  float * a_bwd,	/* I   Backward LPC filter */
 		  int *mode,	/* O  Backward / forward Indication */
@@ -152,7 +153,7 @@ void set_lpc_mode(float * signal_ptr,	/* I   Input signal */
 		if (*glob_stat > 13000)
 			*glob_stat = 13000;
 	} else
-		tst_bwd_dominant(bwd_dominant, *mode);
+		tst_bwd_dominant(count_mode, bwd_dominant, *mode);
 
 	/* Adaptation of the global stationnarity indicator */
 	/* ------------------------------------------------ */
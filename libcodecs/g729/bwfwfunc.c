@@ -28,31 +28,30 @@
 /* No backward dominant => Non Stationnary signal (mainly speech) :     */
 /*         Unquantized filter (10 coef.) + normal weighting             */
 /* -------------------------------------------------------------------- */
-static int count_bwd2 = 0, count_fwd2 = 0;
-
-void tst_bwd_dominant(int *bwd_dominant,	/* O   Dominant backward mode indication */
+void tst_bwd_dominant(int count_mode[2],	/* I/O Forward [0] / backward [1] frame counts */
+		      int *bwd_dominant,	/* O   Dominant backward mode indication */
 		      int mode)
 {				/* I   Selected LPC mode */
 
 	int tmp, count_all;
 
 	if (mode == 0)
-		count_fwd2++;
+		count_mode[0]++;
 	else
-		count_bwd2++;
+		count_mode[1]++;
 
-	count_all = count_bwd2 + count_fwd2;
+	count_all = count_mode[1] + count_mode[0];
 
 	if (count_all == 100) {
 		count_all = count_all >> 1;
-		count_bwd2 = count_bwd2 >> 1;
-		count_fwd2 = count_fwd2 >> 1;
+		count_mode[1] = count_mode[1] >> 1;
+		count_mode[0] = count_mode[0] >> 1;
 	}
 
 	*bwd_dominant = 0;
 	if (count_all >= 10) {
-		tmp = count_fwd2 << 2;
-		if (count_bwd2 > tmp)
+		tmp = count_mode[0] << 2;
+		if (count_mode[1] > tmp)
 			*bwd_dominant = 1;
 	}
 
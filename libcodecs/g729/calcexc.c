@@ -30,7 +30,9 @@ static float gauss(int16_t * seed);
 *   Computes comfort noise excitation                       *
 *   for SID and not-transmitted frames                      *
 *-----------------------------------------------------------*/
-void calc_exc_rand(float cur_gain,	/* (i)   :   target sample gain                 */
+void calc_exc_rand(float exc_err[],	/* (i/o) :   encoder taming memory              */
+		   struct phdisp_state *phd,	/* (i/o) :   decoder phase dispersion state */
+		   float cur_gain,	/* (i)   :   target sample gain                 */
 		   float * exc,	/* (i/o) :   excitation array                   */
 		   int16_t * seed,	/* (i)   :   current Vad decision               */
 		   int flag_cod	/* (i)   :   encoder/decoder flag               */
@@ -53,11 +55,11 @@ void calc_exc_rand(float cur_gain,	/* (i)   :   target sample gain
 		t0 = L_SUBFR + 1;
 		if (flag_cod != FLAG_DEC) {
 			for (i_subfr = 0; i_subfr < L_FRAME; i_subfr += L_SUBFR) {
-				update_exc_err(gp, t0);
+				update_exc_err(exc_err, gp, t0);
 			}
 		} else {
-			Update_PhDisp(gp, cur_gain);
-			Update_PhDisp(gp, cur_gain);
+			Update_PhDisp(phd, gp, cur_gain);
+			Update_PhDisp(phd, gp, cur_gain);
 		}
 		return;
 	}
@@ -187,12 +189,12 @@ void calc_exc_rand(float cur_gain,	/* (i)   :   target sample gain
 		}
 
 		if (flag_cod != FLAG_DEC)
-			update_exc_err(gp, t0);
+			update_exc_err(exc_err, gp, t0);
 		else {
 			if (g >= (float) 0.)
-				Update_PhDisp(gp, g);
+				Update_PhDisp(phd, gp, g);
 			else
-				Update_PhDisp(gp, -g);
+				Update_PhDisp(phd, gp, -g);
 		}
 		cur_exc += L_SUBFR;
 	}			/* end of loop on subframes */
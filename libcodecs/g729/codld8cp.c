@@ -23,6 +23,7 @@
 #include "vad.h"
 #include "dtx.h"
 #include "sid.h"
+#include "state.h"
 /*-----------------------------------------------------------*
  *    Coder constant parameters (defined in "ld8k.h")        *
  *-----------------------------------------------------------*
@@ -38,73 +39,12 @@
  *   L_INTERPOL  : Length of filter for interpolation        *
  *-----------------------------------------------------------*/
 
- /*--------------------------------------------------------*
-  *         Static memory allocation.                      *
-  *--------------------------------------------------------*/
-
-/* Speech vector */
-static float old_speech[L_TOTAL];
-static float *speech, *p_window;
-float *new_speech;		/* Global variable */
-
-/* Weighted speech vector */
-static float old_wsp[L_FRAME + PIT_MAX];
-static float *wsp;
-
-/* Excitation vector */
-static float old_exc[L_FRAME + PIT_MAX + L_INTERPOL];
-static float *exc;
-
-/* Zero vector */
-static float ai_zero[L_SUBFR + M_BWDP1];
-static float *zero;
-
-/* Lsp (Line spectral pairs) */
-static float lsp_old[M] =
+/* Lsp (Line spectral pairs) at reset */
+static float lsp_old_init[M] =
     { (float) 0.9595, (float) 0.8413, (float) 0.6549, (float) 0.4154, (float) 0.1423,
 	(float) - 0.1423, (float) - 0.4154, (float) - 0.6549, (float) - 0.8413, (float) - 0.9595
 };
 
-static float lsp_old_q[M];
-
-/* Filter's memory */
-static float mem_syn[M_BWD], mem_w0[M_BWD], mem_w[M_BWD];
-static float mem_err[M_BWD + L_SUBFR], *error;
-static float pit_sharp;
-
-/* For G.729B */
-/* DTX variables */
-static int pastVad;
-static int ppastVad;
-static int16_t seed;
-
-/* for G.729E */
-/* for the backward analysis */
-static float prev_filter[M_BWDP1];	/* Previous selected filter */
-
-static float rexp[M_BWDP1];
-static float synth[L_ANA_BWD];
-static float *synth_ptr;
-static int prev_lp_mode;
-static float gamma1[2], gamma2[2];	/* Weighting factor for the 2 subframes */
-static float A_t_bwd_mem[M_BWDP1];
-static int bwd_dominant;
-static float C_int;		/* See file bwfw.c */
-static int16_t glob_stat;		/* Mesure of global stationnarity */
-static int16_t stat_bwd;		/* Nbre of consecutive backward frames */
-static int16_t val_stat_bwd;	/* Value associated with stat_bwd */
-
-/* Last backward A(z) for case of unstable filter */
-static float old_A_bwd[M_BWDP1];
-static float old_rc_bwd[2];
-/* Last forkward A(z) for case of unstable filter */
-static float old_A_fwd[MP1];
-static float old_rc_fwd[2];
-static float freq_prev[MA_NP][M];	/* previous LSP vector       */
-
-static int lag_buf[5] = { 20, 20, 20, 20, 20 };
-static float pgain_buf[5] = { (float) 0.7, (float) 0.7, (float) 0.7, (float) 0.7, (float) 0.7 };
-
 #define         AVG(a,b,c,d) (int)(((a)+(b)+(c)+(d))/((float)4.0)+(float)0.5)
 
 /*----------------------------------------------------------------------------
@@ -112,7 +52,8 @@ static float pgain_buf[5] = { (float) 0.7, (float) 0.7, (float) 0.7, (float) 0.7
  *----------------------------------------------------------------------------
  */
 
-void init_coder_ld8c(int dtx_enable	/* input : DTX enable flag */
+void init_coder_ld8c(struct g729_enc *st,	/* output: encoder state */
+		     int dtx_enable	/* input : DTX enable flag */
     )
 {
 /*-----------------------------------------------------------------------*
@@ -132,69 +73,79 @@ void init_coder_ld8c(int dtx_enable	/* input : DTX enable flag */
 *-----------------------------------------------------------------------*/
 	int i;
 
-	new_speech = old_speech + L_TOTAL - L_FRAME;	/* New speech     */
-	speech = new_speech - L_NEXT;	/* Present frame  */
-	p_window = old_speech + L_TOTAL - L_WINDOW;	/* For LPC window */
+	st->new_speech = st->old_speech + L_TOTAL - L_FRAME;	/* New speech     */
+	st->speech = st->new_speech - L_NEXT;	/* Present frame  */
+	st->p_window = st->old_speech + L_TOTAL - L_WINDOW;	/* For LPC window */
 
 	/* Initialize static pointers */
-	wsp = old_wsp + PIT_MAX;
-	exc = old_exc + PIT_MAX + L_INTERPOL;
-	zero = ai_zero + M_BWDP1;
-	error = mem_err + M_BWD;
+	st->wsp = st->old_wsp + PIT_MAX;
+	st->exc = st->old_exc + PIT_MAX + L_INTERPOL;
+	st->zero = st->ai_zero + M_BWDP1;
+	st->error = st->mem_err + M_BWD;
 
 	/* Static vectors to zero */
-	set_zero(old_speech, L_TOTAL);
-	set_zero(old_exc, PIT_MAX + L_INTERPOL);
-	set_zero(old_wsp, PIT_MAX);
-	set_zero(mem_syn, M_BWD);
-	set_zero(mem_w, M_BWD);
-	set_zero(mem_w0, M_BWD);
-	set_zero(mem_err, M_BWD);
-	set_zero(zero, L_SUBFR);
-	pit_sharp = SHARPMIN;
-
-	/* Initialize lsp_old_q[] */
-	copy(lsp_old, lsp_old_q, M);
-
-	lsp_encw_resete(freq_prev);
-	init_exc_err();
+	set_zero(st->old_speech, L_TOTAL);
+	set_zero(st->old_exc, PIT_MAX + L_INTERPOL);
+	set_zero(st->old_wsp, PIT_MAX);
+	set_zero(st->mem_syn, M_BWD);
+	set_zero(st->mem_w, M_BWD);
+	set_zero(st->mem_w0, M_BWD);
+	set_zero(st->mem_err, M_BWD);
+	set_zero(st->zero, L_SUBFR);
+	st->pit_sharp = SHARPMIN;
+
+	/* Initialize lsp_old[] and lsp_old_q[] */
+	copy(lsp_old_init, st->lsp_old, M);
+	copy(st->lsp_old, st->lsp_old_q, M);
+
+	lsp_encw_resete(st->freq_prev);
+	init_exc_err(st->exc_err);
+	for (i = 0; i < 4; i++)
+		st->past_qua_en[i] = (float) - 14.0;
+	for (i = 0; i < 5; i++) {
+		st->lag_buf[i] = 20;
+		st->pgain_buf[i] = (float) 0.7;
+	}
+	st->pwf.smooth = 1;
+	st->pwf.lar_old[0] = st->pwf.lar_old[1] = (float) 0.0;
+	st->count_mode[0] = st->count_mode[1] = 0;
 
 	/* For G.729B */
 	/* Initialize VAD/DTX parameters */
 	if (dtx_enable == 1) {
-		pastVad = 1;
-		ppastVad = 1;
-		seed = INIT_SEED;
-		vad_init();
-		init_lsfq_noise();
+		st->pastVad = 1;
+		st->ppastVad = 1;
+		st->seed = INIT_SEED;
+		vad_init(&st->vad);
+		init_musdetect(&st->mus);
 	}
 	/* for G.729E */
 	/* for the backward analysis */
-	set_zero(synth, L_ANA_BWD);
-	synth_ptr = synth + MEM_SYN_BWD;
-	prev_lp_mode = 0;
-	bwd_dominant = 0;	/* See file bwfw.c */
-	C_int = (float) 1.1;	/* Filter interpolation parameter */
-	glob_stat = 10000;	/* Mesure of global stationnarity */
-	stat_bwd = 0;		/* Nbre of consecutive backward frames */
-	val_stat_bwd = 0;	/* Value associated with stat_bwd */
+	set_zero(st->synth, L_ANA_BWD);
+	st->synth_ptr = st->synth + MEM_SYN_BWD;
+	st->prev_lp_mode = 0;
+	st->bwd_dominant = 0;	/* See file bwfw.c */
+	st->C_int = (float) 1.1;	/* Filter interpolation parameter */
+	st->glob_stat = 10000;	/* Mesure of global stationnarity */
+	st->stat_bwd = 0;		/* Nbre of consecutive backward frames */
+	st->val_stat_bwd = 0;	/* Value associated with stat_bwd */
 
 	for (i = 0; i < M_BWDP1; i++)
-		rexp[i] = (float) 0.;
+		st->rexp[i] = (float) 0.;
 
-	A_t_bwd_mem[0] = (float) 1.;
+	st->A_t_bwd_mem[0] = (float) 1.;
 	for (i = 1; i < M_BWDP1; i++)
-		A_t_bwd_mem[i] = (float) 0.;
-	set_zero(prev_filter, M_BWDP1);
-	prev_filter[0] = (float) 1.;
+		st->A_t_bwd_mem[i] = (float) 0.;
+	set_zero(st->prev_filter, M_BWDP1);
+	st->prev_filter[0] = (float) 1.;
 
-	set_zero(old_A_bwd, M_BWDP1);
-	old_A_bwd[0] = (float) 1.;
-	set_zero(old_rc_bwd, 2);
+	set_zero(st->old_A_bwd, M_BWDP1);
+	st->old_A_bwd[0] = (float) 1.;
+	set_zero(st->old_rc_bwd, 2);
 
-	set_zero(old_A_fwd, MP1);
-	old_A_fwd[0] = (float) 1.;
-	set_zero(old_rc_fwd, 2);
+	set_zero(st->old_A_fwd, MP1);
+	st->old_A_fwd[0] = (float) 1.;
+	set_zero(st->old_rc_fwd, 2);
 
 	return;
 }
@@ -203,7 +154,8 @@ void init_coder_ld8c(int dtx_enable	/* input : DTX enable flag */
 * coder_ld8c - encoder routine ( speech data should be in new_speech )
 *----------------------------------------------------------------------------
 */
-void coder_ld8c(int ana[],	/* output: analysis parameters */
+void coder_ld8c(struct g729_enc *st,	/* in/out: encoder state */
+		int ana[],	/* output: analysis parameters */
 		int frame,	/* input : frame counter */
 		int dtx_enable,	/* input : DTX enable flag */
 		int rate	/* input : rate selector/ G729, G729D, and G729E */
@@ -270,24 +222,24 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
 	/* ------------------- */
 	/* LP Forward analysis */
 	/* ------------------- */
-	autocorr(p_window, NP, r_fwd);	/* Autocorrelations */
+	autocorr(st->p_window, NP, r_fwd);	/* Autocorrelations */
 	copy(r_fwd, r_nbe, MP1);
 	glag_window(NP, r_fwd);	/* Lag windowing    */
 	levinsone(M, r_fwd, &A_t_fwd[MP1], rc_fwd,	/* Levinson Durbin  */
-		  old_A_fwd, old_rc_fwd);
-	az_lsp(&A_t_fwd[MP1], lsp_new, lsp_old);	/* From A(z) to lsp */
+		  st->old_A_fwd, st->old_rc_fwd);
+	az_lsp(&A_t_fwd[MP1], lsp_new, st->lsp_old);	/* From A(z) to lsp */
 
 	/* For G.729B */
 	/* ------ VAD ------- */
 	if (dtx_enable == 1) {
 		lsp_lsf(lsp_new, lsf_new, M);
-		vad(rc_fwd[1], lsf_new, r_fwd, p_window, frame,
-		    pastVad, ppastVad, &Vad, &Energy_db);
+		vad(&st->vad, rc_fwd[1], lsf_new, r_fwd, st->p_window, frame,
+		    st->pastVad, st->ppastVad, &Vad, &Energy_db);
 
-		musdetect(rate, r_fwd[0], rc_fwd, lag_buf, pgain_buf,
-			  prev_lp_mode, frame, pastVad, &Vad, Energy_db);
+		musdetect(&st->mus, rate, r_fwd[0], rc_fwd, st->lag_buf, st->pgain_buf,
+			  st->prev_lp_mode, frame, st->pastVad, &Vad, Energy_db);
 
-		update_cng(r_nbe, Vad);
+		update_cng(&st->cng, r_nbe, Vad);
 	} else
 		Vad = 1;
 
@@ -297,10 +249,10 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
 	if ((rate - (1 - Vad)) == G729E) {
 
 		/* LPC recursive Window as in G728 */
-		autocorr_hyb_window(synth, r_bwd, rexp);	/* Autocorrelations */
+		autocorr_hyb_window(st->synth, r_bwd, st->rexp);	/* Autocorrelations */
 		glag_window_bwd(r_bwd);	/* Lag windowing    */
 		levinsone(M_BWD, r_bwd, &A_t_bwd[M_BWDP1], rc_bwd,
-			  old_A_bwd, old_rc_bwd);
+			  st->old_A_bwd, st->old_rc_bwd);
 
 		/* Tests saturation of A_t_bwd */
 		sat_filter = 0;
@@ -308,9 +260,9 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
 			if (A_t_bwd[i] >= (float) 8.)
 				sat_filter = 1;
 		if (sat_filter == 1)
-			copy(A_t_bwd_mem, &A_t_bwd[M_BWDP1], M_BWDP1);
+			copy(st->A_t_bwd_mem, &A_t_bwd[M_BWDP1], M_BWDP1);
 		else
-			copy(&A_t_bwd[M_BWDP1], A_t_bwd_mem, M_BWDP1);
+			copy(&A_t_bwd[M_BWDP1], st->A_t_bwd_mem, M_BWDP1);
 
 		/* Additional bandwidth expansion on backward filter */
 		weight_az(&A_t_bwd[M_BWDP1], GAMMA_BWD, M_BWD,
@@ -319,14 +271,14 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
     /*--------------------------------------------------*
     * Update synthesis signal for next frame.          *
     *--------------------------------------------------*/
-	copy(&synth[L_FRAME], &synth[0], MEM_SYN_BWD);
+	copy(&st->synth[L_FRAME], &st->synth[0], MEM_SYN_BWD);
 
     /*--------------------------------------------------------------------*
     * Find interpolated LPC parameters in all subframes unquantized.      *
     * The interpolated parameters are in array A_t[] of size (M+1)*4      *
     *---------------------------------------------------------------------*/
-	if (prev_lp_mode == 0) {
-		int_lpc(lsp_old, lsp_new, lsf_int, lsf_new, A_t_fwd);
+	if (st->prev_lp_mode == 0) {
+		int_lpc(st->lsp_old, lsp_new, lsf_int, lsf_new, A_t_fwd);
 	} else {
 		/* no interpolation */
 		/* unquantized */
@@ -339,14 +291,14 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
 		/* ---------------- */
 		/* LSP quantization */
 		/* ---------------- */
-		qua_lspe(lsp_new, lsp_new_q, code_lsp, freq_prev, freq_cur);
+		qua_lspe(lsp_new, lsp_new_q, code_lsp, st->freq_prev, freq_cur);
 
 	/*-------------------------------------------------------------------*
         * Find interpolated LPC parameters in all subframes quantized.       *
         * and the quantized interpolated parameters are in array Aq_t[]      *
         *--------------------------------------------------------------------*/
-		if (prev_lp_mode == 0) {
-			int_qlpc(lsp_old_q, lsp_new_q, A_t_fwd_q);
+		if (st->prev_lp_mode == 0) {
+			int_qlpc(st->lsp_old_q, lsp_new_q, A_t_fwd_q);
 		} else {
 			/* no interpolation */
 			lsp_az(lsp_new_q, &A_t_fwd_q[MP1]);	/* Subframe 2 */
@@ -356,50 +308,50 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
         * - Decision for the switch Forward / Backward                        *
         *---------------------------------------------------------------------*/
 		if (rate == G729E) {
-			set_lpc_mode(speech, A_t_fwd_q, A_t_bwd, &lp_mode,
-				     lsp_new, lsp_old, &bwd_dominant,
-				     prev_lp_mode, prev_filter, &C_int,
-				     &glob_stat, &stat_bwd, &val_stat_bwd);
+			set_lpc_mode(st->count_mode, st->speech, A_t_fwd_q,
+				     A_t_bwd, &lp_mode, lsp_new, st->lsp_old, &st->bwd_dominant,
+				     st->prev_lp_mode, st->prev_filter, &st->C_int,
+				     &st->glob_stat, &st->stat_bwd, &st->val_stat_bwd);
 		} else
-			update_bwd(&lp_mode, &bwd_dominant, &C_int, &glob_stat);
+			update_bwd(&lp_mode, &st->bwd_dominant, &st->C_int, &st->glob_stat);
 	} else
-		update_bwd(&lp_mode, &bwd_dominant, &C_int, &glob_stat);
+		update_bwd(&lp_mode, &st->bwd_dominant, &st->C_int, &st->glob_stat);
 
 	/* ---------------------------------- */
 	/* update the LSPs for the next frame */
 	/* ---------------------------------- */
-	copy(lsp_new, lsp_old, M);
+	copy(lsp_new, st->lsp_old, M);
 
     /*----------------------------------------------------------------------*
     * - Find the weighted input speech w_sp[] for the whole speech frame   *
     *----------------------------------------------------------------------*/
 	if (lp_mode == 0) {
 		m_ap = M;
-		if (bwd_dominant == 0)
+		if (st->bwd_dominant == 0)
 			Ap = A_t_fwd;
 		else
 			Ap = A_t_fwd_q;
-		perc_var(gamma1, gamma2, lsf_int, lsf_new, rc_fwd);
+		perc_var(&st->pwf, st->gamma1, st->gamma2, lsf_int, lsf_new, rc_fwd);
 	} else {
-		if (bwd_dominant == 0) {
+		if (st->bwd_dominant == 0) {
 			m_ap = M;
 			Ap = A_t_fwd;
 		} else {
 			m_ap = M_BWD;
 			Ap = A_t_bwd;
 		}
-		perc_vare(gamma1, gamma2, bwd_dominant);
+		perc_vare(st->gamma1, st->gamma2, st->bwd_dominant);
 	}
 	pAp = Ap;
 	for (i = 0; i < 2; i++) {
-		weight_az(pAp, gamma1[i], m_ap, Ap1);
-		weight_az(pAp, gamma2[i], m_ap, Ap2);
-		residue(m_ap, Ap1, &speech[i * L_SUBFR], &wsp[i * L_SUBFR],
+		weight_az(pAp, st->gamma1[i], m_ap, Ap1);
+		weight_az(pAp, st->gamma2[i], m_ap, Ap2);
+		residue(m_ap, Ap1, &st->speech[i * L_SUBFR], &st->wsp[i * L_SUBFR],
 			L_SUBFR);
-		syn_filte(m_ap, Ap2, &wsp[i * L_SUBFR], &wsp[i * L_SUBFR],
-			  L_SUBFR, &mem_w[M_BWD - m_ap], 0);
+		syn_filte(m_ap, Ap2, &st->wsp[i * L_SUBFR], &st->wsp[i * L_SUBFR],
+			  L_SUBFR, &st->mem_w[M_BWD - m_ap], 0);
 		for (j = 0; j < M_BWD; j++)
-			mem_w[j] = wsp[i * L_SUBFR + L_SUBFR - M_BWD + j];
+			st->mem_w[j] = st->wsp[i * L_SUBFR + L_SUBFR - M_BWD + j];
 		pAp += m_ap + 1;
 	}
 
@@ -409,66 +361,67 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
 	if (Vad == 0) {
 
 		for (i = 0; i < MA_NP; i++)
-			copy(&freq_prev[i][0], &lsfq_mem[i][0], M);
-		cod_cng(exc, pastVad, lsp_old_q, old_A_fwd, old_rc_fwd,
-			A_t_fwd_q, ana, lsfq_mem, &seed);
+			copy(&st->freq_prev[i][0], &lsfq_mem[i][0], M);
+		cod_cng(&st->cng, st->exc_err, st->exc, st->pastVad,
+			st->lsp_old_q, st->old_A_fwd, st->old_rc_fwd,
+			A_t_fwd_q, ana, lsfq_mem, &st->seed);
 
 		for (i = 0; i < MA_NP; i++)
-			copy(&lsfq_mem[i][0], &freq_prev[i][0], M);
+			copy(&lsfq_mem[i][0], &st->freq_prev[i][0], M);
 
-		ppastVad = pastVad;
-		pastVad = Vad;
+		st->ppastVad = st->pastVad;
+		st->pastVad = Vad;
 
 		/* UPDATE wsp, mem_w, mem_syn, mem_err, and mem_w0 */
 		pAp = A_t_fwd;	/* pointer to interpolated LPC parameters           */
 		pAq = A_t_fwd_q;	/* pointer to interpolated quantized LPC parameters */
 		i_gamma = 0;
 		for (i_subfr = 0; i_subfr < L_FRAME; i_subfr += L_SUBFR) {
-			weight_az(pAp, gamma1[i_gamma], M, Ap1);
-			weight_az(pAp, gamma2[i_gamma], M, Ap2);
+			weight_az(pAp, st->gamma1[i_gamma], M, Ap1);
+			weight_az(pAp, st->gamma2[i_gamma], M, Ap2);
 			i_gamma++;
 
 			/* update mem_syn */
-			syn_filte(M, pAq, &exc[i_subfr], &synth_ptr[i_subfr],
-				  L_SUBFR, &mem_syn[M_BWD - M], 0);
+			syn_filte(M, pAq, &st->exc[i_subfr], &st->synth_ptr[i_subfr],
+				  L_SUBFR, &st->mem_syn[M_BWD - M], 0);
 			for (j = 0; j < M_BWD; j++)
-				mem_syn[j] =
-				    synth_ptr[i_subfr + L_SUBFR - M_BWD + j];
+				st->mem_syn[j] =
+				    st->synth_ptr[i_subfr + L_SUBFR - M_BWD + j];
 
 			/* update mem_w0 */
 			for (i = 0; i < L_SUBFR; i++)
-				error[i] =
-				    speech[i_subfr + i] - synth_ptr[i_subfr +
+				st->error[i] =
+				    st->speech[i_subfr + i] - st->synth_ptr[i_subfr +
 								    i];
-			residue(M, Ap1, error, xn, L_SUBFR);
-			syn_filte(M, Ap2, xn, xn, L_SUBFR, &mem_w0[M_BWD - M],
+			residue(M, Ap1, st->error, xn, L_SUBFR);
+			syn_filte(M, Ap2, xn, xn, L_SUBFR, &st->mem_w0[M_BWD - M],
 				  0);
 			for (j = 0; j < M_BWD; j++)
-				mem_w0[j] = xn[L_SUBFR - M_BWD + j];
+				st->mem_w0[j] = xn[L_SUBFR - M_BWD + j];
 
 			/* update mem_err */
 			for (i = L_SUBFR - M_BWD, j = 0; i < L_SUBFR; i++, j++)
-				mem_err[j] = error[i];
+				st->mem_err[j] = st->error[i];
 
 			for (i = 0; i < 4; i++)
-				pgain_buf[i] = pgain_buf[i + 1];
-			pgain_buf[4] = (float) 0.5;
+				st->pgain_buf[i] = st->pgain_buf[i + 1];
+			st->pgain_buf[4] = (float) 0.5;
 
 			pAp += MP1;
 			pAq += MP1;
 		}
 		/* update previous filter for next frame */
-		copy(&A_t_fwd_q[MP1], prev_filter, MP1);
+		copy(&A_t_fwd_q[MP1], st->prev_filter, MP1);
 		for (i = MP1; i < M_BWDP1; i++)
-			prev_filter[i] = (float) 0.;
-		prev_lp_mode = lp_mode;
+			st->prev_filter[i] = (float) 0.;
+		st->prev_lp_mode = lp_mode;
 
-		pit_sharp = SHARPMIN;
+		st->pit_sharp = SHARPMIN;
 
 		/* Update memories for next frames */
-		copy(&old_speech[L_FRAME], &old_speech[0], L_TOTAL - L_FRAME);
-		copy(&old_wsp[L_FRAME], &old_wsp[0], PIT_MAX);
-		copy(&old_exc[L_FRAME], &old_exc[0], PIT_MAX + L_INTERPOL);
+		copy(&st->old_speech[L_FRAME], &st->old_speech[0], L_TOTAL - L_FRAME);
+		copy(&st->old_wsp[L_FRAME], &st->old_wsp[0], PIT_MAX);
+		copy(&st->old_exc[L_FRAME], &st->old_exc[0], PIT_MAX + L_INTERPOL);
 		return;
 
 	}
@@ -483,34 +436,34 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
 		m_aq = M;
 		Aq = A_t_fwd_q;
 		/* update previous filter for next frame */
-		copy(&Aq[MP1], prev_filter, MP1);
+		copy(&Aq[MP1], st->prev_filter, MP1);
 		for (i = MP1; i < M_BWDP1; i++)
-			prev_filter[i] = (float) 0.;
+			st->prev_filter[i] = (float) 0.;
 		for (j = MP1; j < M_BWDP1; j++)
-			ai_zero[j] = (float) 0.;
+			st->ai_zero[j] = (float) 0.;
 	} else {
 		m_aq = M_BWD;
 		Aq = A_t_bwd;
-		if (bwd_dominant == 0) {
+		if (st->bwd_dominant == 0) {
 			for (j = MP1; j < M_BWDP1; j++)
-				ai_zero[j] = (float) 0.;
+				st->ai_zero[j] = (float) 0.;
 		}
 		/* update previous filter for next frame */
-		copy(&Aq[M_BWDP1], prev_filter, M_BWDP1);
+		copy(&Aq[M_BWDP1], st->prev_filter, M_BWDP1);
 	}
 
 	if (dtx_enable == 1) {
-		seed = INIT_SEED;
-		ppastVad = pastVad;
-		pastVad = Vad;
+		st->seed = INIT_SEED;
+		st->ppastVad = st->pastVad;
+		st->pastVad = Vad;
 	}
 
 	if (rate == G729E)
 		*ana++ = lp_mode;
 
 	if (lp_mode == 0) {
-		copy(lsp_new_q, lsp_old_q, M);
-		lsp_prev_update(freq_cur, freq_prev);
+		copy(lsp_new_q, st->lsp_old_q, M);
+		lsp_prev_update(freq_cur, st->freq_prev);
 		*ana++ = code_lsp[0];
 		*ana++ = code_lsp[1];
 	}
@@ -520,18 +473,18 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
     * - Set the range for searching closed-loop pitch in 1st subframe    *
     *--------------------------------------------------------------------*/
 
-	T_op = pitch_ol(wsp, PIT_MIN, PIT_MAX, L_FRAME);
+	T_op = pitch_ol(st->wsp, PIT_MIN, PIT_MAX, L_FRAME);
 
 	for (i = 0; i < 4; i++)
-		lag_buf[i] = lag_buf[i + 1];
+		st->lag_buf[i] = st->lag_buf[i + 1];
 
-	avg_lag = AVG(lag_buf[0], lag_buf[1], lag_buf[2], lag_buf[3]);
+	avg_lag = AVG(st->lag_buf[0], st->lag_buf[1], st->lag_buf[2], st->lag_buf[3]);
 	if (abs((int)(T_op / 2.0) - avg_lag) <= 2)
-		lag_buf[4] = (int)(T_op / 2.0);
+		st->lag_buf[4] = (int)(T_op / 2.0);
 	else if (abs((int)(T_op / 3.0) - avg_lag) <= 2)
-		lag_buf[4] = (int)(T_op / 3.0);
+		st->lag_buf[4] = (int)(T_op / 3.0);
 	else
-		lag_buf[4] = T_op;
+		st->lag_buf[4] = T_op;
 
 	/* Range for closed loop pitch search in 1st subframe */
 	t0_min = T_op - 3;
@@ -572,17 +525,17 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
     /*---------------------------------------------------------------*
     * Find the weighted LPC coefficients for the weighting filter.  *
         *---------------------------------------------------------------*/
-		weight_az(pAp, gamma1[i_gamma], m_ap, Ap1);
-		weight_az(pAp, gamma2[i_gamma], m_ap, Ap2);
+		weight_az(pAp, st->gamma1[i_gamma], m_ap, Ap1);
+		weight_az(pAp, st->gamma2[i_gamma], m_ap, Ap2);
 		i_gamma++;
 
 	/*---------------------------------------------------------------*
         * Compute impulse response, h1[], of weighted synthesis filter  *
         *---------------------------------------------------------------*/
 		for (i = 0; i <= m_ap; i++)
-			ai_zero[i] = Ap1[i];
-		syn_filte(m_aq, pAq, ai_zero, h1, L_SUBFR, zero, 0);
-		syn_filte(m_ap, Ap2, h1, h1, L_SUBFR, zero, 0);
+			st->ai_zero[i] = Ap1[i];
+		syn_filte(m_aq, pAq, st->ai_zero, h1, L_SUBFR, st->zero, 0);
+		syn_filte(m_ap, Ap2, h1, h1, L_SUBFR, st->zero, 0);
 
 	/*------------------------------------------------------------------------*
         *                                                                        *
@@ -609,15 +562,15 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
         * as these signals are already available.                                *
         *                                                                        *
         *------------------------------------------------------------------------*/
-		residue(m_aq, pAq, &speech[i_subfr], &exc[i_subfr], L_SUBFR);	/* LPC residual */
+		residue(m_aq, pAq, &st->speech[i_subfr], &st->exc[i_subfr], L_SUBFR);	/* LPC residual */
 		for (i = 0; i < L_SUBFR; i++)
-			res2[i] = exc[i_subfr + i];
-		syn_filte(m_aq, pAq, &exc[i_subfr], error, L_SUBFR,
-			  &mem_err[M_BWD - m_aq], 0);
-		residue(m_ap, Ap1, error, xn, L_SUBFR);
-		syn_filte(m_ap, Ap2, xn, xn, L_SUBFR, &mem_w0[M_BWD - m_ap], 0);	/* target signal xn[] */
+			res2[i] = st->exc[i_subfr + i];
+		syn_filte(m_aq, pAq, &st->exc[i_subfr], st->error, L_SUBFR,
+			  &st->mem_err[M_BWD - m_aq], 0);
+		residue(m_ap, Ap1, st->error, xn, L_SUBFR);
+		syn_filte(m_ap, Ap2, xn, xn, L_SUBFR, &st->mem_w0[M_BWD - m_ap], 0);	/* target signal xn[] */
 
-		t0 = pitch_fr3cp(&exc[i_subfr], xn, h1, L_SUBFR, t0_min, t0_max,
+		t0 = pitch_fr3cp(&st->exc[i_subfr], xn, h1, L_SUBFR, t0_min, t0_max,
 				 i_subfr, &t0_frac, rate);
 
 		index =
@@ -641,14 +594,14 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
         *   - update target vector for codebook search                    *
         *   - find LTP residual.                                          *
         *-----------------------------------------------------------------*/
-		pred_lt_3(&exc[i_subfr], t0, t0_frac, L_SUBFR);
+		pred_lt_3(&st->exc[i_subfr], t0, t0_frac, L_SUBFR);
 
-		convolve(&exc[i_subfr], h1, y1, L_SUBFR);
+		convolve(&st->exc[i_subfr], h1, y1, L_SUBFR);
 
 		gain_pit = g_pitch(xn, y1, g_coeff, L_SUBFR);
 
 		/* clip pitch gain if taming is necessary */
-		taming = test_err(t0, t0_frac);
+		taming = test_err(st->exc_err, t0, t0_frac);
 
 		if (taming == 1) {
 			if (gain_pit > GPCLIP) {
@@ -668,7 +621,7 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
 		case G729:	/* 8 kbit/s */
 			{
 				index =
-				    ACELP_codebook(xn2, h1, t0, pit_sharp,
+				    ACELP_codebook(&st->extra, xn2, h1, t0, st->pit_sharp,
 						   i_subfr, code, y2, &i);
 				*ana++ = index;	/* Positions index */
 				*ana++ = i;	/* Signs index     */
@@ -678,7 +631,7 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
 		case G729D:	/* 6.4 kbit/s */
 			{
 				index =
-				    ACELP_codebook64(xn2, h1, t0, pit_sharp,
+				    ACELP_codebook64(xn2, h1, t0, st->pit_sharp,
 						     code, y2, &i);
 				*ana++ = index;	/* Positions index */
 				*ana++ = i;	/* Signs index     */
@@ -692,13 +645,13 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
                 *-----------------------------------------------------------------*/
 				if (t0 < L_SUBFR) {
 					for (i = t0; i < L_SUBFR; i++) {
-						h1[i] += pit_sharp * h1[i - t0];
+						h1[i] += st->pit_sharp * h1[i - t0];
 					}
 				}
 
 				/* calculate residual after long term prediction */
 				for (i = 0; i < L_SUBFR; i++)
-					res2[i] -= gain_pit * exc[i + i_subfr];
+					res2[i] -= gain_pit * st->exc[i + i_subfr];
 				if (lp_mode == 0)
 					ACELP_10i40_35bits(xn2, res2, h1, code, y2, ana);	/* Forward */
 				else
@@ -711,7 +664,7 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
 				if (t0 < L_SUBFR)
 					for (i = t0; i < L_SUBFR; i++)
 						code[i] +=
-						    pit_sharp * code[i - t0];
+						    st->pit_sharp * code[i - t0];
 
 				break;
 			}
@@ -730,11 +683,11 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
 
 		if (rate == G729D)
 			index =
-			    qua_gain_6k(code, g_coeff, L_SUBFR, &gain_pit,
+			    qua_gain_6k(st->past_qua_en, code, g_coeff, L_SUBFR, &gain_pit,
 					&gain_code, taming);
 		else
 			index =
-			    qua_gain(code, g_coeff, L_SUBFR, &gain_pit,
+			    qua_gain(st->past_qua_en, code, g_coeff, L_SUBFR, &gain_pit,
 				     &gain_code, taming);
 
 		*ana++ = index;
@@ -743,14 +696,14 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
         * - Update pitch sharpening  with quantized gain_pit          *
         *------------------------------------------------------------*/
 		for (i = 0; i < 4; i++)
-			pgain_buf[i] = pgain_buf[i + 1];
-		pgain_buf[4] = gain_pit;
+			st->pgain_buf[i] = st->pgain_buf[i + 1];
+		st->pgain_buf[4] = gain_pit;
 
-		pit_sharp = gain_pit;
-		if (pit_sharp > SHARPMAX)
-			pit_sharp = SHARPMAX;
-		if (pit_sharp < SHARPMIN)
-			pit_sharp = SHARPMIN;
+		st->pit_sharp = gain_pit;
+		if (st->pit_sharp > SHARPMAX)
+			st->pit_sharp = SHARPMAX;
+		if (st->pit_sharp < SHARPMIN)
+			st->pit_sharp = SHARPMIN;
 
 	/*------------------------------------------------------*
         * - Find the total excitation                          *
@@ -761,20 +714,20 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
         *   update error function for taming process           *
         *------------------------------------------------------*/
 		for (i = 0; i < L_SUBFR; i++)
-			exc[i + i_subfr] =
-			    gain_pit * exc[i + i_subfr] + gain_code * code[i];
+			st->exc[i + i_subfr] =
+			    gain_pit * st->exc[i + i_subfr] + gain_code * code[i];
 
-		update_exc_err(gain_pit, t0);
+		update_exc_err(st->exc_err, gain_pit, t0);
 
-		syn_filte(m_aq, pAq, &exc[i_subfr], &synth_ptr[i_subfr],
-			  L_SUBFR, &mem_syn[M_BWD - m_aq], 0);
+		syn_filte(m_aq, pAq, &st->exc[i_subfr], &st->synth_ptr[i_subfr],
+			  L_SUBFR, &st->mem_syn[M_BWD - m_aq], 0);
 		for (j = 0; j < M_BWD; j++)
-			mem_syn[j] = synth_ptr[i_subfr + L_SUBFR - M_BWD + j];
+			st->mem_syn[j] = st->synth_ptr[i_subfr + L_SUBFR - M_BWD + j];
 
 		for (i = L_SUBFR - M_BWD, j = 0; i < L_SUBFR; i++, j++) {
-			mem_err[j] =
-			    speech[i_subfr + i] - synth_ptr[i_subfr + i];
-			mem_w0[j] =
+			st->mem_err[j] =
+			    st->speech[i_subfr + i] - st->synth_ptr[i_subfr + i];
+			st->mem_w0[j] =
 			    xn[i] - gain_pit * y1[i] - gain_code * y2[i];
 		}
 		pAp += m_ap + 1;
@@ -786,9 +739,9 @@ void coder_ld8c(int ana[],	/* output: analysis parameters */
     * -> shift to the left by L_FRAME:                 *
     *     speech[], wsp[] and  exc[]                   *
     *--------------------------------------------------*/
-	copy(&old_speech[L_FRAME], &old_speech[0], L_TOTAL - L_FRAME);
-	copy(&old_wsp[L_FRAME], &old_wsp[0], PIT_MAX);
-	copy(&old_exc[L_FRAME], &old_exc[0], PIT_MAX + L_INTERPOL);
-	prev_lp_mode = lp_mode;
+	copy(&st->old_speech[L_FRAME], &st->old_speech[0], L_TOTAL - L_FRAME);
+	copy(&st->old_wsp[L_FRAME], &st->old_wsp[0], PIT_MAX);
+	copy(&st->old_exc[L_FRAME], &st->old_exc[0], PIT_MAX + L_INTERPOL);
+	st->prev_lp_mode = lp_mode;
 	return;
 }
@@ -33,26 +33,22 @@
 #include "sid.h"
 #include "tab_dtx.h"
 
-static float cur_gain;
-static float lspSid[M];
-static float sid_gain;
-
 /*
 **
 ** Function:        init_dec_cng()
 **
-** Description:     Initialize dec_cng static variables
+** Description:     Initialize the decoder CNG state
 **
 **
 */
-void init_dec_cng(void)
+void init_dec_cng(struct dec_cng_state *st)
 {
 	int i;
 
 	for (i = 0; i < M; i++)
-		lspSid[i] = (float) cos(freq_prev_reset[i]);
+		st->lspSid[i] = (float) cos(freq_prev_reset[i]);
 
-	sid_gain = tab_Sidgain[0];
+	st->sid_gain = tab_Sidgain[0];
 
 	return;
 }
@@ -67,7 +63,9 @@ void init_dec_cng(void)
 *                     Computes current frame excitation     *
 *                     Computes current frame LSPs
 *-----------------------------------------------------------*/
-void dec_cng(int past_ftyp,	/* (i)   : past frame type                      */
+void dec_cng(struct dec_cng_state *st,
+	     struct phdisp_state *phd,	/* (i/o) : phase dispersion state       */
+	     int past_ftyp,	/* (i)   : past frame type                      */
 	     float sid_sav,	/* (i)   : energy to recover SID gain           */
 	     int *parm,		/* (i)   : coded SID parameters                 */
 	     float * exc,	/* (i/o) : excitation array                     */
@@ -84,10 +82,10 @@ void dec_cng(int past_ftyp,	/* (i)   : past frame type                      */
     /*************/
 	if (parm[0] != 0) {
 
-		sid_gain = tab_Sidgain[parm[4]];
+		st->sid_gain = tab_Sidgain[parm[4]];
 
 		/* Inverse quantization of the LSP */
-		sid_lsfq_decode(&parm[1], lspSid, freq_prev);
+		sid_lsfq_decode(&parm[1], st->lspSid, freq_prev);
 
 	}
 
@@ -99,47 +97,23 @@ void dec_cng(int past_ftyp,	/* (i)   : past frame type                      */
 		/* energy estimate stored in sid_gain         */
 		if (past_ftyp > 1) {
 			qua_Sidgain(&sid_sav, 0, &temp, &ind);
-			sid_gain = tab_Sidgain[ind];
+			st->sid_gain = tab_Sidgain[ind];
 		}
 
 	}
 
 	if (past_ftyp > 1) {
-		cur_gain = sid_gain;
+		st->cur_gain = st->sid_gain;
 	} else {
-		cur_gain *= A_GAIN0;
-		cur_gain += A_GAIN1 * sid_gain;
+		st->cur_gain *= A_GAIN0;
+		st->cur_gain += A_GAIN1 * st->sid_gain;
 	}
 
-	calc_exc_rand(cur_gain, exc, seed, FLAG_DEC);
+	calc_exc_rand(NULL, phd, st->cur_gain, exc, seed, FLAG_DEC);
 
 	/* Interpolate the Lsp vectors */
-	int_qlpc(lsp_old, lspSid, A_t);
-	copy(lspSid, lsp_old, M);
-
-	return;
-}
-
-/*---------------------------------------------------------------------------*
-* Function  init_lsfq_noise                                                 *
-* ~~~~~~~~~~~~~~~~~~~~~~~~~                                                 *
-*                                                                           *
-* -> Initialization of variables for the lsf quantization in the SID        *
-*                                                                           *
-*---------------------------------------------------------------------------*/
-void init_lsfq_noise(void)
-{
-	int i, j;
-
-	/* initialize the noise_fg */
-	for (i = 0; i < 4; i++)
-		copy(fg[0][i], noise_fg[0][i], M);
-
-	for (i = 0; i < 4; i++)
-		for (j = 0; j < M; j++) {
-			noise_fg[1][i][j] =
-			    fg[0][i][j] * (float) 0.6 + fg[1][i][j] * (float) 0.4;
-		}
+	int_qlpc(lsp_old, st->lspSid, A_t);
+	copy(st->lspSid, lsp_old, M);
 
 	return;
 }
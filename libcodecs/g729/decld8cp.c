@@ -19,6 +19,8 @@
 #include "ld8cp.h"
 #include "dtx.h"
 #include "sid.h"
+#include "vad.h"
+#include "state.h"
 
 /*---------------------------------------------------------------*
 *   Decoder constant parameters (defined in "ld8k.h")           *
@@ -33,113 +35,68 @@
 *   PRM_SIZE    : Size of vector containing analysis parameters *
 *---------------------------------------------------------------*/
 
-/*--------------------------------------------------------*
-*         Static memory allocation.                      *
-*--------------------------------------------------------*/
-
-/* Excitation vector */
-static float old_exc[L_FRAME + PIT_MAX + L_INTERPOL];
-static float *exc;
-
-/* Lsp (Line spectral pairs) */
-static float lsp_old[M] = {
+/* Lsp (Line spectral pairs) at reset */
+static float lsp_old_init[M] = {
 	(float) 0.9595, (float) 0.8413, (float) 0.6549, (float) 0.4154, (float) 0.1423,
 	(float) - 0.1423, (float) - 0.4154, (float) - 0.6549, (float) - 0.8413, (float) - 0.9595
 };
 
-static float mem_syn[M_BWD];	/* Filter's memory */
-
-static float sharp;		/* pitch sharpening of previous fr */
-static float gain_code;		/* fixed codebook gain */
-static float gain_pitch;	/* adaptive codebook gain */
-static int prev_t0;		/* integer delay of previous frame    */
-static int prev_t0_frac;	/* integer delay of previous frame    */
-
-/* for G.729B */
-static int16_t seed_fer;
-/* CNG variables */
-static int past_ftyp;
-static int16_t seed;
-static float sid_sav;
-
-/* for the backward analysis */
-static float rexp[M_BWDP1];
-static float A_bwd_mem[M_BWDP1];
-static float A_t_bwd_mem[M_BWDP1];
-static int prev_voicing, prev_bfi, prev_lp_mode;
-static float c_fe, c_int;
-static float prev_filter[M_BWDP1];	/* Previous selected filter */
-static int prev_pitch;
-static int stat_pitch;
-static int pitch_sta, frac_sta;
-
-/* Last backward A(z) for case of unstable filter */
-static float old_A_bwd[M_BWDP1];
-static float old_rc_bwd[2];
-
-static float gain_pit_mem;
-static float gain_cod_mem;
-static float c_muting;
-static int count_bfi;
-static int stat_bwd;
-
-static float freq_prev[MA_NP][M];
-
-/* static memory for frame erase operation */
-static int prev_ma;		/* previous MA prediction coef. */
-static float prev_lsp[M];	/* previous LSP vector */
-
 /*--------------------------------------------------------------------------
 * init_decod_ld8c - Initialization of variables for the decoder section.
 *--------------------------------------------------------------------------
 */
-void init_decod_ld8c(void)
+void init_decod_ld8c(struct g729_dec *st)
 {
+	int i;
+
 	/* Initialize static pointer */
-	exc = old_exc + PIT_MAX + L_INTERPOL;
+	st->exc = st->old_exc + PIT_MAX + L_INTERPOL;
 
 	/* Static vectors to zero */
-	set_zero(old_exc, PIT_MAX + L_INTERPOL);
-	set_zero(mem_syn, M_BWD);
-
-	sharp = SHARPMIN;
-	prev_t0 = 60;
-	prev_t0_frac = 0;
-	gain_code = (float) 0.;
-	gain_pitch = (float) 0.;
-
-	lsp_decw_resete(freq_prev, prev_lsp, &prev_ma);
-
-	set_zero(A_bwd_mem, M_BWDP1);
-	set_zero(A_t_bwd_mem, M_BWDP1);
-	A_bwd_mem[0] = (float) 1.;
-	A_t_bwd_mem[0] = (float) 1.;
-
-	prev_voicing = 0;
-	prev_bfi = 0;
-	prev_lp_mode = 0;
-	c_fe = (float) 0.;
-	c_int = (float) 1.1;	/* Filter interpolation parameter */
-	set_zero(prev_filter, M_BWDP1);
-	prev_filter[0] = (float) 1.;
-	prev_pitch = 30;
-	stat_pitch = 0;
-	set_zero(old_A_bwd, M_BWDP1);
-	set_zero(rexp, M_BWDP1);
-	old_A_bwd[0] = (float) 1.;
-	set_zero(old_rc_bwd, 2);
-	gain_pit_mem = (float) 0.;
-	gain_cod_mem = (float) 0.;
-	c_muting = (float) 1.;
-	count_bfi = 0;
-	stat_bwd = 0;
+	set_zero(st->old_exc, PIT_MAX + L_INTERPOL);
+	set_zero(st->mem_syn, M_BWD);
+
+	st->sharp = SHARPMIN;
+	st->prev_t0 = 60;
+	st->prev_t0_frac = 0;
+	st->gain_code = (float) 0.;
+	st->gain_pitch = (float) 0.;
+
+	copy(lsp_old_init, st->lsp_old, M);
+	lsp_decw_resete(st->freq_prev, st->prev_lsp, &st->prev_ma);
+	for (i = 0; i < 4; i++)
+		st->past_qua_en[i] = (float) - 14.0;
+	st->count_mode[0] = st->count_mode[1] = 0;
+
+	set_zero(st->A_bwd_mem, M_BWDP1);
+	set_zero(st->A_t_bwd_mem, M_BWDP1);
+	st->A_bwd_mem[0] = (float) 1.;
+	st->A_t_bwd_mem[0] = (float) 1.;
+
+	st->prev_voicing = 0;
+	st->prev_bfi = 0;
+	st->prev_lp_mode = 0;
+	st->c_fe = (float) 0.;
+	st->c_int = (float) 1.1;	/* Filter interpolation parameter */
+	set_zero(st->prev_filter, M_BWDP1);
+	st->prev_filter[0] = (float) 1.;
+	st->prev_pitch = 30;
+	st->stat_pitch = 0;
+	set_zero(st->old_A_bwd, M_BWDP1);
+	set_zero(st->rexp, M_BWDP1);
+	st->old_A_bwd[0] = (float) 1.;
+	set_zero(st->old_rc_bwd, 2);
+	st->gain_pit_mem = (float) 0.;
+	st->gain_cod_mem = (float) 0.;
+	st->c_muting = (float) 1.;
+	st->count_bfi = 0;
+	st->stat_bwd = 0;
 
 	/* for G.729B */
-	seed_fer = (int16_t) 21845;
-	past_ftyp = 3;
-	seed = INIT_SEED;
-	sid_sav = (float) 0.;
-	init_lsfq_noise();
+	st->seed_fer = (int16_t) 21845;
+	st->past_ftyp = 3;
+	st->seed = INIT_SEED;
+	st->sid_sav = (float) 0.;
 
 	return;
 }
@@ -148,7 +105,8 @@ void init_decod_ld8c(void)
 * decod_ld8c - decoder
 *--------------------------------------------------------------------------
 */
-void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
+void decod_ld8c(struct g729_dec *st,	/* (i/o) : decoder state                        */
+		int parm[],	/* (i)   : vector of synthesis parameters
 				   parm[0] = bad frame indicator (bfi)    */
 		int voicing,	/* (i)   : voicing decision from previous frame */
 		float synth_buf[],	/* (i/o) : synthesis speech                     */
@@ -197,14 +155,14 @@ void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
 	ftyp = *parm++;
 
 	if (bfi == 1) {
-		ftyp = past_ftyp;
+		ftyp = st->past_ftyp;
 		if (ftyp == 1)
 			ftyp = 0;
 		if (ftyp > 2) {	/* G.729 maintenance */
 			if (ftyp == 3)
 				parm[4] = 1;
 			else {
-				if (prev_lp_mode == 0)
+				if (st->prev_lp_mode == 0)
 					parm[5] = 1;
 				else
 					parm[3] = 1;
@@ -222,17 +180,17 @@ void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
 		lp_mode = 0;
 	else {
 		if (bfi != 0) {
-			lp_mode = prev_lp_mode;	/* Frame erased => lp_mode = previous lp_mode */
+			lp_mode = st->prev_lp_mode;	/* Frame erased => lp_mode = previous lp_mode */
 			*parm++ = lp_mode;
 		} else {
 			lp_mode = *parm++;
 		}
-		if (prev_bfi != 0)
-			voicing = prev_voicing;
+		if (st->prev_bfi != 0)
+			voicing = st->prev_voicing;
 	}
 	if (bfi == 0) {
-		c_muting = (float) 1.;
-		count_bfi = 0;
+		st->c_muting = (float) 1.;
+		st->count_bfi = 0;
 	}
 
 	/* -------------------- */
@@ -240,13 +198,13 @@ void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
 	/* -------------------- */
 	if (rate == G729E) {
 		/* LPC recursive Window as in G728 */
-		autocorr_hyb_window(synth_buf, r_bwd, rexp);	/* Autocorrelations */
+		autocorr_hyb_window(synth_buf, r_bwd, st->rexp);	/* Autocorrelations */
 
 		glag_window_bwd(r_bwd);	/* Lag windowing    */
 
 		/* Levinson (as in G729) */
 		levinsone(M_BWD, r_bwd, &A_t_bwd[M_BWDP1], rc_bwd,
-			  old_A_bwd, old_rc_bwd);
+			  st->old_A_bwd, st->old_rc_bwd);
 
 		/* Tests saturation of A_t_bwd */
 		sat_filter = 0;
@@ -254,9 +212,9 @@ void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
 			if (A_t_bwd[i] >= (float) 8.)
 				sat_filter = 1;
 		if (sat_filter == 1)
-			copy(A_t_bwd_mem, &A_t_bwd[M_BWDP1], M_BWDP1);
+			copy(st->A_t_bwd_mem, &A_t_bwd[M_BWDP1], M_BWDP1);
 		else
-			copy(&A_t_bwd[M_BWDP1], A_t_bwd_mem, M_BWDP1);
+			copy(&A_t_bwd[M_BWDP1], st->A_t_bwd_mem, M_BWDP1);
 
 		/* Additional bandwidth expansion on backward filter */
 		weight_az(&A_t_bwd[M_BWDP1], GAMMA_BWD, M_BWD,
@@ -268,63 +226,64 @@ void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
 	copy(&synth_buf[L_FRAME], &synth_buf[0], MEM_SYN_BWD);
 
 	if (lp_mode == 1) {
-		if ((c_fe != (float) 0.)) {
+		if ((st->c_fe != (float) 0.)) {
 			/* Interpolation of the backward filter after a bad frame */
 			/* A_t_bwd(z) = c_fe . A_bwd_mem(z) + (1 - c_fe) . A_t_bwd(z) */
 			/* ---------------------------------------------------------- */
-			tmp = (float) 1. - c_fe;
+			tmp = (float) 1. - st->c_fe;
 			pA_t = A_t_bwd + M_BWDP1;
 			for (i = 0; i < M_BWDP1; i++) {
 				pA_t[i] *= tmp;
-				pA_t[i] += c_fe * A_bwd_mem[i];
+				pA_t[i] += st->c_fe * st->A_bwd_mem[i];
 			}
 		}
 	}
 
 	/* Memorize the last good backward filter when the frame is erased */
-	if ((bfi != 0) && (prev_bfi == 0) && (past_ftyp > 3))
-		copy(&A_t_bwd[M_BWDP1], A_bwd_mem, M_BWDP1);
+	if ((bfi != 0) && (st->prev_bfi == 0) && (st->past_ftyp > 3))
+		copy(&A_t_bwd[M_BWDP1], st->A_bwd_mem, M_BWDP1);
 
 	/* for G.729B */
 	/* Processing non active frames (SID & not transmitted: ftyp = 1 or 0) */
 	if (ftyp < 2) {
 		/* get_decfreq_prev(lsfq_mem); */
 		for (i = 0; i < MA_NP; i++)
-			copy(&freq_prev[i][0], &lsfq_mem[i][0], M);
+			copy(&st->freq_prev[i][0], &lsfq_mem[i][0], M);
 
-		dec_cng(past_ftyp, sid_sav, &parm[-1], exc, lsp_old,
-			A_t_fwd, &seed, lsfq_mem);
+		dec_cng(&st->cng, &st->phd, st->past_ftyp, st->sid_sav,
+			&parm[-1], st->exc, st->lsp_old,
+			A_t_fwd, &st->seed, lsfq_mem);
 
 		/*   update_decfreq_prev(lsfq_mem); */
 		for (i = 0; i < MA_NP; i++)
-			copy(&lsfq_mem[i][0], &freq_prev[i][0], M);
+			copy(&lsfq_mem[i][0], &st->freq_prev[i][0], M);
 
 		pA_t = A_t_fwd;
 		for (i_subfr = 0; i_subfr < L_FRAME; i_subfr += L_SUBFR) {
-			syn_filte(M, pA_t, &exc[i_subfr], &synth[i_subfr],
-				  L_SUBFR, &mem_syn[M_BWD - M], 0);
-			copy(&synth[i_subfr + L_SUBFR - M_BWD], mem_syn, M_BWD);
+			syn_filte(M, pA_t, &st->exc[i_subfr], &synth[i_subfr],
+				  L_SUBFR, &st->mem_syn[M_BWD - M], 0);
+			copy(&synth[i_subfr + L_SUBFR - M_BWD], st->mem_syn, M_BWD);
 
-			*t0_first = prev_t0;
+			*t0_first = st->prev_t0;
 			pA_t += MP1;
 		}
-		sharp = SHARPMIN;
-		c_int = (float) 1.1;
+		st->sharp = SHARPMIN;
+		st->c_int = (float) 1.1;
 		/* for gain decoding in case of frame erasure */
-		stat_bwd = 0;
+		st->stat_bwd = 0;
 		/* for pitch tracking  in case of frame erasure */
-		stat_pitch = 0;
+		st->stat_pitch = 0;
 		/* update the previous filter for the next frame */
-		copy(&A_t_fwd[MP1], prev_filter, MP1);
+		copy(&A_t_fwd[MP1], st->prev_filter, MP1);
 		for (i = MP1; i < M_BWDP1; i++)
-			prev_filter[i] = (float) 0.;
+			st->prev_filter[i] = (float) 0.;
 	}
 
     /***************************/
 	/* Processing active frame */
     /***************************/
 	else {
-		seed = INIT_SEED;
+		st->seed = INIT_SEED;
 
 		/* ---------------------------- */
 		/* LPC decoding in forward mode */
@@ -332,11 +291,11 @@ void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
 		if (lp_mode == 0) {
 
 			/* Decode the LSPs */
-			d_lspe(parm, lsp_new, bfi, freq_prev, prev_lsp,
-			       &prev_ma);
+			d_lspe(parm, lsp_new, bfi, st->freq_prev, st->prev_lsp,
+			       &st->prev_ma);
 			parm += 2;
-			if (prev_lp_mode == 0) {	/* Interpolation of LPC for the 2 subframes */
-				int_qlpc(lsp_old, lsp_new, A_t_fwd);
+			if (st->prev_lp_mode == 0) {	/* Interpolation of LPC for the 2 subframes */
+				int_qlpc(st->lsp_old, lsp_new, A_t_fwd);
 			} else {
 				/* no interpolation */
 				lsp_az(lsp_new, A_t_fwd);	/* Subframe 1 */
@@ -344,21 +303,21 @@ void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
 			}
 
 			/* update the LSFs for the next frame */
-			copy(lsp_new, lsp_old, M);
+			copy(lsp_new, st->lsp_old, M);
 
-			c_int = (float) 1.1;
+			st->c_int = (float) 1.1;
 			pA_t = A_t_fwd;
 			m_aq = M;
 			/* update the previous filter for the next frame */
-			copy(&A_t_fwd[MP1], prev_filter, MP1);
+			copy(&A_t_fwd[MP1], st->prev_filter, MP1);
 			for (i = MP1; i < M_BWDP1; i++)
-				prev_filter[i] = (float) 0.;
+				st->prev_filter[i] = (float) 0.;
 		} else {
-			int_bwd(A_t_bwd, prev_filter, &c_int);
+			int_bwd(A_t_bwd, st->prev_filter, &st->c_int);
 			pA_t = A_t_bwd;
 			m_aq = M_BWD;
 			/* update the previous filter for the next frame */
-			copy(&A_t_bwd[M_BWDP1], prev_filter, M_BWDP1);
+			copy(&A_t_bwd[M_BWDP1], st->prev_filter, M_BWDP1);
 		}
 
 	/*------------------------------------------------------------------------*
@@ -387,20 +346,20 @@ void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
 					dec_lag3cp(index, PIT_MIN, PIT_MAX,
 						   i_subfr, &t0, &t0_frac,
 						   rate);
-					prev_t0 = t0;
-					prev_t0_frac = t0_frac;
+					st->prev_t0 = t0;
+					st->prev_t0_frac = t0_frac;
 				} else {	/* Bad frame, or parity error */
 					if (bfi == 0)
 						printf
 						    (" ! Wrong Pitch 1st subfr. !   ");
-					t0 = prev_t0;
+					t0 = st->prev_t0;
 					if (rate == G729E) {
-						t0_frac = prev_t0_frac;
+						t0_frac = st->prev_t0_frac;
 					} else {
 						t0_frac = 0;
-						prev_t0++;
-						if (prev_t0 > PIT_MAX) {
-							prev_t0 = PIT_MAX;
+						st->prev_t0++;
+						if (st->prev_t0 > PIT_MAX) {
+							st->prev_t0 = PIT_MAX;
 						}
 					}
 				}
@@ -411,36 +370,36 @@ void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
 					dec_lag3cp(index, PIT_MIN, PIT_MAX,
 						   i_subfr, &t0, &t0_frac,
 						   rate);
-					prev_t0 = t0;
-					prev_t0_frac = t0_frac;
+					st->prev_t0 = t0;
+					st->prev_t0_frac = t0_frac;
 				} else {
-					t0 = prev_t0;
+					t0 = st->prev_t0;
 					if (rate == G729E) {
-						t0_frac = prev_t0_frac;
+						t0_frac = st->prev_t0_frac;
 					} else {
 						t0_frac = 0;
-						prev_t0++;
-						if (prev_t0 > PIT_MAX)
-							prev_t0 = PIT_MAX;
+						st->prev_t0++;
+						if (st->prev_t0 > PIT_MAX)
+							st->prev_t0 = PIT_MAX;
 					}
 				}
 			}
 	    /*-------------------------------------------------*
             * - Find the adaptive codebook vector.            *
             *-------------------------------------------------*/
-			pred_lt_3(&exc[i_subfr], t0, t0_frac, L_SUBFR);
+			pred_lt_3(&st->exc[i_subfr], t0, t0_frac, L_SUBFR);
 
 			/* --------------------------------- */
 			/* pitch tracking for frame erasures */
 			/* --------------------------------- */
 			if (rate == G729E) {
-				track_pit(&prev_t0, &prev_t0_frac, &prev_pitch,
-					  &stat_pitch, &pitch_sta, &frac_sta);
+				track_pit(&st->prev_t0, &st->prev_t0_frac, &st->prev_pitch,
+					  &st->stat_pitch, &st->pitch_sta, &st->frac_sta);
 			} else {
-				i = prev_t0;
-				j = prev_t0_frac;
-				track_pit(&i, &j, &prev_pitch, &stat_pitch,
-					  &pitch_sta, &frac_sta);
+				i = st->prev_t0;
+				j = st->prev_t0_frac;
+				track_pit(&i, &j, &st->prev_pitch, &st->stat_pitch,
+					  &st->pitch_sta, &st->frac_sta);
 			}
 
 	    /*-------------------------------------------------------*
@@ -448,12 +407,12 @@ void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
             *-------------------------------------------------------*/
 			if (bfi != 0) {	/* Bad frame */
 
-				parm[0] = (int)random_g729c(&seed_fer);
-				parm[1] = (int)random_g729c(&seed_fer);
+				parm[0] = (int)random_g729c(&st->seed_fer);
+				parm[1] = (int)random_g729c(&st->seed_fer);
 				if (rate == G729E) {
-					parm[2] = (int)random_g729c(&seed_fer);
-					parm[3] = (int)random_g729c(&seed_fer);
-					parm[4] = (int)random_g729c(&seed_fer);
+					parm[2] = (int)random_g729c(&st->seed_fer);
+					parm[3] = (int)random_g729c(&st->seed_fer);
+					parm[4] = (int)random_g729c(&st->seed_fer);
 				}
 
 			}
@@ -464,29 +423,29 @@ void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
 				decod_ACELP(parm[1], parm[0], code);
 				parm += 2;
 				/* for gain decoding in case of frame erasure */
-				stat_bwd = 0;
+				st->stat_bwd = 0;
 				stationnary = 0;
 			} else if (rate == G729D) {
 				/* case 8 kbps */
 				decod_ACELP64(parm[1], parm[0], code);
 				parm += 2;
 				/* for gain decoding in case of frame erasure */
-				stat_bwd = 0;
+				st->stat_bwd = 0;
 				stationnary = 0;
 			} else if (rate == G729E) {
 				/* case 11.8 kbps */
 				if (lp_mode == 0) {
 					dec_ACELP_10i40_35bits(parm, code);
 					/* for gain decoding in case of frame erasure */
-					stat_bwd = 0;
+					st->stat_bwd = 0;
 					stationnary = 0;
 				} else {
 					dec_ACELP_12i40_44bits(parm, code);
 					/* for gain decoding in case of frame erasure */
-					stat_bwd++;
-					if (stat_bwd >= 30) {
+					st->stat_bwd++;
+					if (st->stat_bwd >= 30) {
 						stationnary = 1;
-						stat_bwd = 30;
+						st->stat_bwd = 30;
 					} else
 						stationnary = 0;
 				}
@@ -497,7 +456,7 @@ void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
             * - Add the fixed-gain pitch contribution to code[].    *
             *-------------------------------------------------------*/
 			for (i = t0; i < L_SUBFR; i++)
-				code[i] += sharp * code[i - t0];
+				code[i] += st->sharp * code[i - t0];
 
 	    /*-------------------------------------------------*
             * - Decode pitch and codebook gains.              *
@@ -505,68 +464,68 @@ void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
 			index = *parm++;	/* index of energy VQ */
 
 			if (rate == G729D)
-				dec_gain_6k(index, code, L_SUBFR, bfi,
-					    &gain_pitch, &gain_code);
+				dec_gain_6k(st->past_qua_en, index, code, L_SUBFR, bfi,
+					    &st->gain_pitch, &st->gain_code);
 			else
-				dec_gaine(index, code, L_SUBFR, bfi,
-					  &gain_pitch, &gain_code, rate,
-					  gain_pit_mem, gain_cod_mem, &c_muting,
-					  count_bfi, stationnary);
+				dec_gaine(st->past_qua_en, index, code, L_SUBFR, bfi,
+					  &st->gain_pitch, &st->gain_code, rate,
+					  st->gain_pit_mem, st->gain_cod_mem, &st->c_muting,
+					  st->count_bfi, stationnary);
 
 		/*-------------------------------------------------------------*
                 * - Update previous gains
             *-------------------------------------------------------------*/
-			gain_pit_mem = gain_pitch;
-			gain_cod_mem = gain_code;
+			st->gain_pit_mem = st->gain_pitch;
+			st->gain_cod_mem = st->gain_code;
 	    /*-------------------------------------------------------------*
             * - Update pitch sharpening "sharp" with quantized gain_pitch *
             *-------------------------------------------------------------*/
-			sharp = gain_pitch;
-			if (sharp > SHARPMAX)
-				sharp = SHARPMAX;
-			if (sharp < SHARPMIN)
-				sharp = SHARPMIN;
+			st->sharp = st->gain_pitch;
+			if (st->sharp > SHARPMAX)
+				st->sharp = SHARPMAX;
+			if (st->sharp < SHARPMIN)
+				st->sharp = SHARPMIN;
 
 	    /*-------------------------------------------------------*
             * - Find the total excitation.                          *
             * - Find synthesis speech corresponding to exc[].       *
             *-------------------------------------------------------*/
 			if (bfi != 0) {	/* Bad frame */
-				count_bfi++;
+				st->count_bfi++;
 				if (voicing == 0) {
 					g_p = (float) 0.;
-					g_c = gain_code;
+					g_c = st->gain_code;
 				} else {
-					g_p = gain_pitch;
+					g_p = st->gain_pitch;
 					g_c = (float) 0.;
 				}
 			} else {
-				g_p = gain_pitch;
-				g_c = gain_code;
+				g_p = st->gain_pitch;
+				g_c = st->gain_code;
 			}
 
 			for (i = 0; i < L_SUBFR; i++) {
-				exc[i + i_subfr] =
-				    g_p * exc[i + i_subfr] + g_c * code[i];
+				st->exc[i + i_subfr] =
+				    g_p * st->exc[i + i_subfr] + g_c * code[i];
 			}
 
 			if (rate == G729D) {
-				PhDisp(&exc[i_subfr], exc_phdisp, gain_code,
-				       gain_pitch, code);
+				PhDisp(&st->phd, &st->exc[i_subfr], exc_phdisp, st->gain_code,
+				       st->gain_pitch, code);
 				syn_filte(m_aq, pA_t, exc_phdisp,
 					  &synth[i_subfr], L_SUBFR,
-					  &mem_syn[M_BWD - m_aq], 0);
+					  &st->mem_syn[M_BWD - m_aq], 0);
 			} else {
-				syn_filte(m_aq, pA_t, &exc[i_subfr],
+				syn_filte(m_aq, pA_t, &st->exc[i_subfr],
 					  &synth[i_subfr], L_SUBFR,
-					  &mem_syn[M_BWD - m_aq], 0);
+					  &st->mem_syn[M_BWD - m_aq], 0);
 
 				/* Updates state machine for phase dispersion in
 				   6.4 kbps mode, if running at other rate */
-				Update_PhDisp(gain_pitch, gain_code);
+				Update_PhDisp(&st->phd, st->gain_pitch, st->gain_code);
 			}
 
-			copy(&synth[i_subfr + L_SUBFR - M_BWD], mem_syn, M_BWD);
+			copy(&synth[i_subfr + L_SUBFR - M_BWD], st->mem_syn, M_BWD);
 
 			pA_t += m_aq + 1;	/* interpolated LPC parameters for next subframe */
 
@@ -578,25 +537,25 @@ void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
      *  For G729b
      *-----------*/
 	if (bfi == 0) {
-		sid_sav = (float) 0.0;
+		st->sid_sav = (float) 0.0;
 		for (i = 0; i < L_FRAME; i++) {
-			sid_sav += exc[i] * exc[i];
+			st->sid_sav += st->exc[i] * st->exc[i];
 		}
 	}
-	past_ftyp = ftyp;
+	st->past_ftyp = ftyp;
 
     /*------------*
      *  For G729E
      *-----------*/
 	energy = ener_dB(synth, L_FRAME);
 	if (energy >= (float) 40.)
-		tst_bwd_dominant(bwd_dominant, lp_mode);
+		tst_bwd_dominant(st->count_mode, bwd_dominant, lp_mode);
 
     /*--------------------------------------------------*
     * Update signal for next frame.                    *
     * -> shift to the left by L_FRAME  exc[]           *
     *--------------------------------------------------*/
-	copy(&old_exc[L_FRAME], &old_exc[0], PIT_MAX + L_INTERPOL);
+	copy(&st->old_exc[L_FRAME], &st->old_exc[0], PIT_MAX + L_INTERPOL);
 
 	if (lp_mode == 0) {
 		copy(A_t_fwd, Az_dec, 2 * MP1);
@@ -606,22 +565,22 @@ void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
 		*m_pst = M_BWD;
 	}
 
-	prev_bfi = bfi;
-	prev_lp_mode = lp_mode;
-	prev_voicing = voicing;
+	st->prev_bfi = bfi;
+	st->prev_lp_mode = lp_mode;
+	st->prev_voicing = voicing;
 
 	if (bfi != 0)
-		c_fe = (float) 1.;
+		st->c_fe = (float) 1.;
 	else {
 		if (lp_mode == 0)
-			c_fe = 0;
+			st->c_fe = 0;
 		else {
 			if (*bwd_dominant == 1)
-				c_fe -= (float) 0.1;
+				st->c_fe -= (float) 0.1;
 			else
-				c_fe -= (float) 0.5;
-			if (c_fe < 0)
-				c_fe = 0;
+				st->c_fe -= (float) 0.5;
+			if (st->c_fe < 0)
+				st->c_fe = 0;
 		}
 	}
 
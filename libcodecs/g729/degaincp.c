@@ -16,13 +16,12 @@
 #include "ld8cp.h"
 #include "tabld8cp.h"
 
-static float past_qua_en[4] =
-    { (float) - 14.0, (float) - 14.0, (float) - 14.0, (float) - 14.0 };
 /*----------------------------------------------------------------------------
 * dec_gain - decode the adaptive and fixed codebook gains
 *----------------------------------------------------------------------------
 */
-void dec_gaine(int index,	/* input : quantizer index              */
+void dec_gaine(float past_qua_en[],	/* in/out: past quantized energies   */
+	       int index,	/* input : quantizer index              */
 	       float code[],	/* input : fixed code book vector       */
 	       int l_subfr,	/* input : subframe size                */
 	       int bfi,		/* input : bad frame indicator good = 0 */
@@ -99,7 +98,8 @@ void dec_gaine(int index,	/* input : quantizer index              */
 	return;
 }
 
-void dec_gain_6k(int index,	/* input : quantizer index              */
+void dec_gain_6k(float past_qua_en[],	/* in/out: past quantized energies   */
+		 int index,	/* input : quantizer index              */
 		 float code[],	/* input : fixed code book vector       */
 		 int l_subfr,	/* input : subframe size                */
 		 int bfi,	/* input : bad frame indicator good = 0 */
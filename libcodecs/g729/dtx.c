@@ -24,49 +24,35 @@
 #include "tab_dtx.h"
 #include "sid.h"
 
-/* Static Variables */
-static float lspSid_q[M];
-static float pastCoeff[MP1];
-static float RCoeff[MP1];
-static float Acf[SIZ_ACF];
-static float sumAcf[SIZ_SUMACF];
-static float ener[NB_GAIN];
-static int fr_cur;
-static float cur_gain;
-static int nb_ener;
-static float sid_gain;
-static int flag_chang;
-static float prev_energy;
-static int count_fr0;
-
 /* Local functions */
-static void calc_pastfilt(float * Coeff, float old_A[], float old_rc[]);
+static void calc_pastfilt(struct cod_cng_state *st, float * Coeff,
+			  float old_A[], float old_rc[]);
 static void calc_RCoeff(float * Coeff, float * RCoeff);
 static int cmp_filt(float * RCoeff, float * acf, float alpha, float Thresh);
 static void calc_sum_acf(float * acf, float * sum, int nb);
-static void update_sumAcf(void);
+static void update_sumAcf(struct cod_cng_state *st);
 
 /*-----------------------------------------------------------*
 * procedure init_Cod_cng:                                   *
 *           ~~~~~~~~~~~~                                    *
 *   Initialize variables used for dtx at the encoder        *
 *-----------------------------------------------------------*/
-void init_cod_cng(void)
+void init_cod_cng(struct cod_cng_state *st)
 {
 	int i;
 
 	for (i = 0; i < SIZ_SUMACF; i++)
-		sumAcf[i] = (float) 0.;
+		st->sumAcf[i] = (float) 0.;
 
 	for (i = 0; i < SIZ_ACF; i++)
-		Acf[i] = (float) 0.;
+		st->Acf[i] = (float) 0.;
 
 	for (i = 0; i < NB_GAIN; i++)
-		ener[i] = (float) 0.;
+		st->ener[i] = (float) 0.;
 
-	cur_gain = 0;
-	fr_cur = 0;
-	flag_chang = 0;
+	st->cur_gain = 0;
+	st->fr_cur = 0;
+	st->flag_chang = 0;
 
 	return;
 }
@@ -78,7 +64,9 @@ void init_cod_cng(void)
 *   encodes SID frames                                      *
 *   computes CNG excitation for encoder update              *
 *-----------------------------------------------------------*/
-void cod_cng(float * exc,	/* (i/o) : excitation array                     */
+void cod_cng(struct cod_cng_state *st,
+	     float exc_err[],	/* (i/o) : taming memory of the encoder         */
+	     float * exc,	/* (i/o) : excitation array                     */
 	     int pastVad,	/* (i)   : previous VAD decision                */
 	     float * lsp_old_q,	/* (i/o) : previous quantized lsp               */
 	     float * old_A,	/* (i/o) : last stable filter LPC coefficients  */
@@ -101,111 +89,111 @@ void cod_cng(float * exc,	/* (i/o) : excitation array                     */
 
 	/* Update Ener */
 	for (i = NB_GAIN - 1; i >= 1; i--) {
-		ener[i] = ener[i - 1];
+		st->ener[i] = st->ener[i - 1];
 	}
 
 	/* Compute current Acfs */
-	calc_sum_acf(Acf, curAcf, NB_CURACF);
+	calc_sum_acf(st->Acf, curAcf, NB_CURACF);
 
 	/* Compute LPC coefficients and residual energy */
 	if (curAcf[0] == (float) 0.) {
-		ener[0] = (float) 0.;	/* should not happen */
+		st->ener[0] = (float) 0.;	/* should not happen */
 	} else {
-		ener[0] = levinsone(M, curAcf, curCoeff, bid, old_A, old_rc);
+		st->ener[0] = levinsone(M, curAcf, curCoeff, bid, old_A, old_rc);
 	}
 
 	/* if first frame of silence => SID frame */
 	if (pastVad != 0) {
 		ana[0] = 1;
-		count_fr0 = 0;
-		nb_ener = 1;
-		qua_Sidgain(ener, nb_ener, &energyq, &cur_igain);
+		st->count_fr0 = 0;
+		st->nb_ener = 1;
+		qua_Sidgain(st->ener, st->nb_ener, &energyq, &cur_igain);
 	} else {
-		nb_ener++;
-		if (nb_ener > NB_GAIN)
-			nb_ener = NB_GAIN;
-		qua_Sidgain(ener, nb_ener, &energyq, &cur_igain);
+		st->nb_ener++;
+		if (st->nb_ener > NB_GAIN)
+			st->nb_ener = NB_GAIN;
+		qua_Sidgain(st->ener, st->nb_ener, &energyq, &cur_igain);
 
 		/* Compute stationarity of current filter   */
 		/* versus reference filter                  */
-		if (cmp_filt(RCoeff, curAcf, ener[0], THRESH1) != 0) {
-			flag_chang = 1;
+		if (cmp_filt(st->RCoeff, curAcf, st->ener[0], THRESH1) != 0) {
+			st->flag_chang = 1;
 		}
 
 		/* compare energy difference between current frame and last frame */
-		if ((float) fabs(prev_energy - energyq) > (float) 2.0)
-			flag_chang = 1;
+		if ((float) fabs(st->prev_energy - energyq) > (float) 2.0)
+			st->flag_chang = 1;
 
-		count_fr0++;
-		if (count_fr0 < FR_SID_MIN) {
+		st->count_fr0++;
+		if (st->count_fr0 < FR_SID_MIN) {
 			ana[0] = 0;	/* no transmission */
 		} else {
-			if (flag_chang != 0) {
+			if (st->flag_chang != 0) {
 				ana[0] = 1;	/* transmit SID frame */
 			} else {
 				ana[0] = 0;
 			}
-			count_fr0 = FR_SID_MIN;	/* to avoid overflow */
+			st->count_fr0 = FR_SID_MIN;	/* to avoid overflow */
 		}
 	}
 
 	if (ana[0] == 1) {
 
 		/* Reset frame count and change flag */
-		count_fr0 = 0;
-		flag_chang = 0;
+		st->count_fr0 = 0;
+		st->flag_chang = 0;
 
 		/* Compute past average filter */
-		calc_pastfilt(pastCoeff, old_A, old_rc);
-		calc_RCoeff(pastCoeff, RCoeff);
+		calc_pastfilt(st, st->pastCoeff, old_A, old_rc);
+		calc_RCoeff(st->pastCoeff, st->RCoeff);
 
 		/* Compute stationarity of current filter   */
 		/* versus past average filter               */
 
 		/* if stationary */
 		/* transmit average filter => new ref. filter */
-		if (cmp_filt(RCoeff, curAcf, ener[0], THRESH2) == 0) {
-			lpcCoeff = pastCoeff;
+		if (cmp_filt(st->RCoeff, curAcf, st->ener[0], THRESH2) == 0) {
+			lpcCoeff = st->pastCoeff;
 		}
 
 		/* else */
 		/* transmit current filter => new ref. filter */
 		else {
 			lpcCoeff = curCoeff;
-			calc_RCoeff(curCoeff, RCoeff);
+			calc_RCoeff(curCoeff, st->RCoeff);
 		}
 
 		/* Compute SID frame codes */
 		az_lsp(lpcCoeff, lsp_new, lsp_old_q);	/* From A(z) to lsp */
 
 		/* LSP quantization */
-		lsfq_noise(lsp_new, lspSid_q, freq_prev, &ana[1]);
+		lsfq_noise(lsp_new, st->lspSid_q, freq_prev, &ana[1]);
 
-		prev_energy = energyq;
+		st->prev_energy = energyq;
 		ana[4] = cur_igain;
-		sid_gain = tab_Sidgain[cur_igain];
+		st->sid_gain = tab_Sidgain[cur_igain];
 
 	}
 
 	/* end of SID frame case */
 	/* Compute new excitation */
 	if (pastVad != 0) {
-		cur_gain = sid_gain;
+		st->cur_gain = st->sid_gain;
 	} else {
-		cur_gain *= A_GAIN0;
-		cur_gain += A_GAIN1 * sid_gain;
+		st->cur_gain *= A_GAIN0;
+		st->cur_gain += A_GAIN1 * st->sid_gain;
 	}
 
-	calc_exc_rand(cur_gain, exc, seed, FLAG_COD);
+	calc_exc_rand(exc_err, NULL, st->cur_gain, exc, seed, FLAG_COD);
 
-	int_qlpc(lsp_old_q, lspSid_q, Aq);
+	int_qlpc(lsp_old_q, st->lspSid_q, Aq);
 	for (i = 0; i < M; i++) {
-		lsp_old_q[i] = lspSid_q[i];
+		lsp_old_q[i] = st->lspSid_q[i];
 	}
 
 	/* Update sumAcf if fr_cur = 0 */
-	if (fr_cur == 0) {
-		update_sumAcf();
+	if (st->fr_cur == 0) {
+		update_sumAcf(st);
 	}
 
 	return;
@@ -218,7 +206,8 @@ void cod_cng(float * exc,	/* (i/o) : excitation array                     */
 *   used for DTX/CNG                                        *
 *   If Vad=1 : updating of array sumAcf                     *
 *-----------------------------------------------------------*/
-void update_cng(float * r,	/* (i) :   frame autocorrelation               */
+void update_cng(struct cod_cng_state *st,
+		float * r,	/* (i) :   frame autocorrelation               */
 		int Vad		/* (i) :   current Vad decision                */
     )
 {
@@ -226,7 +215,7 @@ void update_cng(float * r,	/* (i) :   frame autocorrelation               */
 	float *ptr1, *ptr2;
 
 	/* Update Acf */
-	ptr1 = Acf + SIZ_ACF - 1;
+	ptr1 = st->Acf + SIZ_ACF - 1;
 	ptr2 = ptr1 - MP1;
 	for (i = 0; i < (SIZ_ACF - MP1); i++) {
 		*ptr1-- = *ptr2--;
@@ -234,14 +223,14 @@ void update_cng(float * r,	/* (i) :   frame autocorrelation               */
 
 	/* Save current Acf */
 	for (i = 0; i < MP1; i++) {
-		Acf[i] = r[i];
+		st->Acf[i] = r[i];
 	}
 
-	fr_cur++;
-	if (fr_cur == NB_CURACF) {
-		fr_cur = 0;
+	st->fr_cur++;
+	if (st->fr_cur == NB_CURACF) {
+		st->fr_cur = 0;
 		if (Vad != 0) {
-			update_sumAcf();
+			update_sumAcf(st);
 		}
 	}
 
@@ -300,13 +289,14 @@ static int cmp_filt(float * RCoeff, float * acf, float alpha, float Thresh)
 
 /* Compute past average filter */
 /*******************************/
-static void calc_pastfilt(float * Coeff, float old_A[], float old_rc[])
+static void calc_pastfilt(struct cod_cng_state *st, float * Coeff,
+			  float old_A[], float old_rc[])
 {
 	int i;
 	float s_sumAcf[MP1];
 	float bid[M];
 
-	calc_sum_acf(sumAcf, s_sumAcf, NB_SUMACF);
+	calc_sum_acf(st->sumAcf, s_sumAcf, NB_SUMACF);
 
 	if (s_sumAcf[0] == (float) 0.) {
 		Coeff[0] = (float) 1.;
@@ -321,20 +311,20 @@ static void calc_pastfilt(float * Coeff, float old_A[], float old_rc[])
 
 /* Update sumAcf */
 /*****************/
-static void update_sumAcf(void)
+static void update_sumAcf(struct cod_cng_state *st)
 {
 	float *ptr1, *ptr2;
 	int i;
 
     /*** Move sumAcf ***/
-	ptr1 = sumAcf + SIZ_SUMACF - 1;
+	ptr1 = st->sumAcf + SIZ_SUMACF - 1;
 	ptr2 = ptr1 - MP1;
 	for (i = 0; i < (SIZ_SUMACF - MP1); i++) {
 		*ptr1-- = *ptr2--;
 	}
 
 	/* Compute new sumAcf */
-	calc_sum_acf(Acf, sumAcf, NB_CURACF);
+	calc_sum_acf(st->Acf, st->sumAcf, NB_CURACF);
 	return;
 }
 
@@ -15,9 +15,15 @@
  * Prototypes for DTX/CNG                                                   *
  *--------------------------------------------------------------------------*/
 
+struct cod_cng_state;		/* encoder DTX/CNG state, see below */
+struct dec_cng_state;		/* decoder CNG state, see below */
+struct phdisp_state;		/* see ld8cp.h */
+
 /* Encoder DTX/CNG functions */
-void init_cod_cng(void);
-void cod_cng(float * exc,	/* (i/o) : excitation array                     */
+void init_cod_cng(struct cod_cng_state *st);
+void cod_cng(struct cod_cng_state *st,
+	     float exc_err[],	/* (i/o) : taming memory of the encoder         */
+	     float * exc,	/* (i/o) : excitation array                     */
 	     int pastVad,	/* (i)   : previous VAD decision                */
 	     float * lsp_old_q,	/* (i/o) : previous quantized lsp               */
 	     float * old_A,	/* (i/o) : last stable filter LPC coefficients  */
@@ -28,7 +34,8 @@ void cod_cng(float * exc,	/* (i/o) : excitation array                     */
 	     /* (i/o) : previous LPS for quantization        */
 	     int16_t * seed	/* (i/o) : random generator seed                */
     );
-void update_cng(float * r,	/* (i) :   frame autocorrelation               */
+void update_cng(struct cod_cng_state *st,
+		float * r,	/* (i) :   frame autocorrelation               */
 		int Vad		/* (i) :   current Vad decision                */
     );
 
@@ -40,7 +47,9 @@ void qua_Sidgain(float * ener,	/* (i)   array of energies                   */
     );
 
 /* CNG excitation generation */
-void calc_exc_rand(float cur_gain,	/* (i)   :   target sample gain                 */
+void calc_exc_rand(float exc_err[],	/* (i/o) :   encoder taming memory              */
+		   struct phdisp_state *phd,	/* (i/o) :   decoder phase dispersion state */
+		   float cur_gain,	/* (i)   :   target sample gain                 */
 		   float * exc,	/* (i/o) :   excitation array                   */
 		   int16_t * seed,	/* (i)   :   current Vad decision               */
 		   int flag_cod	/* (i)   :   encoder/decoder flag               */
@@ -53,8 +62,10 @@ void get_decfreq_prev(float x[MA_NP][M]);
 void update_decfreq_prev(float x[MA_NP][M]);
 
 /* Decoder CNG generation */
-void init_dec_cng(void);
-void dec_cng(int past_ftyp,	/* (i)   : past frame type                      */
+void init_dec_cng(struct dec_cng_state *st);
+void dec_cng(struct dec_cng_state *st,
+	     struct phdisp_state *phd,	/* (i/o) : phase dispersion state       */
+	     int past_ftyp,	/* (i)   : past frame type                      */
 	     float sid_sav,	/* (i)   : energy to recover SID gain           */
 	     int *parm,		/* (i)   : coded SID parameters                 */
 	     float * exc,	/* (i/o) : excitation array                     */
@@ -93,3 +104,27 @@ int read_frame(FILE * f_serial, int *parm);
 #define NORM_GAUSS      (float)3.16227766	/* sqrt(40)xalpha */
 #define K0              (float)3.	/* 4 x (1 - alpha ** 2) */
 #define G_MAX           (float)5000.
+
+/* Encoder DTX/CNG state */
+struct cod_cng_state {
+	float lspSid_q[M];
+	float pastCoeff[MP1];
+	float RCoeff[MP1];
+	float Acf[SIZ_ACF];
+	float sumAcf[SIZ_SUMACF];
+	float ener[NB_GAIN];
+	int fr_cur;
+	float cur_gain;
+	int nb_ener;
+	float sid_gain;
+	int flag_chang;
+	float prev_energy;
+	int count_fr0;
+};
+
+/* Decoder CNG state */
+struct dec_cng_state {
+	float cur_gain;
+	float lspSid[M];
+	float sid_gain;
+};
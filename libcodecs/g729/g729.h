@@ -1,6 +1,16 @@
 /* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
 
+struct g729_enc;
+struct g729_dec;
 
-void g729ini(int rate, int dtx);
-int g729enc(short *sp16, unsigned char *br);
-void g729dec(unsigned char *br, short *sp16);
+//create encoder: rate: G729D=0,G729=1,G729E=2, dtx: 0/1
+//return 0 on allocation failure
+struct g729_enc *g729_enc_init(int rate, int dtx);
+void g729_enc_exit(struct g729_enc *st);
+int g729enc(struct g729_enc *st, short *sp16, unsigned char *br);
+
+//create decoder for the same rate and dtx as the remote encoder
+//return 0 on allocation failure
+struct g729_dec *g729_dec_init(int rate, int dtx);
+void g729_dec_exit(struct g729_dec *st);
+void g729dec(struct g729_dec *st, unsigned char *br, short *sp16);
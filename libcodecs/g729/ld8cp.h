@@ -114,14 +114,19 @@
 /*--------------------------------------------------------------------------*
  * Main coder and decoder functions                                         *
  *--------------------------------------------------------------------------*/
-void init_coder_ld8c(int dtx_enable);
-void coder_ld8c(int ana[],	/* output: analysis parameters */
+struct g729_enc;		/* encoder instance, see state.h */
+struct g729_dec;		/* decoder instance, see state.h */
+
+void init_coder_ld8c(struct g729_enc *st, int dtx_enable);
+void coder_ld8c(struct g729_enc *st,
+		int ana[],	/* output: analysis parameters */
 		int frame,	/* input : frame counter */
 		int dtx_enable,	/* input : VAD enable flag */
 		int rate);
 
-void init_decod_ld8c(void);
-void decod_ld8c(int parm[],	/* (i)   : vector of synthesis parameters
+void init_decod_ld8c(struct g729_dec *st);
+void decod_ld8c(struct g729_dec *st,
+		int parm[],	/* (i)   : vector of synthesis parameters
 				   parm[0] = bad frame indicator (bfi)    */
 		int voicing,	/* (i)   : voicing decision from previous frame */
 		float synth_buf[],	/* (i/o) : synthesis speech                     */
@@ -241,8 +246,18 @@ void dec_lag3cp(int index, int pit_min, int pit_max, int i_subfr,
 /*--------------------------------------------------------------------------*
  * Postfilter functions                                                     *
  *--------------------------------------------------------------------------*/
-
-void poste(int t0,		/* input : pitch delay given by coder */
+struct pst_state {
+	float apond2[LONG_H_ST_E];	/* s.t. numerator coeff.        */
+	float mem_stp[M_BWD];	/* s.t. postfilter memory       */
+	float res2[SIZ_RES2];	/* A(gamma2) residual           */
+	float *res2_ptr;
+	float *ptr_mem_stp;
+	float gain_prec;	/* for gain adjustment */
+};
+
+void init_post_filter(struct pst_state *st);
+void poste(struct pst_state *st,
+	   int t0,		/* input : pitch delay given by coder */
 	   float * signal_ptr,	/* input : input signal (pointer to current subframe */
 	   float * coeff,	/* input : LPC coefficients for current subframe */
 	   float * sig_out,	/* output: postfiltered output */
@@ -262,7 +277,8 @@ void poste(int t0,		/* input : pitch delay given by coder */
 /*--------------------------------------------------------------------------*
  * gain VQ functions.                                                       *
  *--------------------------------------------------------------------------*/
-void dec_gaine(int index,	/* (i)    :Index of quantization.         */
+void dec_gaine(float past_qua_en[],	/* (i/o) :Past quantized energies  */
+	       int index,	/* (i)    :Index of quantization.         */
 	       float code[],	/* (i)  :Innovative vector.             */
 	       int L_subfr,	/* (i)    :Subframe length.               */
 	       int bfi,		/* (i)    :Bad frame indicator            */
@@ -284,7 +300,8 @@ void autocorr_hyb_window(float * x,	/* Input speech signal  */
 void glag_window_bwd(float * r_bwd);
 void int_bwd(float * a_bwd, float * prev_filter, float * C_int);
 
-void set_lpc_mode(float * signal_ptr, float * a_fwd, float * a_bwd,
+void set_lpc_mode(int count_mode[2], float * signal_ptr, float * a_fwd,
+		  float * a_bwd,
 		  int *mode, float * lsp_new, float * lsp_old,
 		  int *bwd_dominant, int prev_mode, float * prev_filter,
 		  float * C_int, int16_t * glob_stat, int16_t * stat_bwd,
@@ -295,7 +312,7 @@ void update_bwd(int *mode,	/* O  Backward / forward Indication */
 		int16_t * glob_stat	/* I/O Mre of global stationnarity */
     );
 float ener_dB(float * synth, int L);
-void tst_bwd_dominant(int *high_stat, int mode);
+void tst_bwd_dominant(int count_mode[2], int *high_stat, int mode);
 
 void perc_vare(float * gamma1,	/* Bandwidth expansion parameter */
 	       float * gamma2,	/* Bandwidth expansion parameter */
@@ -349,6 +366,7 @@ void decod_ACELP64(int sign,	/* input : signs of 2 pulses     */
  * G729D gain                                                               *
  *--------------------------------------------------------------------------*/
 int qua_gain_6k(		/* output: quantizer index                   */
+		       float past_qua_en[],	/* in/out: past quantized energies */
 		       float code[],	/* input : fixed codebook vector             */
 		       float * g_coeff,	/* input : correlation factors               */
 		       int l_subfr,	/* input : fcb vector length                 */
@@ -356,7 +374,8 @@ int qua_gain_6k(		/* output: quantizer index                   */
 		       float * gain_code,	/* output: quantized fcb gain                */
 		       int tameflag	/* input : flag set to 1 if taming is needed */
     );
-void dec_gain_6k(int index,	/* input : quantizer index              */
+void dec_gain_6k(float past_qua_en[],	/* in/out: past quantized energies */
+		 int index,	/* input : quantizer index              */
 		 float code[],	/* input : fixed code book vector       */
 		 int l_subfr,	/* input : subframe size                */
 		 int bfi,	/* input : bad frame indicator good = 0 */
@@ -366,10 +385,19 @@ void dec_gain_6k(int index,	/* input : quantizer index              */
 /*--------------------------------------------------------------------------*
  * G729D gain  phase dispersion                                             *
  *--------------------------------------------------------------------------*/
-void Update_PhDisp(float ltpGain,	/* (i)  : pitch gain                  */
+struct phdisp_state {
+	int prevDispState;
+	float gainMem[6];
+	float prevCbGain;
+	int onset;
+};
+
+void Update_PhDisp(struct phdisp_state *st,
+		   float ltpGain,	/* (i)  : pitch gain                  */
 		   float cbGain	/* (i)  : codebook gain               */
     );
-void PhDisp(float x[],		/* input : excitation signal                */
+void PhDisp(struct phdisp_state *st,
+	    float x[],		/* input : excitation signal                */
 	    float x_phdisp[],	/* output : excitation signal after phase dispersion */
 	    float cbGain, float ltpGainQ, float inno[]
     );
@@ -384,6 +412,20 @@ void dvwadd(float * in1, float scalar1, float * in2, float scalar2,
 	    float * out, int16_t npts);
 void dvsmul(float * in, float scalar, float * out, int16_t npts);
 
-void musdetect(int rate, float Energy, float * rc, int *lags, float * pgains,
-	       int stat_flg, int frm_count, int prev_vad, int *Vad,
-	       float Energy_db);
+struct mus_state {
+	int count_music;
+	float Mcount_music;
+	int count_consc;
+	float MeanPgain;
+	int count_pflag;
+	float Mcount_pflag;
+	int count_consc_pflag;
+	int count_consc_rflag;
+	float mrc[10];
+	float MeanSE;
+};
+
+void init_musdetect(struct mus_state *st);
+void musdetect(struct mus_state *st, int rate, float Energy, float * rc,
+	       int *lags, float * pgains, int stat_flg, int frm_count,
+	       int prev_vad, int *Vad, float Energy_db);
@@ -202,11 +202,16 @@ void decod_ld8k(int parm[], int voi, float synth[], float Az_dec[], int *t0);
 /*--------------------------------------------------------------------------*
  * Pre and post-process functions                                           *
  *--------------------------------------------------------------------------*/
-void init_pre_process(void);
-void pre_process(float signal[], int lg);
+struct hp_state {
+	float x0, x1;		/* high-pass fir memory          */
+	float y1, y2;		/* high-pass iir memory          */
+};
 
-void init_post_process(void);
-void post_process(float signal[], int lg);
+void init_pre_process(struct hp_state *st);
+void pre_process(struct hp_state *st, float signal[], int lg);
+
+void init_post_process(struct hp_state *st);
+void post_process(struct hp_state *st, float signal[], int lg);
 
 /*--------------------------------------------------------------------------*
  * LPC analysis and filtering                                               *
@@ -241,8 +246,13 @@ void d_lsp(int index[], float lsp_new[], int bfi);
 /*--------------------------------------------------------------------------*
  *       PWF prototypes                                                     *
  *--------------------------------------------------------------------------*/
-void perc_var(float * gamma1, float * gamma2, float * lsfint, float * lsfnew,
-	      float * r_c);
+struct pwf_state {
+	int smooth;
+	float lar_old[2];
+};
+
+void perc_var(struct pwf_state *st, float * gamma1, float * gamma2,
+	      float * lsfint, float * lsfnew, float * r_c);
 void weight_az(float * a, float gamma, int m, float * ap);
 
 /*-------------------------------------------------------------------------
@@ -273,15 +283,16 @@ float g_pitch(float xn[], float y1[], float g_coeff[], int L_subfr);
  * fixed codebook excitation.                                               *
  *--------------------------------------------------------------------------*/
 void cor_h_x(float h[], float X[], float D[]);
-int ACELP_codebook(float x[], float h[], int T0, float pitch_sharp,
-		   int i_subfr, float code[], float y[], int *sign);
+int ACELP_codebook(int *extra, float x[], float h[], int T0,
+		   float pitch_sharp, int i_subfr, float code[], float y[],
+		   int *sign);
 void decod_ACELP(int signs, int positions, float cod[]);
 
 /*--------------------------------------------------------------------------*
  * gain VQ functions.                                                       *
  *--------------------------------------------------------------------------*/
-int qua_gain(float code[], float * coeff, int lcode, float * gain_pit,
-	     float * gain_code, int taming);
+int qua_gain(float past_qua_en[], float code[], float * coeff, int lcode,
+	     float * gain_pit, float * gain_code, int taming);
 void dec_gain(int indice, float code[], int lcode, int bfi,
 	      float * gain_pit, float * gain_code);
 void gain_predict(float past_qua_en[], float code[], int l_subfr,
@@ -299,15 +310,14 @@ void bits2prm_ld8k(int16_t bits[], int prm[]);
 /*--------------------------------------------------------------------------*
  * postfilter  functions.                                                   *
  *--------------------------------------------------------------------------*/
-void init_post_filter(void);
 void post(int t0, float * syn, float * a_t, float * pst, int *sf_voic);
 
 /*------------------------------------------------------------*
  * prototypes for taming procedure.                           *
  *------------------------------------------------------------*/
-void init_exc_err(void);
-void update_exc_err(float gain_pit, int t0);
-int test_err(int t0, int t0_frac);
+void init_exc_err(float exc_err[]);
+void update_exc_err(float exc_err[], float gain_pit, int t0);
+int test_err(float exc_err[], int t0, int t0_frac);
 
 /*--------------------------------------------------------------------------*
  * Prototypes for auxiliary functions                                       *
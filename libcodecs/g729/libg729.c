@@ -34,84 +34,90 @@
 #include "ld8k.h"
 #include "ld8cp.h"
 #include "dtx.h"
+#include "vad.h"
+#include "state.h"
 #include "octet.h"
 #if defined(__BORLANDC__)
 extern unsigned _stklen = 48000U;
 #endif
 
-extern float *new_speech;	/* Pointer to new speech data   */
-static int g729_prm[PRM_SIZE_E + 1];	/* Analysis parameters.                  */
-static int16_t g729_serial[SERIAL_SIZE_E];	/* Output bitstream buffer */
-static int g729_frame;		/* frame counter for VAD */
-static int g729_dtx_enable;
-static int g729_rate;
-
-static float synth_buf[L_ANA_BWD];	/* Synthesis */
-static int parm[PRM_SIZE_E + 3];	/* Synthesis parameters */
-static float pst_out[L_FRAME];	/* Postfilter output */
-static float *synth;
-static float Az_dec[M_BWDP1 * 2];	/* Decoded Az for post-filter  */
-static int T0_first;		/* Pitch lag in 1st subframe   */
-static int bwd_dominant;
-static int m_pst;
-static int g729_voicing;	/* voicing from previous frame */
-static int Vad;
-static int long_h_st;
-static int sf_voic;		/* voicing for subframe        */
-static float *ptr_Az;
-static float ga1_post;
-static float ga2_post;
-static float ga_harm;
-
 const unsigned char g729_mo[8] = { 1, 2, 4, 8, 16, 32, 64, 128 };
 
 //rate: G729D=0,G729=1,G729E=2, dtx: 0/1
-void g729ini(int rate, int dtx)
+struct g729_enc *g729_enc_init(int rate, int dtx)
 {
-	int i;
-	g729_dtx_enable = dtx;
-	g729_rate = rate;
+	struct g729_enc *st;
+
+	st = (struct g729_enc *)calloc(1, sizeof(struct g729_enc));
+	if (!st)
+		return 0;
+	st->g729_dtx_enable = dtx;
+	st->g729_rate = rate;
 
 	//Initialize the coder
-	init_pre_process();
-	init_coder_ld8c(g729_dtx_enable);
-	if (g729_dtx_enable == 1)
-		init_cod_cng();
-	for (i = 0; i < PRM_SIZE_E; i++)
-		g729_prm[i] = 0;
-	g729_frame = 0;
+	init_pre_process(&st->pre);
+	init_coder_ld8c(st, st->g729_dtx_enable);
+	if (st->g729_dtx_enable == 1)
+		init_cod_cng(&st->cng);
+	st->g729_frame = 0;
+
+	return st;
+}
+
+void g729_enc_exit(struct g729_enc *st)
+{
+	if (st)
+		free(st);
+}
+
+//rate and dtx must match the encoder of the remote side
+struct g729_dec *g729_dec_init(int rate, int dtx)
+{
+	struct g729_dec *st;
+
+	st = (struct g729_dec *)calloc(1, sizeof(struct g729_dec));
+	if (!st)
+		return 0;
+	st->g729_dtx_enable = dtx;
+	st->g729_rate = rate;
 
 	//Initialization of decoder
-	g729_voicing = 60;
-	for (i = 0; i < L_ANA_BWD; i++)
-		synth_buf[i] = (float) 0.;
-	synth = synth_buf + MEM_SYN_BWD;
-	init_decod_ld8c();
-	init_post_filter();
-	init_post_process();
-	ga1_post = GAMMA1_PST_E;
-	ga2_post = GAMMA2_PST_E;
-	ga_harm = GAMMA_HARM_E;
-	init_dec_cng();
+	st->g729_voicing = 60;
+	st->synth = st->synth_buf + MEM_SYN_BWD;
+	init_decod_ld8c(st);
+	init_post_filter(&st->pst);
+	init_post_process(&st->post);
+	st->ga1_post = GAMMA1_PST_E;
+	st->ga2_post = GAMMA2_PST_E;
+	st->ga_harm = GAMMA_HARM_E;
+	init_dec_cng(&st->cng);
+
+	return st;
+}
 
+void g729_dec_exit(struct g729_dec *st)
+{
+	if (st)
+		free(st);
 }
 
 //encode 80 short samples (10 ms frame) to 64/80/118 bits (8/10/15 bytes)
 //or produce 15 bits (2 bytes) SID frame 
-int g729enc(short *sp16, unsigned char *br)
+int g729enc(struct g729_enc *st, short *sp16, unsigned char *br)
 {
 	int i, l, k;
 
-	if (g729_frame == 32767)
-		g729_frame = 256;
+	if (st->g729_frame == 32767)
+		st->g729_frame = 256;
 	else
-		g729_frame++;
+		st->g729_frame++;
 	for (i = 0; i < L_FRAME; i++)
-		new_speech[i] = (float) sp16[i];
-	pre_process(new_speech, L_FRAME);
-	coder_ld8c(g729_prm, g729_frame, g729_dtx_enable, g729_rate);
-	prm2bits_ld8c(g729_prm, g729_serial);
-	l = (int)g729_serial[1];	//number of resulting bits
+		st->new_speech[i] = (float) sp16[i];
+	pre_process(&st->pre, st->new_speech, L_FRAME);
+	coder_ld8c(st, st->g729_prm, st->g729_frame, st->g729_dtx_enable,
+		   st->g729_rate);
+	prm2bits_ld8c(st->g729_prm, st->g729_serial);
+	l = (int)st->g729_serial[1];	//number of resulting bits
 
 	k = l / 8;
 	if (l % 8)
@@ -119,60 +125,60 @@ int g729enc(short *sp16, unsigned char *br)
 	memzero(br, k);
 
 	for (i = 0; i < l; i++)
-		if (g729_serial[i + 2] == BIT_1)
+		if (st->g729_serial[i + 2] == BIT_1)
 			br[i >> 3] |= g729_mo[i & 7];
 
 	//memcpy(br, g729_serial, 2*SERIAL_SIZE_E);
-	memzero(g729_serial, SERIAL_SIZE_E * sizeof(int16_t));
+	memzero(st->g729_serial, SERIAL_SIZE_E * sizeof(int16_t));
 
 	return k;		//0-erasure, 2-SID, 8-G729D, 10-G729, 15-G729E
 
 }
 
-void g729dec(unsigned char *br, short *sp16)
+void g729dec(struct g729_dec *st, unsigned char *br, short *sp16)
 {
 	int serial_size = 0;
 	int i;
 
 	//check frame type
-	if ((g729_dtx_enable) && (!(*(unsigned int *)(br)))
+	if ((st->g729_dtx_enable) && (!(*(unsigned int *)(br)))
 	    && (!(*(unsigned int *)(br + 4))))
 		serial_size = 0;
-	else if ((g729_dtx_enable) && (!(*(unsigned int *)(br + 4))))
+	else if ((st->g729_dtx_enable) && (!(*(unsigned int *)(br + 4))))
 		serial_size = 16;
-	else if (g729_rate == 0)
+	else if (st->g729_rate == 0)
 		serial_size = 64;
-	else if (g729_rate == 1)
+	else if (st->g729_rate == 1)
 		serial_size = 80;
-	else if (g729_rate == 2)
+	else if (st->g729_rate == 2)
 		serial_size = 118;
 
 	for (i = 0; i < serial_size; i++)
 		if (br[i >> 3] & g729_mo[i & 7])
-			g729_serial[i + 2] = BIT_1;
+			st->g729_serial[i + 2] = BIT_1;
 		else
-			g729_serial[i + 2] = BIT_0;
+			st->g729_serial[i + 2] = BIT_0;
 
-	g729_serial[0] = SYNC_WORD;
-	g729_serial[1] = (short)serial_size;
+	st->g729_serial[0] = SYNC_WORD;
+	st->g729_serial[1] = (short)serial_size;
 
-	bits2prm_ld8c(&g729_serial[1], parm);
+	bits2prm_ld8c(&st->g729_serial[1], st->parm);
 
 	if (serial_size == 80) {
-		parm[5] = check_parity_pitch(parm[4], parm[5]);
+		st->parm[5] = check_parity_pitch(st->parm[4], st->parm[5]);
 	} else if (serial_size == 118) {
 		/* ------------------------------------------------------------------ */
 		/* check parity and put 1 in parm[6] if parity error in Forward mode  */
 		/*                  put 1 in parm[4] if parity error in Backward mode */
 		/* ------------------------------------------------------------------ */
-		if (parm[2] == 0) {
-			i = (parm[5] >> 1) & 1;
-			parm[6] += i;
-			parm[6] = check_parity_pitch(parm[5], parm[6]);
+		if (st->parm[2] == 0) {
+			i = (st->parm[5] >> 1) & 1;
+			st->parm[6] += i;
+			st->parm[6] = check_parity_pitch(st->parm[5], st->parm[6]);
 		} else {
-			i = (parm[3] >> 1) & 1;
-			parm[4] += i;
-			parm[4] = check_parity_pitch(parm[3], parm[4]);
+			i = (st->parm[3] >> 1) & 1;
+			st->parm[4] += i;
+			st->parm[4] = check_parity_pitch(st->parm[3], st->parm[4]);
 		}
 	}
 
@@ -181,15 +187,15 @@ void g729dec(unsigned char *br, short *sp16)
 	/* for untransmitted frames, the hardware detects frame erasures
 	   by testing serial[0] */
 
-	parm[0] = 0;		/* No frame erasure */
-	if (g729_serial[1] != 0) {
-		for (i = 0; i < g729_serial[1]; i++)
-			if (g729_serial[i + 2] == 0)
-				parm[0] = 1;	/* frame erased     */
-	} else if (g729_serial[0] != SYNC_WORD)
-		parm[0] = 1;
+	st->parm[0] = 0;		/* No frame erasure */
+	if (st->g729_serial[1] != 0) {
+		for (i = 0; i < st->g729_serial[1]; i++)
+			if (st->g729_serial[i + 2] == 0)
+				st->parm[0] = 1;	/* frame erased     */
+	} else if (st->g729_serial[0] != SYNC_WORD)
+		st->parm[0] = 1;
 
-	if (parm[0] == 1) {
+	if (st->parm[0] == 1) {
 		if (serial_size < RATE_6400) {
 			serial_size = 0;
 		}
@@ -198,62 +204,64 @@ void g729dec(unsigned char *br, short *sp16)
 	/* ---------- */
 	/*  Decoding  */
 	/* ---------- */
-	decod_ld8c(parm, g729_voicing, synth_buf, Az_dec,
-		   &T0_first, &bwd_dominant, &m_pst, &Vad);
+	decod_ld8c(st, st->parm, st->g729_voicing, st->synth_buf, st->Az_dec,
+		   &st->T0_first, &st->bwd_dominant, &st->m_pst, &st->Vad);
 
 	/* ---------- */
 	/* Postfilter */
 	/* ---------- */
-	ptr_Az = Az_dec;
+	st->ptr_Az = st->Az_dec;
 
 	/* Adaptive parameters for postfiltering */
 	/* ------------------------------------- */
 	if (serial_size != 118) {
-		long_h_st = LONG_H_ST;
-		ga1_post = GAMMA1_PST;
-		ga2_post = GAMMA2_PST;
-		ga_harm = GAMMA_HARM;
+		st->long_h_st = LONG_H_ST;
+		st->ga1_post = GAMMA1_PST;
+		st->ga2_post = GAMMA2_PST;
+		st->ga_harm = GAMMA_HARM;
 	} else {
-		long_h_st = LONG_H_ST_E;
+		st->long_h_st = LONG_H_ST_E;
 		/* If backward mode is dominant => progressively reduce postfiltering */
-		if ((parm[2] == 1) && (bwd_dominant == 1)) {
-			ga_harm -= (float) 0.0125;
-			if (ga_harm < 0)
-				ga_harm = 0;
-			ga1_post -= (float) 0.035;
-			if (ga1_post < 0)
-				ga1_post = 0;
-			ga2_post -= (float) 0.0325;
-			if (ga2_post < 0)
-				ga2_post = 0;
+		if ((st->parm[2] == 1) && (st->bwd_dominant == 1)) {
+			st->ga_harm -= (float) 0.0125;
+			if (st->ga_harm < 0)
+				st->ga_harm = 0;
+			st->ga1_post -= (float) 0.035;
+			if (st->ga1_post < 0)
+				st->ga1_post = 0;
+			st->ga2_post -= (float) 0.0325;
+			if (st->ga2_post < 0)
+				st->ga2_post = 0;
 		} else {
-			ga_harm += (float) 0.0125;
-			if (ga_harm > GAMMA_HARM_E)
-				ga_harm = GAMMA_HARM_E;
-			ga1_post += (float) 0.035;
-			if (ga1_post > GAMMA1_PST_E)
-				ga1_post = GAMMA1_PST_E;
-			ga2_post += (float) 0.0325;
-			if (ga2_post > GAMMA2_PST_E)
-				ga2_post = GAMMA2_PST_E;
+			st->ga_harm += (float) 0.0125;
+			if (st->ga_harm > GAMMA_HARM_E)
+				st->ga_harm = GAMMA_HARM_E;
+			st->ga1_post += (float) 0.035;
+			if (st->ga1_post > GAMMA1_PST_E)
+				st->ga1_post = GAMMA1_PST_E;
+			st->ga2_post += (float) 0.0325;
+			if (st->ga2_post > GAMMA2_PST_E)
+				st->ga2_post = GAMMA2_PST_E;
 		}
 	}
 
 	for (i = 0; i < L_FRAME; i++)
-		pst_out[i] = synth[i];
+		st->pst_out[i] = st->synth[i];
 
-	g729_voicing = 0;
+	st->g729_voicing = 0;
 	for (i = 0; i < L_FRAME; i += L_SUBFR) {
-		poste(T0_first, &synth[i], ptr_Az, &pst_out[i], &sf_voic,
-		      ga1_post, ga2_post, ga_harm, long_h_st, m_pst, Vad);
-		if (sf_voic != 0)
-			g729_voicing = sf_voic;
-		ptr_Az += m_pst + 1;
+		poste(&st->pst, st->T0_first, &st->synth[i], st->ptr_Az,
+		      &st->pst_out[i], &st->sf_voic, st->ga1_post,
+		      st->ga2_post, st->ga_harm, st->long_h_st, st->m_pst,
+		      st->Vad);
+		if (st->sf_voic != 0)
+			st->g729_voicing = st->sf_voic;
+		st->ptr_Az += st->m_pst + 1;
 	}
 
-	post_process(pst_out, L_FRAME);
+	post_process(&st->post, st->pst_out, L_FRAME);
 
 	for (i = 0; i < L_FRAME; i++)
-		sp16[i] = (short)pst_out[i];
+		sp16[i] = (short)st->pst_out[i];
 
 }
@@ -19,28 +19,23 @@
 * Static memory allocation.                                 *
 *-----------------------------------------------------------*/
 
-static int prevDispState = 0;
-static float gainMem[6] =
-    { (float) 0.0, (float) 0.0, (float) 0.0, (float) 0.0, (float) 0.0, (float) 0.0 };
-static float prevCbGain = (float) 0.0;
-static int onset = 0;
-
 /*-----------------------------------------------------------*
 * Update_PhDisp- Updates state machine for phase dispersion     *
 * in 6.4 kbps mode, when running in others modes.          *
 *-----------------------------------------------------------*/
-void Update_PhDisp(float ltpGain,	/* (i)  : pitch gain                  */
+void Update_PhDisp(struct phdisp_state *st,	/* (i/o): dispersion state    */
+		   float ltpGain,	/* (i)  : pitch gain                  */
 		   float cbGain	/* (i)  : codebook gain               */
     )
 {
 	int i;
 
 	for (i = 5; i > 0; i--)
-		gainMem[i] = gainMem[i - 1];
-	gainMem[0] = ltpGain;
-	prevDispState = 2;
-	prevCbGain = cbGain;
-	onset = 0;
+		st->gainMem[i] = st->gainMem[i - 1];
+	st->gainMem[0] = ltpGain;
+	st->prevDispState = 2;
+	st->prevCbGain = cbGain;
+	st->onset = 0;
 
 	return;
 }
@@ -48,7 +43,8 @@ void Update_PhDisp(float ltpGain,	/* (i)  : pitch gain                  */
 /*-----------------------------------------------------------*
 * PhDisp - phase dispersion  in 6.4 kbps mode               *
 *-----------------------------------------------------------*/
-void PhDisp(float x[],		/* input : excitation signal                */
+void PhDisp(struct phdisp_state *st,	/* i/o : dispersion state      */
+	    float x[],		/* input : excitation signal                */
 	    float x_phdisp[],	/* output : excitation signal after phase dispersion */
 	    float cbGain, float ltpGainQ, float inno[]
     )
@@ -82,35 +78,35 @@ void PhDisp(float x[],		/* input : excitation signal                */
 	}
 
 	for (i = 5; i > 0; i--) {
-		gainMem[i] = gainMem[i - 1];
+		st->gainMem[i] = st->gainMem[i - 1];
 	}
-	gainMem[0] = ltpGainQ;
+	st->gainMem[0] = ltpGainQ;
 
-	if (cbGain > (float) 2.0 * prevCbGain)
-		onset = 2;
+	if (cbGain > (float) 2.0 * st->prevCbGain)
+		st->onset = 2;
 	else {
-		if (onset)
-			onset -= 1;
+		if (st->onset)
+			st->onset -= 1;
 	}
 
 	i1 = 0;
 	for (i = 0; i < 6; i++) {
-		if (gainMem[i] < (float) 0.6)
+		if (st->gainMem[i] < (float) 0.6)
 			i1 += 1;
 	}
-	if (i1 > 2 && !onset)
+	if (i1 > 2 && !st->onset)
 		dispState = 0;
 
-	if (dispState - prevDispState > 1 && !onset)
+	if (dispState - st->prevDispState > 1 && !st->onset)
 		dispState -= 1;
 
-	if (onset) {
+	if (st->onset) {
 		if (dispState < 2)
 			dispState++;
 	}
 
-	prevDispState = dispState;
-	prevCbGain = cbGain;
+	st->prevDispState = dispState;
+	st->prevCbGain = cbGain;
 
 	if (dispState == 0) {
 		for (nPulse = 0; nPulse < nze; nPulse++) {
@@ -44,25 +44,24 @@
  *     a[3] = {0.10000000E+01, 0.19059465E+01, -0.91140240E+00};          *
 *-----------------------------------------------------------------------*/
 
-static float x0, x1;		/* high-pass fir memory          */
-static float y1, y2;		/* high-pass iir memory          */
-
-void init_pre_process(void
-    )
+void init_pre_process(struct hp_state *st)
 {
-	x0 = x1 = (float) 0.0;
-	y2 = y1 = (float) 0.0;
+	st->x0 = st->x1 = (float) 0.0;
+	st->y2 = st->y1 = (float) 0.0;
 
 	return;
 }
 
-void pre_process(float signal[],	/* (i/o)  : signal                     */
+void pre_process(struct hp_state *st,	/* (i/o)  : filter memory              */
+		 float signal[],	/* (i/o)  : signal                     */
 		 int lg		/* (i)    : lenght of signal           */
     )
 {
 	int i;
 	float x2;
 	float y0;
+	float x0 = st->x0, x1 = st->x1;
+	float y1 = st->y1, y2 = st->y2;
 
 	for (i = 0; i < lg; i++) {
 		x2 = x1;
@@ -77,5 +76,10 @@ void pre_process(float signal[],	/* (i/o)  : signal                     */
 		y1 = y0;
 	}
 
+	st->x0 = x0;
+	st->x1 = x1;
+	st->y1 = y1;
+	st->y2 = y2;
+
 	return;
 }
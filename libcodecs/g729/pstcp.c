@@ -43,18 +43,8 @@ static void filt_mu(float * sig_in, float * sig_out, float parcor0);
 static void calc_rc0_he(float * h, float * rc0, int long_h_st);
 static void scale_st(float * sig_in, float * sig_out, float * gain_prec);
 
-/* Arrays */
-static float apond2[LONG_H_ST_E];	/* s.t. numerator coeff.        */
-static float mem_stp[M_BWD];	/* s.t. postfilter memory       */
-static float mem_zero[M_BWD];	/* null memory to compute h_st  */
-static float res2[SIZ_RES2];	/* A(gamma2) residual           */
-
-/* pointers */
-float *res2_ptr;
-float *ptr_mem_stp;
-
-/* Variables */
-float gain_prec;
+/* null memory to compute h_st, read only: syn_filte() never updates it */
+static float mem_zero[M_BWD];
 
 /************************************************************************/
 /****   Short term postfilter :                                     *****/
@@ -80,7 +70,7 @@ float gain_prec;
  * Init_Post_Filter -  Initialize postfilter functions
  *----------------------------------------------------------------------------
  */
-void init_post_filter(void)
+void init_post_filter(struct pst_state *st)
 {
 	int i;
 
@@ -88,24 +78,20 @@ void init_post_filter(void)
 
 	/* res2 =  A(gamma2) residual */
 	for (i = 0; i < MEM_RES2; i++)
-		res2[i] = (float) 0.;
-	res2_ptr = res2 + MEM_RES2;
+		st->res2[i] = (float) 0.;
+	st->res2_ptr = st->res2 + MEM_RES2;
 
 	/* 1/A(gamma1) memory */
 	for (i = 0; i < M_BWD; i++)
-		mem_stp[i] = (float) 0.;
-	ptr_mem_stp = mem_stp + M_BWD - 1;
+		st->mem_stp[i] = (float) 0.;
+	st->ptr_mem_stp = st->mem_stp + M_BWD - 1;
 
 	/* fill apond2[M+1->long_h_st-1] with zeroes */
 	for (i = M_BWDP1; i < LONG_H_ST_E; i++)
-		apond2[i] = (float) 0.;
-
-	/* null memory to compute i.r. of A(gamma2)/A(gamma1) */
-	for (i = 0; i < M_BWD; i++)
-		mem_zero[i] = (float) 0.;
+		st->apond2[i] = (float) 0.;
 
 	/* for gain adjustment */
-	gain_prec = (float) 1.;
+	st->gain_prec = (float) 1.;
 
 	return;
 }
@@ -114,7 +100,8 @@ void init_post_filter(void)
  * Post - adaptive postfilter main function
  *----------------------------------------------------------------------------
  */
-void poste(int t0,		/* input : pitch delay given by coder */
+void poste(struct pst_state *st,	/* in/out: postfilter memory */
+	   int t0,		/* input : pitch delay given by coder */
 	   float * signal_ptr,	/* input : input signal (pointer to current subframe */
 	   float * coeff,	/* input : LPC coefficients for current subframe */
 	   float * sig_out,	/* output: postfiltered output */
@@ -135,42 +122,42 @@ void poste(int t0,		/* input : pitch delay given by coder */
 
 	/* Compute weighted LPC coefficients */
 	weight_az(coeff, gamma1, m_pst, apond1);
-	weight_az(coeff, gamma2, m_pst, apond2);
-	set_zero(&apond2[m_pst + 1], (M_BWD - m_pst));
+	weight_az(coeff, gamma2, m_pst, st->apond2);
+	set_zero(&st->apond2[m_pst + 1], (M_BWD - m_pst));
 
 	/* Compute A(gamma2) residual */
-	residue(m_pst, apond2, signal_ptr, res2_ptr, L_SUBFR);
+	residue(m_pst, st->apond2, signal_ptr, st->res2_ptr, L_SUBFR);
 
 	/* Harmonic filtering */
 	sig_ltp_ptr = sig_ltp + 1;
 
 	if (Vad > 1)
-		pst_ltpe(t0, res2_ptr, sig_ltp_ptr, vo, gamma_harm);
+		pst_ltpe(t0, st->res2_ptr, sig_ltp_ptr, vo, gamma_harm);
 	else {
 		*vo = 0;
-		copy(res2_ptr, sig_ltp_ptr, L_SUBFR);
+		copy(st->res2_ptr, sig_ltp_ptr, L_SUBFR);
 	}
 
 	/* Save last output of 1/A(gamma1)  */
 	/* (from preceding subframe)        */
-	sig_ltp[0] = *ptr_mem_stp;
+	sig_ltp[0] = *st->ptr_mem_stp;
 
 	/* Controls short term pst filter gain and compute parcor0   */
-	calc_st_filte(apond2, apond1, &parcor0, sig_ltp_ptr, long_h_st, m_pst);
+	calc_st_filte(st->apond2, apond1, &parcor0, sig_ltp_ptr, long_h_st, m_pst);
 
 	/* 1/A(gamma1) filtering, mem_stp is updated */
 	syn_filte(m_pst, apond1, sig_ltp_ptr, sig_ltp_ptr, L_SUBFR,
-		  &mem_stp[M_BWD - m_pst], 0);
-	copy(&sig_ltp_ptr[L_SUBFR - M_BWD], mem_stp, M_BWD);
+		  &st->mem_stp[M_BWD - m_pst], 0);
+	copy(&sig_ltp_ptr[L_SUBFR - M_BWD], st->mem_stp, M_BWD);
 
 	/* Tilt filtering */
 	filt_mu(sig_ltp, sig_out, parcor0);
 
 	/* Gain control */
-	scale_st(signal_ptr, sig_out, &gain_prec);
+	scale_st(signal_ptr, sig_out, &st->gain_prec);
 
     /**** Update for next subframe */
-	copy(&res2[L_SUBFR], &res2[0], MEM_RES2);
+	copy(&st->res2[L_SUBFR], &st->res2[0], MEM_RES2);
 
 	return;
 }
@@ -27,14 +27,12 @@
 #include <math.h>
 #include "ld8k.h"
 
-static int smooth = 1;
-static float lar_old[2] = { (float) 0.0, (float) 0.0 };
-
 /*----------------------------------------------------------------------------
 * perc_var -adaptive bandwidth expansion for perceptual weighting filter
 *----------------------------------------------------------------------------
 */
-void perc_var(float * gamma1,	/* output: gamma1 value */
+void perc_var(struct pwf_state *st,	/* i/o: smoothing state */
+	      float * gamma1,	/* output: gamma1 value */
 	      float * gamma2,	/* output: gamma2 value */
 	      float * lsfint,	/* input : Interpolated lsf vector : 1st subframe */
 	      float * lsfnew,	/* input : lsf vector : 2nd subframe */
@@ -57,8 +55,8 @@ void perc_var(float * gamma1,	/* output: gamma1 value */
 
 	/* Interpolation of lar for the 1st subframe */
 	for (i = 0; i < 2; i++) {
-		lar[i] = (float) 0.5 *(lar_new[i] + lar_old[i]);
-		lar_old[i] = lar_new[i];
+		lar[i] = (float) 0.5 *(lar_new[i] + st->lar_old[i]);
+		st->lar_old[i] = lar_new[i];
 	}
 
 	for (k = 0; k < 2; k++) {	/* LOOP : gamma2 for 1st to 2nd subframes */
@@ -76,15 +74,15 @@ void perc_var(float * gamma1,	/* output: gamma1 value */
 		critlar0 = lar[2 * k];
 		critlar1 = lar[2 * k + 1];
 
-		if (smooth != 0) {
+		if (st->smooth != 0) {
 			if ((critlar0 < THRESH_L1) && (critlar1 > THRESH_H1))
-				smooth = 0;
+				st->smooth = 0;
 		} else {
 			if ((critlar0 > THRESH_L2) || (critlar1 < THRESH_H2))
-				smooth = 1;
+				st->smooth = 1;
 		}
 
-		if (smooth == 0) {
+		if (st->smooth == 0) {
 			/* ------------------------------------------------------ */
 			/* Second criterion based on the minimum distance between */
 			/* two successives lsfs                                   */
@@ -22,8 +22,6 @@
 #include "ld8cp.h"
 #include "tabld8cp.h"
 
-static float past_qua_en[4] =
-    { (float) - 14.0, (float) - 14.0, (float) - 14.0, (float) - 14.0 };
 /* prototypes of local functions */
 static void gbk_presel_6k(float best_gain[],	/* input : [0] unquantized pitch gain
 						   [1] unquantized code gain      */
@@ -43,6 +41,7 @@ static void gbk_presel(float best_gain[],	/* input : [0] unquantized pitch gain
 *----------------------------------------------------------------------------
 */
 int qua_gain_6k(		/* output: quantizer index                   */
+		       float past_qua_en[],	/* in/out: past quantized energies     */
 		       float code[],	/* input : fixed codebook vector             */
 		       float * g_coeff,	/* input : correlation factors               */
 		       int l_subfr,	/* input : fcb vector length                 */
@@ -214,6 +213,7 @@ static void gbk_presel_6k(float best_gain[],	/* input : [0] unquantized pitch ga
 *----------------------------------------------------------------------------
 */
 int qua_gain(			/* output: quantizer index                   */
+		    float past_qua_en[],	/* in/out: past quantized energies     */
 		    float code[],	/* input : fixed codebook vector             */
 		    float * g_coeff,	/* input : correlation factors               */
 		    int l_subfr,	/* input : fcb vector length                 */
@@ -16,7 +16,6 @@
 #define         sqr(a)  ((a)*(a))
 #define         R_LSFQ 10
 
-void init_lsfq_noise(void);
 void lsfq_noise(float * lsp_new, float * lspq,
 		float freq_prev[MA_NP][M], int *idx);
 void sid_lsfq_decode(int *index, float * lspq, float freq_prev[MA_NP][M]);
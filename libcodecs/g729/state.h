@@ -0,0 +1,174 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/* ITU-T G.729 Software Package Release 2 (November 2006) */
+/*
+   ITU-T G.729 Annex C+ - Reference C code for floating point
+                         implementation of G.729 Annex C+
+                         (integration of Annexes B, D and E)
+*/
+
+/*
+ File : STATE.H
+ Encoder and decoder instances: the memory the reference code kept
+ in file-scope statics. Include after ld8k.h, ld8cp.h, vad.h, dtx.h.
+*/
+
+struct g729_enc {
+	struct hp_state pre;	/* pre_proc.c */
+
+	/* codld8cp.c */
+	/* Speech vector */
+	float old_speech[L_TOTAL];
+	float *speech, *p_window;
+	float *new_speech;
+
+	/* Weighted speech vector */
+	float old_wsp[L_FRAME + PIT_MAX];
+	float *wsp;
+
+	/* Excitation vector */
+	float old_exc[L_FRAME + PIT_MAX + L_INTERPOL];
+	float *exc;
+
+	/* Zero vector */
+	float ai_zero[L_SUBFR + M_BWDP1];
+	float *zero;
+
+	/* Lsp (Line spectral pairs) */
+	float lsp_old[M];
+	float lsp_old_q[M];
+
+	/* Filter's memory */
+	float mem_syn[M_BWD], mem_w0[M_BWD], mem_w[M_BWD];
+	float mem_err[M_BWD + L_SUBFR], *error;
+	float pit_sharp;
+
+	/* For G.729B */
+	/* DTX variables */
+	int pastVad;
+	int ppastVad;
+	int16_t seed;
+
+	/* for G.729E */
+	/* for the backward analysis */
+	float prev_filter[M_BWDP1];	/* Previous selected filter */
+
+	float rexp[M_BWDP1];
+	float synth[L_ANA_BWD];
+	float *synth_ptr;
+	int prev_lp_mode;
+	float gamma1[2], gamma2[2];	/* Weighting factor for the 2 subframes */
+	float A_t_bwd_mem[M_BWDP1];
+	int bwd_dominant;
+	float C_int;		/* See file bwfw.c */
+	int16_t glob_stat;	/* Mesure of global stationnarity */
+	int16_t stat_bwd;	/* Nbre of consecutive backward frames */
+	int16_t val_stat_bwd;	/* Value associated with stat_bwd */
+
+	/* Last backward A(z) for case of unstable filter */
+	float old_A_bwd[M_BWDP1];
+	float old_rc_bwd[2];
+	/* Last forkward A(z) for case of unstable filter */
+	float old_A_fwd[MP1];
+	float old_rc_fwd[2];
+	float freq_prev[MA_NP][M];	/* previous LSP vector       */
+
+	int lag_buf[5];
+	float pgain_buf[5];
+
+	float past_qua_en[4];	/* q_gaincp.c */
+	float exc_err[4];	/* taming.c */
+	int extra;		/* acelp_cp.c */
+	int count_mode[2];	/* bwfwfunc.c */
+	struct pwf_state pwf;	/* pwf.c */
+	struct vad_state vad;	/* vad.c */
+	struct mus_state mus;	/* mus_dtct.c */
+	struct cod_cng_state cng;	/* dtx.c */
+
+	/* libg729.c */
+	int g729_prm[PRM_SIZE_E + 1];	/* Analysis parameters.                  */
+	int16_t g729_serial[SERIAL_SIZE_E];	/* Output bitstream buffer */
+	int g729_frame;		/* frame counter for VAD */
+	int g729_dtx_enable;
+	int g729_rate;
+};
+
+struct g729_dec {
+	/* decld8cp.c */
+	/* Excitation vector */
+	float old_exc[L_FRAME + PIT_MAX + L_INTERPOL];
+	float *exc;
+
+	/* Lsp (Line spectral pairs) */
+	float lsp_old[M];
+
+	float mem_syn[M_BWD];	/* Filter's memory */
+
+	float sharp;		/* pitch sharpening of previous fr */
+	float gain_code;	/* fixed codebook gain */
+	float gain_pitch;	/* adaptive codebook gain */
+	int prev_t0;		/* integer delay of previous frame    */
+	int prev_t0_frac;	/* integer delay of previous frame    */
+
+	/* for G.729B */
+	int16_t seed_fer;
+	/* CNG variables */
+	int past_ftyp;
+	int16_t seed;
+	float sid_sav;
+
+	/* for the backward analysis */
+	float rexp[M_BWDP1];
+	float A_bwd_mem[M_BWDP1];
+	float A_t_bwd_mem[M_BWDP1];
+	int prev_voicing, prev_bfi, prev_lp_mode;
+	float c_fe, c_int;
+	float prev_filter[M_BWDP1];	/* Previous selected filter */
+	int prev_pitch;
+	int stat_pitch;
+	int pitch_sta, frac_sta;
+
+	/* Last backward A(z) for case of unstable filter */
+	float old_A_bwd[M_BWDP1];
+	float old_rc_bwd[2];
+
+	float gain_pit_mem;
+	float gain_cod_mem;
+	float c_muting;
+	int count_bfi;
+	int stat_bwd;
+
+	float freq_prev[MA_NP][M];
+
+	/* static memory for frame erase operation */
+	int prev_ma;		/* previous MA prediction coef. */
+	float prev_lsp[M];	/* previous LSP vector */
+
+	float past_qua_en[4];	/* degaincp.c */
+	int count_mode[2];	/* bwfwfunc.c */
+	struct phdisp_state phd;	/* phdisp.c */
+	struct dec_cng_state cng;	/* dec_sid.c */
+	struct pst_state pst;	/* pstcp.c */
+	struct hp_state post;	/* post_pro.c */
+
+	/* libg729.c */
+	int16_t g729_serial[SERIAL_SIZE_E];	/* Input bitstream buffer */
+	int g729_dtx_enable;
+	int g729_rate;
+	float synth_buf[L_ANA_BWD];	/* Synthesis */
+	int parm[PRM_SIZE_E + 3];	/* Synthesis parameters */
+	float pst_out[L_FRAME];	/* Postfilter output */
+	float *synth;
+	float Az_dec[M_BWDP1 * 2];	/* Decoded Az for post-filter  */
+	int T0_first;		/* Pitch lag in 1st subframe   */
+	int bwd_dominant;
+	int m_pst;
+	int g729_voicing;	/* voicing from previous frame */
+	int Vad;
+	int long_h_st;
+	int sf_voic;		/* voicing for subframe        */
+	float *ptr_Az;
+	float ga1_post;
+	float ga2_post;
+	float ga_harm;
+};
@@ -55,7 +55,44 @@ int PtrTab_2[2][16] =
 {16, 1, 0, 0, 8, 25, 22, 20, 19, 23, 20, 31, 4, 31, 20, 31}
 };
 
-float noise_fg[MODE][MA_NP][M];
+float noise_fg[MODE][MA_NP][M] = {
+	{
+	 {(float) 2.569999993e-01f, (float) 2.779999971e-01f, (float) 2.800000012e-01f,
+	  (float) 2.736000121e-01f, (float) 2.757000029e-01f, (float) 2.763999999e-01f,
+	  (float) 2.675000131e-01f, (float) 2.678000033e-01f, (float) 2.779000103e-01f,
+	  (float) 2.646999955e-01f},
+	 {(float) 2.142000049e-01f, (float) 2.194000036e-01f, (float) 2.330999970e-01f,
+	  (float) 2.230000049e-01f, (float) 2.272000015e-01f, (float) 2.251999974e-01f,
+	  (float) 2.148000002e-01f, (float) 2.123000026e-01f, (float) 2.115000039e-01f,
+	  (float) 2.096000016e-01f},
+	 {(float) 1.669999957e-01f, (float) 1.523000002e-01f, (float) 1.567000002e-01f,
+	  (float) 1.580000073e-01f, (float) 1.600999981e-01f, (float) 1.569000036e-01f,
+	  (float) 1.588999927e-01f, (float) 1.554999948e-01f, (float) 1.474000067e-01f,
+	  (float) 1.571000069e-01f},
+	 {(float) 1.238000020e-01f, (float) 9.250000119e-02f, (float) 7.980000228e-02f,
+	  (float) 9.229999781e-02f, (float) 8.900000155e-02f, (float) 8.280000091e-02f,
+	  (float) 1.010000035e-01f, (float) 9.880000353e-02f, (float) 8.720000088e-02f,
+	  (float) 1.059999987e-01f}
+	},
+	{
+	 {(float) 2.486000061e-01f, (float) 2.630000114e-01f, (float) 2.679600120e-01f,
+	  (float) 2.639600039e-01f, (float) 2.661000192e-01f, (float) 2.694799900e-01f,
+	  (float) 2.659400105e-01f, (float) 2.656800151e-01f, (float) 2.687800229e-01f,
+	  (float) 2.512200177e-01f},
+	 {(float) 1.799200177e-01f, (float) 1.686400026e-01f, (float) 1.710200012e-01f,
+	  (float) 1.762000173e-01f, (float) 1.836400032e-01f, (float) 1.821600050e-01f,
+	  (float) 1.799600124e-01f, (float) 1.781000197e-01f, (float) 1.746200025e-01f,
+	  (float) 1.741999984e-01f},
+	 {(float) 1.394400001e-01f, (float) 1.149400026e-01f, (float) 1.100600064e-01f,
+	  (float) 1.209600121e-01f, (float) 1.264999956e-01f, (float) 1.232600063e-01f,
+	  (float) 1.289799958e-01f, (float) 1.263400018e-01f, (float) 1.194800138e-01f,
+	  (float) 1.299000084e-01f},
+	 {(float) 1.112000048e-01f, (float) 7.494000345e-02f, (float) 5.936000496e-02f,
+	  (float) 7.530000061e-02f, (float) 7.444000244e-02f, (float) 6.896000355e-02f,
+	  (float) 8.544000983e-02f, (float) 8.472000808e-02f, (float) 7.568000257e-02f,
+	  (float) 9.536001086e-02f}
+	}
+};
 
 float noise_fg_sum[MODE][M] = {
 	{(float) 2.379833e-01f, (float) 2.577898e-01f, (float) 2.504044e-01f,
@@ -27,9 +27,7 @@
  **************************************************************************/
 #include "ld8k.h"
 
-static float exc_err[4];
-
-void init_exc_err(void)
+void init_exc_err(float exc_err[])
 {
 	int i;
 	for (i = 0; i < 4; i++)
@@ -42,6 +40,7 @@ void init_exc_err(void)
 * adaptive codebook contribution                                         *
 **************************************************************************/
 int test_err(			/* (o) flag set to 1 if taming is necessary  */
+		    float exc_err[],	/* (i) accumulated excitation error */
 		    int t0,	/* (i) integer part of pitch delay           */
 		    int t0_frac	/* (i) fractional part of pitch delay        */
     )
@@ -78,7 +77,8 @@ int test_err(			/* (o) flag set to 1 if taming is necessary  */
 * decoder                                                                *
 **************************************************************************/
 
-void update_exc_err(float gain_pit,	/* (i) pitch gain */
+void update_exc_err(float exc_err[],	/* (i/o) accumulated excitation error */
+		    float gain_pit,	/* (i) pitch gain */
 		    int t0	/* (i) integer part of pitch delay */
     )
 {
@@ -30,15 +30,6 @@ static int MakeDec(float dSLE,	/* (i)  : differential low band energy */
 		   float dSZC	/* (i)  : differential zero crossing rate */
     );
 
-/* static variables */
-static float MeanLSF[M];
-static float Min_buffer[16];
-static float Prev_Min, Next_Min, Min;
-static float MeanE, MeanSE, MeanSLE, MeanSZC;
-static float prev_energy;
-static int count_sil, count_update, count_ext;
-static int flag, v_flag, less_count;
-
 /*---------------------------------------------------------------------------*
  * Function  vad_init                                                                                                            *
  * ~~~~~~~~~~~~~~~~~~                                                                                                            *
@@ -46,22 +37,22 @@ static int flag, v_flag, less_count;
  * -> Initialization of variables for voice activity detection                           *
  *                                                                                                                                                       *
 *---------------------------------------------------------------------------*/
-void vad_init(void)
+void vad_init(struct vad_state *st)
 {
 	/* Static vectors to zero */
-	set_zero(MeanLSF, M);
+	set_zero(st->MeanLSF, M);
 
 	/* Initialize VAD parameters */
-	MeanSE = (float) 0.0;
-	MeanSLE = (float) 0.0;
-	MeanE = (float) 0.0;
-	MeanSZC = (float) 0.0;
-	count_sil = 0;
-	count_update = 0;
-	count_ext = 0;
-	less_count = 0;
-	flag = 1;
-	Min = FLT_MAX_G729;
+	st->MeanSE = (float) 0.0;
+	st->MeanSLE = (float) 0.0;
+	st->MeanE = (float) 0.0;
+	st->MeanSZC = (float) 0.0;
+	st->count_sil = 0;
+	st->count_update = 0;
+	st->count_ext = 0;
+	st->less_count = 0;
+	st->flag = 1;
+	st->Min = FLT_MAX_G729;
 	return;
 }
 
@@ -83,7 +74,8 @@ void vad_init(void)
 *                                                                 *
 *-----------------------------------------------------------------*/
 
-void vad(float rc,
+void vad(struct vad_state *st,
+	 float rc,
 	 float * lsf,
 	 float * rxx,
 	 float * sigpp,
@@ -123,7 +115,7 @@ void vad(float rc,
 	/* Normalize lsfs */
 	for (i = 0; i < M; i++)
 		lsf[i] /= (float) 2. *PI;
-	dvsub(lsf, MeanLSF, tmp, M);
+	dvsub(lsf, st->MeanLSF, tmp, M);
 	SD = dvdot(tmp, tmp, M);
 
 	/* compute # zero crossing */
@@ -139,40 +131,40 @@ void vad(float rc,
 
 	/* Initialize and update Mins */
 	if (frm_count < 129) {
-		if (norm_energy < Min) {
-			Min = norm_energy;
-			Prev_Min = norm_energy;
+		if (norm_energy < st->Min) {
+			st->Min = norm_energy;
+			st->Prev_Min = norm_energy;
 		}
 		if ((frm_count % 8) == 0) {
-			Min_buffer[(int)frm_count / 8 - 1] = Min;
-			Min = FLT_MAX_G729;
+			st->Min_buffer[(int)frm_count / 8 - 1] = st->Min;
+			st->Min = FLT_MAX_G729;
 		}
 	}
 	if ((frm_count % 8) == 0) {
-		Prev_Min = Min_buffer[0];
+		st->Prev_Min = st->Min_buffer[0];
 		for (i = 1; i < 15; i++) {
-			if (Min_buffer[i] < Prev_Min)
-				Prev_Min = Min_buffer[i];
+			if (st->Min_buffer[i] < st->Prev_Min)
+				st->Prev_Min = st->Min_buffer[i];
 		}
 	}
 
 	if (frm_count >= 129) {
 		if ((frm_count % 8) == 1) {
-			Min = Prev_Min;
-			Next_Min = FLT_MAX_G729;
+			st->Min = st->Prev_Min;
+			st->Next_Min = FLT_MAX_G729;
 		}
-		if (norm_energy < Min)
-			Min = norm_energy;
-		if (norm_energy < Next_Min)
-			Next_Min = norm_energy;
+		if (norm_energy < st->Min)
+			st->Min = norm_energy;
+		if (norm_energy < st->Next_Min)
+			st->Next_Min = norm_energy;
 		if ((frm_count % 8) == 0) {
 			for (i = 0; i < 15; i++)
-				Min_buffer[i] = Min_buffer[i + 1];
-			Min_buffer[15] = Next_Min;
-			Prev_Min = Min_buffer[0];
+				st->Min_buffer[i] = st->Min_buffer[i + 1];
+			st->Min_buffer[15] = st->Next_Min;
+			st->Prev_Min = st->Min_buffer[0];
 			for (i = 1; i < 16; i++) {
-				if (Min_buffer[i] < Prev_Min)
-					Prev_Min = Min_buffer[i];
+				if (st->Min_buffer[i] < st->Prev_Min)
+					st->Prev_Min = st->Min_buffer[i];
 			}
 
 		}
@@ -180,33 +172,33 @@ void vad(float rc,
 
 	if (frm_count <= INIT_FRAME) {
 		if (norm_energy < (float) 21.0) {
-			less_count++;
+			st->less_count++;
 			*marker = NOISE;
 		} else {
 			*marker = VOICE;
-			MeanE =
-			    (MeanE * ((float) (frm_count - less_count - 1)) +
-			     norm_energy) / (float) (frm_count - less_count);
-			MeanSZC =
-			    (MeanSZC * ((float) (frm_count - less_count - 1)) +
-			     ZC) / (float) (frm_count - less_count);
-			dvwadd(MeanLSF, (float) (frm_count - less_count - 1),
-			       lsf, (float) 1.0, MeanLSF, M);
-			dvsmul(MeanLSF,
-			       (float) 1.0 / (float) (frm_count - less_count),
-			       MeanLSF, M);
+			st->MeanE =
+			    (st->MeanE * ((float) (frm_count - st->less_count - 1)) +
+			     norm_energy) / (float) (frm_count - st->less_count);
+			st->MeanSZC =
+			    (st->MeanSZC * ((float) (frm_count - st->less_count - 1)) +
+			     ZC) / (float) (frm_count - st->less_count);
+			dvwadd(st->MeanLSF, (float) (frm_count - st->less_count - 1),
+			       lsf, (float) 1.0, st->MeanLSF, M);
+			dvsmul(st->MeanLSF,
+			       (float) 1.0 / (float) (frm_count - st->less_count),
+			       st->MeanLSF, M);
 		}
 	}
 
 	if (frm_count >= INIT_FRAME) {
 		if (frm_count == INIT_FRAME) {
-			MeanSE = MeanE - (float) 10.0;
-			MeanSLE = MeanE - (float) 12.0;
+			st->MeanSE = st->MeanE - (float) 10.0;
+			st->MeanSLE = st->MeanE - (float) 12.0;
 		}
 
-		dSE = MeanSE - norm_energy;
-		dSLE = MeanSLE - E_low;
-		dSZC = MeanSZC - ZC;
+		dSE = st->MeanSE - norm_energy;
+		dSLE = st->MeanSLE - E_low;
+		dSZC = st->MeanSZC - ZC;
 
 		if (norm_energy < (float) 21.0) {
 			*marker = NOISE;
@@ -214,67 +206,67 @@ void vad(float rc,
 			*marker = MakeDec(dSLE, dSE, SD, dSZC);
 		}
 
-		v_flag = 0;
+		st->v_flag = 0;
 		if ((prev_marker == VOICE) && (*marker == NOISE) &&
-		    (norm_energy > MeanSE + (float) 2.0)
+		    (norm_energy > st->MeanSE + (float) 2.0)
 		    && (norm_energy > (float) 21.0)) {
 			*marker = VOICE;
-			v_flag = 1;
+			st->v_flag = 1;
 		}
 
-		if (flag == 1) {
+		if (st->flag == 1) {
 			if ((pprev_marker == VOICE) && (prev_marker == VOICE) &&
 			    (*marker == NOISE)
-			    && (fabs(prev_energy - norm_energy) <= (float) 3.0)) {
-				count_ext++;
+			    && (fabs(st->prev_energy - norm_energy) <= (float) 3.0)) {
+				st->count_ext++;
 				*marker = VOICE;
-				v_flag = 1;
-				if (count_ext <= 4)
-					flag = 1;
+				st->v_flag = 1;
+				if (st->count_ext <= 4)
+					st->flag = 1;
 				else {
-					flag = 0;
-					count_ext = 0;
+					st->flag = 0;
+					st->count_ext = 0;
 				}
 			}
 		} else
-			flag = 1;
+			st->flag = 1;
 
 		if (*marker == NOISE)
-			count_sil++;
+			st->count_sil++;
 
-		if ((*marker == VOICE) && (count_sil > 10) &&
-		    ((norm_energy - prev_energy) <= (float) 3.0)) {
+		if ((*marker == VOICE) && (st->count_sil > 10) &&
+		    ((norm_energy - st->prev_energy) <= (float) 3.0)) {
 			*marker = NOISE;
-			count_sil = 0;
+			st->count_sil = 0;
 		}
 
 		if (*marker == VOICE)
-			count_sil = 0;
+			st->count_sil = 0;
 
-		if ((norm_energy < MeanSE + (float) 3.0) && (frm_count > 128)
-		    && (!v_flag) && (rc < (float) 0.6))
+		if ((norm_energy < st->MeanSE + (float) 3.0) && (frm_count > 128)
+		    && (!st->v_flag) && (rc < (float) 0.6))
 			*marker = NOISE;
 
-		if ((norm_energy < MeanSE + (float) 3.0) && (rc < (float) 0.75)
+		if ((norm_energy < st->MeanSE + (float) 3.0) && (rc < (float) 0.75)
 		    && (SD < (float) 0.002532959)) {
-			count_update++;
-			if (count_update < INIT_COUNT) {
+			st->count_update++;
+			if (st->count_update < INIT_COUNT) {
 				COEF = (float) 0.75;
 				COEFZC = (float) 0.8;
 				COEFSD = (float) 0.6;
-			} else if (count_update < INIT_COUNT + 10) {
+			} else if (st->count_update < INIT_COUNT + 10) {
 				COEF = (float) 0.95;
 				COEFZC = (float) 0.92;
 				COEFSD = (float) 0.65;
-			} else if (count_update < INIT_COUNT + 20) {
+			} else if (st->count_update < INIT_COUNT + 20) {
 				COEF = (float) 0.97;
 				COEFZC = (float) 0.94;
 				COEFSD = (float) 0.70;
-			} else if (count_update < INIT_COUNT + 30) {
+			} else if (st->count_update < INIT_COUNT + 30) {
 				COEF = (float) 0.99;
 				COEFZC = (float) 0.96;
 				COEFSD = (float) 0.75;
-			} else if (count_update < INIT_COUNT + 40) {
+			} else if (st->count_update < INIT_COUNT + 40) {
 				COEF = (float) 0.995;
 				COEFZC = (float) 0.99;
 				COEFSD = (float) 0.75;
@@ -283,22 +275,22 @@ void vad(float rc,
 				COEFZC = (float) 0.998;
 				COEFSD = (float) 0.75;
 			}
-			dvwadd(MeanLSF, COEFSD, lsf, (float) 1.0 - COEFSD, MeanLSF,
+			dvwadd(st->MeanLSF, COEFSD, lsf, (float) 1.0 - COEFSD, st->MeanLSF,
 			       M);
-			MeanSE = COEF * MeanSE + ((float) 1.0 - COEF) * norm_energy;
-			MeanSLE = COEF * MeanSLE + ((float) 1.0 - COEF) * E_low;
-			MeanSZC = COEFZC * MeanSZC + ((float) 1.0 - COEFZC) * ZC;
+			st->MeanSE = COEF * st->MeanSE + ((float) 1.0 - COEF) * norm_energy;
+			st->MeanSLE = COEF * st->MeanSLE + ((float) 1.0 - COEF) * E_low;
+			st->MeanSZC = COEFZC * st->MeanSZC + ((float) 1.0 - COEFZC) * ZC;
 		}
 
 		if (((frm_count > 128)
-		     && ((MeanSE < Min) && (SD < (float) 0.002532959)))
-		    || (MeanSE > Min + (float) 10.0)) {
-			MeanSE = Min;
-			count_update = 0;
+		     && ((st->MeanSE < st->Min) && (SD < (float) 0.002532959)))
+		    || (st->MeanSE > st->Min + (float) 10.0)) {
+			st->MeanSE = st->Min;
+			st->count_update = 0;
 		}
 	}
 
-	prev_energy = norm_energy;
+	st->prev_energy = norm_energy;
 	return;
 }
 
@@ -20,7 +20,17 @@
 #define     ZC_START      120
 #define     ZC_END        200
 
-void vad_init(void);
+struct vad_state {
+	float MeanLSF[M];
+	float Min_buffer[16];
+	float Prev_Min, Next_Min, Min;
+	float MeanE, MeanSE, MeanSLE, MeanSZC;
+	float prev_energy;
+	int count_sil, count_update, count_ext;
+	int flag, v_flag, less_count;
+};
 
-void vad(float rc, float * lsf, float * rxx, float * sigpp, int frm_count,
-	 int prev_marker, int pprev_marker, int *marker, float * Energy_db);
+void vad_init(struct vad_state *st);
+
+void vad(struct vad_state *st, float rc, float * lsf, float * rxx,
+	 float * sigpp, int frm_count, int prev_marker, int pprev_marker, int *marker, float * Energy_db);
@@ -42,6 +42,7 @@
 #include "sp_dec.h"
 #include "sp_rom.h"
 #include "sp_frm.h"
+#include "state.h"
 
 /*________________________________________________________________________
  |                                                                        |
@@ -60,33 +61,6 @@
 #define ASHIFT 4
 #define ASCALE 0x0800
 
-/*________________________________________________________________________
- |                                                                        |
- |                        Global Variables                                |
- |________________________________________________________________________|
-*/
-
-int16_t swVadFrmCnt = 0;	/* Indicates the number of sequential
-				 * frames where VAD == 0 */
-
-short int siUpdPointer = 0;
-int16_t swNElapsed = 50;
-
-int32_t pL_GsHist[N_SUB * (OVERHANG - 1)];
-
-/*________________________________________________________________________
- |                                                                        |
- |                     Other External Variables                           |
- |________________________________________________________________________|
-*/
-
-extern int iLimit;
-
-extern int16_t swR0Dec, swOldR0Dec, swR0NewCN;
-
-extern int16_t swCNR0,
-    pswCNLpc[], pswCNGsp0Code[], pswCNVSCode1[], pswCNVSCode2[];
-
 /*________________________________________________________________________
  |                                                                        |
  |                         DTX Rom Tables                                 |
@@ -155,7 +129,9 @@ int32_t ppLr_gsTable[4][32] = {
  *
  *   INPUTS:
  *
- *   swVadFrmCnt (global) - swVadFlag=0 frame counter.
+ *   st - encoder instance, holds the comfort noise history.
+ *
+ *   st->swVadFrmCnt - swVadFlag=0 frame counter.
  *   If swVadFlag=1 then this counter is 0, the first frame with
  *   swVadFlag=0 will set this counter to 1, with each additional
  *   swVadFlag=0 frame the counter is incremented.
@@ -172,17 +148,17 @@ int32_t ppLr_gsTable[4][32] = {
  *
  *   OUTPUTS:
  *
- *   swCNR0 - global variable, the output quantized R0 index
+ *   st->swCNR0 - the output quantized R0 index
  *
- *   pswCNLpc[3]  - global variable, the output quantized LPC to the
+ *   st->pswCNLpc[3]  - the output quantized LPC to the
  *   transmitted in the SID frame
  *
- *   pswCNGsp0Code[N_SUB] - global variable, the output quantized GSP0 indices
+ *   st->pswCNGsp0Code[N_SUB] - the output quantized GSP0 indices
  *
- *   pswCNVSCode1[N_SUB] - global variable, the output quantized codevector 1
+ *   st->pswCNVSCode1[N_SUB] - the output quantized codevector 1
  *   indices.
  *
- *   pswCNVSCode2[N_SUB] - global variable, the output quantized codevector 2
+ *   st->pswCNVSCode2[N_SUB] - the output quantized codevector 2
  *   indices.
  *
  *
@@ -193,30 +169,10 @@ int32_t ppLr_gsTable[4][32] = {
  *
  *************************************************************************/
 
-int16_t swComfortNoise(int16_t swVadFlag,
+int16_t swComfortNoise(struct gsmhr_enc *st, int16_t swVadFlag,
 			 int32_t L_UnqntzdR0, int32_t * pL_UnqntzdCorr)
 {
 
-/*________________________________________________________________________
- |                                                                        |
- |                        Static Variables                                |
- |________________________________________________________________________|
-*/
-
-	/* history of unquantized parameters */
-	static int32_t pL_R0Hist[OVERHANG];
-	static int32_t ppL_CorrHist[OVERHANG][NP + 1];
-
-	/* quantized reference parameters */
-	static int16_t swQntRefR0, swRefGsIndex;
-	static int piRefVqCodewds[3];
-
-	/* handling of short speech bursts */
-	static int16_t swShortBurst;
-
-	/* state value of random generator */
-	static int32_t L_TxPNSeed;
-
 /*_________________________________________________________________________
  |                                                                         |
  |                            Automatic Variables                          |
@@ -246,55 +202,59 @@ int16_t swComfortNoise(int16_t swVadFlag,
 	/* ------------------------------------------------------------- */
 
 	if (swVadFlag)
-		swVadFrmCnt = 0;	/* Voice acitvity present */
+		st->swVadFrmCnt = 0;	/* Voice acitvity present */
 	else
-		swVadFrmCnt = add(swVadFrmCnt, 1);	/* no voice activity */
+		/* no voice activity */
+		st->swVadFrmCnt = add(st->swVadFrmCnt, 1);
 
 	/* swNElapsed will indicate the number of frames that have elapsed */
 	/* since the last SID frame with updated comfort noise parameters  */
 	/* was generated                                                   */
 	/* --------------------------------------------------------------- */
 
-	swNElapsed = add(swNElapsed, 1);
+	st->swNElapsed = add(st->swNElapsed, 1);
 
 	/* If no voice activity was detected.  */
 	/* ----------------------------------- */
 
-	if (swVadFrmCnt) {
+	if (st->swVadFrmCnt) {
 
 		/* Short speech burst ? */
 		/* -------------------- */
 
-		if (swVadFrmCnt == 1) {
-			if (sub(swNElapsed, 24) < 0)
-				swShortBurst = 1;	/* short speech burst detected */
+		if (st->swVadFrmCnt == 1) {
+			if (sub(st->swNElapsed, 24) < 0)
+				st->swShortBurst = 1;	/* short speech burst
+							 * detected */
 			else
-				swShortBurst = 0;	/* long speech burst detected */
+				st->swShortBurst = 0;	/* long speech burst
+							 * detected */
 		}
 
 		/* Update history, with this frames data */
 		/* ------------------------------------- */
 
-		updateCNHist(L_UnqntzdR0, pL_UnqntzdCorr,
-			     pL_R0Hist, ppL_CorrHist);
+		updateCNHist(st, L_UnqntzdR0, pL_UnqntzdCorr,
+			     st->pL_R0Hist, st->ppL_CorrHist);
 
 		/* first SID frame */
 		/* --------------- */
 
-		if (((swShortBurst == 0) && (swVadFrmCnt == OVERHANG)) ||
-		    ((swShortBurst == 1) && (swVadFrmCnt == 1))) {
+		if (((st->swShortBurst == 0)
+		     && (st->swVadFrmCnt == OVERHANG)) ||
+		    ((st->swShortBurst == 1) && (st->swVadFrmCnt == 1))) {
 
 			/* init. random generator */
 			/* ---------------------- */
-			L_TxPNSeed = PN_INIT_SEED;
+			st->L_TxPNSeed = PN_INIT_SEED;
 
 			/* average GS */
 			/* ---------- */
-			avgGsHistQntz(pL_GsHist, &L_RefGs);
+			avgGsHistQntz(st->pL_GsHist, &L_RefGs);
 
 			/* GS quantization */
 			/* --------------- */
-			swRefGsIndex = gsQuant(L_RefGs, 0);
+			st->swRefGsIndex = gsQuant(L_RefGs, 0);
 
 		}
 
@@ -302,7 +262,7 @@ int16_t swComfortNoise(int16_t swVadFlag,
 		/* generate SID frames with repeated comfort noise parameters */
 		/* ---------------------------------------------------------- */
 
-		if ((swShortBurst == 1) && (swVadFrmCnt < OVERHANG)) {
+		if ((st->swShortBurst == 1) && (st->swVadFrmCnt < OVERHANG)) {
 
 			/* generate a SID frame with repeated parameters */
 			/* --------------------------------------------- */
@@ -312,55 +272,55 @@ int16_t swComfortNoise(int16_t swVadFlag,
 			/* repeat data: r0, LPC, GS */
 			/* ------------------------ */
 
-			swCNR0 = swQntRefR0;
+			st->swCNR0 = st->swQntRefR0;
 
 			for (i = 0; i < 3; i++)
-				pswCNLpc[i] = piRefVqCodewds[i];
+				st->pswCNLpc[i] = st->piRefVqCodewds[i];
 
 			for (i = 0; i < N_SUB; i++)
-				pswCNGsp0Code[i] = swRefGsIndex;
+				st->pswCNGsp0Code[i] = st->swRefGsIndex;
 
 		}
 
 		/* generate SID frames with updated comfort noise parameters */
 		/* --------------------------------------------------------- */
 
-		if (swVadFrmCnt >= OVERHANG) {
+		if (st->swVadFrmCnt >= OVERHANG) {
 
 			/* A SID frame with updated parameters */
 			/* ----------------------------------- */
 
 			swSP = 0;
-			swNElapsed = 0;
+			st->swNElapsed = 0;
 
 			/* average R0 and correlation values */
 			/* --------------------------------- */
 
-			avgCNHist(pL_R0Hist, ppL_CorrHist, &L_RefR0,
+			avgCNHist(st->pL_R0Hist, st->ppL_CorrHist, &L_RefR0,
 				  pL_RefCorr);
 
 			/* now quantize the averaged R(0) */
 			/* ------------------------------ */
 
-			swQntRefR0 = r0Quant(L_RefR0);
+			st->swQntRefR0 = r0Quant(L_RefR0);
 
 			/* Quantize the averaged correlation */
 			/* --------------------------------- */
 
-			lpcCorrQntz(pL_RefCorr, pswFinalRc, piRefVqCodewds);
+			lpcCorrQntz(st, pL_RefCorr, pswFinalRc, st->piRefVqCodewds);
 
 			/* update frame data: r0, LPC */
 			/* -------------------------- */
 
-			swCNR0 = swQntRefR0;
+			st->swCNR0 = st->swQntRefR0;
 			for (i = 0; i < 3; i++)
-				pswCNLpc[i] = piRefVqCodewds[i];
+				st->pswCNLpc[i] = st->piRefVqCodewds[i];
 
 			/* update subframe data (unvoiced mode): GSP0 */
 			/* ------------------------------------------ */
 
 			for (i = 0; i < N_SUB; i++)
-				pswCNGsp0Code[i] = swRefGsIndex;
+				st->pswCNGsp0Code[i] = st->swRefGsIndex;
 
 		}
 
@@ -369,8 +329,8 @@ int16_t swComfortNoise(int16_t swVadFlag,
 
 		if (swSP == 0) {
 			for (i = 0; i < N_SUB; i++) {
-				pswCNVSCode1[i] = getPnBits(7, &L_TxPNSeed);
-				pswCNVSCode2[i] = getPnBits(7, &L_TxPNSeed);
+				st->pswCNVSCode1[i] = getPnBits(7, &st->L_TxPNSeed);
+				st->pswCNVSCode2[i] = getPnBits(7, &st->L_TxPNSeed);
 			}
 		}
 
@@ -399,7 +359,7 @@ int16_t swComfortNoise(int16_t swVadFlag,
  *     pL_UnqntzdCorr[NP+1] - unquantized correlation coefficient
  *     array.  Also an output of FLAT.
  *
- *     siUpdPointer (global) - A modulo counter which counts up from
+ *     st->siUpdPointer - A modulo counter which counts up from
  *     0 to OVERHANG-1.
  *
  *   OUTPUTS:
@@ -416,7 +376,7 @@ int16_t swComfortNoise(int16_t swVadFlag,
  *
  *************************************************************************/
 
-void updateCNHist(int32_t L_UnqntzdR0,
+void updateCNHist(struct gsmhr_enc *st, int32_t L_UnqntzdR0,
 		  int32_t * pL_UnqntzdCorr,
 		  int32_t pL_R0History[],
 		  int32_t ppL_CorrHistory[OVERHANG][NP + 1])
@@ -437,12 +397,12 @@ void updateCNHist(int32_t L_UnqntzdR0,
 */
 
 	/* update */
-	pL_R0History[siUpdPointer] = L_UnqntzdR0;
+	pL_R0History[st->siUpdPointer] = L_UnqntzdR0;
 
 	for (i = 0; i < NP + 1; i++)
-		ppL_CorrHistory[siUpdPointer][i] = pL_UnqntzdCorr[i];
+		ppL_CorrHistory[st->siUpdPointer][i] = pL_UnqntzdCorr[i];
 
-	siUpdPointer = (siUpdPointer + 1) % OVERHANG;
+	st->siUpdPointer = (st->siUpdPointer + 1) % OVERHANG;
 }
 
 /*************************************************************************
@@ -656,6 +616,9 @@ void avgCNHist(int32_t pL_R0History[],
  *
  *    INPUT:
  *
+ *         st
+ *                     Encoder instance, used for the Rc-VQ search.
+ *
  *         pL_CorrelSeq[NP+1]
  *                     Correlation sequence to quantize.
  *
@@ -676,7 +639,7 @@ void avgCNHist(int32_t pL_R0History[],
  *
  *************************************************************************/
 
-void lpcCorrQntz(int32_t pL_CorrelSeq[],
+void lpcCorrQntz(struct gsmhr_enc *st, int32_t pL_CorrelSeq[],
 		 int16_t pswFinalRc[], int piVQCodewds[])
 {
 
@@ -740,24 +703,24 @@ void lpcCorrQntz(int32_t pL_CorrelSeq[],
 		/* do aflat for all vectors in the list */
     /*--------------------------------------*/
 
-		setupPreQ(iSeg, quantList.iRCIndex);	/* set up vector ptrs */
+		setupPreQ(st, iSeg, quantList.iRCIndex);	/* set up vector ptrs */
 
 		for (iCnt = 0; iCnt < quantList.iNum; iCnt++) {
 			/* get a vector */
       /*--------------*/
 
-			getNextVec(pswRc);
+			getNextVec(st, pswRc);
 
 			/* clear the limiter flag */
       /*------------------------*/
 
-			iLimit = 0;
+			st->iLimit = 0;
 
 			/* find the error values for each vector */
       /*---------------------------------------*/
 
 			quantList.pswPredErr[iCnt] =
-			    aflatRecursion(&pswRc[psvqIndex[iSeg - 1].l],
+			    aflatRecursion(st, &pswRc[psvqIndex[iSeg - 1].l],
 					   pswPBar, pswVBar,
 					   ppswPAddrs, ppswVAddrs,
 					   psvqIndex[iSeg - 1].len);
@@ -765,7 +728,7 @@ void lpcCorrQntz(int32_t pL_CorrelSeq[],
 			/* check the limiter flag */
       /*------------------------*/
 
-			if (iLimit)
+			if (st->iLimit)
 				quantList.pswPredErr[iCnt] = 0x7fff;	/* set error to bad value */
 
 		}		/* done list loop */
@@ -784,7 +747,7 @@ void lpcCorrQntz(int32_t pL_CorrelSeq[],
 			quantList.iRCIndex =
 			    bestPql[iVec].iRCIndex * psrQuantSz[iSeg - 1];
 
-			setupQuant(iSeg, quantList.iRCIndex);	/* set up vector ptrs */
+			setupQuant(st, iSeg, quantList.iRCIndex);	/* set up vector ptrs */
 
 			/* do aflat recursion on each element of list */
       /*--------------------------------------------*/
@@ -793,18 +756,18 @@ void lpcCorrQntz(int32_t pL_CorrelSeq[],
 				/* get a vector */
 	/*--------------*/
 
-				getNextVec(pswRc);
+				getNextVec(st, pswRc);
 
 				/* clear the limiter flag */
 	/*------------------------*/
 
-				iLimit = 0;
+				st->iLimit = 0;
 
 				/* find the error values for each vector */
 	/*---------------------------------------*/
 
 				quantList.pswPredErr[iCnt] =
-				    aflatRecursion(&pswRc
+				    aflatRecursion(st, &pswRc
 						   [psvqIndex[iSeg - 1].l],
 						   pswPBar, pswVBar, ppswPAddrs,
 						   ppswVAddrs,
@@ -813,7 +776,7 @@ void lpcCorrQntz(int32_t pL_CorrelSeq[],
 				/* check the limiter flag */
 	/*------------------------*/
 
-				if (iLimit)
+				if (st->iLimit)
 					quantList.pswPredErr[iCnt] = 0x7fff;	/* set error to the worst
 										 * value */
 
@@ -835,8 +798,8 @@ void lpcCorrQntz(int32_t pL_CorrelSeq[],
 		/* find the quantized reflection coefficients */
     /*--------------------------------------------*/
 
-		setupQuant(iSeg, bestQl[iSeg].iRCIndex);	/* set up vector ptrs */
-		getNextVec((int16_t *) (pswFinalRc - 1));
+		setupQuant(st, iSeg, bestQl[iSeg].iRCIndex);	/* set up vector ptrs */
+		getNextVec(st, (int16_t *) (pswFinalRc - 1));
 
 		/* Update pBarFull and vBarFull for the next Rc-VQ segment, and */
 		/* update the pswPBar and pswVBar for the next Rc-VQ segment    */
@@ -951,6 +914,8 @@ int16_t getPnBits(int iBits, int32_t * pL_PNSeed)
  *
  *   INPUTS:
  *
+ *     st - decoder instance, holds the interpolation end points.
+ *
  *     pswOldKs - Last frame's reflection coeffs.
  *
  *     pswNewKs - This frame's decoded/received reflection coeffs.
@@ -968,10 +933,10 @@ int16_t getPnBits(int iBits, int32_t * pL_PNSeed)
  *     swFrameType - type of the received frame (VALIDSID, INVALIDSID
  *     GOODSPEECH or UNUSABLE)
  *
- *     swOldR0Dec - global variable, the decoded R0 value from the last
+ *     st->swOldR0Dec - the decoded R0 value from the last
  *     frame .  This will be modified.
  *
- *     swR0NewCN - global variable the decoded R0 value from the frame
+ *     st->swR0NewCN - the decoded R0 value from the frame
  *     just received. Valid information if current frame is a SID frame.
  *
  *
@@ -980,21 +945,21 @@ int16_t getPnBits(int iBits, int32_t * pL_PNSeed)
  *     pswNewKs - This frames LPC coeffs. modified to reflect
  *     interpolated correlation sequence pL_CorrSeq[].
  *
- *     swR0Dec - global variable, interpolated R0 value
+ *     st->swR0Dec - interpolated R0 value
  *
- *     swR0OldCN - global variable, R0 interpolation point to
+ *     st->swR0OldCN - R0 interpolation point to
  *     interpolate from.
  *
- *     swR0NewCN - global variable, R0 interpolation point to
+ *     st->swR0NewCN - R0 interpolation point to
  *     interpolate to.
  *
- *     pL_OldCorrSeq[NP+1] - global variable, starting point for
+ *     st->pL_OldCorrSeq[NP+1] - starting point for
  *     interpolation of LPC information.
  *
- *     pL_NewCorrSeq[NP+1] - global variable, end point for
+ *     st->pL_NewCorrSeq[NP+1] - end point for
  *     interpolation of LPC information.
  *
- *     pL_CorrSeq[NP+1] - global variable, interpolated value of LPC
+ *     st->pL_CorrSeq[NP+1] - interpolated value of LPC
  *     information to be used in this frame.
  *
  *
@@ -1006,21 +971,12 @@ int16_t getPnBits(int iBits, int32_t * pL_PNSeed)
  *
  *************************************************************************/
 
-void rxInterpR0Lpc(int16_t * pswOldKs, int16_t * pswNewKs,
+void rxInterpR0Lpc(struct gsmhr_dec *st,
+		   int16_t * pswOldKs, int16_t * pswNewKs,
 		   int16_t swRxDTXState,
 		   int16_t swDecoMode, int16_t swFrameType)
 {
 
-/*________________________________________________________________________
- |                                                                        |
- |                        Static Variables                                |
- |________________________________________________________________________|
-*/
-
-	static int16_t swR0OldCN;
-	static int32_t pL_OldCorrSeq[NP + 1],
-	    pL_NewCorrSeq[NP + 1], pL_CorrSeq[NP + 1];
-
 /*_________________________________________________________________________
  |                                                                         |
  |                            Automatic Variables                          |
@@ -1043,78 +999,81 @@ void rxInterpR0Lpc(int16_t * pswOldKs, int16_t * pswNewKs,
 		/* i.e. no interpolation for the first frames           */
 		/* ---------------------------------------------------- */
 
-		swR0OldCN = swOldR0Dec;	/* last non-SID, received R0 */
-		swR0Dec = linInterpSidShort(swR0NewCN, swR0OldCN, swRxDTXState);
+		st->swR0OldCN = st->swOldR0Dec;	/* last non-SID, received R0 */
+		st->swR0Dec = linInterpSidShort(st->swR0NewCN, st->swR0OldCN,
+					       swRxDTXState);
 
 		/* generate the LPC end points for interpolation */
 		/* --------------------------------------------- */
 
-		rcToCorrDpL(ASHIFT, ASCALE, pswOldKs, pL_OldCorrSeq);
-		rcToCorrDpL(ASHIFT, ASCALE, pswNewKs, pL_NewCorrSeq);
+		rcToCorrDpL(ASHIFT, ASCALE, pswOldKs, st->pL_OldCorrSeq);
+		rcToCorrDpL(ASHIFT, ASCALE, pswNewKs, st->pL_NewCorrSeq);
 
 		/* linearly interpolate between the two sets of correlation coefs */
 		/* -------------------------------------------------------------- */
 
 		for (i = 0; i < NP + 1; i++) {
-			pL_CorrSeq[i] =
-			    linInterpSid(pL_NewCorrSeq[i], pL_OldCorrSeq[i],
-					 swRxDTXState);
+			st->pL_CorrSeq[i] =
+			    linInterpSid(st->pL_NewCorrSeq[i],
+					 st->pL_OldCorrSeq[i], swRxDTXState);
 		}
 
 		/* Generate this frames K's (overwrite input) */
 		/* ------------------------------------------ */
 
-		aFlatRcDp(pL_CorrSeq, pswNewKs);
+		aFlatRcDp(st->pL_CorrSeq, pswNewKs);
 
 	} else if ((swDecoMode == CNICONT) && (swFrameType == VALIDSID)) {
 		/* new (not the first) SID frame arrived */
 		/* ------------------------------------- */
 
-		swR0OldCN = swOldR0Dec;	/* move current state of R0 to old */
-		swR0Dec = linInterpSidShort(swR0NewCN, swR0OldCN, swRxDTXState);
+		st->swR0OldCN = st->swOldR0Dec;	/* move current state of R0 to old */
+		st->swR0Dec = linInterpSidShort(st->swR0NewCN, st->swR0OldCN,
+					       swRxDTXState);
 
 		/* LPC: generate new endpoints for interpolation */
 		/* --------------------------------------------- */
 
 		for (i = 0; i < NP + 1; i++) {
-			pL_OldCorrSeq[i] = pL_CorrSeq[i];
+			st->pL_OldCorrSeq[i] = st->pL_CorrSeq[i];
 		}
 
-		rcToCorrDpL(ASHIFT, ASCALE, pswNewKs, pL_NewCorrSeq);
+		rcToCorrDpL(ASHIFT, ASCALE, pswNewKs, st->pL_NewCorrSeq);
 
 		/* linearly interpolate between the two sets of correlation coefs */
 		/* -------------------------------------------------------------- */
 
 		for (i = 0; i < NP + 1; i++) {
-			pL_CorrSeq[i] =
-			    linInterpSid(pL_NewCorrSeq[i], pL_OldCorrSeq[i],
-					 swRxDTXState);
+			st->pL_CorrSeq[i] =
+			    linInterpSid(st->pL_NewCorrSeq[i],
+					 st->pL_OldCorrSeq[i], swRxDTXState);
 		}
 
 		/* Use interpolated LPC for this frame, overwrite the input K's */
 		/* ------------------------------------------------------------ */
 
-		aFlatRcDp(pL_CorrSeq, pswNewKs);
+		aFlatRcDp(st->pL_CorrSeq, pswNewKs);
 
 	} else {
 		/* in between SID frames / invalid SID frames */
 		/* ------------------------------------------ */
 
-		swR0Dec = linInterpSidShort(swR0NewCN, swR0OldCN, swRxDTXState);
+		st->swR0Dec = linInterpSidShort(st->swR0NewCN, st->swR0OldCN,
+					       swRxDTXState);
 
 		/* linearly interpolate between the two sets of correlation coefs */
 		/* -------------------------------------------------------------- */
 
 		for (i = 0; i < NP + 1; i++) {
-			pL_CorrSeq[i] =
-			    linInterpSid(pL_NewCorrSeq[i], pL_OldCorrSeq[i],
-					 swRxDTXState);
+			st->pL_CorrSeq[i] =
+			    linInterpSid(st->pL_NewCorrSeq[i],
+					 st->pL_OldCorrSeq[i], swRxDTXState);
 		}
 
 		/* Use interpolated LPC for this frame, overwrite the input K's */
 		/* ------------------------------------------------------------ */
 
-		aFlatRcDp(pL_CorrSeq, pswNewKs);
+		aFlatRcDp(st->pL_CorrSeq, pswNewKs);
 
 	}
 }
@@ -32,6 +32,7 @@
 #include "mathhalf.h"
 #include "sp_dec.h"
 #include "err_conc.h"
+#include "state.h"
 
 /*_________________________________________________________________________
  |                                                                         |
@@ -40,15 +41,6 @@
 */
 #define  MIN_MUTE_LEVEL -45
 
-/*_________________________________________________________________________
- |                                                                         |
- |                         State variables (globals)                       |
- |_________________________________________________________________________|
-*/
-
-int32_t plSubfrEnergyMem[4];
-int16_t swLevelMem[4], lastR0, pswLastGood[18], swState, swLastFlag;
-
 /*****************************************************************************
  *
  *   FUNCTION NAME: para_conceal_speech_decoder
@@ -87,7 +79,8 @@ int16_t swLevelMem[4], lastR0, pswLastGood[18], swState, swLastFlag;
  *     If the level increase is higher than the determined limit
  *     then muting is allowed.
  *
- *     Input:     pswErrorFlag[0]   badframe flag from channel decoder
+ *     Input:     st                decoder instance
+ *                pswErrorFlag[0]   badframe flag from channel decoder
  *                pswErrorFlag[1]   unreliable frame flag from channel decoder
  *                pswSpeechPara[]   unconcealed speech parameters
  *     Output:    pswSpeechPara[]   concealed speech parameters
@@ -102,7 +95,8 @@ int16_t swLevelMem[4], lastR0, pswLastGood[18], swState, swLastFlag;
  *
  ****************************************************************************/
 
-void para_conceal_speech_decoder(int16_t pswErrorFlag[],
+void para_conceal_speech_decoder(struct gsmhr_dec *st,
+				 int16_t pswErrorFlag[],
 				 int16_t pswSpeechPara[],
 				 int16_t * pswMutePermit)
 {
@@ -144,7 +138,7 @@ void para_conceal_speech_decoder(int16_t pswErrorFlag[],
 
 	/* Determine R0-difference to last frame */
 	/* ------------------------------------- */
-	r0_diff = sub(pswSpeechPara[0], lastR0);
+	r0_diff = sub(pswSpeechPara[0], st->lastR0);
 
 	/* If no badframe has been declared, but the frame is unreliable then */
 	/* check whether there is an abnormal increase of R0                  */
@@ -154,7 +148,7 @@ void para_conceal_speech_decoder(int16_t pswErrorFlag[],
 		/* Check if difference exceeds the maximum allowed threshold. */
 		/* If yes, set badframe flag                                  */
 		/* ---------------------------------------------------------- */
-		if (sub(r0_diff, psrR0RepeatThreshold[lastR0]) >= 0) {
+		if (sub(r0_diff, psrR0RepeatThreshold[st->lastR0]) >= 0) {
 			pswErrorFlag[0] = 1;
 		} else {
 			/* Allow muting if R0 >= 30 */
@@ -172,7 +166,7 @@ void para_conceal_speech_decoder(int16_t pswErrorFlag[],
 		/* Check if difference exceeds a threshold.                   */
 		/* If yes, allow muting in the signal concealment unit        */
 		/* ---------------------------------------------------------- */
-		if (sub(r0_diff, psrR0MuteThreshold[lastR0]) >= 0) {
+		if (sub(r0_diff, psrR0MuteThreshold[st->lastR0]) >= 0) {
 			*pswMutePermit = 1;
 		}
 	}
@@ -181,38 +175,38 @@ void para_conceal_speech_decoder(int16_t pswErrorFlag[],
 	/* -------------------------------------------------------------- */
 
 	if (pswErrorFlag[0] > 0) {
-		swState = add(swState, 1);	/* update the bad frame
+		st->swState = add(st->swState, 1);	/* update the bad frame
 						 * masking state */
-		if (sub(swState, 6) > 0)
-			swState = 6;
+		if (sub(st->swState, 6) > 0)
+			st->swState = 6;
 	} else {
-		if (sub(swState, 6) < 0)
-			swState = 0;
-		else if (swLastFlag == 0)
-			swState = 0;
+		if (sub(st->swState, 6) < 0)
+			st->swState = 0;
+		else if (st->swLastFlag == 0)
+			st->swState = 0;
 	}
 
-	swLastFlag = pswErrorFlag[0];
+	st->swLastFlag = pswErrorFlag[0];
 
 	/* if the decoded frame is good, save it */
 	/* ------------------------------------- */
-	if (swState == 0) {
+	if (st->swState == 0) {
 		for (i = 0; i < 18; i++)
-			pswLastGood[i] = pswSpeechPara[i];
+			st->pswLastGood[i] = pswSpeechPara[i];
 	}
 
 	/* if the frame is bad, attenuate and repeat last good frame */
 	/* --------------------------------------------------------- */
 	else {
-		if ((sub(swState, 3) >= 0) && (sub(swState, 5) <= 0)) {
-			swR0 = sub(pswLastGood[0], 2);	/* attenuate by 4 dB */
+		if ((sub(st->swState, 3) >= 0) && (sub(st->swState, 5) <= 0)) {
+			swR0 = sub(st->pswLastGood[0], 2);	/* attenuate by 4 dB */
 			if (swR0 < 0)
 				swR0 = 0;
-			pswLastGood[0] = swR0;
+			st->pswLastGood[0] = swR0;
 		}
 
-		if (sub(swState, 6) >= 0)	/* mute */
-			pswLastGood[0] = 0;
+		if (sub(st->swState, 6) >= 0)	/* mute */
+			st->pswLastGood[0] = 0;
 
 		/* If the last good frame is unvoiced, use its energy, voicing mode, lpc
 		 * coefficients, and soft interpolation.   For gsp0, use only the gsp0
@@ -220,19 +214,19 @@ void para_conceal_speech_decoder(int16_t pswErrorFlag[],
 		 * unvoiced, use the current codewords.  If not, use the codewords from
 		 * the last good frame.               */
 		/* -------------------------------------------------------------- */
-		if (pswLastGood[5] == 0) {	/* unvoiced good frame */
+		if (st->pswLastGood[5] == 0) {	/* unvoiced good frame */
 			if (pswSpeechPara[5] == 0) {	/* unvoiced bad frame */
 				for (i = 0; i < 5; i++)
-					pswSpeechPara[i] = pswLastGood[i];
+					pswSpeechPara[i] = st->pswLastGood[i];
 				for (i = 0; i < 4; i++)
 					pswSpeechPara[3 * i + 8] =
-					    pswLastGood[17];
+					    st->pswLastGood[17];
 			} else {	/* voiced bad frame */
 				for (i = 0; i < 18; i++)
-					pswSpeechPara[i] = pswLastGood[i];
+					pswSpeechPara[i] = st->pswLastGood[i];
 				for (i = 0; i < 3; i++)
 					pswSpeechPara[3 * i + 8] =
-					    pswLastGood[17];
+					    st->pswLastGood[17];
 			}
 		}
 
@@ -245,9 +239,9 @@ void para_conceal_speech_decoder(int16_t pswErrorFlag[],
 		 * frame.                              */
 		/* ---------------------------------------------------------------- */
 		else {		/* voiced good frame */
-			swLastLag = pswLastGood[6];	/* frame lag */
+			swLastLag = st->pswLastGood[6];	/* frame lag */
 			for (i = 0; i < 3; i++) {	/* each delta lag */
-				swLag = sub(pswLastGood[3 * i + 9], 0x8);	/* biased ahr_round 0 */
+				swLag = sub(st->pswLastGood[3 * i + 9], 0x8);	/* biased ahr_round 0 */
 				swLag = add(swLag, swLastLag);	/* reconstruct pitch */
 				if (sub(swLag, 0x00ff) > 0) {	/* limit, as needed */
 					swLastLag = 0x00ff;
@@ -256,26 +250,26 @@ void para_conceal_speech_decoder(int16_t pswErrorFlag[],
 				} else
 					swLastLag = swLag;
 			}
-			pswLastGood[6] = swLastLag;	/* saved frame lag */
-			pswLastGood[9] = 0x8;	/* saved delta lags */
-			pswLastGood[12] = 0x8;
-			pswLastGood[15] = 0x8;
+			st->pswLastGood[6] = swLastLag;	/* saved frame lag */
+			st->pswLastGood[9] = 0x8;	/* saved delta lags */
+			st->pswLastGood[12] = 0x8;
+			st->pswLastGood[15] = 0x8;
 
 			if (pswSpeechPara[5] != 0) {	/* voiced bad frame */
 				for (i = 0; i < 6; i++)
-					pswSpeechPara[i] = pswLastGood[i];
+					pswSpeechPara[i] = st->pswLastGood[i];
 				for (i = 0; i < 4; i++)
 					pswSpeechPara[3 * i + 6] =
-					    pswLastGood[3 * i + 6];
+					    st->pswLastGood[3 * i + 6];
 				for (i = 0; i < 4; i++)
 					pswSpeechPara[3 * i + 8] =
-					    pswLastGood[17];
+					    st->pswLastGood[17];
 			} else {	/* unvoiced bad frame */
 				for (i = 0; i < 18; i++)
-					pswSpeechPara[i] = pswLastGood[i];
+					pswSpeechPara[i] = st->pswLastGood[i];
 				for (i = 0; i < 3; i++)
 					pswSpeechPara[3 * i + 8] =
-					    pswLastGood[17];
+					    st->pswLastGood[17];
 			}
 		}
 
@@ -283,7 +277,7 @@ void para_conceal_speech_decoder(int16_t pswErrorFlag[],
 
 	/* Update last value of R0 */
 	/* ----------------------- */
-	lastR0 = pswSpeechPara[0];
+	st->lastR0 = pswSpeechPara[0];
 
 }
 
@@ -295,7 +289,8 @@ void para_conceal_speech_decoder(int16_t pswErrorFlag[],
  *     of the last four speech sub-frames. These parameters are the basis
  *     for the level estimation in signal_conceal_sub().
  *
- *     Input:     swUpdate      = 0: the levels are determined
+ *     Input:     st            decoder instance
+ *                swUpdate      = 0: the levels are determined
  *                              = 1: the memory of the level estimator
  *                                   is updated
  *                pswDecodedSpeechFrame[]  synthesized speech signal
@@ -305,7 +300,8 @@ void para_conceal_speech_decoder(int16_t pswErrorFlag[],
  *
  ***************************************************************************/
 
-void level_estimator(int16_t update, int16_t * pswLevelMean,
+void level_estimator(struct gsmhr_dec *st,
+		     int16_t update, int16_t * pswLevelMean,
 		     int16_t * pswLevelMax, int16_t pswDecodedSpeechFrame[])
 {
 
@@ -328,7 +324,7 @@ void level_estimator(int16_t update, int16_t * pswLevelMean,
 		/* Determine mean level of the last 4 sub-frames: */
 		/* ---------------------------------------------- */
 		for (i = 0, L_sum = 0; i < 4; ++i) {
-			L_sum = L_add(L_sum, plSubfrEnergyMem[i]);
+			L_sum = L_add(L_sum, st->plSubfrEnergyMem[i]);
 		}
 		*pswLevelMean = level_calc(1, &L_sum);
 
@@ -336,8 +332,8 @@ void level_estimator(int16_t update, int16_t * pswLevelMean,
 		/* ------------------------------------------------- */
 		*pswLevelMax = -72;
 		for (i = 0; i < 4; ++i) {
-			if (sub(swLevelMem[i], *pswLevelMax) > 0)
-				*pswLevelMax = swLevelMem[i];
+			if (sub(st->swLevelMem[i], *pswLevelMax) > 0)
+				*pswLevelMax = st->swLevelMem[i];
 		}
 
 	} else {
@@ -352,12 +348,12 @@ void level_estimator(int16_t update, int16_t * pswLevelMean,
 		/* Update memories of level estimator: */
 		/* ----------------------------------- */
 		for (i = 0; i < 3; ++i)
-			plSubfrEnergyMem[i] = plSubfrEnergyMem[i + 1];
-		plSubfrEnergyMem[3] = L_sum;
+			st->plSubfrEnergyMem[i] = st->plSubfrEnergyMem[i + 1];
+		st->plSubfrEnergyMem[3] = L_sum;
 
 		for (i = 0; i < 3; ++i)
-			swLevelMem[i] = swLevelMem[i + 1];
-		swLevelMem[3] = swLevelSub;
+			st->swLevelMem[i] = st->swLevelMem[i + 1];
+		st->swLevelMem[3] = swLevelSub;
 	}
 }
 
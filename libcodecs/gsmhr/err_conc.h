@@ -5,19 +5,23 @@
 
 #include "typedefs.h"
 
+struct gsmhr_dec;
+
 /*_________________________________________________________________________
  |                                                                         |
  |                            Function Prototypes                          |
  |_________________________________________________________________________|
 */
 
-void para_conceal_speech_decoder(int16_t pswErrorFlag[],
+void para_conceal_speech_decoder(struct gsmhr_dec *st,
+				 int16_t pswErrorFlag[],
 				 int16_t pswSpeechPara[],
 				 int16_t * pswMutePermit);
 
 int16_t level_calc(int16_t swInd, int32_t * pl_en);
 
-void level_estimator(int16_t update, int16_t * pswLevelMean,
+void level_estimator(struct gsmhr_dec *st,
+		     int16_t update, int16_t * pswLevelMean,
 		     int16_t * pswLevelMax,
 		     int16_t pswDecodedSpeechFrame[]);
 
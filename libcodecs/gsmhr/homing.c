@@ -45,6 +45,7 @@
 #include "vad.h"
 #include "dtx.h"
 #include "homing.h"
+#include "state.h"
 
 /*_________________________________________________________________________
  |                                                                         |
@@ -53,17 +54,7 @@
 */
 
 #define EHF_MASK 0x0008		/* Encoder Homing Frame pattern */
-#define LMAX 142		/* largest lag (integer sense) */
-#define CG_INT_MACS 6		/* Number of multiply-accumulates in
-				 * one interpolation           */
 #define NUM_CLOSED 3		/* maximum number of lags searched */
-#define LPCSTARTINDEX 25	/* where the LPC analysis window
-				 * starts                        */
-#define INBUFFSZ LPCSTARTINDEX + A_LEN	/* input buffer size */
-
-#define LTP_LEN         147	/* maximum ltp lag */
-#define LSMAX           (LMAX + CG_INT_MACS/2)
-#define HNW_BUFF_LEN    LSMAX
 
 /***************************************************************************
  *
@@ -161,7 +152,7 @@ int decoderHomingFrameTest(int16_t pswSpeechPara[], int iLastPara)
  *      resets all of the state variables for the decoder
  *
  *   INPUT:
- *      None
+ *      st    decoder instance state
  *
  *   OUTPUT:
  *      None
@@ -174,39 +165,8 @@ int decoderHomingFrameTest(int16_t pswSpeechPara[], int iLastPara)
  *   KEYWORDS:
  **************************************************************************/
 
-void decoderReset(void)
+void decoderReset(struct gsmhr_dec *st)
 {
-/*_________________________________________________________________________
- |                                                                         |
- |   External declarations for decoder variables which need to be reset    |
- |_________________________________________________________________________|
-*/
-
-	/* variables defined in sp_dec.c */
-	/* ----------------------------- */
-
-	extern int16_t gswPostFiltAgcGain,
-	    gpswPostFiltStateNum[NP],
-	    gpswPostFiltStateDenom[NP],
-	    swPostEmphasisState,
-	    pswSynthFiltState[NP],
-	    pswOldFrmKsDec[NP],
-	    pswOldFrmAsDec[NP],
-	    pswOldFrmPFNum[NP],
-	    pswOldFrmPFDenom[NP],
-	    swOldR0Dec,
-	    pswLtpStateBaseDec[LTP_LEN + S_LEN], pswPPreState[LTP_LEN + S_LEN];
-
-	extern int16_t swMuteFlagOld;	/* error concealment */
-
-	/* variables defined in err_conc.c *//* error concealment */
-	/* ------------------------------- *//* error concealment */
-
-	extern int32_t plSubfrEnergyMem[4];	/* error concealment */
-	extern int16_t swLevelMem[4], lastR0,	/* error concealment */
-	 pswLastGood[18],	/* error concealment */
-	 swState, swLastFlag;	/* error concealment */
-
 /*_________________________________________________________________________
  |                                                                         |
  |   Automatic Variables                                                   |
@@ -224,41 +184,41 @@ void decoderReset(void)
 	/* reset all the decoder state variables */
 	/* ------------------------------------- */
 
-	swOldR0Dec = 0;
+	st->swOldR0Dec = 0;
 
-	gswPostFiltAgcGain = 0;
+	st->gswPostFiltAgcGain = 0;
 
-	swPostEmphasisState = 0;
+	st->swPostEmphasisState = 0;
 
 	for (i = 0; i < NP; i++) {
-		gpswPostFiltStateNum[i] = 0;
-		gpswPostFiltStateDenom[i] = 0;
-		pswSynthFiltState[i] = 0;
-		pswOldFrmKsDec[i] = 0;
-		pswOldFrmAsDec[i] = 0;
-		pswOldFrmPFNum[i] = 0;
-		pswOldFrmPFDenom[i] = 0;
+		st->gpswPostFiltStateNum[i] = 0;
+		st->gpswPostFiltStateDenom[i] = 0;
+		st->pswSynthFiltState[i] = 0;
+		st->pswOldFrmKsDec[i] = 0;
+		st->pswOldFrmAsDec[i] = 0;
+		st->pswOldFrmPFNum[i] = 0;
+		st->pswOldFrmPFDenom[i] = 0;
 	}
 
 	for (i = 0; i < (LTP_LEN + S_LEN); i++) {
-		pswLtpStateBaseDec[i] = 0;
-		pswPPreState[i] = 0;
+		st->pswLtpStateBaseDec[i] = 0;
+		st->pswPPreState[i] = 0;
 	}
 
 	/* reset all the error concealment state variables */
 	/* ----------------------------------------------- */
 
-	swMuteFlagOld = 0;
+	st->swMuteFlagOld = 0;
 
-	lastR0 = 0;
-	swState = 7;
-	swLastFlag = 0;
+	st->lastR0 = 0;
+	st->swState = 7;
+	st->swLastFlag = 0;
 	for (i = 0; i < 3; i++) {
-		plSubfrEnergyMem[i] = 80;
-		swLevelMem[i] = -72;
+		st->plSubfrEnergyMem[i] = 80;
+		st->swLevelMem[i] = -72;
 	}
 	for (i = 0; i < 18; i++) {
-		pswLastGood[i] = 0;
+		st->pswLastGood[i] = 0;
 	}
 
 }
@@ -309,7 +269,7 @@ int encoderHomingFrameTest(int16_t pswSpeech[])
  *      resets all of the state variables for the encoder
  *
  *   INPUT:
- *      None
+ *      st    encoder instance state
  *
  *   OUTPUT:
  *      None
@@ -322,48 +282,9 @@ int encoderHomingFrameTest(int16_t pswSpeech[])
  *   KEYWORDS:
  **************************************************************************/
 
-void encoderReset(void)
+void encoderReset(struct gsmhr_enc *st)
 {
 
-/*_________________________________________________________________________
- |                                                                         |
- |   External declarations for encoder variables which need to be reset    |
- |_________________________________________________________________________|
-*/
-
-	/* variables defined in sp_enc.c */
-	/* ----------------------------- */
-
-	extern int16_t swOldR0;
-	extern int16_t swOldR0Index;
-
-	extern struct NormSw psnsWSfrmEngSpace[];
-
-	extern int16_t pswHPFXState[];
-	extern int16_t pswHPFYState[];
-	extern int16_t pswOldFrmKs[];
-	extern int16_t pswOldFrmAs[];
-	extern int16_t pswOldFrmSNWCoefs[];
-	extern int16_t pswWgtSpeechSpace[];
-
-	extern int16_t pswSpeech[];	/* input speech */
-
-	extern int16_t swPtch;
-
-	/* variables defined in sp_frm.c */
-	/* ----------------------------- */
-
-	extern int16_t pswAnalysisState[NP];
-
-	extern int16_t pswWStateNum[NP], pswWStateDenom[NP];
-
-	/* variables defined in sp_sfrm.c */
-	/* ------------------------------ */
-
-	extern int16_t pswLtpStateBase[LTP_LEN + S_LEN];
-	extern int16_t pswHState[NP];
-	extern int16_t pswHNWState[HNW_BUFF_LEN];
-
 /*_________________________________________________________________________
  |                                                                         |
  |   Automatic Variables                                                   |
@@ -381,43 +302,43 @@ void encoderReset(void)
 	/* reset all the encoder state variables */
 	/* ------------------------------------- */
 
-	swOldR0Index = 0;
-	swOldR0 = 0;
+	st->swOldR0Index = 0;
+	st->swOldR0 = 0;
 
 	for (i = 0; i < 2 * N_SUB; i++) {
-		psnsWSfrmEngSpace[i].man = 0;
-		psnsWSfrmEngSpace[i].sh = 0;
+		st->psnsWSfrmEngSpace[i].man = 0;
+		st->psnsWSfrmEngSpace[i].sh = 0;
 	}
 
 	for (i = 0; i < 4; i++)
-		pswHPFXState[i] = 0;
+		st->pswHPFXState[i] = 0;
 
 	for (i = 0; i < 8; i++)
-		pswHPFYState[i] = 0;
+		st->pswHPFYState[i] = 0;
 
 	for (i = 0; i < NP; i++) {
-		pswOldFrmKs[i] = 0;
-		pswOldFrmAs[i] = 0;
-		pswOldFrmSNWCoefs[i] = 0;
-		pswAnalysisState[i] = 0;
-		pswWStateNum[i] = 0;
-		pswWStateDenom[i] = 0;
-		pswHState[i] = 0;
+		st->pswOldFrmKs[i] = 0;
+		st->pswOldFrmAs[i] = 0;
+		st->pswOldFrmSNWCoefs[i] = 0;
+		st->pswAnalysisState[i] = 0;
+		st->pswWStateNum[i] = 0;
+		st->pswWStateDenom[i] = 0;
+		st->pswHState[i] = 0;
 	}
 
 	for (i = 0; i < (F_LEN + LMAX + CG_INT_MACS / 2); i++)
-		pswWgtSpeechSpace[i] = 0;
+		st->pswWgtSpeechSpace[i] = 0;
 
 	for (i = 0; i < INBUFFSZ; i++)
-		pswSpeech[i] = 0;
+		st->pswSpeech[i] = 0;
 
 	for (i = 0; i < (LTP_LEN + S_LEN); i++)
-		pswLtpStateBase[i] = 0;
+		st->pswLtpStateBase[i] = 0;
 
 	for (i = 0; i < HNW_BUFF_LEN; i++)
-		pswHNWState[i] = 0;
+		st->pswHNWState[i] = 0;
 
-	swPtch = 1;
+	st->swPtch = 1;
 }
 
 /***************************************************************************
@@ -429,7 +350,7 @@ void encoderReset(void)
  *      receive DTX and Comfort Noise.
  *
  *   INPUT:
- *      None
+ *      st    decoder instance state
  *
  *   OUTPUT:
  *      None
@@ -442,11 +363,11 @@ void encoderReset(void)
  *   KEYWORDS:
  **************************************************************************/
 
-void resetDec(void)
+void resetDec(struct gsmhr_dec *st)
 {
-	decoderReset();		/* reset all the state variables in
+	decoderReset(st);	/* reset all the state variables in
 				 * the speech decoder */
-	dtxResetRx();		/* reset all the receive DTX and CN
+	dtxResetRx(st);	/* reset all the receive DTX and CN
 				 * state variables */
 }
 
@@ -459,7 +380,7 @@ void resetDec(void)
  *      the transmit DTX and Comfort Noise.
  *
  *   INPUT:
- *      None
+ *      st    encoder instance state
  *
  *   OUTPUT:
  *      None
@@ -472,14 +393,14 @@ void resetDec(void)
  *   KEYWORDS:
  **************************************************************************/
 
-void resetEnc(void)
+void resetEnc(struct gsmhr_enc *st)
 {
 
-	encoderReset();		/* reset all the state variables in
+	encoderReset(st);	/* reset all the state variables in
 				 * the speech encoder */
-	vad_reset();		/* reset all the VAD state variables */
+	vad_reset(&st->vad);	/* reset all the VAD state variables */
 
-	dtxResetTx();		/* reset all the transmit DTX and CN
+	dtxResetTx(st);	/* reset all the transmit DTX and CN
 				 * state variables */
 }
 
@@ -491,7 +412,7 @@ void resetEnc(void)
  *      reset all the transmit DTX and CN state variables
  *
  *   INPUT:
- *      None
+ *      st    encoder instance state
  *
  *   OUTPUT:
  *      None
@@ -504,28 +425,9 @@ void resetEnc(void)
  *   KEYWORDS:
  **************************************************************************/
 
-void dtxResetTx(void)
+void dtxResetTx(struct gsmhr_enc *st)
 {
 
-/*_________________________________________________________________________
- |                                                                         |
- |   External declarations for encoder variables which need to be reset    |
- |_________________________________________________________________________|
-*/
-
-	/* variables defined in sp_enc.c */
-	/* ----------------------------- */
-
-	extern int16_t swTxGsHistPtr;
-
-	/* variables defined in dtx.c */
-	/* -------------------------- */
-
-	extern int16_t swVadFrmCnt;	/* Indicates the number of sequential
-					 * frames where VAD == 0 */
-	extern short int siUpdPointer;
-	extern int16_t swNElapsed;
-
 /*_________________________________________________________________________
  |                                                                         |
  |   Automatic Variables                                                   |
@@ -541,13 +443,13 @@ void dtxResetTx(void)
 	/* reset all the transmit DTX and CN state variables */
 	/* ------------------------------------------------- */
 
-	swTxGsHistPtr = 0;
+	st->swTxGsHistPtr = 0;
 
-	swVadFrmCnt = 0;
+	st->swVadFrmCnt = 0;
 
-	siUpdPointer = 0;
+	st->siUpdPointer = 0;
 
-	swNElapsed = 50;
+	st->swNElapsed = 50;
 
 }
 
@@ -559,7 +461,7 @@ void dtxResetTx(void)
  *      reset all the receive DTX and CN state variables
  *
  *   INPUT:
- *      None
+ *      st    decoder instance state
  *
  *   OUTPUT:
  *      None
@@ -572,28 +474,9 @@ void dtxResetTx(void)
  *   KEYWORDS:
  **************************************************************************/
 
-void dtxResetRx(void)
+void dtxResetRx(struct gsmhr_dec *st)
 {
 
-/*_________________________________________________________________________
- |                                                                         |
- |   External declarations for encoder variables which need to be reset    |
- |_________________________________________________________________________|
-*/
-
-	/* variables defined in sp_dec.c */
-	/* ----------------------------- */
-
-	extern int16_t swRxDTXState;
-	extern int16_t swDecoMode;
-	extern int16_t swDtxMuting;
-	extern int16_t swDtxBfiCnt;
-
-	extern int16_t swOldR0IndexDec;
-
-	extern int16_t swRxGsHistPtr;
-	extern int32_t pL_RxGsHist[(OVERHANG - 1) * N_SUB];
-
 /*_________________________________________________________________________
  |                                                                         |
  |   Automatic Variables                                                   |
@@ -611,16 +494,16 @@ void dtxResetRx(void)
 	/* reset all the receive DTX and CN state variables */
 	/* ------------------------------------------------ */
 
-	swRxDTXState = CNINTPER - 1;
-	swDecoMode = SPEECH;
-	swDtxMuting = 0;
-	swDtxBfiCnt = 0;
+	st->swRxDTXState = CNINTPER - 1;
+	st->swDecoMode = SPEECH;
+	st->swDtxMuting = 0;
+	st->swDtxBfiCnt = 0;
 
-	swOldR0IndexDec = 0;
+	st->swOldR0IndexDec = 0;
 
-	swRxGsHistPtr = 0;
+	st->swRxGsHistPtr = 0;
 
 	for (i = 0; i < (OVERHANG - 1) * N_SUB; i++)
-		pL_RxGsHist[i] = 0;
+		st->pL_RxGsHist[i] = 0;
 
 }
@@ -5,6 +5,9 @@
 
 #include "typedefs.h"
 
+struct gsmhr_enc;
+struct gsmhr_dec;
+
 #define EHF_MASK 0x0008		/* Encoder Homing Frame pattern */
 
 /*_________________________________________________________________________
@@ -15,18 +18,18 @@
 
 int decoderHomingFrameTest(int16_t pswSpeechPara[], int iLastPara);
 
-void decoderReset(void);
+void decoderReset(struct gsmhr_dec *st);
 
 int encoderHomingFrameTest(int16_t pswSpeech[]);
 
-void encoderReset(void);
+void encoderReset(struct gsmhr_enc *st);
 
-void resetDec(void);
+void resetDec(struct gsmhr_dec *st);
 
-void resetEnc(void);
+void resetEnc(struct gsmhr_enc *st);
 
-void dtxResetTx(void);
+void dtxResetTx(struct gsmhr_enc *st);
 
-void dtxResetRx(void);
+void dtxResetRx(struct gsmhr_dec *st);
 
 #endif
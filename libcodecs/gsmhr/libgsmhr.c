@@ -13,20 +13,22 @@
 #include "homing.h"
 #include "sp_dec.h"
 #include "sp_enc.h"
+#include "dtx.h"
+#include "state.h"
 
 #define EXPORT __attribute__((visibility("default")))
 
 struct gsmhr {
 	int dec_reset_flg;
+	short swTAFCnt;
+	short LastFrameType;
+	struct gsmhr_enc enc;
+	struct gsmhr_dec dec;
 };
 
 const short gsmhr_mo[12] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x100, 0x200, 0x400, 0x800 };	//or-bitmask
 const char gsmhr_ma[18] = { 5, 11, 9, 8, 1, 2, 8, 9, 5, 4, 9, 5, 4, 9, 5, 4, 9, 5 };	//bits for each short
 
-static short swTAFCnt = 1;
-
-static short LastFrameType = 0;
-
     /*___________________________________________________________________________  
 
  |                                                                           |  
@@ -232,8 +234,14 @@ EXPORT struct gsmhr *gsmhr_init(short isDTX)
 		return NULL;
 
 	state->dec_reset_flg = 1;
-	giDTXon = isDTX;
-	resetEnc();
+	state->swTAFCnt = 1;
+	state->enc.giDTXon = isDTX;
+	resetEnc(&state->enc);
+
+	/* the decoder starts from its power-up values; resetDec() is
+	 * only applied on a decoder homing frame */
+	state->dec.swRxDTXState = CNINTPER - 1;
+	state->dec.swDecoMode = SPEECH;
 	return state;
 }
 
@@ -245,8 +253,6 @@ EXPORT void gsmhr_exit(struct gsmhr *state)
 EXPORT int
 gsmhr_encode(struct gsmhr *state, unsigned char *rb, const short *pcm)
 {
-	(void)state;
-
 	int enc_reset_flg;
 	int16_t pcm_b[F_LEN];
 	int16_t hr_params[20];
@@ -260,10 +266,10 @@ gsmhr_encode(struct gsmhr *state, unsigned char *rb, const short *pcm)
 
 	enc_reset_flg = encoderHomingFrameTest(pcm_b);
 //160 short samples -> 112 bits (14 bytes) of speech parameters + SP_flag + VAD_flag
-	speechEncoder(pcm_b, hr_params);
+	speechEncoder(&state->enc, pcm_b, hr_params);
 
 	if (enc_reset_flg)
-		resetEnc();
+		resetEnc(&state->enc);
 
 	//pack 18 short to 112 bits (14 bytes)
 	memset(rb, 0, 14);
@@ -279,11 +285,11 @@ gsmhr_encode(struct gsmhr *state, unsigned char *rb, const short *pcm)
 	//returned value: 0=iddle (SID), 1=SP-tail, 2-first SID, 3=speech 
 	//params[18]-VAD, params19-SP
 	i = 2 * hr_params[18] + hr_params[19];
-	if ((i == 0) && (LastFrameType != 0)) {
+	if ((i == 0) && (state->LastFrameType != 0)) {
 		i = 2;
-		LastFrameType = 0;
+		state->LastFrameType = 0;
 	} else
-		LastFrameType = i;
+		state->LastFrameType = i;
 
 	return i;
 
@@ -331,7 +337,7 @@ gsmhr_decode(struct gsmhr *state, short *pcm, const unsigned char *rb)
 	hr_params[20] = 0;	//BCI
 
 	//detects sid frames
-	if (giDTXon) {
+	if (state->enc.giDTXon) {
 		if (rb)
 			hr_params[20] = swSidDetection(hr_params, hr_eflags);	//0-speech, 2-valid SID 
 		else
@@ -340,11 +346,11 @@ gsmhr_decode(struct gsmhr *state, short *pcm, const unsigned char *rb)
 		hr_params[20] = 0;	//while no DTX all frames are speech
 
 	//evaluate TAF flag for every 12th speech frame
-	if ((swTAFCnt == 0) && (hr_params[20] == 0))
+	if ((state->swTAFCnt == 0) && (hr_params[20] == 0))
 		hr_params[21] = 1;
 	else
 		hr_params[21] = 0;	//TAF
-	swTAFCnt = (swTAFCnt + 1) % 12;
+	state->swTAFCnt = (state->swTAFCnt + 1) % 12;
 
 	memcpy(hr_params_b, hr_params, 22 * sizeof(int16_t));
 
@@ -359,7 +365,7 @@ gsmhr_decode(struct gsmhr *state, short *pcm, const unsigned char *rb)
 		for (i = 0; i < F_LEN; i++)
 			pcm[i] = EHF_MASK;
 	} else {
-		speechDecoder(hr_params_b, pcm);
+		speechDecoder(&state->dec, hr_params_b, pcm);
 	}
 
 	if (!state->dec_reset_flg)
@@ -367,7 +373,7 @@ gsmhr_decode(struct gsmhr *state, short *pcm, const unsigned char *rb)
 		    decoderHomingFrameTest(hr_params_b, WHOLE_FRAME);
 
 	if (dec_reset_flg)
-		resetDec();
+		resetDec(&state->dec);
 
 	state->dec_reset_flg = dec_reset_flg;
 
@@ -8,42 +8,20 @@
  *     arithmetic operations.
  *
  *      The functions in this file are listed below.  Some of them are
- *      defined in terms of other basic operations.  One of the
- *      routines, saturate() is static.  This is not a basic
- *      operation, and is not referenced outside the scope of this
- *      file.
+ *      defined in terms of other basic operations.  The short ones
+ *      that sit in the inner loops of the coder, and saturate() which
+ *      they use, are inline functions in mathhalf.h.
  *
  *
- *       abs_s()
- *       add()
  *       divide_s()
- *       extract_h()
- *       extract_l()
- *       L_abs()
- *       L_add()
- *       L_deposit_h()
- *       L_deposit_l()
- *       L_mac()
- *       L_msu()
- *       L_mult()
- *       L_negate()
  *       L_shift_r()
  *       L_shl()
  *       L_shr()
- *       L_sub()
- *       mac_r()
- *       msu_r()
- *       mult()
- *       mult_r()
- *       negate()
  *       norm_l()
  *       norm_s()
- *       hr_round()
- *       saturate()
  *       shift_r()
  *       shl()
  *       shr()
- *       sub()
  *
  **************************************************************************/
 
@@ -56,154 +34,6 @@
 #include "typedefs.h"
 #include "mathhalf.h"
 
-/***************************************************************************
- *
- *   FUNCTION NAME: saturate
- *
- *   PURPOSE:
- *
- *     Limit the 32 bit input to the range of a 16 bit word.
- *
- *
- *   INPUTS:
- *
- *     L_var1
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     swOut
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range
- *                     0xffff 8000 <= swOut <= 0x0000 7fff.
- *
- *   KEYWORDS: saturation, limiting, limit, saturate, 16 bits
- *
- *************************************************************************/
-
-static int16_t saturate(int32_t L_var1)
-{
-	int16_t swOut;
-
-	if (L_var1 > SW_MAX) {
-		swOut = SW_MAX;
-	} else if (L_var1 < SW_MIN) {
-		swOut = SW_MIN;
-	} else
-		swOut = (int16_t) L_var1;	/* automatic type conversion */
-	return (swOut);
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME: abs_s
- *
- *   PURPOSE:
- *
- *     Take the absolute value of the 16 bit input.  An input of
- *     -0x8000 results in a return value of 0x7fff.
- *
- *   INPUTS:
- *
- *     var1
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     swOut
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range
- *                     0x0000 0000 <= swOut <= 0x0000 7fff.
- *
- *   IMPLEMENTATION:
- *
- *     Take the absolute value of the 16 bit input.  An input of
- *     -0x8000 results in a return value of 0x7fff.
- *
- *   KEYWORDS: absolute value, abs
- *
- *************************************************************************/
-
-int16_t abs_s(int16_t var1)
-{
-	int16_t swOut;
-
-	if (var1 == SW_MIN) {
-		swOut = SW_MAX;
-	} else {
-		if (var1 < 0)
-			swOut = -var1;
-		else
-			swOut = var1;
-	}
-	return (swOut);
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME: add
- *
- *   PURPOSE:
- *
- *     Perform the addition of the two 16 bit input variable with
- *     saturation.
- *
- *   INPUTS:
- *
- *     var1
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
- *     var2
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     swOut
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range
- *                     0xffff 8000 <= swOut <= 0x0000 7fff.
- *
- *   IMPLEMENTATION:
- *
- *     Perform the addition of the two 16 bit input variable with
- *     saturation.
- *
- *     swOut = var1 + var2
- *
- *     swOut is set to 0x7fff if the operation results in an
- *     overflow.  swOut is set to 0x8000 if the operation results
- *     in an underflow.
- *
- *   KEYWORDS: add, addition
- *
- *************************************************************************/
-
-int16_t add(int16_t var1, int16_t var2)
-{
-	int32_t L_sum;
-	int16_t swOut;
-
-	L_sum = (int32_t) var1 + var2;
-	swOut = saturate(L_sum);
-	return (swOut);
-}
-
 /***************************************************************************
  *
  *   FUNCTION NAME: divide_s
@@ -264,55 +94,13 @@ int16_t divide_s(int16_t var1, int16_t var2)
 
 /***************************************************************************
  *
- *   FUNCTION NAME: extract_h
- *
- *   PURPOSE:
- *
- *     Extract the 16 MS bits of a 32 bit int32_t.  Return the 16 bit
- *     number as a int16_t.  This is used as a "truncation" of a fractional
- *     number.
- *
- *   INPUTS:
- *
- *     L_var1
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     swOut
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range
- *                     0xffff 8000 <= swOut <= 0x0000 7fff.
- *
- *   IMPLEMENTATION:
- *
- *   KEYWORDS: assign, truncate
- *
- *************************************************************************/
-
-int16_t extract_h(int32_t L_var1)
-{
-	int16_t var2;
-
-	var2 = (int16_t) (0x0000ffffL & (L_var1 >> 16));
-	return (var2);
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME: extract_l
+ *   FUNCTION NAME: L_shift_r
  *
  *   PURPOSE:
  *
- *     Extract the 16 LS bits of a 32 bit int32_t.  Return the 16 bit
- *     number as a int16_t.  The upper portion of the input int32_t
- *     has no impact whatsoever on the output.
+ *     Shift and hr_round.  Perform a shift right. After shifting, use
+ *     the last bit shifted out of the LSB to hr_round the result up
+ *     or down.
  *
  *   INPUTS:
  *
@@ -320,46 +108,9 @@ int16_t extract_h(int32_t L_var1)
  *                     32 bit long signed integer (int32_t) whose value
  *                     falls in the range
  *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     swOut
+ *     var2
  *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range
- *                     0xffff 8000 <= swOut <= 0x0000 7fff.
- *
- *
- *   KEYWORDS: extract, assign
- *
- *************************************************************************/
-
-int16_t extract_l(int32_t L_var1)
-{
-	int16_t var2;
-
-	var2 = (int16_t) (0x0000ffffL & L_var1);
-	return (var2);
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME: L_abs
- *
- *   PURPOSE:
- *
- *     Take the absolute value of the 32 bit input.  An input of
- *     -0x8000 0000 results in a return value of 0x7fff ffff.
- *
- *   INPUTS:
- *
- *     L_var1
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
  *
  *   OUTPUTS:
  *
@@ -367,983 +118,234 @@ int16_t extract_l(int32_t L_var1)
  *
  *   RETURN VALUE:
  *
- *     L_Out
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *
- *
- *
- *   KEYWORDS: absolute value, abs
- *
- *************************************************************************/
-int32_t L_abs(int32_t L_var1)
-{
-	int32_t L_Out;
-
-	if (L_var1 == LW_MIN) {
-		L_Out = LW_MAX;
-	} else {
-		if (L_var1 < 0)
-			L_Out = -L_var1;
-		else
-			L_Out = L_var1;
-	}
-	return (L_Out);
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME: L_add
- *
- *   PURPOSE:
- *
- *     Perform the addition of the two 32 bit input variables with
- *     saturation.
- *
- *   INPUTS:
- *
  *     L_var1
  *                     32 bit long signed integer (int32_t) whose value
  *                     falls in the range
  *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *     L_var2
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var2 <= 0x7fff ffff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
  *
- *     L_Out
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
  *
  *   IMPLEMENTATION:
  *
- *     Perform the addition of the two 32 bit input variables with
- *     saturation.
- *
- *     L_Out = L_var1 + L_var2
- *
- *     L_Out is set to 0x7fff ffff if the operation results in an
- *     overflow.  L_Out is set to 0x8000 0000 if the operation
- *     results in an underflow.
- *
- *   KEYWORDS: add, addition
- *
- *************************************************************************/
-int32_t L_add(int32_t L_var1, int32_t L_var2)
-{
-
-	int32_t L_Sum, L_SumLow, L_SumHigh;
-
-	L_Sum = L_var1 + L_var2;
-
-	if ((L_var1 > 0 && L_var2 > 0) || (L_var1 < 0 && L_var2 < 0)) {
-
-		/* an overflow is possible */
-
-		L_SumLow = (L_var1 & 0xffff) + (L_var2 & 0xffff);
-		L_SumHigh =
-		    ((L_var1 >> 16) & 0xffff) + ((L_var2 >> 16) & 0xffff);
-		if (L_SumLow & 0x10000) {
-			/* carry into high word is set */
-			L_SumHigh += 1;
-		}
-
-		/* update sum only if there is an overflow or underflow */
-    /*------------------------------------------------------*/
-
-		if ((0x10000 & L_SumHigh) && !(0x8000 & L_SumHigh))
-			L_Sum = LW_MIN;	/* underflow */
-		else if (!(0x10000 & L_SumHigh) && (0x8000 & L_SumHigh))
-			L_Sum = LW_MAX;	/* overflow */
-	}
-
-	return (L_Sum);
-
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME: L_deposit_h
- *
- *   PURPOSE:
+ *     Shift and hr_round.  Perform a shift right. After shifting, use
+ *     the last bit shifted out of the LSB to hr_round the result up
+ *     or down.  This is just like shift_r above except that the
+ *     input/output is 32 bits as opposed to 16.
  *
- *     Put the 16 bit input into the 16 MSB's of the output int32_t.  The
- *     LS 16 bits are zeroed.
+ *     if var2 is positve perform a arithmetic left shift
+ *     with saturation (see L_shl() above).
  *
- *   INPUTS:
+ *     If var2 is zero simply return L_var1.
  *
- *     var1
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     L_Out
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff 0000.
- *
- *
- *   KEYWORDS: deposit, assign, fractional assign
- *
- *************************************************************************/
-
-int32_t L_deposit_h(int16_t var1)
-{
-	int32_t L_var2;
-
-	L_var2 = (int32_t) var1 << 16;
-	return (L_var2);
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME: L_deposit_l
- *
- *   PURPOSE:
- *
- *     Put the 16 bit input into the 16 LSB's of the output int32_t with
- *     sign extension i.e. the top 16 bits are set to either 0 or 0xffff.
- *
- *   INPUTS:
- *
- *     var1
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     L_Out
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0xffff 8000 <= L_var1 <= 0x0000 7fff.
- *
- *   KEYWORDS: deposit, assign
- *
- *************************************************************************/
-
-int32_t L_deposit_l(int16_t var1)
-{
-	int32_t L_Out;
-
-	L_Out = var1;
-	return (L_Out);
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME: L_mac
- *
- *   PURPOSE:
- *
- *     Multiply accumulate.  Fractionally multiply two 16 bit
- *     numbers together with saturation.  Add that result to the
- *     32 bit input with saturation.  Return the 32 bit result.
- *
- *   INPUTS:
- *
- *     var1
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
- *     var2
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
- *     L_var3
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var2 <= 0x7fff ffff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     L_Out
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *
- *   IMPLEMENTATION:
- *
- *     Fractionally multiply two 16 bit numbers together with
- *     saturation.  The only numbers which will cause saturation on
- *     the multiply are 0x8000 * 0x8000.
- *
- *     Add that result to the 32 bit input with saturation.
- *     Return the 32 bit result.
- *
- *     Please note that this is not a true multiply accumulate as
- *     most processors would implement it.  The 0x8000*0x8000
- *     causes and overflow for this instruction.  On most
- *     processors this would cause an overflow only if the 32 bit
- *     input added to it were positive or zero.
- *
- *   KEYWORDS: mac, multiply accumulate
- *
- *************************************************************************/
-
-int32_t L_mac(int32_t L_var3, int16_t var1, int16_t var2)
-{
-	return (L_add(L_var3, L_mult(var1, var2)));
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME: L_msu
- *
- *   PURPOSE:
- *
- *     Multiply and subtract.  Fractionally multiply two 16 bit
- *     numbers together with saturation.  Subtract that result from
- *     the 32 bit input with saturation.  Return the 32 bit result.
- *
- *   INPUTS:
- *
- *     var1
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
- *     var2
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
- *     L_var3
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var2 <= 0x7fff ffff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     L_Out
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *
- *   IMPLEMENTATION:
- *
- *     Fractionally multiply two 16 bit numbers together with
- *     saturation.  The only numbers which will cause saturation on
- *     the multiply are 0x8000 * 0x8000.
- *
- *     Subtract that result from the 32 bit input with saturation.
- *     Return the 32 bit result.
- *
- *     Please note that this is not a true multiply accumulate as
- *     most processors would implement it.  The 0x8000*0x8000
- *     causes and overflow for this instruction.  On most
- *     processors this would cause an overflow only if the 32 bit
- *     input added to it were negative or zero.
- *
- *   KEYWORDS: mac, multiply accumulate, msu
- *
- *************************************************************************/
-
-int32_t L_msu(int32_t L_var3, int16_t var1, int16_t var2)
-{
-	return (L_sub(L_var3, L_mult(var1, var2)));
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME: L_mult
- *
- *   PURPOSE:
- *
- *     Perform a fractional multipy of the two 16 bit input numbers
- *     with saturation.  Output a 32 bit number.
- *
- *   INPUTS:
- *
- *     var1
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
- *     var2
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     L_Out
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *
- *   IMPLEMENTATION:
- *
- *     Multiply the two the two 16 bit input numbers. If the
- *     result is within this range, left shift the result by one
- *     and output the 32 bit number.  The only possible overflow
- *     occurs when var1==var2==-0x8000.  In this case output
- *     0x7fff ffff.
- *
- *   KEYWORDS: multiply, mult, mpy
- *
- *************************************************************************/
-
-int32_t L_mult(int16_t var1, int16_t var2)
-{
-	int32_t L_product;
-
-	if (var1 == SW_MIN && var2 == SW_MIN)
-		L_product = LW_MAX;	/* overflow */
-	else {
-		L_product = (int32_t) var1 *var2;	/* integer multiply */
-
-		L_product = L_product << 1;
-	}
-	return (L_product);
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME: L_negate
- *
- *   PURPOSE:
- *
- *     Negate the 32 bit input. 0x8000 0000's negated value is
- *     0x7fff ffff.
- *
- *   INPUTS:
- *
- *     L_var1
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     L_Out
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0001 <= L_var1 <= 0x7fff ffff.
- *
- *   KEYWORDS: negate, negative
- *
- *************************************************************************/
-
-int32_t L_negate(int32_t L_var1)
-{
-	int32_t L_Out;
-
-	if (L_var1 == LW_MIN)
-		L_Out = LW_MAX;
-	else
-		L_Out = -L_var1;
-	return (L_Out);
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME: L_shift_r
- *
- *   PURPOSE:
- *
- *     Shift and hr_round.  Perform a shift right. After shifting, use
- *     the last bit shifted out of the LSB to hr_round the result up
- *     or down.
- *
- *   INPUTS:
- *
- *     L_var1
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *     var2
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     L_var1
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *
- *
- *   IMPLEMENTATION:
- *
- *     Shift and hr_round.  Perform a shift right. After shifting, use
- *     the last bit shifted out of the LSB to hr_round the result up
- *     or down.  This is just like shift_r above except that the
- *     input/output is 32 bits as opposed to 16.
- *
- *     if var2 is positve perform a arithmetic left shift
- *     with saturation (see L_shl() above).
- *
- *     If var2 is zero simply return L_var1.
- *
- *     If var2 is negative perform a arithmetic right shift (L_shr)
- *     of L_var1 by (-var2)+1.  Add the LS bit of the result to
- *     L_var1 shifted right (L_shr) by -var2.
+ *     If var2 is negative perform a arithmetic right shift (L_shr)
+ *     of L_var1 by (-var2)+1.  Add the LS bit of the result to
+ *     L_var1 shifted right (L_shr) by -var2.
  *
  *     Note that there is no constraint on var2, so if var2 is
- *     -0xffff 8000 then -var2 is 0x0000 8000, not 0x0000 7fff.
- *     This is the reason the L_shl function is used.
- *
- *
- *   KEYWORDS:
- *
- *************************************************************************/
-
-int32_t L_shift_r(int32_t L_var1, int16_t var2)
-{
-	int32_t L_Out, L_rnd;
-
-	if (var2 < -31) {
-		L_Out = 0;
-	} else if (var2 < 0) {
-		/* right shift */
-		L_rnd = L_shl(L_var1, var2 + 1) & 0x1;
-		L_Out = L_add(L_shl(L_var1, var2), L_rnd);
-	} else
-		L_Out = L_shl(L_var1, var2);
-
-	return (L_Out);
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME: L_shl
- *
- *   PURPOSE:
- *
- *     Arithmetic shift left (or right).
- *     Arithmetically shift the input left by var2.   If var2 is
- *     negative then an arithmetic shift right (L_shr) of L_var1 by
- *     -var2 is performed.
- *
- *   INPUTS:
- *
- *     var2
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
- *     L_var1
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     L_Out
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *
- *
- *   IMPLEMENTATION:
- *
- *     Arithmetically shift the 32 bit input left by var2.  This
- *     operation maintains the sign of the input number. If var2 is
- *     negative then an arithmetic shift right (L_shr) of L_var1 by
- *     -var2 is performed.  See description of L_shr for details.
- *
- *     Equivalent to the Full-Rate GSM ">> n" operation.  Note that
- *     ANSI-C does not guarantee operation of the C ">>" or "<<"
- *     operator for negative numbers.
- *
- *   KEYWORDS: shift, arithmetic shift left,
- *
- *************************************************************************/
-
-int32_t L_shl(int32_t L_var1, int16_t var2)
-{
-
-	int32_t L_Mask, L_Out;
-	int i, iOverflow = 0;
-
-	if (var2 == 0 || L_var1 == 0) {
-		L_Out = L_var1;
-	} else if (var2 < 0) {
-		if (var2 <= -31) {
-			if (L_var1 > 0)
-				L_Out = 0;
-			else
-				L_Out = -1;
-		} else
-			L_Out = L_shr(L_var1, -var2);
-	} else {
-
-		if (var2 >= 31)
-			iOverflow = 1;
-
-		else {
-
-			if (L_var1 < 0)
-				L_Mask = LW_SIGN;	/* sign bit mask */
-			else
-				L_Mask = 0x0;
-			L_Out = L_var1;
-			for (i = 0; i < var2 && !iOverflow; i++) {
-				/* check the sign bit */
-				L_Out = (L_Out & 0x7fffffffL) << 1;
-				if ((L_Mask ^ L_Out) & LW_SIGN)
-					iOverflow = 1;
-			}
-		}
-
-		if (iOverflow) {
-			/* saturate */
-			if (L_var1 > 0)
-				L_Out = LW_MAX;
-			else
-				L_Out = LW_MIN;
-		}
-	}
-
-	return (L_Out);
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME: L_shr
- *
- *   PURPOSE:
- *
- *     Arithmetic shift right (or left).
- *     Arithmetically shift the input right by var2.   If var2 is
- *     negative then an arithmetic shift left (shl) of var1 by
- *     -var2 is performed.
- *
- *   INPUTS:
- *
- *     var2
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
- *     L_var1
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     L_Out
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *
- *
- *   IMPLEMENTATION:
- *
- *     Arithmetically shift the input right by var2.  This
- *     operation maintains the sign of the input number. If var2 is
- *     negative then an arithmetic shift left (shl) of L_var1 by
- *     -var2 is performed.  See description of L_shl for details.
- *
- *     The input is a 32 bit number, as is the output.
- *
- *     Equivalent to the Full-Rate GSM ">> n" operation.  Note that
- *     ANSI-C does not guarantee operation of the C ">>" or "<<"
- *     operator for negative numbers.
- *
- *   KEYWORDS: shift, arithmetic shift right,
- *
- *************************************************************************/
-
-int32_t L_shr(int32_t L_var1, int16_t var2)
-{
-
-	int32_t L_Mask, L_Out;
-
-	if (var2 == 0 || L_var1 == 0) {
-		L_Out = L_var1;
-	} else if (var2 < 0) {
-		/* perform a left shift */
-    /*----------------------*/
-		if (var2 <= -31) {
-			/* saturate */
-			if (L_var1 > 0)
-				L_Out = LW_MAX;
-			else
-				L_Out = LW_MIN;
-		} else
-			L_Out = L_shl(L_var1, -var2);
-	} else {
-
-		if (var2 >= 31) {
-			if (L_var1 > 0)
-				L_Out = 0;
-			else
-				L_Out = -1;
-		} else {
-			L_Mask = 0;
-
-			if (L_var1 < 0) {
-				L_Mask = ~L_Mask << (32 - var2);
-			}
-
-			L_var1 >>= var2;
-			L_Out = L_Mask | L_var1;
-		}
-	}
-	return (L_Out);
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME: L_sub
- *
- *   PURPOSE:
- *
- *     Perform the subtraction of the two 32 bit input variables with
- *     saturation.
- *
- *   INPUTS:
- *
- *     L_var1
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *     L_var2
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var2 <= 0x7fff ffff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     L_Out
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *
- *   IMPLEMENTATION:
- *
- *     Perform the subtraction of the two 32 bit input variables with
- *     saturation.
- *
- *     L_Out = L_var1 - L_var2
- *
- *     L_Out is set to 0x7fff ffff if the operation results in an
- *     overflow.  L_Out is set to 0x8000 0000 if the operation
- *     results in an underflow.
- *
- *   KEYWORDS: sub, subtraction
- *
- *************************************************************************/
-int32_t L_sub(int32_t L_var1, int32_t L_var2)
-{
-	int32_t L_Sum;
-
-	/* check for overflow */
-	if ((L_var1 > 0 && L_var2 < 0) || (L_var1 < 0 && L_var2 > 0)) {
-		if (L_var2 == LW_MIN) {
-			L_Sum = L_add(L_var1, LW_MAX);
-			L_Sum = L_add(L_Sum, 1);
-		} else
-			L_Sum = L_add(L_var1, -L_var2);
-	} else {		/* no overflow possible */
-		L_Sum = L_var1 - L_var2;
-	}
-	return (L_Sum);
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME:mac_r
- *
- *   PURPOSE:
- *
- *     Multiply accumulate and hr_round.  Fractionally multiply two 16
- *     bit numbers together with saturation.  Add that result to
- *     the 32 bit input with saturation.  Finally hr_round the result
- *     into a 16 bit number.
- *
- *
- *   INPUTS:
- *
- *     var1
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
- *     var2
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
- *     L_var3
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var2 <= 0x7fff ffff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     swOut
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range
- *                     0xffff 8000 <= swOut <= 0x0000 7fff.
- *
- *   IMPLEMENTATION:
- *
- *     Fractionally multiply two 16 bit numbers together with
- *     saturation.  The only numbers which will cause saturation on
- *     the multiply are 0x8000 * 0x8000.
- *
- *     Add that result to the 32 bit input with saturation.
- *     Round the 32 bit result by adding 0x0000 8000 to the input.
- *     The result may overflow due to the add.  If so, the result
- *     is saturated.  The 32 bit hr_rounded number is then shifted
- *     down 16 bits and returned as a int16_t.
- *
- *     Please note that this is not a true multiply accumulate as
- *     most processors would implement it.  The 0x8000*0x8000
- *     causes and overflow for this instruction.  On most
- *     processors this would cause an overflow only if the 32 bit
- *     input added to it were positive or zero.
- *
- *   KEYWORDS: mac, multiply accumulate, macr
- *
- *************************************************************************/
-
-int16_t mac_r(int32_t L_var3, int16_t var1, int16_t var2)
-{
-	return (hr_round(L_add(L_var3, L_mult(var1, var2))));
-}
-
-/***************************************************************************
- *
- *   FUNCTION NAME:  msu_r
- *
- *   PURPOSE:
- *
- *     Multiply subtract and hr_round.  Fractionally multiply two 16
- *     bit numbers together with saturation.  Subtract that result from
- *     the 32 bit input with saturation.  Finally hr_round the result
- *     into a 16 bit number.
- *
- *
- *   INPUTS:
- *
- *     var1
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
- *     var2
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
- *     L_var3
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var2 <= 0x7fff ffff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     swOut
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range
- *                     0xffff 8000 <= swOut <= 0x0000 7fff.
- *
- *   IMPLEMENTATION:
- *
- *     Fractionally multiply two 16 bit numbers together with
- *     saturation.  The only numbers which will cause saturation on
- *     the multiply are 0x8000 * 0x8000.
- *
- *     Subtract that result from the 32 bit input with saturation.
- *     Round the 32 bit result by adding 0x0000 8000 to the input.
- *     The result may overflow due to the add.  If so, the result
- *     is saturated.  The 32 bit hr_rounded number is then shifted
- *     down 16 bits and returned as a int16_t.
+ *     -0xffff 8000 then -var2 is 0x0000 8000, not 0x0000 7fff.
+ *     This is the reason the L_shl function is used.
  *
- *     Please note that this is not a true multiply accumulate as
- *     most processors would implement it.  The 0x8000*0x8000
- *     causes and overflow for this instruction.  On most
- *     processors this would cause an overflow only if the 32 bit
- *     input added to it were positive or zero.
  *
- *   KEYWORDS: mac, multiply accumulate, macr
+ *   KEYWORDS:
  *
  *************************************************************************/
 
-int16_t msu_r(int32_t L_var3, int16_t var1, int16_t var2)
+int32_t L_shift_r(int32_t L_var1, int16_t var2)
 {
-	return (hr_round(L_sub(L_var3, L_mult(var1, var2))));
+	int32_t L_Out, L_rnd;
+
+	if (var2 < -31) {
+		L_Out = 0;
+	} else if (var2 < 0) {
+		/* right shift */
+		L_rnd = L_shl(L_var1, var2 + 1) & 0x1;
+		L_Out = L_add(L_shl(L_var1, var2), L_rnd);
+	} else
+		L_Out = L_shl(L_var1, var2);
+
+	return (L_Out);
 }
 
 /***************************************************************************
  *
- *   FUNCTION NAME: mult
+ *   FUNCTION NAME: L_shl
  *
  *   PURPOSE:
  *
- *     Perform a fractional multipy of the two 16 bit input numbers
- *     with saturation and truncation.
+ *     Arithmetic shift left (or right).
+ *     Arithmetically shift the input left by var2.   If var2 is
+ *     negative then an arithmetic shift right (L_shr) of L_var1 by
+ *     -var2 is performed.
  *
  *   INPUTS:
  *
- *     var1
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
  *     var2
  *                     16 bit short signed integer (int16_t) whose value
  *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
- *
+ *     L_var1
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
  *   OUTPUTS:
  *
  *     none
  *
  *   RETURN VALUE:
  *
- *     swOut
- *                     16 bit short signed integer (int16_t) whose value
+ *     L_Out
+ *                     32 bit long signed integer (int32_t) whose value
  *                     falls in the range
- *                     0xffff 8000 <= swOut <= 0x0000 7fff.
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *
  *
  *   IMPLEMENTATION:
  *
- *     Perform a fractional multipy of the two 16 bit input
- *     numbers.  If var1 == var2 == -0x8000, output 0x7fff.
- *     Otherwise output var1*var2 >> 15.  The output is a
- *     16 bit number.
+ *     Arithmetically shift the 32 bit input left by var2.  This
+ *     operation maintains the sign of the input number. If var2 is
+ *     negative then an arithmetic shift right (L_shr) of L_var1 by
+ *     -var2 is performed.  See description of L_shr for details.
+ *
+ *     Equivalent to the Full-Rate GSM ">> n" operation.  Note that
+ *     ANSI-C does not guarantee operation of the C ">>" or "<<"
+ *     operator for negative numbers.
  *
- *   KEYWORDS: mult, mulitply, mpy
+ *   KEYWORDS: shift, arithmetic shift left,
  *
  *************************************************************************/
 
-int16_t mult(int16_t var1, int16_t var2)
+int32_t L_shl(int32_t L_var1, int16_t var2)
 {
-	int32_t L_product;
-	int16_t swOut;
 
-	L_product = L_mult(var1, var2);
-	swOut = extract_h(L_product);
-	return (swOut);
+	int32_t L_Mask, L_Out;
+	int i, iOverflow = 0;
+
+	if (var2 == 0 || L_var1 == 0) {
+		L_Out = L_var1;
+	} else if (var2 < 0) {
+		if (var2 <= -31) {
+			if (L_var1 > 0)
+				L_Out = 0;
+			else
+				L_Out = -1;
+		} else
+			L_Out = L_shr(L_var1, -var2);
+	} else {
+
+		if (var2 >= 31)
+			iOverflow = 1;
+
+		else {
+
+			if (L_var1 < 0)
+				L_Mask = LW_SIGN;	/* sign bit mask */
+			else
+				L_Mask = 0x0;
+			L_Out = L_var1;
+			for (i = 0; i < var2 && !iOverflow; i++) {
+				/* check the sign bit */
+				L_Out = (L_Out & 0x7fffffffL) << 1;
+				if ((L_Mask ^ L_Out) & LW_SIGN)
+					iOverflow = 1;
+			}
+		}
+
+		if (iOverflow) {
+			/* saturate */
+			if (L_var1 > 0)
+				L_Out = LW_MAX;
+			else
+				L_Out = LW_MIN;
+		}
+	}
+
+	return (L_Out);
 }
 
 /***************************************************************************
  *
- *   FUNCTION NAME: mult_r
+ *   FUNCTION NAME: L_shr
  *
  *   PURPOSE:
  *
- *     Perform a fractional multipy and hr_round of the two 16 bit
- *     input numbers with saturation.
+ *     Arithmetic shift right (or left).
+ *     Arithmetically shift the input right by var2.   If var2 is
+ *     negative then an arithmetic shift left (shl) of var1 by
+ *     -var2 is performed.
  *
  *   INPUTS:
  *
- *     var1
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
  *     var2
  *                     16 bit short signed integer (int16_t) whose value
  *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
- *
+ *     L_var1
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
  *   OUTPUTS:
  *
  *     none
  *
  *   RETURN VALUE:
  *
- *     swOut
- *                     16 bit short signed integer (int16_t) whose value
+ *     L_Out
+ *                     32 bit long signed integer (int32_t) whose value
  *                     falls in the range
- *                     0xffff 8000 <= swOut <= 0x0000 7fff.
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *
  *
  *   IMPLEMENTATION:
  *
- *     This routine is defined as the concatenation of the multiply
- *     operation and the hr_round operation.
+ *     Arithmetically shift the input right by var2.  This
+ *     operation maintains the sign of the input number. If var2 is
+ *     negative then an arithmetic shift left (shl) of L_var1 by
+ *     -var2 is performed.  See description of L_shl for details.
  *
- *     The fractional multiply (L_mult) produces a saturated 32 bit
- *     output.  This is followed by a an add of 0x0000 8000 to the
- *     32 bit result.  The result may overflow due to the add.  If
- *     so, the result is saturated.  The 32 bit hr_rounded number is
- *     then shifted down 16 bits and returned as a int16_t.
+ *     The input is a 32 bit number, as is the output.
  *
+ *     Equivalent to the Full-Rate GSM ">> n" operation.  Note that
+ *     ANSI-C does not guarantee operation of the C ">>" or "<<"
+ *     operator for negative numbers.
  *
- *   KEYWORDS: multiply and hr_round, hr_round, mult_r, mpyr
+ *   KEYWORDS: shift, arithmetic shift right,
  *
  *************************************************************************/
 
-int16_t mult_r(int16_t var1, int16_t var2)
+int32_t L_shr(int32_t L_var1, int16_t var2)
 {
-	int16_t swOut;
 
-	swOut = hr_round(L_mult(var1, var2));
-	return (swOut);
-}
+	int32_t L_Mask, L_Out;
 
-/***************************************************************************
- *
- *   FUNCTION NAME: negate
- *
- *   PURPOSE:
- *
- *     Negate the 16 bit input. 0x8000's negated value is 0x7fff.
- *
- *   INPUTS:
- *
- *     var1
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     swOut
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range
- *                     0xffff 8001 <= swOut <= 0x0000 7fff.
- *
- *   KEYWORDS: negate, negative, invert
- *
- *************************************************************************/
+	if (var2 == 0 || L_var1 == 0) {
+		L_Out = L_var1;
+	} else if (var2 < 0) {
+		/* perform a left shift */
+    /*----------------------*/
+		if (var2 <= -31) {
+			/* saturate */
+			if (L_var1 > 0)
+				L_Out = LW_MAX;
+			else
+				L_Out = LW_MIN;
+		} else
+			L_Out = L_shl(L_var1, -var2);
+	} else {
 
-int16_t negate(int16_t var1)
-{
-	int16_t swOut;
+		if (var2 >= 31) {
+			if (L_var1 > 0)
+				L_Out = 0;
+			else
+				L_Out = -1;
+		} else {
+			L_Mask = 0;
 
-	if (var1 == SW_MIN)
-		swOut = SW_MAX;
-	else
-		swOut = -var1;
-	return (swOut);
+			if (L_var1 < 0) {
+				L_Mask = ~L_Mask << (32 - var2);
+			}
+
+			L_var1 >>= var2;
+			L_Out = L_Mask | L_var1;
+		}
+	}
+	return (L_Out);
 }
 
 /***************************************************************************
@@ -1501,54 +503,6 @@ int16_t norm_s(int16_t var1)
 	return (swShiftCnt);
 }
 
-/***************************************************************************
- *
- *   FUNCTION NAME: hr_round
- *
- *   PURPOSE:
- *
- *     Round the 32 bit int32_t into a 16 bit shortword with saturation.
- *
- *   INPUTS:
- *
- *     L_var1
- *                     32 bit long signed integer (int32_t) whose value
- *                     falls in the range
- *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     swOut
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range
- *                     0xffff 8000 <= swOut <= 0x0000 7fff.
- *
- *   IMPLEMENTATION:
- *
- *     Perform a two's complement hr_round on the input int32_t with
- *     saturation.
- *
- *     This is equivalent to adding 0x0000 8000 to the input.  The
- *     result may overflow due to the add.  If so, the result is
- *     saturated.  The 32 bit hr_rounded number is then shifted down
- *     16 bits and returned as a int16_t.
- *
- *
- *   KEYWORDS: hr_round
- *
- *************************************************************************/
-
-int16_t hr_round(int32_t L_var1)
-{
-	int32_t L_Prod;
-
-	L_Prod = L_add(L_var1, 0x00008000L);	/* hr_round MSP */
-	return (extract_h(L_Prod));
-}
-
 /***************************************************************************
  *
  *   FUNCTION NAME: shift_r
@@ -1819,56 +773,3 @@ int16_t shr(int16_t var1, int16_t var2)
 	return (swOut);
 }
 
-/***************************************************************************
- *
- *   FUNCTION NAME: sub
- *
- *   PURPOSE:
- *
- *     Perform the subtraction of the two 16 bit input variable with
- *     saturation.
- *
- *   INPUTS:
- *
- *     var1
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
- *     var2
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
- *
- *   OUTPUTS:
- *
- *     none
- *
- *   RETURN VALUE:
- *
- *     swOut
- *                     16 bit short signed integer (int16_t) whose value
- *                     falls in the range
- *                     0xffff 8000 <= swOut <= 0x0000 7fff.
- *
- *   IMPLEMENTATION:
- *
- *     Perform the subtraction of the two 16 bit input variable with
- *     saturation.
- *
- *     swOut = var1 - var2
- *
- *     swOut is set to 0x7fff if the operation results in an
- *     overflow.  swOut is set to 0x8000 if the operation results
- *     in an underflow.
- *
- *   KEYWORDS: sub, subtraction
- *
- *************************************************************************/
-int16_t sub(int16_t var1, int16_t var2)
-{
-	int32_t L_diff;
-	int16_t swOut;
-
-	L_diff = (int32_t) var1 - var2;
-	swOut = saturate(L_diff);
-
-	return (swOut);
-}
@@ -11,21 +11,6 @@
  |_________________________________________________________________________|
 */
 
-/* addition */
-/************/
-
-int16_t add(int16_t var1, int16_t var2);	/* 1 ops */
-int16_t sub(int16_t var1, int16_t var2);	/* 1 ops */
-int32_t L_add(int32_t L_var1, int32_t L_var2);	/* 2 ops */
-int32_t L_sub(int32_t L_var1, int32_t L_var2);	/* 2 ops */
-
-/* multiplication */
-/******************/
-
-int16_t mult(int16_t var1, int16_t var2);	/* 1 ops */
-int32_t L_mult(int16_t var1, int16_t var2);	/* 1 ops */
-int16_t mult_r(int16_t var1, int16_t var2);	/* 2 ops */
-
 /* arithmetic shifts */
 /*********************/
 
@@ -36,39 +21,6 @@ int32_t L_shl(int32_t L_var1, int16_t var2);	/* 2 ops */
 int16_t shift_r(int16_t var, int16_t var2);	/* 2 ops */
 int32_t L_shift_r(int32_t L_var, int16_t var2);	/* 3 ops */
 
-/* absolute value  */
-/*******************/
-
-int16_t abs_s(int16_t var1);	/* 1 ops */
-int32_t L_abs(int32_t var1);	/* 3 ops */
-
-/* multiply accumulate  */
-/************************/
-
-int32_t L_mac(int32_t L_var3, int16_t var1, int16_t var2);	/* 1 op */
-int16_t mac_r(int32_t L_var3, int16_t var1, int16_t var2);	/* 2 op */
-int32_t L_msu(int32_t L_var3, int16_t var1, int16_t var2);	/* 1 op */
-int16_t msu_r(int32_t L_var3, int16_t var1, int16_t var2);	/* 2 op */
-
-/* negation  */
-/*************/
-
-int16_t negate(int16_t var1);	/* 1 ops */
-int32_t L_negate(int32_t L_var1);	/* 2 ops */
-
-/* Accumulator manipulation */
-/****************************/
-
-int32_t L_deposit_l(int16_t var1);	/* 1 ops */
-int32_t L_deposit_h(int16_t var1);	/* 1 ops */
-int16_t extract_l(int32_t L_var1);	/* 1 ops */
-int16_t extract_h(int32_t L_var1);	/* 1 ops */
-
-/* Round */
-/*********/
-
-int16_t hr_round(int32_t L_var1);	/* 1 ops */
-
 /* Normalization */
 /*****************/
 
@@ -87,4 +39,1070 @@ int32_t L_sat(int32_t L_var1);	/* 4 ops */
 int32_t L_macNs(int32_t L_var3, int16_t var1, int16_t var2);	/* 1 ops */
 int32_t L_msuNs(int32_t L_var3, int16_t var1, int16_t var2);	/* 1 ops */
 
+/*_________________________________________________________________________
+ |                                                                         |
+ |                        Inline Basic Operations                          |
+ |_________________________________________________________________________|
+*/
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: saturate
+ *
+ *   PURPOSE:
+ *
+ *     Limit the 32 bit input to the range of a 16 bit word.
+ *
+ *
+ *   INPUTS:
+ *
+ *     L_var1
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     swOut
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range
+ *                     0xffff 8000 <= swOut <= 0x0000 7fff.
+ *
+ *   KEYWORDS: saturation, limiting, limit, saturate, 16 bits
+ *
+ *************************************************************************/
+
+static inline int16_t saturate(int32_t L_var1)
+{
+	int16_t swOut;
+
+	if (L_var1 > SW_MAX) {
+		swOut = SW_MAX;
+	} else if (L_var1 < SW_MIN) {
+		swOut = SW_MIN;
+	} else
+		swOut = (int16_t) L_var1;	/* automatic type conversion */
+	return (swOut);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: add
+ *
+ *   PURPOSE:
+ *
+ *     Perform the addition of the two 16 bit input variable with
+ *     saturation.
+ *
+ *   INPUTS:
+ *
+ *     var1
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
+ *     var2
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     swOut
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range
+ *                     0xffff 8000 <= swOut <= 0x0000 7fff.
+ *
+ *   IMPLEMENTATION:
+ *
+ *     Perform the addition of the two 16 bit input variable with
+ *     saturation.
+ *
+ *     swOut = var1 + var2
+ *
+ *     swOut is set to 0x7fff if the operation results in an
+ *     overflow.  swOut is set to 0x8000 if the operation results
+ *     in an underflow.
+ *
+ *   KEYWORDS: add, addition
+ *
+ *************************************************************************/
+
+static inline int16_t add(int16_t var1, int16_t var2)
+{
+	int32_t L_sum;
+	int16_t swOut;
+
+	L_sum = (int32_t) var1 + var2;
+	swOut = saturate(L_sum);
+	return (swOut);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: sub
+ *
+ *   PURPOSE:
+ *
+ *     Perform the subtraction of the two 16 bit input variable with
+ *     saturation.
+ *
+ *   INPUTS:
+ *
+ *     var1
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
+ *     var2
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     swOut
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range
+ *                     0xffff 8000 <= swOut <= 0x0000 7fff.
+ *
+ *   IMPLEMENTATION:
+ *
+ *     Perform the subtraction of the two 16 bit input variable with
+ *     saturation.
+ *
+ *     swOut = var1 - var2
+ *
+ *     swOut is set to 0x7fff if the operation results in an
+ *     overflow.  swOut is set to 0x8000 if the operation results
+ *     in an underflow.
+ *
+ *   KEYWORDS: sub, subtraction
+ *
+ *************************************************************************/
+static inline int16_t sub(int16_t var1, int16_t var2)
+{
+	int32_t L_diff;
+	int16_t swOut;
+
+	L_diff = (int32_t) var1 - var2;
+	swOut = saturate(L_diff);
+
+	return (swOut);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: abs_s
+ *
+ *   PURPOSE:
+ *
+ *     Take the absolute value of the 16 bit input.  An input of
+ *     -0x8000 results in a return value of 0x7fff.
+ *
+ *   INPUTS:
+ *
+ *     var1
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     swOut
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range
+ *                     0x0000 0000 <= swOut <= 0x0000 7fff.
+ *
+ *   IMPLEMENTATION:
+ *
+ *     Take the absolute value of the 16 bit input.  An input of
+ *     -0x8000 results in a return value of 0x7fff.
+ *
+ *   KEYWORDS: absolute value, abs
+ *
+ *************************************************************************/
+
+static inline int16_t abs_s(int16_t var1)
+{
+	int16_t swOut;
+
+	if (var1 == SW_MIN) {
+		swOut = SW_MAX;
+	} else {
+		if (var1 < 0)
+			swOut = -var1;
+		else
+			swOut = var1;
+	}
+	return (swOut);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: negate
+ *
+ *   PURPOSE:
+ *
+ *     Negate the 16 bit input. 0x8000's negated value is 0x7fff.
+ *
+ *   INPUTS:
+ *
+ *     var1
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     swOut
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range
+ *                     0xffff 8001 <= swOut <= 0x0000 7fff.
+ *
+ *   KEYWORDS: negate, negative, invert
+ *
+ *************************************************************************/
+
+static inline int16_t negate(int16_t var1)
+{
+	int16_t swOut;
+
+	if (var1 == SW_MIN)
+		swOut = SW_MAX;
+	else
+		swOut = -var1;
+	return (swOut);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: extract_h
+ *
+ *   PURPOSE:
+ *
+ *     Extract the 16 MS bits of a 32 bit int32_t.  Return the 16 bit
+ *     number as a int16_t.  This is used as a "truncation" of a fractional
+ *     number.
+ *
+ *   INPUTS:
+ *
+ *     L_var1
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     swOut
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range
+ *                     0xffff 8000 <= swOut <= 0x0000 7fff.
+ *
+ *   IMPLEMENTATION:
+ *
+ *   KEYWORDS: assign, truncate
+ *
+ *************************************************************************/
+
+static inline int16_t extract_h(int32_t L_var1)
+{
+	int16_t var2;
+
+	var2 = (int16_t) (0x0000ffffL & (L_var1 >> 16));
+	return (var2);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: extract_l
+ *
+ *   PURPOSE:
+ *
+ *     Extract the 16 LS bits of a 32 bit int32_t.  Return the 16 bit
+ *     number as a int16_t.  The upper portion of the input int32_t
+ *     has no impact whatsoever on the output.
+ *
+ *   INPUTS:
+ *
+ *     L_var1
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     swOut
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range
+ *                     0xffff 8000 <= swOut <= 0x0000 7fff.
+ *
+ *
+ *   KEYWORDS: extract, assign
+ *
+ *************************************************************************/
+
+static inline int16_t extract_l(int32_t L_var1)
+{
+	int16_t var2;
+
+	var2 = (int16_t) (0x0000ffffL & L_var1);
+	return (var2);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: L_deposit_h
+ *
+ *   PURPOSE:
+ *
+ *     Put the 16 bit input into the 16 MSB's of the output int32_t.  The
+ *     LS 16 bits are zeroed.
+ *
+ *   INPUTS:
+ *
+ *     var1
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     L_Out
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff 0000.
+ *
+ *
+ *   KEYWORDS: deposit, assign, fractional assign
+ *
+ *************************************************************************/
+
+static inline int32_t L_deposit_h(int16_t var1)
+{
+	int32_t L_var2;
+
+	L_var2 = (int32_t) var1 << 16;
+	return (L_var2);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: L_deposit_l
+ *
+ *   PURPOSE:
+ *
+ *     Put the 16 bit input into the 16 LSB's of the output int32_t with
+ *     sign extension i.e. the top 16 bits are set to either 0 or 0xffff.
+ *
+ *   INPUTS:
+ *
+ *     var1
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     L_Out
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0xffff 8000 <= L_var1 <= 0x0000 7fff.
+ *
+ *   KEYWORDS: deposit, assign
+ *
+ *************************************************************************/
+
+static inline int32_t L_deposit_l(int16_t var1)
+{
+	int32_t L_Out;
+
+	L_Out = var1;
+	return (L_Out);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: L_add
+ *
+ *   PURPOSE:
+ *
+ *     Perform the addition of the two 32 bit input variables with
+ *     saturation.
+ *
+ *   INPUTS:
+ *
+ *     L_var1
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *     L_var2
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var2 <= 0x7fff ffff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     L_Out
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *
+ *   IMPLEMENTATION:
+ *
+ *     Perform the addition of the two 32 bit input variables with
+ *     saturation.
+ *
+ *     L_Out = L_var1 + L_var2
+ *
+ *     L_Out is set to 0x7fff ffff if the operation results in an
+ *     overflow.  L_Out is set to 0x8000 0000 if the operation
+ *     results in an underflow.
+ *
+ *   KEYWORDS: add, addition
+ *
+ *************************************************************************/
+static inline int32_t L_add(int32_t L_var1, int32_t L_var2)
+{
+	int64_t L_Sum;
+
+	L_Sum = (int64_t) L_var1 + L_var2;
+
+	if (L_Sum > LW_MAX)
+		L_Sum = LW_MAX;	/* overflow */
+	else if (L_Sum < LW_MIN)
+		L_Sum = LW_MIN;	/* underflow */
+
+	return ((int32_t) L_Sum);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: L_sub
+ *
+ *   PURPOSE:
+ *
+ *     Perform the subtraction of the two 32 bit input variables with
+ *     saturation.
+ *
+ *   INPUTS:
+ *
+ *     L_var1
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *     L_var2
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var2 <= 0x7fff ffff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     L_Out
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *
+ *   IMPLEMENTATION:
+ *
+ *     Perform the subtraction of the two 32 bit input variables with
+ *     saturation.
+ *
+ *     L_Out = L_var1 - L_var2
+ *
+ *     L_Out is set to 0x7fff ffff if the operation results in an
+ *     overflow.  L_Out is set to 0x8000 0000 if the operation
+ *     results in an underflow.
+ *
+ *   KEYWORDS: sub, subtraction
+ *
+ *************************************************************************/
+static inline int32_t L_sub(int32_t L_var1, int32_t L_var2)
+{
+	int32_t L_Sum;
+
+	/* check for overflow */
+	if ((L_var1 > 0 && L_var2 < 0) || (L_var1 < 0 && L_var2 > 0)) {
+		if (L_var2 == LW_MIN) {
+			L_Sum = L_add(L_var1, LW_MAX);
+			L_Sum = L_add(L_Sum, 1);
+		} else
+			L_Sum = L_add(L_var1, -L_var2);
+	} else {		/* no overflow possible */
+		L_Sum = L_var1 - L_var2;
+	}
+	return (L_Sum);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: L_abs
+ *
+ *   PURPOSE:
+ *
+ *     Take the absolute value of the 32 bit input.  An input of
+ *     -0x8000 0000 results in a return value of 0x7fff ffff.
+ *
+ *   INPUTS:
+ *
+ *     L_var1
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     L_Out
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *
+ *
+ *
+ *   KEYWORDS: absolute value, abs
+ *
+ *************************************************************************/
+static inline int32_t L_abs(int32_t L_var1)
+{
+	int32_t L_Out;
+
+	if (L_var1 == LW_MIN) {
+		L_Out = LW_MAX;
+	} else {
+		if (L_var1 < 0)
+			L_Out = -L_var1;
+		else
+			L_Out = L_var1;
+	}
+	return (L_Out);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: L_negate
+ *
+ *   PURPOSE:
+ *
+ *     Negate the 32 bit input. 0x8000 0000's negated value is
+ *     0x7fff ffff.
+ *
+ *   INPUTS:
+ *
+ *     L_var1
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     L_Out
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0001 <= L_var1 <= 0x7fff ffff.
+ *
+ *   KEYWORDS: negate, negative
+ *
+ *************************************************************************/
+
+static inline int32_t L_negate(int32_t L_var1)
+{
+	int32_t L_Out;
+
+	if (L_var1 == LW_MIN)
+		L_Out = LW_MAX;
+	else
+		L_Out = -L_var1;
+	return (L_Out);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: L_mult
+ *
+ *   PURPOSE:
+ *
+ *     Perform a fractional multipy of the two 16 bit input numbers
+ *     with saturation.  Output a 32 bit number.
+ *
+ *   INPUTS:
+ *
+ *     var1
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
+ *     var2
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     L_Out
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *
+ *   IMPLEMENTATION:
+ *
+ *     Multiply the two the two 16 bit input numbers. If the
+ *     result is within this range, left shift the result by one
+ *     and output the 32 bit number.  The only possible overflow
+ *     occurs when var1==var2==-0x8000.  In this case output
+ *     0x7fff ffff.
+ *
+ *   KEYWORDS: multiply, mult, mpy
+ *
+ *************************************************************************/
+
+static inline int32_t L_mult(int16_t var1, int16_t var2)
+{
+	int32_t L_product;
+
+	if (var1 == SW_MIN && var2 == SW_MIN)
+		L_product = LW_MAX;	/* overflow */
+	else {
+		L_product = (int32_t) var1 *var2;	/* integer multiply */
+
+		L_product = L_product << 1;
+	}
+	return (L_product);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: L_mac
+ *
+ *   PURPOSE:
+ *
+ *     Multiply accumulate.  Fractionally multiply two 16 bit
+ *     numbers together with saturation.  Add that result to the
+ *     32 bit input with saturation.  Return the 32 bit result.
+ *
+ *   INPUTS:
+ *
+ *     var1
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
+ *     var2
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
+ *     L_var3
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var2 <= 0x7fff ffff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     L_Out
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *
+ *   IMPLEMENTATION:
+ *
+ *     Fractionally multiply two 16 bit numbers together with
+ *     saturation.  The only numbers which will cause saturation on
+ *     the multiply are 0x8000 * 0x8000.
+ *
+ *     Add that result to the 32 bit input with saturation.
+ *     Return the 32 bit result.
+ *
+ *     Please note that this is not a true multiply accumulate as
+ *     most processors would implement it.  The 0x8000*0x8000
+ *     causes and overflow for this instruction.  On most
+ *     processors this would cause an overflow only if the 32 bit
+ *     input added to it were positive or zero.
+ *
+ *   KEYWORDS: mac, multiply accumulate
+ *
+ *************************************************************************/
+
+static inline int32_t L_mac(int32_t L_var3, int16_t var1, int16_t var2)
+{
+	return (L_add(L_var3, L_mult(var1, var2)));
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: L_msu
+ *
+ *   PURPOSE:
+ *
+ *     Multiply and subtract.  Fractionally multiply two 16 bit
+ *     numbers together with saturation.  Subtract that result from
+ *     the 32 bit input with saturation.  Return the 32 bit result.
+ *
+ *   INPUTS:
+ *
+ *     var1
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
+ *     var2
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
+ *     L_var3
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var2 <= 0x7fff ffff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     L_Out
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *
+ *   IMPLEMENTATION:
+ *
+ *     Fractionally multiply two 16 bit numbers together with
+ *     saturation.  The only numbers which will cause saturation on
+ *     the multiply are 0x8000 * 0x8000.
+ *
+ *     Subtract that result from the 32 bit input with saturation.
+ *     Return the 32 bit result.
+ *
+ *     Please note that this is not a true multiply accumulate as
+ *     most processors would implement it.  The 0x8000*0x8000
+ *     causes and overflow for this instruction.  On most
+ *     processors this would cause an overflow only if the 32 bit
+ *     input added to it were negative or zero.
+ *
+ *   KEYWORDS: mac, multiply accumulate, msu
+ *
+ *************************************************************************/
+
+static inline int32_t L_msu(int32_t L_var3, int16_t var1, int16_t var2)
+{
+	return (L_sub(L_var3, L_mult(var1, var2)));
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: hr_round
+ *
+ *   PURPOSE:
+ *
+ *     Round the 32 bit int32_t into a 16 bit shortword with saturation.
+ *
+ *   INPUTS:
+ *
+ *     L_var1
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var1 <= 0x7fff ffff.
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     swOut
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range
+ *                     0xffff 8000 <= swOut <= 0x0000 7fff.
+ *
+ *   IMPLEMENTATION:
+ *
+ *     Perform a two's complement hr_round on the input int32_t with
+ *     saturation.
+ *
+ *     This is equivalent to adding 0x0000 8000 to the input.  The
+ *     result may overflow due to the add.  If so, the result is
+ *     saturated.  The 32 bit hr_rounded number is then shifted down
+ *     16 bits and returned as a int16_t.
+ *
+ *
+ *   KEYWORDS: hr_round
+ *
+ *************************************************************************/
+
+static inline int16_t hr_round(int32_t L_var1)
+{
+	int32_t L_Prod;
+
+	L_Prod = L_add(L_var1, 0x00008000L);	/* hr_round MSP */
+	return (extract_h(L_Prod));
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: mult
+ *
+ *   PURPOSE:
+ *
+ *     Perform a fractional multipy of the two 16 bit input numbers
+ *     with saturation and truncation.
+ *
+ *   INPUTS:
+ *
+ *     var1
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
+ *     var2
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     swOut
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range
+ *                     0xffff 8000 <= swOut <= 0x0000 7fff.
+ *
+ *   IMPLEMENTATION:
+ *
+ *     Perform a fractional multipy of the two 16 bit input
+ *     numbers.  If var1 == var2 == -0x8000, output 0x7fff.
+ *     Otherwise output var1*var2 >> 15.  The output is a
+ *     16 bit number.
+ *
+ *   KEYWORDS: mult, mulitply, mpy
+ *
+ *************************************************************************/
+
+static inline int16_t mult(int16_t var1, int16_t var2)
+{
+	int32_t L_product;
+	int16_t swOut;
+
+	L_product = L_mult(var1, var2);
+	swOut = extract_h(L_product);
+	return (swOut);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME: mult_r
+ *
+ *   PURPOSE:
+ *
+ *     Perform a fractional multipy and hr_round of the two 16 bit
+ *     input numbers with saturation.
+ *
+ *   INPUTS:
+ *
+ *     var1
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
+ *     var2
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     swOut
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range
+ *                     0xffff 8000 <= swOut <= 0x0000 7fff.
+ *
+ *   IMPLEMENTATION:
+ *
+ *     This routine is defined as the concatenation of the multiply
+ *     operation and the hr_round operation.
+ *
+ *     The fractional multiply (L_mult) produces a saturated 32 bit
+ *     output.  This is followed by a an add of 0x0000 8000 to the
+ *     32 bit result.  The result may overflow due to the add.  If
+ *     so, the result is saturated.  The 32 bit hr_rounded number is
+ *     then shifted down 16 bits and returned as a int16_t.
+ *
+ *
+ *   KEYWORDS: multiply and hr_round, hr_round, mult_r, mpyr
+ *
+ *************************************************************************/
+
+static inline int16_t mult_r(int16_t var1, int16_t var2)
+{
+	int16_t swOut;
+
+	swOut = hr_round(L_mult(var1, var2));
+	return (swOut);
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME:mac_r
+ *
+ *   PURPOSE:
+ *
+ *     Multiply accumulate and hr_round.  Fractionally multiply two 16
+ *     bit numbers together with saturation.  Add that result to
+ *     the 32 bit input with saturation.  Finally hr_round the result
+ *     into a 16 bit number.
+ *
+ *
+ *   INPUTS:
+ *
+ *     var1
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
+ *     var2
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
+ *     L_var3
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var2 <= 0x7fff ffff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     swOut
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range
+ *                     0xffff 8000 <= swOut <= 0x0000 7fff.
+ *
+ *   IMPLEMENTATION:
+ *
+ *     Fractionally multiply two 16 bit numbers together with
+ *     saturation.  The only numbers which will cause saturation on
+ *     the multiply are 0x8000 * 0x8000.
+ *
+ *     Add that result to the 32 bit input with saturation.
+ *     Round the 32 bit result by adding 0x0000 8000 to the input.
+ *     The result may overflow due to the add.  If so, the result
+ *     is saturated.  The 32 bit hr_rounded number is then shifted
+ *     down 16 bits and returned as a int16_t.
+ *
+ *     Please note that this is not a true multiply accumulate as
+ *     most processors would implement it.  The 0x8000*0x8000
+ *     causes and overflow for this instruction.  On most
+ *     processors this would cause an overflow only if the 32 bit
+ *     input added to it were positive or zero.
+ *
+ *   KEYWORDS: mac, multiply accumulate, macr
+ *
+ *************************************************************************/
+
+static inline int16_t mac_r(int32_t L_var3, int16_t var1, int16_t var2)
+{
+	return (hr_round(L_add(L_var3, L_mult(var1, var2))));
+}
+
+/***************************************************************************
+ *
+ *   FUNCTION NAME:  msu_r
+ *
+ *   PURPOSE:
+ *
+ *     Multiply subtract and hr_round.  Fractionally multiply two 16
+ *     bit numbers together with saturation.  Subtract that result from
+ *     the 32 bit input with saturation.  Finally hr_round the result
+ *     into a 16 bit number.
+ *
+ *
+ *   INPUTS:
+ *
+ *     var1
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var1 <= 0x0000 7fff.
+ *     var2
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range 0xffff 8000 <= var2 <= 0x0000 7fff.
+ *     L_var3
+ *                     32 bit long signed integer (int32_t) whose value
+ *                     falls in the range
+ *                     0x8000 0000 <= L_var2 <= 0x7fff ffff.
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     swOut
+ *                     16 bit short signed integer (int16_t) whose value
+ *                     falls in the range
+ *                     0xffff 8000 <= swOut <= 0x0000 7fff.
+ *
+ *   IMPLEMENTATION:
+ *
+ *     Fractionally multiply two 16 bit numbers together with
+ *     saturation.  The only numbers which will cause saturation on
+ *     the multiply are 0x8000 * 0x8000.
+ *
+ *     Subtract that result from the 32 bit input with saturation.
+ *     Round the 32 bit result by adding 0x0000 8000 to the input.
+ *     The result may overflow due to the add.  If so, the result
+ *     is saturated.  The 32 bit hr_rounded number is then shifted
+ *     down 16 bits and returned as a int16_t.
+ *
+ *     Please note that this is not a true multiply accumulate as
+ *     most processors would implement it.  The 0x8000*0x8000
+ *     causes and overflow for this instruction.  On most
+ *     processors this would cause an overflow only if the 32 bit
+ *     input added to it were positive or zero.
+ *
+ *   KEYWORDS: mac, multiply accumulate, macr
+ *
+ *************************************************************************/
+
+static inline int16_t msu_r(int32_t L_var3, int16_t var1, int16_t var2)
+{
+	return (hr_round(L_sub(L_var3, L_mult(var1, var2))));
+}
+
 #endif
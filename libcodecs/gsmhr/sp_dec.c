@@ -64,6 +64,7 @@
  *       lpcZsFir()
  *       lpcZsIir()
  *       lpcZsIirP()
+ *       lpcNoSat()
  *     Square root:
  *       sqroot()
  *
@@ -81,6 +82,7 @@
 #include "sp_dec.h"
 #include "err_conc.h"
 #include "dtx.h"
+#include "state.h"
 
 /*_________________________________________________________________________
  |                                                                         |
@@ -97,10 +99,12 @@ static short aToRc(int16_t swAshift, int16_t pswAin[], int16_t pswRc[]);
 static int16_t agcGain(int16_t pswStateCurr[],
 			 struct NormSw snsInSigEnergy, int16_t swEngyRShft);
 
-static int16_t lagDecode(int16_t swDeltaLag);
+static int16_t lagDecode(struct gsmhr_dec *st, int16_t swDeltaLag);
 
 static void lookupVq(int16_t pswVqCodeWds[], int16_t pswRCOut[]);
 
+static int lpcNoSat(int16_t pswCoef[]);
+
 static void pitchPreFilt(int16_t pswExcite[],
 			 int16_t swRxGsp0,
 			 int16_t swRxLag,
@@ -109,7 +113,8 @@ static void pitchPreFilt(int16_t pswExcite[],
 			 struct NormSw snsSqrtRs,
 			 int16_t pswExciteOut[], int16_t pswPPreState[]);
 
-static void spectralPostFilter(int16_t pswSPFIn[],
+static void spectralPostFilter(struct gsmhr_dec *st,
+			       int16_t pswSPFIn[],
 			       int16_t pswNumCoef[], int16_t pswDenomCoef[],
 			       int16_t pswSPFOut[]);
 
@@ -130,65 +135,12 @@ static void spectralPostFilter(int16_t pswSPFIn[],
 				 * codeword */
 #define  MAXBITS      C_BITS_V	/* max number of bits in any VSELP
 				 * codeword */
-#define  LTP_LEN      147	/* 147==0x93 length of LTP history */
 #define  SQRT_ONEHALF 0x5a82	/* the 0.5 ** 0.5 */
 #define  LPC_ROUND    0x00000800L	/* 0x8000 >> ASHIFT */
 #define  AFSHIFT      2		/* number of right shifts to be
 				 * applied to the autocorrelation
 				 * sequence in aFlatRcDp     */
 
-/*_________________________________________________________________________
- |                                                                         |
- |                         State variables (globals)                       |
- |_________________________________________________________________________|
-*/
-
-int16_t gswPostFiltAgcGain,
-    gpswPostFiltStateNum[NP],
-    gpswPostFiltStateDenom[NP],
-    swPostEmphasisState,
-    pswSynthFiltState[NP],
-    pswOldFrmKsDec[NP],
-    pswOldFrmAsDec[NP],
-    pswOldFrmPFNum[NP],
-    pswOldFrmPFDenom[NP],
-    swOldR0Dec,
-    pswLtpStateBaseDec[LTP_LEN + S_LEN], pswPPreState[LTP_LEN + S_LEN];
-
-int16_t swMuteFlagOld;	/* error concealment */
-
- /* DTX state variables */
- /* ------------------- */
-
-int16_t swRxDTXState = CNINTPER - 1;	/* DTX State at the rx.
-					 * Modulo */
-
- /* counter [0,11].             */
-
-int16_t swDecoMode = SPEECH;
-int16_t swDtxMuting = 0;
-int16_t swDtxBfiCnt = 0;
-
-int16_t swOldR0IndexDec = 0;
-
-int16_t swRxGsHistPtr = 0;
-int32_t pL_RxGsHist[(OVERHANG - 1) * N_SUB];
-
-/*_________________________________________________________________________
- |                                                                         |
- |                               Global Data                               |
- |                     (scope is global to this file)                      |
- |_________________________________________________________________________|
-*/
-
-int16_t swR0Dec;
-
-int16_t swVoicingMode,	/* MODE */
- pswVq[3],			/* LPC1, LPC2, LPC3 */
- swSi,				/* INT_LPC */
- swEngyRShift;			/* for use by spectral postfilter */
-
-int16_t swR0NewCN;		/* DTX mode */
 
 extern int32_t ppLr_gsTable[4][32];	/* DTX mode */
 
@@ -1783,11 +1735,11 @@ short int interpolateCheck(int16_t pswRefKs[],
  *
  *                     lag received from channel decoder
  *
- *     giSfrmCnt
+ *     st->giSfrmCnt
  *
  *                     current sub-frame count
  *
- *     swLastLag
+ *     st->swLastLag
  *
  *                     previous lag to un-delta this sub-frame's lag
  *
@@ -1797,7 +1749,7 @@ short int interpolateCheck(int16_t pswRefKs[],
  *
  *   OUTPUTS:
  *
- *     swLastLag
+ *     st->swLastLag
  *
  *                     new previous lag for next sub-frame
  *
@@ -1821,7 +1773,7 @@ short int interpolateCheck(int16_t pswRefKs[],
  *
  *************************************************************************/
 
-static int16_t lagDecode(int16_t swDeltaLag)
+static int16_t lagDecode(struct gsmhr_dec *st, int16_t swDeltaLag)
 {
 
 /*_________________________________________________________________________
@@ -1834,14 +1786,6 @@ static int16_t lagDecode(int16_t swDeltaLag)
 #define  MAX_LAG          0x00ff
 #define  MIN_LAG          0x0000
 
-/*_________________________________________________________________________
- |                                                                         |
- |                           Local Static Variables                        |
- |_________________________________________________________________________|
-*/
-
-	static int16_t swLastLag;
-
 /*_________________________________________________________________________
  |                                                                         |
  |                            Automatic Variables                          |
@@ -1859,8 +1803,8 @@ static int16_t lagDecode(int16_t swDeltaLag)
 	/* first sub-frame */
 	/* --------------- */
 
-	if (giSfrmCnt == 0) {
-		swLastLag = swDeltaLag;
+	if (st->giSfrmCnt == 0) {
+		st->swLastLag = swDeltaLag;
 	}
 
 	/* remaining sub-frames */
@@ -1876,24 +1820,24 @@ static int16_t lagDecode(int16_t swDeltaLag)
 		/* get real lag relative to last */
 		/* ----------------------------- */
 
-		swLag = add(swLag, swLastLag);
+		swLag = add(swLag, st->swLastLag);
 
 		/* clip to max or min */
 		/* ------------------ */
 
 		if (sub(swLag, MAX_LAG) > 0) {
-			swLastLag = MAX_LAG;
+			st->swLastLag = MAX_LAG;
 		} else if (sub(swLag, MIN_LAG) < 0) {
-			swLastLag = MIN_LAG;
+			st->swLastLag = MIN_LAG;
 		} else {
-			swLastLag = swLag;
+			st->swLastLag = swLag;
 		}
 	}
 
 	/* return lag after look up */
 	/* ------------------------ */
 
-	swLag = psrLagTbl[swLastLag];
+	swLag = psrLagTbl[st->swLastLag];
 	return (swLag);
 }
 
@@ -2036,6 +1980,70 @@ static void lookupVq(int16_t pswVqCodeWds[], int16_t pswRCOut[])
 	}
 }
 
+/***************************************************************************
+ *
+ *   FUNCTION NAME: lpcNoSat
+ *
+ *   PURPOSE:
+ *
+ *     Tells whether the NP tap sum of a direct form filter with the given
+ *     coefficients can saturate.
+ *
+ *   INPUTS:
+ *
+ *     pswCoef[0:NP-1]
+ *                     array of direct form coefficients
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     nonzero if no partial sum can saturate, whatever the data
+ *
+ *   DESCRIPTION:
+ *
+ *     Every tap adds at most 2 * 0x8000 * |coef| to the magnitude of the
+ *     L_mac()/L_msu() chain started at LPC_ROUND.  When the absolute
+ *     coefficients sum to no more than (LW_MAX - LPC_ROUND) >> 16 no prefix
+ *     of the chain can leave the 32 bit range, and the chain equals the
+ *     plain integer sum LPC_ROUND +/- 2 * sum(data * coef) bit for bit.
+ *     The lpc filters use that to drop the per tap saturation checks.
+ *
+ *   KEYWORDS: lpc, directform, saturation, lpcFilt
+ *
+ *************************************************************************/
+
+static int lpcNoSat(int16_t pswCoef[])
+{
+
+/*_________________________________________________________________________
+ |                                                                         |
+ |                            Automatic Variables                          |
+ |_________________________________________________________________________|
+*/
+
+	int32_t L_Sum;
+	short int siStage;
+
+/*_________________________________________________________________________
+ |                                                                         |
+ |                              Executable Code                            |
+ |_________________________________________________________________________|
+*/
+
+	L_Sum = 0;
+	for (siStage = 0; siStage < NP; siStage++) {
+		if (pswCoef[siStage] < 0)
+			L_Sum -= pswCoef[siStage];
+		else
+			L_Sum += pswCoef[siStage];
+	}
+
+	return (L_Sum <= (LW_MAX - LPC_ROUND) >> 16);
+}
+
 /***************************************************************************
  *
  *   FUNCTION NAME: lpcFir
@@ -2125,6 +2133,7 @@ void lpcFir(int16_t pswInput[], int16_t pswCoef[],
 
 	int32_t L_Sum;
 	short int siStage, siSmp;
+	int iNoSat;
 
 /*_________________________________________________________________________
  |                                                                         |
@@ -2132,6 +2141,8 @@ void lpcFir(int16_t pswInput[], int16_t pswCoef[],
  |_________________________________________________________________________|
 */
 
+	iNoSat = lpcNoSat(pswCoef);
+
 	/* filter 1st sample */
 	/* ----------------- */
 
@@ -2160,25 +2171,44 @@ void lpcFir(int16_t pswInput[], int16_t pswCoef[],
 
 	for (siSmp = 1; siSmp < S_LEN; siSmp++) {
 
-		/* sum past outputs */
-		/* ---------------- */
-		/* 0th coef, with hr_rounding */
-		L_Sum = L_mac(LPC_ROUND, pswInput[siSmp - 1], pswCoef[0]);
-		/* remaining coefs */
-		for (siStage = 1; ((0 < (siSmp - siStage)) && siStage < NP);
-		     siStage++) {
-			L_Sum =
-			    L_mac(L_Sum, pswInput[siSmp - siStage - 1],
-				  pswCoef[siStage]);
-		}
+		if (iNoSat) {
 
-		/* sum past states, if any */
-		/* ----------------------- */
+			/* no saturation possible, plain integer sum */
+			/* ----------------------------------------- */
 
-		for (siStage = siSmp; siStage < NP; siStage++) {
-			L_Sum =
-			    L_mac(L_Sum, pswState[siStage - siSmp],
-				  pswCoef[siStage]);
+			L_Sum = 0;
+			for (siStage = 0; siStage < siSmp && siStage < NP;
+			     siStage++)
+				L_Sum += pswInput[siSmp - siStage - 1] *
+				    pswCoef[siStage];
+			for (siStage = siSmp; siStage < NP; siStage++)
+				L_Sum += pswState[siStage - siSmp] *
+				    pswCoef[siStage];
+			L_Sum = LPC_ROUND + 2 * L_Sum;
+		} else {
+
+			/* sum past outputs */
+			/* ---------------- */
+			/* 0th coef, with hr_rounding */
+			L_Sum = L_mac(LPC_ROUND, pswInput[siSmp - 1],
+				      pswCoef[0]);
+			/* remaining coefs */
+			for (siStage = 1;
+			     ((0 < (siSmp - siStage)) && siStage < NP);
+			     siStage++) {
+				L_Sum =
+				    L_mac(L_Sum, pswInput[siSmp - siStage - 1],
+					  pswCoef[siStage]);
+			}
+
+			/* sum past states, if any */
+			/* ----------------------- */
+
+			for (siStage = siSmp; siStage < NP; siStage++) {
+				L_Sum =
+				    L_mac(L_Sum, pswState[siStage - siSmp],
+					  pswCoef[siStage]);
+			}
 		}
 
 		/* add input to partial output */
@@ -2290,6 +2320,7 @@ void lpcIir(int16_t pswInput[], int16_t pswCoef[],
 
 	int32_t L_Sum;
 	short int siStage, siSmp;
+	int iNoSat;
 
 /*_________________________________________________________________________
  |                                                                         |
@@ -2297,6 +2328,8 @@ void lpcIir(int16_t pswInput[], int16_t pswCoef[],
  |_________________________________________________________________________|
 */
 
+	iNoSat = lpcNoSat(pswCoef);
+
 	/* filter 1st sample */
 	/* ----------------- */
 
@@ -2325,25 +2358,44 @@ void lpcIir(int16_t pswInput[], int16_t pswCoef[],
 
 	for (siSmp = 1; siSmp < S_LEN; siSmp++) {
 
-		/* sum past outputs */
-		/* ---------------- */
-		/* 0th coef, with hr_rounding */
-		L_Sum = L_msu(LPC_ROUND, pswFiltOut[siSmp - 1], pswCoef[0]);
-		/* remaining coefs */
-		for (siStage = 1; ((0 < (siSmp - siStage)) && siStage < NP);
-		     siStage++) {
-			L_Sum =
-			    L_msu(L_Sum, pswFiltOut[siSmp - siStage - 1],
-				  pswCoef[siStage]);
-		}
+		if (iNoSat) {
 
-		/* sum past states, if any */
-		/* ----------------------- */
+			/* no saturation possible, plain integer sum */
+			/* ----------------------------------------- */
 
-		for (siStage = siSmp; siStage < NP; siStage++) {
-			L_Sum =
-			    L_msu(L_Sum, pswState[siStage - siSmp],
-				  pswCoef[siStage]);
+			L_Sum = 0;
+			for (siStage = 0; siStage < siSmp && siStage < NP;
+			     siStage++)
+				L_Sum += pswFiltOut[siSmp - siStage - 1] *
+				    pswCoef[siStage];
+			for (siStage = siSmp; siStage < NP; siStage++)
+				L_Sum += pswState[siStage - siSmp] *
+				    pswCoef[siStage];
+			L_Sum = LPC_ROUND - 2 * L_Sum;
+		} else {
+
+			/* sum past outputs */
+			/* ---------------- */
+			/* 0th coef, with hr_rounding */
+			L_Sum = L_msu(LPC_ROUND, pswFiltOut[siSmp - 1],
+				      pswCoef[0]);
+			/* remaining coefs */
+			for (siStage = 1;
+			     ((0 < (siSmp - siStage)) && siStage < NP);
+			     siStage++) {
+				L_Sum =
+				    L_msu(L_Sum, pswFiltOut[siSmp - siStage - 1],
+					  pswCoef[siStage]);
+			}
+
+			/* sum past states, if any */
+			/* ----------------------- */
+
+			for (siStage = siSmp; siStage < NP; siStage++) {
+				L_Sum =
+				    L_msu(L_Sum, pswState[siStage - siSmp],
+					  pswCoef[siStage]);
+			}
 		}
 
 		/* add input to partial output */
@@ -2820,6 +2872,7 @@ void lpcZsIir(int16_t pswInput[], int16_t pswCoef[], int16_t pswFiltOut[])
 
 	int32_t L_Sum;
 	short int siStage, siSmp;
+	int iNoSat;
 
 /*_________________________________________________________________________
  |                                                                         |
@@ -2827,6 +2880,8 @@ void lpcZsIir(int16_t pswInput[], int16_t pswCoef[], int16_t pswFiltOut[])
  |_________________________________________________________________________|
 */
 
+	iNoSat = lpcNoSat(pswCoef);
+
 	/* output 1st sample */
 	/* ----------------- */
 
@@ -2837,16 +2892,32 @@ void lpcZsIir(int16_t pswInput[], int16_t pswCoef[], int16_t pswFiltOut[])
 
 	for (siSmp = 1; siSmp < S_LEN; siSmp++) {
 
-		/* sum past outputs */
-		/* ---------------- */
-		/* 0th coef, with hr_rounding */
-		L_Sum = L_msu(LPC_ROUND, pswFiltOut[siSmp - 1], pswCoef[0]);
-		/* remaining coefs */
-		for (siStage = 1; ((0 < (siSmp - siStage)) && siStage < NP);
-		     siStage++) {
-			L_Sum =
-			    L_msu(L_Sum, pswFiltOut[siSmp - siStage - 1],
-				  pswCoef[siStage]);
+		if (iNoSat) {
+
+			/* no saturation possible, plain integer sum */
+			/* ----------------------------------------- */
+
+			L_Sum = 0;
+			for (siStage = 0; siStage < siSmp && siStage < NP;
+			     siStage++)
+				L_Sum += pswFiltOut[siSmp - siStage - 1] *
+				    pswCoef[siStage];
+			L_Sum = LPC_ROUND - 2 * L_Sum;
+		} else {
+
+			/* sum past outputs */
+			/* ---------------- */
+			/* 0th coef, with hr_rounding */
+			L_Sum = L_msu(LPC_ROUND, pswFiltOut[siSmp - 1],
+				      pswCoef[0]);
+			/* remaining coefs */
+			for (siStage = 1;
+			     ((0 < (siSmp - siStage)) && siStage < NP);
+			     siStage++) {
+				L_Sum =
+				    L_msu(L_Sum, pswFiltOut[siSmp - siStage - 1],
+					  pswCoef[siStage]);
+			}
 		}
 
 		/* add input to partial output */
@@ -4109,18 +4180,18 @@ int16_t scaleExcite(int16_t pswVect[],
  *                    Exactly like lpc coefficients in format.  Shifted down
  *                    by iAShift to ensure that they are < 1.0.
  *
- *      gpswPostFiltStateNum[0:NP-1], gpswPostFiltStateDenom[0:NP-1]
+ *      st->gpswPostFiltStateNum[0:NP-1], st->gpswPostFiltStateDenom[0:NP-1]
  *
  *                    array of the filter state.
  *                    Same format as coefficients: *praState = state of
  *                    filter for delay n = -1 praState[NP] = state of
  *                    filter for delay n = -NP These numbers are not
- *                    shifted at all.  These states are static to this
- *                    file.
+ *                    shifted at all.  These states are kept in the
+ *                    decoder instance.
  *
  *   OUTPUT:
  *
- *      gpswPostFiltStateNum[0:NP-1], gpswPostFiltStateDenom[0:NP-1]
+ *      st->gpswPostFiltStateNum[0:NP-1], st->gpswPostFiltStateDenom[0:NP-1]
  *
  *                      See above for description.  These are updated.
  *
@@ -4155,7 +4226,8 @@ int16_t scaleExcite(int16_t pswVect[],
  *
  *************************************************************************/
 
-static void spectralPostFilter(int16_t pswSPFIn[],
+static void spectralPostFilter(struct gsmhr_dec *st,
+			       int16_t pswSPFIn[],
 			       int16_t pswNumCoef[],
 			       int16_t pswDenomCoef[], int16_t pswSPFOut[])
 {
@@ -4192,36 +4264,36 @@ static void spectralPostFilter(int16_t pswSPFIn[],
 	/* calculate the energy in the input and save it */
   /*-----------------------------------------------*/
 
-	snsOrigEnergy.sh = g_corr1s(pswSPFIn, swEngyRShift, &L_OrigEnergy);
+	snsOrigEnergy.sh = g_corr1s(pswSPFIn, st->swEngyRShift, &L_OrigEnergy);
 	snsOrigEnergy.man = hr_round(L_OrigEnergy);
 
 	/* numerator of the postfilter */
   /*-----------------------------*/
 
-	lpcFir(pswSPFIn, pswNumCoef, gpswPostFiltStateNum, pswSPFOut);
+	lpcFir(pswSPFIn, pswNumCoef, st->gpswPostFiltStateNum, pswSPFOut);
 
 	/* denominator of the postfilter */
   /*-------------------------------*/
 
-	lpcIir(pswSPFOut, pswDenomCoef, gpswPostFiltStateDenom, pswSPFOut);
+	lpcIir(pswSPFOut, pswDenomCoef, st->gpswPostFiltStateDenom, pswSPFOut);
 
 	/* postemphasis section of postfilter */
   /*------------------------------------*/
 
 	for (i = 0; i < S_LEN; i++) {
-		swTemp = msu_r(L_deposit_h(pswSPFOut[i]), swPostEmphasisState,
+		swTemp = msu_r(L_deposit_h(pswSPFOut[i]), st->swPostEmphasisState,
 			       POST_EMPHASIS);
-		swPostEmphasisState = pswSPFOut[i];
+		st->swPostEmphasisState = pswSPFOut[i];
 		pswSPFOut[i] = swTemp;
 	}
 
-	swAgcGain = agcGain(pswSPFOut, snsOrigEnergy, swEngyRShift);
+	swAgcGain = agcGain(pswSPFOut, snsOrigEnergy, st->swEngyRShift);
 
 	/* scale the speech vector */
   /*-----------------------------*/
 
-	swRunningGain = gswPostFiltAgcGain;
-	L_runningGain = L_deposit_h(gswPostFiltAgcGain);
+	swRunningGain = st->gswPostFiltAgcGain;
+	L_runningGain = L_deposit_h(st->gswPostFiltAgcGain);
 	for (i = 0; i < S_LEN; i++) {
 		L_runningGain = L_msu(L_runningGain, swRunningGain, AGC_COEF);
 		L_runningGain = L_mac(L_runningGain, swAgcGain, AGC_COEF);
@@ -4232,7 +4304,7 @@ static void spectralPostFilter(int16_t pswSPFIn[],
 		L_Output = L_mult(swRunningGain, pswSPFOut[i]);
 		pswSPFOut[i] = extract_h(L_shl(L_Output, 2));
 	}
-	gswPostFiltAgcGain = swRunningGain;
+	st->gswPostFiltAgcGain = swRunningGain;
 
 }
 
@@ -4247,6 +4319,10 @@ static void spectralPostFilter(int16_t pswSPFIn[],
  *
  *   INPUTS:
  *
+ *     st
+ *
+ *        decoder instance state
+ *
  *     pswParameters[0:21]
  *
  *        pointer to this frame's parameters.  See below for input
@@ -4385,7 +4461,8 @@ static void spectralPostFilter(int16_t pswSPFIn[],
  *
  *************************************************************************/
 
-void speechDecoder(int16_t pswParameters[], int16_t pswDecodedSpeechFrame[])
+void speechDecoder(struct gsmhr_dec *st,
+		   int16_t pswParameters[], int16_t pswDecodedSpeechFrame[])
 {
 
 /*_________________________________________________________________________
@@ -4394,38 +4471,36 @@ void speechDecoder(int16_t pswParameters[], int16_t pswDecodedSpeechFrame[])
  |_________________________________________________________________________|
 */
 
-	static int16_t
-	    * pswLtpStateOut = &pswLtpStateBaseDec[LTP_LEN],
-	    pswSythAsSpace[NP * N_SUB],
-	    pswPFNumAsSpace[NP * N_SUB],
-	    pswPFDenomAsSpace[NP * N_SUB], *ppswSynthAs[N_SUB] = {
-		&pswSythAsSpace[0],
-		&pswSythAsSpace[10],
-		&pswSythAsSpace[20],
-		&pswSythAsSpace[30],
-	}, *ppswPFNumAs[N_SUB] = {
-	&pswPFNumAsSpace[0],
-		    &pswPFNumAsSpace[10],
-		    &pswPFNumAsSpace[20],
-		    &pswPFNumAsSpace[30],}, *ppswPFDenomAs[N_SUB] = {
-	&pswPFDenomAsSpace[0],
-		    &pswPFDenomAsSpace[10],
-		    &pswPFDenomAsSpace[20], &pswPFDenomAsSpace[30],};
-
 	static int16_t psrSPFDenomWidenCf[NP] = {
 		0x6000, 0x4800, 0x3600, 0x2880, 0x1E60,
 		0x16C8, 0x1116, 0x0CD0, 0x099C, 0x0735,
 	};
 
-	static int32_t L_RxPNSeed;	/* DTX mode */
-	static int16_t swRxDtxGsIndex;	/* DTX mode */
-
 /*_________________________________________________________________________
  |                                                                         |
  |                            Automatic Variables                          |
  |_________________________________________________________________________|
 */
 
+	int16_t
+	    * pswLtpStateOut = &st->pswLtpStateBaseDec[LTP_LEN],
+	    *ppswSynthAs[N_SUB] = {
+		&st->pswSythAsSpace[0],
+		&st->pswSythAsSpace[10],
+		&st->pswSythAsSpace[20],
+		&st->pswSythAsSpace[30],
+	}, *ppswPFNumAs[N_SUB] = {
+		&st->pswPFNumAsSpace[0],
+		&st->pswPFNumAsSpace[10],
+		&st->pswPFNumAsSpace[20],
+		&st->pswPFNumAsSpace[30],
+	}, *ppswPFDenomAs[N_SUB] = {
+		&st->pswPFDenomAsSpace[0],
+		&st->pswPFDenomAsSpace[10],
+		&st->pswPFDenomAsSpace[20],
+		&st->pswPFDenomAsSpace[30],
+	};
+
 	short int i,
 	    j,
 	    siLagCode = 0,
@@ -4492,76 +4567,76 @@ void speechDecoder(int16_t pswParameters[], int16_t pswDecodedSpeechFrame[])
 	/* update of decoder state */
 	/* ----------------------- */
 
-	if (swDecoMode == SPEECH) {
+	if (st->swDecoMode == SPEECH) {
 		/* speech decoding mode */
 		/* -------------------- */
 
 		if (swFrameType == VALIDSID)
-			swDecoMode = CNIFIRSTSID;
+			st->swDecoMode = CNIFIRSTSID;
 		else if (swFrameType == INVALIDSID)
-			swDecoMode = CNIFIRSTSID;
+			st->swDecoMode = CNIFIRSTSID;
 		else if (swFrameType == UNUSABLE)
-			swDecoMode = SPEECH;
+			st->swDecoMode = SPEECH;
 		else if (swFrameType == GOODSPEECH)
-			swDecoMode = SPEECH;
+			st->swDecoMode = SPEECH;
 	} else {
 		/* comfort noise insertion mode */
 		/* ---------------------------- */
 
 		if (swFrameType == VALIDSID)
-			swDecoMode = CNICONT;
+			st->swDecoMode = CNICONT;
 		else if (swFrameType == INVALIDSID)
-			swDecoMode = CNICONT;
+			st->swDecoMode = CNICONT;
 		else if (swFrameType == UNUSABLE)
-			swDecoMode = CNIBFI;
+			st->swDecoMode = CNIBFI;
 		else if (swFrameType == GOODSPEECH)
-			swDecoMode = SPEECH;
+			st->swDecoMode = SPEECH;
 	}
 
-	if (swDecoMode == SPEECH) {
+	if (st->swDecoMode == SPEECH) {
 		/* speech decoding mode */
 		/* -------------------- */
 
 		/* Perform parameter concealment, depending on BFI (pswParameters[18]) */
 		/* or UFI (pswParameters[19])                                          */
 		/* ------------------------------------------------------------------- */
-		para_conceal_speech_decoder(&pswParameters[18],
+		para_conceal_speech_decoder(st, &pswParameters[18],
 					    pswParameters, &swMutePermit);
 
 		/* copy the frame rate parameters */
 		/* ------------------------------ */
 
 		swR0Index = pswParameters[0];	/* R0 Index */
-		pswVq[0] = pswParameters[1];	/* LPC1 */
-		pswVq[1] = pswParameters[2];	/* LPC2 */
-		pswVq[2] = pswParameters[3];	/* LPC3 */
-		swSi = pswParameters[4];	/* INT_LPC */
-		swVoicingMode = pswParameters[5];	/* MODE */
+		st->pswVq[0] = pswParameters[1];	/* LPC1 */
+		st->pswVq[1] = pswParameters[2];	/* LPC2 */
+		st->pswVq[2] = pswParameters[3];	/* LPC3 */
+		st->swSi = pswParameters[4];	/* INT_LPC */
+		st->swVoicingMode = pswParameters[5];	/* MODE */
 
 		/* lookup R0 and VQ parameters */
 		/* --------------------------- */
 
-		swR0Dec = psrR0DecTbl[swR0Index * 2];	/* R0 */
-		lookupVq(pswVq, pswFrmKs);
+		st->swR0Dec = psrR0DecTbl[swR0Index * 2];	/* R0 */
+		lookupVq(st->pswVq, pswFrmKs);
 
 		/* save this frames GS values */
 		/* -------------------------- */
 
 		for (i = 0; i < N_SUB; i++) {
-			pL_RxGsHist[swRxGsHistPtr] =
-			    ppLr_gsTable[swVoicingMode][pswParameters
+			st->pL_RxGsHist[st->swRxGsHistPtr] =
+			    ppLr_gsTable[st->swVoicingMode][pswParameters
 							[(i * 3) + 8]];
-			swRxGsHistPtr++;
-			if (swRxGsHistPtr > ((OVERHANG - 1) * N_SUB) - 1)
-				swRxGsHistPtr = 0;
+			st->swRxGsHistPtr++;
+			if (st->swRxGsHistPtr > ((OVERHANG - 1) * N_SUB) - 1)
+				st->swRxGsHistPtr = 0;
 		}
 
 		/* DTX variables */
 		/* ------------- */
 
-		swDtxBfiCnt = 0;
-		swDtxMuting = 0;
-		swRxDTXState = CNINTPER - 1;
+		st->swDtxBfiCnt = 0;
+		st->swDtxMuting = 0;
+		st->swRxDTXState = CNINTPER - 1;
 
 	} else {
 		/* comfort noise insertion mode */
@@ -4571,68 +4646,68 @@ void speechDecoder(int16_t pswParameters[], int16_t pswDecodedSpeechFrame[])
 		/* ------------------------------ */
 
 		swR0Index = pswParameters[0];	/* R0 Index */
-		pswVq[0] = pswParameters[1];	/* LPC1 */
-		pswVq[1] = pswParameters[2];	/* LPC2 */
-		pswVq[2] = pswParameters[3];	/* LPC3 */
-		swSi = 1;	/* INT_LPC */
-		swVoicingMode = 0;	/* MODE */
+		st->pswVq[0] = pswParameters[1];	/* LPC1 */
+		st->pswVq[1] = pswParameters[2];	/* LPC2 */
+		st->pswVq[2] = pswParameters[3];	/* LPC3 */
+		st->swSi = 1;	/* INT_LPC */
+		st->swVoicingMode = 0;	/* MODE */
 
 		/* bad frame handling in comfort noise insertion mode */
 		/* -------------------------------------------------- */
 
-		if (swDecoMode == CNIFIRSTSID) {	/* first SID frame */
-			swDtxBfiCnt = 0;
-			swDtxMuting = 0;
-			swRxDTXState = CNINTPER - 1;
+		if (st->swDecoMode == CNIFIRSTSID) {	/* first SID frame */
+			st->swDtxBfiCnt = 0;
+			st->swDtxMuting = 0;
+			st->swRxDTXState = CNINTPER - 1;
 
 			if (swFrameType == VALIDSID) {	/* valid SID frame */
-				swR0NewCN = psrR0DecTbl[swR0Index * 2];
-				lookupVq(pswVq, pswFrmKs);
+				st->swR0NewCN = psrR0DecTbl[swR0Index * 2];
+				lookupVq(st->pswVq, pswFrmKs);
 			} else if (swFrameType == INVALIDSID) {	/* invalid SID frame */
-				swR0NewCN = psrR0DecTbl[swOldR0IndexDec * 2];
-				swR0Index = swOldR0IndexDec;
+				st->swR0NewCN = psrR0DecTbl[st->swOldR0IndexDec * 2];
+				swR0Index = st->swOldR0IndexDec;
 				for (i = 0; i < NP; i++)
-					pswFrmKs[i] = pswOldFrmKsDec[i];
+					pswFrmKs[i] = st->pswOldFrmKsDec[i];
 			}
 
-		} else if (swDecoMode == CNICONT) {	/* SID frame detected, but *//* not the first SID       */
-			swDtxBfiCnt = 0;
-			swDtxMuting = 0;
+		} else if (st->swDecoMode == CNICONT) {	/* SID frame detected, but *//* not the first SID       */
+			st->swDtxBfiCnt = 0;
+			st->swDtxMuting = 0;
 
 			if (swFrameType == VALIDSID) {	/* valid SID frame */
-				swRxDTXState = 0;
-				swR0NewCN = psrR0DecTbl[swR0Index * 2];
-				lookupVq(pswVq, pswFrmKs);
+				st->swRxDTXState = 0;
+				st->swR0NewCN = psrR0DecTbl[swR0Index * 2];
+				lookupVq(st->pswVq, pswFrmKs);
 			} else if (swFrameType == INVALIDSID) {	/* invalid SID frame */
-				if (swRxDTXState < (CNINTPER - 1))
-					swRxDTXState = add(swRxDTXState, 1);
-				swR0Index = swOldR0IndexDec;
+				if (st->swRxDTXState < (CNINTPER - 1))
+					st->swRxDTXState = add(st->swRxDTXState, 1);
+				swR0Index = st->swOldR0IndexDec;
 			}
 
-		} else if (swDecoMode == CNIBFI) {	/* bad frame received in *//* CNI mode              */
-			if (swRxDTXState < (CNINTPER - 1))
-				swRxDTXState = add(swRxDTXState, 1);
-			swR0Index = swOldR0IndexDec;
+		} else if (st->swDecoMode == CNIBFI) {	/* bad frame received in *//* CNI mode              */
+			if (st->swRxDTXState < (CNINTPER - 1))
+				st->swRxDTXState = add(st->swRxDTXState, 1);
+			swR0Index = st->swOldR0IndexDec;
 
-			if (swDtxMuting == 1) {
-				swOldR0IndexDec = sub(swOldR0IndexDec, 2);	/* attenuate
+			if (st->swDtxMuting == 1) {
+				st->swOldR0IndexDec = sub(st->swOldR0IndexDec, 2);	/* attenuate
 										 * by 4 dB */
-				if (swOldR0IndexDec < 0)
-					swOldR0IndexDec = 0;
+				if (st->swOldR0IndexDec < 0)
+					st->swOldR0IndexDec = 0;
 
-				swR0Index = swOldR0IndexDec;
+				swR0Index = st->swOldR0IndexDec;
 
-				swR0NewCN = psrR0DecTbl[swOldR0IndexDec * 2];	/* R0 */
+				st->swR0NewCN = psrR0DecTbl[st->swOldR0IndexDec * 2];	/* R0 */
 
 			}
 
-			swDtxBfiCnt = add(swDtxBfiCnt, 1);
-			if ((swTAF == 1) && (swDtxBfiCnt >= (2 * CNINTPER + 1)))	/* 25 */
-				swDtxMuting = 1;
+			st->swDtxBfiCnt = add(st->swDtxBfiCnt, 1);
+			if ((swTAF == 1) && (st->swDtxBfiCnt >= (2 * CNINTPER + 1)))	/* 25 */
+				st->swDtxMuting = 1;
 
 		}
 
-		if (swDecoMode == CNIFIRSTSID) {
+		if (st->swDecoMode == CNIFIRSTSID) {
 
 			/* the first SID frame is received */
 			/* ------------------------------- */
@@ -4640,13 +4715,13 @@ void speechDecoder(int16_t pswParameters[], int16_t pswDecodedSpeechFrame[])
 			/* initialize the decoders pn-generator */
 			/* ------------------------------------ */
 
-			L_RxPNSeed = PN_INIT_SEED;
+			st->L_RxPNSeed = PN_INIT_SEED;
 
 			/* using the stored rx history, generate averaged GS */
 			/* ------------------------------------------------- */
 
-			avgGsHistQntz(pL_RxGsHist, &L_RxDTXGs);
-			swRxDtxGsIndex = gsQuant(L_RxDTXGs, 0);
+			avgGsHistQntz(st->pL_RxGsHist, &L_RxDTXGs);
+			st->swRxDtxGsIndex = gsQuant(L_RxDTXGs, 0);
 
 		}
 
@@ -4656,19 +4731,19 @@ void speechDecoder(int16_t pswParameters[], int16_t pswDecodedSpeechFrame[])
 
 		for (i = 0; i < 4; i++) {
 			/* initialize the GSP0 parameter */
-			pswParameters[(i * 3) + 8] = swRxDtxGsIndex;
+			pswParameters[(i * 3) + 8] = st->swRxDtxGsIndex;
 
 			/* CODE1 */
-			pswParameters[(i * 3) + 6] = getPnBits(7, &L_RxPNSeed);
+			pswParameters[(i * 3) + 6] = getPnBits(7, &st->L_RxPNSeed);
 			/* CODE2 */
-			pswParameters[(i * 3) + 7] = getPnBits(7, &L_RxPNSeed);
+			pswParameters[(i * 3) + 7] = getPnBits(7, &st->L_RxPNSeed);
 		}
 
 		/* Interpolation of CN parameters */
 		/* ------------------------------ */
 
-		rxInterpR0Lpc(pswOldFrmKsDec, pswFrmKs, swRxDTXState,
-			      swDecoMode, swFrameType);
+		rxInterpR0Lpc(st, st->pswOldFrmKsDec, pswFrmKs, st->swRxDTXState,
+			      st->swDecoMode, swFrameType);
 
 	}
 
@@ -4693,54 +4768,55 @@ void speechDecoder(int16_t pswParameters[], int16_t pswDecodedSpeechFrame[])
 	} else {
 
 		for (i = 0; i < NP; i++) {
-			pswFrmKs[i] = pswOldFrmKsDec[i];
-			pswFrmAs[i] = pswOldFrmAsDec[i];
-			pswFrmPFDenom[i] = pswOldFrmPFDenom[i];
-			pswFrmPFNum[i] = pswOldFrmPFNum[i];
+			pswFrmKs[i] = st->pswOldFrmKsDec[i];
+			pswFrmAs[i] = st->pswOldFrmAsDec[i];
+			pswFrmPFDenom[i] = st->pswOldFrmPFDenom[i];
+			pswFrmPFNum[i] = st->pswOldFrmPFNum[i];
 		}
 	}
 
 	/* interpolate, or otherwise get sfrm reflection coefs */
 	/* --------------------------------------------------- */
 
-	getSfrmLpc(swSi, swOldR0Dec, swR0Dec, pswOldFrmKsDec, pswOldFrmAsDec,
-		   pswOldFrmPFNum, pswOldFrmPFDenom, pswFrmKs, pswFrmAs,
+	getSfrmLpc(st->swSi, st->swOldR0Dec, st->swR0Dec,
+		   st->pswOldFrmKsDec, st->pswOldFrmAsDec,
+		   st->pswOldFrmPFNum, st->pswOldFrmPFDenom, pswFrmKs, pswFrmAs,
 		   pswFrmPFNum, pswFrmPFDenom, psnsSqrtRs, ppswSynthAs,
 		   ppswPFNumAs, ppswPFDenomAs);
 
 	/* calculate shift for spectral postfilter */
 	/* --------------------------------------- */
 
-	swEngyRShift = r0BasedEnergyShft(swR0Index);
+	st->swEngyRShift = r0BasedEnergyShft(swR0Index);
 
 	/* ----------------------- */
 	/* do sub-frame processing */
 	/* ----------------------- */
 
-	for (giSfrmCnt = 0; giSfrmCnt < 4; giSfrmCnt++) {
+	for (st->giSfrmCnt = 0; st->giSfrmCnt < 4; st->giSfrmCnt++) {
 
 		/* copy this sub-frame's parameters */
 		/* -------------------------------- */
 
-		if (sub(swVoicingMode, 0) == 0) {	/* unvoiced */
-			psiVselpCw[0] = pswParameters[(giSfrmCnt * 3) + 6];	/* CODE_1 */
-			psiVselpCw[1] = pswParameters[(giSfrmCnt * 3) + 7];	/* CODE_2 */
-			siGsp0Code = pswParameters[(giSfrmCnt * 3) + 8];	/* GSP0 */
+		if (sub(st->swVoicingMode, 0) == 0) {	/* unvoiced */
+			psiVselpCw[0] = pswParameters[(st->giSfrmCnt * 3) + 6];	/* CODE_1 */
+			psiVselpCw[1] = pswParameters[(st->giSfrmCnt * 3) + 7];	/* CODE_2 */
+			siGsp0Code = pswParameters[(st->giSfrmCnt * 3) + 8];	/* GSP0 */
 		} else {	/* voiced */
-			siLagCode = pswParameters[(giSfrmCnt * 3) + 6];	/* LAG */
-			psiVselpCw[0] = pswParameters[(giSfrmCnt * 3) + 7];	/* CODE */
-			siGsp0Code = pswParameters[(giSfrmCnt * 3) + 8];	/* GSP0 */
+			siLagCode = pswParameters[(st->giSfrmCnt * 3) + 6];	/* LAG */
+			psiVselpCw[0] = pswParameters[(st->giSfrmCnt * 3) + 7];	/* CODE */
+			siGsp0Code = pswParameters[(st->giSfrmCnt * 3) + 8];	/* GSP0 */
 		}
 
 		/* for voiced mode, reconstruct the pitch vector */
 		/* --------------------------------------------- */
 
-		if (swVoicingMode) {
+		if (st->swVoicingMode) {
 
 			/* convert delta lag to lag and convert to fractional lag */
 			/* ------------------------------------------------------ */
 
-			swLag = lagDecode(siLagCode);
+			swLag = lagDecode(st, siLagCode);
 
 			/* state followed by out */
 			/* --------------------- */
@@ -4767,7 +4843,7 @@ void speechDecoder(int16_t pswParameters[], int16_t pswDecodedSpeechFrame[])
 		/* x_vec, x_a_vec here named ppswVselpEx[0] and [1] */
 		/* ------------------------------------------------ */
 
-		if (swVoicingMode) {	/* voiced */
+		if (st->swVoicingMode) {	/* voiced */
 
 			siNumBits = C_BITS_V;
 			siVselpCw = psiVselpCw[0];
@@ -4800,29 +4876,29 @@ void speechDecoder(int16_t pswParameters[], int16_t pswDecodedSpeechFrame[])
 		/* ------------------------------------------------------------------ */
 
 		if (swLag) {
-			rs_rr(pswPVec, psnsSqrtRs[giSfrmCnt], &snsRs00);
+			rs_rr(pswPVec, psnsSqrtRs[st->giSfrmCnt], &snsRs00);
 		}
 
-		rs_rrNs(ppswVselpEx[0], psnsSqrtRs[giSfrmCnt], &snsRs11);
+		rs_rrNs(ppswVselpEx[0], psnsSqrtRs[st->giSfrmCnt], &snsRs11);
 
-		if (!swVoicingMode) {
-			rs_rrNs(ppswVselpEx[1], psnsSqrtRs[giSfrmCnt],
+		if (!st->swVoicingMode) {
+			rs_rrNs(ppswVselpEx[1], psnsSqrtRs[st->giSfrmCnt],
 				&snsRs22);
 		}
 
 		/* now implement synthesis - combine the excitations */
 		/* ------------------------------------------------- */
 
-		if (swVoicingMode) {	/* voiced */
+		if (st->swVoicingMode) {	/* voiced */
 
 			/* scale pitch and codebook excitations and get beta */
 			/* ------------------------------------------------- */
 			swSemiBeta = scaleExcite(pswPVec,
-						 pppsrGsp0[swVoicingMode]
+						 pppsrGsp0[st->swVoicingMode]
 						 [siGsp0Code][0], snsRs00,
 						 pswPVec);
 			scaleExcite(ppswVselpEx[0],
-				    pppsrGsp0[swVoicingMode][siGsp0Code][1],
+				    pppsrGsp0[st->swVoicingMode][siGsp0Code][1],
 				    snsRs11, ppswVselpEx[0]);
 
 			/* combine the two scaled excitations */
@@ -4837,10 +4913,10 @@ void speechDecoder(int16_t pswParameters[], int16_t pswDecodedSpeechFrame[])
 			/* -------------------------------------------------------------- */
 			swSemiBeta = 0;
 			scaleExcite(ppswVselpEx[0],
-				    pppsrGsp0[swVoicingMode][siGsp0Code][0],
+				    pppsrGsp0[st->swVoicingMode][siGsp0Code][0],
 				    snsRs11, ppswVselpEx[0]);
 			scaleExcite(ppswVselpEx[1],
-				    pppsrGsp0[swVoicingMode][siGsp0Code][1],
+				    pppsrGsp0[st->swVoicingMode][siGsp0Code][1],
 				    snsRs22, ppswVselpEx[1]);
 
 			/* combine the two scaled excitations */
@@ -4855,7 +4931,7 @@ void speechDecoder(int16_t pswParameters[], int16_t pswDecodedSpeechFrame[])
 		/* --------------------------------------------------------------- */
 
 		for (i = 0; i < LTP_LEN; i++) {
-			pswLtpStateBaseDec[i] = pswLtpStateBaseDec[i + S_LEN];
+			st->pswLtpStateBaseDec[i] = st->pswLtpStateBaseDec[i + S_LEN];
 		}
 
 		/* add the current sub-frames data to the state */
@@ -4869,54 +4945,54 @@ void speechDecoder(int16_t pswParameters[], int16_t pswDecodedSpeechFrame[])
 		/* ----------------------------------------------- */
 
 		pitchPreFilt(pswExcite, siGsp0Code, swLag,
-			     swVoicingMode, swSemiBeta, psnsSqrtRs[giSfrmCnt],
-			     pswPPFExcit, pswPPreState);
+			     st->swVoicingMode, swSemiBeta, psnsSqrtRs[st->giSfrmCnt],
+			     pswPPFExcit, st->pswPPreState);
 
 		/* Concealment on subframe signal level: */
 		/* ------------------------------------- */
-		level_estimator(0, &swLevelMean, &swLevelMax,
-				&pswDecodedSpeechFrame[giSfrmCnt * S_LEN]);
+		level_estimator(st, 0, &swLevelMean, &swLevelMax,
+				&pswDecodedSpeechFrame[st->giSfrmCnt * S_LEN]);
 
-		signal_conceal_sub(pswPPFExcit, ppswSynthAs[giSfrmCnt],
-				   pswSynthFiltState, &pswLtpStateOut[-S_LEN],
-				   &pswPPreState[LTP_LEN - S_LEN], swLevelMean,
-				   swLevelMax, pswParameters[19], swMuteFlagOld,
+		signal_conceal_sub(pswPPFExcit, ppswSynthAs[st->giSfrmCnt],
+				   st->pswSynthFiltState, &pswLtpStateOut[-S_LEN],
+				   &st->pswPPreState[LTP_LEN - S_LEN], swLevelMean,
+				   swLevelMax, pswParameters[19], st->swMuteFlagOld,
 				   &swMuteFlag, swMutePermit);
 
 		/* synthesize the speech through the synthesis filter */
 		/* -------------------------------------------------- */
 
-		lpcIir(pswPPFExcit, ppswSynthAs[giSfrmCnt], pswSynthFiltState,
+		lpcIir(pswPPFExcit, ppswSynthAs[st->giSfrmCnt], st->pswSynthFiltState,
 		       pswSynthFiltOut);
 
 		/* pass reconstructed speech through adaptive spectral postfilter */
 		/* -------------------------------------------------------------- */
 
-		spectralPostFilter(pswSynthFiltOut, ppswPFNumAs[giSfrmCnt],
-				   ppswPFDenomAs[giSfrmCnt],
-				   &pswDecodedSpeechFrame[giSfrmCnt * S_LEN]);
+		spectralPostFilter(st, pswSynthFiltOut, ppswPFNumAs[st->giSfrmCnt],
+				   ppswPFDenomAs[st->giSfrmCnt],
+				   &pswDecodedSpeechFrame[st->giSfrmCnt * S_LEN]);
 
-		level_estimator(1, &swLevelMean, &swLevelMax,
-				&pswDecodedSpeechFrame[giSfrmCnt * S_LEN]);
+		level_estimator(st, 1, &swLevelMean, &swLevelMax,
+				&pswDecodedSpeechFrame[st->giSfrmCnt * S_LEN]);
 
 	}
 
 	/* Save muting information for next frame */
 	/* -------------------------------------- */
-	swMuteFlagOld = swMuteFlag;
+	st->swMuteFlagOld = swMuteFlag;
 
 	/* end of frame processing - save this frame's frame energy,  */
 	/* reflection coefs, direct form coefs, and post filter coefs */
 	/* ---------------------------------------------------------- */
 
-	swOldR0Dec = swR0Dec;
-	swOldR0IndexDec = swR0Index;	/* DTX mode */
+	st->swOldR0Dec = st->swR0Dec;
+	st->swOldR0IndexDec = swR0Index;	/* DTX mode */
 
 	for (i = 0; i < NP; i++) {
-		pswOldFrmKsDec[i] = pswFrmKs[i];
-		pswOldFrmAsDec[i] = pswFrmAs[i];
-		pswOldFrmPFNum[i] = pswFrmPFNum[i];
-		pswOldFrmPFDenom[i] = pswFrmPFDenom[i];
+		st->pswOldFrmKsDec[i] = pswFrmKs[i];
+		st->pswOldFrmAsDec[i] = pswFrmAs[i];
+		st->pswOldFrmPFNum[i] = pswFrmPFNum[i];
+		st->pswOldFrmPFDenom[i] = pswFrmPFDenom[i];
 	}
 }
 
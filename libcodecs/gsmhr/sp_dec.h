@@ -5,14 +5,16 @@
 
 #include "typedefs.h"
 
+struct gsmhr_dec;
+
 /*_________________________________________________________________________
  |                                                                         |
  |                            Function Prototypes                          |
  |_________________________________________________________________________|
 */
 
-void speechDecoder(int16_t pswParameters[],
-		   int16_t pswDecodedSpeechFrame[]);
+void speechDecoder(struct gsmhr_dec *st,
+		   int16_t pswParameters[], int16_t pswDecodedSpeechFrame[]);
 
 void aFlatRcDp(int32_t * pL_R, int16_t * pswRc);
 
@@ -27,6 +27,7 @@
 #include "sp_enc.h"
 #include "host.h"
 #include "vad.h"
+#include "state.h"
 
 /*_________________________________________________________________________
  |                                                                         |
@@ -34,57 +35,16 @@
  |_________________________________________________________________________|
 */
 
-#define CG_INT_MACS       6	/* Number of Multiply-Accumulates in */
-				       /* one interpolation                 */
 #define ASCALE       0x0800
-#define LMAX            142	/* largest lag (integer sense) */
-#define LSMAX           (LMAX+ CG_INT_MACS/2)	/* Lag Search Array Length */
 #define NUM_CLOSED        3	/* Maximum number of lags searched */
 				      /* in closed loop.                 */
 
-#define LPCSTARTINDEX     25	/* Where the LPC analysis window
-				 * starts */
-#define INBUFFSZ          LPCSTARTINDEX + A_LEN	/* Input buffer size  */
 #define NUMSTARTUPSMP     INBUFFSZ - F_LEN	/* Number of samples needed */
 						/* at start up              */
 #define NUMSTARTUPSMP_P1  INBUFFSZ - F_LEN + 1
 #define HPFSHIFT          1	/* no right shifts high pass shifts
 				 * speech */
 
-/*_________________________________________________________________________
- |                                                                         |
- |                     State variables (globals)                           |
- |_________________________________________________________________________|
-*/
-
-int16_t swOldR0;
-int16_t swOldR0Index;
-
-struct NormSw psnsWSfrmEngSpace[2 * N_SUB];
-
-int16_t pswHPFXState[4];
-int16_t pswHPFYState[8];
-int16_t pswOldFrmKs[NP];
-int16_t pswOldFrmAs[NP];
-int16_t pswOldFrmSNWCoefs[NP];
-int16_t pswWgtSpeechSpace[F_LEN + LMAX + CG_INT_MACS / 2];
-
-int16_t pswSpeech[INBUFFSZ];	/* input speech */
-
-int16_t swPtch = 1;
-
-/*_________________________________________________________________________
- |                                                                         |
- |                         Global DTX variables                            |
- |_________________________________________________________________________|
-*/
-
-int16_t swTxGsHistPtr = 0;
-
-int16_t pswCNVSCode1[N_SUB],
-    pswCNVSCode2[N_SUB], pswCNGsp0Code[N_SUB], pswCNLpc[3], swCNR0;
-
-extern int32_t pL_GsHist[];
 extern int32_t ppLr_gsTable[4][32];
 
 /***************************************************************************
@@ -97,6 +57,8 @@ extern int32_t ppLr_gsTable[4][32];
  *
  *   INPUTS:
  *
+ *     st - encoder instance
+ *
  *     pswSpeechIn[0:159] - input speech samples, 160 new samples per frame
  *
  *   OUTPUTS:
@@ -118,31 +80,26 @@ extern int32_t ppLr_gsTable[4][32];
  *
  *************************************************************************/
 
-void speechEncoder(int16_t pswSpeechIn[], int16_t pswFrmCodes[])
+void speechEncoder(struct gsmhr_enc *st,
+		   int16_t pswSpeechIn[], int16_t pswFrmCodes[])
 {
 
 /*_________________________________________________________________________
  |                                                                         |
- |                            Static Variables                             |
+ |                            Automatic Variables                          |
  |_________________________________________________________________________|
 */
 
 	/* 1st point in analysis window */
-	static int16_t *pswLpcStart = &pswSpeech[LPCSTARTINDEX];
+	int16_t *pswLpcStart = &st->pswSpeech[LPCSTARTINDEX];
 
 	/* 1st point of new frame other than 1st */
-	static int16_t *pswNewSpeech = &pswSpeech[NUMSTARTUPSMP];
+	int16_t *pswNewSpeech = &st->pswSpeech[NUMSTARTUPSMP];
 
 	/* sample 0 of weighted speech */
-	static int16_t *pswWgtSpeech = &pswWgtSpeechSpace[LSMAX];
+	int16_t *pswWgtSpeech = &st->pswWgtSpeechSpace[LSMAX];
 
-	static struct NormSw *psnsWSfrmEng = &psnsWSfrmEngSpace[N_SUB];
-
-/*_________________________________________________________________________
- |                                                                         |
- |                            Automatic Variables                          |
- |_________________________________________________________________________|
-*/
+	struct NormSw *psnsWSfrmEng = &st->psnsWSfrmEngSpace[N_SUB];
 
 	int iVoicing,		/* bitAlloc */
 	 iR0,			/* bitAlloc and aflat */
@@ -187,7 +144,7 @@ void speechEncoder(int16_t pswSpeechIn[], int16_t pswFrmCodes[])
 	/* ---------------------------- */
 
 	filt4_2nd(psrHPFCoefs, pswSpeechIn,
-		  pswHPFXState, pswHPFYState, F_LEN, HPFSHIFT);
+		  st->pswHPFXState, st->pswHPFYState, F_LEN, HPFSHIFT);
 
 	/* copy high passed filtered speech into encoder's speech buff */
   /*-------------------------------------------------------------*/
@@ -198,7 +155,8 @@ void speechEncoder(int16_t pswSpeechIn[], int16_t pswFrmCodes[])
 	/* Calculate and quantize LPC coefficients */
 	/* --------------------------------------- */
 
-	aflat(pswLpcStart, &iR0, pswFrmKs, piVq, swPtch, &swVadFlag, &swSP);
+	aflat(st, pswLpcStart, &iR0, pswFrmKs, piVq, st->swPtch,
+	      &swVadFlag, &swSP);
 
 	/* Lookup frame energy r0 */
 	/* ---------------------- */
@@ -214,21 +172,21 @@ void speechEncoder(int16_t pswSpeechIn[], int16_t pswFrmCodes[])
 	} else {
 
 		for (i = 0; i < NP; i++) {
-			pswFrmKs[i] = pswOldFrmKs[i];
-			pswFrmAs[i] = pswOldFrmAs[i];
-			pswFrmSNWCoefs[i] = pswOldFrmSNWCoefs[i];
+			pswFrmKs[i] = st->pswOldFrmKs[i];
+			pswFrmAs[i] = st->pswOldFrmAs[i];
+			pswFrmSNWCoefs[i] = st->pswOldFrmSNWCoefs[i];
 		}
 	}
 
 	/* Interpolate, or otherwise get sfrm reflection coefs */
 	/* --------------------------------------------------- */
 
-	getSfrmLpcTx(swOldR0, swR0,
-		     pswOldFrmKs, pswOldFrmAs,
-		     pswOldFrmSNWCoefs,
+	getSfrmLpcTx(st, st->swOldR0, swR0,
+		     st->pswOldFrmKs, st->pswOldFrmAs,
+		     st->pswOldFrmSNWCoefs,
 		     pswFrmKs, pswFrmAs,
 		     pswFrmSNWCoefs,
-		     pswSpeech, &siSi, psnsSqrtRs, ppswSynthAs, ppswSNWCoefAs);
+		     st->pswSpeech, &siSi, psnsSqrtRs, ppswSynthAs, ppswSNWCoefAs);
 
 	/* loose once bitAlloc done */
 	iSi = siSi;
@@ -236,14 +194,14 @@ void speechEncoder(int16_t pswSpeechIn[], int16_t pswFrmCodes[])
 	/* Weight the entire speech frame */
 	/* ------------------------------ */
 
-	weightSpeechFrame(pswSpeech, ppswSynthAs[0], ppswSNWCoefAs[0],
-			  pswWgtSpeechSpace);
+	weightSpeechFrame(st, st->pswSpeech, ppswSynthAs[0], ppswSNWCoefAs[0],
+			  st->pswWgtSpeechSpace);
 
 	/* Perform open-loop lag search, get harmonic-noise-weighting parameters */
 	/* --------------------------------------------------------------------- */
 
-	openLoopLagSearch(&pswWgtSpeechSpace[LSMAX],
-			  swOldR0Index,
+	openLoopLagSearch(&st->pswWgtSpeechSpace[LSMAX],
+			  st->swOldR0Index,
 			  (int16_t) iR0,
 			  &siUVCode,
 			  pswLagList,
@@ -257,34 +215,34 @@ void speechEncoder(int16_t pswSpeechIn[], int16_t pswFrmCodes[])
 	/* parameter                                    *//* DTX mode */
 	/* -------------------------------------------- *//* DTX mode */
 
-	periodicity_update(pswVadLags, &swPtch);	/* DTX mode */
+	periodicity_update(&st->vad, pswVadLags, &st->swPtch);	/* DTX mode */
 
 	/* Subframe processing loop */
 	/* ------------------------ */
 
 	pswLagListPtr = pswLagList;
 
-	for (giSfrmCnt = 0; giSfrmCnt < N_SUB; giSfrmCnt++) {
+	for (st->giSfrmCnt = 0; st->giSfrmCnt < N_SUB; st->giSfrmCnt++) {
 
 		if (swSP == 0) {	/* DTX mode *//* DTX mode */
-			pswVSCode1[giSfrmCnt] = pswCNVSCode1[giSfrmCnt];	/* DTX mode */
-			pswVSCode2[giSfrmCnt] = pswCNVSCode2[giSfrmCnt];	/* DTX mode */
-			pswGsp0Code[giSfrmCnt] = pswCNGsp0Code[giSfrmCnt];	/* DTX mode */
+			pswVSCode1[st->giSfrmCnt] = st->pswCNVSCode1[st->giSfrmCnt];	/* DTX mode */
+			pswVSCode2[st->giSfrmCnt] = st->pswCNVSCode2[st->giSfrmCnt];	/* DTX mode */
+			pswGsp0Code[st->giSfrmCnt] = st->pswCNGsp0Code[st->giSfrmCnt];	/* DTX mode */
 		}
 		/* DTX mode */
-		sfrmAnalysis(&pswWgtSpeech[giSfrmCnt * S_LEN],
+		sfrmAnalysis(st, &pswWgtSpeech[st->giSfrmCnt * S_LEN],
 			     siUVCode,
-			     psnsSqrtRs[giSfrmCnt],
-			     ppswSNWCoefAs[giSfrmCnt],
+			     psnsSqrtRs[st->giSfrmCnt],
+			     ppswSNWCoefAs[st->giSfrmCnt],
 			     pswLagListPtr,
-			     pswNumLagList[giSfrmCnt],
-			     pswPitchBuf[giSfrmCnt],
-			     pswHNWCoefBuf[giSfrmCnt],
-			     &pswLagCode[giSfrmCnt], &pswVSCode1[giSfrmCnt],
-			     &pswVSCode2[giSfrmCnt], &pswGsp0Code[giSfrmCnt],
+			     pswNumLagList[st->giSfrmCnt],
+			     pswPitchBuf[st->giSfrmCnt],
+			     pswHNWCoefBuf[st->giSfrmCnt],
+			     &pswLagCode[st->giSfrmCnt], &pswVSCode1[st->giSfrmCnt],
+			     &pswVSCode2[st->giSfrmCnt], &pswGsp0Code[st->giSfrmCnt],
 			     swSP);
 
-		pswLagListPtr = &pswLagListPtr[pswNumLagList[giSfrmCnt]];
+		pswLagListPtr = &pswLagListPtr[pswNumLagList[st->giSfrmCnt]];
 
 	}
 
@@ -297,9 +255,9 @@ void speechEncoder(int16_t pswSpeechIn[], int16_t pswFrmCodes[])
 		/* copy comfort noise frame parameter *//* DTX mode */
 		/* ---------------------------------- *//* DTX mode */
 
-		iR0 = swCNR0;	/* quantized R0 index *//* DTX mode */
+		iR0 = st->swCNR0;	/* quantized R0 index *//* DTX mode */
 		for (i = 0; i < 3; i++)	/* DTX mode */
-			piVq[i] = pswCNLpc[i];	/* DTX mode */
+			piVq[i] = st->pswCNLpc[i];	/* DTX mode */
 
 	} /* DTX mode */
 	else {			/* DTX mode */
@@ -309,11 +267,11 @@ void speechEncoder(int16_t pswSpeechIn[], int16_t pswFrmCodes[])
 		/* ----------------------------------------- *//* DTX mode */
 
 		for (i = 0; i < N_SUB; i++) {	/* DTX mode */
-			pL_GsHist[swTxGsHistPtr] =	/* DTX mode */
+			st->pL_GsHist[st->swTxGsHistPtr] =	/* DTX mode */
 			    ppLr_gsTable[siUVCode][pswGsp0Code[i]];	/* DTX mode */
-			swTxGsHistPtr++;	/* DTX mode */
-			if (swTxGsHistPtr > ((OVERHANG - 1) * N_SUB) - 1)	/* DTX mode */
-				swTxGsHistPtr = 0;	/* DTX mode */
+			st->swTxGsHistPtr++;	/* DTX mode */
+			if (st->swTxGsHistPtr > ((OVERHANG - 1) * N_SUB) - 1)	/* DTX mode */
+				st->swTxGsHistPtr = 0;	/* DTX mode */
 		}		/* DTX mode */
 
 	}			/* DTX mode */
@@ -328,13 +286,13 @@ void speechEncoder(int16_t pswSpeechIn[], int16_t pswFrmCodes[])
 		piGsp0Code[i] = pswGsp0Code[i];
 	}
 
-	swOldR0Index = (int16_t) iR0;
-	swOldR0 = swR0;
+	st->swOldR0Index = (int16_t) iR0;
+	st->swOldR0 = swR0;
 
 	for (i = 0; i < NP; i++) {
-		pswOldFrmKs[i] = pswFrmKs[i];
-		pswOldFrmAs[i] = pswFrmAs[i];
-		pswOldFrmSNWCoefs[i] = pswFrmSNWCoefs[i];
+		st->pswOldFrmKs[i] = pswFrmKs[i];
+		st->pswOldFrmAs[i] = pswFrmAs[i];
+		st->pswOldFrmSNWCoefs[i] = pswFrmSNWCoefs[i];
 	}
 
 	/* Insert SID Codeword *//* DTX mode */
@@ -364,6 +322,6 @@ void speechEncoder(int16_t pswSpeechIn[], int16_t pswFrmCodes[])
   /*-----------------------------------*/
 
 	for (i = 0, j = F_LEN; j < INBUFFSZ; i++, j++) {
-		pswSpeech[i] = pswSpeech[j];
+		st->pswSpeech[i] = st->pswSpeech[j];
 	}
 }
@@ -5,12 +5,15 @@
 
 #include "typedefs.h"
 
+struct gsmhr_enc;
+
 /*_________________________________________________________________________
  |                                                                         |
  |                           Function Prototypes                           |
  |_________________________________________________________________________|
 */
 
-void speechEncoder(int16_t pswSpeechIn[], int16_t pswFrmCodes[]);
+void speechEncoder(struct gsmhr_enc *st,
+		   int16_t pswSpeechIn[], int16_t pswFrmCodes[]);
 
 #endif
@@ -48,6 +48,7 @@
  *
  *     Open loop lag search:
  *       openLoopLagSearch()
+ *         corrNoSat()
  *         bestDelta()
  *           maxCCOverGWithSign()
  *         getCCThreshold()
@@ -76,6 +77,7 @@
 #include "sp_sfrm.h"
 #include "vad.h"
 #include "dtx.h"
+#include "state.h"
 #include <ophtools.h>
 
 /*_________________________________________________________________________
@@ -86,7 +88,6 @@
 
 #define ASCALE  0x0800
 #define ASHIFT 4
-#define CG_INT_MACS     6
 #define CG_TERMS        (LSMAX - LSMIN + 1)
 #define CVSHIFT 2		/* Number of right shifts to be
 				 * applied to the normalized Phi
@@ -99,13 +100,11 @@
 #define HIGH 1
 #define INV_OS_FCTR     0x1555	/* 1.0/6.0 */
 #define LAG_TABLE_LEN   (1 << L_BITS)
-#define LMAX            142
 #define LMAX_FR         (LMAX * OS_FCTR)
 #define LMIN            21
 #define LMIN_FR         (LMIN * OS_FCTR)
 #define LOW 0
 #define LPC_VQ_SEG 3
-#define LSMAX           (LMAX + CG_INT_MACS/2)
 #define LSMIN           (LMIN - CG_INT_MACS/2)
 #define LSP_MASK  0xffff
 #define L_BITS          8
@@ -135,36 +134,6 @@
 #define odd(x) (x & 0x0001)	/* This macro will determine if an
 				 * integer is odd */
 
-/*_________________________________________________________________________
- |                                                                         |
- |                         State Variables (globals)                       |
- |_________________________________________________________________________|
-*/
-
-int16_t pswAnalysisState[NP];
-
-int16_t pswWStateNum[NP], pswWStateDenom[NP];
-
-/*_________________________________________________________________________
- |                                                                         |
- |                         Other External Variables                        |
- |_________________________________________________________________________|
-*/
-
-static int16_t *psrTable;	/* points to correct table of
-				 * vectors */
-int iLimit;			/* accessible to all in this file
-				 * and to lpcCorrQntz() in dtx.c */
-static int iLow;		/* the low element in this segment */
-static int iThree;		/* boolean, is this a three element
-				 * vector */
-static int iWordHalfPtr;	/* points to the next byte */
-static int iWordPtr;		/* points to the next word to be
-				 * read */
-
-extern int16_t pswCNVSCode1[],	/* comfort noise parameters */
- pswCNVSCode2[], pswCNGsp0Code[], pswCNLpc[], swCNR0;
-
 /***************************************************************************
  *
  *    FUNCTION NAME: aflat
@@ -181,6 +150,10 @@ extern int16_t pswCNVSCode1[],	/* comfort noise parameters */
  *
  *    INPUT:
  *
+ *        st
+ *                     Encoder instance; VAD, comfort noise and
+ *                     Rc-VQ search state.
+ *
  *        pswSpeechToLpc[0:A_LEN-1]
  *                     A vector of high-pass filtered input speech, from
  *                     which the unquantized reflection coefficients and
@@ -225,7 +198,7 @@ extern int16_t pswCNVSCode1[],	/* comfort noise parameters */
  *
  *************************************************************************/
 
-void aflat(int16_t pswSpeechToLPC[],
+void aflat(struct gsmhr_enc *st, int16_t pswSpeechToLPC[],
 	   int piR0Index[],
 	   int16_t pswFinalRc[],
 	   int piVQCodewds[],
@@ -298,18 +271,18 @@ void aflat(int16_t pswSpeechToLPC[],
 	/*  modified.                                           *//* DTX mode */
 	/* ---------------------------------------------------- *//* DTX mode */
 
-	vad_algorithm(pL_VadAcf, swVadScalAuto, pswVadRc, swPtch,	/* DTX mode */
+	vad_algorithm(&st->vad, pL_VadAcf, swVadScalAuto, pswVadRc, swPtch,	/* DTX mode */
 		      pswVadFlag);
 
 	/* if DTX mode off, then always voice activity *//* DTX mode */
 	/* ------------------------------------------- *//* DTX mode */
-	if (!giDTXon)
+	if (!st->giDTXon)
 		*pswVadFlag = 1;	/* DTX mode */
 
 	/* determination of comfort noise parameters *//* DTX mode */
 	/* ----------------------------------------- *//* DTX mode */
 
-	*pswSP = swComfortNoise(*pswVadFlag,	/* DTX mode */
+	*pswSP = swComfortNoise(st, *pswVadFlag,	/* DTX mode */
 				L_R0,	/* DTX mode */
 				pL_CorrelSeq);	/* DTX mode */
 
@@ -355,24 +328,24 @@ void aflat(int16_t pswSpeechToLPC[],
 			/* do aflat for all vectors in the list */
       /*--------------------------------------*/
 
-			setupPreQ(iSeg, quantList.iRCIndex);	/* set up vector ptrs */
+			setupPreQ(st, iSeg, quantList.iRCIndex);	/* set up vector ptrs */
 
 			for (iCnt = 0; iCnt < quantList.iNum; iCnt++) {
 				/* get a vector */
 	/*--------------*/
 
-				getNextVec(pswRc);
+				getNextVec(st, pswRc);
 
 				/* clear the limiter flag */
 	/*------------------------*/
 
-				iLimit = 0;
+				st->iLimit = 0;
 
 				/* find the error values for each vector */
 	/*---------------------------------------*/
 
 				quantList.pswPredErr[iCnt] =
-				    aflatRecursion(&pswRc
+				    aflatRecursion(st, &pswRc
 						   [psvqIndex[iSeg - 1].l],
 						   pswPBar, pswVBar, ppswPAddrs,
 						   ppswVAddrs,
@@ -381,7 +354,7 @@ void aflat(int16_t pswSpeechToLPC[],
 				/* check the limiter flag */
 	/*------------------------*/
 
-				if (iLimit) {
+				if (st->iLimit) {
 					quantList.pswPredErr[iCnt] = 0x7fff;	/* set error to bad value */
 				}
 
@@ -402,7 +375,7 @@ void aflat(int16_t pswSpeechToLPC[],
 				    bestPql[iVec].iRCIndex * psrQuantSz[iSeg -
 									1];
 
-				setupQuant(iSeg, quantList.iRCIndex);	/* set up vector ptrs */
+				setupQuant(st, iSeg, quantList.iRCIndex);	/* set up vector ptrs */
 
 				/* do aflat recursion on each element of list */
 	/*--------------------------------------------*/
@@ -412,18 +385,18 @@ void aflat(int16_t pswSpeechToLPC[],
 					/* get a vector */
 	  /*--------------*/
 
-					getNextVec(pswRc);
+					getNextVec(st, pswRc);
 
 					/* clear the limiter flag */
 	  /*------------------------*/
 
-					iLimit = 0;
+					st->iLimit = 0;
 
 					/* find the error values for each vector */
 	  /*---------------------------------------*/
 
 					quantList.pswPredErr[iCnt] =
-					    aflatRecursion(&pswRc
+					    aflatRecursion(st, &pswRc
 							   [psvqIndex[iSeg - 1].
 							    l], pswPBar,
 							   pswVBar, ppswPAddrs,
@@ -434,7 +407,7 @@ void aflat(int16_t pswSpeechToLPC[],
 					/* check the limiter flag */
 	  /*------------------------*/
 
-					if (iLimit) {
+					if (st->iLimit) {
 						quantList.pswPredErr[iCnt] = 0x7fff;	/* set error to the worst
 											 * value */
 					}
@@ -458,8 +431,8 @@ void aflat(int16_t pswSpeechToLPC[],
 			/* find the quantized reflection coefficients */
       /*--------------------------------------------*/
 
-			setupQuant(iSeg, bestQl[iSeg].iRCIndex);	/* set up vector ptrs */
-			getNextVec((int16_t *) (pswFinalRc - 1));
+			setupQuant(st, iSeg, bestQl[iSeg].iRCIndex);	/* set up vector ptrs */
+			getNextVec(st, (int16_t *) (pswFinalRc - 1));
 
 			/* Update pBarFull and vBarFull for the next Rc-VQ segment, and */
 			/* update the pswPBar and pswVBar for the next Rc-VQ segment    */
@@ -767,6 +740,9 @@ void aflatNewBarRecursionL(int16_t pswQntRc[], int iSegment,
  *              This is an implementation of equations 4.18 to 4.23.
  *    INPUTS:
  *
+ *        st
+ *                     Encoder instance, iLimit is set on overflow.
+ *
  *        pswQntRc[0:NP_AFLAT-1]
  *                     An input reflection coefficient vector from the
  *                     Rc-prequantizer or the Rc-VQ codebook.
@@ -824,7 +800,7 @@ void aflatNewBarRecursionL(int16_t pswQntRc[], int iSegment,
  *
  *************************************************************************/
 
-int16_t aflatRecursion(int16_t pswQntRc[],
+int16_t aflatRecursion(struct gsmhr_enc *st, int16_t pswQntRc[],
 			 int16_t pswPBar[],
 			 int16_t pswVBar[],
 			 int16_t * ppswPAddrs[],
@@ -895,7 +871,7 @@ int16_t aflatRecursion(int16_t pswQntRc[],
     /*-----------------------------------------*/
 
 		if (sub(pswPNew[0], 0x4000) >= 0)
-			iLimit = 1;
+			st->iLimit = 1;
 
 		/* Compute the new Vsubj(i) */
     /*--------------------------*/
@@ -1361,6 +1337,10 @@ short CGInterpValid(int16_t swFullResLag,
  *
  *   INPUTS:
  *
+ *     st
+ *
+ *                     Encoder instance, holds the analysis filter state.
+ *
  *     pswSpeech[0:159] ( [0:F_LEN-1] )
  *
  *                     Input speech frame (after high-pass filtering).
@@ -1400,7 +1380,7 @@ short CGInterpValid(int16_t swFullResLag,
  *
  **************************************************************************/
 
-short compResidEnergy(int16_t pswSpeech[],
+short compResidEnergy(struct gsmhr_enc *st, int16_t pswSpeech[],
 		      int16_t ppswInterpCoef[][NP],
 		      int16_t pswPreviousCoef[],
 		      int16_t pswCurrentCoef[], struct NormSw psnsSqrtRs[])
@@ -1463,7 +1443,7 @@ short compResidEnergy(int16_t pswSpeech[],
   /*--------------------------------------------------*/
 
 	for (i = 0; i < NP; i++)
-		pswTempState[i] = pswAnalysisState[i];
+		pswTempState[i] = st->pswAnalysisState[i];
 
 	/* Send the speech frame, one subframe at a time, through the analysis */
 	/* filter which is based on interpolated coefficients.  After each     */
@@ -1526,7 +1506,7 @@ short compResidEnergy(int16_t pswSpeech[],
 			break;
 		}
 
-		lpcFir(&pswSpeech[i * S_LEN], pswCoef, pswAnalysisState,
+		lpcFir(&pswSpeech[i * S_LEN], pswCoef, st->pswAnalysisState,
 		       pswResidual);
 
 		if (siOverflowPossible) {
@@ -2094,9 +2074,9 @@ void findBestInQuantList(struct QuantList psqlInList,
 	 * be < (not <= ) current best */
 	for (quantIndex = 0; quantIndex < psqlInList.iNum; quantIndex++) {
 		bstIndex = 0;
-		while (sub(psqlInList.pswPredErr[quantIndex],
-			   psqlBestOutList[bstIndex].pswPredErr[0]) >= 0 &&
-		       bstIndex < iNumVectOut) {
+		while (bstIndex < iNumVectOut &&
+		       sub(psqlInList.pswPredErr[quantIndex],
+			   psqlBestOutList[bstIndex].pswPredErr[0]) >= 0) {
 			bstIndex++;	/* only increments to next upon
 					 * failure to beat "best" */
 		}
@@ -3352,7 +3332,7 @@ void getNWCoefs(int16_t pswACoefs[], int16_t pswHCoefs[])
  *   PURPOSE:
  *     The purpose of this function is to get the next vector in the list.
  *
- *   INPUTS: none
+ *   INPUTS: st, the Rc-VQ search state set up by setupQuant()
  *
  *   OUTPUTS: pswRc
  *
@@ -3394,7 +3374,7 @@ void getNWCoefs(int16_t pswACoefs[], int16_t pswHCoefs[])
  *
  *************************************************************************/
 
-void getNextVec(int16_t pswRc[])
+void getNextVec(struct gsmhr_enc *st, int16_t pswRc[])
 {
 
 /*_________________________________________________________________________
@@ -3409,27 +3389,27 @@ void getNextVec(int16_t pswRc[])
  |                              Executable Code                            |
  |_________________________________________________________________________|
 */
-	i = iLow;
+	i = st->iLow;
 
-	if (iThree) {
+	if (st->iThree) {
 
-		if (iWordHalfPtr == HIGH) {
-			pswRc[i++] = psrSQuant[high(psrTable[iWordPtr])];
-			pswRc[i++] = psrSQuant[low(psrTable[iWordPtr++])];
-			pswRc[i] = psrSQuant[high(psrTable[iWordPtr])];
-			iWordHalfPtr = LOW;
+		if (st->iWordHalfPtr == HIGH) {
+			pswRc[i++] = psrSQuant[high(st->psrTable[st->iWordPtr])];
+			pswRc[i++] = psrSQuant[low(st->psrTable[st->iWordPtr++])];
+			pswRc[i] = psrSQuant[high(st->psrTable[st->iWordPtr])];
+			st->iWordHalfPtr = LOW;
 		} else {
-			pswRc[i++] = psrSQuant[low(psrTable[iWordPtr++])];
-			pswRc[i++] = psrSQuant[high(psrTable[iWordPtr])];
-			pswRc[i] = psrSQuant[low(psrTable[iWordPtr++])];
-			iWordHalfPtr = HIGH;
+			pswRc[i++] = psrSQuant[low(st->psrTable[st->iWordPtr++])];
+			pswRc[i++] = psrSQuant[high(st->psrTable[st->iWordPtr])];
+			pswRc[i] = psrSQuant[low(st->psrTable[st->iWordPtr++])];
+			st->iWordHalfPtr = HIGH;
 		}
 
 	} else {
-		pswRc[i++] = psrSQuant[high(psrTable[iWordPtr])];
-		pswRc[i++] = psrSQuant[low(psrTable[iWordPtr++])];
-		pswRc[i++] = psrSQuant[high(psrTable[iWordPtr])];
-		pswRc[i] = psrSQuant[low(psrTable[iWordPtr++])];
+		pswRc[i++] = psrSQuant[high(st->psrTable[st->iWordPtr])];
+		pswRc[i++] = psrSQuant[low(st->psrTable[st->iWordPtr++])];
+		pswRc[i++] = psrSQuant[high(st->psrTable[st->iWordPtr])];
+		pswRc[i] = psrSQuant[low(st->psrTable[st->iWordPtr++])];
 	}
 }
 
@@ -3444,6 +3424,8 @@ void getNextVec(int16_t pswRc[])
  *       as opposed to those coded and transmitted.
  *
  *    INPUT:
+ *       st - encoder instance
+ *
  *       swPrevR0,swNewR0 - Rq0 for the last frame and for this frame.
  *          These are the decoded values, not the codewords.
  *
@@ -3491,7 +3473,7 @@ void getNextVec(int16_t pswRc[])
  *
  *************************************************************************/
 
-void getSfrmLpcTx(int16_t swPrevR0, int16_t swNewR0,
+void getSfrmLpcTx(struct gsmhr_enc *st, int16_t swPrevR0, int16_t swNewR0,
 /* last frm*/
 		  int16_t pswPrevFrmKs[], int16_t pswPrevFrmAs[],
 		  int16_t pswPrevFrmSNWCoef[],
@@ -3596,7 +3578,7 @@ void getSfrmLpcTx(int16_t swPrevR0, int16_t swNewR0,
 	/* make the decision whether to interpolate (1) or not (0)       */
   /*---------------------------------------------------------------*/
 
-	swSi = compResidEnergy(pswHPFSpeech,
+	swSi = compResidEnergy(st, pswHPFSpeech,
 			       ppswSynthAs, pswPrevFrmAs,
 			       pswNewFrmAs, psnsSqrtRs);
 
@@ -4096,6 +4078,80 @@ int16_t maxCCOverGWithSign(int16_t pswCIn[],
 	return (maxCCGIndex);
 }				/* end of maxCCOverGWithSign */
 
+/***************************************************************************
+ *
+ *   FUNCTION NAME: corrNoSat
+ *
+ *   PURPOSE:
+ *
+ *     Tells whether correlations of windows taken from a buffer can
+ *     saturate when accumulated with L_mac().
+ *
+ *   INPUTS:
+ *
+ *     pswIn[0:siLen-1]
+ *                     the buffer the windows are taken from
+ *
+ *     siLen
+ *                     length of the buffer
+ *
+ *     siWinLen
+ *                     length of each window
+ *
+ *   OUTPUTS:
+ *
+ *     none
+ *
+ *   RETURN VALUE:
+ *
+ *     nonzero if every window of siWinLen samples has an energy (sum of
+ *     squares, not doubled) below 2^30
+ *
+ *   DESCRIPTION:
+ *
+ *     Any partial sum of an L_mac() chain correlating two windows x and y
+ *     is bounded by 2 * sum(|x * y|) <= sum(x * x) + sum(y * y).  With both
+ *     energies below 2^30 no prefix of the chain can saturate, and no
+ *     sample can be -0x8000, so the chain equals the plain integer sum
+ *     2 * sum(x * y) bit for bit.  The energies are kept in 64 bits with a
+ *     sliding window.
+ *
+ *   KEYWORDS: correlation, saturation, overflow
+ *
+ *************************************************************************/
+
+int corrNoSat(int16_t pswIn[], short siLen, short siWinLen)
+{
+
+/*_________________________________________________________________________
+ |                                                                         |
+ |                            Automatic Variables                          |
+ |_________________________________________________________________________|
+*/
+
+	int64_t LL_Eng;
+	short i;
+
+/*_________________________________________________________________________
+ |                                                                         |
+ |                              Executable Code                            |
+ |_________________________________________________________________________|
+*/
+
+	LL_Eng = 0;
+	for (i = 0; i < siLen; i++) {
+
+		LL_Eng += pswIn[i] * pswIn[i];
+		if (i >= siWinLen)
+			LL_Eng -= pswIn[i - siWinLen] * pswIn[i - siWinLen];
+
+		if (LL_Eng >= 0x40000000)
+			return (0);
+	}
+
+	return (1);
+}
+
 /***************************************************************************
  *
  *   FUNCTION NAME: openLoopLagSearch
@@ -4216,6 +4272,7 @@ void openLoopLagSearch(int16_t pswWSpeech[],
 	short siNumPeaks, siNumTrajToDo, siPeakIndex, siFIndex;
 	short siNumDelta, siBIndex, siBestTrajIndex = 0;
 	short siLowestSoFar, siLagsSoFar, si1, si2, si3;
+	int iNoSat;
 	struct NormSw snsMax;
 
 	int16_t pswGFrame[G_FRAME_LEN];
@@ -4371,16 +4428,32 @@ void openLoopLagSearch(int16_t pswWSpeech[],
 	/* as in the G buffer.)                                       */
   /*------------------------------------------------------------*/
 
+	/* When no window of the scaled speech is loud enough for an L_mac() */
+	/* chain to saturate, the correlations are plain integer sums which  */
+	/* the compiler can vectorize                                        */
+  /*-------------------------------------------------------------------*/
+
+	iNoSat = corrNoSat(pswScaledWSpeechBuffer, W_F_BUFF_LEN, S_LEN);
+
 	for (i = 0; i < N_SUB; i++) {
 
 		for (j = LSMIN; j <= LSMAX; j++) {
 
 			L_C = 0;
-			for (k = 0; k < S_LEN; k++) {
+			if (iNoSat) {
+				for (k = 0; k < S_LEN; k++)
+					L_C += pswScaledWSpeech[i * S_LEN + k] *
+					    pswScaledWSpeech[i * S_LEN - j + k];
+				L_C *= 2;
+			} else {
+				for (k = 0; k < S_LEN; k++) {
 
-				L_C =
-				    L_mac(L_C, pswScaledWSpeech[i * S_LEN + k],
-					  pswScaledWSpeech[i * S_LEN - j + k]);
+					L_C =
+					    L_mac(L_C,
+						  pswScaledWSpeech[i * S_LEN + k],
+						  pswScaledWSpeech[i * S_LEN -
+								   j + k]);
+				}
 			}
 
 			pswCFrame[i * CG_TERMS + j - LSMIN] = extract_h(L_C);
@@ -5343,7 +5416,7 @@ int16_t r0Quant(int32_t L_UnqntzdR0)
  *
  *   INPUTS: iSeg, iVector
  *
- *   OUTPUTS: None
+ *   OUTPUTS: st, the Rc-VQ search state
  *
  *   RETURN VALUE: none
  *
@@ -5355,7 +5428,7 @@ int16_t r0Quant(int32_t L_UnqntzdR0)
  *
  *************************************************************************/
 
-void setupPreQ(int iSeg, int iVector)
+void setupPreQ(struct gsmhr_enc *st, int iSeg, int iVector)
 {
 
 /*_________________________________________________________________________
@@ -5364,37 +5437,37 @@ void setupPreQ(int iSeg, int iVector)
  |_________________________________________________________________________|
 */
 
-	iLow = psvqIndex[iSeg - 1].l;
-	iThree = ((psvqIndex[iSeg - 1].h - iLow) == 2);
+	st->iLow = psvqIndex[iSeg - 1].l;
+	st->iThree = ((psvqIndex[iSeg - 1].h - st->iLow) == 2);
 
 	switch (iSeg) {
 	case 1:
 		{
-			psrTable = psrPreQ1;
-			iWordPtr = (iVector * 3) >> 1;
+			st->psrTable = psrPreQ1;
+			st->iWordPtr = (iVector * 3) >> 1;
 			if (odd(iVector))
-				iWordHalfPtr = LOW;
+				st->iWordHalfPtr = LOW;
 			else
-				iWordHalfPtr = HIGH;
+				st->iWordHalfPtr = HIGH;
 			break;
 		}
 
 	case 2:
 		{
-			psrTable = psrPreQ2;
-			iWordPtr = (iVector * 3) >> 1;
+			st->psrTable = psrPreQ2;
+			st->iWordPtr = (iVector * 3) >> 1;
 			if (odd(iVector))
-				iWordHalfPtr = LOW;
+				st->iWordHalfPtr = LOW;
 			else
-				iWordHalfPtr = HIGH;
+				st->iWordHalfPtr = HIGH;
 			break;
 		}
 
 	case 3:
 		{
-			psrTable = psrPreQ3;
-			iWordPtr = iVector * 2;
-			iWordHalfPtr = HIGH;
+			st->psrTable = psrPreQ3;
+			st->iWordPtr = iVector * 2;
+			st->iWordHalfPtr = HIGH;
 			break;
 		}
 	}
@@ -5411,7 +5484,7 @@ void setupPreQ(int iSeg, int iVector)
  *
  *   INPUTS: iSeg, iVector
  *
- *   OUTPUTS: None
+ *   OUTPUTS: st, the Rc-VQ search state
  *
  *   RETURN VALUE: none
  *
@@ -5423,7 +5496,7 @@ void setupPreQ(int iSeg, int iVector)
  *
  *************************************************************************/
 
-void setupQuant(int iSeg, int iVector)
+void setupQuant(struct gsmhr_enc *st, int iSeg, int iVector)
 {
 
 /*_________________________________________________________________________
@@ -5432,37 +5505,37 @@ void setupQuant(int iSeg, int iVector)
  |_________________________________________________________________________|
 */
 
-	iLow = psvqIndex[iSeg - 1].l;
-	iThree = ((psvqIndex[iSeg - 1].h - iLow) == 2);
+	st->iLow = psvqIndex[iSeg - 1].l;
+	st->iThree = ((psvqIndex[iSeg - 1].h - st->iLow) == 2);
 
 	switch (iSeg) {
 	case 1:
 		{
-			psrTable = psrQuant1;
-			iWordPtr = (iVector * 3) >> 1;
+			st->psrTable = psrQuant1;
+			st->iWordPtr = (iVector * 3) >> 1;
 			if (odd(iVector))
-				iWordHalfPtr = LOW;
+				st->iWordHalfPtr = LOW;
 			else
-				iWordHalfPtr = HIGH;
+				st->iWordHalfPtr = HIGH;
 			break;
 		}
 
 	case 2:
 		{
-			psrTable = psrQuant2;
-			iWordPtr = (iVector * 3) >> 1;
+			st->psrTable = psrQuant2;
+			st->iWordPtr = (iVector * 3) >> 1;
 			if (odd(iVector))
-				iWordHalfPtr = LOW;
+				st->iWordHalfPtr = LOW;
 			else
-				iWordHalfPtr = HIGH;
+				st->iWordHalfPtr = HIGH;
 			break;
 		}
 
 	case 3:
 		{
-			psrTable = psrQuant3;
-			iWordPtr = iVector * 2;
-			iWordHalfPtr = HIGH;
+			st->psrTable = psrQuant3;
+			st->iWordPtr = iVector * 2;
+			st->iWordHalfPtr = HIGH;
 			break;
 		}
 	}
@@ -5479,6 +5552,10 @@ void setupQuant(int iSeg, int iVector)
  *
  *   INPUTS:
  *
+ *     st
+ *
+ *                     Encoder instance, holds the W(z) filter states.
+ *
  *     pswSpeechFrm[0:F_LEN]
  *
  *                     high pass filtered input speech frame
@@ -5513,7 +5590,7 @@ void setupQuant(int iSeg, int iVector)
  *
  *************************************************************************/
 
-void weightSpeechFrame(int16_t pswSpeechFrm[],
+void weightSpeechFrame(struct gsmhr_enc *st, int16_t pswSpeechFrm[],
 		       int16_t pswWNumSpace[],
 		       int16_t pswWDenomSpace[],
 		       int16_t pswWSpeechBuffBase[])
@@ -5548,11 +5625,11 @@ void weightSpeechFrame(int16_t pswSpeechFrm[],
 
 	for (siI = 0; siI < N_SUB; siI++) {
 		lpcFir(&pswSpeechFrm[siI * S_LEN], &pswWNumSpace[siI * NP],
-		       pswWStateNum, &pswScratch0[siI * S_LEN]);
+		       st->pswWStateNum, &pswScratch0[siI * S_LEN]);
 	}
 
 	for (siI = 0; siI < N_SUB; siI++) {
 		lpcIir(&pswScratch0[siI * S_LEN], &pswWDenomSpace[siI * NP],
-		       pswWStateDenom, &pswWSpeechFrm[siI * S_LEN]);
+		       st->pswWStateDenom, &pswWSpeechFrm[siI * S_LEN]);
 	}
 }
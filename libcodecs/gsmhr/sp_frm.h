@@ -6,6 +6,8 @@
 #include "typedefs.h"
 #include "sp_rom.h"
 
+struct gsmhr_enc;
+
 struct QuantList {
 	/* structure which points to the beginning of a block of candidate vq
 	 * vectors.  It also stores the residual error for each vector. */
@@ -38,7 +40,7 @@ void initPBarVBarL(int32_t pL_PBarFull[],
 void initPBarFullVBarFullL(int32_t pL_CorrelSeq[],
 			   int32_t pL_PBarFull[], int32_t pL_VBarFull[]);
 
-int16_t aflatRecursion(int16_t pswQntRc[],
+int16_t aflatRecursion(struct gsmhr_enc *st, int16_t pswQntRc[],
 			 int16_t pswPBar[],
 			 int16_t pswVBar[],
 			 int16_t * ppswPAddrs[],
@@ -50,13 +52,13 @@ void aflatNewBarRecursionL(int16_t pswQntRc[],
 			   int32_t pL_VBar[],
 			   int16_t pswPBar[], int16_t pswVBar[]);
 
-void setupPreQ(int iSeg, int iVector);
+void setupPreQ(struct gsmhr_enc *st, int iSeg, int iVector);
 
-void setupQuant(int iSeg, int iVector);
+void setupQuant(struct gsmhr_enc *st, int iSeg, int iVector);
 
-void getNextVec(int16_t pswRc[]);
+void getNextVec(struct gsmhr_enc *st, int16_t pswRc[]);
 
-void aflat(int16_t pswSpeechToLPC[],
+void aflat(struct gsmhr_enc *st, int16_t pswSpeechToLPC[],
 	   int piR0Index[],
 	   int16_t pswFinalRc[],
 	   int piVQCodewds[],
@@ -66,12 +68,13 @@ int16_t fnExp2(int32_t L_Input);
 
 int16_t fnLog2(int32_t L_Input);
 
-void weightSpeechFrame(int16_t pswSpeechFrm[],
+void weightSpeechFrame(struct gsmhr_enc *st, int16_t pswSpeechFrm[],
 		       int16_t pswWNumSpace[],
 		       int16_t pswWDenomSpace[],
 		       int16_t pswWSpeechBuffBase[]);
 
-void getSfrmLpcTx(int16_t swPrevR0, int16_t swNewR0,
+void getSfrmLpcTx(struct gsmhr_enc *st,
+		  int16_t swPrevR0, int16_t swNewR0,
 		  int16_t pswPrevFrmKs[],
 		  int16_t pswPrevFrmAs[],
 		  int16_t pswPrevFrmSNWCoef[],
@@ -88,7 +91,7 @@ short int fnBest_CG(int16_t pswCframe[],
 		    int16_t * pswCmaxSqr,
 		    int16_t * pswGmax, short int siNumPairs);
 
-short compResidEnergy(int16_t pswSpeech[],
+short compResidEnergy(struct gsmhr_enc *st, int16_t pswSpeech[],
 		      int16_t ppswInterpCoef[][NP],
 		      int16_t pswPreviousCoef[],
 		      int16_t pswCurrentCoef[], struct NormSw psnsSqrtRs[]);
@@ -106,6 +109,8 @@ int32_t flat(int16_t pswSpeechIn[],
 	      int16_t pswRc[],
 	      int *piR0Inx, int32_t pL_VadAcf[], int16_t * pswVadScalAuto);
 
+int corrNoSat(int16_t pswIn[], short siLen, short siWinLen);
+
 void openLoopLagSearch(int16_t pswWSpeech[],
 		       int16_t swPrevR0Index,
 		       int16_t swCurrR0Index,
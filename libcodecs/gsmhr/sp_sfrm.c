@@ -39,6 +39,7 @@
 #include "sp_dec.h"
 #include "sp_frm.h"
 #include "sp_sfrm.h"
+#include "state.h"
 
 /*_________________________________________________________________________
  |                                                                         |
@@ -46,7 +47,6 @@
  |_________________________________________________________________________|
 */
 
-#define CG_INT_MACS     6
 #define C_BITS_UV       7
 #define C_BITS_UV_1     C_BITS_UV-1
 #define C_BITS_V        9
@@ -55,23 +55,9 @@
 #define GSP0_NUM        32
 #define GSP0_VECTOR_SIZE      5
 #define GTWEAKMAX       0x5A82	/* sqrt(2)/2 */
-#define LMAX            142
-#define LSMAX           (LMAX + CG_INT_MACS/2)
-#define HNW_BUFF_LEN    LSMAX
 #define LSP_MASK        0xffff
-#define LTP_LEN         147	/* maximum ltp lag */
 #define MAX_CANDIDATE   6	/* maximum number of lag candidates */
 
-/*_________________________________________________________________________
- |                                                                         |
- |                     State variables (globals)                           |
- |_________________________________________________________________________|
-*/
-
-int16_t pswLtpStateBase[LTP_LEN + S_LEN];
-int16_t pswHState[NP];
-int16_t pswHNWState[HNW_BUFF_LEN];
-
 /***************************************************************************
  *
  *   FUNCTION NAME: closedLoopLagSearch
@@ -240,10 +226,10 @@ int closedLoopLagSearch(int16_t pswLagList[], int iNumLags,
 
 	/* find the shift count associated with the largest CC and G */
 	/* ---------------------------------------------------------- */
-	L_ccNorm = L_abs(pL_CCBuf[0]);
-	L_cgNorm = pL_CGBuf[0];
+	L_ccNorm = 0;
+	L_cgNorm = 0;
 
-	for (i = 1; i < iNumLags; i++) {
+	for (i = 0; i < iNumLags; i++) {
 		L_ccNorm |= L_abs(pL_CCBuf[i]);
 		L_cgNorm |= pL_CGBuf[i];
 	}
@@ -1216,6 +1202,10 @@ void hnwFilt(int16_t pswInSample[],
  *
  *   INPUTS:
  *
+ *     st
+ *                     Encoder instance: subframe counter, LTP history and
+ *                     weighting filter states.
+ *
  *     pswWSpeech
  *                     Input weighted speech vector to be matched.
  *
@@ -1347,7 +1337,7 @@ void hnwFilt(int16_t pswInSample[],
  *
  **************************************************************************/
 
-void sfrmAnalysis(int16_t * pswWSpeech,
+void sfrmAnalysis(struct gsmhr_enc *st, int16_t * pswWSpeech,
 		  int16_t swVoicingMode,
 		  struct NormSw snsSqrtRs,
 		  int16_t * pswHCoefs,
@@ -1360,14 +1350,6 @@ void sfrmAnalysis(int16_t * pswWSpeech,
 		  short *psiVSCode2, short *psiGsp0Code, int16_t swSP)
 {
 
-/*_________________________________________________________________________
- |                                                                         |
- |                            Static Variables                             |
- |_________________________________________________________________________|
-*/
-
-	static short siPrevLagCode;
-
 /*_________________________________________________________________________
  |                                                                         |
  |                            Automatic Variables                          |
@@ -1400,7 +1382,7 @@ void sfrmAnalysis(int16_t * pswWSpeech,
 
 	memzero(&snsRs00, sizeof(struct NormSw));
 
-	pswLtpStateOut = pswLtpStateBase + LTP_LEN;
+	pswLtpStateOut = st->pswLtpStateBase + LTP_LEN;
 
 	if (swSP == 1) {	/* DTX mode *//* DTX mode */
 
@@ -1410,7 +1392,7 @@ void sfrmAnalysis(int16_t * pswWSpeech,
 		/* Get the zero-input response of H(z) */
     /*-------------------------------------*/
 
-		lpcZiIir(pswHCoefs, pswHState, pswTempVec);
+		lpcZiIir(pswHCoefs, st->pswHState, pswTempVec);
 
 		/* Subtract the zero-input response of H(z) from W(z)-weighted speech. */
 		/* The result is the vector to match for the adaptive codebook (long-  */
@@ -1466,7 +1448,7 @@ void sfrmAnalysis(int16_t * pswWSpeech,
       /*---------------------------------------------------------------*/
 
 			siCode = closedLoopLagSearch(pswLagList, siNumLags,
-						     pswLtpStateBase, pswHCoefs,
+						     st->pswLtpStateBase, pswHCoefs,
 						     pswWSVec, &swLag,
 						     &swLtpShift);
 
@@ -1476,15 +1458,15 @@ void sfrmAnalysis(int16_t * pswWSpeech,
 
 			if (swVoicingMode > 0) {
 
-				if (giSfrmCnt == 0) {
-					siPrevLagCode = siCode;
+				if (st->giSfrmCnt == 0) {
+					st->siPrevLagCode = siCode;
 					*psiLagCode = siCode;
 				} else {
 
 					*psiLagCode =
-					    add(sub(siCode, siPrevLagCode),
+					    add(sub(siCode, st->siPrevLagCode),
 						DELTA_LEVELS / 2);
-					siPrevLagCode = siCode;
+					st->siPrevLagCode = siCode;
 				}
 			}
 
@@ -1526,7 +1508,7 @@ void sfrmAnalysis(int16_t * pswWSpeech,
 				pswHNWCoefs, siHnwOffset, 1, S_LEN);
 
 			hnwFilt(pswTempVec, pswTempVec,
-				&pswHNWState[HNW_BUFF_LEN - 1], pswHNWCoefs,
+				&st->pswHNWState[HNW_BUFF_LEN - 1], pswHNWCoefs,
 				siHnwOffset, 1, S_LEN);
 
 			for (i = 0; i < S_LEN; i++) {
@@ -1800,14 +1782,14 @@ void sfrmAnalysis(int16_t * pswWSpeech,
   /*----------------------------------------------------------------*/
 
 	for (i = 0; i < HNW_BUFF_LEN - S_LEN; i++)
-		pswHNWState[i] = pswHNWState[i + S_LEN];
+		st->pswHNWState[i] = st->pswHNWState[i + S_LEN];
 
 	/* Second, perform H(z) filter on excitation, output goes into */
 	/* C(z) state                                                  */
   /*-------------------------------------------------------------*/
 
-	lpcIir(pswTempVec, pswHCoefs, pswHState,
-	       &pswHNWState[HNW_BUFF_LEN - S_LEN]);
+	lpcIir(pswTempVec, pswHCoefs, st->pswHState,
+	       &st->pswHNWState[HNW_BUFF_LEN - S_LEN]);
 
 }				/* end of sfrmAnalysis() */
 
@@ -5,6 +5,8 @@
 
 #include "typedefs.h"
 
+struct gsmhr_enc;
+
 /*_________________________________________________________________________
  |                                                                         |
  |                           Function Prototypes                           |
@@ -39,7 +41,7 @@ void hnwFilt(int16_t pswInSample[],
 	     int16_t pswInCoef[],
 	     int iStateOffset, int16_t swZeroState, int iNumSamples);
 
-void sfrmAnalysis(int16_t * pswWSpeech,
+void sfrmAnalysis(struct gsmhr_enc *st, int16_t * pswWSpeech,
 		  int16_t swVoicingMode,
 		  struct NormSw snsSqrtRs,
 		  int16_t * pswHCoefs,
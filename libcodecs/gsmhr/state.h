@@ -0,0 +1,168 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/***************************************************************************
+ *
+ *   File Name:  state.h
+ *
+ *   Purpose:  Defines the encoder, VAD and decoder state of one codec
+ *             instance.  These used to be file scope globals; keeping
+ *             them in an instance lets several coders run side by side.
+ *
+ **************************************************************************/
+
+#ifndef __STATE
+#define __STATE
+
+#include "typedefs.h"
+
+/*_________________________________________________________________________
+ |                                                                         |
+ |                          State buffer sizes                             |
+ |_________________________________________________________________________|
+*/
+
+#define CG_INT_MACS     6	/* Number of multiply-accumulates in
+				 * one interpolation           */
+#define LMAX            142	/* largest lag (integer sense) */
+#define LSMAX           (LMAX + CG_INT_MACS/2)	/* Lag Search Array Length */
+#define HNW_BUFF_LEN    LSMAX
+#define LTP_LEN         147	/* maximum ltp lag */
+#define LPCSTARTINDEX   25	/* where the LPC analysis window
+				 * starts                        */
+#define INBUFFSZ        LPCSTARTINDEX + A_LEN	/* input buffer size */
+
+/*_________________________________________________________________________
+ |                                                                         |
+ |                         Voice activity detector                         |
+ |_________________________________________________________________________|
+*/
+
+struct gsmhr_vad {
+	int16_t pswRvad[9],
+	    swNormRvad,
+	    swPt_sacf,
+	    swPt_sav0,
+	    swE_thvad,
+	    swM_thvad,
+	    swAdaptCount,
+	    swBurstCount, swHangCount, swOldLagCount, swVeryOldLagCount, swOldLag;
+
+	int32_t pL_sacf[27], pL_sav0[36], L_lastdm;
+};
+
+/*_________________________________________________________________________
+ |                                                                         |
+ |                              Speech encoder                             |
+ |_________________________________________________________________________|
+*/
+
+struct gsmhr_enc {
+	int giSfrmCnt;		/* Subframe count: 0,1,2,3 */
+	int giDTXon;		/* DTX mode switched on/off */
+
+	/* sp_enc.c */
+	int16_t swOldR0;
+	int16_t swOldR0Index;
+	struct NormSw psnsWSfrmEngSpace[2 * N_SUB];
+	int16_t pswHPFXState[4];
+	int16_t pswHPFYState[8];
+	int16_t pswOldFrmKs[NP];
+	int16_t pswOldFrmAs[NP];
+	int16_t pswOldFrmSNWCoefs[NP];
+	int16_t pswWgtSpeechSpace[F_LEN + LMAX + CG_INT_MACS / 2];
+	int16_t pswSpeech[INBUFFSZ];	/* input speech */
+	int16_t swPtch;
+
+	/* sp_frm.c */
+	int16_t pswAnalysisState[NP];
+	int16_t pswWStateNum[NP], pswWStateDenom[NP];
+
+	/* vector quantizer search, see setupQuant() */
+	int16_t *psrTable;	/* points to correct table of
+				 * vectors */
+	int iLimit;		/* also read by lpcCorrQntz() in dtx.c */
+	int iLow;		/* the low element in this segment */
+	int iThree;		/* boolean, is this a three element
+				 * vector */
+	int iWordHalfPtr;	/* points to the next byte */
+	int iWordPtr;		/* points to the next word to be
+				 * read */
+
+	/* sp_sfrm.c */
+	int16_t pswLtpStateBase[LTP_LEN + S_LEN];
+	int16_t pswHState[NP];
+	int16_t pswHNWState[HNW_BUFF_LEN];
+	short siPrevLagCode;
+
+	/* transmit DTX and comfort noise */
+	int16_t swTxGsHistPtr;
+	int16_t pswCNVSCode1[N_SUB],
+	    pswCNVSCode2[N_SUB], pswCNGsp0Code[N_SUB], pswCNLpc[3], swCNR0;
+	int16_t swVadFrmCnt;	/* Indicates the number of sequential
+				 * frames where VAD == 0 */
+	short int siUpdPointer;
+	int16_t swNElapsed;
+	int32_t pL_GsHist[N_SUB * (OVERHANG - 1)];
+	int32_t pL_R0Hist[OVERHANG];
+	int32_t ppL_CorrHist[OVERHANG][NP + 1];
+	int16_t swQntRefR0, swRefGsIndex;
+	int piRefVqCodewds[3];
+	int16_t swShortBurst;
+	int32_t L_TxPNSeed;
+
+	struct gsmhr_vad vad;
+};
+
+/*_________________________________________________________________________
+ |                                                                         |
+ |                              Speech decoder                             |
+ |_________________________________________________________________________|
+*/
+
+struct gsmhr_dec {
+	int giSfrmCnt;		/* Subframe count: 0,1,2,3 */
+
+	/* sp_dec.c */
+	int16_t gswPostFiltAgcGain,
+	    gpswPostFiltStateNum[NP],
+	    gpswPostFiltStateDenom[NP],
+	    swPostEmphasisState,
+	    pswSynthFiltState[NP],
+	    pswOldFrmKsDec[NP],
+	    pswOldFrmAsDec[NP],
+	    pswOldFrmPFNum[NP],
+	    pswOldFrmPFDenom[NP],
+	    swOldR0Dec,
+	    pswLtpStateBaseDec[LTP_LEN + S_LEN], pswPPreState[LTP_LEN + S_LEN];
+	int16_t swMuteFlagOld;	/* error concealment */
+	int16_t swLastLag;
+	int16_t pswSythAsSpace[NP * N_SUB],
+	    pswPFNumAsSpace[NP * N_SUB], pswPFDenomAsSpace[NP * N_SUB];
+
+	int16_t swR0Dec;
+	int16_t swVoicingMode,	/* MODE */
+	 pswVq[3],		/* LPC1, LPC2, LPC3 */
+	 swSi,			/* INT_LPC */
+	 swEngyRShift;		/* for use by spectral postfilter */
+
+	/* receive DTX and comfort noise */
+	int16_t swRxDTXState;	/* DTX State at the rx. Modulo */
+	/* counter [0,11].             */
+	int16_t swDecoMode;
+	int16_t swDtxMuting;
+	int16_t swDtxBfiCnt;
+	int16_t swOldR0IndexDec;
+	int16_t swRxGsHistPtr;
+	int32_t pL_RxGsHist[(OVERHANG - 1) * N_SUB];
+	int16_t swR0NewCN;
+	int32_t L_RxPNSeed;
+	int16_t swRxDtxGsIndex;
+	int16_t swR0OldCN;
+	int32_t pL_OldCorrSeq[NP + 1], pL_NewCorrSeq[NP + 1], pL_CorrSeq[NP + 1];
+
+	/* error concealment */
+	int32_t plSubfrEnergyMem[4];
+	int16_t swLevelMem[4], lastR0, pswLastGood[18], swState, swLastFlag;
+};
+
+#endif
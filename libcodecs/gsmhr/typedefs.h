@@ -48,12 +48,4 @@ struct NormSw {			/* normalized int16_t fractional
 #define OVERHANG 8		/* vad parameter */
 #define strStr strStr16
 
-/* global variables */
-/********************/
-
-extern int giFrmCnt;		/* 0,1,2,3,4..... */
-extern int giSfrmCnt;		/* 0,1,2,3 */
-
-extern int giDTXon;		/* DTX Mode on/off */
-
 #endif
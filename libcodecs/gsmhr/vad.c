@@ -20,6 +20,7 @@
 #include "mathhalf.h"
 #include "mathdp31.h"
 #include "vad.h"
+#include "state.h"
 
 /*_________________________________________________________________________
  |                                                                         |
@@ -36,24 +37,6 @@
 #define M_MARGIN 27343
 #define E_MARGIN 27
 
-/*_________________________________________________________________________
- |                                                                         |
- |                            Static Variables                             |
- |_________________________________________________________________________|
-*/
-
-static int16_t
-    pswRvad[9],
-    swNormRvad,
-    swPt_sacf,
-    swPt_sav0,
-    swE_thvad,
-    swM_thvad,
-    swAdaptCount,
-    swBurstCount, swHangCount, swOldLagCount, swVeryOldLagCount, swOldLag;
-
-static int32_t pL_sacf[27], pL_sav0[36], L_lastdm;
-
 /****************************************************************************
  *
  *     FUNCTION:  vad_reset
@@ -64,7 +47,7 @@ static int32_t pL_sacf[27], pL_sav0[36], L_lastdm;
  *
  ***************************************************************************/
 
-void vad_reset(void)
+void vad_reset(struct gsmhr_vad *st)
 {
 
 /*_________________________________________________________________________
@@ -81,26 +64,26 @@ void vad_reset(void)
  |_________________________________________________________________________|
 */
 
-	pswRvad[0] = 24576;
-	swNormRvad = 7;
-	swPt_sacf = 0;
-	swPt_sav0 = 0;
-	L_lastdm = 0;
-	swE_thvad = 21;
-	swM_thvad = 21875;
-	swAdaptCount = 0;
-	swBurstCount = 0;
-	swHangCount = -1;
-	swOldLagCount = 0;
-	swVeryOldLagCount = 0;
-	swOldLag = 21;
+	st->pswRvad[0] = 24576;
+	st->swNormRvad = 7;
+	st->swPt_sacf = 0;
+	st->swPt_sav0 = 0;
+	st->L_lastdm = 0;
+	st->swE_thvad = 21;
+	st->swM_thvad = 21875;
+	st->swAdaptCount = 0;
+	st->swBurstCount = 0;
+	st->swHangCount = -1;
+	st->swOldLagCount = 0;
+	st->swVeryOldLagCount = 0;
+	st->swOldLag = 21;
 
 	for (i = 1; i < 9; i++)
-		pswRvad[i] = 0;
+		st->pswRvad[i] = 0;
 	for (i = 0; i < 27; i++)
-		pL_sacf[i] = 0;
+		st->pL_sacf[i] = 0;
 	for (i = 0; i < 36; i++)
-		pL_sav0[i] = 0;
+		st->pL_sav0[i] = 0;
 
 }
 
@@ -113,7 +96,8 @@ void vad_reset(void)
  *     PURPOSE:   Returns a decision as to whether the current frame being
  *                processed by the speech encoder contains speech or not.
  *
- *     INPUTS:    pL_acf[0..8]  autocorrelation of input signal frame
+ *     INPUTS:    st            VAD state
+ *                pL_acf[0..8]  autocorrelation of input signal frame
  *                swScaleAcf    L_acf scaling factor
  *                pswRc[0..3]   speech encoder reflection coefficients
  *                swPtch        flag to indicate a periodic signal component
@@ -122,7 +106,7 @@ void vad_reset(void)
  *
  ***************************************************************************/
 
-void vad_algorithm(int32_t pL_acf[9],
+void vad_algorithm(struct gsmhr_vad *st, int32_t pL_acf[9],
 		   int16_t swScaleAcf,
 		   int16_t pswRc[4], int16_t swPtch, int16_t * pswVadFlag)
 {
@@ -148,25 +132,28 @@ void vad_algorithm(int32_t pL_acf[9],
 
 	energy_computation
 	    (pL_acf, swScaleAcf,
-	     pswRvad, swNormRvad, &swM_pvad, &swE_pvad, &swM_acf0, &swE_acf0);
+	     st->pswRvad, st->swNormRvad,
+	     &swM_pvad, &swE_pvad, &swM_acf0, &swE_acf0);
 
-	average_acf(pL_acf, swScaleAcf, pL_av0, pL_av1);
+	average_acf(st, pL_acf, swScaleAcf, pL_av0, pL_av1);
 
 	predictor_values(pL_av1, pswRav1, &swNormRav1);
 
-	spectral_comparison(pswRav1, swNormRav1, pL_av0, &swStat);
+	spectral_comparison(st, pswRav1, swNormRav1, pL_av0, &swStat);
 
 	tone_detection(pswRc, &swTone);
 
 	threshold_adaptation
-	    (swStat, swPtch, swTone,
+	    (st, swStat, swPtch, swTone,
 	     pswRav1, swNormRav1,
 	     swM_pvad, swE_pvad,
-	     swM_acf0, swE_acf0, pswRvad, &swNormRvad, &swM_thvad, &swE_thvad);
+	     swM_acf0, swE_acf0, st->pswRvad,
+	     &st->swNormRvad, &st->swM_thvad, &st->swE_thvad);
 
-	vad_decision(swM_pvad, swE_pvad, swM_thvad, swE_thvad, &swVvad);
+	vad_decision(swM_pvad, swE_pvad, st->swM_thvad, st->swE_thvad,
+		     &swVvad);
 
-	vad_hangover(swVvad, pswVadFlag);
+	vad_hangover(st, swVvad, pswVadFlag);
 
 }
 
@@ -271,7 +258,8 @@ void energy_computation(int32_t pL_acf[],
  *
  *     PURPOSE:   Computes the arrays L_av0 [0..8] and L_av1 [0..8].
  *
- *     INPUTS:    pL_acf[0..8]  autocorrelation of input signal frame
+ *     INPUTS:    st            VAD state
+ *                pL_acf[0..8]  autocorrelation of input signal frame
  *                swScaleAcf    L_acf scaling factor
  *
  *     OUTPUTS:   pL_av0[0..8]  ACF averaged over last four frames
@@ -279,7 +267,7 @@ void energy_computation(int32_t pL_acf[],
  *
  ***************************************************************************/
 
-void average_acf(int32_t pL_acf[],
+void average_acf(struct gsmhr_vad *st, int32_t pL_acf[],
 		 int16_t swScaleAcf, int32_t pL_av0[], int32_t pL_av1[])
 {
 
@@ -309,25 +297,25 @@ void average_acf(int32_t pL_acf[],
 
 	for (i = 0; i <= 8; i++) {
 		L_temp = L_shr(pL_acf[i], swScale);
-		pL_av0[i] = L_add(pL_sacf[i], L_temp);
-		pL_av0[i] = L_add(pL_sacf[i + 9], pL_av0[i]);
-		pL_av0[i] = L_add(pL_sacf[i + 18], pL_av0[i]);
-		pL_sacf[swPt_sacf + i] = L_temp;
-		pL_av1[i] = pL_sav0[swPt_sav0 + i];
-		pL_sav0[swPt_sav0 + i] = pL_av0[i];
+		pL_av0[i] = L_add(st->pL_sacf[i], L_temp);
+		pL_av0[i] = L_add(st->pL_sacf[i + 9], pL_av0[i]);
+		pL_av0[i] = L_add(st->pL_sacf[i + 18], pL_av0[i]);
+		st->pL_sacf[st->swPt_sacf + i] = L_temp;
+		pL_av1[i] = st->pL_sav0[st->swPt_sav0 + i];
+		st->pL_sav0[st->swPt_sav0 + i] = pL_av0[i];
 	}
 
   /*** Update the array pointers ***/
 
-	if (swPt_sacf == 18)
-		swPt_sacf = 0;
+	if (st->swPt_sacf == 18)
+		st->swPt_sacf = 0;
 	else
-		swPt_sacf = add(swPt_sacf, 9);
+		st->swPt_sacf = add(st->swPt_sacf, 9);
 
-	if (swPt_sav0 == 27)
-		swPt_sav0 = 0;
+	if (st->swPt_sav0 == 27)
+		st->swPt_sav0 = 0;
 	else
-		swPt_sav0 = add(swPt_sav0, 9);
+		st->swPt_sav0 = add(st->swPt_sav0, 9);
 
 }
 
@@ -581,7 +569,8 @@ void compute_rav1(int16_t pswAav1[],
  *     PURPOSE:   Computes the stat flag needed for the threshold
  *                adaptation decision.
  *
- *     INPUTS:    pswRav1[0..8]   ACF obtained from L_av1
+ *     INPUTS:    st              VAD state
+ *                pswRav1[0..8]   ACF obtained from L_av1
  *                swNormRav1      rav1 scaling factor
  *                pL_av0[0..8]    ACF averaged over last four frames
  *
@@ -589,7 +578,7 @@ void compute_rav1(int16_t pswAav1[],
  *
  ***************************************************************************/
 
-void spectral_comparison(int16_t pswRav1[],
+void spectral_comparison(struct gsmhr_vad *st, int16_t pswRav1[],
 			 int16_t swNormRav1,
 			 int32_t pL_av0[], int16_t * pswStat)
 {
@@ -674,8 +663,8 @@ void spectral_comparison(int16_t pswRav1[],
 
   /*** Compute the difference and save L_dm ***/
 
-	L_temp = L_sub(L_dm, L_lastdm);
-	L_lastdm = L_dm;
+	L_temp = L_sub(L_dm, st->L_lastdm);
+	st->L_lastdm = L_dm;
 
 	if (L_temp < 0L)
 		L_temp = L_negate(L_temp);
@@ -786,7 +775,8 @@ void tone_detection(int16_t pswRc[4], int16_t * pswTone)
  *                present then the noise model rvad and adaptive threshold
  *                thvad are updated.
  *
- *     INPUTS:    swStat        flag to indicate spectral stationarity
+ *     INPUTS:    st            VAD state
+ *                swStat        flag to indicate spectral stationarity
  *                swPtch        flag to indicate a periodic signal component
  *                swTone        flag to indicate a tone signal component
  *                pswRav1[0..8] ACF obtained from l_av1
@@ -803,7 +793,7 @@ void tone_detection(int16_t pswRc[4], int16_t * pswTone)
  *
  ***************************************************************************/
 
-void threshold_adaptation(int16_t swStat,
+void threshold_adaptation(struct gsmhr_vad *st, int16_t swStat,
 			  int16_t swPtch,
 			  int16_t swTone,
 			  int16_t pswRav1[],
@@ -861,14 +851,14 @@ void threshold_adaptation(int16_t swStat,
 		swComp = 1;
 
 	if (swComp == 1) {
-		swAdaptCount = 0;
+		st->swAdaptCount = 0;
 		return;
 	}
 
   /*** Increment adaptcount ***/
 
-	swAdaptCount = add(swAdaptCount, 1);
-	if (swAdaptCount <= 8)
+	st->swAdaptCount = add(st->swAdaptCount, 1);
+	if (st->swAdaptCount <= 8)
 		return;
 
   /*** computation of thvad-(thvad/dec) ***/
@@ -990,7 +980,7 @@ void threshold_adaptation(int16_t swStat,
 
   /*** Set adaptcount to adp + 1 ***/
 
-	swAdaptCount = 9;
+	st->swAdaptCount = 9;
 
 }
 
@@ -1041,13 +1031,15 @@ void vad_decision(int16_t swM_pvad,
  *     PURPOSE:   Computes the final VAD decision for the current frame
  *                being processed.
  *
- *     INPUTS:    swVvad        vad decision before hangover is added
+ *     INPUTS:    st            VAD state
+ *                swVvad        vad decision before hangover is added
  *
  *     OUTPUTS:   pswVadFlag    vad decision after hangover is added
  *
  ***************************************************************************/
 
-void vad_hangover(int16_t swVvad, int16_t * pswVadFlag)
+void vad_hangover(struct gsmhr_vad *st, int16_t swVvad,
+		  int16_t * pswVadFlag)
 {
 
 /*_________________________________________________________________________
@@ -1057,20 +1049,20 @@ void vad_hangover(int16_t swVvad, int16_t * pswVadFlag)
 */
 
 	if (swVvad == 1)
-		swBurstCount = add(swBurstCount, 1);
+		st->swBurstCount = add(st->swBurstCount, 1);
 	else
-		swBurstCount = 0;
+		st->swBurstCount = 0;
 
-	if (swBurstCount >= 3) {
-		swHangCount = 5;
-		swBurstCount = 3;
+	if (st->swBurstCount >= 3) {
+		st->swHangCount = 5;
+		st->swBurstCount = 3;
 	}
 
 	*pswVadFlag = swVvad;
 
-	if (swHangCount >= 0) {
+	if (st->swHangCount >= 0) {
 		*pswVadFlag = 1;
-		swHangCount = sub(swHangCount, 1);
+		st->swHangCount = sub(st->swHangCount, 1);
 	}
 
 }
@@ -1084,13 +1076,15 @@ void vad_hangover(int16_t swVvad, int16_t * pswVadFlag)
  *     PURPOSE:   Computes the ptch flag needed for the threshold
  *                adaptation decision for the next frame.
  *
- *     INPUTS:    pswLags[0..3]    speech encoder long term predictor lags
+ *     INPUTS:    st               VAD state
+ *                pswLags[0..3]    speech encoder long term predictor lags
  *
  *     OUTPUTS:   pswPtch          Boolean voiced / unvoiced decision
  *
  ***************************************************************************/
 
-void periodicity_update(int16_t pswLags[4], int16_t * pswPtch)
+void periodicity_update(struct gsmhr_vad *st, int16_t pswLags[4],
+			int16_t * pswPtch)
 {
 
 /*_________________________________________________________________________
@@ -1116,11 +1110,11 @@ void periodicity_update(int16_t pswLags[4], int16_t * pswPtch)
 	for (i = 0; i <= 3; i++) {
     /*** Search the maximum and minimum of consecutive lags ***/
 
-		if (swOldLag > pswLags[i]) {
+		if (st->swOldLag > pswLags[i]) {
 			swMinLag = pswLags[i];
-			swMaxLag = swOldLag;
+			swMaxLag = st->swOldLag;
 		} else {
-			swMinLag = swOldLag;
+			swMinLag = st->swOldLag;
 			swMaxLag = pswLags[i];
 		}
 
@@ -1145,17 +1139,17 @@ void periodicity_update(int16_t pswLags[4], int16_t * pswPtch)
 
     /*** Save the current LTP lag ***/
 
-		swOldLag = pswLags[i];
+		st->swOldLag = pswLags[i];
 	}
 
   /*** Update the veryoldlagcount and oldlagcount ***/
 
-	swVeryOldLagCount = swOldLagCount;
-	swOldLagCount = swLagCount;
+	st->swVeryOldLagCount = st->swOldLagCount;
+	st->swOldLagCount = swLagCount;
 
   /*** Make ptch decision ready for next frame ***/
 
-	swTemp = add(swOldLagCount, swVeryOldLagCount);
+	swTemp = add(st->swOldLagCount, st->swVeryOldLagCount);
 
 	if (swTemp >= 7)
 		*pswPtch = 1;
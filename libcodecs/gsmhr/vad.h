@@ -5,16 +5,19 @@
 
 #include "typedefs.h"
 
+struct gsmhr_vad;
+
 /*_________________________________________________________________________
  |                                                                         |
  |                            Function Prototypes                          |
  |_________________________________________________________________________|
 */
 
-void vad_reset(void);
+void vad_reset(struct gsmhr_vad *st);
 
 void vad_algorithm
-    (int32_t pL_acf[9],
+    (struct gsmhr_vad *st,
+     int32_t pL_acf[9],
      int16_t swScaleAcf,
      int16_t pswRc[4], int16_t swPtch, int16_t * pswVadFlag);
 
@@ -27,7 +30,8 @@ void energy_computation
      int16_t * pswE_pvad, int16_t * pswM_acf0, int16_t * pswE_acf0);
 
 void average_acf
-    (int32_t pL_acf[],
+    (struct gsmhr_vad *st,
+     int32_t pL_acf[],
      int16_t swScaleAcf, int32_t pL_av0[], int32_t pL_av1[]
     );
 
@@ -44,13 +48,15 @@ void compute_rav1
     (int16_t pswAav1[], int16_t pswRav1[], int16_t * pswNormRav1);
 
 void spectral_comparison
-    (int16_t pswRav1[],
+    (struct gsmhr_vad *st,
+     int16_t pswRav1[],
      int16_t swNormRav1, int32_t pL_av0[], int16_t * pswStat);
 
 void tone_detection(int16_t pswRc[4], int16_t * pswTone);
 
 void threshold_adaptation
-    (int16_t swStat,
+    (struct gsmhr_vad *st,
+     int16_t swStat,
      int16_t swPtch,
      int16_t swTone,
      int16_t pswRav1[],
@@ -67,8 +73,10 @@ void vad_decision
      int16_t swE_pvad,
      int16_t swM_thvad, int16_t swE_thvad, int16_t * pswVvad);
 
-void vad_hangover(int16_t swVvad, int16_t * pswVadFlag);
+void vad_hangover(struct gsmhr_vad *st, int16_t swVvad,
+		  int16_t * pswVadFlag);
 
-void periodicity_update(int16_t pswLags[4], int16_t * pswPtch);
+void periodicity_update(struct gsmhr_vad *st, int16_t pswLags[4],
+			int16_t * pswPtch);
 
 #endif
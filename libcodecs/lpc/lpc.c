@@ -41,11 +41,12 @@
 
 #define GAIN_ADJUST 0.9
 
-static struct lpcwork {
+/* analyzer instance: windows, pitch filter and voicing history */
+struct lpcwork {
 	float w_s[MAXWINDOW], w_y[MAXWINDOW], w_h[MAXWINDOW], w_w[MAXWINDOW];
-} *work = NULL;
-
-static float fa[6], u, u1, yp1, yp2;
+	float fa[6], u1, yp1, yp2;
+	int vuv;
+};
 
 static void auto_correl(w, n, p, r)
 float *w;
@@ -124,7 +125,8 @@ float *k;
 	}
 }
 
-static void calc_pitch(w, per)
+static void calc_pitch(work, w, per)
+struct lpcwork *work;
 float *w;
 float *per;
 {
@@ -132,7 +134,6 @@ float *per;
 	float d[MAXWINDOW / DOWN], k[PITCHORDER + 1], r[MAXPER + 1], g, rmax;
 	float rval, rm, rp;
 	float a, b, c, x, y;
-	static int vuv = 0;
 
 #ifdef NO_LPC_FIX
 	/* Old decimation sometimes fails to recognise voiced. */
@@ -191,15 +192,15 @@ float *per;
 	}
 #endif
 #ifdef NO_LPC_FIX
-	if (rval >= 0.4 || (vuv == 3 && rval >= 0.3)) {
+	if (rval >= 0.4 || (work->vuv == 3 && rval >= 0.3)) {
 #else
-	if ((rval >= 0.4 || (vuv == 3 && rval >= 0.3)) && (x > 0)) {
+	if ((rval >= 0.4 || (work->vuv == 3 && rval >= 0.3)) && (x > 0)) {
 #endif
 		*per = x;
-		vuv = (vuv & 1) * 2 + 1;
+		work->vuv = (work->vuv & 1) * 2 + 1;
 	} else {
 		*per = 0.0;
-		vuv = (vuv & 1) * 2;
+		work->vuv = (work->vuv & 1) * 2;
 	}
 }
 
@@ -211,46 +212,6 @@ void lpc_init(state)
 lpcstate_t *state;
 {
 	int i;
-	float r, v, w, wcT;
-
-#ifdef HEXDUMP
-	/*  Let's make sure the compiler hasn't inserted
-	   padding in the lpcparams_t structure which will
-	   make it incompatible with other machines.  */
-
-	{
-		lpcparams_t *p = 0;
-
-		if ((&p->gain != ((unsigned char *)2)) ||
-		    (p->k != ((signed char *)4))) {
-			fprintf(stderr,
-				"Alignment problem in lpcparams.h structure.\n");
-			fprintf(stderr,
-				"Add definitions or compiler options in lpc directory\n");
-			fprintf(stderr,
-				"to guarantee this structure is packed.\n");
-		}
-	}
-#endif
-
-	for (i = 0; i < BUFLEN; i++) {
-		s[i] = 0.0;
-		h[i] = WSCALE * (0.54 - 0.46 *
-				 cos(2 * M_PI * i / (BUFLEN - 1.0)));
-	}
-	wcT = 2 * M_PI * FC / FS;
-	r = 0.36891079 * wcT;
-	v = 0.18445539 * wcT;
-	w = 0.92307712 * wcT;
-	fa[1] = -exp(-r);
-	fa[2] = 1.0 + fa[1];
-	fa[3] = -2.0 * exp(-v) * cos(w);
-	fa[4] = exp(-2.0 * v);
-	fa[5] = 1.0 + fa[3] + fa[4];
-
-	u1 = 0.0;
-	yp1 = 0.0;
-	yp2 = 0.0;
 
 	state->Oldper = 0.0;
 	state->OldG = 0.0;
@@ -259,27 +220,30 @@ lpcstate_t *state;
 		state->bp[i] = 0.0;
 	}
 	state->pitchctr = 0;
+	state->seed = 1;
 }
 
-void lpc_analyze(buf, params)
+void lpc_analyze(work, buf, params)
+struct lpcwork *work;
 short *buf;
 lpcparams_t *params;
 {
 	int i, j;
 #define w   work->w_w
 	float r[LPC_FILTORDER + 1];
-	float per, G, k[LPC_FILTORDER + 1];
+	float u, per, G, k[LPC_FILTORDER + 1];
+	float *fa = work->fa;
 
 	for (i = 0, j = BUFLEN - FRAMESIZE; i < FRAMESIZE; i++, j++) {
 		s[j] = (float)(GAIN_ADJUST * ((*buf++) / 32768.));
-		u = fa[2] * s[j] - fa[1] * u1;
-		y[j] = fa[5] * u1 - fa[3] * yp1 - fa[4] * yp2;
-		u1 = u;
-		yp2 = yp1;
-		yp1 = y[j];
+		u = fa[2] * s[j] - fa[1] * work->u1;
+		y[j] = fa[5] * work->u1 - fa[3] * work->yp1 - fa[4] * work->yp2;
+		work->u1 = u;
+		work->yp2 = work->yp1;
+		work->yp1 = y[j];
 	}
 
-	calc_pitch(y, &per);
+	calc_pitch(work, y, &per);
 
 	for (i = 0; i < BUFLEN; i++)
 		w[i] = s[i] * h[i];
@@ -320,10 +284,7 @@ lpcstate_t *state;
 	double k[LPC_FILTORDER + 1], Newk[LPC_FILTORDER + 1],
 	    kinc[LPC_FILTORDER + 1];
 
-	per =
-	    (double)((unsigned short)(((params->period) >> 8) +
-				      ((params->period) << 8))) / 256.;
-	//per = (double) ((unsigned short) ntohs(params->period)) / 256.;
+	per = (double)((unsigned short)ntohs(params->period)) / 256.;
 	G = (double)params->gain / 256.;
 	k[0] = 0.0;
 	for (i = 0; i < LPC_FILTORDER; i++)
@@ -355,7 +316,8 @@ lpcstate_t *state;
 #ifdef NO_LPC_FIX
 			u = ((double)random() / 2147483648.0) * NewG;
 #else
-			u = ((rand() / (1.0 + RAND_MAX)) - 0.5) * 1.5874 * NewG;
+			state->seed = state->seed * 1103515245 + 12345;
+			u = ((((state->seed >> 16) & 0x7fff) / 32768.0) - 0.5) * 1.5874 * NewG;
 #endif
 		} else {
 			if (state->pitchctr == 0) {
@@ -400,22 +362,66 @@ lpcstate_t *state;
 		state->Oldk[i] = k[i];
 }
 
-/*  LPC_START  --  Allocate working storage for LPC coder.  */
+/*  LPC_START  --  Allocate and reset analyzer instance.  */
 
-int lpc_start()
+struct lpcwork *lpc_start()
 {
-	if (work == NULL) {
-		work = (struct lpcwork *)malloc(sizeof(struct lpcwork));
+	struct lpcwork *work;
+	int i;
+	float r, v, w, wcT;
+
+	work = (struct lpcwork *)malloc(sizeof(struct lpcwork));
+	if (work == NULL)
+		return NULL;
+
+#ifdef HEXDUMP
+	/*  Let's make sure the compiler hasn't inserted
+	   padding in the lpcparams_t structure which will
+	   make it incompatible with other machines.  */
+
+	{
+		lpcparams_t *p = 0;
+
+		if ((&p->gain != ((unsigned char *)2)) ||
+		    (p->k != ((signed char *)4))) {
+			fprintf(stderr,
+				"Alignment problem in lpcparams.h structure.\n");
+			fprintf(stderr,
+				"Add definitions or compiler options in lpc directory\n");
+			fprintf(stderr,
+				"to guarantee this structure is packed.\n");
+		}
+	}
+#endif
+
+	for (i = 0; i < BUFLEN; i++) {
+		s[i] = 0.0;
+		y[i] = 0.0;
+		h[i] = WSCALE * (0.54 - 0.46 *
+				 cos(2 * M_PI * i / (BUFLEN - 1.0)));
 	}
-	return work != NULL;
+	wcT = 2 * M_PI * FC / FS;
+	r = 0.36891079 * wcT;
+	v = 0.18445539 * wcT;
+	w = 0.92307712 * wcT;
+	work->fa[0] = 0.0;
+	work->fa[1] = -exp(-r);
+	work->fa[2] = 1.0 + work->fa[1];
+	work->fa[3] = -2.0 * exp(-v) * cos(w);
+	work->fa[4] = exp(-2.0 * v);
+	work->fa[5] = 1.0 + work->fa[3] + work->fa[4];
+
+	work->u1 = 0.0;
+	work->yp1 = 0.0;
+	work->yp2 = 0.0;
+	work->vuv = 0;
+	return work;
 }
 
-/*  LPC_END  --  Release working storage for LPC coder.  */
+/*  LPC_END  --  Release analyzer instance.  */
 
-void lpc_end()
+void lpc_end(work)
+struct lpcwork *work;
 {
-	if (work != NULL) {
-		free(work);
-		work = NULL;
-	}
+	free(work);
 }
@@ -28,10 +28,14 @@ typedef struct {
 typedef struct {
 	double Oldper, OldG, Oldk[LPC_FILTORDER + 1], bp[LPC_FILTORDER + 1];
 	int pitchctr;
+	unsigned int seed;	/* noise excitation generator */
 } lpcstate_t;
 
-int lpc_start( /*void */ );
+/* analyzer instance (created by lpc_start) */
+struct lpcwork;
+
+struct lpcwork *lpc_start( /*void */ );
 void lpc_init( /*lpcstate_t* state */ );
-void lpc_analyze( /*short *buf, lpcparams_t *params */ );
+void lpc_analyze( /*struct lpcwork *work, short *buf, lpcparams_t *params */ );
 void lpc_synthesize( /*short *buf, lpcparams_t *params, lpcstate_t* state */ );
-void lpc_end( /*void */ );
+void lpc_end( /*struct lpcwork *work */ );
@@ -29,6 +29,7 @@
 #include "dsp_sub.h"
 #include "coeff.h"
 #include "melp_sub.h"
+#include "state.h"
 
 #define PITCH_RANGE				5
 #define SQRT_PIT_SUBFRAME_Q11	19429	/* sqrt(PIT_SUBFRAME) * (1 << 11) */
@@ -36,8 +37,6 @@
 				     /* changed to 1/10 of its floating point */
 					  /* counterpart.  30/10 * (1 << 11). */
 #define TWO_Q11					4096	/* 2 * (1 << 11) */
-#define THREE_Q11				6144	/* 3 * (1 << 11) */
-#define FIVE_Q11				10240	/* 5 * (1 << 11) */
 #define M_TEN_Q11				-20480
 #define X04_Q15					13107	/* 0.4 * (1 << 15) */
 #define X045_Q15				14746	/* 0.45 * (1 << 15) */
@@ -89,12 +88,10 @@ static void frac_cor(int16_t inbuf[], int16_t pitch, int16_t * cor);
 ** Return value:	None
 **
 *****************************************************************************/
-void classify(int16_t inbuf[], classParam * classStat, int16_t autocorr[])
+void classify(struct melpe_enc *st, int16_t inbuf[], classParam * classStat,
+	      int16_t autocorr[])
 {
 	register int16_t i, j;
-	static BOOLEAN firstTime = TRUE;
-	static int16_t bpfdel[BPF_ORD + BPF_ORD / 3];
-	static int16_t back_sigbuf[PIT_COR_LEN - PIT_SUBFRAME];
 	const int16_t *ptr_bpf_num, *ptr_bpf_den;
 	int16_t classy, sum1_shift = 0;
 	int32_t L_sum1, L_sum2;	/* Q0 */
@@ -110,20 +107,13 @@ void classify(int16_t inbuf[], classParam * classStat, int16_t autocorr[])
 	int16_t subEnergyDiff;	/* Q11 */
 	int16_t lowBandCorx;	/* low band pcor moved from classParam, Q15 */
 
-	if (firstTime) {
-		voicedEn = FIVE_Q11;	/* Both voicedEn and silenceEn are 1/10 of */
-		silenceEn = THREE_Q11;	/* their values in floating point version. */
-		voicedCnt = 0;
-		v_zap(bpfdel, BPF_ORD + BPF_ORD / 3);
-	}
-
 	/* The following inline implementation of iir_2nd_s() is for the          */
 	/* complexity reduction.  The memory bpfdel[] plays both the roles for    */
 	/* bpf_delin[] and bpf_delout[] in the past as the output memory for      */
 	/* stage i (bpf_delout[2*i]@2) is the input memory for stage (i+1)        */
 	/* (bpf_delin[2*(i+1)]@2).                                                */
 
-	if (firstTime) {
+	if (st->classify_first) {
 
 		/* The first time we run the 3-stage filters, we have to compute the  */
 		/* whole sequence of length PIT_COR_LEN (220).  After that, every     */
@@ -148,7 +138,7 @@ void classify(int16_t inbuf[], classParam * classStat, int16_t autocorr[])
 		v_equ(&(sigbuf_in[BPF_ORD / 3]),
 		      &(inbuf[(PIT_COR_LEN - PIT_SUBFRAME) / 2]), sigbuf_len);
 		v_equ(&(sigbuf_out[BPF_ORD / 3 - PIT_COR_LEN + PIT_SUBFRAME]),
-		      back_sigbuf, PIT_COR_LEN - PIT_SUBFRAME);
+		      st->back_sigbuf, PIT_COR_LEN - PIT_SUBFRAME);
 	}
 
 	ptr_bpf_num = bpf_num;	/* It will point to bpf_num[3*i] */
@@ -157,8 +147,8 @@ void classify(int16_t inbuf[], classParam * classStat, int16_t autocorr[])
 		/*      iir_2nd_s(&(sigbuf[BPF_ORD/3]), &bpf_den[i*3], &bpf_num[i*3],
 		   &(sigbuf[BPF_ORD/3]), &bpf_delin[i*2], &bpf_delout[i*2],
 		   sigbuf_len); */
-		v_equ(sigbuf_in, &(bpfdel[2 * i]), BPF_ORD / 3);
-		v_equ(sigbuf_out, &(bpfdel[2 * i + 2]), BPF_ORD / 3);
+		v_equ(sigbuf_in, &(st->bpfdel[2 * i]), BPF_ORD / 3);
+		v_equ(sigbuf_out, &(st->bpfdel[2 * i + 2]), BPF_ORD / 3);
 		for (j = BPF_ORD / 3; j < melpe_add(sigbuf_len, BPF_ORD / 3); j++) {
 			L_temp = melpe_L_mult(sigbuf_in[j], ptr_bpf_num[0]);
 			L_temp =
@@ -175,7 +165,7 @@ void classify(int16_t inbuf[], classParam * classStat, int16_t autocorr[])
 
 			sigbuf_out[j] = melpe_r_ound(L_temp);
 		}
-		v_equ(&(bpfdel[2 * i]), &(sigbuf_in[sigbuf_len]), BPF_ORD / 3);
+		v_equ(&(st->bpfdel[2 * i]), &(sigbuf_in[sigbuf_len]), BPF_ORD / 3);
 
 		temp_sigbuf = sigbuf_in;
 		sigbuf_in = sigbuf_out;
@@ -185,15 +175,15 @@ void classify(int16_t inbuf[], classParam * classStat, int16_t autocorr[])
 		ptr_bpf_den += 3;
 	}
 
-	if (firstTime) {
-		firstTime = FALSE;
+	if (st->classify_first) {
+		st->classify_first = FALSE;
 		sigbuf_out = sigbuf_in;	/* The loop is over and we switch it back. */
 	} else
 		sigbuf_out = sigbuf_in - (PIT_COR_LEN - PIT_SUBFRAME);
 
-	v_equ(&(bpfdel[BPF_ORD]), &(sigbuf_out[PIT_COR_LEN]), BPF_ORD / 3);
+	v_equ(&(st->bpfdel[BPF_ORD]), &(sigbuf_out[PIT_COR_LEN]), BPF_ORD / 3);
 
-	v_equ(back_sigbuf, &(sigbuf_out[BPF_ORD / 3 + PIT_SUBFRAME]),
+	v_equ(st->back_sigbuf, &(sigbuf_out[BPF_ORD / 3 + PIT_SUBFRAME]),
 	      PIT_COR_LEN - PIT_SUBFRAME);
 
 	/* Compute subframe energy.  Note that L_sum1 can have a large dynamic    */
@@ -303,8 +293,8 @@ void classify(int16_t inbuf[], classParam * classStat, int16_t autocorr[])
 
 	frac_cor(&(sigbuf_out[BPF_ORD / 3]), classStat->pitch, &lowBandCorx);
 
-	if (silenceEn > melpe_sub(voicedEn, X15_Q11))
-		silenceEn = melpe_sub(voicedEn, X15_Q11);
+	if (st->silenceEn > melpe_sub(st->voicedEn, X15_Q11))
+		st->silenceEn = melpe_sub(st->voicedEn, X15_Q11);
 	/* the noise level is way too high */
 	zeroCrosRateDiff = melpe_sub(classStat->zeroCrosRate, classStat[-1].zeroCrosRate);	/* Q15 */
 	subEnergyDiff = melpe_sub(classStat->subEnergy, classStat[-1].subEnergy);
@@ -314,7 +304,7 @@ void classify(int16_t inbuf[], classParam * classStat, int16_t autocorr[])
 	if (classStat->subEnergy < SILENCE_DB_Q11)
 		classy = SILENCE;
 	else if (classStat->subEnergy <
-		 interp_scalar(voicedEn, silenceEn, X065_Q15)) {
+		 interp_scalar(st->voicedEn, st->silenceEn, X065_Q15)) {
 		/* quite possible it is silence or UNVOICED */
 		/* unless the noise level is very high          */
 		if ((classStat->zeroCrosRate > X06_Q15) &&
@@ -346,7 +336,7 @@ void classify(int16_t inbuf[], classParam * classStat, int16_t autocorr[])
 		    ((lowBandCorx > X03_Q15) && (classStat->corx > X06_Q15)))
 			classy = VOICED;
 		else if (classStat->subEnergy >
-			 interp_scalar(voicedEn, silenceEn, X03_Q15)) {
+			 interp_scalar(st->voicedEn, st->silenceEn, X03_Q15)) {
 			if (classStat->peakiness > X15_Q11)
 				classy = TRANSITION;
 			else
@@ -358,7 +348,7 @@ void classify(int16_t inbuf[], classParam * classStat, int16_t autocorr[])
 		    ((lowBandCorx > X03_Q15) && (classStat->corx > X065_Q15)))
 			classy = VOICED;
 		else if ((classStat->subEnergy <
-			  interp_scalar(voicedEn, silenceEn, X06_Q15)) &&
+			  interp_scalar(st->voicedEn, st->silenceEn, X06_Q15)) &&
 			 (lowhighBandDiff > ONE_Q12))
 			classy = SILENCE;
 		else if (classStat->peakiness > X14_Q11)
@@ -56,6 +56,7 @@ Secretariat fax: +33 493 65 47 16.
 #define TWO_Q3		16	/* 2 * (1 << 3) */
 #define TWO_Q19		1048576L	/* 2 * (1 << 19) */
 #define THREE_Q11	6144	/* 3 * (1 << 11) */
+#define FIVE_Q11	10240	/* 5 * (1 << 11) */
 #define FIFTY_Q0	50	/* 50 * (1 << 0) */
 #define FIFTY_Q7	6400	/* 50 * (1 << 7) */
 #define SIX_Q8		1536	/* 6 * (1 << 8) */
@@ -51,6 +51,7 @@ typedef struct {
 /* ============================ */
 /* Prototypes from "classify.c"	*/
 /* ============================ */
-void classify(int16_t inbuf[], classParam * classStat, int16_t autocorr[]);
+void classify(struct melpe_enc *st, int16_t inbuf[], classParam * classStat,
+	      int16_t autocorr[]);
 
 #endif
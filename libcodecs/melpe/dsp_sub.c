@@ -338,9 +338,10 @@ void quant_u_dec(int16_t index, int16_t * p_data, int16_t qmin,
 }
 
 /* Subroutine rand_num: generate random numbers to fill array using "minimal  */
-/* standard" random number generator.                                         */
+/* standard" random number generator.  *seed is the generator state.          */
 
-void rand_num(int16_t output[], int16_t amplitude, int16_t npts)
+void rand_num(uint32_t * seed, int16_t output[], int16_t amplitude,
+	      int16_t npts)
 {
 	register int16_t i;
 	int16_t temp;
@@ -349,7 +350,7 @@ void rand_num(int16_t output[], int16_t amplitude, int16_t npts)
 
 		/* rand_minstdgen returns 0 <= x < 1 */
 		/* -0.5 <= temp < 0.5 */
-		temp = melpe_sub(rand_minstdgen(), X05_Q15);
+		temp = melpe_sub(rand_minstdgen(seed), X05_Q15);
 		output[i] = melpe_mult(amplitude, melpe_shl(temp, 1));
 	}
 }
@@ -361,13 +362,16 @@ void rand_num(int16_t output[], int16_t amplitude, int16_t npts)
 /*	   This is the "minimal standard" generator from CACM Oct 1988, p. 1192.*/
 /*	   The implementation is based on an algorithm using 2 31-bit registers */
 /*	   to represent the product (A*x), from CACM Jan 1990, p. 87.			*/
+/*	   The generator state x is kept by the caller in *seed.				*/
 /*																			*/
 /****************************************************************************/
 
-int16_t rand_minstdgen()
+int16_t rand_minstdgen(uint32_t * seed)
 {
-	static uint32_t next = 1;	/* seed; must not be zero!!! */
+	uint32_t next = *seed;	/* seed; must not be zero!!! */
+#if OVERFLOW_CHECK
 	int32_t old_saturation;
+#endif
 	uint16_t x0 = melpe_extract_l(next);	/* 16 LSBs OF SEED */
 	uint16_t x1 = melpe_extract_h(next);	/* 16 MSBs OF SEED */
 	uint32_t p, q;		/* MSW, LSW OF PRODUCT */
@@ -384,10 +388,12 @@ int16_t rand_minstdgen()
 	/* WHERE C = q[31] (CARRY BIT FROM q).  NOTE THAT BECAUSE A < 2^15,     */
 	/* (A * x0)[31] IS ALWAYS 0.                                            */
 	/*----------------------------------------------------------------------*/
+#if OVERFLOW_CHECK
 	/* save and reset saturation count                                      */
 
 	old_saturation = saturation;
 	saturation = 0;
+#endif
 
 	/* q = ((A * x1) << 17 >> 1) + (A * x0); */
 	/* p = ((A * x1) >> 15) + (q >> 31); */
@@ -423,9 +429,12 @@ int16_t rand_minstdgen()
 	} else
 		L_temp1 = melpe_L_add(p, q);
 	next = L_temp1;
+	*seed = next;
 
+#if OVERFLOW_CHECK
 	/* restore saturation count */
 	saturation = old_saturation;
+#endif
 
 	x1 = melpe_extract_h(next);
 	return (x1);
@@ -546,7 +555,7 @@ void window(int16_t input[], const int16_t win_coeff[], int16_t output[],
 /*    win_coeff - Qin, output = input             */
 /* ============================================== */
 
-void window_Q(int16_t input[], int16_t win_coeff[], int16_t output[],
+void window_Q(int16_t input[], const int16_t win_coeff[], int16_t output[],
 	      int16_t npts, int16_t Qin)
 {
 	register int16_t i;
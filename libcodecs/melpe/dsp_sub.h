@@ -62,9 +62,10 @@ void quant_u(int16_t * p_data, int16_t * p_index, int16_t qmin,
 void quant_u_dec(int16_t index, int16_t * p_data, int16_t qmin,
 		 int16_t qmax, int16_t nlev_q, int16_t scale);
 
-void rand_num(int16_t output[], int16_t amplitude, int16_t npts);
+void rand_num(uint32_t * seed, int16_t output[], int16_t amplitude,
+	      int16_t npts);
 
-int16_t rand_minstdgen();
+int16_t rand_minstdgen(uint32_t * seed);
 
 BOOLEAN unpack_code(unsigned char **ptr_ch_begin, int16_t * ptr_ch_bit,
 		    int16_t * code, int16_t numbits, int16_t wsize,
@@ -73,7 +74,7 @@ BOOLEAN unpack_code(unsigned char **ptr_ch_begin, int16_t * ptr_ch_bit,
 void window(int16_t input[], const int16_t win_coeff[],
 	    int16_t output[], int16_t npts);
 
-void window_Q(int16_t input[], int16_t win_coeff[], int16_t output[],
+void window_Q(int16_t input[], const int16_t win_coeff[], int16_t output[],
 	      int16_t npts, int16_t Qin);
 
 void zerflt(int16_t input[], const int16_t coeff[], int16_t output[],
@@ -49,10 +49,6 @@ Secretariat fax: +33 493 65 47 16.
 #define BEP_CORR		-1	/* "Correct" bit error position */
 #define BEP_UNCORR		-2	/* "Uncorrectable" bit error position */
 
-static int16_t codewd74[7];
-static int16_t codewd84[8];
-static int16_t codewd_13x9[13];
-
 /* (7,4) Hamming code tables.  Parity generator matrix. */
 static const int16_t pmat74[3][4] = {
 	{1, 1, 0, 1}, {1, 0, 1, 1}, {0, 1, 1, 1}
@@ -907,6 +903,9 @@ static int16_t crc4_dec(int16_t bit[], int16_t num_bits);
 
 void fec_code(struct quant_param *qpar)
 {
+	int16_t codewd74[7];
+	int16_t codewd84[8];
+
 	/* Increment pitch index to allow for unvoiced pitch code */
 	qpar->pitch_index++;
 
@@ -954,6 +953,10 @@ void fec_code(struct quant_param *qpar)
 
 void low_rate_fec_code(struct quant_param *par)
 {
+	int16_t codewd74[7];
+	int16_t codewd84[8];
+	int16_t codewd_13x9[13];
+
 	if (par->uv_flag[0] && par->uv_flag[1] && par->uv_flag[2]) {
 
 		/* for 4 MSB of Gain */
@@ -993,6 +996,8 @@ void low_rate_fec_code(struct quant_param *par)
 int16_t fec_decode(struct quant_param *qpar, int16_t erase)
 {
 	int16_t berr_pos;
+	int16_t codewd74[7];
+	int16_t codewd84[8];
 
 	/* Decode pitch index */
 	qpar->pitch_index = pitch_dec[qpar->pitch_index];
@@ -1063,6 +1068,9 @@ int16_t low_rate_fec_decode(struct quant_param * qpar, int16_t erase,
 			      int16_t lsp_check[])
 {
 	int16_t berr_pos;
+	int16_t codewd74[7];
+	int16_t codewd84[8];
+	int16_t codewd_13x9[13];
 
 	if (qpar->uv_flag[0] && qpar->uv_flag[1] && qpar->uv_flag[2]) {
 		/* for 4 MSB of Gain */
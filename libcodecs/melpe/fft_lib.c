@@ -25,9 +25,78 @@
 
 #define SWAP(a, b)		{int16_t temp1; temp1 = (a); (a) = (b); (b) = temp1;}
 
-/* Memory definition */
-static int16_t wr_array[FFTLENGTH / 2];
-static int16_t wi_array[FFTLENGTH / 2];
+/* Twiddle factors, wr_array[i] = cos_fxp(theta) and wi_array[i] =          */
+/* sin_fxp(theta) with theta = 2*i/FFTLENGTH in Q15 (ONE_Q15 for the last   */
+/* entry).  These were computed by fs_init() and are now kept in ROM.       */
+static const int16_t wr_array[FFTLENGTH / 2] = {
+	32767, 32766, 32758, 32746, 32729, 32706, 32679, 32647,
+	32610, 32568, 32522, 32470, 32413, 32352, 32286, 32214,
+	32138, 32058, 31972, 31881, 31786, 31686, 31581, 31471,
+	31357, 31238, 31114, 30986, 30853, 30715, 30572, 30425,
+	30274, 30118, 29957, 29792, 29622, 29448, 29269, 29086,
+	28899, 28707, 28511, 28311, 28106, 27897, 27684, 27467,
+	27246, 27020, 26791, 26557, 26320, 26078, 25833, 25583,
+	25330, 25073, 24812, 24548, 24279, 24008, 23732, 23453,
+	23170, 22884, 22595, 22302, 22006, 21706, 21403, 21097,
+	20788, 20475, 20160, 19841, 19520, 19195, 18868, 18538,
+	18205, 17869, 17531, 17190, 16846, 16500, 16151, 15800,
+	15447, 15091, 14733, 14373, 14010, 13646, 13279, 12910,
+	12540, 12167, 11793, 11417, 11039, 10660, 10279, 9896,
+	9512, 9127, 8740, 8351, 7962, 7571, 7180, 6787,
+	6393, 5998, 5602, 5205, 4808, 4410, 4011, 3612,
+	3212, 2811, 2411, 2009, 1608, 1206, 804, 402,
+	0, -405, -807, -1209, -1611, -2012, -2414, -2814,
+	-3215, -3615, -4014, -4413, -4811, -5208, -5605, -6001,
+	-6396, -6790, -7183, -7574, -7965, -8354, -8743, -9130,
+	-9515, -9898, -10281, -10662, -11041, -11419, -11795, -12169,
+	-12542, -12912, -13281, -13648, -14012, -14375, -14735, -15093,
+	-15449, -15802, -16153, -16502, -16848, -17192, -17533, -17871,
+	-18207, -18540, -18870, -19197, -19522, -19843, -20162, -20477,
+	-20790, -21099, -21405, -21708, -22008, -22304, -22597, -22886,
+	-23172, -23455, -23734, -24010, -24281, -24550, -24814, -25075,
+	-25331, -25584, -25834, -26079, -26321, -26558, -26792, -27021,
+	-27247, -27468, -27685, -27898, -28107, -28312, -28512, -28708,
+	-28900, -29087, -29270, -29449, -29623, -29793, -29958, -30119,
+	-30275, -30426, -30573, -30716, -30854, -30987, -31114, -31238,
+	-31357, -31471, -31581, -31686, -31786, -31881, -31972, -32058,
+	-32138, -32214, -32286, -32352, -32413, -32470, -32522, -32568,
+	-32610, -32647, -32679, -32706, -32729, -32746, -32758, -32766
+};
+
+static const int16_t wi_array[FFTLENGTH / 2] = {
+	0, 402, 804, 1206, 1608, 2009, 2411, 2811,
+	3212, 3612, 4011, 4410, 4808, 5205, 5602, 5998,
+	6393, 6787, 7180, 7571, 7962, 8351, 8740, 9127,
+	9512, 9896, 10279, 10660, 11039, 11417, 11793, 12167,
+	12540, 12910, 13279, 13646, 14010, 14373, 14733, 15091,
+	15447, 15800, 16151, 16500, 16846, 17190, 17531, 17869,
+	18205, 18538, 18868, 19195, 19520, 19841, 20160, 20475,
+	20788, 21097, 21403, 21706, 22006, 22302, 22595, 22884,
+	23170, 23453, 23732, 24008, 24279, 24548, 24812, 25073,
+	25330, 25583, 25833, 26078, 26320, 26557, 26791, 27020,
+	27246, 27467, 27684, 27897, 28106, 28311, 28511, 28707,
+	28899, 29086, 29269, 29448, 29622, 29792, 29957, 30118,
+	30274, 30425, 30572, 30715, 30853, 30986, 31114, 31238,
+	31357, 31471, 31581, 31686, 31786, 31881, 31972, 32058,
+	32138, 32214, 32286, 32352, 32413, 32470, 32522, 32568,
+	32610, 32647, 32679, 32706, 32729, 32746, 32758, 32766,
+	32767, 32765, 32757, 32745, 32728, 32705, 32678, 32646,
+	32609, 32567, 32521, 32469, 32412, 32351, 32285, 32213,
+	32137, 32057, 31971, 31880, 31785, 31685, 31580, 31470,
+	31356, 31237, 31113, 30984, 30851, 30713, 30570, 30423,
+	30272, 30116, 29955, 29790, 29620, 29446, 29267, 29084,
+	28897, 28705, 28509, 28309, 28104, 27895, 27682, 27465,
+	27244, 27018, 26789, 26555, 26318, 26076, 25831, 25581,
+	25327, 25070, 24809, 24545, 24276, 24005, 23729, 23450,
+	23167, 22881, 22592, 22299, 22003, 21703, 21400, 21094,
+	20785, 20472, 20157, 19838, 19517, 19192, 18865, 18535,
+	18202, 17866, 17528, 17187, 16843, 16497, 16148, 15797,
+	15444, 15088, 14730, 14370, 14007, 13643, 13276, 12907,
+	12537, 12164, 11790, 11414, 11036, 10657, 10276, 9893,
+	9508, 9123, 8736, 8347, 7958, 7567, 7176, 6783,
+	6389, 5994, 5598, 5201, 4804, 4406, 4007, 3608,
+	3208, 2807, 2407, 2005, 1604, 1202, 800, 398
+};
 
 /* Radix-2, DIT, 2N-point Real FFT */
 void rfft(int16_t datam1[], int16_t n)
@@ -280,24 +349,3 @@ int16_t fft_npp(int16_t data[], int16_t dir)
 	}
 	return guard;
 }
-
-/* Initialization of wr_array and wi_array */
-void fs_init()
-{
-	register int16_t i;
-	int16_t fft_len2, shift, step, theta;
-
-	fft_len2 = melpe_shr(FFTLENGTH, 1);
-	shift = melpe_norm_s(fft_len2);
-	step = melpe_shl(2, shift);
-	theta = 0;
-
-	for (i = 0; i < fft_len2; i++) {
-		wr_array[i] = cos_fxp(theta);
-		wi_array[i] = sin_fxp(theta);
-		if (i == (fft_len2 - 1))
-			theta = ONE_Q15;
-		else
-			theta = melpe_add(theta, step);
-	}
-}
@@ -16,38 +16,28 @@
 
 #include "sc1200.h"
 
-/* ====== Data I/O for high level language implementation ====== */
-long frame_count;
-short rate;
-
-/* ====== Global variables for fixed-point library ====== */
-int32_t saturation = 0;
-int32_t temp_saturation;
-
-/* ====== General parameters ====== */
-struct melp_param melp_par[NF];	/* melp analysis parameters */
-unsigned char chbuf[CHSIZE];	/* channel bit data buffer */
-int16_t frameSize, frameSize12, frameSize24;	/* frame size 2.4 = 180 1.2 = 540 */
-int16_t bitNum, bitNum12, bitNum24;	/* number of bits */
+/* ====== Coder configuration ====== */
+/* The coder only runs at 1200 bps; the per instance state lives in       */
+/* state.h and everything here is read only.                              */
+const short rate = RATE1200;
+const int16_t frameSize = BLOCK;	/* frame size 2.4 = 180 1.2 = 540 */
+const int16_t bitNum12 = 81, bitNum24 = 54;	/* number of bits */
+const int16_t chwordsize = 8;	/* output bitstream word size */
 
 /* ====== Quantization ====== */
 const int16_t msvq_bits[MSVQ_STAGES] = { 7, 6, 6, 6 };
 const int16_t msvq_levels[MSVQ_STAGES] = { 128, 64, 64, 64 };
 
-struct quant_param quant_par;
-
-/* ====== Buffers ====== */
-int16_t hpspeech[IN_BEG + BLOCK];	/* input speech buffer dc removed */
-int16_t dcdel[DC_ORD];
-int16_t dcdelin[DC_ORD];
-int16_t dcdelout_hi[DC_ORD];
-int16_t dcdelout_lo[DC_ORD];
-
-/* ====== Classifier ====== */
-int16_t voicedEn, silenceEn;	/* Q11 */
-int32_t voicedCnt;
-
 /* ====== Fourier Harmonics Weights ====== */
-int16_t w_fs[NUM_HARM];	/* Q14 */
-int16_t w_fs_inv[NUM_HARM];
-BOOLEAN w_fs_init = FALSE;
+/* w_fs[] is vq_fsw(w_fs, NUM_HARM, X60_Q9) and w_fs_inv[] is             */
+/* divide_s(ONE_Q13, w_fs[]); both used to be computed on the first call  */
+/* of melp_ana_init() or melp_syn_init().                                 */
+const int16_t w_fs[NUM_HARM] = {	/* Q14 */
+	18956, 18267, 17267, 16068, 14800, 13559, 12379, 11311,
+	10341, 9475
+};
+
+const int16_t w_fs_inv[NUM_HARM] = {	/* Q14 */
+	14160, 14695, 15546, 16706, 18137, 19797, 21684, 23732,
+	25958, 28330
+};
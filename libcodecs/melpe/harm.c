@@ -181,6 +181,7 @@ void set_fc(int16_t bpvc[], int16_t * fc)
 **
 ** Arguments:
 **
+**	uint32_t *seed		random phase generator state
 **	int16_t amp[]			input harmonic mags (Q13)
 **	int16_t signal[]		output synthesized signal buffer (Q15)
 **	int16_t fc			The cut-off frequency (Q3)
@@ -189,8 +190,8 @@ void set_fc(int16_t bpvc[], int16_t * fc)
 ** Return value:			None
 **
 *****************************************************************************/
-void harm_syn_pitch(int16_t amp[], int16_t signal[], int16_t fc,
-		    int16_t length)
+void harm_syn_pitch(uint32_t * seed, int16_t amp[], int16_t signal[],
+		    int16_t fc, int16_t length)
 {
 	register int16_t i;
 	int16_t rndphase[SYN_FFT_SIZE / 2 + 1];	/* Q0 */
@@ -208,7 +209,7 @@ void harm_syn_pitch(int16_t amp[], int16_t signal[], int16_t fc,
 	/* the actual phases divided by (2*PI)/length.                            */
 
 	for (i = 0; i < length / 2 + 1; i++)
-		rndphase[i] = melpe_mult(length, rand_minstdgen());
+		rndphase[i] = melpe_mult(length, rand_minstdgen(seed));
 
 	/* ====== Harmonic Synthesis ====== */
 	/* The fc1 and fc2 computed in the if block below are Q2 */
@@ -15,7 +15,7 @@
 
 void set_fc(int16_t bpvc[], int16_t * fc);
 
-void harm_syn_pitch(int16_t amp[], int16_t signal[], int16_t fc,
-		    int16_t length);
+void harm_syn_pitch(uint32_t * seed, int16_t amp[], int16_t signal[],
+		    int16_t fc, int16_t length);
 
 #endif
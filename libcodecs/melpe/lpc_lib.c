@@ -615,6 +615,76 @@ int16_t lpc_pred2lsp(int16_t lpc[], int16_t lsf[], int16_t order)
 	return (0);
 }
 
+/* Cosine table for lsp_to_freq(), lsp_cos[i] = cos(i*(TWOPI / DFTLENGTH)) */
+/* in Q15.  It was filled with cos_fxp() on the first call and is now kept  */
+/* in ROM.                                                                  */
+static const int16_t lsp_cos[DFTLENGTH] = {
+	32767, 32766, 32758, 32746, 32729, 32706, 32679, 32647,
+	32610, 32568, 32522, 32470, 32413, 32352, 32286, 32214,
+	32138, 32058, 31972, 31881, 31786, 31686, 31581, 31471,
+	31357, 31238, 31114, 30986, 30853, 30715, 30572, 30425,
+	30274, 30118, 29957, 29792, 29622, 29448, 29269, 29086,
+	28899, 28707, 28511, 28311, 28106, 27897, 27684, 27467,
+	27246, 27020, 26791, 26557, 26320, 26078, 25833, 25583,
+	25330, 25073, 24812, 24548, 24279, 24008, 23732, 23453,
+	23170, 22884, 22595, 22302, 22006, 21706, 21403, 21097,
+	20788, 20475, 20160, 19841, 19520, 19195, 18868, 18538,
+	18205, 17869, 17531, 17190, 16846, 16500, 16151, 15800,
+	15447, 15091, 14733, 14373, 14010, 13646, 13279, 12910,
+	12540, 12167, 11793, 11417, 11039, 10660, 10279, 9896,
+	9512, 9127, 8740, 8351, 7962, 7571, 7180, 6787,
+	6393, 5998, 5602, 5205, 4808, 4410, 4011, 3612,
+	3212, 2811, 2411, 2009, 1608, 1206, 804, 402,
+	0, -402, -804, -1206, -1608, -2009, -2411, -2811,
+	-3212, -3612, -4011, -4410, -4808, -5205, -5602, -5998,
+	-6393, -6787, -7180, -7571, -7962, -8351, -8740, -9127,
+	-9512, -9896, -10279, -10660, -11039, -11417, -11793, -12167,
+	-12540, -12910, -13279, -13646, -14010, -14373, -14733, -15091,
+	-15447, -15800, -16151, -16500, -16846, -17190, -17531, -17869,
+	-18205, -18538, -18868, -19195, -19520, -19841, -20160, -20475,
+	-20788, -21097, -21403, -21706, -22006, -22302, -22595, -22884,
+	-23170, -23453, -23732, -24008, -24279, -24548, -24812, -25073,
+	-25330, -25583, -25833, -26078, -26320, -26557, -26791, -27020,
+	-27246, -27467, -27684, -27897, -28106, -28311, -28511, -28707,
+	-28899, -29086, -29269, -29448, -29622, -29792, -29957, -30118,
+	-30274, -30425, -30572, -30715, -30853, -30986, -31114, -31238,
+	-31357, -31471, -31581, -31686, -31786, -31881, -31972, -32058,
+	-32138, -32214, -32286, -32352, -32413, -32470, -32522, -32568,
+	-32610, -32647, -32679, -32706, -32729, -32746, -32758, -32766,
+	-32767, -32766, -32758, -32746, -32729, -32706, -32679, -32647,
+	-32610, -32568, -32522, -32470, -32413, -32352, -32286, -32214,
+	-32138, -32058, -31972, -31881, -31786, -31686, -31581, -31471,
+	-31357, -31238, -31114, -30986, -30853, -30715, -30572, -30425,
+	-30274, -30118, -29957, -29792, -29622, -29448, -29269, -29086,
+	-28899, -28707, -28511, -28311, -28106, -27897, -27684, -27467,
+	-27246, -27020, -26791, -26557, -26320, -26078, -25833, -25583,
+	-25330, -25073, -24812, -24548, -24279, -24008, -23732, -23453,
+	-23170, -22884, -22595, -22302, -22006, -21706, -21403, -21097,
+	-20788, -20475, -20160, -19841, -19520, -19195, -18868, -18538,
+	-18205, -17869, -17531, -17190, -16846, -16500, -16151, -15800,
+	-15447, -15091, -14733, -14373, -14010, -13646, -13279, -12910,
+	-12540, -12167, -11793, -11417, -11039, -10660, -10279, -9896,
+	-9512, -9127, -8740, -8351, -7962, -7571, -7180, -6787,
+	-6393, -5998, -5602, -5205, -4808, -4410, -4011, -3612,
+	-3212, -2811, -2411, -2009, -1608, -1206, -804, -402,
+	0, 402, 804, 1206, 1608, 2009, 2411, 2811,
+	3212, 3612, 4011, 4410, 4808, 5205, 5602, 5998,
+	6393, 6787, 7180, 7571, 7962, 8351, 8740, 9127,
+	9512, 9896, 10279, 10660, 11039, 11417, 11793, 12167,
+	12540, 12910, 13279, 13646, 14010, 14373, 14733, 15091,
+	15447, 15800, 16151, 16500, 16846, 17190, 17531, 17869,
+	18205, 18538, 18868, 19195, 19520, 19841, 20160, 20475,
+	20788, 21097, 21403, 21706, 22006, 22302, 22595, 22884,
+	23170, 23453, 23732, 24008, 24279, 24548, 24812, 25073,
+	25330, 25583, 25833, 26078, 26320, 26557, 26791, 27020,
+	27246, 27467, 27684, 27897, 28106, 28311, 28511, 28707,
+	28899, 29086, 29269, 29448, 29622, 29792, 29957, 30118,
+	30274, 30425, 30572, 30715, 30853, 30986, 31114, 31238,
+	31357, 31471, 31581, 31686, 31786, 31881, 31972, 32058,
+	32138, 32214, 32286, 32352, 32413, 32470, 32522, 32568,
+	32610, 32647, 32679, 32706, 32729, 32746, 32758, 32766
+};
+
 /* Subroutine LSP_TO_FREQ: Calculate line spectrum pair	root frequencies from */
 /* LSP polynomial.  Only lsp[0], ...... lsp[order/2] are used and the other   */
 /* lsp[]'s are ignored.  Similarly, only freq[0], ...... freq[order/2] are    */
@@ -626,9 +696,6 @@ int16_t lpc_pred2lsp(int16_t lpc[], int16_t lsf[], int16_t order)
 static void lsp_to_freq(int16_t lsp[], int16_t freq[], int16_t order)
 {
 	register int16_t i, j;
-	static BOOLEAN firstTime = TRUE;
-	static int16_t lsp_cos[DFTLENGTH];	/* cosine table */
-	static int16_t default_w, default_w0;
 	int16_t p2, count;
 	BOOLEAN prev_less;
 	int32_t mag[3];
@@ -637,38 +704,6 @@ static void lsp_to_freq(int16_t lsp[], int16_t freq[], int16_t order)
 	int16_t temp1, temp2;
 	int32_t L_temp1, L_temp2;
 
-	if (firstTime) {
-		/* for (i = 0; i < DFTLENGTH; i++)
-		   lsp_cos[i] = cos(i*(TWOPI / DFTLENGTH)); */
-
-		/* cos_fxp() takes Q15 input.  (TWO/DFTLENGTH) above is DFTLENGTH_D4  */
-		/* in Q15.  The first for loop fills lsp_cos[] in the first quadrant, */
-		/* and the next loop fills lsp_cos[] for the other three quadrants.   */
-
-		temp1 = 0;
-		for (i = 0; i <= DFTLENGTH_D4; i++) {
-			lsp_cos[i] = cos_fxp(temp1);
-			lsp_cos[i + DFTLENGTH_D2] = melpe_negate(lsp_cos[i]);
-			temp1 = melpe_add(temp1, DFTLENGTH_D4);
-		}
-		temp1 = DFTLENGTH_D4;
-		temp2 = DFTLENGTH_D4;
-		for (i = 0; i < DFTLENGTH_D4; i++) {
-			lsp_cos[temp1] = melpe_negate(lsp_cos[temp2]);
-			lsp_cos[temp1 + DFTLENGTH_D2] = lsp_cos[temp2];
-			temp1 = melpe_add(temp1, 1);
-			temp2 = melpe_sub(temp2, 1);
-		}
-
-		/* compute default values for freq[] */
-		/* (1./p2) in Q15 */
-		default_w = melpe_divide_s(ONE_Q11, melpe_shl(order, 10));
-		/* freq[0] = (0.5/p2) in Q15 */
-		default_w0 = melpe_shr(default_w, 1);
-
-		firstTime = FALSE;
-	}
-
 	prev_less = TRUE;
 	L_fill(mag, 0x7fffffff, 2);
 	fill(s_mag, 0x7fff, 2);
@@ -728,9 +763,12 @@ static void lsp_to_freq(int16_t lsp[], int16_t freq[], int16_t order)
 
 	if (count != p2) {
 		/* use default values */
-		freq[0] = default_w0;
+		/* (1./p2) in Q15 */
+		temp1 = melpe_divide_s(ONE_Q11, melpe_shl(order, 10));
+		/* freq[0] = (0.5/p2) in Q15 */
+		freq[0] = melpe_shr(temp1, 1);
 		for (i = 1; i < p2; i++)
-			freq[i] = melpe_add(freq[i - 1], default_w);
+			freq[i] = melpe_add(freq[i - 1], temp1);
 	}
 }
 
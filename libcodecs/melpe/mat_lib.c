@@ -575,11 +575,84 @@ int16_t *v_zap(int16_t vec1[], int16_t n)
 	return (vec1 - n);
 }
 
+/***************************************************************************
+ *
+ *	 SCRATCH ARENA
+ *
+ *	   v_get() and L_v_get() hand out working vectors from a scratch
+ *	   arena preallocated by v_arena_init() and selected by v_arena_use().
+ *	   Blocks are taken from the top of the arena; v_free() of an arena
+ *	   block releases it together with every block taken after it, which
+ *	   matches the nested get/free pattern of the coder.  Without an
+ *	   arena, or if the arena is exhausted, malloc() is used instead.
+ *	   The selection is per thread, so every coder instance can bring
+ *	   its own arena and select it on entry.
+ *
+ *************************************************************************/
+
+#ifdef _MSC_VER
+#define V_THREAD		__declspec(thread)
+#else
+#define V_THREAD		__thread
+#endif
+
+static V_THREAD v_arena_t *v_arena = NULL;	/* arena used by v_get()/L_v_get() */
+
+int16_t v_arena_init(v_arena_t * arena, int32_t words)
+{
+	if (arena->base && (arena->size >= words)) {
+		arena->top = 0;
+		return (1);
+	}
+	v_arena_free(arena);
+	arena->base = malloc(sizeof(int32_t) * words);
+	if (arena->base == NULL)
+		return (0);
+	arena->size = words;
+	arena->top = 0;
+	arena->peak = 0;
+	return (1);
+}
+
+void v_arena_free(v_arena_t * arena)
+{
+	if (v_arena == arena)
+		v_arena = NULL;
+	if (arena->base)
+		free(arena->base);
+	arena->base = NULL;
+	arena->size = 0;
+	arena->top = 0;
+}
+
+void v_arena_use(v_arena_t * arena)
+{
+	v_arena = arena;
+}
+
+/* take words 32-bit words from the current arena, NULL if not possible */
+static void *v_arena_get(int32_t words)
+{
+	int32_t *ptr;
+
+	if ((v_arena == NULL) || (v_arena->top + words > v_arena->size))
+		return (NULL);
+	ptr = v_arena->base + v_arena->top;
+	v_arena->top += words;
+	if (v_arena->top > v_arena->peak)
+		v_arena->peak = v_arena->top;
+	return (ptr);
+}
+
 int16_t *v_get(int16_t n)
 {
 	int16_t *ptr;
 	int32_t size;
 
+	/* keep arena blocks 32-bit aligned */
+	ptr = v_arena_get((int32_t) ((n + 1) >> 1));
+	if (ptr)
+		return (ptr);
 	size = sizeof(int16_t) * n;
 	ptr = malloc(size);
 	assert(ptr != NULL);
@@ -591,6 +664,9 @@ int32_t *L_v_get(int16_t n)
 	int32_t *ptr;
 	int32_t size;
 
+	ptr = v_arena_get((int32_t) n);
+	if (ptr)
+		return (ptr);
 	size = sizeof(int32_t) * n;
 	ptr = malloc(size);
 	assert(ptr != NULL);
@@ -599,6 +675,16 @@ int32_t *L_v_get(int16_t n)
 
 void v_free(void *v)
 {
-	if (v)
-		free(v);
+	int32_t *ptr = v;
+
+	if (!v)
+		return;
+	if (v_arena && (ptr >= v_arena->base)
+	    && (ptr < v_arena->base + v_arena->size)) {
+		/* release this block and all blocks taken after it */
+		if (ptr - v_arena->base < v_arena->top)
+			v_arena->top = (int32_t) (ptr - v_arena->base);
+		return;
+	}
+	free(v);
 }
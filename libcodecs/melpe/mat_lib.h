@@ -39,6 +39,14 @@ Secretariat fax: +33 493 65 47 16.
 #ifndef _MAT_LIB_H_
 #define _MAT_LIB_H_
 
+/* scratch arena for v_get()/L_v_get() working vectors */
+typedef struct {
+	int32_t *base;		/* storage, 32-bit aligned */
+	int32_t size;		/* size of storage in 32-bit words */
+	int32_t top;		/* first free word */
+	int32_t peak;		/* high-water mark of top */
+} v_arena_t;
+
 int16_t *v_add(int16_t vec1[], const int16_t vec2[], int16_t n);
 
 int16_t *v_equ(int16_t vec1[], const int16_t v2[], int16_t n);
@@ -69,4 +77,10 @@ int32_t *L_v_get(int16_t n);
 
 void v_free(void *v);
 
+int16_t v_arena_init(v_arena_t * arena, int32_t words);
+
+void v_arena_free(v_arena_t * arena);
+
+void v_arena_use(v_arena_t * arena);
+
 #endif
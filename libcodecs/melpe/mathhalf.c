@@ -118,7 +118,10 @@ Secretariat fax: +33 493 65 47 16.
  *************************************************************************/
 
 #if OVERFLOW_CHECK
-inc_saturation()
+int32_t saturation = 0;		/* debugging only, counts saturations */
+int32_t temp_saturation;
+
+void inc_saturation()
 {
 	saturation++;
 }
@@ -62,6 +62,7 @@ Secretariat fax: +33 493 65 47 16.
 #include "melp_sub.h"
 #include "dsp_sub.h"
 #include "coeff.h"
+#include "state.h"
 
 /* compiler constants */
 
@@ -72,7 +73,6 @@ Secretariat fax: +33 493 65 47 16.
 #define PEAK_THRESH_Q12		5488	/* 1.34 * (1 << 12) */
 #define PEAK_THR2_Q12		6553	/* 1.6 * (1 << 12) */
 #define SILENCE_DB_Q8		7680	/* 30.0 * (1 << 8) */
-#define SIG_LENGTH			(LPF_ORD + PITCH_FR)	/* 327 */
 
 #define X01_Q15				3277	/* 0.1 * (1 << 15) */
 #define X03_Q11				614	/* 0.3 * (1 << 11) */
@@ -86,19 +86,12 @@ Secretariat fax: +33 493 65 47 16.
 #define MX01_Q15			-3277	/* -0.1 * (1 << 15) */
 #define MX02_Q15			-6554	/* -0.2 * (1 << 15) */
 
-/* memory definitions */
-
-static int16_t sigbuf[SIG_LENGTH];
-static classParam classStat[TRACK_NUM];	/* class of subframes */
-static pitTrackParam pitTrack[TRACK_NUM];	/* pitch of subframes */
-
-int16_t top_lpc[LPC_ORD];
-
 /* Prototype */
 
-static void melp_ana(int16_t sp_in[], struct melp_param *par,
+static void melp_ana(struct melpe_enc *st, int16_t sp_in[],
+		     struct melp_param *par,
 		     int16_t subnum);
-void sc_ana(struct melp_param *par);
+void sc_ana(struct melpe_enc *st, struct melp_param *par);
 static BOOLEAN subenergyRelation1(classParam classStat[], int16_t curTrack);
 static BOOLEAN subenergyRelation2(classParam classStat[], int16_t curTrack);
 
@@ -116,7 +109,7 @@ static BOOLEAN subenergyRelation2(classParam classStat[], int16_t curTrack);
 ** Return value:	None
 **
 *****************************************************************************/
-void analysis(int16_t sp_in[], struct melp_param *par)
+void analysis(struct melpe_enc *st, int16_t sp_in[], struct melp_param *par)
 {
 	register int16_t i;
 	int16_t lpc[LPC_ORD + 1], weights[LPC_ORD];
@@ -141,19 +134,19 @@ void analysis(int16_t sp_in[], struct melp_param *par)
 		/* (Q13) we use for RATE 2400.                                        */
 
 		if (rate == RATE2400)
-			dc_rmv(&sp_in[i * FRAME], &hpspeech[OLD_IN_BEG],
-			       dcdelin, dcdelout_hi, dcdelout_lo, FRAME);
+			dc_rmv(&sp_in[i * FRAME], &st->hpspeech[OLD_IN_BEG],
+			       st->dcdelin, st->dcdelout_hi, st->dcdelout_lo, FRAME);
 		else
-			dc_rmv(&sp_in[i * FRAME], &hpspeech[IN_BEG + i * FRAME],
-			       dcdelin, dcdelout_hi, dcdelout_lo, FRAME);
+			dc_rmv(&sp_in[i * FRAME], &st->hpspeech[IN_BEG + i * FRAME],
+			       st->dcdelin, st->dcdelout_hi, st->dcdelout_lo, FRAME);
 
-		melp_ana(&hpspeech[i * FRAME], &par[i], i);
+		melp_ana(st, &st->hpspeech[i * FRAME], &par[i], i);
 	}
 
 	/* ---- New routine to refine the parameters for block ---- */
 
 	if (rate == RATE1200)
-		sc_ana(par);
+		sc_ana(st, par);
 
 	/* ======== Quantization ======== */
 
@@ -162,62 +155,62 @@ void analysis(int16_t sp_in[], struct melp_param *par)
 		/* -- Quantize MELP parameters to 2400 bps and generate bitstream --  */
 
 		/* Quantize LSF's with MSVQ */
-		v_equ(&(lpc[1]), top_lpc, LPC_ORD);
+		v_equ(&(lpc[1]), st->top_lpc, LPC_ORD);
 		vq_lspw(weights, par->lsf, &(lpc[1]), LPC_ORD);
 
 		/*      msvq_enc(par->lsf, weights, par->lsf, vq_par); */
 		vq_ms4(msvq_cb, par->lsf, msvq_cb_mean, msvq_levels, MSVQ_M, 4,
-		       LPC_ORD, weights, par->lsf, quant_par.msvq_index,
+		       LPC_ORD, weights, par->lsf, st->quant_par.msvq_index,
 		       MSVQ_MAXCNT);
 
 		/* Force minimum LSF bandwidth (separation) */
 		lpc_clamp(par->lsf, BWMIN_Q15, LPC_ORD);
 
 	} else
-		lsf_vq(par);
+		lsf_vq(st, par);
 
 	if (rate == RATE2400) {
 		/* Quantize logarithmic pitch period */
 		/* Reserve all zero code for completely unvoiced */
 		par->pitch = log10_fxp(par->pitch, 7);	/* par->pitch in Q12 */
-		quant_u(&par->pitch, &(quant_par.pitch_index), PIT_QLO_Q12,
+		quant_u(&par->pitch, &(st->quant_par.pitch_index), PIT_QLO_Q12,
 			PIT_QUP_Q12, PIT_QLEV_M1, PIT_QLEV_M1_Q8, 1, 7);
 		/* convert pitch back to linear in Q7 */
 		par->pitch = pow10_fxp(par->pitch, 7);
 	} else
-		pitch_vq(par);
+		pitch_vq(st, par);
 
 	if (rate == RATE2400) {
 		/* Quantize gain terms with uniform log quantizer   */
-		q_gain(par->gain, quant_par.gain_index, GN_QLO_Q8, GN_QUP_Q8,
+		q_gain(st, par->gain, st->quant_par.gain_index, GN_QLO_Q8, GN_QUP_Q8,
 		       GN_QLEV_M1, GN_QLEV_M1_Q10, 0, 5);
 	} else
-		gain_vq(par);
+		gain_vq(st, par);
 
 	if (rate == RATE2400) {	/* Quantize jitter */
 		/*      quant_u(&par->jitter, &par->jit_index, 0, MAX_JITTER_Q15, 2);     */
 		if (par->jitter < melpe_shr(MAX_JITTER_Q15, 1)) {
 			par->jitter = 0;
-			quant_par.jit_index[0] = 0;
+			st->quant_par.jit_index[0] = 0;
 		} else {
 			par->jitter = MAX_JITTER_Q15;
-			quant_par.jit_index[0] = 1;
+			st->quant_par.jit_index[0] = 1;
 		}
 	} else {
 		for (i = 0; i < NF; i++)
-			quant_u(&par[i].jitter, &(quant_par.jit_index[i]), 0,
+			quant_u(&par[i].jitter, &(st->quant_par.jit_index[i]), 0,
 				MAX_JITTER_Q15, 2, ONE_Q15, 1, 7);
 	}
 
 	/* Quantize bandpass voicing */
 	if (rate == RATE2400)
-		par[0].uv_flag = q_bpvc(par[0].bpvc, &(quant_par.bpvc_index[0]),
+		par[0].uv_flag = q_bpvc(par[0].bpvc, &(st->quant_par.bpvc_index[0]),
 					NUM_BANDS);
 	else
-		quant_bp(par, num_frames);
+		quant_bp(st, par, num_frames);
 
 	if (rate == RATE1200)
-		quant_jitter(par);
+		quant_jitter(st, par);
 
 	/* Calculate Fourier coeffs of residual from quantized LPC */
 	for (i = 0; i < num_frames; i++) {
@@ -226,11 +219,11 @@ void analysis(int16_t sp_in[], struct melp_param *par)
 		fill(par[i].fs_mag, ONE_Q13, NUM_HARM);
 		if (!par[i].uv_flag) {
 			lpc_lsp2pred(par[i].lsf, &(lpc[1]), LPC_ORD);
-			zerflt(&hpspeech
+			zerflt(&st->hpspeech
 			       [(i * FRAME + FRAME_END - (LPC_FRAME / 2))], lpc,
-			       sigbuf, LPC_ORD, LPC_FRAME);
-			window(sigbuf, win_cof, sigbuf, LPC_FRAME);
-			find_harm(sigbuf, par[i].fs_mag, par[i].pitch, NUM_HARM,
+			       st->sigbuf, LPC_ORD, LPC_FRAME);
+			window(st->sigbuf, win_cof, st->sigbuf, LPC_FRAME);
+			find_harm(st->sigbuf, par[i].fs_mag, par[i].pitch, NUM_HARM,
 				  LPC_FRAME);
 		}
 	}
@@ -246,23 +239,23 @@ void analysis(int16_t sp_in[], struct melp_param *par)
 		/* replaced directly with constants or other variables.               */
 
 		vq_enc(fsvq_cb, par->fs_mag, FS_LEVELS, NUM_HARM, par->fs_mag,
-		       &(quant_par.fsvq_index));
+		       &(st->quant_par.fsvq_index));
 	} else
-		quant_fsmag(par);
+		quant_fsmag(st, par);
 
 	for (i = 0; i < num_frames; i++)
-		quant_par.uv_flag[i] = par[i].uv_flag;
+		st->quant_par.uv_flag[i] = par[i].uv_flag;
 
 	/* Write channel bitstream */
 	if (rate == RATE2400)
-		melp_chn_write(&quant_par, chbuf);
+		melp_chn_write(st, &st->quant_par, st->chbuf);
 #if !SKIP_CHANNEL
 	else
-		low_rate_chn_write(&quant_par);
+		low_rate_chn_write(st, &st->quant_par);
 #endif
 
 	/* Update delay buffers for next block */
-	v_equ(hpspeech, &(hpspeech[num_frames * FRAME]), IN_BEG);
+	v_equ(st->hpspeech, &(st->hpspeech[num_frames * FRAME]), IN_BEG);
 
 }
 
@@ -277,15 +270,11 @@ void analysis(int16_t sp_in[], struct melp_param *par)
 /*  Returns: void                                                             */
 /* ========================================================================== */
 
-static void melp_ana(int16_t speech[], struct melp_param *par,
+static void melp_ana(struct melpe_enc *st, int16_t speech[],
+		     struct melp_param *par,
 		     int16_t subnum)
 {
 	register int16_t i;
-	static BOOLEAN firstTime = TRUE;
-	static int16_t lpfsp_delin[LPF_ORD];
-	static int16_t lpfsp_delout[LPF_ORD];
-	static int16_t pitch_avg;
-	static int16_t fpitch[NUM_PITCHES];
 	int16_t cur_track, begin;
 	int16_t sub_pitch;
 	int16_t temp, dontcare, pcorr;
@@ -294,14 +283,6 @@ static void melp_ana(int16_t speech[], struct melp_param *par,
 	int16_t temp_delin[LPF_ORD];
 	int16_t temp_delout[LPF_ORD];
 
-	if (firstTime) {
-		v_zap(lpfsp_delin, LPF_ORD);	/* Release V2 only use "lpfsp_del". */
-		v_zap(lpfsp_delout, LPF_ORD);
-		pitch_avg = DEFAULT_PITCH_Q7;
-		fill(fpitch, DEFAULT_PITCH_Q7, 2);
-		firstTime = FALSE;
-	}
-
 	/* Copy input speech to pitch window and lowpass filter */
 
 	/* The following filter block was in use in the fixed point implementa-   */
@@ -321,40 +302,40 @@ static void melp_ana(int16_t speech[], struct melp_param *par,
 	/* truncation errors) under Q13.  Therefore the floating point version of */
 	/* the filter is completely replaced with the RATE2400 filter.            */
 
-	v_equ(&sigbuf[LPF_ORD], &speech[PITCH_BEG], PITCH_FR);
+	v_equ(&st->sigbuf[LPF_ORD], &speech[PITCH_BEG], PITCH_FR);
 	for (section = 0; section < LPF_ORD / 2; section++) {
 		for (i = (int16_t) (section * 2);
 		     i < (int16_t) (section * 2 + 2); i++) {
 			temp_delin[i] =
-			    sigbuf[LPF_ORD + FRAME - 1 - i + section * 2];
+			    st->sigbuf[LPF_ORD + FRAME - 1 - i + section * 2];
 		}
-		iir_2nd_s(&sigbuf[LPF_ORD], &lpf_den[section * 3],
-			  &lpf_num[section * 3], &sigbuf[LPF_ORD],
-			  &lpfsp_delin[section * 2], &lpfsp_delout[section * 2],
+		iir_2nd_s(&st->sigbuf[LPF_ORD], &lpf_den[section * 3],
+			  &lpf_num[section * 3], &st->sigbuf[LPF_ORD],
+			  &st->lpfsp_delin[section * 2], &st->lpfsp_delout[section * 2],
 			  FRAME);
-		v_equ(&(temp_delout[2 * section]), &(lpfsp_delout[2 * section]),
+		v_equ(&(temp_delout[2 * section]), &(st->lpfsp_delout[2 * section]),
 		      2);
-		iir_2nd_s(&sigbuf[LPF_ORD + FRAME], &lpf_den[section * 3],
-			  &lpf_num[section * 3], &sigbuf[LPF_ORD + FRAME],
-			  &lpfsp_delin[section * 2], &lpfsp_delout[section * 2],
+		iir_2nd_s(&st->sigbuf[LPF_ORD + FRAME], &lpf_den[section * 3],
+			  &lpf_num[section * 3], &st->sigbuf[LPF_ORD + FRAME],
+			  &st->lpfsp_delin[section * 2], &st->lpfsp_delout[section * 2],
 			  PITCH_FR - FRAME);
 		/* restore delay buffers for the next overlapping frame */
-		v_equ(&(lpfsp_delin[2 * section]), &(temp_delin[2 * section]),
+		v_equ(&(st->lpfsp_delin[2 * section]), &(temp_delin[2 * section]),
 		      2);
-		v_equ(&(lpfsp_delout[2 * section]), &(temp_delout[2 * section]),
+		v_equ(&(st->lpfsp_delout[2 * section]), &(temp_delout[2 * section]),
 		      2);
 	}
 
-	f_pitch_scale(&sigbuf[LPF_ORD], &sigbuf[LPF_ORD], PITCH_FR);
+	f_pitch_scale(&st->sigbuf[LPF_ORD], &st->sigbuf[LPF_ORD], PITCH_FR);
 
 	/* Perform global pitch search at frame end on lowpass speech signal */
 	/* Note: avoid short pitches due to formant tracking */
-	fpitch[1] = find_pitch(&sigbuf[LPF_ORD + (PITCH_FR / 2)], &dontcare,
+	st->fpitch[1] = find_pitch(&st->sigbuf[LPF_ORD + (PITCH_FR / 2)], &dontcare,
 			       (2 * PITCHMIN), PITCHMAX, PITCHMAX);
-	fpitch[1] = melpe_shl(fpitch[1], 7);	/* fpitch in Q7 */
+	st->fpitch[1] = melpe_shl(st->fpitch[1], 7);	/* fpitch in Q7 */
 
 	/* Perform bandpass voicing analysis for end of frame */
-	bpvc_ana(&speech[FRAME_END], fpitch, par->bpvc, &sub_pitch);
+	bpvc_ana(st, &speech[FRAME_END], st->fpitch, par->bpvc, &sub_pitch);
 
 	/* Force jitter if lowest band voicing strength is weak */
 	if (par->bpvc[0] < VJIT_Q14)	/* par->bpvc in Q14 */
@@ -380,7 +361,7 @@ static void melp_ana(int16_t speech[], struct melp_param *par,
 
 	if (rate == RATE2400) {	/* Calculate Line Spectral Frequencies */
 		lpc_pred2lsp(&(lpc[1]), par->lsf, LPC_ORD);
-		v_equ(top_lpc, &(lpc[1]), LPC_ORD);
+		v_equ(st->top_lpc, &(lpc[1]), LPC_ORD);
 	} else {
 		lpc_bw_expand(&(lpc[1]), &(lpc[1]), BWFACT_Q15, LPC_ORD);
 
@@ -392,11 +373,11 @@ static void melp_ana(int16_t speech[], struct melp_param *par,
 	}
 
 	/* Calculate LPC residual */
-	zerflt(&speech[PITCH_BEG], lpc, &sigbuf[LPF_ORD], LPC_ORD, PITCH_FR);
+	zerflt(&speech[PITCH_BEG], lpc, &st->sigbuf[LPF_ORD], LPC_ORD, PITCH_FR);
 
 	/* Check peakiness of residual signal */
 	begin = LPF_ORD + (PITCHMAX / 2);
-	temp = peakiness(&sigbuf[begin], PITCHMAX);	/* temp in Q12 */
+	temp = peakiness(&st->sigbuf[begin], PITCHMAX);	/* temp in Q12 */
 
 	/* Peakiness: force lowest band to be voiced  */
 	if (temp > PEAK_THRESH_Q12)
@@ -412,22 +393,22 @@ static void melp_ana(int16_t speech[], struct melp_param *par,
 		/* ======== Compute pre-classification and pitch parameters ========  */
 		cur_track = (int16_t) (CUR_TRACK + subnum * PIT_SUBNUM);
 		for (i = 0; i < PIT_SUBNUM; i++) {
-			pitchAuto(&speech
+			pitchAuto(st, &speech
 				  [FRAME_END + i * PIT_SUBFRAME +
 				   PIT_COR_LEN / 2],
-				  &pitTrack[cur_track + i + 1],
-				  &classStat[cur_track + i + 1]);
+				  &st->pitTrack[cur_track + i + 1],
+				  &st->classStat[cur_track + i + 1]);
 
-			classify(&speech
+			classify(st, &speech
 				 [FRAME_END + i * PIT_SUBFRAME +
 				  PIT_SUBFRAME / 2],
-				 &classStat[cur_track + i + 1], auto_corr);
+				 &st->classStat[cur_track + i + 1], auto_corr);
 		}
 	}
 
 	/* Calculate overall frame pitch using lowpass filtered residual */
-	par->pitch = pitch_ana(&speech[FRAME_END], &sigbuf[LPF_ORD + PITCHMAX],
-			       sub_pitch, pitch_avg, &pcorr);
+	par->pitch = pitch_ana(st, &speech[FRAME_END], &st->sigbuf[LPF_ORD + PITCHMAX],
+			       sub_pitch, st->pitch_avg, &pcorr);
 
 	/* Calculate gain of input speech for each gain subframe */
 	for (i = 0; i < NUM_GAINFR; i++) {
@@ -455,7 +436,7 @@ static void melp_ana(int16_t speech[], struct melp_param *par,
 	else
 		temp = 0;
 	/* pcorr in Q14 */
-	pitch_avg = p_avg_update(par->pitch, temp, VMIN_Q14);
+	st->pitch_avg = p_avg_update(st, par->pitch, temp, VMIN_Q14);
 
 	if (rate == RATE1200) {
 		if (par->bpvc[0] > BPTHRESH_Q14)
@@ -465,43 +446,60 @@ static void melp_ana(int16_t speech[], struct melp_param *par,
 	}
 
 	/* Update delay buffers for next frame */
-	fpitch[0] = fpitch[1];
+	st->fpitch[0] = st->fpitch[1];
 }
 
 /* ======================================= */
 /* melp_ana_init(): perform initialization */
 /* ======================================= */
 
-void melp_ana_init()
+void melp_ana_init(struct melpe_enc *st)
 {
 	register int16_t i;
+	int16_t temp1, temp2;
 
-	v_zap(hpspeech, IN_BEG + BLOCK);	/* speech[] is declared IN_BEG + BLOCK */
-
-	/* Initialize fixed MSE weighting and inverse of weighting */
-
-	if (!w_fs_init) {
-		vq_fsw(w_fs, NUM_HARM, X60_Q9);
-		for (i = 0; i < NUM_HARM; i++)
-			w_fs_inv[i] = melpe_divide_s(ONE_Q13, w_fs[i]);	/* w_fs_inv in Q14 */
-		w_fs_init = TRUE;
+	v_zap(st->hpspeech, IN_BEG + BLOCK);	/* speech[] is declared IN_BEG + BLOCK */
+
+	st->pitch_avg = DEFAULT_PITCH_Q7;
+	fill(st->fpitch, DEFAULT_PITCH_Q7, 2);
+	fill(st->good_pitch, DEFAULT_PITCH_Q7, NF);
+
+	/* Both voicedEn and silenceEn are 1/10 of their values in floating    */
+	/* point version.  prev_pitch is Q7 but it is always an integer in Q7  */
+	/* as the former floating point version specifies.                     */
+
+	st->classify_first = TRUE;
+	st->voicedEn = FIVE_Q11;
+	st->silenceEn = THREE_Q11;
+	st->prev_uv = UNVOICED;
+	st->prev_pitch = FIFTY_Q7;
+
+	/* Initialize the quantizer predictors */
+
+	st->prev_uv_flag = TRUE;
+	st->vq_prev_pitch = LOG_UV_PITCH_Q12;
+	st->vq_prev_qpitch = LOG_UV_PITCH_Q12;
+	st->fs_prev_uv = TRUE;
+	temp1 = X08_Q10;	/* Q10 */
+	temp2 = melpe_shl(LPC_ORD, 10);	/* Q10 */
+	for (i = 0; i < LPC_ORD; i++) {
+		/*      qplsp[i] = (i+1)*0.8/LPC_ORD; */
+		st->qplsp[i] = melpe_divide_s(temp1, temp2);
+		temp1 = melpe_add(temp1, X08_Q10);
 	}
 
-	/* Initialize wr_array and wi_array */
-	fs_init();
-
 	/* Initialization of the pitch, classification and voicing paramters.  It */
 	/* is believed that the following for loop is not necessary.              */
 
 	for (i = 0; i < TRACK_NUM; i++) {
-		fill(pitTrack[i].pit, FIFTY_Q0, NODE);	/* !!! (12/10/99) */
-		fill(pitTrack[i].weight, ONE_Q15, NODE);
-
-		classStat[i].classy = UNVOICED;
-		classStat[i].subEnergy = X28_Q11;
-		classStat[i].zeroCrosRate = X05_Q15;
-		classStat[i].peakiness = ONE_Q11;
-		classStat[i].corx = X02_Q15;
+		fill(st->pitTrack[i].pit, FIFTY_Q0, NODE);	/* !!! (12/10/99) */
+		fill(st->pitTrack[i].weight, ONE_Q15, NODE);
+
+		st->classStat[i].classy = UNVOICED;
+		st->classStat[i].subEnergy = X28_Q11;
+		st->classStat[i].zeroCrosRate = X05_Q15;
+		st->classStat[i].peakiness = ONE_Q11;
+		st->classStat[i].corx = X02_Q15;
 	}
 }
 
@@ -519,14 +517,9 @@ void melp_ana_init()
 **
 *****************************************************************************/
 
-void sc_ana(struct melp_param *par)
+void sc_ana(struct melpe_enc *st, struct melp_param *par)
 {
 	register int16_t i;
-	static int16_t prev_sbp3;
-	static BOOLEAN prev_uv = UNVOICED;
-	static int16_t prev_pitch = FIFTY_Q7;	/* Note that prev_pitch is Q7 */
-	/* but it is always an integer in Q7 as the */
-	/* former floating point version specifies. */
 	int16_t pitCand, npitch;	/* Q7 */
 	int16_t bpvc_copy[NUM_BANDS];
 	int16_t sbp[NF + 1];
@@ -542,35 +535,35 @@ void sc_ana(struct melp_param *par)
 		curTrack = (int16_t) (i * PIT_SUBNUM + CUR_TRACK);
 
 		/* ---- update silence energy ---- */
-		if ((classStat[curTrack].classy == SILENCE) &&
-		    (classStat[curTrack - 1].classy == SILENCE)) {
+		if ((st->classStat[curTrack].classy == SILENCE) &&
+		    (st->classStat[curTrack - 1].classy == SILENCE)) {
 			/*      silenceEn = log10(EN_UP_RATE * pow(10.0, silenceEn) +
 			   (1.0 - EN_UP_RATE) * 
 			   pow(10.0, classStat[curTrack].subEnergy)); */
-			silenceEn = updateEn(silenceEn, EN_UP_RATE_Q15,
-					     classStat[curTrack].subEnergy);
+			st->silenceEn = updateEn(st->silenceEn, EN_UP_RATE_Q15,
+					     st->classStat[curTrack].subEnergy);
 		}
 	}
 
-	uv[0] = prev_uv;
+	uv[0] = st->prev_uv;
 	uv[1] = par[0].uv_flag;
 	uv[2] = par[1].uv_flag;
 	uv[3] = par[2].uv_flag;
 
 	curTrack = CUR_TRACK;
 	if (!uv[1])
-		voicedCnt++;
+		st->voicedCnt++;
 	else
-		voicedCnt = 0;
+		st->voicedCnt = 0;
 
 	if (!uv[1] && !uv[2] && !uv[3]
-	    && !subenergyRelation1(classStat, curTrack)) {
+	    && !subenergyRelation1(st->classStat, curTrack)) {
 		/* ---- process only voiced frames ---- */
 		/* check if it is offset first */
-		if ((voicedCnt < 2) || subenergyRelation2(classStat, curTrack)) {
+		if ((st->voicedCnt < 2) || subenergyRelation2(st->classStat, curTrack)) {
 
 			/* Got onset position, should look forward for pitch */
-			pitCand = pitLookahead(&pitTrack[curTrack], 3);
+			pitCand = pitLookahead(&st->pitTrack[curTrack], 3);
 			if (ratio(par[0].pitch, pitCand) > X015_Q15) {
 				if (ratio(pitCand, par[1].pitch) < X015_Q15)
 					par[0].pitch = pitCand;
@@ -585,37 +578,37 @@ void sc_ana(struct melp_param *par)
 			}
 		} else if (!uv[0]) {
 			/* not onset not offset, just check pitch smooth */
-			temp1 = melpe_sub(par[0].pitch, prev_pitch);
+			temp1 = melpe_sub(par[0].pitch, st->prev_pitch);
 			index1 = melpe_shr(temp1, 7);	/* Q0 */
 			temp2 = melpe_sub(par[1].pitch, par[0].pitch);
 			index2 = melpe_shr(temp2, 7);	/* Q0 */
 			if ((melpe_abs_s(index1) > 5) && (melpe_abs_s(index2) > 5) &&
 			    (index1 * index2 < 0)) {
 				/* here is a pitch jump */
-				pitCand = pitLookahead(&pitTrack[curTrack], 3);
-				if ((ratio(prev_pitch, pitCand) < X015_Q15) ||
+				pitCand = pitLookahead(&st->pitTrack[curTrack], 3);
+				if ((ratio(st->prev_pitch, pitCand) < X015_Q15) ||
 				    (ratio(pitCand, par[1].pitch) < X02_Q15))
 					par[0].pitch = pitCand;
 				else {
 					/*      par[0].pitch = (prev_pitch + par[1].pitch)/2; */
-					temp1 = melpe_shr(prev_pitch, 1);
+					temp1 = melpe_shr(st->prev_pitch, 1);
 					temp2 = melpe_shr(par[1].pitch, 1);
 					par[0].pitch = melpe_add(temp1, temp2);	/* Q7 */
 				}
-			} else if ((ratio(par[0].pitch, prev_pitch) > X015_Q15)
+			} else if ((ratio(par[0].pitch, st->prev_pitch) > X015_Q15)
 				   &&
-				   ((ratio(par[1].pitch, prev_pitch) < X015_Q15)
-				    || (ratio(par[2].pitch, prev_pitch) <
+				   ((ratio(par[1].pitch, st->prev_pitch) < X015_Q15)
+				    || (ratio(par[2].pitch, st->prev_pitch) <
 					X015_Q15))) {
 				index1 =
-				    trackPitch(prev_pitch, &pitTrack[curTrack]);
-				pitCand = melpe_shl(pitTrack[curTrack].pit[index1], 7);	/* !!! (12/10/99) */
+				    trackPitch(st->prev_pitch, &st->pitTrack[curTrack]);
+				pitCand = melpe_shl(st->pitTrack[curTrack].pit[index1], 7);	/* !!! (12/10/99) */
 				index2 =
 				    trackPitch(par[0].pitch,
-					       &pitTrack[curTrack]);
+					       &st->pitTrack[curTrack]);
 				w1_w2 =
-				    melpe_sub(pitTrack[curTrack].weight[index1],
-					pitTrack[curTrack].weight[index2]);
+				    melpe_sub(st->pitTrack[curTrack].weight[index1],
+					st->pitTrack[curTrack].weight[index2]);
 
 				if (multiCheck(par[0].pitch, pitCand) <
 				    X008_Q15) {
@@ -629,38 +622,38 @@ void sc_ana(struct melp_param *par)
 			} else
 			    if ((L_ratio
 				 (par[0].pitch,
-				  (int32_t) (prev_pitch * 2)) < X008_Q15)
+				  (int32_t) (st->prev_pitch * 2)) < X008_Q15)
 				||
 				(L_ratio
 				 (par[0].pitch,
-				  (int32_t) (prev_pitch * 3)) < X008_Q15)) {
+				  (int32_t) (st->prev_pitch * 3)) < X008_Q15)) {
 				/* possible it is a double pitch */
-				pitCand = pitLookahead(&pitTrack[curTrack], 4);
-				if (ratio(pitCand, prev_pitch) < X01_Q15)
+				pitCand = pitLookahead(&st->pitTrack[curTrack], 4);
+				if (ratio(pitCand, st->prev_pitch) < X01_Q15)
 					par[0].pitch = pitCand;
 			}
 		}
 	}
 
 	/* ======== The second frame ======== */
-	prev_pitch = melpe_shl(melpe_shr(par[0].pitch, 7), 7);	/* r_ounding to Q7 integer. */
+	st->prev_pitch = melpe_shl(melpe_shr(par[0].pitch, 7), 7);	/* r_ounding to Q7 integer. */
 	curTrack = CUR_TRACK + 2;
 	if (!uv[2])
-		voicedCnt++;
+		st->voicedCnt++;
 	else
-		voicedCnt = 0;
+		st->voicedCnt = 0;
 
-	if (!uv[2] && !subenergyRelation1(classStat, curTrack)) {
-		if ((voicedCnt < 2) || subenergyRelation2(classStat, curTrack)) {
+	if (!uv[2] && !subenergyRelation1(st->classStat, curTrack)) {
+		if ((st->voicedCnt < 2) || subenergyRelation2(st->classStat, curTrack)) {
 
 			/* Got onset position, should look forward for pitch */
-			pitCand = pitLookahead(&pitTrack[curTrack], 3);
+			pitCand = pitLookahead(&st->pitTrack[curTrack], 3);
 			if (ratio(par[1].pitch, pitCand) > X015_Q15) {
 				if (ratio(pitCand, par[2].pitch) < X015_Q15)
 					par[1].pitch = pitCand;
 				else {
 					npitch =
-					    pitLookahead(&pitTrack
+					    pitLookahead(&st->pitTrack
 							 [curTrack + 1], 3);
 					if (ratio(npitch, par[2].pitch) <
 					    X015_Q15) {
@@ -678,42 +671,42 @@ void sc_ana(struct melp_param *par)
 			}
 		} else if (!uv[1]) {
 			/* not onset not offset, just check pitch smooth */
-			temp1 = melpe_sub(par[1].pitch, prev_pitch);
+			temp1 = melpe_sub(par[1].pitch, st->prev_pitch);
 			index1 = melpe_shr(temp1, 7);
 			temp2 = melpe_sub(par[2].pitch, par[1].pitch);
 			index2 = melpe_shr(temp2, 7);
-			pitCand = pitLookahead(&pitTrack[curTrack], 3);
+			pitCand = pitLookahead(&st->pitTrack[curTrack], 3);
 			if ((melpe_abs_s(index1) > 5) && (melpe_abs_s(index2) > 5) &&
 			    (index1 * index2 < 0)) {
 				/* here is a pitch jump */
-				if ((ratio(prev_pitch, pitCand) < X015_Q15) ||
+				if ((ratio(st->prev_pitch, pitCand) < X015_Q15) ||
 				    (ratio(pitCand, par[2].pitch) < X02_Q15))
 					par[1].pitch = pitCand;
 				else {
 					/*      par[1].pitch = (prev_pitch + par[2].pitch)/2; */
-					temp1 = melpe_shr(prev_pitch, 1);
+					temp1 = melpe_shr(st->prev_pitch, 1);
 					temp2 = melpe_shr(par[2].pitch, 1);
 					par[1].pitch = melpe_add(temp1, temp2);	/* Q7 */
 				}
-			} else if ((ratio(par[1].pitch, prev_pitch) > X015_Q15)
+			} else if ((ratio(par[1].pitch, st->prev_pitch) > X015_Q15)
 				   &&
-				   ((ratio(par[2].pitch, prev_pitch) < X015_Q15)
-				    || (ratio(pitCand, prev_pitch) <
+				   ((ratio(par[2].pitch, st->prev_pitch) < X015_Q15)
+				    || (ratio(pitCand, st->prev_pitch) <
 					X015_Q15))) {
-				if (ratio(pitCand, prev_pitch) < X015_Q15)
+				if (ratio(pitCand, st->prev_pitch) < X015_Q15)
 					par[1].pitch = pitCand;
 				else {
 					index1 =
-					    trackPitch(prev_pitch,
-						       &pitTrack[curTrack]);
-					pitCand = melpe_shl(pitTrack[curTrack].pit[index1], 7);	/* !!! (12/10/99) */
+					    trackPitch(st->prev_pitch,
+						       &st->pitTrack[curTrack]);
+					pitCand = melpe_shl(st->pitTrack[curTrack].pit[index1], 7);	/* !!! (12/10/99) */
 					index2 =
 					    trackPitch(par[1].pitch,
-						       &pitTrack[curTrack]);
+						       &st->pitTrack[curTrack]);
 					w1_w2 =
-					    melpe_sub(pitTrack[curTrack].
+					    melpe_sub(st->pitTrack[curTrack].
 						weight[index1],
-						pitTrack[curTrack].
+						st->pitTrack[curTrack].
 						weight[index2]);
 
 					if (multiCheck(par[1].pitch, pitCand) <
@@ -728,37 +721,37 @@ void sc_ana(struct melp_param *par)
 			} else
 			    if ((L_ratio
 				 (par[1].pitch,
-				  (int32_t) (prev_pitch * 2)) < X008_Q15)
+				  (int32_t) (st->prev_pitch * 2)) < X008_Q15)
 				||
 				(L_ratio
 				 (par[1].pitch,
-				  (int32_t) (prev_pitch * 3)) < X008_Q15)) {
+				  (int32_t) (st->prev_pitch * 3)) < X008_Q15)) {
 				/* possible it is a double pitch */
-				pitCand = pitLookahead(&pitTrack[curTrack], 4);
-				if (ratio(pitCand, prev_pitch) < X01_Q15)
+				pitCand = pitLookahead(&st->pitTrack[curTrack], 4);
+				if (ratio(pitCand, st->prev_pitch) < X01_Q15)
 					par[1].pitch = pitCand;
 			}
 		}
 	}
 
 	/* ======== The third frame ======== */
-	prev_pitch = melpe_shl(melpe_shr(par[1].pitch, 7), 7);
+	st->prev_pitch = melpe_shl(melpe_shr(par[1].pitch, 7), 7);
 	curTrack = CUR_TRACK + 4;
 	if (!uv[3])
-		voicedCnt++;
+		st->voicedCnt++;
 	else
-		voicedCnt = 0;
+		st->voicedCnt = 0;
 
-	if (!uv[3] && (classStat[curTrack + 1].classy == VOICED) &&
-	    (classStat[curTrack + 2].classy == VOICED) &&
-	    !subenergyRelation1(classStat, curTrack)) {
-		if ((voicedCnt < 2) || subenergyRelation2(classStat, curTrack)) {
+	if (!uv[3] && (st->classStat[curTrack + 1].classy == VOICED) &&
+	    (st->classStat[curTrack + 2].classy == VOICED) &&
+	    !subenergyRelation1(st->classStat, curTrack)) {
+		if ((st->voicedCnt < 2) || subenergyRelation2(st->classStat, curTrack)) {
 
 			/* Got onset position, should look forward for pitch */
-			pitCand = pitLookahead(&pitTrack[curTrack], 2);
+			pitCand = pitLookahead(&st->pitTrack[curTrack], 2);
 			if (ratio(par[2].pitch, pitCand) > X015_Q15) {
 				npitch =
-				    pitLookahead(&pitTrack[curTrack + 1], 1);
+				    pitLookahead(&st->pitTrack[curTrack + 1], 1);
 				if (ratio(npitch, pitCand) < X015_Q15)
 					par[2].pitch = pitCand;
 				else if (ratio(par[2].pitch, npitch) >=
@@ -767,27 +760,27 @@ void sc_ana(struct melp_param *par)
 			}
 		} else if (!uv[2]) {
 			/* not onset not offset, just check pitch smooth */
-			pitCand = pitLookahead(&pitTrack[curTrack], 2);
-			temp1 = melpe_sub(par[2].pitch, prev_pitch);
+			pitCand = pitLookahead(&st->pitTrack[curTrack], 2);
+			temp1 = melpe_sub(par[2].pitch, st->prev_pitch);
 			index1 = melpe_shr(temp1, 7);
 			temp2 = melpe_sub(pitCand, par[2].pitch);
 			index2 = melpe_shr(temp2, 7);
 			if ((melpe_abs_s(index1) > 5) && (melpe_abs_s(index2) > 5) &&
 			    (index1 * index2 < 0)) {
 				/* here is a pitch jump */
-				if (ratio(prev_pitch, pitCand) < X015_Q15)
+				if (ratio(st->prev_pitch, pitCand) < X015_Q15)
 					par[2].pitch = pitCand;
 				else {
 					index1 =
 					    trackPitch(pitCand,
-						       &pitTrack[curTrack]);
+						       &st->pitTrack[curTrack]);
 					index2 =
 					    trackPitch(par[2].pitch,
-						       &pitTrack[curTrack]);
+						       &st->pitTrack[curTrack]);
 					w1_w2 =
-					    melpe_sub(pitTrack[curTrack].
+					    melpe_sub(st->pitTrack[curTrack].
 						weight[index1],
-						pitTrack[curTrack].
+						st->pitTrack[curTrack].
 						weight[index2]);
 
 					if (multiCheck(par[2].pitch, pitCand) <
@@ -798,19 +791,19 @@ void sc_ana(struct melp_param *par)
 							par[2].pitch = pitCand;
 					} else {
 						index1 =
-						    trackPitch(prev_pitch,
-							       &pitTrack
+						    trackPitch(st->prev_pitch,
+							       &st->pitTrack
 							       [curTrack]);
-						pitCand = melpe_shl(pitTrack[curTrack].pit[index1], 7);	/* !!! (12/10/99) */
+						pitCand = melpe_shl(st->pitTrack[curTrack].pit[index1], 7);	/* !!! (12/10/99) */
 
 						/* Note that w1 = pitTrack[curTrack].weight[index1]   */
 						/* has ben modified from the value outside of the if  */
 						/* condition.                                         */
 
 						w1_w2 =
-						    melpe_sub(pitTrack[curTrack].
+						    melpe_sub(st->pitTrack[curTrack].
 							weight[index1],
-							pitTrack[curTrack].
+							st->pitTrack[curTrack].
 							weight[index2]);
 						if (multiCheck
 						    (par[2].pitch,
@@ -826,7 +819,7 @@ void sc_ana(struct melp_param *par)
 						} else {
 							/*      par[2].pitch = (prev_pitch + pitCand)/2; */
 							temp1 =
-							    melpe_shr(prev_pitch, 1);
+							    melpe_shr(st->prev_pitch, 1);
 							temp2 = melpe_shr(pitCand, 1);
 							par[2].pitch = melpe_add(temp1, temp2);	/* Q7 */
 						}
@@ -838,7 +831,7 @@ void sc_ana(struct melp_param *par)
 
 	/* ======== Try smooth voicing information ======== */
 
-	sbp[0] = prev_sbp3;
+	sbp[0] = st->prev_sbp3;
 	for (i = 0; i < NF; i++) {
 
 		/* Make a copy of par[i].bpvc because the function q_bpvc() will      */
@@ -868,7 +861,7 @@ void sc_ana(struct melp_param *par)
 	for (i = 1; i < NF; i++) {
 		curTrack = (int16_t) (CUR_TRACK + (i - 1) * 2);
 		if ((sbp[i - 1] > 12) && (sbp[i + 1] > 12)) {
-			if ((classStat[curTrack].subEnergy > voicedEn - X05_Q11)
+			if ((st->classStat[curTrack].subEnergy > st->voicedEn - X05_Q11)
 			    || ((par[i - 1].bpvc[2] > X05_Q14)
 				&& (par[i - 1].bpvc[3] > X05_Q14))) {
 				if (sbp[i] < 12)
@@ -878,14 +871,14 @@ void sc_ana(struct melp_param *par)
 					sbp[i] = 8;
 			}
 		} else if ((sbp[i - 1] > 8) && (sbp[i + 1] > 8)) {
-			if ((classStat[curTrack].subEnergy > voicedEn - ONE_Q11)
+			if ((st->classStat[curTrack].subEnergy > st->voicedEn - ONE_Q11)
 			    || ((par[i - 1].bpvc[2] > X04_Q14)
 				&& (par[i - 1].bpvc[3] > X04_Q14))) {
 				if (sbp[i] < 8)
 					sbp[i] = 8;
 			}
 		} else if ((sbp[i - 1] < 8) && (sbp[i + 1] < 8)) {
-			if ((classStat[curTrack].subEnergy < voicedEn - X05_Q11)
+			if ((st->classStat[curTrack].subEnergy < st->voicedEn - X05_Q11)
 			    && (par[i - 1].bpvc[3] < X07_Q14)) {
 				if (sbp[i] > 12)
 					sbp[i] = 12;
@@ -894,12 +887,12 @@ void sc_ana(struct melp_param *par)
 	}
 
 	curTrack = CUR_TRACK + 4;
-	if ((classStat[curTrack].subEnergy > voicedEn - X03_Q11) &&
+	if ((st->classStat[curTrack].subEnergy > st->voicedEn - X03_Q11) &&
 	    (sbp[2] > 12) && (par[1].bpvc[2] > X05_Q14) &&
 	    (par[1].bpvc[3] > X05_Q14)) {
 		if (sbp[3] < 12)
 			sbp[3] = 12;
-	} else if ((classStat[curTrack].subEnergy > voicedEn - X05_Q11) &&
+	} else if ((st->classStat[curTrack].subEnergy > st->voicedEn - X05_Q11) &&
 		   (sbp[2] > 8) && (par[1].bpvc[2] > X045_Q14) &&
 		   (par[1].bpvc[3] > X045_Q14)) {
 		if (sbp[3] < 8)
@@ -919,37 +912,37 @@ void sc_ana(struct melp_param *par)
 		par[i].bpvc[0] = temp1;
 	}
 
-	prev_sbp3 = sbp[3];
+	st->prev_sbp3 = sbp[3];
 
 	/* ======== Update voiced and unvoiced counters ======== */
 	for (i = 0; i < NF; i++) {
 		curTrack = (int16_t) (i * PIT_SUBNUM + CUR_TRACK);
 
 		/* ---- update voiced energy ---- */
-		if (voicedCnt > 2) {
+		if (st->voicedCnt > 2) {
 			/*      voicedEn = log10(EN_UP_RATE * pow(10.0, voicedEn) +
 			   (1.0 - EN_UP_RATE) * 
 			   pow(10.0, classStat[curTrack].subEnergy)); */
-			voicedEn = updateEn(voicedEn, EN_UP_RATE_Q15,
-					    classStat[curTrack].subEnergy);
+			st->voicedEn = updateEn(st->voicedEn, EN_UP_RATE_Q15,
+					    st->classStat[curTrack].subEnergy);
 		}
-		if (voicedEn < classStat[curTrack].subEnergy)
-			voicedEn = classStat[curTrack].subEnergy;
+		if (st->voicedEn < st->classStat[curTrack].subEnergy)
+			st->voicedEn = st->classStat[curTrack].subEnergy;
 	}
 
 	/* ======== Update class and pitch structures ======== */
 	for (i = 0; i < TRACK_NUM - NF * PIT_SUBNUM; i++) {
-		classStat[i] = classStat[i + NF * PIT_SUBNUM];
-		pitTrack[i] = pitTrack[i + NF * PIT_SUBNUM];
+		st->classStat[i] = st->classStat[i + NF * PIT_SUBNUM];
+		st->pitTrack[i] = st->pitTrack[i + NF * PIT_SUBNUM];
 	}
 
-	prev_uv = par[NF - 1].uv_flag;
+	st->prev_uv = par[NF - 1].uv_flag;
 
 	/* Set prev_pitch to par[NF - 1].pitch so that it is an integer for its   */
 	/* Q value.  We first use shr() to truncate par[NF - 1].pitch and then    */
 	/* use shl() to correct the Q value.                                      */
 
-	prev_pitch = melpe_shl(melpe_shr(par[NF - 1].pitch, 7), 7);
+	st->prev_pitch = melpe_shl(melpe_shr(par[NF - 1].pitch, 7), 7);
 }
 
 static BOOLEAN subenergyRelation1(classParam classStat[], int16_t curTrack)
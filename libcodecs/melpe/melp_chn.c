@@ -65,6 +65,7 @@ Secretariat fax: +33 493 65 47 16.
 #include "dsp_sub.h"
 #include "fec_code.h"
 #include "macro.h"
+#include "state.h"
 
 #define X0333_Q15		10923	/* (1.0/3.0) * (1 << 15) */
 #define X0667_Q15		21845	/* (2.0/3.0) * (1 << 15) */
@@ -99,14 +100,10 @@ static int16_t bit_order[NUM_CH_BITS] = {
 };
 #endif
 
-/* Define bit buffer */
-static unsigned char bit_buffer[NUM_CH_BITS];
-
-static int16_t sync_bit = 0;	/* sync bit */
-
 int16_t parity(int16_t x, int16_t leng);
 
-void melp_chn_write(struct quant_param *qpar, unsigned char chbuf[])
+void melp_chn_write(struct melpe_enc *st, struct quant_param *qpar,
+		    unsigned char chbuf[])
 {
 	register int16_t i;
 	unsigned char *bit_ptr;
@@ -116,14 +113,14 @@ void melp_chn_write(struct quant_param *qpar, unsigned char chbuf[])
 	fec_code(qpar);
 
 	/* Fill bit buffer */
-	bit_ptr = bit_buffer;
+	bit_ptr = st->bit_buffer;
 	bit_cntr = 0;
 
 	pack_code(qpar->gain_index[1], &bit_ptr, &bit_cntr, 5, 1);
 
 	/* Toggle and write sync bit */
-	sync_bit = melpe_sub(1, sync_bit);
-	pack_code(sync_bit, &bit_ptr, &bit_cntr, 1, 1);
+	st->sync_bit = melpe_sub(1, st->sync_bit);
+	pack_code(st->sync_bit, &bit_ptr, &bit_cntr, 1, 1);
 
 	pack_code(qpar->gain_index[0], &bit_ptr, &bit_cntr, 3, 1);
 	pack_code(qpar->pitch_index, &bit_ptr, &bit_cntr, PIT_BITS, 1);
@@ -140,14 +137,15 @@ void melp_chn_write(struct quant_param *qpar, unsigned char chbuf[])
 	qpar->chptr = chbuf;
 	qpar->chbit = 0;
 	for (i = 0; i < bitNum24; i++) {
-		pack_code(bit_buffer[bit_order[i]], &qpar->chptr, &qpar->chbit,
+		pack_code(st->bit_buffer[bit_order[i]], &qpar->chptr, &qpar->chbit,
 			  1, chwordsize);
 		if (i == 0)	/* set beginning of frame bit */
 			*(qpar->chptr) |= (uint16_t) 0x8000;
 	}
 }
 
-BOOLEAN melp_chn_read(struct quant_param *qpar, struct melp_param *par,
+BOOLEAN melp_chn_read(struct melpe_dec *st, struct quant_param *qpar,
+		      struct melp_param *par,
 		      struct melp_param *prev_par, unsigned char chbuf[])
 {
 	register int16_t i;
@@ -156,18 +154,18 @@ BOOLEAN melp_chn_read(struct quant_param *qpar, struct melp_param *par,
 	int16_t index, bit_cntr, dontcare;
 
 	/* Read channel output buffer into bit buffer */
-	bit_ptr = bit_buffer;
+	bit_ptr = st->bit_buffer;
 	qpar->chptr = chbuf;
 	qpar->chbit = 0;
 	for (i = 0; i < bitNum24; i++) {
 		erase |= unpack_code(&(qpar->chptr), &(qpar->chbit), &index, 1,
 				     chwordsize, ERASE_MASK);
-		bit_buffer[bit_order[i]] = (unsigned char)index;
+		st->bit_buffer[bit_order[i]] = (unsigned char)index;
 		bit_ptr++;
 	}
 
 	/* Read information from  bit buffer */
-	bit_ptr = bit_buffer;
+	bit_ptr = st->bit_buffer;
 	bit_cntr = 0;
 
 	(void)unpack_code(&bit_ptr, &bit_cntr, &qpar->gain_index[1], 5, 1, 0);
@@ -214,7 +212,7 @@ BOOLEAN melp_chn_read(struct quant_param *qpar, struct melp_param *par,
 				&(qpar->fsvq_index), &dontcare, 1, NUM_HARM, 0);
 
 		/* Decode gain terms with uniform log quantizer */
-		q_gain_dec(par->gain, qpar->gain_index, GN_QLO_Q8, GN_QUP_Q8,
+		q_gain_dec(st, par->gain, qpar->gain_index, GN_QLO_Q8, GN_QUP_Q8,
 			   GN_QLEV_M1_Q10, 5);
 
 		/* Decode voicing information */
@@ -259,7 +257,7 @@ BOOLEAN melp_chn_read(struct quant_param *qpar, struct melp_param *par,
 ** Return value:	None
 **
 *****************************************************************************/
-void low_rate_chn_write(struct quant_param *qpar)
+void low_rate_chn_write(struct melpe_enc *st, struct quant_param *qpar)
 {
 	register int16_t i;
 	int16_t bit_cntr, cnt;
@@ -272,12 +270,12 @@ void low_rate_chn_write(struct quant_param *qpar)
 	low_rate_fec_code(qpar);
 
 	/* ====== Fill bit buffer ====== */
-	bit_ptr = bit_buffer;
+	bit_ptr = st->bit_buffer;
 	bit_cntr = 0;
 
 	/* ====== Toggle and write sync bit ====== */
-	sync_bit = melpe_sub(1, sync_bit);
-	pack_code(sync_bit, &bit_ptr, &bit_cntr, 1, 1);
+	st->sync_bit = melpe_sub(1, st->sync_bit);
+	pack_code(st->sync_bit, &bit_ptr, &bit_cntr, 1, 1);
 
 	/* ===== Count the number of voiced frame ===== */
 	cnt = 0;
@@ -430,10 +428,10 @@ void low_rate_chn_write(struct quant_param *qpar)
 	pack_code(qpar->jit_index[0], &bit_ptr, &bit_cntr, 1, 1);
 
 	/* ======== Write channel output buffer ======== */
-	qpar->chptr = chbuf;
+	qpar->chptr = st->chbuf;
 	qpar->chbit = 0;
 	for (i = 0; i < bitNum12; i++) {
-		pack_code(bit_buffer[i], &qpar->chptr, &qpar->chbit, 1,
+		pack_code(st->bit_buffer[i], &qpar->chptr, &qpar->chbit, 1,
 			  chwordsize);
 		if (i == 0)
 			*(qpar->chptr) |= 0x8000;	/* set beginning of frame bit */
@@ -453,14 +451,11 @@ void low_rate_chn_write(struct quant_param *qpar)
 ** Return value:	None
 **
 *****************************************************************************/
-int16_t low_rate_chn_read(struct quant_param *qpar, struct melp_param *par,
+int16_t low_rate_chn_read(struct melpe_dec *st, struct quant_param *qpar,
+			  struct melp_param *par,
 			    struct melp_param *prev_par)
 {
 	register int16_t i, j, k;
-	static int16_t prev_uv = 1;
-	static int16_t prev_fsmag[NUM_HARM];
-	static int16_t qplsp[LPC_ORD], prev_gain[2 * NF * NUM_GAINFR];
-	static int16_t firstTime = TRUE;
 	const int16_t *codebook;
 	int16_t erase = 0, lsp_check[NF] = { 0, 0, 0 };
 	int16_t bit_cntr, bit_cntr1, cnt, last, index, dontcare;
@@ -488,33 +483,18 @@ int16_t low_rate_chn_read(struct quant_param *qpar, struct melp_param *par,
 	/* of w_fs_inv[] and w_fs[] do not yield the original data.  Modifica-    */
 	/* tions are made to remove this to and fro inversions.                   */
 
-	if (firstTime) {	/* Initialization */
-		temp2 = melpe_shl(LPC_ORD, 10);	/* Q10 */
-		temp1 = X08_Q10;	/* Q10 */
-		for (i = 0; i < LPC_ORD; i++) {
-			/*      qplsp[i] = (i + 1)*0.8/LPC_ORD; */
-			qplsp[i] = melpe_divide_s(temp1, temp2);
-			temp1 = melpe_add(temp1, X08_Q10);
-		}
-
-		fill(prev_gain, 2560, 2 * NF * NUM_GAINFR);
-		fill(prev_fsmag, ONE_Q13, NUM_HARM);
-
-		firstTime = FALSE;
-	}
-
 	/* ======== Read channel output buffer into bit buffer ======== */
-	bit_ptr = bit_buffer;
-	qpar->chptr = chbuf;
+	bit_ptr = st->bit_buffer;
+	qpar->chptr = st->chbuf;
 	qpar->chbit = 0;
 	for (i = 0; i < bitNum12; i++) {
 		erase |= unpack_code(&qpar->chptr, &qpar->chbit, &index, 1,
 				     chwordsize, ERASE_MASK);
-		bit_buffer[i] = (unsigned char)index;
+		st->bit_buffer[i] = (unsigned char)index;
 		bit_ptr++;
 	}
 
-	bit_ptr = bit_buffer;
+	bit_ptr = st->bit_buffer;
 	bit_cntr = 0;
 
 	/* ====== Read sync bit ====== */
@@ -1060,14 +1040,14 @@ int16_t low_rate_chn_read(struct quant_param *qpar, struct melp_param *par,
 				/*      ilsp1[j] = inpCoef[i][j] * qplsp[j] +
 				   (1.0 - inpCoef[i][j]) * par[2].lsf[j]; */
 				intfact = inpCoef[i][j];	/* Q14 */
-				L_acc = melpe_L_mult(intfact, qplsp[j]);	/* Q14 */
+				L_acc = melpe_L_mult(intfact, st->qplsp[j]);	/* Q14 */
 				intfact = melpe_sub(ONE_Q14, intfact);
 				L_acc = melpe_L_mac(L_acc, intfact, par[2].lsf[j]);
 				ilsp1[j] = melpe_extract_h(melpe_L_shl(L_acc, 1));	/* Q15 */
 				/*      ilsp2[j] = inpCoef[i][j+10] * qplsp[j] +
 				   (1.0 - inpCoef[i][j + LPC_ORD]) * par[2].lsf[j]; */
 				intfact = inpCoef[i][j + LPC_ORD];	/* Q14 */
-				L_acc = melpe_L_mult(intfact, qplsp[j]);	/* Q14 */
+				L_acc = melpe_L_mult(intfact, st->qplsp[j]);	/* Q14 */
 				intfact = melpe_sub(ONE_Q14, intfact);
 				L_acc = melpe_L_mac(L_acc, intfact, par[2].lsf[j]);
 				ilsp2[j] = melpe_extract_h(melpe_L_shl(L_acc, 1));	/* Q15 */
@@ -1155,11 +1135,11 @@ int16_t low_rate_chn_read(struct quant_param *qpar, struct melp_param *par,
 			lspSort(par[2].lsf, LPC_ORD);
 
 		/* ---- Save for next frame ---- */
-		v_equ(qplsp, par[NF - 1].lsf, LPC_ORD);
+		v_equ(st->qplsp, par[NF - 1].lsf, LPC_ORD);
 	} else {
 		for (i = 0; i < NF; i++)
 			v_equ(par[i].lsf, prev_par->lsf, LPC_ORD);
-		v_equ(qplsp, par[NF - 1].lsf, LPC_ORD);
+		v_equ(st->qplsp, par[NF - 1].lsf, LPC_ORD);
 	}
 
 	/* ====== Decode gain information ====== */
@@ -1186,7 +1166,7 @@ int16_t low_rate_chn_read(struct quant_param *qpar, struct melp_param *par,
 	}
 
 	if (cnt > 1) {
-		if (prev_uv) {	/* U {UVV,VUV,VVU,VVV} */
+		if (st->prev_uv) {	/* U {UVV,VUV,VVU,VVV} */
 			for (i = 0; i < last; i++)
 				if (!par[i].uv_flag)
 					v_equ(par[i].fs_mag, par[last].fs_mag,
@@ -1196,18 +1176,18 @@ int16_t low_rate_chn_read(struct quant_param *qpar, struct melp_param *par,
 				v_equ(par[1].fs_mag, par[last].fs_mag,
 				      NUM_HARM);
 			else if (par[1].uv_flag)	/* V VUV */
-				v_equ(par[0].fs_mag, prev_fsmag, NUM_HARM);
+				v_equ(par[0].fs_mag, st->prev_fsmag, NUM_HARM);
 			else if (par[2].uv_flag) {	/* V VVU */
 				for (i = 0; i < NUM_HARM; i++) {
 					/*      par[0].fs_mag[i] = 0.5*(weighted_fsmag[i] +
 					   prev_fsmag[i]); */
 					temp1 = melpe_shr(weighted_fsmag[i], 1);	/* Q13 */
-					temp2 = melpe_shr(prev_fsmag[i], 1);	/* Q13 */
+					temp2 = melpe_shr(st->prev_fsmag[i], 1);	/* Q13 */
 					par[0].fs_mag[i] = melpe_add(temp1, temp2);	/* Q13 */
 				}
 			} else {	/* V VVV */
 				for (i = 0; i < NUM_HARM; i++) {
-					p_value = prev_fsmag[i];
+					p_value = st->prev_fsmag[i];
 					q_value = weighted_fsmag[i];
 
 					/*      par[0].fs_mag[i] = (p + p + q)/3.0; */
@@ -1223,12 +1203,12 @@ int16_t low_rate_chn_read(struct quant_param *qpar, struct melp_param *par,
 		}
 	}
 
-	prev_uv = par[NF - 1].uv_flag;
+	st->prev_uv = par[NF - 1].uv_flag;
 	if (par[NF - 1].uv_flag) {
-		fill(prev_fsmag, ONE_Q13, NUM_HARM);
-		window_Q(prev_fsmag, w_fs, prev_fsmag, NUM_HARM, 14);
+		fill(st->prev_fsmag, ONE_Q13, NUM_HARM);
+		window_Q(st->prev_fsmag, w_fs, st->prev_fsmag, NUM_HARM, 14);
 	} else
-		v_equ(prev_fsmag, par[NF - 1].fs_mag, NUM_HARM);
+		v_equ(st->prev_fsmag, par[NF - 1].fs_mag, NUM_HARM);
 
 	/* ====== Decode jitter information ====== */
 	for (i = 0; i < NF; i++) {
@@ -1293,7 +1273,7 @@ int16_t low_rate_chn_read(struct quant_param *qpar, struct melp_param *par,
 
 		L_sum1 = 0;
 		for (i = 0; i < 2 * NF * NUM_GAINFR; i++)
-			L_sum1 = melpe_L_add(L_sum1, melpe_L_deposit_l(prev_gain[i]));
+			L_sum1 = melpe_L_add(L_sum1, melpe_L_deposit_l(st->prev_gain[i]));
 		L_sum1 = melpe_L_shr(L_sum1, 1);
 
 		L_sum2 = 0;
@@ -1321,10 +1301,10 @@ int16_t low_rate_chn_read(struct quant_param *qpar, struct melp_param *par,
 	}
 
 	for (i = 0; i < NF * NUM_GAINFR; i++)
-		prev_gain[i] = prev_gain[i + NF * NUM_GAINFR];
+		st->prev_gain[i] = st->prev_gain[i + NF * NUM_GAINFR];
 	for (i = 0; i < NF; i++) {
 		for (j = 0; j < NUM_GAINFR; j++)
-			prev_gain[NF * NUM_GAINFR + i * NUM_GAINFR + j] =
+			st->prev_gain[NF * NUM_GAINFR + i * NUM_GAINFR + j] =
 			    par[i].gain[j];
 	}
 
@@ -1338,9 +1318,9 @@ int16_t low_rate_chn_read(struct quant_param *qpar, struct melp_param *par,
 			fill(&(par[i].fs_mag[0]), ONE_Q13, NUM_HARM);
 			par[i].jitter = MAX_JITTER_Q15;
 		}
-		v_equ(qplsp, par[NF - 1].lsf, LPC_ORD);
-		prev_uv = 1;
-		fill(prev_fsmag, ONE_Q13, NUM_HARM);
+		v_equ(st->qplsp, par[NF - 1].lsf, LPC_ORD);
+		st->prev_uv = 1;
+		fill(st->prev_fsmag, ONE_Q13, NUM_HARM);
 	} else if (erase_uuu) {
 		for (i = 0; i < NF; i++) {
 			par[i].pitch = UV_PITCH_Q7;
@@ -1349,15 +1329,15 @@ int16_t low_rate_chn_read(struct quant_param *qpar, struct melp_param *par,
 			par[i].jitter = MAX_JITTER_Q15;
 		}
 
-		prev_uv = 1;
-		fill(prev_fsmag, ONE_Q13, NUM_HARM);
+		st->prev_uv = 1;
+		fill(st->prev_fsmag, ONE_Q13, NUM_HARM);
 	} else if (erase_vvv) {
 		for (i = 0; i < NF; i++) {
 			fill(&(par[i].bpvc[1]), 0, NUM_BANDS - 1);
 			fill(&(par[i].fs_mag[0]), ONE_Q13, NUM_HARM);
 		}
-		prev_uv = 0;
-		fill(prev_fsmag, ONE_Q13, NUM_HARM);
+		st->prev_uv = 0;
+		fill(st->prev_fsmag, ONE_Q13, NUM_HARM);
 	}
 
 	/* Return erase flag */
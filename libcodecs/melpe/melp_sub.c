@@ -43,6 +43,7 @@ Secretariat fax: +33 493 65 47 16.
 #include "constant.h"
 #include "coeff.h"
 #include "global.h"
+#include "state.h"
 
 /* Filter orders */
 
@@ -74,34 +75,17 @@ Secretariat fax: +33 493 65 47 16.
 /*                                                                            */
 /* Q values: speech - Q0, fpitch - Q7, bpvc - Q14, pitch - Q7                 */
 
-void bpvc_ana(int16_t speech[], int16_t fpitch[], int16_t bpvc[],
+void bpvc_ana(struct melpe_enc *st, int16_t speech[], int16_t fpitch[],
+	      int16_t bpvc[],
 	      int16_t * pitch)
 {
 	register int16_t i, section;
-	static int16_t bpfsp[NUM_BANDS][PITCH_FR - FRAME];
-	static int16_t bpfdelin[NUM_BANDS][BPF_ORD];
-	static int16_t bpfdelout[NUM_BANDS][BPF_ORD];
-	static int16_t envdel[NUM_BANDS][ENV_ORD];
-	static int16_t envdel2[NUM_BANDS];
-	static BOOLEAN firstTime = TRUE;
 	int16_t sigbuf[BPF_ORD + PITCH_FR];
 	int16_t pcorr, temp, scale;
 	int16_t filt_index;
 
-	if (firstTime) {
-		for (i = 0; i < NUM_BANDS; i++) {
-			v_zap(bpfsp[i], PITCH_FR - FRAME);
-			v_zap(bpfdelin[i], BPF_ORD);
-			v_zap(bpfdelout[i], BPF_ORD);
-		}
-		for (i = 0; i < NUM_BANDS; i++)
-			v_zap(envdel[i], ENV_ORD);
-		v_zap(envdel2, NUM_BANDS);
-		firstTime = FALSE;
-	}
-
 	/* Filter lowest band and estimate pitch */
-	v_equ(&sigbuf[BPF_ORD], bpfsp[0], PITCH_FR - FRAME);
+	v_equ(&sigbuf[BPF_ORD], st->bpfsp[0], PITCH_FR - FRAME);
 	v_equ(&sigbuf[BPF_ORD + PITCH_FR - FRAME],
 	      &speech[PITCH_FR - FRAME - PITCHMAX], FRAME);
 
@@ -109,10 +93,10 @@ void bpvc_ana(int16_t speech[], int16_t fpitch[], int16_t bpvc[],
 		iir_2nd_s(&sigbuf[BPF_ORD + PITCH_FR - FRAME],
 			  &bpf_den[section * 3], &bpf_num[section * 3],
 			  &sigbuf[BPF_ORD + PITCH_FR - FRAME],
-			  &bpfdelin[0][section * 2], &bpfdelout[0][section * 2],
+			  &st->bpfdelin[0][section * 2], &st->bpfdelout[0][section * 2],
 			  FRAME);
 	}
-	v_equ(bpfsp[0], &sigbuf[BPF_ORD + FRAME], PITCH_FR - FRAME);
+	v_equ(st->bpfsp[0], &sigbuf[BPF_ORD + FRAME], PITCH_FR - FRAME);
 
 	/* Scale signal for pitch correlations */
 	f_pitch_scale(&sigbuf[BPF_ORD], &sigbuf[BPF_ORD], PITCH_FR);
@@ -137,7 +121,7 @@ void bpvc_ana(int16_t speech[], int16_t fpitch[], int16_t bpvc[],
 	/* Calculate bandpass voicing for frames */
 	for (i = 1; i < NUM_BANDS; i++) {
 		/* Bandpass filter input speech */
-		v_equ(&sigbuf[BPF_ORD], bpfsp[i], PITCH_FR - FRAME);
+		v_equ(&sigbuf[BPF_ORD], st->bpfsp[i], PITCH_FR - FRAME);
 		v_equ(&sigbuf[BPF_ORD + PITCH_FR - FRAME],
 		      &speech[PITCH_FR - FRAME - PITCHMAX], FRAME);
 
@@ -147,10 +131,10 @@ void bpvc_ana(int16_t speech[], int16_t fpitch[], int16_t bpvc[],
 			iir_2nd_s(&sigbuf[BPF_ORD + PITCH_FR - FRAME],
 				  &bpf_den[filt_index], &bpf_num[filt_index],
 				  &sigbuf[BPF_ORD + PITCH_FR - FRAME],
-				  &bpfdelin[i][section * 2],
-				  &bpfdelout[i][section * 2], FRAME);
+				  &st->bpfdelin[i][section * 2],
+				  &st->bpfdelout[i][section * 2], FRAME);
 		}
-		v_equ(bpfsp[i], &sigbuf[BPF_ORD + FRAME], PITCH_FR - FRAME);
+		v_equ(st->bpfsp[i], &sigbuf[BPF_ORD + FRAME], PITCH_FR - FRAME);
 
 		/* Scale signal for pitch correlations */
 		scale =
@@ -163,13 +147,13 @@ void bpvc_ana(int16_t speech[], int16_t fpitch[], int16_t bpvc[],
 
 		/* Calculate envelope of bandpass filtered input speech */
 		/* update delay buffers without scaling */
-		temp = melpe_shr(envdel2[i], scale);
-		envdel2[i] =
+		temp = melpe_shr(st->envdel2[i], scale);
+		st->envdel2[i] =
 		    melpe_shr(sigbuf[BPF_ORD + FRAME - 1], (int16_t) (-scale));
-		v_equ_shr(&sigbuf[BPF_ORD - ENV_ORD], envdel[i], scale,
+		v_equ_shr(&sigbuf[BPF_ORD - ENV_ORD], st->envdel[i], scale,
 			  ENV_ORD);
 		envelope(&sigbuf[BPF_ORD], temp, &sigbuf[BPF_ORD], PITCH_FR);
-		v_equ_shr(envdel[i], &sigbuf[BPF_ORD + FRAME - ENV_ORD],
+		v_equ_shr(st->envdel[i], &sigbuf[BPF_ORD + FRAME - ENV_ORD],
 			  (int16_t) (-scale), ENV_ORD);
 
 		/* Scale signal for pitch correlations */
@@ -633,11 +617,11 @@ void q_bpvc_dec(int16_t bpvc[], int16_t bpvc_index, BOOLEAN uv_flag,
 /*	Q values:                                                                 */
 /*	*gain - Q8, gn_qlo - Q8, gn_qup - Q8, gn_qlev - Q10                       */
 
-void q_gain(int16_t * gain, int16_t * gain_index, int16_t gn_qlo,
+void q_gain(struct melpe_enc *st, int16_t * gain, int16_t * gain_index,
+	    int16_t gn_qlo,
 	    int16_t gn_qup, int16_t gn_qlev, int16_t gn_qlev_q,
 	    int16_t double_flag, int16_t scale)
 {
-	static int16_t prev_gain = 0;
 	int16_t temp, temp2;
 
 	/* Quantize second gain term with uniform quantizer */
@@ -654,8 +638,8 @@ void q_gain(int16_t * gain, int16_t * gain_index, int16_t gn_qlo,
 
 	/* if (fabs(gain[1] - prev_gain) < GAIN_INT_DB &&
 	   fabs(gain[0] - 0.5*(gain[1]+prev_gain)) < 3.0) */
-	temp = melpe_add(melpe_shr(gain[1], 1), melpe_shr(prev_gain, 1));
-	if (melpe_abs_s(melpe_sub(gain[1], prev_gain)) < GAIN_INT_DB_Q8 &&
+	temp = melpe_add(melpe_shr(gain[1], 1), melpe_shr(st->prev_gain, 1));
+	if (melpe_abs_s(melpe_sub(gain[1], st->prev_gain)) < GAIN_INT_DB_Q8 &&
 	    melpe_abs_s(melpe_sub(gain[0], temp)) < THREE_Q8) {
 
 		/* interpolate and set special code */
@@ -665,12 +649,12 @@ void q_gain(int16_t * gain, int16_t * gain_index, int16_t gn_qlo,
 	} else {
 
 		/* Code intermediate gain with 7-levels */
-		if (prev_gain < gain[1]) {
-			temp = prev_gain;
+		if (st->prev_gain < gain[1]) {
+			temp = st->prev_gain;
 			temp2 = gain[1];
 		} else {
 			temp = gain[1];
-			temp2 = prev_gain;
+			temp2 = st->prev_gain;
 		}
 		temp = melpe_sub(temp, SIX_Q8);
 		temp2 = melpe_add(temp2, SIX_Q8);
@@ -688,14 +672,13 @@ void q_gain(int16_t * gain, int16_t * gain_index, int16_t gn_qlo,
 	}
 
 	/* Update previous gain for next time */
-	prev_gain = gain[1];
+	st->prev_gain = gain[1];
 }
 
-void q_gain_dec(int16_t * gain, int16_t * gain_index, int16_t gn_qlo,
+void q_gain_dec(struct melpe_dec *st, int16_t * gain, int16_t * gain_index,
+		int16_t gn_qlo,
 		int16_t gn_qup, int16_t gn_qlev_q, int16_t scale)
 {
-	static int16_t prev_gain = 0;
-	static BOOLEAN prev_gain_err = FALSE;
 	int16_t temp, temp2;
 
 	/* Decode second gain term */
@@ -704,30 +687,30 @@ void q_gain_dec(int16_t * gain, int16_t * gain_index, int16_t gn_qlo,
 	if (gain_index[0] == 0) {
 
 		/* interpolation bit code for intermediate gain */
-		temp = melpe_sub(gain[1], prev_gain);
+		temp = melpe_sub(gain[1], st->dec_prev_gain);
 		temp = melpe_abs_s(temp);
 		if (temp > GAIN_INT_DB_Q8) {
 			/* Invalid received data (bit error) */
-			if (!prev_gain_err) {
+			if (!st->prev_gain_err) {
 				/* First time: don't allow gain excursion */
-				gain[1] = prev_gain;
+				gain[1] = st->dec_prev_gain;
 			}
-			prev_gain_err = TRUE;
+			st->prev_gain_err = TRUE;
 		} else
-			prev_gain_err = FALSE;
+			st->prev_gain_err = FALSE;
 
 		/* Use interpolated gain value */
 		/* gain[0] = 0.5*(gain[1]+prev_gain); */
-		gain[0] = melpe_add(melpe_shr(gain[1], 1), melpe_shr(prev_gain, 1));
+		gain[0] = melpe_add(melpe_shr(gain[1], 1), melpe_shr(st->dec_prev_gain, 1));
 	} else {
 		/* Decode 7-bit quantizer for first gain term */
-		prev_gain_err = FALSE;
-		if (prev_gain < gain[1]) {
-			temp = prev_gain;
+		st->prev_gain_err = FALSE;
+		if (st->dec_prev_gain < gain[1]) {
+			temp = st->dec_prev_gain;
 			temp2 = gain[1];
 		} else {
 			temp = gain[1];
-			temp2 = prev_gain;
+			temp2 = st->dec_prev_gain;
 		}
 		temp = melpe_sub(temp, SIX_Q8);
 		temp2 = melpe_add(temp2, SIX_Q8);
@@ -744,7 +727,7 @@ void q_gain_dec(int16_t * gain, int16_t * gain_index, int16_t gn_qlo,
 	}
 
 	/* Update previous gain for next time */
-	prev_gain = gain[1];
+	st->dec_prev_gain = gain[1];
 }
 
 /* Name: scale_adj.c                                                          */
@@ -765,10 +748,10 @@ void q_gain_dec(int16_t * gain, int16_t * gain_index, int16_t gn_qlo,
 /*	*speech - Q0                                                              */
 /*	gain - Q12                                                                */
 
-void scale_adj(int16_t * speech, int16_t gain, int16_t length,
+void scale_adj(struct melpe_dec *st, int16_t * speech, int16_t gain,
+	       int16_t length,
 	       int16_t scale_over, int16_t inv_scale_over)
 {
-	static int16_t prev_scale;	/* Previous scale factor, Q13 */
 	register int16_t i;
 	int16_t scale, shift, log_magsq, log_length;
 	int16_t temp;
@@ -833,7 +816,7 @@ void scale_adj(int16_t * speech, int16_t gain, int16_t length,
 		L_temp = melpe_L_mult(temp, inv_scale_over);	/* L_temp in Q30 */
 		L_temp = melpe_L_shl(L_temp, 1);	/* L_temp in Q31 */
 		temp = melpe_extract_h(L_temp);	/* temp in Q15 */
-		interp1 = melpe_L_mult(prev_scale, temp);	/* interp1 in Q29 */
+		interp1 = melpe_L_mult(st->prev_scale, temp);	/* interp1 in Q29 */
 
 		temp = melpe_shl(i, 11);
 		L_temp = melpe_L_mult(temp, inv_scale_over);	/* L_temp in Q30 */
@@ -853,7 +836,7 @@ void scale_adj(int16_t * speech, int16_t gain, int16_t length,
 		    (int16_t) (length - scale_over + 1), 2);
 
 	/* Update previous scale factor for next call */
-	prev_scale = scale;
+	st->prev_scale = scale;
 
 	v_free(tempbuf);
 }
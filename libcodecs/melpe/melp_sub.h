@@ -36,7 +36,8 @@ Secretariat fax: +33 493 65 47 16.
 #ifndef _MELP_SUB_H_
 #define _MELP_SUB_H_
 
-void bpvc_ana(int16_t speech[], int16_t fpitch[], int16_t bpvc[],
+void bpvc_ana(struct melpe_enc *st, int16_t speech[], int16_t fpitch[],
+	      int16_t bpvc[],
 	      int16_t * pitch);
 
 void dc_rmv(int16_t sigin[], int16_t sigout[], int16_t delin[],
@@ -61,14 +62,17 @@ BOOLEAN q_bpvc(int16_t * bpvc, int16_t * bpvc_index, int16_t num_bands);
 void q_bpvc_dec(int16_t bpvc[], int16_t bpvc_index, BOOLEAN uv_flag,
 		int16_t num_bands);
 
-void q_gain(int16_t * gain, int16_t * gain_index, int16_t qlow,
+void q_gain(struct melpe_enc *st, int16_t * gain, int16_t * gain_index,
+	    int16_t qlow,
 	    int16_t qup, int16_t qlev, int16_t qlev_q,
 	    int16_t double_flag, int16_t scale);
 
-void q_gain_dec(int16_t * gain, int16_t * gain_index, int16_t qlow,
+void q_gain_dec(struct melpe_dec *st, int16_t * gain, int16_t * gain_index,
+		int16_t qlow,
 		int16_t qup, int16_t qlev_q, int16_t scale);
 
-void scale_adj(int16_t * speech, int16_t gain, int16_t length,
+void scale_adj(struct melpe_dec *st, int16_t * speech, int16_t gain,
+	       int16_t length,
 	       int16_t scale_over, int16_t inv_scale_over);
 
 #endif
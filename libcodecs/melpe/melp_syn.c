@@ -57,6 +57,7 @@ Secretariat fax: +33 493 65 47 16.
 
 #if POSTFILTER
 #include "postfilt.h"
+#include "state.h"
 #endif
 
 #define INV_LPC_ORD			2979
@@ -66,7 +67,6 @@ Secretariat fax: +33 493 65 47 16.
 #define X1_732_Q14			28377	/* 1.732 * (1 << 14) */
 #define X12_Q8				3072	/* 12.0 * (1 << 8) */
 #define X30_Q8				7680	/* 30.0 * (1 << 8) */
-#define TILT_ORD			1
 #define SCALEOVER			10
 #define INV_SCALEOVER_Q18	26214	/* ((1.0/SCALEOVER)*(1 << 18)) */
 #define PDEL				SCALEOVER
@@ -84,14 +84,10 @@ Secretariat fax: +33 493 65 47 16.
 #define SYN_GAIN_Q4				32000
 #endif
 
-static struct melp_param prev_par;
-static int16_t sigsave[PITCHMAX];
-static int16_t syn_begin;
-static BOOLEAN erase;
-
 /* Prototype */
 
-static void melp_syn(struct melp_param *par, int16_t sp_out[]);
+static void melp_syn(struct melpe_dec *st, struct melp_param *par,
+		     int16_t sp_out[]);
 
 /****************************************************************************
 **
@@ -107,40 +103,40 @@ static void melp_syn(struct melp_param *par, int16_t sp_out[]);
 ** Return value:	None
 **
 *****************************************************************************/
-void synthesis(struct melp_param *par, int16_t sp_out[])
+void synthesis(struct melpe_dec *st, struct melp_param *par, int16_t sp_out[])
 {
 	register int16_t i;
 
 	/* Copy previous period of processed speech to output array */
-	if (syn_begin > 0) {
-		if (syn_begin > frameSize) {	/* impossible */
-			v_equ(sp_out, sigsave, frameSize);
+	if (st->syn_begin > 0) {
+		if (st->syn_begin > frameSize) {	/* impossible */
+			v_equ(sp_out, st->sigsave, frameSize);
 			/* past end: save remainder in sigsave[0] */
-			v_equ(sigsave, &sigsave[frameSize],
-			      (int16_t) (syn_begin - frameSize));
+			v_equ(st->sigsave, &st->sigsave[frameSize],
+			      (int16_t) (st->syn_begin - frameSize));
 		} else
-			v_equ(sp_out, sigsave, syn_begin);
+			v_equ(sp_out, st->sigsave, st->syn_begin);
 	}
 
-	erase = FALSE;		/* no erasures yet */
+	st->erase = FALSE;		/* no erasures yet */
 
 	/* Read and decode channel input buffer. */
 	if (rate == RATE2400)
-		erase = melp_chn_read(&quant_par, par, &prev_par, chbuf);
+		st->erase = melp_chn_read(st, &st->quant_par, par, &st->prev_par, st->chbuf);
 #if !SKIP_CHANNEL
 	else
-		erase = (BOOLEAN) low_rate_chn_read(&quant_par, par, &prev_par);
+		st->erase = (BOOLEAN) low_rate_chn_read(st, &st->quant_par, par, &st->prev_par);
 #endif
 
 	if (rate == RATE2400) {
-		par->uv_flag = quant_par.uv_flag[0];
-		melp_syn(par, sp_out);
+		par->uv_flag = st->quant_par.uv_flag[0];
+		melp_syn(st, par, sp_out);
 	} else {
 		for (i = 0; i < NF; i++) {
-			melp_syn(&par[i], &sp_out[i * FRAME]);
-			if ((syn_begin > 0) && (i < NF - 1))
-				v_equ(&sp_out[(i + 1) * FRAME], sigsave,
-				      syn_begin);
+			melp_syn(st, &par[i], &sp_out[i * FRAME]);
+			if ((st->syn_begin > 0) && (i < NF - 1))
+				v_equ(&sp_out[(i + 1) * FRAME], st->sigsave,
+				      st->syn_begin);
 		}
 	}
 }
@@ -157,18 +153,10 @@ void synthesis(struct melp_param *par, int16_t sp_out[])
 /*    speech[] - output speech signal                                         */
 /*  Returns: void                                                             */
 
-static void melp_syn(struct melp_param *par, int16_t sp_out[])
+static void melp_syn(struct melpe_dec *st, struct melp_param *par,
+		     int16_t sp_out[])
 {
 	register int16_t i;
-	static BOOLEAN firstTime = TRUE;
-	static int16_t noise_gain = MIN_NOISE_Q8;
-	static int16_t prev_lpc_gain = ONE_Q15;
-	static int16_t lpc_del[LPC_ORD];	/* Q0 */
-	static int16_t prev_tilt;
-	static int16_t prev_pcof[MIX_ORD + 1], prev_ncof[MIX_ORD + 1];
-	static int16_t disp_del[DISP_ORD];
-	static int16_t ase_del[LPC_ORD], tilt_del[TILT_ORD];
-	static int16_t pulse_del[MIX_ORD], noise_del[MIX_ORD];
 	int16_t fs_real[PITCHMAX];
 	int16_t sig2[BEGIN + PITCHMAX];
 	int16_t sigbuf[BEGIN + PITCHMAX];
@@ -187,25 +175,25 @@ static void melp_syn(struct melp_param *par, int16_t sp_out[])
 	int16_t fc_prev, fc_curr, fc;
 
 	/* Update adaptive noise level estimate based on last gain */
-	if (firstTime) {
-		noise_gain = par->gain[NUM_GAINFR - 1];	/* noise_gain in Q8 */
-		prev_tilt = 0;
-		v_zap(prev_pcof, MIX_ORD + 1);
-		v_zap(prev_ncof, MIX_ORD + 1);
-		prev_ncof[MIX_ORD / 2] = ONE_Q15;
-		v_zap(disp_del, DISP_ORD);
-		v_zap(ase_del, LPC_ORD);
-		v_zap(tilt_del, TILT_ORD);
-		v_zap(pulse_del, MIX_ORD);
-		v_zap(noise_del, MIX_ORD);
-		firstTime = FALSE;
-	} else if (!erase) {
+	if (st->syn_first) {
+		st->noise_gain = par->gain[NUM_GAINFR - 1];	/* noise_gain in Q8 */
+		st->prev_tilt = 0;
+		v_zap(st->prev_pcof, MIX_ORD + 1);
+		v_zap(st->prev_ncof, MIX_ORD + 1);
+		st->prev_ncof[MIX_ORD / 2] = ONE_Q15;
+		v_zap(st->disp_del, DISP_ORD);
+		v_zap(st->ase_del, LPC_ORD);
+		v_zap(st->tilt_del, TILT_ORD);
+		v_zap(st->pulse_del, MIX_ORD);
+		v_zap(st->noise_del, MIX_ORD);
+		st->syn_first = FALSE;
+	} else if (!st->erase) {
 		for (i = 0; i < NUM_GAINFR; i++) {
-			noise_est(par->gain[i], &noise_gain, UPCONST_Q19,
+			noise_est(par->gain[i], &st->noise_gain, UPCONST_Q19,
 				  DOWNCONST_Q17, MIN_NOISE_Q8, MAX_NOISE_Q8);
 
 			/* Adjust gain based on noise level (noise suppression) */
-			noise_sup(&par->gain[i], noise_gain, MAX_NS_SUP_Q8,
+			noise_sup(&par->gain[i], st->noise_gain, MAX_NS_SUP_Q8,
 				  MAX_NS_ATT_Q8, NFACT_Q8);
 		}
 	}
@@ -217,7 +205,7 @@ static void melp_syn(struct melp_param *par, int16_t sp_out[])
 	}
 
 	/* Un-weight Fourier magnitudes */
-	if (!par->uv_flag && !erase)
+	if (!par->uv_flag && !st->erase)
 		window_Q(par->fs_mag, w_fs_inv, par->fs_mag, NUM_HARM, 14);
 
 	/* Clamp LSP bandwidths to avoid sharp LPC filters */
@@ -245,11 +233,11 @@ static void melp_syn(struct melp_param *par, int16_t sp_out[])
 	/*      if (par->pitch < 0.5*prev_par.pitch &&
 	   par->gain[0] > 6.0 + prev_par.gain[NUM_GAINFR - 1]) */
 
-	temp1 = melpe_shr(prev_par.pitch, 1);
-	temp2 = melpe_add(SIX_Q8, prev_par.gain[NUM_GAINFR - 1]);
+	temp1 = melpe_shr(st->prev_par.pitch, 1);
+	temp2 = melpe_add(SIX_Q8, st->prev_par.gain[NUM_GAINFR - 1]);
 	if ((par->pitch < temp1) && (par->gain[0] > temp2)) {
 		/* copy current pitch into previous */
-		prev_par.pitch = par->pitch;
+		st->prev_par.pitch = par->pitch;
 	}
 
 	/* Set pulse and noise coefficients based on voicing strengths */
@@ -263,18 +251,18 @@ static void melp_syn(struct melp_param *par, int16_t sp_out[])
 	}
 
 	/* Process each pitch period */
-	while (syn_begin < FRAME) {
+	while (st->syn_begin < FRAME) {
 
 		/* interpolate previous and current parameters */
-		ifact = melpe_divide_s(syn_begin, FRAME);	/* ifact in Q15 */
+		ifact = melpe_divide_s(st->syn_begin, FRAME);	/* ifact in Q15 */
 
-		if (syn_begin >= GAINFR) {
+		if (st->syn_begin >= GAINFR) {
 			gaincnt = 2;
-			temp1 = melpe_sub(syn_begin, GAINFR);
+			temp1 = melpe_sub(st->syn_begin, GAINFR);
 			ifact_gain = melpe_divide_s(temp1, GAINFR);
 		} else {
 			gaincnt = 1;
-			ifact_gain = melpe_divide_s(syn_begin, GAINFR);
+			ifact_gain = melpe_divide_s(st->syn_begin, GAINFR);
 		}
 
 		/* interpolate gain.  It is assumed that par->gain[] are obtained     */
@@ -293,7 +281,7 @@ static void melp_syn(struct melp_param *par, int16_t sp_out[])
 			   (1.0 - ifact_gain) * prev_par.gain[NUM_GAINFR - 1];        */
 			L_temp1 = melpe_L_mult(par->gain[gaincnt - 1], ifact_gain);
 			temp1 = melpe_sub(ONE_Q15, ifact_gain);
-			L_temp2 = melpe_L_mult(prev_par.gain[NUM_GAINFR - 1], temp1);
+			L_temp2 = melpe_L_mult(st->prev_par.gain[NUM_GAINFR - 1], temp1);
 			gain = melpe_extract_h(melpe_L_add(L_temp1, L_temp2));	/* gain in Q8 */
 		}
 
@@ -301,11 +289,11 @@ static void melp_syn(struct melp_param *par, int16_t sp_out[])
 
 		temp1 =
 		    melpe_sub(par->gain[NUM_GAINFR - 1],
-			prev_par.gain[NUM_GAINFR - 1]);
+			st->prev_par.gain[NUM_GAINFR - 1]);
 		if (melpe_abs_s(temp1) > SIX_Q8) {
 			/* Power surge: use gain adjusted interpolation */
 			/*      intfact = (gain - prev_par.gain[NUM_GAINFR - 1])/temp; */
-			temp2 = melpe_sub(gain, prev_par.gain[NUM_GAINFR - 1]);
+			temp2 = melpe_sub(gain, st->prev_par.gain[NUM_GAINFR - 1]);
 			if (((temp2 > 0) && (temp1 < 0)) ||
 			    ((temp2 < 0) && (temp1 > 0)))
 				intfact = 0;
@@ -321,12 +309,12 @@ static void melp_syn(struct melp_param *par, int16_t sp_out[])
 			intfact = ifact;
 
 		/* interpolate LSF's and convert to LPC filter */
-		interp_array(prev_par.lsf, par->lsf, lsf, intfact, LPC_ORD);
+		interp_array(st->prev_par.lsf, par->lsf, lsf, intfact, LPC_ORD);
 		lpc_lsp2pred(lsf, &(lpc[1]), LPC_ORD);
 
 		/* Check signal probability for adaptive spectral enhancement filter */
-		temp1 = melpe_add(noise_gain, X12_Q8);
-		temp2 = melpe_add(noise_gain, X30_Q8);
+		temp1 = melpe_add(st->noise_gain, X12_Q8);
+		temp2 = melpe_add(st->noise_gain, X30_Q8);
 		/* sig_prob in Q15 */
 		sig_prob = lin_int_bnd(gain, temp1, temp2, 0, ONE_Q15);
 
@@ -341,7 +329,7 @@ static void melp_syn(struct melp_param *par, int16_t sp_out[])
 		   (1.0 - intfact) * prev_tilt);               */
 		temp1 = melpe_mult(curr_tilt, intfact);
 		intfact1 = melpe_sub(ONE_Q15, intfact);
-		temp2 = melpe_mult(prev_tilt, intfact1);
+		temp2 = melpe_mult(st->prev_tilt, intfact1);
 		temp1 = melpe_add(temp1, temp2);
 		tilt_cof[1] = melpe_mult(sig_prob, temp1);	/* tilt_cof in Q15 */
 
@@ -349,13 +337,13 @@ static void melp_syn(struct melp_param *par, int16_t sp_out[])
 		/*      syn_gain = SYN_GAIN * (intfact * lpc_gain +
 		   (1.0 - intfact) * prev_lpc_gain); */
 		temp1 = melpe_mult(lpc_gain, intfact);	/* lpc_gain in Q15 */
-		temp2 = melpe_mult(prev_lpc_gain, intfact1);
+		temp2 = melpe_mult(st->prev_lpc_gain, intfact1);
 		temp1 = melpe_add(temp1, temp2);	/* temp1 in Q15 */
 		syn_gain = melpe_mult(SYN_GAIN_Q4, temp1);
 		/* syn_gain in Q4 */
 		/*      pitch = intfact * par->pitch + (1.0 - intfact) * prev_par.pitch;  */
 		temp1 = melpe_mult(par->pitch, intfact);
-		temp2 = melpe_mult(prev_par.pitch, intfact1);
+		temp2 = melpe_mult(st->prev_par.pitch, intfact1);
 		pitch = melpe_add(temp1, temp2);	/* pitch in Q7 */
 
 		/*      pulse_gain = syn_gain * sqrt(pitch); */
@@ -366,12 +354,12 @@ static void melp_syn(struct melp_param *par, int16_t sp_out[])
 
 		/* interpolate pulse and noise coefficients */
 		temp1 = sqrt_fxp(ifact, 15);
-		interp_array(prev_pcof, curr_pcof, pulse_cof, temp1,
+		interp_array(st->prev_pcof, curr_pcof, pulse_cof, temp1,
 			     MIX_ORD + 1);
-		interp_array(prev_ncof, curr_ncof, noise_cof, temp1,
+		interp_array(st->prev_ncof, curr_ncof, noise_cof, temp1,
 			     MIX_ORD + 1);
 
-		set_fc(prev_par.bpvc, &fc_prev);
+		set_fc(st->prev_par.bpvc, &fc_prev);
 		set_fc(par->bpvc, &fc_curr);
 		temp2 = melpe_sub(ONE_Q15, temp1);
 		temp1 = melpe_mult(temp1, fc_curr);	/* temp1 is now Q3 */
@@ -382,7 +370,7 @@ static void melp_syn(struct melp_param *par, int16_t sp_out[])
 		/*      jitter = ifact * par->jitter + (1.0 - ifact) * prev_par.jitter;   */
 		temp1 = melpe_mult(par->jitter, ifact);
 		temp2 = melpe_sub(ONE_Q15, ifact);	/* temp2 is Q15 */
-		temp2 = melpe_mult(prev_par.jitter, temp2);
+		temp2 = melpe_mult(st->prev_par.jitter, temp2);
 		jitter = melpe_add(temp1, temp2);	/* jitter is Q15 */
 
 		/* scale gain by 0.05 but keep gain in log. */
@@ -390,7 +378,7 @@ static void melp_syn(struct melp_param *par, int16_t sp_out[])
 		gain = melpe_mult(X005_Q19, gain);	/* gain in Q12 */
 
 		/* Set period length based on pitch and jitter */
-		rand_num(&temp1, ONE_Q15, 1);
+		rand_num(&st->seed, &temp1, ONE_Q15, 1);
 		/*      length = pitch * (1.0 - jitter * temp) + 0.5; */
 		temp1 = melpe_mult(jitter, temp1);
 		temp1 = melpe_shr(temp1, 1);	/* temp1 in Q14 */
@@ -404,102 +392,111 @@ static void melp_syn(struct melp_param *par, int16_t sp_out[])
 
 		fill(fs_real, ONE_Q13, length);
 		fs_real[0] = 0;
-		interp_array(prev_par.fs_mag, par->fs_mag, &fs_real[1], intfact,
+		interp_array(st->prev_par.fs_mag, par->fs_mag, &fs_real[1], intfact,
 			     NUM_HARM);
 
-		harm_syn_pitch(fs_real, &sigbuf[BEGIN], fc, length);
+		harm_syn_pitch(&st->seed, fs_real, &sigbuf[BEGIN], fc, length);
 		v_scale(&sigbuf[BEGIN], pulse_gain, length);	/* sigbuf[] is Q0 */
 
 		/* Adaptive spectral enhancement */
-		v_equ(&sigbuf[BEGIN - LPC_ORD], ase_del, LPC_ORD);
+		v_equ(&sigbuf[BEGIN - LPC_ORD], st->ase_del, LPC_ORD);
 		lpc_synthesis(&sigbuf[BEGIN], &sigbuf[BEGIN], ase_den, LPC_ORD,
 			      length);
-		v_equ(ase_del, &sigbuf[BEGIN + length - LPC_ORD], LPC_ORD);
+		v_equ(st->ase_del, &sigbuf[BEGIN + length - LPC_ORD], LPC_ORD);
 
 		zerflt(&sigbuf[BEGIN], ase_num, &sigbuf[BEGIN], LPC_ORD,
 		       length);
-		v_equ(&sigbuf[BEGIN - TILT_ORD], tilt_del, TILT_ORD);
-		v_equ(tilt_del, &sigbuf[length + BEGIN - TILT_ORD], TILT_ORD);
+		v_equ(&sigbuf[BEGIN - TILT_ORD], st->tilt_del, TILT_ORD);
+		v_equ(st->tilt_del, &sigbuf[length + BEGIN - TILT_ORD], TILT_ORD);
 		zerflt_Q(&sigbuf[BEGIN], tilt_cof, &sigbuf[BEGIN], TILT_ORD,
 			 length, 15);
 
 		/* Possible Signal overflow at this point! */
 		/* Perform LPC synthesis filtering */
-		v_equ(&sigbuf[BEGIN - LPC_ORD], lpc_del, LPC_ORD);
+		v_equ(&sigbuf[BEGIN - LPC_ORD], st->lpc_del, LPC_ORD);
 		lpc_synthesis(&sigbuf[BEGIN], &sigbuf[BEGIN], &(lpc[1]),
 			      LPC_ORD, length);
-		v_equ(lpc_del, &sigbuf[length + BEGIN - LPC_ORD], LPC_ORD);
+		v_equ(st->lpc_del, &sigbuf[length + BEGIN - LPC_ORD], LPC_ORD);
 		/* Adjust scaling of synthetic speech, sigbuf in Q0 */
-		scale_adj(&sigbuf[BEGIN], gain, length, SCALEOVER,
+		scale_adj(st, &sigbuf[BEGIN], gain, length, SCALEOVER,
 			  INV_SCALEOVER_Q18);
 
 		/* Implement pulse dispersion filter on output speech */
-		v_equ(&sigbuf[BEGIN - DISP_ORD], disp_del, DISP_ORD);
-		v_equ(disp_del, &sigbuf[length + BEGIN - DISP_ORD], DISP_ORD);
+		v_equ(&sigbuf[BEGIN - DISP_ORD], st->disp_del, DISP_ORD);
+		v_equ(st->disp_del, &sigbuf[length + BEGIN - DISP_ORD], DISP_ORD);
 		zerflt_Q(&sigbuf[BEGIN], disp_cof, &sigbuf[BEGIN], DISP_ORD,
 			 length, 15);
 
 		/* Copy processed speech to output array (not past frame end) */
-		if (melpe_add(syn_begin, length) >= FRAME) {
-			v_equ(&sp_out[syn_begin], &sigbuf[BEGIN],
-			      (int16_t) (FRAME - syn_begin));
+		if (melpe_add(st->syn_begin, length) >= FRAME) {
+			v_equ(&sp_out[st->syn_begin], &sigbuf[BEGIN],
+			      (int16_t) (FRAME - st->syn_begin));
 
 #if POSTFILTER
-			postfilt(sp_out, prev_par.lsf, par->lsf);
+			postfilt(st, sp_out, st->prev_par.lsf, par->lsf);
 #endif
 
 			/* past end: save remainder in sigsave[0] */
-			v_equ(sigsave, &sigbuf[BEGIN + FRAME - syn_begin],
-			      (int16_t) (length - (FRAME - syn_begin)));
+			v_equ(st->sigsave, &sigbuf[BEGIN + FRAME - st->syn_begin],
+			      (int16_t) (length - (FRAME - st->syn_begin)));
 		} else
-			v_equ(&sp_out[syn_begin], &sigbuf[BEGIN], length);
+			v_equ(&sp_out[st->syn_begin], &sigbuf[BEGIN], length);
 
 		/* Update syn_begin for next period */
-		syn_begin = melpe_add(syn_begin, length);
+		st->syn_begin = melpe_add(st->syn_begin, length);
 	}
 
 	/* Save previous pulse and noise filters for next frame */
-	v_equ(prev_pcof, curr_pcof, MIX_ORD + 1);
-	v_equ(prev_ncof, curr_ncof, MIX_ORD + 1);
+	v_equ(st->prev_pcof, curr_pcof, MIX_ORD + 1);
+	v_equ(st->prev_ncof, curr_ncof, MIX_ORD + 1);
 
 	/* Copy current parameters to previous parameters for next time */
-	prev_par = *par;
-	prev_tilt = curr_tilt;
-	prev_lpc_gain = lpc_gain;
+	st->prev_par = *par;
+	st->prev_tilt = curr_tilt;
+	st->prev_lpc_gain = lpc_gain;
 
 	/* Update syn_begin for next frame */
-	syn_begin = melpe_sub(syn_begin, FRAME);
+	st->syn_begin = melpe_sub(st->syn_begin, FRAME);
 }
 
 /* =========================================================== */
 /* melp_syn_init() performs initialization for melp synthesis. */
 /* =========================================================== */
 
-void melp_syn_init()
+void melp_syn_init(struct melpe_dec *st)
 {
 	register int16_t i;
-	int16_t temp;
+	int16_t temp, temp1, temp2;
 
-	v_zap(prev_par.gain, NUM_GAINFR);
-	prev_par.pitch = UV_PITCH_Q7;
+	v_zap(st->prev_par.gain, NUM_GAINFR);
+	st->prev_par.pitch = UV_PITCH_Q7;
 	temp = 0;
 	for (i = 0; i < LPC_ORD; i++) {
 		temp = melpe_add(temp, INV_LPC_ORD);
-		prev_par.lsf[i] = temp;
+		st->prev_par.lsf[i] = temp;
 	}
-	prev_par.jitter = 0;
-	v_zap(&prev_par.bpvc[0], NUM_BANDS);
-	syn_begin = 0;
-	v_zap(sigsave, PITCHMAX);
+	st->prev_par.jitter = 0;
+	v_zap(&st->prev_par.bpvc[0], NUM_BANDS);
+	st->syn_begin = 0;
+	v_zap(st->sigsave, PITCHMAX);
+
+	fill(st->prev_par.fs_mag, ONE_Q13, NUM_HARM);
 
-	fill(prev_par.fs_mag, ONE_Q13, NUM_HARM);
+	st->syn_first = TRUE;
+	st->noise_gain = MIN_NOISE_Q8;
+	st->prev_lpc_gain = ONE_Q15;
+	st->seed = 1;
 
-	/* Initialize fixed MSE weighting and inverse of weighting */
+	/* Initialize the channel decoder predictors */
 
-	if (!w_fs_init) {
-		vq_fsw(w_fs, NUM_HARM, X60_Q9);
-		for (i = 0; i < NUM_HARM; i++)
-			w_fs_inv[i] = melpe_divide_s(ONE_Q13, w_fs[i]);	/* w_fs_inv in Q14 */
-		w_fs_init = TRUE;
+	st->prev_uv = 1;
+	fill(st->prev_gain, 2560, 2 * NF * NUM_GAINFR);
+	fill(st->prev_fsmag, ONE_Q13, NUM_HARM);
+	temp1 = X08_Q10;	/* Q10 */
+	temp2 = melpe_shl(LPC_ORD, 10);	/* Q10 */
+	for (i = 0; i < LPC_ORD; i++) {
+		/*      qplsp[i] = (i + 1)*0.8/LPC_ORD; */
+		st->qplsp[i] = melpe_divide_s(temp1, temp2);
+		temp1 = melpe_add(temp1, X08_Q10);
 	}
 }
@@ -31,78 +31,132 @@
 #include "math_lib.h"
 #include "math.h"
 
-#if NPP
 #include "npp.h"
-#endif
+#include "state.h"
+
+/* Scratch arena for working vectors of analysis and synthesis, in 32-bit */
+/* words.  The deepest nesting of v_get()/L_v_get() blocks takes about    */
+/* 160 words at 1200 bps (the 2400 bps MSVQ search takes 179).            */
+#define MELPE_SCRATCH			512
 
 #define X05_Q7				64	/* 0.5 * (1 << 7) */
 #define THREE_Q7			384	/* 3 * (1 << 7) */
 
-/* ====== External memory ====== */
-
-int16_t mode;
-int16_t chwordsize;
-int16_t bitBufSize, bitBufSize12, bitBufSize24;
-/* ========== Static definations ========== */
-
 #define PROGRAM_NAME			"SC1200 1200 bps speech coder"
 #define PROGRAM_VERSION			"Version 7 / 42 Bits"
 #define PROGRAM_DATE			"10/25/2000"
 
 /* ========== Public Prototypes ========== */
-void melpe_n(short *sp);
-void melpe_i(void);
-void melpe_a(unsigned char *buf, short *sp);
-void melpe_s(short *sp, unsigned char *buf);
-void melpe_al(unsigned char *buf, short *sp);
-void melpe_i2(void);
+struct melpe_npp *melpe_npp_init(void);
+void melpe_npp_exit(struct melpe_npp *st);
+void melpe_n(struct melpe_npp *st, short *sp);
+struct melpe_enc *melpe_enc_init(void);
+void melpe_enc_exit(struct melpe_enc *st);
+void melpe_a(struct melpe_enc *st, unsigned char *buf, short *sp);
+struct melpe_dec *melpe_dec_init(void);
+void melpe_dec_exit(struct melpe_dec *st);
+void melpe_s(struct melpe_dec *st, short *sp, unsigned char *buf);
 
 //------------------------------NPP------------------------
 
+//create a standalone noise preprocessor
+struct melpe_npp *melpe_npp_init(void)
+{
+	struct melpe_npp *st;
+
+	st = calloc(1, sizeof(struct melpe_npp));
+	if (st)
+		npp_init(st);
+	return st;
+}
+
+void melpe_npp_exit(struct melpe_npp *st)
+{
+	free(st);
+}
+
 //denoise 180 samples sp->sp
-void melpe_n(short *sp)
+void melpe_n(struct melpe_npp *st, short *sp)
 {
 	//noise preprocessor for other codecs (frame=180)
-	npp(sp, sp);
+	npp(st, sp, sp);
 }
 
 //-------------------------1200----------------------------------
 
-//init melpe codec at 1200 bps
-void melpe_i(void)
+//create melpe encoder at 1200 bps
+struct melpe_enc *melpe_enc_init(void)
 {
-	//====== Run MELPE codec ====== 
-	mode = ANA_SYN;
-	rate = RATE1200;
-	frameSize = (int16_t) BLOCK;
-
-	chwordsize = 8;
-	bitNum12 = 81;
-	bitNum24 = 54;
-	bitBufSize12 = 11;
-	bitBufSize24 = 7;
-	bitBufSize = bitBufSize12;
-
-	melp_ana_init();
-	melp_syn_init();
+	struct melpe_enc *st;
+
+	st = calloc(1, sizeof(struct melpe_enc));
+	if (!st)
+		return 0;
+
+	//preallocate working vectors: no heap calls while coding
+	if (!v_arena_init(&st->arena, MELPE_SCRATCH)) {
+		free(st);
+		return 0;
+	}
+	v_arena_use(&st->arena);
+
+	npp_init(&st->npp);
+	melp_ana_init(st);
+	return st;
+}
+
+void melpe_enc_exit(struct melpe_enc *st)
+{
+	if (!st)
+		return;
+	v_arena_free(&st->arena);
+	free(st);
 }
 
 //compress 540 samples sp (67.5 mS) -> 81 bits buf (11 bytes)
-void melpe_a(unsigned char *buf, short *sp)
+void melpe_a(struct melpe_enc *st, unsigned char *buf, short *sp)
 {
 	//analysys
-	npp(sp, sp);
-	npp(&(sp[FRAME]), &(sp[FRAME]));
-	npp(&(sp[2 * FRAME]), &(sp[2 * FRAME]));
-	analysis(sp, melp_par);
-	memcpy(buf, chbuf, 11);
+	v_arena_use(&st->arena);
+	npp(&st->npp, sp, sp);
+	npp(&st->npp, &(sp[FRAME]), &(sp[FRAME]));
+	npp(&st->npp, &(sp[2 * FRAME]), &(sp[2 * FRAME]));
+	analysis(st, sp, st->par);
+	memcpy(buf, st->chbuf, 11);
+}
+
+//create melpe decoder at 1200 bps
+struct melpe_dec *melpe_dec_init(void)
+{
+	struct melpe_dec *st;
+
+	st = calloc(1, sizeof(struct melpe_dec));
+	if (!st)
+		return 0;
+
+	if (!v_arena_init(&st->arena, MELPE_SCRATCH)) {
+		free(st);
+		return 0;
+	}
+	v_arena_use(&st->arena);
+
+	melp_syn_init(st);
+	return st;
+}
+
+void melpe_dec_exit(struct melpe_dec *st)
+{
+	if (!st)
+		return;
+	v_arena_free(&st->arena);
+	free(st);
 }
 
 //decompress 81 bits buf (11 bytes) -> 540 samples sp (67.5 mS)
-void melpe_s(short *sp, unsigned char *buf)
+void melpe_s(struct melpe_dec *st, short *sp, unsigned char *buf)
 {
 	//syntesis
-	memcpy(chbuf, buf, 11);
-	synthesis(melp_par, sp);
+	v_arena_use(&st->arena);
+	memcpy(st->chbuf, buf, 11);
+	synthesis(st, st->par, sp);
 }
-
@@ -6,12 +6,25 @@ extern "C" {
 
 #ifndef __MELPELIB__
 #define  __MELPELIB__
+	struct melpe_npp;
+	struct melpe_nppf;
+	struct melpe_enc;
+	struct melpe_dec;
+
 //------------NPP----------------------
-	void melpe_n(short *sp);	//denoise 180 samples sp->sp
+	struct melpe_npp *melpe_npp_init(void);	//create noise preprocessor, 0 on failure
+	void melpe_npp_exit(struct melpe_npp *st);
+	void melpe_n(struct melpe_npp *st, short *sp);	//denoise 180 samples sp->sp
+	struct melpe_nppf *melpe_nppf_init(void);	//create floating point noise preprocessor, 0 on failure
+	void melpe_nppf_exit(struct melpe_nppf *st);
+	void melpe_nf(struct melpe_nppf *st, short *sp, int n);	//denoise n (128-240) samples sp->sp
 //------------1200---------------------
-	void melpe_i(void);	//init melpe codec at 1200 bps
-	void melpe_a(unsigned char *buf, short *sp);	//compress 540 samples sp -> 81 bits buf  
-	void melpe_s(short *sp, unsigned char *buf);	//decompress 81 bits buf -> 540 samples sp
+	struct melpe_enc *melpe_enc_init(void);	//create encoder at 1200 bps, 0 on failure
+	void melpe_enc_exit(struct melpe_enc *st);
+	void melpe_a(struct melpe_enc *st, unsigned char *buf, short *sp);	//compress 540 samples sp -> 81 bits buf
+	struct melpe_dec *melpe_dec_init(void);	//create decoder at 1200 bps, 0 on failure
+	void melpe_dec_exit(struct melpe_dec *st);
+	void melpe_s(struct melpe_dec *st, short *sp, unsigned char *buf);	//decompress 81 bits buf -> 540 samples sp
 
 #endif
 #ifdef __cplusplus
@@ -20,6 +20,8 @@
  *---------------------------------------------------------------------
  */
 
+#include <string.h>
+
 #include "npp.h"
 #include "fs_lib.h"
 #include "mat_lib.h"
@@ -27,6 +29,7 @@
 #include "dsp_sub.h"
 #include "fft_lib.h"
 #include "global.h"
+#include "state.h"
 
 #define X003_Q15		983	/* 0.03 * (1 << 15) */
 #define X005_Q15		1638	/* 0.05 * (1 << 15) */
@@ -74,84 +77,35 @@ static const int16_t sqrt_tukey_256_180[ENH_WINLEN] = {	/* Q15 */
 	4724, 4053, 3380, 2705, 2030, 1354, 677, 0
 };
 
-/* ====== Entities from Enhanced_Data ====== */
-static int16_t enh_i = 0;	/* formerly D->I */
-static int16_t lambdaD[ENH_VEC_LENF];	/* overestimated noise */
-					       /* psd(noise_bias * noisespect) */
-static int16_t lambdaD_shift[ENH_VEC_LENF];
-static int16_t SN_LT;		/* long term SNR */
-static int16_t SN_LT_shift;
-static int16_t n_pwr;
-static int16_t n_pwr_shift;
-static int16_t YY[ENH_VEC_LENF];	/* signal periodogram of current frame */
-static int16_t YY_shift[ENH_VEC_LENF];
-static int16_t sm_shift[ENH_VEC_LENF];
-static int16_t noise_shift[ENH_VEC_LENF];
-static int16_t noise2_shift[ENH_VEC_LENF];
-static int16_t av_shift[ENH_VEC_LENF];
-static int16_t av2_shift[ENH_VEC_LENF];
-static int16_t act_min[ENH_VEC_LENF];	/* current minimum of long window */
-static int16_t act_min_shift[ENH_VEC_LENF];
-static int16_t act_min_sub[ENH_VEC_LENF];
-					     /* current minimum of sub-window */
-static int16_t act_min_sub_shift[ENH_VEC_LENF];
-static int16_t vk[ENH_VEC_LENF];
-static int16_t vk_shift[ENH_VEC_LENF];
-static int16_t ksi[ENH_VEC_LENF];	/* a priori SNR */
-static int16_t ksi_shift[ENH_VEC_LENF];
-
-static int16_t var_rel[ENH_VEC_LENF];
-				       /* est. relative var. of smoothedspect */
-static int16_t var_rel_av;	/* average relative var. of smoothedspect */
-
-/* only for minimum statistics */
-
-static int16_t smoothedspect[ENH_VEC_LENF];	/* smoothed signal spectrum */
-static int16_t var_sp_av[ENH_VEC_LENF];
-					   /* estimated mean of smoothedspect */
-static int16_t var_sp_2[ENH_VEC_LENF];
-				     /* esitmated 2nd moment of smoothedspect */
-static int16_t noisespect[ENH_VEC_LENF];	/* estimated noise psd */
-static int16_t noisespect2[ENH_VEC_LENF];
-static int16_t alphacorr;	/* correction factor for alpha_var, Q15 */
-static int16_t alpha_var[ENH_VEC_LENF];	/* variable smoothing */
-							 /* parameter for psd */
-static int16_t circb[NUM_MINWIN][ENH_VEC_LENF];	/* ring buffer */
-static int16_t circb_shift[NUM_MINWIN][ENH_VEC_LENF];
-
-static int16_t initial_noise[ENH_WINLEN];	/* look ahead noise */
-							      /* samples (Q0) */
-static int16_t speech_in_npp[ENH_WINLEN];	/* input of one frame */
-static int16_t ybuf[2 * ENH_WINLEN + 2];
-				 /* buffer for FFT, this can be eliminated if */
-						    /* we can write a better real-FFT program for DSP */
-static int32_t temp_yy[ENH_WINLEN + 2];
-
 /* ====== Prototypes ====== */
 
 static void smoothing_win(int16_t initial_noise[]);
-static void compute_qk(int16_t qk[], int16_t gamaK[],
+static void compute_qk(struct melpe_npp *st, int16_t qk[], int16_t gamaK[],
 		       int16_t gamaK_shift[], int16_t GammaQ_TH);
-static void gain_log_mmse(int16_t qk[], int16_t Gain[],
+static void gain_log_mmse(struct melpe_npp *st, int16_t qk[], int16_t Gain[],
 			  int16_t gamaK[], int16_t gamaK_shift[],
 			  int16_t m);
 static int16_t ksi_min_adapt(BOOLEAN n_flag, int16_t ksi_min,
 			       int16_t sn_lt, int16_t sn_lt_shift);
-static void smoothed_periodogram(int16_t YY_av, int16_t yy_shift);
-static void bias_compensation(int16_t biased_spect[],
+static void smoothed_periodogram(struct melpe_npp *st, int16_t YY_av,
+				 int16_t yy_shift);
+static void bias_compensation(struct melpe_npp *st, int16_t biased_spect[],
 			      int16_t bias_shift[],
 			      int16_t biased_spect_sub[],
 			      int16_t bias_sub_shift[]);
-static int16_t noise_slope();
+static int16_t noise_slope(struct melpe_npp *st);
 static int16_t comp_data_shift(int16_t num1, int16_t shift1,
 				 int16_t num2, int16_t shift2);
-static void min_search(int16_t biased_spect[], int16_t bias_shift[],
+static void min_search(struct melpe_npp *st, int16_t biased_spect[],
+		       int16_t bias_shift[],
 		       int16_t biased_spect_sub[],
 		       int16_t bias_sub_shift[]);
-void enh_init();
-static void minstat_init();
-static void process_frame(int16_t inspeech[], int16_t outspeech[]);
-static void gain_mod(int16_t qk[], int16_t GainD[], int16_t m);
+void enh_init(struct melpe_npp *st);
+static void minstat_init(struct melpe_npp *st);
+static void process_frame(struct melpe_npp *st, int16_t inspeech[],
+			  int16_t outspeech[]);
+static void gain_mod(struct melpe_npp *st, int16_t qk[], int16_t GainD[],
+		     int16_t m);
 
 /****************************************************************************
 **
@@ -167,48 +121,59 @@ static void gain_mod(int16_t qk[], int16_t GainD[], int16_t m);
 ** Return value:	None
 **
 *****************************************************************************/
-void npp(int16_t sp_in[], int16_t sp_out[])
+void npp(struct melpe_npp *st, int16_t sp_in[], int16_t sp_out[])
 {
-	static int16_t speech_overlap[ENH_OVERLAP_LEN];
-	static BOOLEAN first_time = TRUE;
 	int16_t speech_out_npp[ENH_WINLEN];	/* output of one frame */
 
-	if (first_time) {
+	if (st->first_time) {
 
 		if (rate == RATE1200)
-			v_equ(initial_noise, sp_in, ENH_WINLEN);
+			v_equ(st->initial_noise, sp_in, ENH_WINLEN);
 		else {
-			v_zap(initial_noise, ENH_OVERLAP_LEN);
-			v_equ(&initial_noise[ENH_OVERLAP_LEN], sp_in,
+			v_zap(st->initial_noise, ENH_OVERLAP_LEN);
+			v_equ(&st->initial_noise[ENH_OVERLAP_LEN], sp_in,
 			      ENH_WIN_SHIFT);
 		}
-		enh_init();	/* Initialize enhancement routine */
-		v_zap(speech_in_npp, ENH_WINLEN);
+		enh_init(st);	/* Initialize enhancement routine */
+		v_zap(st->speech_in_npp, ENH_WINLEN);
 
-		first_time = FALSE;
+		st->first_time = FALSE;
 	}
 
 	/* Shift input buffer from the previous frame */
-	v_equ(speech_in_npp, &(speech_in_npp[ENH_WIN_SHIFT]), ENH_OVERLAP_LEN);
-	v_equ(&(speech_in_npp[ENH_OVERLAP_LEN]), sp_in, ENH_WIN_SHIFT);
+	v_equ(st->speech_in_npp, &(st->speech_in_npp[ENH_WIN_SHIFT]), ENH_OVERLAP_LEN);
+	v_equ(&(st->speech_in_npp[ENH_OVERLAP_LEN]), sp_in, ENH_WIN_SHIFT);
 
 	/* ======== Process one frame ======== */
-	process_frame(speech_in_npp, speech_out_npp);
+	process_frame(st, st->speech_in_npp, speech_out_npp);
 
 	/* Overlap-add the output buffer. */
-	v_add(speech_out_npp, speech_overlap, ENH_OVERLAP_LEN);
-	v_equ(speech_overlap, &(speech_out_npp[ENH_WIN_SHIFT]),
+	v_add(speech_out_npp, st->speech_overlap, ENH_OVERLAP_LEN);
+	v_equ(st->speech_overlap, &(speech_out_npp[ENH_WIN_SHIFT]),
 	      ENH_OVERLAP_LEN);
 
 	/* ======== Output enhanced speech ======== */
 	v_equ(sp_out, speech_out_npp, ENH_WIN_SHIFT);
 }
 
+/*****************************************************************************/
+/*	  Subroutine npp_init: power-up state of the noise pre-processor		 */
+/*****************************************************************************/
+void npp_init(struct melpe_npp *st)
+{
+	memset(st, 0, sizeof(struct melpe_npp));
+	st->first_time = TRUE;
+	st->frame_first = TRUE;
+	st->Ksi_min_var = GM_MIN;
+	fill(st->qla, X05_Q15, ENH_VEC_LENF);
+}
+
 /*****************************************************************************/
 /*	  Subroutine gain_mod: compute gain modification factor based on		 */
 /*		 signal absence probabilities qk									 */
 /*****************************************************************************/
-static void gain_mod(int16_t qk[], int16_t GainD[], int16_t m)
+static void gain_mod(struct melpe_npp *st, int16_t qk[], int16_t GainD[],
+		     int16_t m)
 {
 	register int16_t i;
 	int16_t temp, temp1, temp2, temp3, temp4, shift;
@@ -233,18 +198,18 @@ static void gain_mod(int16_t qk[], int16_t GainD[], int16_t m)
 		/*      GM[i] = temp2 / (temp2 + (temp + ksi[i])*qk[i]*exp(-vk[i])) */
 
 		/*      exp(-vk) = 2^(2*vk*(-0.5*log2(e))), and -23637 is -0.5*log2(e).   */
-		L_sum = melpe_L_mult(vk[i], -23637);	/* vk*(-0.5*log2(e)), Q15 */
-		shift = melpe_add(vk_shift[i], 1);
+		L_sum = melpe_L_mult(st->vk[i], -23637);	/* vk*(-0.5*log2(e)), Q15 */
+		shift = melpe_add(st->vk_shift[i], 1);
 		L_sum = melpe_L_shr(L_sum, melpe_sub(15, shift));	/* 2^x x Q16 */
 
 		/*      temp + ksi[i] */
-		shift = melpe_sub(ksi_shift[i], temp_shift);
+		shift = melpe_sub(st->ksi_shift[i], temp_shift);
 		if (shift > 0) {
-			temp4 = melpe_add(ksi_shift[i], 1);
-			temp3 = melpe_add(melpe_shr(temp, melpe_add(shift, 1)), melpe_shr(ksi[i], 1));
+			temp4 = melpe_add(st->ksi_shift[i], 1);
+			temp3 = melpe_add(melpe_shr(temp, melpe_add(shift, 1)), melpe_shr(st->ksi[i], 1));
 		} else {
 			temp4 = melpe_add(temp_shift, 1);
-			temp3 = melpe_add(melpe_shr(temp, 1), melpe_shl(ksi[i], melpe_sub(shift, 1)));
+			temp3 = melpe_add(melpe_shr(temp, 1), melpe_shl(st->ksi[i], melpe_sub(shift, 1)));
 		}
 		/*      (temp + ksi[i])*qk[i] */
 		L_tmp = melpe_L_mult(temp3, qk[i]);
@@ -286,29 +251,20 @@ static void gain_mod(int16_t qk[], int16_t GainD[], int16_t m)
 /*	  Subroutine compute_qk: compute the probability of speech absence       */
 /*		This uses an harddecision approach due to Malah (ICASSP 1999).		 */
 /*****************************************************************************/
-static void compute_qk(int16_t qk[], int16_t gamaK[],
+static void compute_qk(struct melpe_npp *st, int16_t qk[], int16_t gamaK[],
 		       int16_t gamaK_shift[], int16_t GammaQ_TH)
 {
 	register int16_t i;
-	static BOOLEAN first_time = TRUE;
-	static int16_t qla[ENH_VEC_LENF];
-
-	/* Initializing qla[] */
-	if (first_time) {
-		fill(qla, X05_Q15, ENH_VEC_LENF);
-		first_time = FALSE;
-	}
-
 	/*      qla[] = alphaq * qla[]; */
-	v_scale(qla, ENH_ALPHAQ, ENH_VEC_LENF);
+	v_scale(st->qla, ENH_ALPHAQ, ENH_VEC_LENF);
 	for (i = 0; i < ENH_VEC_LENF; i++) {
 
 		/*      if (gamaK[i] < GammaQ_TH) */
 		if (comp_data_shift(gamaK[i], gamaK_shift[i], GammaQ_TH, 0) < 0)
 			/*      qla[] += betaq; */
-			qla[i] = melpe_add(qla[i], ENH_BETAQ);
+			st->qla[i] = melpe_add(st->qla[i], ENH_BETAQ);
 	}
-	v_equ(qk, qla, ENH_VEC_LENF);
+	v_equ(qk, st->qla, ENH_VEC_LENF);
 }
 
 /*****************************************************************************/
@@ -316,7 +272,7 @@ static void compute_qk(int16_t qk[], int16_t gamaK[],
 /*		variable vk for the Ephraim&Malah 1985 log spectral estimator.		 */
 /*	  Approximation of the exponential integral due to Malah, 1996			 */
 /*****************************************************************************/
-static void gain_log_mmse(int16_t qk[], int16_t Gain[],
+static void gain_log_mmse(struct melpe_npp *st, int16_t qk[], int16_t Gain[],
 			  int16_t gamaK[], int16_t gamaK_shift[],
 			  int16_t m)
 {
@@ -330,15 +286,15 @@ static void gain_log_mmse(int16_t qk[], int16_t Gain[],
 		temp1 = melpe_sub(ONE_Q15, qk[i]);
 		shift = melpe_norm_s(temp1);
 		temp1 = melpe_shl(temp1, shift);
-		temp2 = melpe_sub(ksi_shift[i], (int16_t) (-shift));
+		temp2 = melpe_sub(st->ksi_shift[i], (int16_t) (-shift));
 		/*      ksi[] + 1.0 - qk[] */
 		if (temp2 > 0) {
 			temp1 = melpe_shr(temp1, melpe_add(temp2, 1));
-			temp1 = melpe_add(temp1, melpe_shr(ksi[i], 1));
-			temp2 = melpe_shr(ksi[i], 1);
+			temp1 = melpe_add(temp1, melpe_shr(st->ksi[i], 1));
+			temp2 = melpe_shr(st->ksi[i], 1);
 		} else {
-			temp1 = melpe_add(melpe_shr(temp1, 1), melpe_shl(ksi[i], melpe_sub(temp2, 1)));
-			temp2 = melpe_shl(ksi[i], melpe_sub(temp2, 1));
+			temp1 = melpe_add(melpe_shr(temp1, 1), melpe_shl(st->ksi[i], melpe_sub(temp2, 1)));
+			temp2 = melpe_shl(st->ksi[i], melpe_sub(temp2, 1));
 		}
 
 		/*      ksi_vq = ksi[i] / (ksi[i] + 1.0 - qk[i]); */
@@ -347,39 +303,39 @@ static void gain_log_mmse(int16_t qk[], int16_t Gain[],
 		/*      vk[i] = ksi_vq * gamaK[i]; */
 		L_sum = melpe_L_mult(ksi_vq, gamaK[i]);
 		shift = melpe_norm_l(L_sum);
-		vk[i] = melpe_extract_h(melpe_L_shl(L_sum, shift));
-		vk_shift[i] = melpe_sub(gamaK_shift[i], shift);
+		st->vk[i] = melpe_extract_h(melpe_L_shl(L_sum, shift));
+		st->vk_shift[i] = melpe_sub(gamaK_shift[i], shift);
 
 		/* The original floating version compares vk[] against 2^{-52} ==     */
 		/* 2.220446049250313e-16.  Tian uses 32767*2^{-52} instead.           */
-		if (comp_data_shift(vk[i], vk_shift[i], 32767, -52) < 0) {
-			vk[i] = 32767;	/* MATLAB eps */
-			vk_shift[i] = -52;
+		if (comp_data_shift(st->vk[i], st->vk_shift[i], 32767, -52) < 0) {
+			st->vk[i] = 32767;	/* MATLAB eps */
+			st->vk_shift[i] = -52;
 		}
 
-		if (comp_data_shift(vk[i], vk_shift[i], 26214, -3) < 0) {
+		if (comp_data_shift(st->vk[i], st->vk_shift[i], 26214, -3) < 0) {
 			/* eiv = -2.31 * log10(vk[i]) - 0.6; */
-			temp1 = log10_fxp(vk[i], 15);	/* Q12 */
+			temp1 = log10_fxp(st->vk[i], 15);	/* Q12 */
 			L_sum = melpe_L_shl(melpe_L_deposit_l(temp1), 14);	/* Q26 */
 			L_sum =
-			    melpe_L_add(L_sum, melpe_L_shl(melpe_L_mult(vk_shift[i], 9864), 10));
+			    melpe_L_add(L_sum, melpe_L_shl(melpe_L_mult(st->vk_shift[i], 9864), 10));
 			L_sum = L_mpy_ls(L_sum, -18923);
 			/* -18923 = -2.31 (Q13). out Q24 */
 			L_sum = melpe_L_sub(L_sum, 10066330L);	/* 10066330L = 0.6 (Q24), Q24 */
-		} else if (comp_data_shift(vk[i], vk_shift[i], 25600, 8) > 0) {
+		} else if (comp_data_shift(st->vk[i], st->vk_shift[i], 25600, 8) > 0) {
 			/*      eiv = pow(10, -0.52 * 200 - 0.26); */
 			L_sum = 1;	/* Q24 */
 
 			/*      vk[] = 200; */
-			vk[i] = 25600;
-			vk_shift[i] = 8;
-		} else if (comp_data_shift(vk[i], vk_shift[i], 32767, 0) > 0) {
+			st->vk[i] = 25600;
+			st->vk_shift[i] = 8;
+		} else if (comp_data_shift(st->vk[i], st->vk_shift[i], 32767, 0) > 0) {
 			/*      eiv = pow(10, -0.52 * vk[i] - 0.26); */
-			L_sum = melpe_L_mult(vk[i], -17039);	/* -17039 == -0.52 Q15 */
+			L_sum = melpe_L_mult(st->vk[i], -17039);	/* -17039 == -0.52 Q15 */
 			L_sum =
-			    melpe_L_sub(L_sum, melpe_L_shr(melpe_L_deposit_h(8520), vk_shift[i]));
+			    melpe_L_sub(L_sum, melpe_L_shr(melpe_L_deposit_h(8520), st->vk_shift[i]));
 			/* 8520 == 0.26 Q15 */
-			L_sum = melpe_L_shr(L_sum, melpe_sub(14, vk_shift[i]));
+			L_sum = melpe_L_shr(L_sum, melpe_sub(14, st->vk_shift[i]));
 			L_sum = L_mpy_ls(L_sum, 27213);	/* Q15 to base 2 */
 			shift = melpe_extract_h(melpe_L_shl(L_sum, 1));	/* integer part */
 			temp1 = (int16_t) (melpe_extract_l(L_sum) & 0x7fff);
@@ -389,9 +345,9 @@ static void gain_log_mmse(int16_t qk[], int16_t Gain[],
 			L_sum = melpe_L_shl(L_sum, shift);	/* shift must < 0 */
 		} else {
 			/* eiv = -1.544 * log10(vk[i]) + 0.166; */
-			temp1 = vk[i];
-			if (vk_shift[i] != 0)
-				temp1 = melpe_shl(temp1, vk_shift[i]);
+			temp1 = st->vk[i];
+			if (st->vk_shift[i] != 0)
+				temp1 = melpe_shl(temp1, st->vk_shift[i]);
 			temp1 = log10_fxp(temp1, 15);	/* Q12 */
 			L_sum = melpe_L_shl(melpe_L_deposit_l(temp1), 13);	/* Q25 */
 			L_sum = L_mpy_ls(L_sum, -25297);	/* -25297 = -1.544, Q14. Q24 */
@@ -480,24 +436,25 @@ static int16_t ksi_min_adapt(BOOLEAN n_flag, int16_t ksi_min,
 
 /*****************************************************************************/
 /* Subroutine smoothing_win: applies the Parzen window.  The window applies  */
-/* an inverse trapezoid window and wtr_front[] supplies the coefficients for */
-/* the two edges.                                                            */
+/* an inverse trapezoid window and melpe_wtr_front[] supplies the            */
+/* coefficients for the two edges.                                           */
 /*****************************************************************************/
+const int16_t melpe_wtr_front[WTR_FRONT_LEN] = {	/* Q15 */
+	32767, 32582, 32048, 31202, 30080, 28718, 27152, 25418,
+	23552, 21590, 19568, 17522, 15488, 13502, 11600, 9818,
+	8192, 6750, 5488, 4394, 3456, 2662, 2000, 1458,
+	1024, 686, 432, 250, 128, 54, 16, 2
+};
+
 static void smoothing_win(int16_t initial_noise[])
 {
 	register int16_t i;
-	static const int16_t wtr_front[WTR_FRONT_LEN] = {	/* Q15 */
-		32767, 32582, 32048, 31202, 30080, 28718, 27152, 25418,
-		23552, 21590, 19568, 17522, 15488, 13502, 11600, 9818,
-		8192, 6750, 5488, 4394, 3456, 2662, 2000, 1458,
-		1024, 686, 432, 250, 128, 54, 16, 2
-	};
 
 	for (i = 1; i < WTR_FRONT_LEN; i++)
-		initial_noise[i] = melpe_mult(initial_noise[i], wtr_front[i]);
+		initial_noise[i] = melpe_mult(initial_noise[i], melpe_wtr_front[i]);
 	for (i = ENH_WINLEN - WTR_FRONT_LEN + 1; i < ENH_WINLEN; i++)
 		initial_noise[i] =
-		    melpe_mult(initial_noise[i], wtr_front[ENH_WINLEN - i]);
+		    melpe_mult(initial_noise[i], melpe_wtr_front[ENH_WINLEN - i]);
 
 	/* Clearing the central part of initial_noise[]. */
 	v_zap(&(initial_noise[WTR_FRONT_LEN]),
@@ -508,7 +465,8 @@ static void smoothing_win(int16_t initial_noise[])
 /*	Subroutine smoothed_periodogram: compute short time psd with optimal   */
 /*						 smoothing										   */
 /***************************************************************************/
-static void smoothed_periodogram(int16_t YY_av, int16_t yy_shift)
+static void smoothed_periodogram(struct melpe_npp *st, int16_t YY_av,
+				 int16_t yy_shift)
 {
 	register int16_t i;
 	int16_t smoothed_av, alphacorr_new, alpha_N_min_1, alpha_num;
@@ -519,20 +477,20 @@ static void smoothed_periodogram(int16_t YY_av, int16_t yy_shift)
 	/* ---- compute smoothed_av ---- */
 	max_shift = SW_MIN;
 	for (i = 0; i < ENH_VEC_LENF; i++) {
-		if (sm_shift[i] > max_shift)
-			max_shift = sm_shift[i];
+		if (st->sm_shift[i] > max_shift)
+			max_shift = st->sm_shift[i];
 	}
 
-	L_sum = melpe_L_shl(melpe_L_deposit_l(smoothedspect[0]),
-		      melpe_sub(7, melpe_sub(max_shift, sm_shift[0])));
-	L_sum = melpe_L_add(L_sum, melpe_L_shl(melpe_L_deposit_l(smoothedspect[ENH_VEC_LENF - 1]),
+	L_sum = melpe_L_shl(melpe_L_deposit_l(st->smoothedspect[0]),
+		      melpe_sub(7, melpe_sub(max_shift, st->sm_shift[0])));
+	L_sum = melpe_L_add(L_sum, melpe_L_shl(melpe_L_deposit_l(st->smoothedspect[ENH_VEC_LENF - 1]),
 				   melpe_sub(7,
 				       melpe_sub(max_shift,
-					   sm_shift[ENH_VEC_LENF - 1]))));
+					   st->sm_shift[ENH_VEC_LENF - 1]))));
 	for (i = 1; i < ENH_VEC_LENF - 1; i++)
-		L_sum = melpe_L_add(L_sum, melpe_L_shl(melpe_L_deposit_l(smoothedspect[i]),
+		L_sum = melpe_L_add(L_sum, melpe_L_shl(melpe_L_deposit_l(st->smoothedspect[i]),
 					   melpe_sub(8,
-					       melpe_sub(max_shift, sm_shift[i]))));
+					       melpe_sub(max_shift, st->sm_shift[i]))));
 
 	/* Now L_sum contains smoothed_av.  Here we do not multiply L_sum with    */
 	/* win_len_inv because we do not do this on YY_av either.                 */
@@ -579,17 +537,17 @@ static void smoothed_periodogram(int16_t YY_av, int16_t yy_shift)
 		alphacorr_new = X07_Q15;
 
 	/* -- alphacorr = 0.7*alphacorr + 0.3*alphacorr_new -- */
-	alphacorr = melpe_extract_h(melpe_L_add(melpe_L_mult(X07_Q15, alphacorr),
+	st->alphacorr = melpe_extract_h(melpe_L_add(melpe_L_mult(X07_Q15, st->alphacorr),
 				    melpe_L_mult(X03_Q15, alphacorr_new)));
 
 	/* -- compute alpha_N_min_1 -- */
 	/* -- alpha_N_min_1 = pow(SN_LT, PDECAY_NUM) */
-	if (comp_data_shift(SN_LT, SN_LT_shift, 16384, 15) > 0)
+	if (comp_data_shift(st->SN_LT, st->SN_LT_shift, 16384, 15) > 0)
 		L_sum = 536870912L;	/* Q15 */
-	else if (comp_data_shift(SN_LT, SN_LT_shift, 32, 15) < 0)
+	else if (comp_data_shift(st->SN_LT, st->SN_LT_shift, 32, 15) < 0)
 		L_sum = 1048576L;
 	else
-		L_sum = melpe_L_shl(melpe_L_deposit_l(SN_LT), SN_LT_shift);
+		L_sum = melpe_L_shl(melpe_L_deposit_l(st->SN_LT), st->SN_LT_shift);
 	temp = L_log10_fxp(L_sum, 15);	/* output Q11 */
 	temp = melpe_shl(temp, 1);	/* convert to Q12 */
 	temp = melpe_mult(temp, (int16_t) PDECAY_NUM);
@@ -603,24 +561,24 @@ static void smoothed_periodogram(int16_t YY_av, int16_t yy_shift)
 		alpha_N_min_1 = X005_Q15;
 
 	/* -- alpha_num = ALPHA_N_MAX * alphacorr -- */
-	alpha_num = melpe_mult(ALPHA_N_MAX, alphacorr);
+	alpha_num = melpe_mult(ALPHA_N_MAX, st->alphacorr);
 
 	/* -- compute smoothed spectrum -- */
 	for (i = 0; i < ENH_VEC_LENF; i++) {
-		tmpns = noisespect[i];
+		tmpns = st->noisespect[i];
 
 		/*      temp = smoothedspect[i] - tmpns; */
-		shift = melpe_sub(sm_shift[i], noise_shift[i]);
+		shift = melpe_sub(st->sm_shift[i], st->noise_shift[i]);
 		if (shift > 0) {
-			L_tmp = melpe_L_sub(melpe_L_deposit_h(smoothedspect[i]),
-				      melpe_L_shr(melpe_L_deposit_h(noisespect[i]), shift));
-			shift = sm_shift[i];
+			L_tmp = melpe_L_sub(melpe_L_deposit_h(st->smoothedspect[i]),
+				      melpe_L_shr(melpe_L_deposit_h(st->noisespect[i]), shift));
+			shift = st->sm_shift[i];
 		} else {
 			L_tmp =
 			    melpe_L_sub(melpe_L_shr
-				  (melpe_L_deposit_h(smoothedspect[i]), melpe_abs_s(shift)),
+				  (melpe_L_deposit_h(st->smoothedspect[i]), melpe_abs_s(shift)),
 				  melpe_L_deposit_h(tmpns));
-			shift = noise_shift[i];
+			shift = st->noise_shift[i];
 		}
 
 		temp1 = melpe_norm_l(L_tmp);
@@ -631,9 +589,9 @@ static void smoothed_periodogram(int16_t YY_av, int16_t yy_shift)
 		L_sum = melpe_L_mult(tmpns, tmpns);	/* noise square, shift*2 */
 		noise__shift = melpe_norm_l(L_sum);
 		tmpns = melpe_extract_h(melpe_L_shl(L_sum, noise__shift));
-		tmpns_shift = melpe_sub(melpe_shl(noise_shift[i], 1), noise__shift);
-		noisespect2[i] = tmpns;
-		noise2_shift[i] = tmpns_shift;
+		tmpns_shift = melpe_sub(melpe_shl(st->noise_shift[i], 1), noise__shift);
+		st->noisespect2[i] = tmpns;
+		st->noise2_shift[i] = tmpns_shift;
 
 		if (temp == SW_MIN)
 			L_sum = 0x7fffffff;
@@ -663,28 +621,28 @@ static void smoothed_periodogram(int16_t YY_av, int16_t yy_shift)
 			tmpalpha = alpha_N_min_1;
 
 		temp = melpe_sub(ONE_Q15, tmpalpha);	/* 1 - tmpalpha */
-		alpha_var[i] = tmpalpha;	/* save alpha */
+		st->alpha_var[i] = tmpalpha;	/* save alpha */
 
 		/*      smoothedspect[i] = tmpalpha * smoothedspect[i] + */
 		/*                     (1 - tmpalpha) * YY[i]; */
-		smav_shift = melpe_sub(YY_shift[i], sm_shift[i]);
+		smav_shift = melpe_sub(st->YY_shift[i], st->sm_shift[i]);
 		if (smav_shift > 0) {
 			L_sum =
-			    melpe_L_shr(melpe_L_mult(tmpalpha, smoothedspect[i]),
+			    melpe_L_shr(melpe_L_mult(tmpalpha, st->smoothedspect[i]),
 				  smav_shift);
-			L_sum = melpe_L_add(L_sum, melpe_L_mult(temp, YY[i]));
-			sm_shift[i] = YY_shift[i];
+			L_sum = melpe_L_add(L_sum, melpe_L_mult(temp, st->YY[i]));
+			st->sm_shift[i] = st->YY_shift[i];
 		} else {
-			L_sum = melpe_L_mult(tmpalpha, smoothedspect[i]);
+			L_sum = melpe_L_mult(tmpalpha, st->smoothedspect[i]);
 			L_sum =
 			    melpe_L_add(L_sum,
-				  melpe_L_shl(melpe_L_mult(temp, YY[i]), smav_shift));
+				  melpe_L_shl(melpe_L_mult(temp, st->YY[i]), smav_shift));
 		}
 		if (L_sum < 1)
 			L_sum = 1;
 		shift = melpe_norm_l(L_sum);
-		smoothedspect[i] = melpe_extract_h(melpe_L_shl(L_sum, shift));
-		sm_shift[i] = melpe_sub(sm_shift[i], shift);
+		st->smoothedspect[i] = melpe_extract_h(melpe_L_shl(L_sum, shift));
+		st->sm_shift[i] = melpe_sub(st->sm_shift[i], shift);
 	}
 }
 
@@ -692,7 +650,7 @@ static void smoothed_periodogram(int16_t YY_av, int16_t yy_shift)
 /* Subroutine normalized_variance: compute variance of smoothed periodogram, */
 /* normalize it, and use it to compute a biased smoothed periodogram		 */
 /*****************************************************************************/
-static void bias_compensation(int16_t biased_spect[],
+static void bias_compensation(struct melpe_npp *st, int16_t biased_spect[],
 			      int16_t bias_shift[],
 			      int16_t biased_spect_sub[],
 			      int16_t bias_sub_shift[])
@@ -709,96 +667,96 @@ static void bias_compensation(int16_t biased_spect[],
 
 		/*      tmp1 = alpha_var[i]*alpha_var[i]; */
 		/*      beta_var = (tmp1 > 0.8 ? 0.8 : tmp1); */
-		beta_var = melpe_mult(alpha_var[i], alpha_var[i]);
+		beta_var = melpe_mult(st->alpha_var[i], st->alpha_var[i]);
 		if (beta_var > X08_Q15)
 			beta_var = X08_Q15;
 
 		/*      tmp2 = (1 - beta_var) * smoothedspect[i]; */
-		L_sum = melpe_L_mult(melpe_sub(ONE_Q15, beta_var), smoothedspect[i]);
+		L_sum = melpe_L_mult(melpe_sub(ONE_Q15, beta_var), st->smoothedspect[i]);
 
 		/*      var_sp_av[i] = beta_var * var_sp_av[i] + tmp2; */
-		av__shift = melpe_sub(sm_shift[i], av_shift[i]);
+		av__shift = melpe_sub(st->sm_shift[i], st->av_shift[i]);
 		if (av__shift > 0) {
 			L_max1 =
 			    melpe_L_add(melpe_L_shr
-				  (melpe_L_mult(beta_var, var_sp_av[i]), av__shift),
+				  (melpe_L_mult(beta_var, st->var_sp_av[i]), av__shift),
 				  L_sum);
-			av_shift[i] = sm_shift[i];
+			st->av_shift[i] = st->sm_shift[i];
 		} else
-			L_max1 = melpe_L_add(melpe_L_mult(beta_var, var_sp_av[i]),
+			L_max1 = melpe_L_add(melpe_L_mult(beta_var, st->var_sp_av[i]),
 				       melpe_L_shl(L_sum, av__shift));
 		if (L_max1 < 1)
 			L_max1 = 1;
 		shift1 = melpe_norm_l(L_max1);
-		var_sp_av[i] = melpe_extract_h(melpe_L_shl(L_max1, shift1));
-		av_shift[i] = melpe_sub(av_shift[i], shift1);
+		st->var_sp_av[i] = melpe_extract_h(melpe_L_shl(L_max1, shift1));
+		st->av_shift[i] = melpe_sub(st->av_shift[i], shift1);
 
 		/*      tmp4 = tmp2 * smoothedspect[i]; */
 		/*      var_sp_2[i] = beta_var * var_sp_2[i] + tmp4; */
-		av2__shift = melpe_sub(melpe_shl(sm_shift[i], 1), av2_shift[i]);
+		av2__shift = melpe_sub(melpe_shl(st->sm_shift[i], 1), st->av2_shift[i]);
 		if (av2__shift > 0) {
 			L_max2 =
 			    melpe_L_add(melpe_L_shr
-				  (melpe_L_mult(beta_var, var_sp_2[i]), av2__shift),
-				  L_mpy_ls(L_sum, smoothedspect[i]));
-			av2_shift[i] = melpe_shl(sm_shift[i], 1);
+				  (melpe_L_mult(beta_var, st->var_sp_2[i]), av2__shift),
+				  L_mpy_ls(L_sum, st->smoothedspect[i]));
+			st->av2_shift[i] = melpe_shl(st->sm_shift[i], 1);
 		} else
-			L_max2 = melpe_L_add(melpe_L_mult(beta_var, var_sp_2[i]),
-				       melpe_L_shl(L_mpy_ls(L_sum, smoothedspect[i]),
+			L_max2 = melpe_L_add(melpe_L_mult(beta_var, st->var_sp_2[i]),
+				       melpe_L_shl(L_mpy_ls(L_sum, st->smoothedspect[i]),
 					     av2__shift));
 
 		if (L_max2 < 1)
 			L_max2 = 1;
 		shift1 = melpe_norm_l(L_max2);
-		var_sp_2[i] = melpe_extract_h(melpe_L_shl(L_max2, shift1));
-		av2_shift[i] = melpe_sub(av2_shift[i], shift1);
+		st->var_sp_2[i] = melpe_extract_h(melpe_L_shl(L_max2, shift1));
+		st->av2_shift[i] = melpe_sub(st->av2_shift[i], shift1);
 
 		/*      tmp3 = var_sp_av[i] * var_sp_av[i]; */
-		L_sum = melpe_L_mult(var_sp_av[i], var_sp_av[i]);
+		L_sum = melpe_L_mult(st->var_sp_av[i], st->var_sp_av[i]);
 
 		/*      var_sp = var_sp_2[i] - tmp3; */
-		shift3 = melpe_sub(av2_shift[i], melpe_shl(av_shift[i], 1));
+		shift3 = melpe_sub(st->av2_shift[i], melpe_shl(st->av_shift[i], 1));
 		if (shift3 > 0) {
 			L_sum =
-			    melpe_L_sub(melpe_L_deposit_h(var_sp_2[i]),
+			    melpe_L_sub(melpe_L_deposit_h(st->var_sp_2[i]),
 				  melpe_L_shr(L_sum, shift3));
-			shift4 = av2_shift[i];
+			shift4 = st->av2_shift[i];
 		} else {
 			L_sum =
-			    melpe_L_sub(melpe_L_shl(melpe_L_deposit_h(var_sp_2[i]), shift3),
+			    melpe_L_sub(melpe_L_shl(melpe_L_deposit_h(st->var_sp_2[i]), shift3),
 				  L_sum);
-			shift4 = melpe_shl(av_shift[i], 1);
+			shift4 = melpe_shl(st->av_shift[i], 1);
 		}
 		shift1 = melpe_sub(melpe_norm_l(L_sum), 1);
 		tmp1 = melpe_extract_h(melpe_L_shl(L_sum, shift1));
-		tmp = melpe_sub(melpe_sub(shift4, shift1), noise2_shift[i]);
+		tmp = melpe_sub(melpe_sub(shift4, shift1), st->noise2_shift[i]);
 
 		/*      tmp1 = var_sp / noisespect2[i]; */
-		var_rel[i] = melpe_divide_s(tmp1, noisespect2[i]);
+		st->var_rel[i] = melpe_divide_s(tmp1, st->noisespect2[i]);
 
 		/*      var_rel[i] = (tmp1 > 0.5 ? 0.5 : tmp1); */
-		if (comp_data_shift(var_rel[i], tmp, X05_Q15, 0) > 0)
-			var_rel[i] = X05_Q15;
+		if (comp_data_shift(st->var_rel[i], tmp, X05_Q15, 0) > 0)
+			st->var_rel[i] = X05_Q15;
 		else
-			var_rel[i] = melpe_shl(var_rel[i], tmp);
-		if (var_rel[i] < 0)
-			var_rel[i] = 0;
+			st->var_rel[i] = melpe_shl(st->var_rel[i], tmp);
+		if (st->var_rel[i] < 0)
+			st->var_rel[i] = 0;
 
 		/*      var_sum += var_rel[i]; */
-		L_var_sum = melpe_L_add(L_var_sum, melpe_L_deposit_l(var_rel[i]));
+		L_var_sum = melpe_L_add(L_var_sum, melpe_L_deposit_l(st->var_rel[i]));
 	}
 
 	/*      var_rel_av = (2 * var_sum - var_rel[0] - var_rel[ENH_VEC_LENF - 1]);  */
 	L_var_sum = melpe_L_shl(L_var_sum, 1);
-	L_var_sum = melpe_L_sub(L_var_sum, melpe_L_deposit_l(var_rel[0]));
-	L_var_sum = melpe_L_sub(L_var_sum, melpe_L_deposit_l(var_rel[ENH_VEC_LENF - 1]));
-	var_rel_av = melpe_extract_l(melpe_L_shr(L_var_sum, 8));	/* Q15 */
+	L_var_sum = melpe_L_sub(L_var_sum, melpe_L_deposit_l(st->var_rel[0]));
+	L_var_sum = melpe_L_sub(L_var_sum, melpe_L_deposit_l(st->var_rel[ENH_VEC_LENF - 1]));
+	st->var_rel_av = melpe_extract_l(melpe_L_shr(L_var_sum, 8));	/* Q15 */
 
 	/*      var_rel_av = (var_rel_av < 0 ? 0 : var_rel_av); */
-	if (var_rel_av < 0)
-		var_rel_av = 0;
+	if (st->var_rel_av < 0)
+		st->var_rel_av = 0;
 
-	var_rel_av_sqrt = melpe_mult(X15_Q13, sqrt_Q15(var_rel_av));	/* Q13 */
+	var_rel_av_sqrt = melpe_mult(X15_Q13, sqrt_Q15(st->var_rel_av));	/* Q13 */
 	var_rel_av_sqrt = melpe_add(ONE_Q13, var_rel_av_sqrt);	/* Q13 */
 
 	/*      tmp1 = var_rel_av_sqrt * Fvar; */
@@ -807,9 +765,9 @@ static void bias_compensation(int16_t biased_spect[],
 	tmp2 = melpe_extract_h(melpe_L_shl(melpe_L_mult(var_rel_av_sqrt, FVAR_SUB), 1));	/* Q13 */
 
 	for (i = 0; i < ENH_VEC_LENF; i++) {
-		L_tmp3 = melpe_L_mult(var_rel_av_sqrt, smoothedspect[i]);	/* Q29 */
-		tmp5 = var_rel[i];	/* Q15 */
-		L_tmp4 = melpe_L_mult(tmp5, smoothedspect[i]);	/* Q31 */
+		L_tmp3 = melpe_L_mult(var_rel_av_sqrt, st->smoothedspect[i]);	/* Q29 */
+		tmp5 = st->var_rel[i];	/* Q15 */
+		L_tmp4 = melpe_L_mult(tmp5, st->smoothedspect[i]);	/* Q31 */
 
 		/* quadratic approximation */
 		tmp = melpe_add(MINV, melpe_shr(tmp5, 1));	/* Q14 */
@@ -821,7 +779,7 @@ static void bias_compensation(int16_t biased_spect[],
 			L_sum = 1;
 		shift1 = melpe_norm_l(L_sum);
 		biased_spect[i] = melpe_extract_h(melpe_L_shl(L_sum, shift1));
-		bias_shift[i] = melpe_add(sm_shift[i], melpe_sub(8, shift1));
+		bias_shift[i] = melpe_add(st->sm_shift[i], melpe_sub(8, shift1));
 
 		tmp = melpe_add(MINV_SUB, melpe_shr(tmp5, 2));	/* Q13 */
 		tmp = melpe_add(MINV_SUB2, melpe_shr(melpe_mult(tmp5, tmp), 1));	/* Q12 */
@@ -832,7 +790,7 @@ static void bias_compensation(int16_t biased_spect[],
 			L_sum = 1;
 		shift1 = melpe_norm_l(L_sum);
 		biased_spect_sub[i] = melpe_extract_h(melpe_L_shl(L_sum, shift1));
-		bias_sub_shift[i] = melpe_add(sm_shift[i], melpe_sub(6, shift1));
+		bias_sub_shift[i] = melpe_add(st->sm_shift[i], melpe_sub(6, shift1));
 	}
 }
 
@@ -840,17 +798,17 @@ static void bias_compensation(int16_t biased_spect[],
 /*	Subroutine noise_slope: compute maximum of the permitted increase of   */
 /*		   the noise estimate as a function of the mean signal variance    */
 /***************************************************************************/
-static int16_t noise_slope()
+static int16_t noise_slope(struct melpe_npp *st)
 {
 	int16_t noise_slope_max;
 
-	if (var_rel_av > X018_Q15)
+	if (st->var_rel_av > X018_Q15)
 		noise_slope_max = X132_Q11;
-	else if ((var_rel_av < X003_Q15) || (enh_i < 50))
+	else if ((st->var_rel_av < X003_Q15) || (st->enh_i < 50))
 		noise_slope_max = X88_Q11;
-	else if (var_rel_av < X005_Q15)
+	else if (st->var_rel_av < X005_Q15)
 		noise_slope_max = X44_Q11;
-	else if (var_rel_av < X006_Q15)
+	else if (st->var_rel_av < X006_Q15)
 		noise_slope_max = X22_Q11;
 	else
 		noise_slope_max = X132_Q11;
@@ -886,92 +844,87 @@ static int16_t comp_data_shift(int16_t num1, int16_t shift1,
 /***************************************************************************/
 /*	Subroutine min_search: find minimum of psd's in circular buffer 	   */
 /***************************************************************************/
-static void min_search(int16_t biased_spect[], int16_t bias_shift[],
+static void min_search(struct melpe_npp *st, int16_t biased_spect[],
+		       int16_t bias_shift[],
 		       int16_t biased_spect_sub[], int16_t bias_sub_shift[])
 {
 	register int16_t i, k;
-	static BOOLEAN localflag[ENH_VEC_LENF];	/* local minimum indicator */
-	static int16_t minspec_counter = 0;	/* count sub-windows */
-	static int16_t circb_index = 0;	/* ring buffer counter */
-	static int16_t circb_min[ENH_VEC_LENF];
-	/* minimum of circular buffer */
-	static int16_t circb_min_shift[ENH_VEC_LENF];
 	int16_t noise_slope_max, tmp, tmp_shift, temp1, temp2;
 	int32_t L_sum;
 
-	/* localflag[] is initialized to FALSE since it is static. */
+	/* localflag[] is initialized to FALSE by npp_init(). */
 
-	if (minspec_counter == 0) {
-		noise_slope_max = noise_slope();
+	if (st->minspec_counter == 0) {
+		noise_slope_max = noise_slope(st);
 
 		for (i = 0; i < ENH_VEC_LENF; i++) {
 			if (comp_data_shift(biased_spect[i], bias_shift[i],
-					    act_min[i], act_min_shift[i]) < 0) {
-				act_min[i] = biased_spect[i];	/* update minimum */
-				act_min_shift[i] = bias_shift[i];
-				act_min_sub[i] = biased_spect_sub[i];
-				act_min_sub_shift[i] = bias_sub_shift[i];
-				localflag[i] = FALSE;
+					    st->act_min[i], st->act_min_shift[i]) < 0) {
+				st->act_min[i] = biased_spect[i];	/* update minimum */
+				st->act_min_shift[i] = bias_shift[i];
+				st->act_min_sub[i] = biased_spect_sub[i];
+				st->act_min_sub_shift[i] = bias_sub_shift[i];
+				st->localflag[i] = FALSE;
 			}
 		}
 
 		/* write new minimum into ring buffer */
-		v_equ(circb[circb_index], act_min, ENH_VEC_LENF);
-		v_equ(circb_shift[circb_index], act_min_shift, ENH_VEC_LENF);
+		v_equ(st->circb[st->circb_index], st->act_min, ENH_VEC_LENF);
+		v_equ(st->circb_shift[st->circb_index], st->act_min_shift, ENH_VEC_LENF);
 
 		for (i = 0; i < ENH_VEC_LENF; i++) {
 			/* Find minimum of ring buffer.  Using temp1 and temp2 as cache   */
 			/* for circb_min[i] and circb_min_shift[i].                       */
 
-			temp1 = circb[0][i];
-			temp2 = circb_shift[0][i];
+			temp1 = st->circb[0][i];
+			temp2 = st->circb_shift[0][i];
 			for (k = 1; k < NUM_MINWIN; k++) {
 				if (comp_data_shift
-				    (circb[k][i], circb_shift[k][i], temp1,
+				    (st->circb[k][i], st->circb_shift[k][i], temp1,
 				     temp2) < 0) {
-					temp1 = circb[k][i];
-					temp2 = circb_shift[k][i];
+					temp1 = st->circb[k][i];
+					temp2 = st->circb_shift[k][i];
 				}
 			}
-			circb_min[i] = temp1;
-			circb_min_shift[i] = temp2;
+			st->circb_min[i] = temp1;
+			st->circb_min_shift[i] = temp2;
 		}
 		for (i = 0; i < ENH_VEC_LENF; i++) {
 			/*      rapid update in case of local minima which do not deviate
 			   more than noise_slope_max from the current minima */
-			tmp = melpe_mult(noise_slope_max, circb_min[i]);
-			tmp_shift = melpe_add(circb_min_shift[i], 4);	/* adjust for Q11 */
-			if (localflag[i] &&
-			    comp_data_shift(act_min_sub[i],
-					    act_min_sub_shift[i], circb_min[i],
-					    circb_min_shift[i]) > 0
-			    && comp_data_shift(act_min_sub[i],
-					       act_min_sub_shift[i], tmp,
+			tmp = melpe_mult(noise_slope_max, st->circb_min[i]);
+			tmp_shift = melpe_add(st->circb_min_shift[i], 4);	/* adjust for Q11 */
+			if (st->localflag[i] &&
+			    comp_data_shift(st->act_min_sub[i],
+					    st->act_min_sub_shift[i], st->circb_min[i],
+					    st->circb_min_shift[i]) > 0
+			    && comp_data_shift(st->act_min_sub[i],
+					       st->act_min_sub_shift[i], tmp,
 					       tmp_shift) < 0) {
-				circb_min[i] = act_min_sub[i];
-				circb_min_shift[i] = act_min_sub_shift[i];
+				st->circb_min[i] = st->act_min_sub[i];
+				st->circb_min_shift[i] = st->act_min_sub_shift[i];
 
 				/* propagate new rapid update minimum into ring buffer */
 				for (k = 0; k < NUM_MINWIN; k++) {
-					circb[k][i] = circb_min[i];
-					circb_shift[k][i] = circb_min_shift[i];
+					st->circb[k][i] = st->circb_min[i];
+					st->circb_shift[k][i] = st->circb_min_shift[i];
 				}
 			}
 		}
 
 		/* reset local minimum indicator */
-		fill(localflag, FALSE, ENH_VEC_LENF);
+		fill(st->localflag, FALSE, ENH_VEC_LENF);
 
 		/* increment ring buffer pointer */
-		circb_index = melpe_add(circb_index, 1);
-		if (circb_index == NUM_MINWIN)
-			circb_index = 0;
-	} else if (minspec_counter == 1) {
+		st->circb_index = melpe_add(st->circb_index, 1);
+		if (st->circb_index == NUM_MINWIN)
+			st->circb_index = 0;
+	} else if (st->minspec_counter == 1) {
 
-		v_equ(act_min, biased_spect, ENH_VEC_LENF);
-		v_equ(act_min_shift, bias_shift, ENH_VEC_LENF);
-		v_equ(act_min_sub, biased_spect_sub, ENH_VEC_LENF);
-		v_equ(act_min_sub_shift, bias_sub_shift, ENH_VEC_LENF);
+		v_equ(st->act_min, biased_spect, ENH_VEC_LENF);
+		v_equ(st->act_min_shift, bias_shift, ENH_VEC_LENF);
+		v_equ(st->act_min_sub, biased_spect_sub, ENH_VEC_LENF);
+		v_equ(st->act_min_sub_shift, bias_sub_shift, ENH_VEC_LENF);
 
 	} else {		/* minspec_counter > 1 */
 
@@ -981,46 +934,46 @@ static void min_search(int16_t biased_spect[], int16_t bias_shift[],
 
 		for (i = 0; i < ENH_VEC_LENF; i++) {
 			if (comp_data_shift(biased_spect[i], bias_shift[i],
-					    act_min[i], act_min_shift[i]) < 0) {
+					    st->act_min[i], st->act_min_shift[i]) < 0) {
 				/* update minimum */
-				act_min[i] = biased_spect[i];
-				act_min_shift[i] = bias_shift[i];
-				act_min_sub[i] = biased_spect_sub[i];
-				act_min_sub_shift[i] = bias_sub_shift[i];
-				localflag[i] = TRUE;
+				st->act_min[i] = biased_spect[i];
+				st->act_min_shift[i] = bias_shift[i];
+				st->act_min_sub[i] = biased_spect_sub[i];
+				st->act_min_sub_shift[i] = bias_sub_shift[i];
+				st->localflag[i] = TRUE;
 			}
 		}
 		for (i = 0; i < ENH_VEC_LENF; i++) {
 			if (comp_data_shift
-			    (act_min_sub[i], act_min_sub_shift[i], circb_min[i],
-			     circb_min_shift[i]) < 0) {
-				circb_min[i] = act_min_sub[i];
-				circb_min_shift[i] = act_min_sub_shift[i];
+			    (st->act_min_sub[i], st->act_min_sub_shift[i], st->circb_min[i],
+			     st->circb_min_shift[i]) < 0) {
+				st->circb_min[i] = st->act_min_sub[i];
+				st->circb_min_shift[i] = st->act_min_sub_shift[i];
 			}
 		}
 
-		v_equ(noisespect, circb_min, ENH_VEC_LENF);
-		v_equ(noise_shift, circb_min_shift, ENH_VEC_LENF);
+		v_equ(st->noisespect, st->circb_min, ENH_VEC_LENF);
+		v_equ(st->noise_shift, st->circb_min_shift, ENH_VEC_LENF);
 
 		for (i = 0; i < ENH_VEC_LENF; i++) {
-			L_sum = melpe_L_mult(ENH_NOISE_BIAS, noisespect[i]);
+			L_sum = melpe_L_mult(ENH_NOISE_BIAS, st->noisespect[i]);
 			if (L_sum < 0x40000000L) {
 				L_sum = melpe_L_shl(L_sum, 1);
-				lambdaD_shift[i] = noise_shift[i];
+				st->lambdaD_shift[i] = st->noise_shift[i];
 			} else
-				lambdaD_shift[i] = melpe_add(noise_shift[i], 1);
-			lambdaD[i] = melpe_extract_h(L_sum);
+				st->lambdaD_shift[i] = melpe_add(st->noise_shift[i], 1);
+			st->lambdaD[i] = melpe_extract_h(L_sum);
 		}
 	}
-	minspec_counter = melpe_add(minspec_counter, 1);
-	if (minspec_counter == LEN_MINWIN)
-		minspec_counter = 0;
+	st->minspec_counter = melpe_add(st->minspec_counter, 1);
+	if (st->minspec_counter == LEN_MINWIN)
+		st->minspec_counter = 0;
 }
 
 /***************************************************************************/
 /*	Subroutine enh_init: initialization of variables for the enhancement   */
 /***************************************************************************/
-void enh_init()
+void enh_init(struct melpe_npp *st)
 {
 	register int16_t i;
 	int16_t max, shift, temp, norm_shift, guard;
@@ -1032,13 +985,13 @@ void enh_init()
 	/* Because initial_noise[] is read once and then never used, we can use   */
 	/* it for tempV2[] too.                                                   */
 
-	window(initial_noise, sqrt_tukey_256_180, initial_noise, ENH_WINLEN);
+	window(st->initial_noise, sqrt_tukey_256_180, st->initial_noise, ENH_WINLEN);
 
 	/* ---- Find normalization factor of the input signal ---- */
 	/* Starting max with 1 to avoid norm_s(0). */
 	max = 1;
 	for (i = 0; i < ENH_WINLEN; i++) {
-		temp = melpe_abs_s(initial_noise[i]);
+		temp = melpe_abs_s(st->initial_noise[i]);
 		if (temp > max)
 			max = temp;
 	}
@@ -1049,101 +1002,101 @@ void enh_init()
 	a_shift = melpe_sub(15, shift);
 
 	/* transfer to frequency domain */
-	v_zap(ybuf, 2 * ENH_WINLEN + 2);
+	v_zap(st->ybuf, 2 * ENH_WINLEN + 2);
 	for (i = 0; i < ENH_WINLEN; i++)
-		ybuf[2 * i] = melpe_shl(initial_noise[i], shift);
+		st->ybuf[2 * i] = melpe_shl(st->initial_noise[i], shift);
 
-	guard = fft_npp(ybuf, 1);
+	guard = fft_npp(st->ybuf, 1);
 	/* guard = fft(ybuf, ENH_WINLEN, MONE_Q15); */
 
 	/* get rough estimate of lambdaD  */
-	temp_yy[0] = melpe_L_shr(melpe_L_mult(ybuf[0], ybuf[0]), 1);
-	temp_yy[1] = 0;
-	temp_yy[ENH_WINLEN] =
-	    melpe_L_shr(melpe_L_mult(ybuf[ENH_WINLEN], ybuf[ENH_WINLEN]), 1);
-	temp_yy[ENH_WINLEN + 1] = 0;
+	st->temp_yy[0] = melpe_L_shr(melpe_L_mult(st->ybuf[0], st->ybuf[0]), 1);
+	st->temp_yy[1] = 0;
+	st->temp_yy[ENH_WINLEN] =
+	    melpe_L_shr(melpe_L_mult(st->ybuf[ENH_WINLEN], st->ybuf[ENH_WINLEN]), 1);
+	st->temp_yy[ENH_WINLEN + 1] = 0;
 
 	for (i = 2; i < ENH_WINLEN - 1; i += 2) {
-		temp_yy[i + 1] = 0;
-		temp_yy[i] = melpe_L_shr(melpe_L_add(melpe_L_mult(ybuf[i], ybuf[i]),
-					 melpe_L_mult(ybuf[i + 1], ybuf[i + 1])), 1);
+		st->temp_yy[i + 1] = 0;
+		st->temp_yy[i] = melpe_L_shr(melpe_L_add(melpe_L_mult(st->ybuf[i], st->ybuf[i]),
+					 melpe_L_mult(st->ybuf[i + 1], st->ybuf[i + 1])), 1);
 	}
 
-	L_sum = temp_yy[0];
+	L_sum = st->temp_yy[0];
 	for (i = 1; i < ENH_WINLEN + 1; i++) {
-		if (L_sum < temp_yy[i])
-			L_sum = temp_yy[i];
+		if (L_sum < st->temp_yy[i])
+			L_sum = st->temp_yy[i];
 	}
 	shift = melpe_norm_l(L_sum);
 	for (i = 0; i < ENH_WINLEN + 1; i++)
-		ybuf[i] = melpe_extract_h(melpe_L_shl(temp_yy[i], shift));
+		st->ybuf[i] = melpe_extract_h(melpe_L_shl(st->temp_yy[i], shift));
 	shift = melpe_sub(melpe_shl(melpe_add(a_shift, guard), 1), melpe_add(shift, 7));
 
 	/* convert to correlation domain */
 	for (i = 0; i < ENH_WINLEN / 2 - 1; i++) {
-		ybuf[ENH_WINLEN + 2 * i + 2] = ybuf[ENH_WINLEN - 2 * i - 2];
-		ybuf[ENH_WINLEN + 2 * i + 3] =
-		    melpe_negate(ybuf[ENH_WINLEN - 2 * i - 2 + 1]);
+		st->ybuf[ENH_WINLEN + 2 * i + 2] = st->ybuf[ENH_WINLEN - 2 * i - 2];
+		st->ybuf[ENH_WINLEN + 2 * i + 3] =
+		    melpe_negate(st->ybuf[ENH_WINLEN - 2 * i - 2 + 1]);
 	}
-	guard = fft_npp(ybuf, -1);	/* inverse fft */
+	guard = fft_npp(st->ybuf, -1);	/* inverse fft */
 	/* guard = fft(ybuf, ENH_WINLEN, ONE_Q15); */
 	shift = melpe_add(shift, guard);
 	shift = melpe_sub(shift, 8);
 	for (i = 0; i < ENH_WINLEN; i++)
-		initial_noise[i] = ybuf[2 * i];
+		st->initial_noise[i] = st->ybuf[2 * i];
 
 	max = 0;
 	for (i = 0; i < ENH_WINLEN; i++) {
-		temp = melpe_abs_s(initial_noise[i]);
+		temp = melpe_abs_s(st->initial_noise[i]);
 		if (temp > max)
 			max = temp;
 	}
 	temp = melpe_norm_s(max);
 	shift = melpe_sub(shift, temp);
 	for (i = 0; i < ENH_WINLEN; i++)
-		initial_noise[i] = melpe_shl(initial_noise[i], temp);
+		st->initial_noise[i] = melpe_shl(st->initial_noise[i], temp);
 
-	smoothing_win(initial_noise);
+	smoothing_win(st->initial_noise);
 
 	/* convert back to frequency domain */
-	v_zap(ybuf, 2 * ENH_WINLEN + 2);
+	v_zap(st->ybuf, 2 * ENH_WINLEN + 2);
 	for (i = 0; i < ENH_WINLEN; i++)
-		ybuf[2 * i] = initial_noise[i];
-	guard = fft_npp(ybuf, 1);
+		st->ybuf[2 * i] = st->initial_noise[i];
+	guard = fft_npp(st->ybuf, 1);
 	/* guard = fft(ybuf, ENH_WINLEN, MONE_Q15); */
 	for (i = 0; i <= (ENH_WINLEN * 2); i += 2) {
-		if (ybuf[i] < 0)
-			ybuf[i] = 0;
+		if (st->ybuf[i] < 0)
+			st->ybuf[i] = 0;
 	}
 	norm_shift = melpe_add(shift, guard);
 
 	/* rough estimate of lambdaD */
-	L_sum = melpe_L_shl(melpe_L_mult(NOISE_B_BY_NSMTH_B, ybuf[0]), 7);
+	L_sum = melpe_L_shl(melpe_L_mult(NOISE_B_BY_NSMTH_B, st->ybuf[0]), 7);
 	L_sum = melpe_L_add(L_sum, 2);
 	shift = melpe_norm_l(L_sum);
-	lambdaD[0] = melpe_extract_h(melpe_L_shl(L_sum, shift));
-	lambdaD_shift[0] = melpe_add(norm_shift, melpe_sub(1, shift));
+	st->lambdaD[0] = melpe_extract_h(melpe_L_shl(L_sum, shift));
+	st->lambdaD_shift[0] = melpe_add(norm_shift, melpe_sub(1, shift));
 	L_sum = melpe_L_shr(L_sum, 8);
 
-	L_data = melpe_L_shl(melpe_L_mult(NOISE_B_BY_NSMTH_B, ybuf[ENH_WINLEN]), 7);
+	L_data = melpe_L_shl(melpe_L_mult(NOISE_B_BY_NSMTH_B, st->ybuf[ENH_WINLEN]), 7);
 	L_data = melpe_L_add(L_data, 2);
 	shift = melpe_norm_l(L_data);
-	lambdaD[ENH_WINLEN / 2] = melpe_extract_h(melpe_L_shl(L_data, shift));
-	lambdaD_shift[ENH_WINLEN / 2] = melpe_add(norm_shift, melpe_sub(1, shift));
+	st->lambdaD[ENH_WINLEN / 2] = melpe_extract_h(melpe_L_shl(L_data, shift));
+	st->lambdaD_shift[ENH_WINLEN / 2] = melpe_add(norm_shift, melpe_sub(1, shift));
 	L_sum = melpe_L_add(L_sum, melpe_L_shr(L_data, 8));
 
 	for (i = 1; i < ENH_WINLEN / 2; i++) {
-		L_data = melpe_L_shl(melpe_L_mult(NOISE_B_BY_NSMTH_B, ybuf[2 * i]), 7);
+		L_data = melpe_L_shl(melpe_L_mult(NOISE_B_BY_NSMTH_B, st->ybuf[2 * i]), 7);
 		L_data = melpe_L_add(L_data, 2);
 		shift = melpe_norm_l(L_data);
-		lambdaD[i] = melpe_extract_h(melpe_L_shl(L_data, shift));
-		lambdaD_shift[i] = melpe_add(norm_shift, melpe_sub(1, shift));
+		st->lambdaD[i] = melpe_extract_h(melpe_L_shl(L_data, shift));
+		st->lambdaD_shift[i] = melpe_add(norm_shift, melpe_sub(1, shift));
 		L_sum = melpe_L_add(L_sum, melpe_L_shr(L_data, 7));
 	}
 
 	shift = melpe_norm_l(L_sum);
-	n_pwr = melpe_extract_h(melpe_L_shl(L_sum, shift));
-	n_pwr_shift = melpe_sub(melpe_add(norm_shift, 1), shift);
+	st->n_pwr = melpe_extract_h(melpe_L_shl(L_sum, shift));
+	st->n_pwr_shift = melpe_sub(melpe_add(norm_shift, 1), shift);
 
 	/* compute initial long term SNR; speech signal power depends on
 	   the window; the Hanning window is used as a reference here with
@@ -1151,49 +1104,49 @@ void enh_init()
 
 	temp = 14648;		/* 0.894/2 Q15 */
 	shift = 22;		/* exp = 22, sum = 1875000 */
-	SN_LT = melpe_divide_s(temp, n_pwr);
-	SN_LT_shift = melpe_sub(shift, n_pwr_shift);
+	st->SN_LT = melpe_divide_s(temp, st->n_pwr);
+	st->SN_LT_shift = melpe_sub(shift, st->n_pwr_shift);
 
-	minstat_init();
+	minstat_init(st);
 }
 
 /***************************************************************************/
 /*	Subroutine minstat_init: initialization of variables for minimum	   */
 /*							 statistics noise estimation				   */
 /***************************************************************************/
-static void minstat_init()
+static void minstat_init(struct melpe_npp *st)
 {
 	/* Initialize Minimum Statistics Noise Estimator */
 	register int16_t i;
 	int16_t shift;
 	int32_t L_sum;
 
-	v_equ(smoothedspect, lambdaD, ENH_VEC_LENF);
-	v_scale(smoothedspect, ENH_INV_NOISE_BIAS, ENH_VEC_LENF);
+	v_equ(st->smoothedspect, st->lambdaD, ENH_VEC_LENF);
+	v_scale(st->smoothedspect, ENH_INV_NOISE_BIAS, ENH_VEC_LENF);
 
 	for (i = 0; i < NUM_MINWIN; i++) {
-		v_equ(circb[i], smoothedspect, ENH_VEC_LENF);
-		v_equ(circb_shift[i], lambdaD_shift, ENH_VEC_LENF);
+		v_equ(st->circb[i], st->smoothedspect, ENH_VEC_LENF);
+		v_equ(st->circb_shift[i], st->lambdaD_shift, ENH_VEC_LENF);
 	}
 
-	v_equ(sm_shift, lambdaD_shift, ENH_VEC_LENF);
-	v_equ(act_min, smoothedspect, ENH_VEC_LENF);
-	v_equ(act_min_shift, lambdaD_shift, ENH_VEC_LENF);
-	v_equ(act_min_sub, smoothedspect, ENH_VEC_LENF);
-	v_equ(act_min_sub_shift, lambdaD_shift, ENH_VEC_LENF);
-	v_equ(noisespect, smoothedspect, ENH_VEC_LENF);
-	v_equ(noise_shift, lambdaD_shift, ENH_VEC_LENF);
+	v_equ(st->sm_shift, st->lambdaD_shift, ENH_VEC_LENF);
+	v_equ(st->act_min, st->smoothedspect, ENH_VEC_LENF);
+	v_equ(st->act_min_shift, st->lambdaD_shift, ENH_VEC_LENF);
+	v_equ(st->act_min_sub, st->smoothedspect, ENH_VEC_LENF);
+	v_equ(st->act_min_sub_shift, st->lambdaD_shift, ENH_VEC_LENF);
+	v_equ(st->noisespect, st->smoothedspect, ENH_VEC_LENF);
+	v_equ(st->noise_shift, st->lambdaD_shift, ENH_VEC_LENF);
 
 	for (i = 0; i < ENH_VEC_LENF; i++) {
-		var_sp_av[i] = melpe_mult(smoothedspect[i], 20066);	/* Q14, sqrt(3/2) */
-		av_shift[i] = melpe_add(lambdaD_shift[i], 1);
-		L_sum = melpe_L_mult(smoothedspect[i], smoothedspect[i]);
+		st->var_sp_av[i] = melpe_mult(st->smoothedspect[i], 20066);	/* Q14, sqrt(3/2) */
+		st->av_shift[i] = melpe_add(st->lambdaD_shift[i], 1);
+		L_sum = melpe_L_mult(st->smoothedspect[i], st->smoothedspect[i]);
 		shift = melpe_norm_l(L_sum);
-		var_sp_2[i] = melpe_extract_h(melpe_L_shl(L_sum, shift));
-		av2_shift[i] = melpe_sub(melpe_shl(lambdaD_shift[i], 1), melpe_sub(shift, 1));
+		st->var_sp_2[i] = melpe_extract_h(melpe_L_shl(L_sum, shift));
+		st->av2_shift[i] = melpe_sub(melpe_shl(st->lambdaD_shift[i], 1), melpe_sub(shift, 1));
 	}
 
-	alphacorr = X09_Q15;
+	st->alphacorr = X09_Q15;
 }
 
 /***************************************************************************/
@@ -1209,17 +1162,10 @@ static void minstat_init()
 ** Return value:    None
 **
  ***************************************************************************/
-static void process_frame(int16_t inspeech[], int16_t outspeech[])
+static void process_frame(struct melpe_npp *st, int16_t inspeech[],
+			  int16_t outspeech[])
 {
 	register int16_t i;
-	static BOOLEAN first_time = TRUE;
-	static int16_t agal[ENH_VEC_LENF];	/* GainD*Ymag */
-	static int16_t agal_shift[ENH_VEC_LENF];
-	static int16_t Ksi_min_var = GM_MIN;
-	static int16_t qk[ENH_VEC_LENF];	/* probability of noise only, Q15 */
-	static int16_t Gain[ENH_VEC_LENF];	/* MMSE LOG STA estimator gain */
-	static int16_t YY_LT, YY_LT_shift;
-	static int16_t SN_LT0, SN_LT0_shift;
 	BOOLEAN n_flag;
 	int16_t temp, temp_shift;
 	int16_t YY_av, gamma_av, gamma_max, gamma_av_shift, gamma_max_shift;
@@ -1238,24 +1184,24 @@ static void process_frame(int16_t inspeech[], int16_t outspeech[])
 	int16_t bias_shift[ENH_VEC_LENF], bias_sub_shift[ENH_VEC_LENF];
 	int32_t L_sum, L_max;
 
-	if (first_time) {
-		v_zap(agal, ENH_VEC_LENF);
-		v_zap(agal_shift, ENH_VEC_LENF);
-		fill(ksi, GM_MIN, ENH_VEC_LENF);
-		v_zap(ksi_shift, ENH_VEC_LENF);
-		fill(qk, ENH_QK_MAX, ENH_VEC_LENF);
-		fill(Gain, GM_MIN, ENH_VEC_LENF);
+	if (st->frame_first) {
+		v_zap(st->agal, ENH_VEC_LENF);
+		v_zap(st->agal_shift, ENH_VEC_LENF);
+		fill(st->ksi, GM_MIN, ENH_VEC_LENF);
+		v_zap(st->ksi_shift, ENH_VEC_LENF);
+		fill(st->qk, ENH_QK_MAX, ENH_VEC_LENF);
+		fill(st->Gain, GM_MIN, ENH_VEC_LENF);
 		fill(GainD, GM_MIN, ENH_VEC_LENF);
-		YY_LT = 0;
-		YY_LT_shift = 0;
-		SN_LT0 = SN_LT;
-		SN_LT0_shift = SN_LT_shift;
+		st->YY_LT = 0;
+		st->YY_LT_shift = 0;
+		st->SN_LT0 = st->SN_LT;
+		st->SN_LT0_shift = st->SN_LT_shift;
 
-		first_time = FALSE;
+		st->frame_first = FALSE;
 	}
 
-	if (enh_i < 50)		/* This ensures enh_i does not overflow. */
-		enh_i++;
+	if (st->enh_i < 50)		/* This ensures enh_i does not overflow. */
+		st->enh_i++;
 
 	/* analysis window */
 	window(inspeech, sqrt_tukey_256_180, analy, ENH_WINLEN);	/* analy[] Q0 */
@@ -1278,10 +1224,10 @@ static void process_frame(int16_t inspeech[], int16_t outspeech[])
 	for (i = 0; i < ENH_WINLEN; i++)
 		analy[i] = melpe_shl(analy[i], shift);
 
-	v_zap(ybuf, 2 * ENH_WINLEN + 2);
+	v_zap(st->ybuf, 2 * ENH_WINLEN + 2);
 	for (i = 0; i < 2 * ENH_WINLEN; i += 2)
-		ybuf[i] = analy[i / 2];
-	guard = fft_npp(ybuf, 1);
+		st->ybuf[i] = analy[i / 2];
+	guard = fft_npp(st->ybuf, 1);
 	/* guard = fft(ybuf, ENH_WINLEN, MONE_Q15); */
 
 	/* Previously here we copy ybuf[] to Y[] and process Y[].  In fact this   */
@@ -1292,48 +1238,48 @@ static void process_frame(int16_t inspeech[], int16_t outspeech[])
 	Y_shift = melpe_add(a_shift, guard);
 	YY_av_shift = melpe_shl(Y_shift, 1);
 
-	temp_yy[0] = melpe_L_mult(ybuf[0], ybuf[0]);
-	temp_yy[ENH_VEC_LENF - 1] = melpe_L_mult(ybuf[ENH_WINLEN], ybuf[ENH_WINLEN]);
+	st->temp_yy[0] = melpe_L_mult(st->ybuf[0], st->ybuf[0]);
+	st->temp_yy[ENH_VEC_LENF - 1] = melpe_L_mult(st->ybuf[ENH_WINLEN], st->ybuf[ENH_WINLEN]);
 
 	for (i = 1; i < ENH_VEC_LENF - 1; i++)
-		temp_yy[i] = melpe_L_add(melpe_L_mult(ybuf[2 * i], ybuf[2 * i]),
-				   melpe_L_mult(ybuf[2 * i + 1], ybuf[2 * i + 1]));
+		st->temp_yy[i] = melpe_L_add(melpe_L_mult(st->ybuf[2 * i], st->ybuf[2 * i]),
+				   melpe_L_mult(st->ybuf[2 * i + 1], st->ybuf[2 * i + 1]));
 
 	max_YY_shift = SW_MIN;
 	for (i = 0; i < ENH_VEC_LENF; i++) {
-		if (temp_yy[i] < 1)
-			temp_yy[i] = 1;
-		shift = melpe_norm_l(temp_yy[i]);
-		YY[i] = melpe_extract_h(melpe_L_shl(temp_yy[i], shift));
-		YY_shift[i] = melpe_sub(YY_av_shift, shift);
-		if (max_YY_shift < YY_shift[i])
-			max_YY_shift = YY_shift[i];
+		if (st->temp_yy[i] < 1)
+			st->temp_yy[i] = 1;
+		shift = melpe_norm_l(st->temp_yy[i]);
+		st->YY[i] = melpe_extract_h(melpe_L_shl(st->temp_yy[i], shift));
+		st->YY_shift[i] = melpe_sub(YY_av_shift, shift);
+		if (max_YY_shift < st->YY_shift[i])
+			max_YY_shift = st->YY_shift[i];
 	}
 
 	for (i = 0; i < ENH_VEC_LENF; i++) {
-		temp = YY[i];
-		temp_shift = YY_shift[i];
+		temp = st->YY[i];
+		temp_shift = st->YY_shift[i];
 		if (temp_shift & 0x0001) {
 			temp = melpe_shr(temp, 1);
 			temp_shift = melpe_add(temp_shift, 1);
 		}
 		Ymag[i] = sqrt_Q15(temp);
 		Ymag_shift[i] = melpe_shr(temp_shift, 1);
-		YY_shift[i] = melpe_sub(YY_shift[i], 8);
+		st->YY_shift[i] = melpe_sub(st->YY_shift[i], 8);
 	}
 
 	/* ---- Compute YY_av ---- */
 	L_sum =
-	    melpe_L_shl(melpe_L_deposit_l(YY[0]), melpe_sub(7, melpe_sub(max_YY_shift, YY_shift[0])));
+	    melpe_L_shl(melpe_L_deposit_l(st->YY[0]), melpe_sub(7, melpe_sub(max_YY_shift, st->YY_shift[0])));
 	L_sum =
 	    melpe_L_add(L_sum,
-		  melpe_L_shl(melpe_L_deposit_l(YY[ENH_VEC_LENF - 1]),
-			melpe_sub(7, melpe_sub(max_YY_shift, YY_shift[ENH_VEC_LENF - 1]))));
+		  melpe_L_shl(melpe_L_deposit_l(st->YY[ENH_VEC_LENF - 1]),
+			melpe_sub(7, melpe_sub(max_YY_shift, st->YY_shift[ENH_VEC_LENF - 1]))));
 	for (i = 1; i < ENH_VEC_LENF - 1; i++)
-		L_sum = melpe_L_add(L_sum, melpe_L_shl(melpe_L_deposit_l(YY[i]),
+		L_sum = melpe_L_add(L_sum, melpe_L_shl(melpe_L_deposit_l(st->YY[i]),
 					   melpe_sub(8,
 					       melpe_sub(max_YY_shift,
-						   YY_shift[i]))));
+						   st->YY_shift[i]))));
 	if (L_sum == 0)
 		L_sum = 1;
 	temp1 = melpe_norm_l(L_sum);
@@ -1341,21 +1287,21 @@ static void process_frame(int16_t inspeech[], int16_t outspeech[])
 	YY_av_shift = melpe_sub(melpe_add(max_YY_shift, 1), temp1);
 
 	/* compute smoothed short time periodogram */
-	smoothed_periodogram(YY_av, YY_av_shift);
+	smoothed_periodogram(st, YY_av, YY_av_shift);
 
 	/* compute inverse bias and multiply short time periodogram with inverse  */
 	/* bias */
-	bias_compensation(biased_smoothedspect, bias_shift,
+	bias_compensation(st, biased_smoothedspect, bias_shift,
 			  biased_smoothedspect_sub, bias_sub_shift);
 
 	/* determine unbiased noise psd estimate by minimum search */
-	min_search(biased_smoothedspect, bias_shift, biased_smoothedspect_sub,
+	min_search(st, biased_smoothedspect, bias_shift, biased_smoothedspect_sub,
 		   bias_sub_shift);
 
 	/* compute 'gammas' */
 	for (i = 0; i < ENH_VEC_LENF; i++) {
-		gamaK[i] = melpe_divide_s(melpe_shr(YY[i], 1), lambdaD[i]);
-		gamaK_shift[i] = melpe_sub(melpe_add(YY_shift[i], 1), lambdaD_shift[i]);
+		gamaK[i] = melpe_divide_s(melpe_shr(st->YY[i], 1), st->lambdaD[i]);
+		gamaK_shift[i] = melpe_sub(melpe_add(st->YY_shift[i], 1), st->lambdaD_shift[i]);
 	}
 
 	/* compute average of gammas */
@@ -1405,38 +1351,38 @@ static void process_frame(int16_t inspeech[], int16_t outspeech[])
 	    (comp_data_shift(gamma_av, gamma_av_shift, GAMMAV_THR, 1) < 0)) {
 		n_flag = TRUE;	/* noise-only */
 
-		temp1 = melpe_mult(n_pwr, GAMMAV_THR);
-		temp2 = melpe_add(n_pwr_shift, 1 + 1);
+		temp1 = melpe_mult(st->n_pwr, GAMMAV_THR);
+		temp2 = melpe_add(st->n_pwr_shift, 1 + 1);
 		if (comp_data_shift(YY_av, YY_av_shift, temp1, temp2) > 0)
 			n_flag = FALSE;	/* overiding if frame SNR > 3dB (9/98) */
 	}
 
-	if (enh_i == 1) {	/* Initial estimation of apriori SNR and Gain */
+	if (st->enh_i == 1) {	/* Initial estimation of apriori SNR and Gain */
 		for (i = 0; i < ENH_VEC_LENF; i++) {
-			temp_yy[i] = melpe_L_mult(Ymag[i], GM_MIN);
-			shift = melpe_norm_l(temp_yy[i]);
-			agal[i] = melpe_extract_h(melpe_L_shl(temp_yy[i], shift));
-			agal_shift[i] = melpe_sub(Ymag_shift[i], shift);
+			st->temp_yy[i] = melpe_L_mult(Ymag[i], GM_MIN);
+			shift = melpe_norm_l(st->temp_yy[i]);
+			st->agal[i] = melpe_extract_h(melpe_L_shl(st->temp_yy[i], shift));
+			st->agal_shift[i] = melpe_sub(Ymag_shift[i], shift);
 		}
 	} else {		/* enh_i > 1 */
 
 		/* estimation of apriori SNR */
 		for (i = 0; i < ENH_VEC_LENF; i++) {
-			L_sum = melpe_L_mult(agal[i], agal[i]);
+			L_sum = melpe_L_mult(st->agal[i], st->agal[i]);
 			L_sum = L_mpy_ls(L_sum, ENH_ALPHAK);
 			if (L_sum < 1)
 				L_sum = 1;
 			shift = melpe_norm_l(L_sum);
 			temp1 = melpe_extract_h(melpe_L_shl(L_sum, shift));
-			temp2 = melpe_sub(melpe_shl(agal_shift[i], 1), melpe_add(shift, 8));
-			temp3 = lambdaD[i];
-			temp4 = lambdaD_shift[i];
+			temp2 = melpe_sub(melpe_shl(st->agal_shift[i], 1), melpe_add(shift, 8));
+			temp3 = st->lambdaD[i];
+			temp4 = st->lambdaD_shift[i];
 			if (melpe_sub(temp3, temp1) < 0) {
 				temp1 = melpe_shr(temp1, 1);
 				temp2 = (int16_t) (temp2 + 1);
 			}
-			ksi[i] = melpe_divide_s(temp1, temp3);
-			ksi_shift[i] = melpe_sub(temp2, temp4);
+			st->ksi[i] = melpe_divide_s(temp1, temp3);
+			st->ksi_shift[i] = melpe_sub(temp2, temp4);
 			if (comp_data_shift
 			    (gamaK[i], gamaK_shift[i], ENH_INV_NOISE_BIAS,
 			     0) > 0) {
@@ -1448,45 +1394,45 @@ static void process_frame(int16_t inspeech[], int16_t outspeech[])
 				temp1 = melpe_extract_h(melpe_L_shl(L_sum, shift));
 				temp1 = melpe_mult(temp1, ENH_BETAK);	/* note ENH_BETAK is Q18 */
 				temp2 = melpe_sub(gamaK_shift[i], melpe_add(shift, 3));
-				shift = melpe_sub(ksi_shift[i], temp2);
+				shift = melpe_sub(st->ksi_shift[i], temp2);
 				if (shift > 0) {
-					ksi[i] =
-					    melpe_add(melpe_shr(ksi[i], 1),
+					st->ksi[i] =
+					    melpe_add(melpe_shr(st->ksi[i], 1),
 						melpe_shr(temp1,
 						    (int16_t) (shift + 1)));
-					ksi_shift[i] = melpe_add(ksi_shift[i], 1);
+					st->ksi_shift[i] = melpe_add(st->ksi_shift[i], 1);
 				} else {
-					ksi[i] =
+					st->ksi[i] =
 					    melpe_add(melpe_shl
-						(ksi[i],
+						(st->ksi[i],
 						 (int16_t) (shift - 1)),
 						melpe_shr(temp1, 1));
-					ksi_shift[i] = melpe_add(temp2, 1);
+					st->ksi_shift[i] = melpe_add(temp2, 1);
 				}
 			}
 		}
 
 		/*      Ksi_min_var = 0.9*Ksi_min_var +
 		   0.1*ksi_min_adapt(n_flag, ksi_min, SN_LT);          */
-		temp1 = melpe_mult(X09_Q15, Ksi_min_var);
-		temp2 = melpe_mult(X01_Q15, ksi_min_adapt(n_flag, GM_MIN, SN_LT,
-						    SN_LT_shift));
-		Ksi_min_var = melpe_add(temp1, temp2);
+		temp1 = melpe_mult(X09_Q15, st->Ksi_min_var);
+		temp2 = melpe_mult(X01_Q15, ksi_min_adapt(n_flag, GM_MIN, st->SN_LT,
+						    st->SN_LT_shift));
+		st->Ksi_min_var = melpe_add(temp1, temp2);
 
-		shift = melpe_norm_s(Ksi_min_var);
-		temp1 = melpe_shl(Ksi_min_var, shift);
+		shift = melpe_norm_s(st->Ksi_min_var);
+		temp1 = melpe_shl(st->Ksi_min_var, shift);
 		/* ---- limit the bottom of the ksi ---- */
 		for (i = 0; i < ENH_VEC_LENF; i++) {
-			if (comp_data_shift(ksi[i], ksi_shift[i],
+			if (comp_data_shift(st->ksi[i], st->ksi_shift[i],
 					    temp1, melpe_negate(shift)) < 0) {
-				ksi[i] = temp1;
-				ksi_shift[i] = melpe_negate(shift);
+				st->ksi[i] = temp1;
+				st->ksi_shift[i] = melpe_negate(shift);
 			}
 		}
 
 		/* estimation of k-th component 'signal absence' prob and gain */
 		/* default value for qk's % (9/98)      */
-		fill(qk, ENH_QK_MAX, ENH_VEC_LENF);
+		fill(st->qk, ENH_QK_MAX, ENH_VEC_LENF);
 
 		if (!n_flag) {	/* SIGNAL PRESENT */
 			/* computation of the long term SNR */
@@ -1494,10 +1440,10 @@ static void process_frame(int16_t inspeech[], int16_t outspeech[])
 			    (gamma_av, gamma_av_shift, GAMMAV_THR, 1) > 0) {
 
 				/*      YY_LT = YY_LT * alpha_LT + beta_LT * YY_av; */
-				L_sum = melpe_L_mult(YY_LT, ENH_ALPHA_LT);
+				L_sum = melpe_L_mult(st->YY_LT, ENH_ALPHA_LT);
 				shift = melpe_norm_l(L_sum);
 				temp1 = melpe_extract_h(melpe_L_shl(L_sum, shift));
-				temp2 = melpe_sub(YY_LT_shift, shift);
+				temp2 = melpe_sub(st->YY_LT_shift, shift);
 				L_sum = melpe_L_mult(YY_av, ENH_BETA_LT);
 				shift = melpe_norm_l(L_sum);
 				temp3 = melpe_extract_h(melpe_L_shl(L_sum, shift));
@@ -1506,71 +1452,71 @@ static void process_frame(int16_t inspeech[], int16_t outspeech[])
 				temp3 = melpe_shr(temp3, 1);
 				shift = melpe_sub(temp2, temp4);
 				if (shift > 0) {
-					YY_LT = melpe_add(temp1, melpe_shr(temp3, shift));
-					YY_LT_shift = temp2;
+					st->YY_LT = melpe_add(temp1, melpe_shr(temp3, shift));
+					st->YY_LT_shift = temp2;
 				} else {
-					YY_LT = melpe_add(melpe_shl(temp1, shift), temp3);
-					YY_LT_shift = temp4;
+					st->YY_LT = melpe_add(melpe_shl(temp1, shift), temp3);
+					st->YY_LT_shift = temp4;
 				}
-				YY_LT_shift = melpe_add(YY_LT_shift, 1);
+				st->YY_LT_shift = melpe_add(st->YY_LT_shift, 1);
 
 				/*      SN_LT = (YY_LT/n_pwr) - 1;  Long-term S/N */
-				temp1 = melpe_sub(YY_LT, n_pwr);
+				temp1 = melpe_sub(st->YY_LT, st->n_pwr);
 				if (temp1 > 0) {
-					YY_LT = melpe_shr(YY_LT, 1);
-					YY_LT_shift = melpe_add(YY_LT_shift, 1);
+					st->YY_LT = melpe_shr(st->YY_LT, 1);
+					st->YY_LT_shift = melpe_add(st->YY_LT_shift, 1);
 				}
-				SN_LT = melpe_divide_s(YY_LT, n_pwr);
-				SN_LT_shift = melpe_sub(YY_LT_shift, n_pwr_shift);
+				st->SN_LT = melpe_divide_s(st->YY_LT, st->n_pwr);
+				st->SN_LT_shift = melpe_sub(st->YY_LT_shift, st->n_pwr_shift);
 
 				/*      if (SN_LT < 0); we didn't subtract 1 from SN_LT yet.      */
 				if (comp_data_shift
-				    (SN_LT, SN_LT_shift, ONE_Q15, 0) < 0) {
-					SN_LT = SN_LT0;
-					SN_LT_shift = SN_LT0_shift;
+				    (st->SN_LT, st->SN_LT_shift, ONE_Q15, 0) < 0) {
+					st->SN_LT = st->SN_LT0;
+					st->SN_LT_shift = st->SN_LT0_shift;
 				} else {
 					temp1 = ONE_Q15;
-					L_sum = melpe_L_sub(melpe_L_deposit_h(SN_LT),
+					L_sum = melpe_L_sub(melpe_L_deposit_h(st->SN_LT),
 						      melpe_L_shr(melpe_L_deposit_h(temp1),
-							    SN_LT_shift));
+							    st->SN_LT_shift));
 					shift = melpe_norm_l(L_sum);
-					SN_LT = melpe_extract_h(melpe_L_shl(L_sum, shift));
-					SN_LT_shift = melpe_sub(SN_LT_shift, shift);
+					st->SN_LT = melpe_extract_h(melpe_L_shl(L_sum, shift));
+					st->SN_LT_shift = melpe_sub(st->SN_LT_shift, shift);
 				}
 
 				/*      SN_LT0 = SN_LT; */
-				SN_LT0 = SN_LT;
-				SN_LT0_shift = SN_LT_shift;
+				st->SN_LT0 = st->SN_LT;
+				st->SN_LT0_shift = st->SN_LT_shift;
 			}
 
 			/* Estimating qk's using hard-decision approach (7/98) */
-			compute_qk(qk, gamaK, gamaK_shift, ENH_GAMMAQ_THR);
+			compute_qk(st, st->qk, gamaK, gamaK_shift, ENH_GAMMAQ_THR);
 
 			/*      vec_limit_top(qk, qk, qk_max, vec_lenf); */
 			/*      vec_limit_bottom(qk, qk, qk_min, vec_lenf); */
 			for (i = 0; i < ENH_VEC_LENF; i++) {
-				if (qk[i] > ENH_QK_MAX)
-					qk[i] = ENH_QK_MAX;
-				else if (qk[i] < ENH_QK_MIN)
-					qk[i] = ENH_QK_MIN;
+				if (st->qk[i] > ENH_QK_MAX)
+					st->qk[i] = ENH_QK_MAX;
+				else if (st->qk[i] < ENH_QK_MIN)
+					st->qk[i] = ENH_QK_MIN;
 			}
 
 		}
 
-		gain_log_mmse(qk, Gain, gamaK, gamaK_shift, ENH_VEC_LENF);
+		gain_log_mmse(st, st->qk, st->Gain, gamaK, gamaK_shift, ENH_VEC_LENF);
 
 		/* Previously the gain modification is done outside of gain_mod() and */
 		/* now it is moved inside. */
 
-		v_equ(GainD, Gain, ENH_VEC_LENF);
-		gain_mod(qk, GainD, ENH_VEC_LENF);
+		v_equ(GainD, st->Gain, ENH_VEC_LENF);
+		gain_mod(st, st->qk, GainD, ENH_VEC_LENF);
 
 		/*      vec_mult(Agal, GainD, Ymag, vec_lenf); */
 		for (i = 0; i < ENH_VEC_LENF; i++) {
 			L_sum = melpe_L_mult(GainD[i], Ymag[i]);
 			shift = melpe_norm_l(L_sum);
-			agal[i] = melpe_extract_h(melpe_L_shl(L_sum, shift));
-			agal_shift[i] = melpe_sub(Ymag_shift[i], shift);
+			st->agal[i] = melpe_extract_h(melpe_L_shl(L_sum, shift));
+			st->agal_shift[i] = melpe_sub(Ymag_shift[i], shift);
 
 		}
 
@@ -1579,32 +1525,32 @@ static void process_frame(int16_t inspeech[], int16_t outspeech[])
 	/* enhanced signal in frequency domain */
 	/*       (implement ygal = GainD .* Y)   */
 	for (i = 0; i < ENH_WINLEN + 2; i++)
-		temp_yy[i] = melpe_L_mult(ybuf[i], GainD[i / 2]);
+		st->temp_yy[i] = melpe_L_mult(st->ybuf[i], GainD[i / 2]);
 	L_max = 0;
 	for (i = 0; i < ENH_WINLEN + 2; i++)
-		if (L_max < melpe_L_abs(temp_yy[i]))
-			L_max = melpe_L_abs(temp_yy[i]);
+		if (L_max < melpe_L_abs(st->temp_yy[i]))
+			L_max = melpe_L_abs(st->temp_yy[i]);
 
 	shift = melpe_norm_l(L_max);
 	for (i = 0; i < ENH_WINLEN + 2; i++)
-		ybuf[i] = melpe_extract_h(melpe_L_shl(temp_yy[i], shift));
+		st->ybuf[i] = melpe_extract_h(melpe_L_shl(st->temp_yy[i], shift));
 	shift = melpe_sub(Y_shift, shift);
 
 	/* transformation to time domain */
 	for (i = 0; i < ENH_WINLEN / 2 - 1; i++) {
-		ybuf[ENH_WINLEN + 2 * i + 2] = ybuf[ENH_WINLEN - 2 * i - 2];
-		ybuf[ENH_WINLEN + 2 * i + 3] =
-		    melpe_negate(ybuf[ENH_WINLEN - 2 * i - 2 + 1]);
+		st->ybuf[ENH_WINLEN + 2 * i + 2] = st->ybuf[ENH_WINLEN - 2 * i - 2];
+		st->ybuf[ENH_WINLEN + 2 * i + 3] =
+		    melpe_negate(st->ybuf[ENH_WINLEN - 2 * i - 2 + 1]);
 	}
 
-	guard = fft_npp(ybuf, -1);
+	guard = fft_npp(st->ybuf, -1);
 	/* guard = fft(ybuf, ENH_WINLEN, ONE_Q15); */
 	shift = melpe_add(shift, guard);
 	shift = melpe_sub(shift, 8);
 
 #if USE_SYN_WINDOW
 	for (i = 0; i < ENH_WINLEN; i++) {
-		ygal = melpe_shl(ybuf[2 * i], melpe_sub(shift, 15));
+		ygal = melpe_shl(st->ybuf[2 * i], melpe_sub(shift, 15));
 		outspeech[i] = melpe_mult(ygal, sqrt_tukey_256_180[i]);
 	}
 #endif
@@ -1612,25 +1558,25 @@ static void process_frame(int16_t inspeech[], int16_t outspeech[])
 	/* Misc. updates */
 	max_YY_shift = SW_MIN;
 	for (i = 0; i < ENH_VEC_LENF; i++) {
-		if (max_YY_shift < lambdaD_shift[i])
-			max_YY_shift = lambdaD_shift[i];
+		if (max_YY_shift < st->lambdaD_shift[i])
+			max_YY_shift = st->lambdaD_shift[i];
 	}
 
-	L_sum = melpe_L_shl(melpe_L_deposit_l(lambdaD[0]),
-		      melpe_sub(7, melpe_sub(max_YY_shift, lambdaD_shift[0])));
-	L_sum = melpe_L_add(L_sum, melpe_L_shl(melpe_L_deposit_l(lambdaD[ENH_VEC_LENF - 1]),
+	L_sum = melpe_L_shl(melpe_L_deposit_l(st->lambdaD[0]),
+		      melpe_sub(7, melpe_sub(max_YY_shift, st->lambdaD_shift[0])));
+	L_sum = melpe_L_add(L_sum, melpe_L_shl(melpe_L_deposit_l(st->lambdaD[ENH_VEC_LENF - 1]),
 				   melpe_sub(7, melpe_sub(max_YY_shift,
-					      lambdaD_shift[ENH_VEC_LENF -
+					      st->lambdaD_shift[ENH_VEC_LENF -
 							    1]))));
 
 	for (i = 1; i < ENH_VEC_LENF - 1; i++)
-		L_sum = melpe_L_add(L_sum, melpe_L_shl(melpe_L_deposit_l(lambdaD[i]),
+		L_sum = melpe_L_add(L_sum, melpe_L_shl(melpe_L_deposit_l(st->lambdaD[i]),
 					   melpe_sub(8,
 					       melpe_sub(max_YY_shift,
-						   lambdaD_shift[i]))));
+						   st->lambdaD_shift[i]))));
 	if (L_sum == 0)
 		L_sum = 1;
 	shift = melpe_norm_l(L_sum);
-	n_pwr = melpe_extract_h(melpe_L_shl(L_sum, shift));
-	n_pwr_shift = melpe_add(melpe_sub(max_YY_shift, shift), 1);
+	st->n_pwr = melpe_extract_h(melpe_L_shl(L_sum, shift));
+	st->n_pwr_shift = melpe_add(melpe_sub(max_YY_shift, shift), 1);
 }
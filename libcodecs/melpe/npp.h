@@ -110,6 +110,12 @@ These settings are also suitable for the latest version (nsa8).
 						    /* qk-value, 0.93375, Q15 */
 #define ENH_BETAQ			2171	/* 0.06625, Q15 */
 
-extern void npp(int16_t sp_in[], int16_t sp_out[]);
+/* Parzen window edges for the initial noise autocorrelation, Q15 */
+extern const int16_t melpe_wtr_front[WTR_FRONT_LEN];
+
+struct melpe_npp;
+
+extern void npp_init(struct melpe_npp *st);
+extern void npp(struct melpe_npp *st, int16_t sp_in[], int16_t sp_out[]);
 
 #endif
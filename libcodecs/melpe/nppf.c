@@ -0,0 +1,584 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/* ================================================================== */
+/* nppf.c: floating point noise pre-processor for other codecs.       */
+/*                                                                    */
+/* The same log-MMSE enhancer with minimum statistics noise tracking  */
+/* as npp.c (Rainer Martin, AT&T Labs-Research), but with the block   */
+/* floating point mantissa/shift pairs of the fixed point version     */
+/* replaced by floats and the transforms done by the real kiss FFT.   */
+/* All parameters are taken from npp.h.  The frame advance is chosen  */
+/* at run time (128 to 240 samples) and the analysis/synthesis        */
+/* window is a square root Tukey window whose tapers overlap exactly, */
+/* so 160 sample frames need no separate raw buffer size.             */
+/* ================================================================== */
+
+#include <math.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "npp.h"
+#include "kiss_fftr.h"
+
+#define NPPF_MIN_SHIFT		(ENH_WINLEN / 2)	/* tapers must not overlap */
+#define NPPF_MAX_SHIFT		240
+
+#define Q(x, n)			((float)(x) / (float)(1L << (n)))
+
+/* ====== Parameters of npp.h as floats ====== */
+#define F_GM_MIN			Q(GM_MIN, 15)
+#define F_GAMMAX_THR		Q(GAMMAX_THR, 9)
+#define F_GAMMAV_THR		Q(GAMMAV_THR, 14)
+#define F_ALPHA_N_MAX		Q(ALPHA_N_MAX, 15)
+#define F_PDECAY_NUM		Q(PDECAY_NUM, 15)
+#define F_MINV				Q(MINV, 14)
+#define F_MINV_SUB			Q(MINV_SUB, 13)
+#define F_MINV2				Q(MINV2, 13)
+#define F_MINV_SUB2			Q(MINV_SUB2, 12)
+#define F_FVAR				Q(FVAR, 11)
+#define F_FVAR_SUB			Q(FVAR_SUB, 14)
+#define F_NOISE_BIAS		Q(ENH_NOISE_BIAS, 14)
+#define F_INV_NOISE_BIAS	Q(ENH_INV_NOISE_BIAS, 15)
+#define F_ALPHA_LT			Q(ENH_ALPHA_LT, 15)
+#define F_BETA_LT			Q(ENH_BETA_LT, 15)
+#define F_QK_MAX			Q(ENH_QK_MAX, 15)
+#define F_QK_MIN			Q(ENH_QK_MIN, 15)
+#define F_ALPHAK			Q(ENH_ALPHAK, 15)
+#define F_BETAK				Q(ENH_BETAK, 18)
+#define F_GAMMAQ_THR		Q(ENH_GAMMAQ_THR, 15)
+#define F_ALPHAQ			Q(ENH_ALPHAQ, 15)
+#define F_BETAQ				Q(ENH_BETAQ, 15)
+
+#define F_EPS				2.220446049250313e-16f	/* MATLAB eps */
+#define F_MIN_PSD			1e-20f	/* floor of the power spectra */
+
+struct melpe_nppf {
+	int shift;		/* frame advance, 0 before the first frame */
+	kiss_fftr_cfg fwd, inv;
+	float win[ENH_WINLEN];	/* sqrt Tukey analysis/synthesis window */
+	float speech_in[ENH_WINLEN];	/* input of one frame */
+	float overlap[ENH_WINLEN];	/* output tail of the previous frame */
+
+	int enh_i;
+	float lambdaD[ENH_VEC_LENF];	/* overestimated noise psd */
+	float SN_LT, SN_LT0;	/* long term SNR */
+	float n_pwr, YY_LT;
+	float YY[ENH_VEC_LENF];	/* signal periodogram of current frame */
+	float ksi[ENH_VEC_LENF];	/* a priori SNR */
+	float vk[ENH_VEC_LENF];
+	float agal[ENH_VEC_LENF];
+	float qk[ENH_VEC_LENF], qla[ENH_VEC_LENF];
+	float Gain[ENH_VEC_LENF];
+	float Ksi_min_var;
+
+	/* minimum statistics */
+	float smoothedspect[ENH_VEC_LENF];
+	float var_sp_av[ENH_VEC_LENF], var_sp_2[ENH_VEC_LENF];
+	float var_rel[ENH_VEC_LENF], var_rel_av;
+	float noisespect[ENH_VEC_LENF], noisespect2[ENH_VEC_LENF];
+	float alphacorr, alpha_var[ENH_VEC_LENF];
+	float circb[NUM_MINWIN][ENH_VEC_LENF];	/* ring buffer */
+	float circb_min[ENH_VEC_LENF];
+	float act_min[ENH_VEC_LENF], act_min_sub[ENH_VEC_LENF];
+	int localflag[ENH_VEC_LENF];
+	int minspec_counter, circb_index;
+
+	kiss_fft_cpx Y[ENH_VEC_LENF];	/* spectrum of current frame */
+};
+
+/* ====== Prototypes ====== */
+struct melpe_nppf *melpe_nppf_init(void);
+void melpe_nppf_exit(struct melpe_nppf *st);
+void melpe_nf(struct melpe_nppf *st, short *sp, int n);
+
+/* Mean over the full (two sided) spectrum of a one sided spectrum */
+static float spect_av(const float x[])
+{
+	int i;
+	float sum = 0.0f;
+
+	for (i = 1; i < ENH_VEC_LENF - 1; i++)
+		sum += x[i];
+	return (2.0f * sum + x[0] + x[ENH_VEC_LENF - 1]) / ENH_WINLEN;
+}
+
+/* Periodogram of x[] windowed, spectrum kept in st->Y */
+static void periodogram(struct melpe_nppf *st, const float x[], float yy[])
+{
+	int i;
+	float buf[ENH_WINLEN];
+
+	for (i = 0; i < ENH_WINLEN; i++)
+		buf[i] = x[i] * st->win[i];
+	kiss_fftr(st->fwd, buf, st->Y);
+	for (i = 0; i < ENH_VEC_LENF; i++) {
+		yy[i] = (st->Y[i].r * st->Y[i].r + st->Y[i].i * st->Y[i].i) /
+		    ENH_WINLEN;
+		if (yy[i] < F_MIN_PSD)
+			yy[i] = F_MIN_PSD;
+	}
+}
+
+/* Initial noise psd from the look ahead samples: periodogram smoothed by */
+/* a lag window on its autocorrelation, as enh_init() in npp.c            */
+static void nppf_enh_init(struct melpe_nppf *st)
+{
+	int i;
+	float r[ENH_WINLEN];
+	kiss_fft_cpx c[ENH_VEC_LENF];
+
+	periodogram(st, st->speech_in, st->YY);
+
+	/* to the correlation domain */
+	for (i = 0; i < ENH_VEC_LENF; i++) {
+		c[i].r = st->YY[i];
+		c[i].i = 0.0f;
+	}
+	kiss_fftri(st->inv, c, r);
+
+	/* Parzen window, r[] scaled by 1/N of the inverse transform */
+	r[0] /= ENH_WINLEN;
+	for (i = 1; i < WTR_FRONT_LEN; i++) {
+		r[i] *= Q(melpe_wtr_front[i], 15) / ENH_WINLEN;
+		r[ENH_WINLEN - i] *= Q(melpe_wtr_front[i], 15) / ENH_WINLEN;
+	}
+	for (; i <= ENH_WINLEN - WTR_FRONT_LEN; i++)
+		r[i] = 0.0f;
+
+	/* back to the frequency domain */
+	kiss_fftr(st->fwd, r, c);
+	for (i = 0; i < ENH_VEC_LENF; i++)
+		st->lambdaD[i] = F_NOISE_BIAS * (c[i].r > 0.0f ? c[i].r : 0.0f) +
+		    F_MIN_PSD;
+
+	st->n_pwr = spect_av(st->lambdaD);
+
+	/* initial long term SNR: 0.894/2 * 2^22 over the noise power, the */
+	/* Hanning window being the reference with a squared norm of 96     */
+	st->SN_LT = 1875000.0f / st->n_pwr;
+	st->SN_LT0 = st->SN_LT;
+
+	/* minimum statistics */
+	for (i = 0; i < ENH_VEC_LENF; i++) {
+		st->smoothedspect[i] = st->lambdaD[i] * F_INV_NOISE_BIAS;
+		st->act_min[i] = st->smoothedspect[i];
+		st->act_min_sub[i] = st->smoothedspect[i];
+		st->noisespect[i] = st->smoothedspect[i];
+		st->var_sp_av[i] = st->smoothedspect[i] * 1.2247449f;	/* sqrt(3/2) */
+		st->var_sp_2[i] = 2.0f * st->smoothedspect[i] * st->smoothedspect[i];
+		st->localflag[i] = 0;
+	}
+	for (i = 0; i < NUM_MINWIN; i++)
+		memcpy(st->circb[i], st->smoothedspect, sizeof(st->circb[i]));
+	memcpy(st->circb_min, st->smoothedspect, sizeof(st->circb_min));
+	st->alphacorr = 0.9f;
+	st->minspec_counter = 0;
+	st->circb_index = 0;
+
+	/* first frame */
+	st->enh_i = 0;
+	st->Ksi_min_var = F_GM_MIN;
+	st->YY_LT = 0.0f;
+	for (i = 0; i < ENH_VEC_LENF; i++) {
+		st->agal[i] = 0.0f;
+		st->ksi[i] = F_GM_MIN;
+		st->vk[i] = 0.0f;
+		st->qk[i] = F_QK_MAX;
+		st->qla[i] = 0.5f;
+		st->Gain[i] = F_GM_MIN;
+	}
+}
+
+/* Short time psd with optimal smoothing */
+static void smoothed_periodogram(struct melpe_nppf *st, float YY_av)
+{
+	int i;
+	float alphacorr_new, alpha_N_min_1, alpha_num, d, ns2, tmpalpha;
+
+	alphacorr_new = spect_av(st->smoothedspect) / YY_av - 1.0f;
+	alphacorr_new = 1.0f / (1.0f + alphacorr_new * alphacorr_new);
+	if (alphacorr_new < 0.7f)
+		alphacorr_new = 0.7f;
+	st->alphacorr = 0.7f * st->alphacorr + 0.3f * alphacorr_new;
+
+	alpha_N_min_1 = st->SN_LT > 0.0f ? powf(st->SN_LT, F_PDECAY_NUM) : 1.0f;
+	if (alpha_N_min_1 > 0.3f)
+		alpha_N_min_1 = 0.3f;
+	else if (alpha_N_min_1 < 0.05f)
+		alpha_N_min_1 = 0.05f;
+
+	alpha_num = F_ALPHA_N_MAX * st->alphacorr;
+
+	for (i = 0; i < ENH_VEC_LENF; i++) {
+		d = st->smoothedspect[i] - st->noisespect[i];
+		ns2 = st->noisespect[i] * st->noisespect[i];
+		st->noisespect2[i] = ns2;
+
+		tmpalpha = alpha_num * ns2 / (ns2 + d * d);
+		if (tmpalpha < alpha_N_min_1)
+			tmpalpha = alpha_N_min_1;
+		st->alpha_var[i] = tmpalpha;
+
+		st->smoothedspect[i] = tmpalpha * st->smoothedspect[i] +
+		    (1.0f - tmpalpha) * st->YY[i];
+	}
+}
+
+/* Variance of the smoothed periodogram and the bias compensated psd for */
+/* the long window and the subwindow                                     */
+static void bias_compensation(struct melpe_nppf *st, float biased[],
+			      float biased_sub[])
+{
+	int i;
+	float beta_var, tmp2, var_sp, vr, vras, t1, t2, var_sum = 0.0f;
+
+	for (i = 0; i < ENH_VEC_LENF; i++) {
+		beta_var = st->alpha_var[i] * st->alpha_var[i];
+		if (beta_var > 0.8f)
+			beta_var = 0.8f;
+
+		tmp2 = (1.0f - beta_var) * st->smoothedspect[i];
+		st->var_sp_av[i] = beta_var * st->var_sp_av[i] + tmp2;
+		st->var_sp_2[i] = beta_var * st->var_sp_2[i] +
+		    tmp2 * st->smoothedspect[i];
+
+		var_sp = st->var_sp_2[i] - st->var_sp_av[i] * st->var_sp_av[i];
+		vr = var_sp / st->noisespect2[i];
+		if (vr > 0.5f)
+			vr = 0.5f;
+		else if (vr < 0.0f)
+			vr = 0.0f;
+		st->var_rel[i] = vr;
+	}
+	for (i = 1; i < ENH_VEC_LENF - 1; i++)
+		var_sum += st->var_rel[i];
+	st->var_rel_av = (2.0f * var_sum + st->var_rel[0] +
+			  st->var_rel[ENH_VEC_LENF - 1]) / ENH_WINLEN;
+
+	vras = 1.0f + 1.5f * sqrtf(st->var_rel_av);
+	t1 = vras * F_FVAR;
+	t2 = vras * F_FVAR_SUB;
+
+	/* quadratic approximation of the inverse bias */
+	for (i = 0; i < ENH_VEC_LENF; i++) {
+		vr = st->var_rel[i];
+		biased[i] = st->smoothedspect[i] *
+		    (vras + t1 * vr * (F_MINV2 + vr * (F_MINV + vr)));
+		biased_sub[i] = st->smoothedspect[i] *
+		    (vras + t2 * vr * (F_MINV_SUB2 + vr * (F_MINV_SUB + vr)));
+	}
+}
+
+/* Maximum permitted increase of the noise estimate */
+static float noise_slope(struct melpe_nppf *st)
+{
+	if (st->var_rel_av > 0.18f)
+		return 1.32f;
+	else if ((st->var_rel_av < 0.03f) || (st->enh_i < 50))
+		return 8.8f;
+	else if (st->var_rel_av < 0.05f)
+		return 4.4f;
+	else if (st->var_rel_av < 0.06f)
+		return 2.2f;
+	else
+		return 1.32f;
+}
+
+/* Minimum of the psd's in the circular buffer */
+static void min_search(struct melpe_nppf *st, const float biased[],
+		       const float biased_sub[])
+{
+	int i, k;
+	float noise_slope_max, m;
+
+	if (st->minspec_counter == 0) {
+		noise_slope_max = noise_slope(st);
+
+		for (i = 0; i < ENH_VEC_LENF; i++) {
+			if (biased[i] < st->act_min[i]) {
+				st->act_min[i] = biased[i];
+				st->act_min_sub[i] = biased_sub[i];
+				st->localflag[i] = 0;
+			}
+		}
+
+		/* write new minimum into ring buffer and find its minimum */
+		memcpy(st->circb[st->circb_index], st->act_min,
+		       sizeof(st->act_min));
+		for (i = 0; i < ENH_VEC_LENF; i++) {
+			m = st->circb[0][i];
+			for (k = 1; k < NUM_MINWIN; k++)
+				if (st->circb[k][i] < m)
+					m = st->circb[k][i];
+			st->circb_min[i] = m;
+		}
+
+		/* rapid update in case of local minima which do not deviate */
+		/* more than noise_slope_max from the current minima         */
+		for (i = 0; i < ENH_VEC_LENF; i++) {
+			if (st->localflag[i] &&
+			    st->act_min_sub[i] > st->circb_min[i] &&
+			    st->act_min_sub[i] < noise_slope_max * st->circb_min[i]) {
+				st->circb_min[i] = st->act_min_sub[i];
+				for (k = 0; k < NUM_MINWIN; k++)
+					st->circb[k][i] = st->circb_min[i];
+			}
+			st->localflag[i] = 0;
+		}
+
+		if (++st->circb_index == NUM_MINWIN)
+			st->circb_index = 0;
+	} else if (st->minspec_counter == 1) {
+		memcpy(st->act_min, biased, sizeof(st->act_min));
+		memcpy(st->act_min_sub, biased_sub, sizeof(st->act_min_sub));
+	} else {
+		for (i = 0; i < ENH_VEC_LENF; i++) {
+			if (biased[i] < st->act_min[i]) {
+				st->act_min[i] = biased[i];
+				st->act_min_sub[i] = biased_sub[i];
+				st->localflag[i] = 1;
+			}
+			if (st->act_min_sub[i] < st->circb_min[i])
+				st->circb_min[i] = st->act_min_sub[i];
+			st->noisespect[i] = st->circb_min[i];
+			st->lambdaD[i] = F_NOISE_BIAS * st->noisespect[i];
+		}
+	}
+	if (++st->minspec_counter == LEN_MINWIN)
+		st->minspec_counter = 0;
+}
+
+/* Adaptive lower limit of the a priori SNR */
+static float ksi_min_adapt(int n_flag, float ksi_min, float sn_lt)
+{
+	float k;
+
+	if (n_flag)
+		return ksi_min;
+	k = ksi_min * powf(0.5f + sn_lt, 0.65f) * 0.0067379470f;	/* 2^-7.2134752 */
+	return k > 0.25f ? 0.25f : k;
+}
+
+/* Gain of the Ephraim & Malah 1985 log spectral estimator, with Malah's */
+/* 1996 approximation of the exponential integral                        */
+static void gain_log_mmse(struct melpe_nppf *st, const float gamaK[])
+{
+	int i;
+	float ksi_vq, vk, eiv, g;
+
+	for (i = 0; i < ENH_VEC_LENF; i++) {
+		ksi_vq = st->ksi[i] / (st->ksi[i] + 1.0f - st->qk[i]);
+		vk = ksi_vq * gamaK[i];
+		if (vk < F_EPS)
+			vk = F_EPS;
+
+		if (vk < 0.1f)
+			eiv = -2.31f * log10f(vk) - 0.6f;
+		else if (vk > 200.0f) {
+			eiv = 5.9604645e-8f;	/* 1 in Q24 */
+			vk = 200.0f;
+		} else if (vk > 1.0f)
+			eiv = powf(10.0f, -0.52f * vk - 0.26f);
+		else
+			eiv = -1.544f * log10f(vk) + 0.166f;
+		st->vk[i] = vk;
+
+		g = ksi_vq * expf(0.5f * eiv);
+		st->Gain[i] = g > 1.0f ? 1.0f : g;
+	}
+}
+
+/* Gain modification by the signal absence probabilities qk */
+static void gain_mod(struct melpe_nppf *st, float GainD[])
+{
+	int i;
+	float t, t2, gm;
+
+	for (i = 0; i < ENH_VEC_LENF; i++) {
+		t = 1.0f - st->qk[i];
+		if (t < Q(1, 15))
+			t = Q(1, 15);
+		t2 = t * t;
+		gm = t2 / (t2 + (t + st->ksi[i]) * st->qk[i] * expf(-st->vk[i]));
+		if (gm < F_GM_MIN)
+			gm = F_GM_MIN;
+		GainD[i] = st->Gain[i] * gm;
+	}
+}
+
+/* Enhance one frame: st->speech_in[] -> out[] (windowed, to be overlap */
+/* added)                                                               */
+static void process_frame(struct melpe_nppf *st, float out[])
+{
+	int i, n_flag;
+	float YY_av, gamma_av, gamma_max, ks, r;
+	float Ymag[ENH_VEC_LENF], GainD[ENH_VEC_LENF], gamaK[ENH_VEC_LENF];
+	float biased[ENH_VEC_LENF], biased_sub[ENH_VEC_LENF];
+
+	if (st->enh_i < 50)
+		st->enh_i++;
+
+	periodogram(st, st->speech_in, st->YY);
+	for (i = 0; i < ENH_VEC_LENF; i++)
+		Ymag[i] = sqrtf(st->YY[i]);
+	YY_av = spect_av(st->YY);
+
+	smoothed_periodogram(st, YY_av);
+	bias_compensation(st, biased, biased_sub);
+	min_search(st, biased, biased_sub);
+
+	/* a posteriori SNR */
+	gamma_max = 0.0f;
+	for (i = 0; i < ENH_VEC_LENF; i++) {
+		gamaK[i] = st->YY[i] / st->lambdaD[i];
+		if (gamaK[i] > gamma_max)
+			gamma_max = gamaK[i];
+	}
+	gamma_av = spect_av(gamaK);
+
+	/* determine signal presence, overriding if frame SNR > 3dB (9/98) */
+	n_flag = (gamma_max < F_GAMMAX_THR) && (gamma_av < F_GAMMAV_THR) &&
+	    !(YY_av > 2.0f * F_GAMMAV_THR * st->n_pwr);
+
+	if (st->enh_i == 1) {	/* initial estimation of apriori SNR and Gain */
+		for (i = 0; i < ENH_VEC_LENF; i++) {
+			GainD[i] = F_GM_MIN;
+			st->agal[i] = Ymag[i] * F_GM_MIN;
+		}
+	} else {
+		/* decision directed a priori SNR */
+		for (i = 0; i < ENH_VEC_LENF; i++) {
+			ks = F_ALPHAK * st->agal[i] * st->agal[i] / st->lambdaD[i];
+			if (gamaK[i] > F_INV_NOISE_BIAS)
+				ks += F_BETAK * (gamaK[i] - F_INV_NOISE_BIAS);
+			st->ksi[i] = ks;
+		}
+
+		st->Ksi_min_var = 0.9f * st->Ksi_min_var +
+		    0.1f * ksi_min_adapt(n_flag, F_GM_MIN, st->SN_LT);
+		for (i = 0; i < ENH_VEC_LENF; i++)
+			if (st->ksi[i] < st->Ksi_min_var)
+				st->ksi[i] = st->Ksi_min_var;
+
+		/* signal absence probabilities */
+		for (i = 0; i < ENH_VEC_LENF; i++)
+			st->qk[i] = F_QK_MAX;
+
+		if (!n_flag) {
+			/* long term SNR */
+			if (gamma_av > F_GAMMAV_THR) {
+				st->YY_LT = st->YY_LT * F_ALPHA_LT + F_BETA_LT * YY_av;
+				r = st->YY_LT / st->n_pwr;
+				st->SN_LT = r < 1.0f ? st->SN_LT0 : r - 1.0f;
+				st->SN_LT0 = st->SN_LT;
+			}
+
+			/* hard decision qk's (7/98) */
+			for (i = 0; i < ENH_VEC_LENF; i++) {
+				st->qla[i] *= F_ALPHAQ;
+				if (gamaK[i] < F_GAMMAQ_THR)
+					st->qla[i] += F_BETAQ;
+				st->qk[i] = st->qla[i];
+				if (st->qk[i] > F_QK_MAX)
+					st->qk[i] = F_QK_MAX;
+				else if (st->qk[i] < F_QK_MIN)
+					st->qk[i] = F_QK_MIN;
+			}
+		}
+
+		gain_log_mmse(st, gamaK);
+		gain_mod(st, GainD);
+
+		for (i = 0; i < ENH_VEC_LENF; i++)
+			st->agal[i] = GainD[i] * Ymag[i];
+	}
+
+	/* enhanced signal, back to the time domain */
+	for (i = 0; i < ENH_VEC_LENF; i++) {
+		st->Y[i].r *= GainD[i] / ENH_WINLEN;
+		st->Y[i].i *= GainD[i] / ENH_WINLEN;
+	}
+	kiss_fftri(st->inv, st->Y, out);
+	for (i = 0; i < ENH_WINLEN; i++)
+		out[i] *= st->win[i];
+
+	st->n_pwr = spect_av(st->lambdaD);
+}
+
+//create a floating point noise preprocessor, 0 on failure
+struct melpe_nppf *melpe_nppf_init(void)
+{
+	struct melpe_nppf *st;
+
+	st = calloc(1, sizeof(struct melpe_nppf));
+	if (!st)
+		return 0;
+	st->fwd = kiss_fftr_alloc(ENH_WINLEN, 0, NULL, NULL);
+	st->inv = kiss_fftr_alloc(ENH_WINLEN, 1, NULL, NULL);
+	if (!st->fwd || !st->inv) {
+		melpe_nppf_exit(st);
+		return 0;
+	}
+	return st;
+}
+
+void melpe_nppf_exit(struct melpe_nppf *st)
+{
+	if (!st)
+		return;
+	if (st->fwd)
+		kiss_fftr_free(st->fwd);
+	if (st->inv)
+		kiss_fftr_free(st->inv);
+	free(st);
+}
+
+//denoise n samples sp->sp: 128 to 240 samples per frame, a new frame size
+//restarts the preprocessor, other sizes are left untouched
+void melpe_nf(struct melpe_nppf *st, short *sp, int n)
+{
+	int i, ovl;
+	float out[ENH_WINLEN], t;
+
+	if ((n < NPPF_MIN_SHIFT) || (n > NPPF_MAX_SHIFT))
+		return;
+	ovl = ENH_WINLEN - n;
+
+	if (n != st->shift) {
+		/* sqrt Tukey window: tapers of ovl samples, squared sum 1 */
+		for (i = 0; i < ENH_WINLEN; i++)
+			st->win[i] = 1.0f;
+		for (i = 0; i < ovl; i++) {
+			t = sinf((float)PI / 2 * (i + 1) / ovl);
+			st->win[i] = t;
+			st->win[ENH_WINLEN - 2 - i] = t;
+		}
+		st->win[ENH_WINLEN - 1] = 0.0f;
+
+		/* look ahead noise: the first frame behind silence */
+		memset(st->speech_in, 0, sizeof(st->speech_in));
+		memset(st->overlap, 0, sizeof(st->overlap));
+		for (i = 0; i < n; i++)
+			st->speech_in[ovl + i] = sp[i];
+		nppf_enh_init(st);
+		memset(st->speech_in, 0, sizeof(st->speech_in));
+		st->shift = n;
+	}
+
+	/* shift input buffer from the previous frame */
+	memmove(st->speech_in, &st->speech_in[n], ovl * sizeof(float));
+	for (i = 0; i < n; i++)
+		st->speech_in[ovl + i] = sp[i];
+
+	process_frame(st, out);
+
+	/* overlap-add and output */
+	for (i = 0; i < ovl; i++)
+		out[i] += st->overlap[i];
+	memcpy(st->overlap, &out[n], ovl * sizeof(float));
+	for (i = 0; i < n; i++) {
+		t = out[i];
+		sp[i] = t > 32767.0f ? 32767 : t < -32768.0f ? -32768 :
+		    (short)lrintf(t);
+	}
+}
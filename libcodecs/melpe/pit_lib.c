@@ -43,6 +43,7 @@ Secretariat fax: +33 493 65 47 16.
 #include "constant.h"
 #include "global.h"
 #include "coeff.h"
+#include "state.h"
 
 #define PDECAY_Q15			31129	/* 0.95 * (1 << 15) */
 #define PDECAY_PITCH_Q7 	320	/* (0.05*DEFAULT_PITCH) * (1 << 7) */
@@ -512,36 +513,30 @@ int16_t frac_pch(int16_t sig_in[], int16_t * pcorr, int16_t fpitch,
 /*                                                                            */
 /* Copyright (c) 1995 by Texas Instruments, Inc.  All rights reserved.        */
 
-int16_t p_avg_update(int16_t pitch, int16_t pcorr, int16_t pthresh)
+int16_t p_avg_update(struct melpe_enc *st, int16_t pitch, int16_t pcorr,
+		     int16_t pthresh)
 {
 	register int16_t i;
-	static int16_t good_pitch[NF];
-	static BOOLEAN firstTime = TRUE;
 	int16_t pitch_avg, temp;
 
-	if (firstTime) {
-		fill(good_pitch, DEFAULT_PITCH_Q7, NF);
-		firstTime = FALSE;
-	}
-
 	/* Strong correlation: update good pitch array */
 	if (pcorr > pthresh) {
 		/* We used to insert pitch to good_pitch[0] and shift everything up.  */
 		/* Now we insert at good_pitch[NF - 1] and shift everything down.     */
 
-		v_equ(good_pitch, &(good_pitch[1]), NF - 1);
-		good_pitch[NF - 1] = pitch;
+		v_equ(st->good_pitch, &(st->good_pitch[1]), NF - 1);
+		st->good_pitch[NF - 1] = pitch;
 	} else {		/* Otherwise decay good pitch array to default value */
 		for (i = 0; i < NF; i++) {
 			/*      good_pitch[i] =
 			   (PDECAY*good_pitch[i]) +((1.0-PDECAY)*DEFAULT_PITCH); */
-			temp = melpe_mult(PDECAY_Q15, good_pitch[i]);
-			good_pitch[i] = melpe_add(temp, PDECAY_PITCH_Q7);
+			temp = melpe_mult(PDECAY_Q15, st->good_pitch[i]);
+			st->good_pitch[i] = melpe_add(temp, PDECAY_PITCH_Q7);
 		}
 	}
 
 	/* Pitch_avg = median of pitch values */
-	pitch_avg = median3(good_pitch);
+	pitch_avg = median3(st->good_pitch);
 
 	return (pitch_avg);
 }
@@ -568,71 +563,61 @@ int16_t p_avg_update(int16_t pitch, int16_t pcorr, int16_t pthresh)
 /* Q values                                                                   */
 /*      speech - Q0, resid - Q0, pitch_est - Q7, pitch_avg - Q7, pcorr2 - Q14 */
 
-int16_t pitch_ana(int16_t speech[], int16_t resid[],
+int16_t pitch_ana(struct melpe_enc *st, int16_t speech[], int16_t resid[],
 		    int16_t pitch_est, int16_t pitch_avg,
 		    int16_t * pcorr2)
 {
 	register int16_t i, section;
-	static int16_t lpres_delin[LPF_ORD];
-	static int16_t lpres_delout[LPF_ORD];
-	static int16_t sigbuf[LPF_ORD + PITCH_FR];
-	static BOOLEAN firstTime = TRUE;
 	int16_t pcorr, pitch;
 	int16_t temp, temp2;
 	int16_t temp_delin[LPF_ORD], temp_delout[LPF_ORD];
 
-	if (firstTime) {
-		v_zap(lpres_delin, LPF_ORD);
-		v_zap(lpres_delout, LPF_ORD);
-		firstTime = FALSE;
-	}
-
 	/* Lowpass filter residual signal */
-	v_equ(&sigbuf[LPF_ORD_SOS], &resid[-PITCHMAX], PITCH_FR);
+	v_equ(&st->pit_sigbuf[LPF_ORD_SOS], &resid[-PITCHMAX], PITCH_FR);
 
 	for (section = 0; section < LPF_ORD / 2; section++) {
-		iir_2nd_s(&sigbuf[LPF_ORD_SOS], &lpf_den[section * 3],
-			  &lpf_num[section * 3], &sigbuf[LPF_ORD_SOS],
-			  &lpres_delin[section * 2], &lpres_delout[section * 2],
+		iir_2nd_s(&st->pit_sigbuf[LPF_ORD_SOS], &lpf_den[section * 3],
+			  &lpf_num[section * 3], &st->pit_sigbuf[LPF_ORD_SOS],
+			  &st->lpres_delin[section * 2], &st->lpres_delout[section * 2],
 			  FRAME);
 		/* save delay buffers for the next overlapping frame */
 		for (i = (int16_t) (section * 2);
 		     i < (int16_t) (section * 2 + 2); i++) {
-			temp_delin[i] = lpres_delin[i];
-			temp_delout[i] = lpres_delout[i];
+			temp_delin[i] = st->lpres_delin[i];
+			temp_delout[i] = st->lpres_delout[i];
 		}
-		iir_2nd_s(&sigbuf[LPF_ORD_SOS + FRAME], &lpf_den[section * 3],
-			  &lpf_num[section * 3], &sigbuf[LPF_ORD_SOS + FRAME],
-			  &lpres_delin[section * 2], &lpres_delout[section * 2],
+		iir_2nd_s(&st->pit_sigbuf[LPF_ORD_SOS + FRAME], &lpf_den[section * 3],
+			  &lpf_num[section * 3], &st->pit_sigbuf[LPF_ORD_SOS + FRAME],
+			  &st->lpres_delin[section * 2], &st->lpres_delout[section * 2],
 			  PITCH_FR - FRAME);
 		/* restore delay buffers for the next overlapping frame */
 		for (i = (int16_t) (section * 2);
 		     i < (int16_t) (section * 2 + 2); i++) {
-			lpres_delin[i] = temp_delin[i];
-			lpres_delout[i] = temp_delout[i];
+			st->lpres_delin[i] = temp_delin[i];
+			st->lpres_delout[i] = temp_delout[i];
 		}
 	}
 
 	/* Scale lowpass residual for pitch correlations */
-	f_pitch_scale(&sigbuf[LPF_ORD_SOS], &sigbuf[LPF_ORD_SOS], PITCH_FR);
+	f_pitch_scale(&st->pit_sigbuf[LPF_ORD_SOS], &st->pit_sigbuf[LPF_ORD_SOS], PITCH_FR);
 
 	/* Perform local search ar_ound pitch estimate */
 	temp =
-	    frac_pch(&sigbuf[LPF_ORD_SOS + (PITCH_FR / 2)], &pcorr, pitch_est,
+	    frac_pch(&st->pit_sigbuf[LPF_ORD_SOS + (PITCH_FR / 2)], &pcorr, pitch_est,
 		     5, PITCHMIN, PITCHMAX, PITCHMIN_Q7, PITCHMAX_Q7,
 		     MINLENGTH);
 
 	if (pcorr < PCORR_THR) {
 
 		/* If correlation is too low, try speech signal instead */
-		v_equ(&sigbuf[LPF_ORD], &speech[-PITCHMAX], PITCH_FR);
+		v_equ(&st->pit_sigbuf[LPF_ORD], &speech[-PITCHMAX], PITCH_FR);
 
 		/* Scale speech for pitch correlations */
-		f_pitch_scale(&sigbuf[LPF_ORD_SOS], &sigbuf[LPF_ORD_SOS],
+		f_pitch_scale(&st->pit_sigbuf[LPF_ORD_SOS], &st->pit_sigbuf[LPF_ORD_SOS],
 			      PITCH_FR);
 
 		temp =
-		    frac_pch(&sigbuf[LPF_ORD + (PITCH_FR / 2)], &pcorr,
+		    frac_pch(&st->pit_sigbuf[LPF_ORD + (PITCH_FR / 2)], &pcorr,
 			     pitch_est, 0, PITCHMIN, PITCHMAX, PITCHMIN_Q7,
 			     PITCHMAX_Q7, MINLENGTH);
 
@@ -647,7 +632,7 @@ int16_t pitch_ana(int16_t speech[], int16_t resid[],
 			else
 				temp2 = PDOUBLE3;
 			pitch =
-			    double_chk(&sigbuf[LPF_ORD + (PITCH_FR / 2)],
+			    double_chk(&st->pit_sigbuf[LPF_ORD + (PITCH_FR / 2)],
 				       &pcorr, temp, temp2, PITCHMIN, PITCHMAX,
 				       PITCHMIN_Q7, PITCHMAX_Q7, MINLENGTH);
 		}
@@ -660,7 +645,7 @@ int16_t pitch_ana(int16_t speech[], int16_t resid[],
 			temp2 = PDOUBLE2;
 		else
 			temp2 = PDOUBLE1;
-		pitch = double_chk(&sigbuf[LPF_ORD + (PITCH_FR / 2)], &pcorr,
+		pitch = double_chk(&st->pit_sigbuf[LPF_ORD + (PITCH_FR / 2)], &pcorr,
 				   temp, temp2, PITCHMIN, PITCHMAX, PITCHMIN_Q7,
 				   PITCHMAX_Q7, MINLENGTH);
 	}
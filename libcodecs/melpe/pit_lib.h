@@ -46,9 +46,10 @@ int16_t frac_pch(int16_t sig_in[], int16_t * pcorr, int16_t fpitch,
 		   int16_t range, int16_t pmin, int16_t pmax,
 		   int16_t pmin_q7, int16_t pmax_q7, int16_t lmin);
 
-int16_t p_avg_update(int16_t pitch, int16_t pcorr, int16_t pthresh);
+int16_t p_avg_update(struct melpe_enc *st, int16_t pitch, int16_t pcorr,
+		     int16_t pthresh);
 
-int16_t pitch_ana(int16_t speech[], int16_t resid[],
+int16_t pitch_ana(struct melpe_enc *st, int16_t speech[], int16_t resid[],
 		    int16_t pitch_est, int16_t pitch_avg,
 		    int16_t * pcorr2);
 
@@ -29,6 +29,7 @@
 #include "constant.h"
 #include "dsp_sub.h"
 #include "melp_sub.h"
+#include "state.h"
 
 #define PIT_WIN			(PIT_COR_LEN - MAXPITCH)
 #define PIT_WEIGHT		200	/* 100 * (1 << 1) */
@@ -60,18 +61,9 @@ static void corPeak(int16_t inbuf[], pitTrackParam * pitTrack,
 ** Return value:	None
 **
 *****************************************************************************/
-void pitchAuto(int16_t inbuf[], pitTrackParam * pitTrack,
+void pitchAuto(struct melpe_enc *st, int16_t inbuf[], pitTrackParam * pitTrack,
 	       classParam * classStat)
 {
-	static BOOLEAN firstTime = TRUE;
-	static int16_t lpbuf[PIT_COR_LEN];	/* low pass filter buffer, Q0 */
-	static int16_t ivbuf[PIT_COR_LEN];	/* inverse filter buffer, Q12 */
-
-	if (firstTime) {	/* initialize the buffers */
-		v_zap(lpbuf, PIT_COR_LEN);
-		v_zap(ivbuf, PIT_COR_LEN);
-		firstTime = FALSE;
-	}
 
 	/* The input inbuf[] is not modified in pitchAuto() and the functions     */
 	/* pitchAuto() directly or indirectly calls.  On the other hand, an       */
@@ -82,13 +74,13 @@ void pitchAuto(int16_t inbuf[], pitTrackParam * pitTrack,
 	/* ivbuf[] any way we want.                                               */
 
 	/* ------ 800Hz low pass filter ------ */
-	lpfilt(inbuf, lpbuf, PIT_SUBFRAME);
+	lpfilt(inbuf, st->lpbuf, PIT_SUBFRAME);
 
 	/* ------ Two order inverse filter ------- */
-	ivfilt(ivbuf, lpbuf, PIT_SUBFRAME);
+	ivfilt(st->ivbuf, st->lpbuf, PIT_SUBFRAME);
 
 	/* ------ Calculate the autocorrelation function ------- */
-	corPeak(ivbuf, pitTrack, classStat);
+	corPeak(st->ivbuf, pitTrack, classStat);
 }
 
 /*============================================================*
@@ -21,7 +21,7 @@
 #ifndef _PITCH_H_
 #define _PITCH_H_
 
-void pitchAuto(int16_t inbuf[], pitTrackParam * pitTrack,
+void pitchAuto(struct melpe_enc *st, int16_t inbuf[], pitTrackParam * pitTrack,
 	       classParam * classStat);
 
 int16_t multiCheck(int16_t f1, int16_t f2);
@@ -30,17 +30,17 @@
 #include "math_lib.h"
 #include "lpc_lib.h"
 #include "mathhalf.h"
+#include "state.h"
 
 /* ---- Postfilter ---- */
 #define ALPH			18678	/* 0.57, Q15 */
 #define BETA			24576	/* 0.75, Q15 */
 
-#define SMOOTH_LEN		20
 #define X05_Q12			2048
 
 /* ===== Prototypes ===== */
-static void hpf60(int16_t speech[]);
-static void lpf3500(int16_t speech[]);
+static void hpf60(struct melpe_dec *st, int16_t speech[]);
+static void lpf3500(struct melpe_dec *st, int16_t speech[]);
 
 /****************************************************************
 **
@@ -57,20 +57,18 @@ static void lpf3500(int16_t speech[]);
 **
 *****************************************************************/
 
-void postfilt(int16_t speech[], int16_t prev_lsf[], int16_t cur_lsf[])
+void postfilt(struct melpe_dec *st, int16_t speech[], int16_t prev_lsf[],
+	      int16_t cur_lsf[])
 {
 	register int16_t i, j, k;
 	static const int16_t syn_inp[SYN_SUBNUM] = {	/* Q15 */
 		4096, 12288, 20480, 28672
 	};
-	static BOOLEAN postfilt_firsttime = TRUE;
-	static int16_t hpm = 0;	/* Q0 */
-	static int16_t mem1[LPC_ORD] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-	static int16_t mem2[LPC_ORD] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-	static int16_t gain = 0;	/* Q14 */
-	static int16_t alphaipFIR[LPC_ORD];	/* Q12 */
-	static int16_t alphaipIIR[LPC_ORD];
-	static int16_t window[SMOOTH_LEN];	/* Q15 */
+	static const int16_t window[SMOOTH_LEN] = {	/* Q15 */
+		0, 1638, 3276, 4914, 6552, 8190, 9828, 11466, 13104, 14742,
+		16380, 18018, 19656, 21294, 22932, 24570, 26208, 27846, 29484,
+		31122
+	};	/* smoothing window, i/SMOOTH_LEN */
 	int16_t temp, temp_shift;
 	int16_t temp1, temp2;
 	int32_t L_temp;
@@ -90,16 +88,6 @@ void postfilt(int16_t speech[], int16_t prev_lsf[], int16_t cur_lsf[])
 	int16_t sp, sp_shift;
 	int16_t op, op_shift;
 
-	if (postfilt_firsttime) {
-		/* ======== Compute smoothing window ======== */
-		temp = 0;	/* Q15 */
-		for (i = 0; i < SMOOTH_LEN; i++) {
-			window[i] = temp;
-			temp = melpe_add(temp, 1638);	/* 1638 is 1/SMOOTH_LEN in Q15 */
-		}
-		postfilt_firsttime = FALSE;
-	}
-
 	/* Computing sp, the sum of squares of speech[].  We would treat speech[] */
 	/* as if it is Q15, and we will do the same thing when computing op.      */
 
@@ -149,9 +137,9 @@ void postfilt(int16_t speech[], int16_t prev_lsf[], int16_t cur_lsf[])
 		/* which should not be frequent.                                      */
 
 		for (j = 0; j < SYN_SUBFRAME; j++) {
-			temp = melpe_mult(emph, hpm);	/* Q0 */
-			hpm = speech[i * SYN_SUBFRAME + j];
-			synhp[j] = melpe_sub(hpm, temp);	/* Q0 */
+			temp = melpe_mult(emph, st->hpm);	/* Q0 */
+			st->hpm = speech[i * SYN_SUBFRAME + j];
+			synhp[j] = melpe_sub(st->hpm, temp);	/* Q0 */
 		}
 
 		/* ------ Short-term postfilter ------ */
@@ -161,13 +149,13 @@ void postfilt(int16_t speech[], int16_t prev_lsf[], int16_t cur_lsf[])
 		/* 0.                                                                 */
 
 		if (i == 0) {
-			v_equ(mem1old, mem1, LPC_ORD);
-			v_equ(mem2old, mem2, LPC_ORD);
+			v_equ(mem1old, st->mem1, LPC_ORD);
+			v_equ(mem2old, st->mem2, LPC_ORD);
 
 			for (j = 0; j < SMOOTH_LEN; j++) {
 				L_sum = 0;
 				for (k = 0; k < LPC_ORD; k++) {
-					L_temp = melpe_L_mult(mem1old[k], alphaipFIR[k]);	/* Q13 */
+					L_temp = melpe_L_mult(mem1old[k], st->alphaipFIR[k]);	/* Q13 */
 					L_sum = melpe_L_add(L_sum, L_temp);	/* Q13 */
 				}
 				for (k = LPC_ORD - 1; k > 0; k--)
@@ -177,7 +165,7 @@ void postfilt(int16_t speech[], int16_t prev_lsf[], int16_t cur_lsf[])
 				L_sum = melpe_L_add(L_sum, L_temp);
 
 				for (k = 0; k < LPC_ORD; k++) {
-					L_temp = melpe_L_mult(mem2old[k], alphaipIIR[k]);	/* Q13 */
+					L_temp = melpe_L_mult(mem2old[k], st->alphaipIIR[k]);	/* Q13 */
 					L_sum = melpe_L_sub(L_sum, L_temp);
 				}
 				for (k = LPC_ORD - 1; k > 0; k--)
@@ -192,7 +180,7 @@ void postfilt(int16_t speech[], int16_t prev_lsf[], int16_t cur_lsf[])
 				/* appropriate.                                               */
 
 				temp1 = melpe_mult(temp, temp1);	/* Q0 */
-				L_temp = melpe_L_mult(gain, temp1);	/* Q15 */
+				L_temp = melpe_L_mult(st->gain, temp1);	/* Q15 */
 				nokori[j] = melpe_extract_l(melpe_L_shr(L_temp, 15));	/* Q0 */
 			}
 		}
@@ -200,8 +188,8 @@ void postfilt(int16_t speech[], int16_t prev_lsf[], int16_t cur_lsf[])
 		temp1 = ALPH;	/* Q15 */
 		temp2 = BETA;
 		for (j = 0; j < LPC_ORD; j++) {
-			alphaipFIR[j] = melpe_mult(synLPC[j], temp1);	/* Q12 */
-			alphaipIIR[j] = melpe_mult(synLPC[j], temp2);
+			st->alphaipFIR[j] = melpe_mult(synLPC[j], temp1);	/* Q12 */
+			st->alphaipIIR[j] = melpe_mult(synLPC[j], temp2);
 			temp1 = melpe_mult(ALPH, temp1);
 			temp2 = melpe_mult(BETA, temp2);
 		}
@@ -209,23 +197,23 @@ void postfilt(int16_t speech[], int16_t prev_lsf[], int16_t cur_lsf[])
 		for (j = 0; j < SYN_SUBFRAME; j++) {
 			L_sum = 0;
 			for (k = 0; k < LPC_ORD; k++) {
-				L_temp = melpe_L_mult(mem1[k], alphaipFIR[k]);	/* Q13 */
+				L_temp = melpe_L_mult(st->mem1[k], st->alphaipFIR[k]);	/* Q13 */
 				L_sum = melpe_L_add(L_sum, L_temp);	/* Q13 */
 			}
 			for (k = LPC_ORD - 1; k > 0; k--)
-				mem1[k] = mem1[k - 1];
-			mem1[0] = synhp[j];
+				st->mem1[k] = st->mem1[k - 1];
+			st->mem1[0] = synhp[j];
 			L_temp = melpe_L_shl(melpe_L_deposit_l(synhp[j]), 13);	/* Q13 */
 			L_sum = melpe_L_add(L_sum, L_temp);
 
 			for (k = 0; k < LPC_ORD; k++) {
-				L_temp = melpe_L_mult(mem2[k], alphaipIIR[k]);	/* Q13 */
+				L_temp = melpe_L_mult(st->mem2[k], st->alphaipIIR[k]);	/* Q13 */
 				L_sum = melpe_L_sub(L_sum, L_temp);	/* Q13 */
 			}
 			for (k = LPC_ORD - 1; k > 0; k--)
-				mem2[k] = mem2[k - 1];
+				st->mem2[k] = st->mem2[k - 1];
 			L_sum = melpe_L_shr(L_sum, 13);	/* Q0 */
-			mem2[0] = melpe_extract_l(L_sum);	/* Q0 */
+			st->mem2[0] = melpe_extract_l(L_sum);	/* Q0 */
 			speech[i * SYN_SUBFRAME + j] = melpe_extract_l(L_sum);	/* Q0 */
 		}
 	}
@@ -289,12 +277,12 @@ void postfilt(int16_t speech[], int16_t prev_lsf[], int16_t cur_lsf[])
 		/* larger energy than the processed one.  If we want to make the code */
 		/* "bullet-proof", we can saturate gain computed below.               */
 
-		gain = melpe_shl(temp, temp_shift);	/* Q14 */
+		st->gain = melpe_shl(temp, temp_shift);	/* Q14 */
 	} else
-		gain = 0;
+		st->gain = 0;
 
 	for (i = 0; i < FRAME; i++) {
-		L_temp = melpe_L_mult(gain, speech[i]);	/* Q15 */
+		L_temp = melpe_L_mult(st->gain, speech[i]);	/* Q15 */
 		speech[i] = melpe_extract_l(melpe_L_shr(L_temp, 15));	/* Q0 */
 	}
 
@@ -325,8 +313,8 @@ void postfilt(int16_t speech[], int16_t prev_lsf[], int16_t cur_lsf[])
 	/*     before we feed the signal into the filters.  This tends to reduce  */
 	/*     the likelihood of saturation.                                      */
 
-	lpf3500(speech);
-	hpf60(speech);
+	lpf3500(st, speech);
+	hpf60(st, speech);
 }
 
 /* The filter hpf60() can be rewritten as                                     */
@@ -339,7 +327,7 @@ void postfilt(int16_t speech[], int16_t prev_lsf[], int16_t cur_lsf[])
 /*      = ---------------------------------------- * 0.9672                   */
 /*          (1.0 - 1.9334 z^{-1} + 0.9355 z^{-2})                             */
 
-static void hpf60(int16_t speech[])
+static void hpf60(struct melpe_dec *st, int16_t speech[])
 {
 	static const int16_t hpf60_num[3] = {	/* Q13 */
 		8192, -16384, 8192
@@ -347,12 +335,9 @@ static void hpf60(int16_t speech[])
 	static const int16_t hpf60_den[3] = {	/* Negated; Q13 */
 		-8192, 15838, -7664
 	};
-	static int16_t hpf60_delin[2] = { 0, 0 };	/* Q13 */
-	static int16_t hpf60_delout_hi[2] = { 0, 0 };
-	static int16_t hpf60_delout_lo[2] = { 0, 0 };
 
-	iir_2nd_d(speech, hpf60_den, hpf60_num, speech, hpf60_delin,
-		  hpf60_delout_hi, hpf60_delout_lo, FRAME);
+	iir_2nd_d(speech, hpf60_den, hpf60_num, speech, st->hpf60_delin,
+		  st->hpf60_delout_hi, st->hpf60_delout_lo, FRAME);
 }
 
 /* Refer to the comment for hpf60(), this filter can be rewritten as          */
@@ -365,7 +350,7 @@ static void hpf60(int16_t speech[])
 /*      = ---------------------------------------- * 0.9178                   */
 /*          (1.0 + 1.8307 z^{-1} + 0.8446 z^{-2})                             */
 
-static void lpf3500(int16_t speech[])
+static void lpf3500(struct melpe_dec *st, int16_t speech[])
 {
 	static const int16_t lpf3500_num[3] = {	/* Q13 */
 		8192, 16384, 8192
@@ -373,10 +358,7 @@ static void lpf3500(int16_t speech[])
 	static const int16_t lpf3500_den[3] = {	/* Negated; Q13 */
 		-8192, -14997, -6919
 	};
-	static int16_t lpf3500_delin[2] = { 0, 0 };	/* Q13 */
-	static int16_t lpf3500_delout_hi[2] = { 0, 0 };
-	static int16_t lpf3500_delout_lo[2] = { 0, 0 };
 
-	iir_2nd_d(speech, lpf3500_den, lpf3500_num, speech, lpf3500_delin,
-		  lpf3500_delout_hi, lpf3500_delout_lo, FRAME);
+	iir_2nd_d(speech, lpf3500_den, lpf3500_num, speech, st->lpf3500_delin,
+		  st->lpf3500_delout_hi, st->lpf3500_delout_lo, FRAME);
 }
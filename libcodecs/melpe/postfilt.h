@@ -22,6 +22,7 @@
 #define _POSTFILT_H_
 
 /* ========== Prototypes ========== */
-void postfilt(int16_t syn[], int16_t prev_lsf[], int16_t cur_lsf[]);
+void postfilt(struct melpe_dec *st, int16_t syn[], int16_t prev_lsf[],
+	      int16_t cur_lsf[]);
 
 #endif
@@ -33,6 +33,7 @@
 #include "fsvq_cb.h"
 #include "dsp_sub.h"
 #include "melp_sub.h"
+#include "state.h"
 
 #define	LSP_INP_CAND		5
 #define NF_X_NUM_GAINFR		(NF * NUM_GAINFR)
@@ -72,12 +73,9 @@ static void lspVQ(int16_t target[], int16_t weight[], int16_t qout[],
 ** Return value:	None
 **
 *****************************************************************************/
-void pitch_vq(struct melp_param *par)
+void pitch_vq(struct melpe_enc *st, struct melp_param *par)
 {
 	register int16_t i;
-	static BOOLEAN prev_uv_flag = TRUE;
-	static int16_t prev_pitch = LOG_UV_PITCH_Q12;	/* Q12 */
-	static int16_t prev_qpitch = LOG_UV_PITCH_Q12;	/* Q12 */
 	const int16_t *codebook;
 	int16_t cnt, size, pitch_index;
 	int16_t temp1, temp2;
@@ -105,31 +103,31 @@ void pitch_vq(struct melp_param *par)
 
 	/* ---- calculate delta ---- */
 	for (i = 0; i < NF; i++) {
-		if (prev_uv_flag || par[i].uv_flag) {
+		if (st->prev_uv_flag || par[i].uv_flag) {
 			deltp[i] = 0;
 			deltw[i] = 0;
 		} else {
-			deltp[i] = melpe_sub(target[i], prev_pitch);
+			deltp[i] = melpe_sub(target[i], st->vq_prev_pitch);
 			deltw[i] = DELTA_PITCH_WEIGHT_Q0;
 		}
-		prev_pitch = target[i];
-		prev_uv_flag = par[i].uv_flag;
+		st->vq_prev_pitch = target[i];
+		st->prev_uv_flag = par[i].uv_flag;
 	}
 
 	if (cnt == 0) {
 
 		for (i = 0; i < NF; i++)
 			par[i].pitch = UV_PITCH;
-		prev_qpitch = LOG_UV_PITCH_Q12;
+		st->vq_prev_qpitch = LOG_UV_PITCH_Q12;
 
 	} else if (cnt == 1) {
 
 		for (i = 0; i < NF; i++) {
 			if (!par[i].uv_flag) {
-				quant_u(&target[i], &(quant_par.pitch_index),
+				quant_u(&target[i], &(st->quant_par.pitch_index),
 					PIT_QLO_Q12, PIT_QUP_Q12, PIT_QLEV_M1,
 					PIT_QLEV_M1_Q8, TRUE, 7);
-				quant_u_dec(quant_par.pitch_index,
+				quant_u_dec(st->quant_par.pitch_index,
 					    &par[i].pitch, PIT_QLO_Q12,
 					    PIT_QUP_Q12, PIT_QLEV_M1_Q8, 7);
 			} else
@@ -139,7 +137,7 @@ void pitch_vq(struct melp_param *par)
 		/* At this point par[].pitch temporarily holds the pitches in the     */
 		/* log domain with Q12.                                               */
 
-		prev_qpitch = par[NF - 1].pitch;	/* Q12 */
+		st->vq_prev_qpitch = par[NF - 1].pitch;	/* Q12 */
 
 		for (i = 0; i < NF; i++)
 			par[i].pitch = pow10_fxp(par[i].pitch, 7);	/* Q7 */
@@ -167,7 +165,7 @@ void pitch_vq(struct melp_param *par)
 
 			/* Now temp1 is (i*NF) and temp2 is (indexlist[i]*NF).            */
 
-			dcb[temp1] = melpe_sub(codebook[temp2], prev_qpitch);	/* Q12 */
+			dcb[temp1] = melpe_sub(codebook[temp2], st->vq_prev_qpitch);	/* Q12 */
 			v_equ(&dcb[temp1 + 1], &codebook[temp2 + 1], NF - 1);
 			v_sub(&dcb[temp1 + 1], &codebook[temp2], NF - 1);
 			temp1 = melpe_add(temp1, NF);
@@ -177,9 +175,9 @@ void pitch_vq(struct melp_param *par)
 				   PITCH_VQ_CAND);
 
 		if (par[NF - 1].uv_flag)
-			prev_qpitch = LOG_UV_PITCH_Q12;
+			st->vq_prev_qpitch = LOG_UV_PITCH_Q12;
 		else
-			prev_qpitch = codebook[pitch_index * NF + NF - 1];	/* Q12 */
+			st->vq_prev_qpitch = codebook[pitch_index * NF + NF - 1];	/* Q12 */
 
 		for (i = 0; i < NF; i++) {
 			if (par[i].uv_flag)
@@ -190,7 +188,7 @@ void pitch_vq(struct melp_param *par)
 					      7);
 		}
 
-		quant_par.pitch_index = pitch_index;
+		st->quant_par.pitch_index = pitch_index;
 	}
 }
 
@@ -365,7 +363,7 @@ static int16_t wvq2(int16_t target[], int16_t weights[],
 ** Return value:	None
 **
 *****************************************************************************/
-void gain_vq(struct melp_param *par)
+void gain_vq(struct melpe_enc *st, struct melp_param *par)
 {
 	register int16_t i, j;
 	int16_t index;
@@ -427,7 +425,7 @@ void gain_vq(struct melp_param *par)
 		temp2 = melpe_add(temp2, NUM_GAINFR);
 	}
 
-	quant_par.gain_index[0] = index;
+	st->quant_par.gain_index[0] = index;
 }
 
 /****************************************************************************
@@ -444,14 +442,14 @@ void gain_vq(struct melp_param *par)
 **
 *****************************************************************************/
 
-void quant_bp(struct melp_param *par, int16_t num_frames)
+void quant_bp(struct melpe_enc *st, struct melp_param *par, int16_t num_frames)
 {
 	register int16_t i;
 
 	for (i = 0; i < num_frames; i++) {
-		par[i].uv_flag = q_bpvc(par[i].bpvc, &(quant_par.bpvc_index[i]),
+		par[i].uv_flag = q_bpvc(par[i].bpvc, &(st->quant_par.bpvc_index[i]),
 					NUM_BANDS);
-		quant_par.bpvc_index[i] = bp_index_map[quant_par.bpvc_index[i]];
+		st->quant_par.bpvc_index[i] = bp_index_map[st->quant_par.bpvc_index[i]];
 	}
 }
 
@@ -892,11 +890,9 @@ void lspSort(int16_t lsp[], int16_t order)
 **
 *****************************************************************************/
 
-void lsf_vq(struct melp_param *par)
+void lsf_vq(struct melpe_enc *st, struct melp_param *par)
 {
 	register int16_t i, j, k;
-	static BOOLEAN firstTime = TRUE;
-	static int16_t qplsp[LPC_ORD];	/* Q15 */
 	const int16_t melp_cb_size[4] = { 256, 64, 32, 32 };	/* !!! (12/15/99) */
 	const int16_t res_cb_size[4] = { 256, 64, 64, 64 };
 	const int16_t melp_uv_cb_size[1] = { 512 };
@@ -920,17 +916,6 @@ void lsf_vq(struct melp_param *par)
 	int16_t ilsp0[LPC_ORD], ilsp1[LPC_ORD];	/* Q15 */
 	int16_t cand, inp_index_cand, tos, intfact;
 
-	if (firstTime) {
-		temp2 = melpe_shl(LPC_ORD, 10);	/* Q10 */
-		temp1 = X08_Q10;	/* Q10 */
-		for (i = 0; i < LPC_ORD; i++) {
-			/*      qplsp[i] = (i+1)*0.8/LPC_ORD; */
-			qplsp[i] = melpe_divide_s(temp1, temp2);
-			temp1 = melpe_add(temp1, X08_Q10);
-		}
-		firstTime = FALSE;
-	}
-
 	/* ==== Compute weights ==== */
 	for (i = 0; i < NF; i++) {
 		lsp[i] = par[i].lsf;
@@ -956,35 +941,35 @@ void lsf_vq(struct melp_param *par)
 	switch (uv_config) {
 	case 7:		/* 111, all frames are NOT voiced ---- */
 		lspVQ(lsp[0], wgt[0], lsp[0], lsp_uv_9, 1, melp_uv_cb_size,
-		      quant_par.lsf_index[0], LPC_ORD, FALSE);
+		      st->quant_par.lsf_index[0], LPC_ORD, FALSE);
 		lspVQ(lsp[1], wgt[1], lsp[1], lsp_uv_9, 1, melp_uv_cb_size,
-		      quant_par.lsf_index[1], LPC_ORD, FALSE);
+		      st->quant_par.lsf_index[1], LPC_ORD, FALSE);
 		lspVQ(lsp[2], wgt[2], lsp[2], lsp_uv_9, 1, melp_uv_cb_size,
-		      quant_par.lsf_index[2], LPC_ORD, FALSE);
+		      st->quant_par.lsf_index[2], LPC_ORD, FALSE);
 		break;
 	case 6:		/* 110 */
 		lspVQ(lsp[0], wgt[0], lsp[0], lsp_uv_9, 1, melp_uv_cb_size,
-		      quant_par.lsf_index[0], LPC_ORD, FALSE);
+		      st->quant_par.lsf_index[0], LPC_ORD, FALSE);
 		lspVQ(lsp[1], wgt[1], lsp[1], lsp_uv_9, 1, melp_uv_cb_size,
-		      quant_par.lsf_index[1], LPC_ORD, FALSE);
+		      st->quant_par.lsf_index[1], LPC_ORD, FALSE);
 		lspVQ(lsp[2], wgt[2], lsp[2], lsp_v_256x64x32x32, 4, melp_cb_size,	/* !!! (12/15/99) */
-		      quant_par.lsf_index[2], LPC_ORD, FALSE);
+		      st->quant_par.lsf_index[2], LPC_ORD, FALSE);
 		break;
 	case 5:		/* 101 */
 		lspVQ(lsp[0], wgt[0], lsp[0], lsp_uv_9, 1, melp_uv_cb_size,
-		      quant_par.lsf_index[0], LPC_ORD, FALSE);
+		      st->quant_par.lsf_index[0], LPC_ORD, FALSE);
 		lspVQ(lsp[1], wgt[1], lsp[1], lsp_v_256x64x32x32, 4, melp_cb_size,	/* !!! (12/15/99) */
-		      quant_par.lsf_index[1], LPC_ORD, FALSE);
+		      st->quant_par.lsf_index[1], LPC_ORD, FALSE);
 		lspVQ(lsp[2], wgt[2], lsp[2], lsp_uv_9, 1, melp_uv_cb_size,
-		      quant_par.lsf_index[2], LPC_ORD, FALSE);
+		      st->quant_par.lsf_index[2], LPC_ORD, FALSE);
 		break;
 	case 3:		/* 011 */
 		lspVQ(lsp[0], wgt[0], lsp[0], lsp_v_256x64x32x32, 4, melp_cb_size,	/* !!! (12/15/99) */
-		      quant_par.lsf_index[0], LPC_ORD, FALSE);
+		      st->quant_par.lsf_index[0], LPC_ORD, FALSE);
 		lspVQ(lsp[1], wgt[1], lsp[1], lsp_uv_9, 1, melp_uv_cb_size,
-		      quant_par.lsf_index[1], LPC_ORD, FALSE);
+		      st->quant_par.lsf_index[1], LPC_ORD, FALSE);
 		lspVQ(lsp[2], wgt[2], lsp[2], lsp_uv_9, 1, melp_uv_cb_size,
-		      quant_par.lsf_index[2], LPC_ORD, FALSE);
+		      st->quant_par.lsf_index[2], LPC_ORD, FALSE);
 		break;
 	default:
 		if (uv_config == 1) {	/* 001 case, if (!uv1 && !uv2 && uv3). */
@@ -1017,7 +1002,7 @@ void lsf_vq(struct melp_param *par)
 					/*      ilsp0[j] = (inpCoef[i][j] * qplsp[j] +
 					   (1.0 - inpCoef[i][j]) * lsp_cand[k][j]); */
 					intfact = inpCoef[i][j];	/* Q14 */
-					acc = melpe_L_mult(intfact, qplsp[j]);	/* Q30 */
+					acc = melpe_L_mult(intfact, st->qplsp[j]);	/* Q30 */
 					intfact = melpe_sub(ONE_Q14, intfact);	/* Q14 */
 					acc = melpe_L_mac(acc, intfact, lsp_cand[k][j]);	/* Q30 */
 					ilsp0[j] = melpe_extract_h(melpe_L_shl(acc, 1));
@@ -1029,7 +1014,7 @@ void lsf_vq(struct melp_param *par)
 					/*      ilsp1[j] = inpCoef[i][j + LPC_ORD] * qplsp[j] +
 					   (1.0 - inpCoef[i][j + LPC_ORD]) * lsp_cand[k][j]; */
 					intfact = inpCoef[i][j + LPC_ORD];	/* Q14 */
-					bcc = melpe_L_mult(intfact, qplsp[j]);
+					bcc = melpe_L_mult(intfact, st->qplsp[j]);
 					intfact = melpe_sub(ONE_Q14, intfact);
 					bcc = melpe_L_mac(bcc, intfact, lsp_cand[k][j]);	/* Q30 */
 					ilsp1[j] = melpe_extract_h(melpe_L_shl(bcc, 1));
@@ -1090,9 +1075,9 @@ void lsf_vq(struct melp_param *par)
 		}
 
 		v_equ(lsp[2], lsp_cand[cand], LPC_ORD);
-		v_equ(quant_par.lsf_index[0], &(lsp_index_cand[cand * tos]),
+		v_equ(st->quant_par.lsf_index[0], &(lsp_index_cand[cand * tos]),
 		      tos);
-		quant_par.lsf_index[1][0] = inp_index_cand;
+		st->quant_par.lsf_index[1][0] = inp_index_cand;
 
 		for (i = 0; i < LPC_ORD; i++) {
 			temp1 = melpe_sub(lsp[0][i], bestlsp0[i]);	/* Q15 */
@@ -1109,10 +1094,10 @@ void lsf_vq(struct melp_param *par)
 
 		if (uv_config == 1)	/* if (!uv1 && !uv2 && uv3) */
 			lspVQ(res, mwgt, res, res256x64x64x64, 4, res_cb_size,
-			      quant_par.lsf_index[2], 2 * LPC_ORD, FALSE);
+			      st->quant_par.lsf_index[2], 2 * LPC_ORD, FALSE);
 		else
 			lspVQ(res, mwgt, res, res256x64x64x64, 2, res_cb_size,
-			      quant_par.lsf_index[2], 2 * LPC_ORD, FALSE);
+			      st->quant_par.lsf_index[2], 2 * LPC_ORD, FALSE);
 
 		/* ---- reconstruct lsp for later stability check ---- */
 		for (i = 0; i < LPC_ORD; i++) {
@@ -1134,7 +1119,7 @@ void lsf_vq(struct melp_param *par)
 	if (!lspStable(lsp[2], LPC_ORD))
 		lspSort(lsp[2], LPC_ORD);
 
-	v_equ(qplsp, lsp[2], LPC_ORD);
+	v_equ(st->qplsp, lsp[2], LPC_ORD);
 }
 
 /*********************************************************************
@@ -1195,7 +1180,7 @@ void deqnt_msvq(int16_t qout[], const int16_t codebook[], int16_t tos,
 ** Return value:	None
 **
 *****************************************************************************/
-void quant_jitter(struct melp_param *par)
+void quant_jitter(struct melpe_enc *st, struct melp_param *par)
 {
 	register int16_t i;
 	int16_t uv_config;
@@ -1257,7 +1242,7 @@ void quant_jitter(struct melp_param *par)
 	for (i = 0; i < NF; i++)
 		par[i].jitter = jitter[i];
 
-	quant_par.jit_index[0] = flag_jitter;
+	st->quant_par.jit_index[0] = flag_jitter;
 }
 
 /****************************************************************************
@@ -1274,11 +1259,9 @@ void quant_jitter(struct melp_param *par)
 **
 *****************************************************************************/
 
-void quant_fsmag(struct melp_param *par)
+void quant_fsmag(struct melpe_enc *st, struct melp_param *par)
 {
-	static BOOLEAN prev_uv = TRUE;
 	register int16_t i;
-	static int16_t prev_fsmag[NUM_HARM];
 	int16_t qmag[NUM_HARM];	/* Q13 */
 	int16_t temp1, temp2;
 	int16_t p_value, q_value;
@@ -1304,30 +1287,30 @@ void quant_fsmag(struct melp_param *par)
 
 	if (count > 0)
 		vq_enc(fsvq_cb, par[last].fs_mag, FS_LEVELS, NUM_HARM, qmag,
-		       &quant_par.fs_index);
+		       &st->quant_par.fs_index);
 
 	if (count > 1) {
-		if (prev_uv || par[0].uv_flag) {
+		if (st->fs_prev_uv || par[0].uv_flag) {
 			for (i = 0; i <= last; i++) {
 				if (!par[i].uv_flag)
 					v_equ(par[i].fs_mag, qmag, NUM_HARM);
 			}
 		} else {
 			if (par[1].uv_flag) {	/* V VUV */
-				v_equ(par[0].fs_mag, prev_fsmag, NUM_HARM);
+				v_equ(par[0].fs_mag, st->prev_fsmag, NUM_HARM);
 				v_equ(par[last].fs_mag, qmag, NUM_HARM);
 			} else if (par[2].uv_flag) {	/* V VVU */
 				v_equ(par[1].fs_mag, qmag, NUM_HARM);
 				for (i = 0; i < NUM_HARM; i++) {
 					/*      par[0].fs_mag[i] = 0.5*(qmag[i] + prev_fsmag[i]); */
 					temp1 = melpe_shr(qmag[i], 1);	/* 0.5*qmag[i], Q13 */
-					temp2 = melpe_shr(prev_fsmag[i], 1);	/* Q13 */
+					temp2 = melpe_shr(st->prev_fsmag[i], 1);	/* Q13 */
 					par[0].fs_mag[i] = melpe_add(temp1, temp2);	/* Q13 */
 				}
 			} else {	/* V VVV */
 				v_equ(par[2].fs_mag, qmag, NUM_HARM);
 				for (i = 0; i < NUM_HARM; i++) {
-					p_value = prev_fsmag[i];
+					p_value = st->prev_fsmag[i];
 					q_value = qmag[i];	/* Q13 */
 
 					/* Note that (par[0].fs_mag[i] + par[1].fs_mag[i]) ==     */
@@ -1348,9 +1331,9 @@ void quant_fsmag(struct melp_param *par)
 	} else if (count == 1)
 		v_equ(par[last].fs_mag, qmag, NUM_HARM);
 
-	prev_uv = par[NF - 1].uv_flag;
-	if (prev_uv)
-		fill(prev_fsmag, ONE_Q13, NUM_HARM);
+	st->fs_prev_uv = par[NF - 1].uv_flag;
+	if (st->fs_prev_uv)
+		fill(st->prev_fsmag, ONE_Q13, NUM_HARM);
 	else
-		v_equ(prev_fsmag, par[NF - 1].fs_mag, NUM_HARM);
+		v_equ(st->prev_fsmag, par[NF - 1].fs_mag, NUM_HARM);
 }
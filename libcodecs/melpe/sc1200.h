@@ -256,24 +256,30 @@ struct quant_param {
 	int16_t chbit;	/* they are rate dependent */
 };
 
-void analysis(int16_t sp_in[], struct melp_param *par);
+struct melpe_enc;		/* analyzer instance, see state.h */
+struct melpe_dec;		/* synthesizer instance, see state.h */
 
-void sc_ana(struct melp_param *par);
+void analysis(struct melpe_enc *st, int16_t sp_in[], struct melp_param *par);
 
-void synthesis(struct melp_param *par, int16_t sp_out[]);
+void sc_ana(struct melpe_enc *st, struct melp_param *par);
 
-void melp_ana_init();
+void synthesis(struct melpe_dec *st, struct melp_param *par, int16_t sp_out[]);
 
-void melp_syn_init();
+void melp_ana_init(struct melpe_enc *st);
 
-void melp_chn_write(struct quant_param *qpar, unsigned char chbuf[]);
+void melp_syn_init(struct melpe_dec *st);
 
-void low_rate_chn_write(struct quant_param *qpar);
+void melp_chn_write(struct melpe_enc *st, struct quant_param *qpar,
+		    unsigned char chbuf[]);
 
-BOOLEAN melp_chn_read(struct quant_param *qpar, struct melp_param *par,
+void low_rate_chn_write(struct melpe_enc *st, struct quant_param *qpar);
+
+BOOLEAN melp_chn_read(struct melpe_dec *st, struct quant_param *qpar,
+		      struct melp_param *par,
 		      struct melp_param *prev_par, unsigned char chbuf[]);
 
-BOOLEAN low_rate_chn_read(struct quant_param *qpar, struct melp_param *par,
+BOOLEAN low_rate_chn_read(struct melpe_dec *st, struct quant_param *qpar,
+			  struct melp_param *par,
 			  struct melp_param *prev_par);
 
 void fec_code(struct quant_param *par);
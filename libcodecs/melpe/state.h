@@ -0,0 +1,230 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/* ================================================================== */
+/*                                                                    */
+/*    Microsoft Speech coder     ANSI-C Source Code                   */
+/*    SC1200 1200 bps speech coder                                    */
+/*    Fixed Point Implementation      Version 7.0                     */
+/*    Copyright (C) 2000, Microsoft Corp.                             */
+/*    All rights reserved.                                            */
+/*                                                                    */
+/* ================================================================== */
+
+/* ================================================================= */
+/* state.h: state of one noise preprocessor, analyzer or synthesizer */
+/*          instance.  These used to be file and function scope      */
+/*          statics; keeping them in an instance lets several coders */
+/*          run side by side.                                        */
+/* ================================================================= */
+
+#ifndef _STATE_H_
+#define _STATE_H_
+
+#include "sc1200.h"
+#include "cprv.h"
+#include "npp.h"
+#include "mat_lib.h"
+
+/* ====== Buffer sizes ====== */
+#define SIG_LENGTH			(LPF_ORD + PITCH_FR)	/* 327 */
+#define TILT_ORD			1
+#define SMOOTH_LEN			20
+
+/* ====== Noise preprocessor ====== */
+struct melpe_npp {
+	/* npp() */
+	BOOLEAN first_time;
+	int16_t speech_overlap[ENH_OVERLAP_LEN];
+
+	/* entities from Enhanced_Data */
+	int16_t enh_i;		/* formerly D->I */
+	int16_t lambdaD[ENH_VEC_LENF];	/* overestimated noise */
+	/* psd(noise_bias * noisespect) */
+	int16_t lambdaD_shift[ENH_VEC_LENF];
+	int16_t SN_LT;		/* long term SNR */
+	int16_t SN_LT_shift;
+	int16_t n_pwr;
+	int16_t n_pwr_shift;
+	int16_t YY[ENH_VEC_LENF];	/* signal periodogram of current frame */
+	int16_t YY_shift[ENH_VEC_LENF];
+	int16_t sm_shift[ENH_VEC_LENF];
+	int16_t noise_shift[ENH_VEC_LENF];
+	int16_t noise2_shift[ENH_VEC_LENF];
+	int16_t av_shift[ENH_VEC_LENF];
+	int16_t av2_shift[ENH_VEC_LENF];
+	int16_t act_min[ENH_VEC_LENF];	/* current minimum of long window */
+	int16_t act_min_shift[ENH_VEC_LENF];
+	int16_t act_min_sub[ENH_VEC_LENF];
+	/* current minimum of sub-window */
+	int16_t act_min_sub_shift[ENH_VEC_LENF];
+	int16_t vk[ENH_VEC_LENF];
+	int16_t vk_shift[ENH_VEC_LENF];
+	int16_t ksi[ENH_VEC_LENF];	/* a priori SNR */
+	int16_t ksi_shift[ENH_VEC_LENF];
+
+	/* entities from Minstat_Data */
+	int16_t var_rel[ENH_VEC_LENF];
+	/* est. relative var. of smoothedspect */
+	int16_t var_rel_av;	/* average relative var. of smoothedspect */
+	int16_t smoothedspect[ENH_VEC_LENF];	/* smoothed signal spectrum */
+	int16_t var_sp_av[ENH_VEC_LENF];
+	/* estimated mean of smoothedspect */
+	int16_t var_sp_2[ENH_VEC_LENF];
+	/* estimated 2nd moment of smoothedspect */
+	int16_t noisespect[ENH_VEC_LENF];	/* estimated noise psd */
+	int16_t noisespect2[ENH_VEC_LENF];
+	int16_t alphacorr;	/* correction factor for alpha_var, Q15 */
+	int16_t alpha_var[ENH_VEC_LENF];	/* variable smoothing */
+	/* parameter for psd */
+	int16_t circb[NUM_MINWIN][ENH_VEC_LENF];	/* ring buffer */
+	int16_t circb_shift[NUM_MINWIN][ENH_VEC_LENF];
+
+	int16_t initial_noise[ENH_WINLEN];	/* look ahead noise */
+	/* samples (Q0) */
+	int16_t speech_in_npp[ENH_WINLEN];	/* input of one frame */
+	int16_t ybuf[2 * ENH_WINLEN + 2];
+	/* buffer for FFT, this can be */
+	/* eliminated if we can write a better real-FFT program for DSP */
+	int32_t temp_yy[ENH_WINLEN + 2];
+
+	/* compute_qk() */
+	int16_t qla[ENH_VEC_LENF];
+
+	/* min_search() */
+	BOOLEAN localflag[ENH_VEC_LENF];	/* local minimum indicator */
+	int16_t minspec_counter;	/* count sub-windows */
+	int16_t circb_index;	/* ring buffer counter */
+	int16_t circb_min[ENH_VEC_LENF];	/* minimum of circular buffer */
+	int16_t circb_min_shift[ENH_VEC_LENF];
+
+	/* process_frame() */
+	BOOLEAN frame_first;
+	int16_t agal[ENH_VEC_LENF];	/* GainD*Ymag */
+	int16_t agal_shift[ENH_VEC_LENF];
+	int16_t Ksi_min_var;
+	int16_t qk[ENH_VEC_LENF];	/* probability of noise only, Q15 */
+	int16_t Gain[ENH_VEC_LENF];	/* MMSE LOG STA estimator gain */
+	int16_t YY_LT, YY_LT_shift;
+	int16_t SN_LT0, SN_LT0_shift;
+};
+
+/* ====== Analyzer ====== */
+struct melpe_enc {
+	v_arena_t arena;	/* scratch arena for working vectors */
+	struct melpe_npp npp;	/* noise preprocessor of the input */
+
+	struct melp_param par[NF];	/* melp analysis parameters */
+	struct quant_param quant_par;
+	unsigned char chbuf[CHSIZE];	/* channel bit data buffer */
+
+	/* analysis() and melp_ana() */
+	int16_t hpspeech[IN_BEG + BLOCK];	/* input speech buffer dc removed */
+	int16_t dcdelin[DC_ORD];
+	int16_t dcdelout_hi[DC_ORD];
+	int16_t dcdelout_lo[DC_ORD];
+	int16_t sigbuf[SIG_LENGTH];
+	classParam classStat[TRACK_NUM];	/* class of subframes */
+	pitTrackParam pitTrack[TRACK_NUM];	/* pitch of subframes */
+	int16_t top_lpc[LPC_ORD];
+	int16_t lpfsp_delin[LPF_ORD];
+	int16_t lpfsp_delout[LPF_ORD];
+	int16_t pitch_avg;
+	int16_t fpitch[NUM_PITCHES];
+
+	/* classifier, classify() and sc_ana() */
+	BOOLEAN classify_first;
+	int16_t voicedEn, silenceEn;	/* Q11 */
+	int32_t voicedCnt;
+	int16_t bpfdel[BPF_ORD + BPF_ORD / 3];
+	int16_t back_sigbuf[PIT_COR_LEN - PIT_SUBFRAME];
+	int16_t prev_sbp3;
+	BOOLEAN prev_uv;
+	int16_t prev_pitch;	/* Q7 */
+
+	/* pitchAuto() */
+	int16_t lpbuf[PIT_COR_LEN];	/* low pass filter buffer, Q0 */
+	int16_t ivbuf[PIT_COR_LEN];	/* inverse filter buffer, Q12 */
+
+	/* p_avg_update() and pitch_ana() */
+	int16_t good_pitch[NF];
+	int16_t lpres_delin[LPF_ORD];
+	int16_t lpres_delout[LPF_ORD];
+	int16_t pit_sigbuf[LPF_ORD + PITCH_FR];
+
+	/* bpvc_ana() */
+	int16_t bpfsp[NUM_BANDS][PITCH_FR - FRAME];
+	int16_t bpfdelin[NUM_BANDS][BPF_ORD];
+	int16_t bpfdelout[NUM_BANDS][BPF_ORD];
+	int16_t envdel[NUM_BANDS][ENV_ORD];
+	int16_t envdel2[NUM_BANDS];
+
+	/* q_gain(), 2400 bps only */
+	int16_t prev_gain;
+
+	/* pitch_vq(), lsf_vq() and quant_fsmag() */
+	BOOLEAN prev_uv_flag;
+	int16_t vq_prev_pitch;	/* Q12 */
+	int16_t vq_prev_qpitch;	/* Q12 */
+	int16_t qplsp[LPC_ORD];	/* Q15 */
+	BOOLEAN fs_prev_uv;
+	int16_t prev_fsmag[NUM_HARM];
+
+	/* channel */
+	int16_t sync_bit;
+	unsigned char bit_buffer[NUM_CH_BITS];
+};
+
+/* ====== Synthesizer ====== */
+struct melpe_dec {
+	v_arena_t arena;	/* scratch arena for working vectors */
+
+	struct melp_param par[NF];	/* decoded melp parameters */
+	struct quant_param quant_par;
+	unsigned char chbuf[CHSIZE];	/* channel bit data buffer */
+
+	/* synthesis() */
+	struct melp_param prev_par;
+	int16_t sigsave[PITCHMAX];
+	int16_t syn_begin;
+	BOOLEAN erase;
+
+	/* melp_syn() */
+	BOOLEAN syn_first;
+	int16_t noise_gain;
+	int16_t prev_lpc_gain;
+	int16_t lpc_del[LPC_ORD];	/* Q0 */
+	int16_t prev_tilt;
+	int16_t prev_pcof[MIX_ORD + 1], prev_ncof[MIX_ORD + 1];
+	int16_t disp_del[DISP_ORD];
+	int16_t ase_del[LPC_ORD], tilt_del[TILT_ORD];
+	int16_t pulse_del[MIX_ORD], noise_del[MIX_ORD];
+	uint32_t seed;		/* random number generator; must not be zero */
+
+	/* scale_adj() */
+	int16_t prev_scale;	/* Q13 */
+
+	/* postfilt(), hpf60() and lpf3500() */
+	int16_t hpm;		/* Q0 */
+	int16_t mem1[LPC_ORD];
+	int16_t mem2[LPC_ORD];
+	int16_t gain;		/* Q14 */
+	int16_t alphaipFIR[LPC_ORD];	/* Q12 */
+	int16_t alphaipIIR[LPC_ORD];
+	int16_t hpf60_delin[2];	/* Q13 */
+	int16_t hpf60_delout_hi[2];
+	int16_t hpf60_delout_lo[2];
+	int16_t lpf3500_delin[2];	/* Q13 */
+	int16_t lpf3500_delout_hi[2];
+	int16_t lpf3500_delout_lo[2];
+
+	/* low_rate_chn_read() and q_gain_dec() */
+	int16_t prev_uv;
+	int16_t prev_fsmag[NUM_HARM];
+	int16_t qplsp[LPC_ORD];
+	int16_t prev_gain[2 * NF * NUM_GAINFR];
+	int16_t dec_prev_gain;	/* 2400 bps only */
+	BOOLEAN prev_gain_err;
+	unsigned char bit_buffer[NUM_CH_BITS];
+};
+
+#endif
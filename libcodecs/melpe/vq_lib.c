@@ -128,7 +128,7 @@ int16_t vq_ms4(const int16_t * cb, int16_t * u, const int16_t * u_est,
 	int16_t i, j, m, s, c, p_max, inner_counter;
 	int16_t *indices, *p_indices, *n_indices;
 	int16_t *parents, *p_parents, *n_parents;
-	int16_t *tmp_p_e;
+	int16_t *tmp_p_e, *nodes;
 	int16_t temp;
 	int32_t L_temp, L_temp1;
 
@@ -149,15 +149,20 @@ int16_t vq_ms4(const int16_t * cb, int16_t * u, const int16_t * u_est,
 		weights[i] = melpe_shr(weights[i], j);
 	}
 
-	/* allocate memory for the current node and parent node (thus, the        */
-	/* factors of two everywhere) The parents and current nodes are allocated */
-	/* contiguously */
-	indices = v_get((int16_t) (2 * ma * stages));
-	errors = v_get((int16_t) (2 * ma * order));
-	uhatw = v_get(order);
-	d = v_get((int16_t) (2 * ma));
-	parents = v_get((int16_t) (2 * ma));
-	tmp_p_e = v_get((int16_t) (ma * order));
+	/* take working memory for the current node and parent node (thus, the  */
+	/* factors of two everywhere) as one block from the scratch arena.  The  */
+	/* tree is kept as a structure of arrays: each node field is contiguous  */
+	/* over all candidates, with parents and current nodes next to each      */
+	/* other, so the inner search loop walks memory linearly.                */
+	nodes = v_get((int16_t) (2 * ma * (stages + order + 2) +
+				 ma * order + 2 * order + 1));
+	indices = nodes;
+	errors = &indices[2 * ma * stages];
+	d = &errors[2 * ma * order];
+	parents = &d[2 * ma];
+	tmp_p_e = &parents[2 * ma];
+	uhatw = &tmp_p_e[ma * order];
+	u_tmp = &uhatw[order];
 
 	/* initialize memory */
 	v_zap(indices, (int16_t) (2 * stages * ma));
@@ -178,8 +183,7 @@ int16_t vq_ms4(const int16_t * cb, int16_t * u, const int16_t * u_est,
 
 	/* u_tmp is the input vector (i.e. if u_est is non-null, it is subtracted */
 	/* off) */
-	u_tmp = v_get((int16_t) (order + 1));	/* u_tmp is Q15 */
-	(void)v_equ(u_tmp, u, order);
+	(void)v_equ(u_tmp, u, order);	/* u_tmp is Q15 */
 	if (u_est)
 		(void)v_sub(u_tmp, u_est, order);
 
@@ -204,9 +208,6 @@ int16_t vq_ms4(const int16_t * cb, int16_t * u, const int16_t * u_est,
 		n_d[c] = tmp;
 	}
 
-	/* no longer need memory so free it here */
-	v_free(u_tmp);
-
 	/* codebook pointer is set to point to first stage */
 	cbp = cb;
 
@@ -285,11 +286,7 @@ int16_t vq_ms4(const int16_t * cb, int16_t * u, const int16_t * u_est,
 					/* n_d is now a Q16 */
 					n_d[p_max] = d_cj;
 
-					i = melpe_add(melpe_shr
-						(melpe_extract_l
-						 (melpe_L_mult(p_max, stages)), 1),
-						s);
-					n_indices[i] = j;
+					n_indices[p_max * stages + s] = j;
 					n_parents[p_max] = c;
 
 					/* want to limit the number of times the inner loop is    */
@@ -373,12 +370,7 @@ int16_t vq_ms4(const int16_t * cb, int16_t * u, const int16_t * u_est,
 		}
 	}
 
-	v_free(tmp_p_e);
-	v_free(parents);
-	v_free(d);
-	v_free(uhatw);
-	v_free(errors);
-	v_free(indices);
+	v_free(nodes);
 
 	return (d_opt);
 }
@@ -45,6 +45,27 @@ opus_val32(*const CELT_PITCH_XCORR_IMPL[OPUS_ARCHMASK + 1]) (const opus_val16 *,
 	    MAY_HAVE_MEDIA(celt_pitch_xcorr),	/* Media */
 	    MAY_HAVE_NEON(celt_pitch_xcorr)	/* NEON */
 };
+#elif defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+void (*const CELT_PITCH_XCORR_IMPL[OPUS_ARCHMASK + 1]) (const opus_val16 *,
+							const opus_val16 *,
+							opus_val32 *, int,
+							int) = {
+	celt_pitch_xcorr_c,	/* ARMv4 */
+	    celt_pitch_xcorr_c,	/* EDSP */
+	    celt_pitch_xcorr_c,	/* Media */
+	    MAY_HAVE_NEON(celt_pitch_xcorr)	/* NEON */
+};
+
+void (*const COMB_FILTER_CONST_IMPL[OPUS_ARCHMASK + 1]) (opus_val32 *,
+							 opus_val32 *, int,
+							 int, opus_val16,
+							 opus_val16,
+							 opus_val16) = {
+	comb_filter_const_c,	/* ARMv4 */
+	    comb_filter_const_c,	/* EDSP */
+	    comb_filter_const_c,	/* Media */
+	    MAY_HAVE_NEON(comb_filter_const)	/* NEON */
+};
 #else
 #error "Floating-point implementation is not supported by ARM asm yet." \
  "Reconfigure with --disable-rtcd or send patches."
@@ -98,6 +98,11 @@ uint32_t opus_cpu_capabilities(void)
 	uint32_t flags = 0;
 	FILE *cpuinfo;
 
+#if defined(__aarch64__)
+	/* Advanced SIMD is mandatory on AArch64, where cpuinfo calls it "asimd" */
+	flags |= OPUS_CPU_ARM_NEON;
+#endif
+
 	/* Reading /proc/self/auxv would be easier, but that doesn't work reliably on
 	 * Android */
 	cpuinfo = fopen("/proc/cpuinfo", "r");
@@ -108,7 +113,8 @@ uint32_t opus_cpu_capabilities(void)
 		char buf[512];
 
 		while (fgets(buf, 512, cpuinfo) != NULL) {
-#if defined(OPUS_ARM_MAY_HAVE_EDSP) || defined(OPUS_ARM_MAY_HAVE_NEON)
+#if defined(OPUS_ARM_MAY_HAVE_EDSP) || defined(OPUS_ARM_MAY_HAVE_NEON) || \
+  defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
 			/* Search for edsp and neon flag */
 			if (memcmp(buf, "Features", 8) == 0) {
 				char *p;
@@ -118,7 +124,7 @@ uint32_t opus_cpu_capabilities(void)
 					flags |= OPUS_CPU_ARM_EDSP;
 #endif
 
-#if defined(OPUS_ARM_MAY_HAVE_NEON)
+#if defined(OPUS_ARM_MAY_HAVE_NEON) || defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
 				p = strstr(buf, " neon");
 				if (p != NULL && (p[5] == ' ' || p[5] == '\n'))
 					flags |= OPUS_CPU_ARM_NEON;
@@ -155,6 +161,11 @@ int opus_select_arch(void)
 	uint32_t flags = opus_cpu_capabilities();
 	int arch = 0;
 
+	/* NEON implies ARMv7 and so EDSP and media too, but AArch64 reports
+	 * neither of those. */
+	if (flags & OPUS_CPU_ARM_NEON)
+		return 3;
+
 	if (!(flags & OPUS_CPU_ARM_EDSP))
 		return arch;
 	arch++;
@@ -42,7 +42,7 @@
 #define MAY_HAVE_MEDIA(name) MAY_HAVE_EDSP(name)
 #endif
 
-#if defined(OPUS_ARM_MAY_HAVE_NEON)
+#if defined(OPUS_ARM_MAY_HAVE_NEON) || defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
 #define MAY_HAVE_NEON(name) name ## _neon
 #else
 #define MAY_HAVE_NEON(name) MAY_HAVE_MEDIA(name)
@@ -0,0 +1,129 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <arm_neon.h>
+
+#include "pitch.h"
+
+#if defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+
+#if defined(FIXED_POINT)
+
+/* vmlal widens every 16x16 product to 32 bits, so this is bit-exact
+   with celt_pitch_xcorr_c(). */
+opus_val32 celt_pitch_xcorr_neon(const opus_val16 * _x, const opus_val16 * _y,
+				 opus_val32 * xcorr, int len, int max_pitch)
+{
+	int i, j;
+	opus_val32 maxcorr = 1;
+	assert(max_pitch > 0);
+	for (i = 0; i < max_pitch - 3; i += 4) {
+		const opus_val16 *y = _y + i;
+		int32x4_t sum = vdupq_n_s32(0);
+		int32x2_t max2;
+		for (j = 0; j < len; j++)
+			sum = vmlal_n_s16(sum, vld1_s16(y + j), _x[j]);
+		vst1q_s32(xcorr + i, sum);
+		max2 = vpmax_s32(vget_low_s32(sum), vget_high_s32(sum));
+		max2 = vpmax_s32(max2, max2);
+		maxcorr = MAX32(maxcorr, vget_lane_s32(max2, 0));
+	}
+	/* In case max_pitch isn't a multiple of 4, do non-unrolled version. */
+	for (; i < max_pitch; i++) {
+		opus_val32 sum = 0;
+		for (j = 0; j < len; j++)
+			sum = MAC16_16(sum, _x[j], _y[i + j]);
+		xcorr[i] = sum;
+		maxcorr = MAX32(maxcorr, sum);
+	}
+	return maxcorr;
+}
+
+#else
+
+void celt_pitch_xcorr_neon(const opus_val16 * _x, const opus_val16 * _y,
+			   opus_val32 * xcorr, int len, int max_pitch)
+{
+	int i, j;
+	assert(max_pitch > 0);
+	for (i = 0; i < max_pitch - 3; i += 4) {
+		const opus_val16 *y = _y + i;
+		float32x4_t sum0 = vdupq_n_f32(0);
+		float32x4_t sum1 = vdupq_n_f32(0);
+		for (j = 0; j < len - 1; j += 2) {
+			sum0 = vmlaq_n_f32(sum0, vld1q_f32(y + j), _x[j]);
+			sum1 = vmlaq_n_f32(sum1, vld1q_f32(y + j + 1),
+					   _x[j + 1]);
+		}
+		if (j < len)
+			sum0 = vmlaq_n_f32(sum0, vld1q_f32(y + j), _x[j]);
+		vst1q_f32(xcorr + i, vaddq_f32(sum0, sum1));
+	}
+	/* In case max_pitch isn't a multiple of 4, do non-unrolled version. */
+	for (; i < max_pitch; i++) {
+		opus_val32 sum = 0;
+		for (j = 0; j < len; j++)
+			sum = MAC16_16(sum, _x[j], _y[i + j]);
+		xcorr[i] = sum;
+	}
+}
+
+void comb_filter_const_neon(opus_val32 * y, opus_val32 * x, int T, int N,
+			    opus_val16 g10, opus_val16 g11, opus_val16 g12)
+{
+	int i;
+	/* T is at least COMBFILTER_MINPERIOD, so every tap of a block is
+	   read before the block itself is written, even when y == x. */
+	for (i = 0; i < N - 3; i += 4) {
+		const opus_val32 *xp = &x[i - T];
+		float32x4_t yi, x0v, x1v, x2v, x3v, x4v;
+		yi = vld1q_f32(x + i);
+		x0v = vld1q_f32(xp - 2);
+		x1v = vld1q_f32(xp - 1);
+		x2v = vld1q_f32(xp);
+		x3v = vld1q_f32(xp + 1);
+		x4v = vld1q_f32(xp + 2);
+		yi = vmlaq_n_f32(yi, x2v, g10);
+		yi = vmlaq_n_f32(yi, vaddq_f32(x3v, x1v), g11);
+		yi = vmlaq_n_f32(yi, vaddq_f32(x4v, x0v), g12);
+		vst1q_f32(y + i, yi);
+	}
+	for (; i < N; i++) {
+		y[i] = x[i]
+		    + MULT16_32_Q15(g10, x[i - T])
+		    + MULT16_32_Q15(g11, ADD32(x[i - T + 1], x[i - T - 1]))
+		    + MULT16_32_Q15(g12, ADD32(x[i - T + 2], x[i - T - 2]));
+	}
+}
+
+#endif				/* FIXED_POINT */
+
+#endif
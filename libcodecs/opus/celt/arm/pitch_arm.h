@@ -34,7 +34,7 @@
 
 #if defined(FIXED_POINT)
 
-#if defined(OPUS_ARM_MAY_HAVE_NEON)
+#if defined(OPUS_ARM_MAY_HAVE_NEON) || defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
 opus_val32 celt_pitch_xcorr_neon(const opus_val16 * _x, const opus_val16 * _y,
 				 opus_val32 * xcorr, int len, int max_pitch);
 #endif
@@ -54,6 +54,16 @@ opus_val32 celt_pitch_xcorr_edsp(const opus_val16 * _x, const opus_val16 * _y,
   ((void)(arch),PRESUME_NEON(celt_pitch_xcorr)(_x, _y, xcorr, len, max_pitch))
 #endif
 
+#else
+
+#if defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+void celt_pitch_xcorr_neon(const opus_val16 * _x, const opus_val16 * _y,
+			   opus_val32 * xcorr, int len, int max_pitch);
+
+void comb_filter_const_neon(opus_val32 * y, opus_val32 * x, int T, int N,
+			    opus_val16 g10, opus_val16 g11, opus_val16 g12);
+#endif
+
 #endif
 
 #endif
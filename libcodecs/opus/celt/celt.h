@@ -204,7 +204,7 @@ extern "C" {
 
 	void comb_filter(opus_val32 * y, opus_val32 * x, int T0, int T1, int N,
 			 opus_val16 g0, opus_val16 g1, int tapset0, int tapset1,
-			 const opus_val16 * window, int overlap);
+			 const opus_val16 * window, int overlap, int arch);
 
 	void init_caps(const CELTMode * m, int *cap, int LM, int C);
 
@@ -656,7 +656,7 @@ static void celt_decode_lost(CELTDecoder * OPUS_RESTRICT st,
 				    st->postfilter_period, overlap,
 				    -st->postfilter_gain, -st->postfilter_gain,
 				    st->postfilter_tapset,
-				    st->postfilter_tapset, NULL, 0);
+				    st->postfilter_tapset, NULL, 0, st->arch);
 
 			/* Simulate TDAC on the concealed audio so that it blends with the
 			   MDCT of the next frame. */
@@ -987,7 +987,7 @@ int celt_decode_with_ec(CELTDecoder * OPUS_RESTRICT st,
 			    st->postfilter_period, mode->shortMdctSize,
 			    st->postfilter_gain_old, st->postfilter_gain,
 			    st->postfilter_tapset_old, st->postfilter_tapset,
-			    mode->window, overlap);
+			    mode->window, overlap, st->arch);
 		if (LM != 0)
 			comb_filter(out_syn[c] + mode->shortMdctSize,
 				    out_syn[c] + mode->shortMdctSize,
@@ -995,7 +995,7 @@ int celt_decode_with_ec(CELTDecoder * OPUS_RESTRICT st,
 				    N - mode->shortMdctSize,
 				    st->postfilter_gain, postfilter_gain,
 				    st->postfilter_tapset, postfilter_tapset,
-				    mode->window, overlap);
+				    mode->window, overlap, st->arch);
 
 	} while (++c < CC);
 	st->postfilter_period_old = st->postfilter_period;
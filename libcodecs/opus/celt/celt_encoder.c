@@ -1141,13 +1141,13 @@ static int run_prefilter(CELTEncoder * st, celt_sig * in,
 				    st->prefilter_period, st->prefilter_period,
 				    offset, -st->prefilter_gain,
 				    -st->prefilter_gain, st->prefilter_tapset,
-				    st->prefilter_tapset, NULL, 0);
+				    st->prefilter_tapset, NULL, 0, st->arch);
 
 		comb_filter(in + c * (N + st->overlap) + st->overlap + offset,
 			    pre[c] + COMBFILTER_MAXPERIOD + offset,
 			    st->prefilter_period, pitch_index, N - offset,
 			    -st->prefilter_gain, -gain1, st->prefilter_tapset,
-			    prefilter_tapset, mode->window, st->overlap);
+			    prefilter_tapset, mode->window, st->overlap, st->arch);
 		OPUS_COPY(st->in_mem + c * (st->overlap),
 			  in + c * (N + st->overlap) + N, st->overlap);
 
@@ -2153,7 +2153,7 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_val16 * pcm,
 				    st->prefilter_gain_old, st->prefilter_gain,
 				    st->prefilter_tapset_old,
 				    st->prefilter_tapset, mode->window,
-				    st->overlap);
+				    st->overlap, st->arch);
 			if (LM != 0)
 				comb_filter(out_mem[c] + mode->shortMdctSize,
 					    out_mem[c] + mode->shortMdctSize,
@@ -2162,7 +2162,7 @@ int celt_encode_with_ec(CELTEncoder * OPUS_RESTRICT st, const opus_val16 * pcm,
 					    st->prefilter_gain, gain1,
 					    st->prefilter_tapset,
 					    prefilter_tapset, mode->window,
-					    overlap);
+					    overlap, st->arch);
 		} while (++c < CC);
 
 		/* We reuse freq[] as scratch space for the de-emphasis */
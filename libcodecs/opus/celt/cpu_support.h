@@ -33,7 +33,8 @@
 #include <stdint.h>
 #include "opus_defines.h"
 
-#if defined(OPUS_HAVE_RTCD) && defined(OPUS_ARM_ASM)
+#if defined(OPUS_HAVE_RTCD) && \
+  (defined(OPUS_ARM_ASM) || defined(OPUS_ARM_MAY_HAVE_NEON_INTR))
 #include "arm/armcpu.h"
 
 /* We currently support 4 ARM variants:
@@ -44,6 +45,19 @@
  */
 #define OPUS_ARCHMASK 3
 
+#elif defined(OPUS_HAVE_RTCD) && \
+  (defined(OPUS_X86_MAY_HAVE_SSE2) || defined(OPUS_X86_MAY_HAVE_SSE4_1) || \
+   defined(OPUS_X86_MAY_HAVE_AVX))
+#include "x86/x86cpu.h"
+
+/* We currently support 4 x86 variants:
+ * arch[0] -> C
+ * arch[1] -> SSE2
+ * arch[2] -> SSE4.1
+ * arch[3] -> AVX
+ */
+#define OPUS_ARCHMASK 3
+
 #else
 #define OPUS_ARCHMASK 0
 
@@ -41,11 +41,18 @@
 #include "modes.h"
 #include "cpu_support.h"
 
-#if defined(__SSE__) && !defined(FIXED_POINT)
+#if (defined(__SSE__) && !defined(FIXED_POINT)) || \
+  (defined(__SSE2__) && defined(FIXED_POINT))
 #include "x86/pitch_sse.h"
 #endif
 
-#if defined(OPUS_ARM_ASM) && defined(FIXED_POINT)
+#if defined(OPUS_X86_MAY_HAVE_SSE2) || defined(OPUS_X86_MAY_HAVE_SSE4_1) || \
+  defined(OPUS_X86_MAY_HAVE_AVX)
+#include "x86/pitch_x86.h"
+#endif
+
+#if (defined(OPUS_ARM_ASM) && defined(FIXED_POINT)) || \
+  defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
 #include "arm/pitch_arm.h"
 #endif
 
@@ -176,4 +183,28 @@ extern
 #endif
 #endif
 
+void comb_filter_const_c(opus_val32 * y, opus_val32 * x, int T, int N,
+			 opus_val16 g10, opus_val16 g11, opus_val16 g12);
+
+/* Only the float build has vector comb filters; the fixed-point one
+   must stay bit-exact with the reference and always runs the C loop. */
+#if defined(OPUS_HAVE_RTCD) && !defined(FIXED_POINT) && \
+  (defined(OPUS_X86_MAY_HAVE_SSE2) || defined(OPUS_ARM_MAY_HAVE_NEON_INTR))
+extern void (*const COMB_FILTER_CONST_IMPL[OPUS_ARCHMASK + 1]) (opus_val32 *,
+								opus_val32 *,
+								int, int,
+								opus_val16,
+								opus_val16,
+								opus_val16);
+
+#define comb_filter_const(y, x, T, N, g10, g11, g12, arch) \
+  ((*COMB_FILTER_CONST_IMPL[(arch)&OPUS_ARCHMASK])(y, x, T, N, g10, g11, g12))
+#elif defined(OVERRIDE_COMB_FILTER_CONST)
+#define comb_filter_const(y, x, T, N, g10, g11, g12, arch) \
+  ((void)(arch),comb_filter_const_sse(y, x, T, N, g10, g11, g12))
+#else
+#define comb_filter_const(y, x, T, N, g10, g11, g12, arch) \
+  ((void)(arch),comb_filter_const_c(y, x, T, N, g10, g11, g12))
+#endif
+
 #endif
@@ -0,0 +1,114 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <immintrin.h>
+
+#include "pitch.h"
+
+#if defined(OPUS_X86_MAY_HAVE_AVX) && !defined(FIXED_POINT)
+
+/* Eight lags per pass: broadcast one input sample and multiply it
+   against eight consecutive history samples. */
+void celt_pitch_xcorr_avx(const opus_val16 * _x, const opus_val16 * _y,
+			  opus_val32 * xcorr, int len, int max_pitch)
+{
+	int i, j;
+	assert(max_pitch > 0);
+	for (i = 0; i < max_pitch - 7; i += 8) {
+		const opus_val16 *y = _y + i;
+		__m256 sum0 = _mm256_setzero_ps();
+		__m256 sum1 = _mm256_setzero_ps();
+		for (j = 0; j < len - 1; j += 2) {
+			__m256 x0 = _mm256_broadcast_ss(_x + j);
+			__m256 x1 = _mm256_broadcast_ss(_x + j + 1);
+			__m256 y0 = _mm256_loadu_ps(y + j);
+			__m256 y1 = _mm256_loadu_ps(y + j + 1);
+			sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(x0, y0));
+			sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(x1, y1));
+		}
+		if (j < len) {
+			__m256 x0 = _mm256_broadcast_ss(_x + j);
+			__m256 y0 = _mm256_loadu_ps(y + j);
+			sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(x0, y0));
+		}
+		_mm256_storeu_ps(xcorr + i, _mm256_add_ps(sum0, sum1));
+	}
+	for (; i < max_pitch - 3; i += 4) {
+		opus_val32 sum[4] = { 0, 0, 0, 0 };
+		xcorr_kernel(_x, _y + i, sum, len);
+		xcorr[i] = sum[0];
+		xcorr[i + 1] = sum[1];
+		xcorr[i + 2] = sum[2];
+		xcorr[i + 3] = sum[3];
+	}
+	/* In case max_pitch isn't a multiple of 4, do non-unrolled version. */
+	for (; i < max_pitch; i++) {
+		opus_val32 sum = 0;
+		for (j = 0; j < len; j++)
+			sum = MAC16_16(sum, _x[j], _y[i + j]);
+		xcorr[i] = sum;
+	}
+}
+
+void comb_filter_const_avx(opus_val32 * y, opus_val32 * x, int T, int N,
+			   opus_val16 g10, opus_val16 g11, opus_val16 g12)
+{
+	int i;
+	__m256 g10v, g11v, g12v;
+	g10v = _mm256_set1_ps(g10);
+	g11v = _mm256_set1_ps(g11);
+	g12v = _mm256_set1_ps(g12);
+	/* T is at least COMBFILTER_MINPERIOD, so every tap of a block is
+	   read before the block itself is written, even when y == x. */
+	for (i = 0; i < N - 7; i += 8) {
+		const opus_val32 *xp = &x[i - T];
+		__m256 yi, x0v, x1v, x2v, x3v, x4v;
+		yi = _mm256_loadu_ps(x + i);
+		x0v = _mm256_loadu_ps(xp - 2);
+		x1v = _mm256_loadu_ps(xp - 1);
+		x2v = _mm256_loadu_ps(xp);
+		x3v = _mm256_loadu_ps(xp + 1);
+		x4v = _mm256_loadu_ps(xp + 2);
+		yi = _mm256_add_ps(yi, _mm256_mul_ps(g10v, x2v));
+		x1v = _mm256_mul_ps(g11v, _mm256_add_ps(x3v, x1v));
+		x0v = _mm256_mul_ps(g12v, _mm256_add_ps(x4v, x0v));
+		yi = _mm256_add_ps(yi, _mm256_add_ps(x1v, x0v));
+		_mm256_storeu_ps(y + i, yi);
+	}
+	for (; i < N; i++) {
+		y[i] = x[i]
+		    + MULT16_32_Q15(g10, x[i - T])
+		    + MULT16_32_Q15(g11, ADD32(x[i - T + 1], x[i - T - 1]))
+		    + MULT16_32_Q15(g12, ADD32(x[i - T + 2], x[i - T - 2]));
+	}
+}
+
+#endif
@@ -34,9 +34,47 @@
 #ifndef PITCH_SSE_H
 #define PITCH_SSE_H
 
-#include <xmmintrin.h>
 #include "arch.h"
 
+#if defined(FIXED_POINT)
+
+#include <emmintrin.h>
+
+/* pmaddwd sums two exact 16x16 products per lane, so the result is
+   bit-exact with the MAC16_16 loop below. */
+#define OVERRIDE_DUAL_INNER_PROD
+static inline void dual_inner_prod(const opus_val16 * x, const opus_val16 * y01,
+				   const opus_val16 * y02, int N,
+				   opus_val32 * xy1, opus_val32 * xy2)
+{
+	int i;
+	__m128i xsum1, xsum2;
+	xsum1 = _mm_setzero_si128();
+	xsum2 = _mm_setzero_si128();
+	for (i = 0; i < N - 7; i += 8) {
+		__m128i xi = _mm_loadu_si128((const __m128i *)(x + i));
+		__m128i y1i = _mm_loadu_si128((const __m128i *)(y01 + i));
+		__m128i y2i = _mm_loadu_si128((const __m128i *)(y02 + i));
+		xsum1 = _mm_add_epi32(xsum1, _mm_madd_epi16(xi, y1i));
+		xsum2 = _mm_add_epi32(xsum2, _mm_madd_epi16(xi, y2i));
+	}
+	/* Horizontal sum */
+	xsum1 = _mm_add_epi32(xsum1, _mm_unpackhi_epi64(xsum1, xsum1));
+	xsum1 = _mm_add_epi32(xsum1, _mm_shuffle_epi32(xsum1, 0x55));
+	xsum2 = _mm_add_epi32(xsum2, _mm_unpackhi_epi64(xsum2, xsum2));
+	xsum2 = _mm_add_epi32(xsum2, _mm_shuffle_epi32(xsum2, 0x55));
+	*xy1 = _mm_cvtsi128_si32(xsum1);
+	*xy2 = _mm_cvtsi128_si32(xsum2);
+	for (; i < N; i++) {
+		*xy1 = MAC16_16(*xy1, x[i], y01[i]);
+		*xy2 = MAC16_16(*xy2, x[i], y02[i]);
+	}
+}
+
+#else
+
+#include <xmmintrin.h>
+
 #define OVERRIDE_XCORR_KERNEL
 static inline void xcorr_kernel(const opus_val16 * x, const opus_val16 * y,
 				opus_val32 sum[4], int len)
@@ -117,9 +155,9 @@ static inline void dual_inner_prod(const opus_val16 * x, const opus_val16 * y01,
 }
 
 #define OVERRIDE_COMB_FILTER_CONST
-static inline void comb_filter_const(opus_val32 * y, opus_val32 * x, int T,
-				     int N, opus_val16 g10, opus_val16 g11,
-				     opus_val16 g12)
+static inline void comb_filter_const_sse(opus_val32 * y, opus_val32 * x,
+					 int T, int N, opus_val16 g10,
+					 opus_val16 g11, opus_val16 g12)
 {
 	int i;
 	__m128 x0v;
@@ -157,14 +195,14 @@ static inline void comb_filter_const(opus_val32 * y, opus_val32 * x, int T,
 		x0v = x4v;
 		_mm_storeu_ps(y + i, yi);
 	}
-#ifdef CUSTOM_MODES
 	for (; i < N; i++) {
 		y[i] = x[i]
 		    + MULT16_32_Q15(g10, x[i - T])
 		    + MULT16_32_Q15(g11, ADD32(x[i - T + 1], x[i - T - 1]))
 		    + MULT16_32_Q15(g12, ADD32(x[i - T + 2], x[i - T - 2]));
 	}
-#endif
 }
 
+#endif				/* FIXED_POINT */
+
 #endif
@@ -0,0 +1,134 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <emmintrin.h>
+
+#include "pitch.h"
+
+#if defined(OPUS_X86_MAY_HAVE_SSE2)
+
+#if defined(FIXED_POINT)
+
+/* Four lags per pass, eight taps per pmaddwd.  Every product is exact
+   and the 32-bit sums wrap the same way as MAC16_16, so the result is
+   bit-exact with celt_pitch_xcorr_c(). */
+opus_val32 celt_pitch_xcorr_sse2(const opus_val16 * _x, const opus_val16 * _y,
+				 opus_val32 * xcorr, int len, int max_pitch)
+{
+	int i, j;
+	opus_val32 maxcorr = 1;
+	assert(max_pitch > 0);
+	for (i = 0; i < max_pitch - 3; i += 4) {
+		const opus_val16 *y = _y + i;
+		opus_val32 sum[4];
+		__m128i sum0, sum1, sum2, sum3, t0, t1;
+		sum0 = _mm_setzero_si128();
+		sum1 = _mm_setzero_si128();
+		sum2 = _mm_setzero_si128();
+		sum3 = _mm_setzero_si128();
+		for (j = 0; j < len - 7; j += 8) {
+			__m128i xj = _mm_loadu_si128((const __m128i *)(_x + j));
+			sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(xj,
+				_mm_loadu_si128((const __m128i *)(y + j))));
+			sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(xj,
+				_mm_loadu_si128((const __m128i *)(y + j + 1))));
+			sum2 = _mm_add_epi32(sum2, _mm_madd_epi16(xj,
+				_mm_loadu_si128((const __m128i *)(y + j + 2))));
+			sum3 = _mm_add_epi32(sum3, _mm_madd_epi16(xj,
+				_mm_loadu_si128((const __m128i *)(y + j + 3))));
+		}
+		/* Transpose-add the four accumulators into one vector */
+		t0 = _mm_add_epi32(_mm_unpacklo_epi32(sum0, sum1),
+				   _mm_unpackhi_epi32(sum0, sum1));
+		t1 = _mm_add_epi32(_mm_unpacklo_epi32(sum2, sum3),
+				   _mm_unpackhi_epi32(sum2, sum3));
+		_mm_storeu_si128((__m128i *) sum,
+				 _mm_add_epi32(_mm_unpacklo_epi64(t0, t1),
+					       _mm_unpackhi_epi64(t0, t1)));
+		for (; j < len; j++) {
+			sum[0] = MAC16_16(sum[0], _x[j], y[j]);
+			sum[1] = MAC16_16(sum[1], _x[j], y[j + 1]);
+			sum[2] = MAC16_16(sum[2], _x[j], y[j + 2]);
+			sum[3] = MAC16_16(sum[3], _x[j], y[j + 3]);
+		}
+		xcorr[i] = sum[0];
+		xcorr[i + 1] = sum[1];
+		xcorr[i + 2] = sum[2];
+		xcorr[i + 3] = sum[3];
+		sum[0] = MAX32(sum[0], sum[1]);
+		sum[2] = MAX32(sum[2], sum[3]);
+		sum[0] = MAX32(sum[0], sum[2]);
+		maxcorr = MAX32(maxcorr, sum[0]);
+	}
+	/* In case max_pitch isn't a multiple of 4, do non-unrolled version. */
+	for (; i < max_pitch; i++) {
+		opus_val32 sum = 0;
+		for (j = 0; j < len; j++)
+			sum = MAC16_16(sum, _x[j], _y[i + j]);
+		xcorr[i] = sum;
+		maxcorr = MAX32(maxcorr, sum);
+	}
+	return maxcorr;
+}
+
+#else
+
+void celt_pitch_xcorr_sse2(const opus_val16 * _x, const opus_val16 * _y,
+			   opus_val32 * xcorr, int len, int max_pitch)
+{
+	int i, j;
+	assert(max_pitch > 0);
+	for (i = 0; i < max_pitch - 3; i += 4) {
+		opus_val32 sum[4] = { 0, 0, 0, 0 };
+		xcorr_kernel(_x, _y + i, sum, len);
+		xcorr[i] = sum[0];
+		xcorr[i + 1] = sum[1];
+		xcorr[i + 2] = sum[2];
+		xcorr[i + 3] = sum[3];
+	}
+	/* In case max_pitch isn't a multiple of 4, do non-unrolled version. */
+	for (; i < max_pitch; i++) {
+		opus_val32 sum = 0;
+		for (j = 0; j < len; j++)
+			sum = MAC16_16(sum, _x[j], _y[i + j]);
+		xcorr[i] = sum;
+	}
+}
+
+void comb_filter_const_sse2(opus_val32 * y, opus_val32 * x, int T, int N,
+			    opus_val16 g10, opus_val16 g11, opus_val16 g12)
+{
+	comb_filter_const_sse(y, x, T, N, g10, g11, g12);
+}
+
+#endif				/* FIXED_POINT */
+
+#endif
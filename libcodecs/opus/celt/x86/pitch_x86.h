@@ -0,0 +1,60 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined(PITCH_X86_H)
+#define PITCH_X86_H
+
+#include "x86cpu.h"
+
+#if defined(OPUS_X86_MAY_HAVE_SSE2)
+#if defined(FIXED_POINT)
+opus_val32
+#else
+void
+#endif
+celt_pitch_xcorr_sse2(const opus_val16 * _x, const opus_val16 * _y,
+		      opus_val32 * xcorr, int len, int max_pitch);
+#endif
+
+#if defined(OPUS_X86_MAY_HAVE_AVX) && !defined(FIXED_POINT)
+void celt_pitch_xcorr_avx(const opus_val16 * _x, const opus_val16 * _y,
+			  opus_val32 * xcorr, int len, int max_pitch);
+#endif
+
+#if !defined(FIXED_POINT)
+#if defined(OPUS_X86_MAY_HAVE_SSE2)
+void comb_filter_const_sse2(opus_val32 * y, opus_val32 * x, int T, int N,
+			    opus_val16 g10, opus_val16 g11, opus_val16 g12);
+#endif
+
+#if defined(OPUS_X86_MAY_HAVE_AVX)
+void comb_filter_const_avx(opus_val32 * y, opus_val32 * x, int T, int N,
+			   opus_val16 g10, opus_val16 g11, opus_val16 g12);
+#endif
+#endif
+
+#endif
@@ -0,0 +1,77 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pitch.h"
+
+#if defined(OPUS_HAVE_RTCD)
+
+/* CELT has no SSE4.1 kernels of its own, and AVX has no 256-bit integer
+   multiplies, so the fixed-point build keeps the SSE2 kernels on both. */
+#if defined(OPUS_X86_MAY_HAVE_AVX)
+#define CELT_MAY_HAVE_AVX(name) name ## _avx
+#else
+#define CELT_MAY_HAVE_AVX(name) MAY_HAVE_SSE2(name)
+#endif
+
+#if defined(FIXED_POINT)
+opus_val32(*const CELT_PITCH_XCORR_IMPL[OPUS_ARCHMASK + 1]) (const opus_val16 *,
+							     const opus_val16 *,
+							     opus_val32 *, int,
+							     int) = {
+	celt_pitch_xcorr_c,	/* C */
+	    MAY_HAVE_SSE2(celt_pitch_xcorr),	/* SSE2 */
+	    MAY_HAVE_SSE2(celt_pitch_xcorr),	/* SSE4.1 */
+	    MAY_HAVE_SSE2(celt_pitch_xcorr)	/* AVX */
+};
+#else
+void (*const CELT_PITCH_XCORR_IMPL[OPUS_ARCHMASK + 1]) (const opus_val16 *,
+							const opus_val16 *,
+							opus_val32 *, int,
+							int) = {
+	celt_pitch_xcorr_c,	/* C */
+	    MAY_HAVE_SSE2(celt_pitch_xcorr),	/* SSE2 */
+	    MAY_HAVE_SSE2(celt_pitch_xcorr),	/* SSE4.1 */
+	    CELT_MAY_HAVE_AVX(celt_pitch_xcorr)	/* AVX */
+};
+
+void (*const COMB_FILTER_CONST_IMPL[OPUS_ARCHMASK + 1]) (opus_val32 *,
+							 opus_val32 *, int,
+							 int, opus_val16,
+							 opus_val16,
+							 opus_val16) = {
+	comb_filter_const_c,	/* C */
+	    MAY_HAVE_SSE2(comb_filter_const),	/* SSE2 */
+	    MAY_HAVE_SSE2(comb_filter_const),	/* SSE4.1 */
+	    CELT_MAY_HAVE_AVX(comb_filter_const)	/* AVX */
+};
+#endif
+
+#endif
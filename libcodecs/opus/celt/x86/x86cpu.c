@@ -0,0 +1,117 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef OPUS_HAVE_RTCD
+
+#include "x86cpu.h"
+#include "cpu_support.h"
+#include <stdint.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+#define OPUS_CPU_X86_SSE2   (1)
+#define OPUS_CPU_X86_SSE4_1 (1<<1)
+#define OPUS_CPU_X86_AVX    (1<<2)
+
+static void opus_cpuid(unsigned int leaf, unsigned int regs[4])
+{
+#if defined(_MSC_VER)
+	__cpuid((int *)regs, leaf);
+#else
+	regs[0] = regs[1] = regs[2] = regs[3] = 0;
+	__get_cpuid(leaf, &regs[0], &regs[1], &regs[2], &regs[3]);
+#endif
+}
+
+/* AVX also needs the OS to save the upper halves of the ymm registers
+ * on context switch, which is what XCR0 bits 1 and 2 tell us. */
+static int opus_os_saves_ymm(void)
+{
+#if defined(_MSC_VER)
+	return (_xgetbv(0) & 6) == 6;
+#else
+	uint32_t lo, hi;
+	__asm__ __volatile__(".byte 0x0f, 0x01, 0xd0"	/* xgetbv */
+			     :"=a"(lo), "=d"(hi)
+			     :"c"(0));
+	(void)hi;
+	return (lo & 6) == 6;
+#endif
+}
+
+static uint32_t opus_cpu_capabilities(void)
+{
+	unsigned int regs[4];
+	uint32_t flags = 0;
+
+	opus_cpuid(0, regs);
+	if (regs[0] < 1)
+		return flags;
+	opus_cpuid(1, regs);
+
+	/* edx bit 26: SSE2, ecx bit 19: SSE4.1,
+	 * ecx bit 27: OSXSAVE, ecx bit 28: AVX */
+	if (regs[3] & (1u << 26))
+		flags |= OPUS_CPU_X86_SSE2;
+	if (regs[2] & (1u << 19))
+		flags |= OPUS_CPU_X86_SSE4_1;
+	if ((regs[2] & (1u << 27)) && (regs[2] & (1u << 28))
+	    && opus_os_saves_ymm())
+		flags |= OPUS_CPU_X86_AVX;
+
+	return flags;
+}
+
+int opus_select_arch(void)
+{
+	uint32_t flags = opus_cpu_capabilities();
+	int arch = 0;
+
+	if (!(flags & OPUS_CPU_X86_SSE2))
+		return arch;
+	arch++;
+
+	if (!(flags & OPUS_CPU_X86_SSE4_1))
+		return arch;
+	arch++;
+
+	if (!(flags & OPUS_CPU_X86_AVX))
+		return arch;
+	arch++;
+
+	return arch;
+}
+
+#endif
@@ -0,0 +1,53 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if !defined(X86CPU_H)
+#define X86CPU_H
+
+#if defined(OPUS_X86_MAY_HAVE_SSE2)
+#define MAY_HAVE_SSE2(name) name ## _sse2
+#else
+#define MAY_HAVE_SSE2(name) name ## _c
+#endif
+
+#if defined(OPUS_X86_MAY_HAVE_SSE4_1)
+#define MAY_HAVE_SSE4_1(name) name ## _sse4_1
+#else
+#define MAY_HAVE_SSE4_1(name) MAY_HAVE_SSE2(name)
+#endif
+
+#if defined(OPUS_X86_MAY_HAVE_AVX)
+#define MAY_HAVE_AVX(name) name ## _avx
+#else
+#define MAY_HAVE_AVX(name) MAY_HAVE_SSE4_1(name)
+#endif
+
+#if defined(OPUS_HAVE_RTCD)
+int opus_select_arch(void);
+#endif
+
+#endif
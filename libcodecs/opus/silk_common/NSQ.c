@@ -32,6 +32,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 #include "main.h"
+#include "NSQ.h"
 
 static inline void silk_nsq_scale_states(const silk_encoder_state * psEncC,	/* I    Encoder State                   */
 					 silk_nsq_state * NSQ,	/* I/O  NSQ state                       */
@@ -64,7 +65,8 @@ static inline void silk_noise_shape_quantizer(silk_nsq_state * NSQ,	/* I/O  NSQ
 					      int offset_Q10,	/* I                                    */
 					      int length,	/* I    Input length                    */
 					      int shapingLPCOrder,	/* I    Noise shaping AR filter order   */
-					      int predictLPCOrder	/* I    Prediction filter order         */
+					      int predictLPCOrder,	/* I    Prediction filter order         */
+					      int arch	/* I    Run-time architecture           */
     );
 
 void silk_NSQ(const silk_encoder_state * psEncC,	/* I/O  Encoder State                   */
@@ -173,7 +175,8 @@ void silk_NSQ(const silk_encoder_state * psEncC,	/* I/O  Encoder State
 					   Lambda_Q10, offset_Q10,
 					   psEncC->subfr_length,
 					   psEncC->shapingLPCOrder,
-					   psEncC->predictLPCOrder);
+					   psEncC->predictLPCOrder,
+					   psEncC->arch);
 
 		x_Q3 += psEncC->subfr_length;
 		pulses += psEncC->subfr_length;
@@ -214,7 +217,8 @@ static inline void silk_noise_shape_quantizer(silk_nsq_state * NSQ,	/* I/O  NSQ
 					      int offset_Q10,	/* I                                    */
 					      int length,	/* I    Input length                    */
 					      int shapingLPCOrder,	/* I    Noise shaping AR filter order   */
-					      int predictLPCOrder	/* I    Prediction filter order         */
+					      int predictLPCOrder,	/* I    Prediction filter order         */
+					      int arch	/* I    Run-time architecture           */
     )
 {
 	int i, j;
@@ -239,49 +243,11 @@ static inline void silk_noise_shape_quantizer(silk_nsq_state * NSQ,	/* I/O  NSQ
 		NSQ->rand_seed = silk_RAND(NSQ->rand_seed);
 
 		/* Short-term prediction */
-		assert(predictLPCOrder == 10 || predictLPCOrder == 16);
-		/* Avoids introducing a bias because silk_SMLAWB() always rounds to -inf */
-		LPC_pred_Q10 = silk_RSHIFT(predictLPCOrder, 1);
 		LPC_pred_Q10 =
-		    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[0], a_Q12[0]);
-		LPC_pred_Q10 =
-		    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[-1], a_Q12[1]);
-		LPC_pred_Q10 =
-		    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[-2], a_Q12[2]);
-		LPC_pred_Q10 =
-		    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[-3], a_Q12[3]);
-		LPC_pred_Q10 =
-		    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[-4], a_Q12[4]);
-		LPC_pred_Q10 =
-		    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[-5], a_Q12[5]);
-		LPC_pred_Q10 =
-		    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[-6], a_Q12[6]);
-		LPC_pred_Q10 =
-		    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[-7], a_Q12[7]);
-		LPC_pred_Q10 =
-		    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[-8], a_Q12[8]);
-		LPC_pred_Q10 =
-		    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[-9], a_Q12[9]);
-		if (predictLPCOrder == 16) {
-			LPC_pred_Q10 =
-			    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[-10],
-					a_Q12[10]);
-			LPC_pred_Q10 =
-			    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[-11],
-					a_Q12[11]);
-			LPC_pred_Q10 =
-			    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[-12],
-					a_Q12[12]);
-			LPC_pred_Q10 =
-			    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[-13],
-					a_Q12[13]);
-			LPC_pred_Q10 =
-			    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[-14],
-					a_Q12[14]);
-			LPC_pred_Q10 =
-			    silk_SMLAWB(LPC_pred_Q10, psLPC_Q14[-15],
-					a_Q12[15]);
-		}
+		    silk_noise_shape_quantizer_short_prediction(psLPC_Q14,
+								a_Q12,
+								predictLPCOrder,
+								arch);
 
 		/* Long-term prediction */
 		if (signalType == TYPE_VOICED) {
@@ -0,0 +1,101 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef SILK_NSQ_H
+#define SILK_NSQ_H
+
+#include <assert.h>
+
+#include "SigProc_FIX.h"
+#include "cpu_support.h"
+
+/* Short-term prediction of the noise shaping quantizers.  The taps run
+   backwards from buf32[0].  Each silk_SMLAWB() term is an exact
+   (b * c) >> 16, so the vector versions may sum the terms in any order
+   and still match this one bit for bit. */
+static inline int32_t silk_noise_shape_quantizer_short_prediction_c(const
+								     int32_t *
+								     buf32,
+								     const
+								     int16_t *
+								     coef16,
+								     int order)
+{
+	int32_t out;
+	assert(order == 10 || order == 16);
+
+	/* Avoids introducing a bias because silk_SMLAWB() always rounds to -inf */
+	out = silk_RSHIFT(order, 1);
+	out = silk_SMLAWB(out, buf32[0], coef16[0]);
+	out = silk_SMLAWB(out, buf32[-1], coef16[1]);
+	out = silk_SMLAWB(out, buf32[-2], coef16[2]);
+	out = silk_SMLAWB(out, buf32[-3], coef16[3]);
+	out = silk_SMLAWB(out, buf32[-4], coef16[4]);
+	out = silk_SMLAWB(out, buf32[-5], coef16[5]);
+	out = silk_SMLAWB(out, buf32[-6], coef16[6]);
+	out = silk_SMLAWB(out, buf32[-7], coef16[7]);
+	out = silk_SMLAWB(out, buf32[-8], coef16[8]);
+	out = silk_SMLAWB(out, buf32[-9], coef16[9]);
+	if (order == 16) {
+		out = silk_SMLAWB(out, buf32[-10], coef16[10]);
+		out = silk_SMLAWB(out, buf32[-11], coef16[11]);
+		out = silk_SMLAWB(out, buf32[-12], coef16[12]);
+		out = silk_SMLAWB(out, buf32[-13], coef16[13]);
+		out = silk_SMLAWB(out, buf32[-14], coef16[14]);
+		out = silk_SMLAWB(out, buf32[-15], coef16[15]);
+	}
+	return out;
+}
+
+#if defined(OPUS_HAVE_RTCD) && \
+  (defined(OPUS_X86_MAY_HAVE_SSE4_1) || defined(OPUS_ARM_MAY_HAVE_NEON_INTR))
+
+#if defined(OPUS_X86_MAY_HAVE_SSE4_1)
+int32_t silk_noise_shape_quantizer_short_prediction_sse4_1(const int32_t *
+							   buf32,
+							   const int16_t *
+							   coef16, int order);
+#endif
+
+#if defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+int32_t silk_noise_shape_quantizer_short_prediction_neon(const int32_t *
+							 buf32,
+							 const int16_t *
+							 coef16, int order);
+#endif
+
+extern int32_t(*const SILK_NSQ_SHORT_PREDICTION_IMPL[OPUS_ARCHMASK + 1])
+ (const int32_t *, const int16_t *, int);
+
+#define silk_noise_shape_quantizer_short_prediction(in, coef, order, arch) \
+  ((*SILK_NSQ_SHORT_PREDICTION_IMPL[(arch)&OPUS_ARCHMASK])(in, coef, order))
+#else
+#define silk_noise_shape_quantizer_short_prediction(in, coef, order, arch) \
+  ((void)(arch),silk_noise_shape_quantizer_short_prediction_c(in, coef, order))
+#endif
+
+#endif
@@ -32,6 +32,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #endif
 
 #include "main.h"
+#include "NSQ.h"
 #include <ophtools.h>
 
 typedef struct {
@@ -103,7 +104,8 @@ static inline void silk_noise_shape_quantizer_del_dec(silk_nsq_state * NSQ,	/* I
 						      int warping_Q16,	/* I                                        */
 						      int nStatesDelayedDecision,	/* I    Number of states in decision tree   */
 						      int * smpl_buf_idx,	/* I    Index to newest samples in buffers  */
-						      int decisionDelay	/* I                                        */
+						      int decisionDelay,	/* I                                        */
+						      int arch	/* I    Run-time architecture               */
     );
 
 void silk_NSQ_del_dec(const silk_encoder_state * psEncC,	/* I/O  Encoder State                   */
@@ -329,7 +331,8 @@ void silk_NSQ_del_dec(const silk_encoder_state * psEncC,	/* I/O  Encoder State
 						   psEncC->
 						   nStatesDelayedDecision,
 						   &smpl_buf_idx,
-						   decisionDelay);
+						   decisionDelay,
+						   psEncC->arch);
 
 		x_Q3 += psEncC->subfr_length;
 		pulses += psEncC->subfr_length;
@@ -410,7 +413,8 @@ static inline void silk_noise_shape_quantizer_del_dec(silk_nsq_state * NSQ,	/* I
 						      int warping_Q16,	/* I                                        */
 						      int nStatesDelayedDecision,	/* I    Number of states in decision tree   */
 						      int * smpl_buf_idx,	/* I    Index to newest samples in buffers  */
-						      int decisionDelay	/* I                                        */
+						      int decisionDelay,	/* I                                        */
+						      int arch	/* I    Run-time architecture               */
     )
 {
 	int i, j, k, Winner_ind, RDmin_ind, RDmax_ind, last_smple_idx;
@@ -495,50 +499,11 @@ static inline void silk_noise_shape_quantizer_del_dec(silk_nsq_state * NSQ,	/* I
 			/* Pointer used in short term prediction and shaping */
 			psLPC_Q14 = &psDD->sLPC_Q14[NSQ_LPC_BUF_LENGTH - 1 + i];
 			/* Short-term prediction */
-			assert(predictLPCOrder == 10
-				    || predictLPCOrder == 16);
-			/* Avoids introducing a bias because silk_SMLAWB() always rounds to -inf */
-			LPC_pred_Q14 = silk_RSHIFT(predictLPCOrder, 1);
-			LPC_pred_Q14 =
-			    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[0], a_Q12[0]);
-			LPC_pred_Q14 =
-			    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[-1], a_Q12[1]);
-			LPC_pred_Q14 =
-			    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[-2], a_Q12[2]);
-			LPC_pred_Q14 =
-			    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[-3], a_Q12[3]);
-			LPC_pred_Q14 =
-			    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[-4], a_Q12[4]);
 			LPC_pred_Q14 =
-			    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[-5], a_Q12[5]);
-			LPC_pred_Q14 =
-			    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[-6], a_Q12[6]);
-			LPC_pred_Q14 =
-			    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[-7], a_Q12[7]);
-			LPC_pred_Q14 =
-			    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[-8], a_Q12[8]);
-			LPC_pred_Q14 =
-			    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[-9], a_Q12[9]);
-			if (predictLPCOrder == 16) {
-				LPC_pred_Q14 =
-				    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[-10],
-						a_Q12[10]);
-				LPC_pred_Q14 =
-				    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[-11],
-						a_Q12[11]);
-				LPC_pred_Q14 =
-				    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[-12],
-						a_Q12[12]);
-				LPC_pred_Q14 =
-				    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[-13],
-						a_Q12[13]);
-				LPC_pred_Q14 =
-				    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[-14],
-						a_Q12[14]);
-				LPC_pred_Q14 =
-				    silk_SMLAWB(LPC_pred_Q14, psLPC_Q14[-15],
-						a_Q12[15]);
-			}
+			    silk_noise_shape_quantizer_short_prediction(psLPC_Q14,
+									a_Q12,
+									predictLPCOrder,
+									arch);
 			LPC_pred_Q14 = silk_LSHIFT(LPC_pred_Q14, 4);	/* Q10 -> Q14 */
 
 			/* Noise shape feedback */
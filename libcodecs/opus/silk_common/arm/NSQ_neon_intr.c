@@ -0,0 +1,69 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <arm_neon.h>
+
+#include "main.h"
+#include "NSQ.h"
+
+#if defined(OPUS_ARM_MAY_HAVE_NEON_INTR)
+
+/* vmull gives the full 64-bit b * c; narrowing it after a 16-bit shift
+   keeps exactly silk_SMULWB(b, c). */
+int32_t silk_noise_shape_quantizer_short_prediction_neon(const int32_t *
+							 buf32,
+							 const int16_t *
+							 coef16, int order)
+{
+	int32x2_t acc = vdup_n_s32(0);
+	int32_t out;
+	int j;
+	assert(order == 10 || order == 16);
+
+	for (j = 0; j < order - 3; j += 4) {
+		/* buf32[-j-3..-j] in memory order pairs with coef16[j+3..j] */
+		int32x4_t b = vld1q_s32(&buf32[-j - 3]);
+		int32x4_t c = vmovl_s16(vrev64_s16(vld1_s16(&coef16[j])));
+		int64x2_t lo = vmull_s32(vget_low_s32(b), vget_low_s32(c));
+		int64x2_t hi = vmull_s32(vget_high_s32(b), vget_high_s32(c));
+		acc = vadd_s32(acc, vadd_s32(vshrn_n_s64(lo, 16),
+					     vshrn_n_s64(hi, 16)));
+	}
+
+	/* Avoids introducing a bias because silk_SMLAWB() always rounds to -inf */
+	out = silk_RSHIFT(order, 1);
+	out += vget_lane_s32(acc, 0) + vget_lane_s32(acc, 1);
+	for (; j < order; j++)
+		out = silk_SMLAWB(out, buf32[-j], coef16[j]);
+	return out;
+}
+
+#endif
@@ -0,0 +1,77 @@
+/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
+
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <smmintrin.h>
+
+#include "main.h"
+#include "NSQ.h"
+
+#if defined(OPUS_X86_MAY_HAVE_SSE4_1)
+
+/* pmuldq gives the full 64-bit b * c of the even lanes; bits 16..47 of
+   it are exactly silk_SMULWB(b, c), which the logical 64-bit shift
+   leaves in the low half of each lane. */
+int32_t silk_noise_shape_quantizer_short_prediction_sse4_1(const int32_t *
+							   buf32,
+							   const int16_t *
+							   coef16, int order)
+{
+	__m128i acc = _mm_setzero_si128();
+	int32_t out;
+	int j;
+	assert(order == 10 || order == 16);
+
+	for (j = 0; j < order - 3; j += 4) {
+		/* buf32[-j-3..-j] reversed, so lane k pairs with coef16[j+k] */
+		__m128i b =
+		    _mm_shuffle_epi32(_mm_loadu_si128
+				      ((const __m128i *)&buf32[-j - 3]),
+				      _MM_SHUFFLE(0, 1, 2, 3));
+		__m128i c =
+		    _mm_cvtepi16_epi32(_mm_loadl_epi64
+				       ((const __m128i *)&coef16[j]));
+		__m128i p0 = _mm_mul_epi32(b, c);
+		__m128i p1 = _mm_mul_epi32(_mm_srli_epi64(b, 32),
+					   _mm_srli_epi64(c, 32));
+		acc = _mm_add_epi32(acc,
+				    _mm_add_epi32(_mm_srli_epi64(p0, 16),
+						  _mm_srli_epi64(p1, 16)));
+	}
+
+	/* Avoids introducing a bias because silk_SMLAWB() always rounds to -inf */
+	out = silk_RSHIFT(order, 1);
+	out += _mm_cvtsi128_si32(acc) + _mm_extract_epi32(acc, 2);
+	for (; j < order; j++)
+		out = silk_SMLAWB(out, buf32[-j], coef16[j]);
+	return out;
+}
+
+#endif
@@ -1,69 +0,0 @@
-/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
-
-/***********************************************************************
-Copyright (c) 2006-2010, Skype Limited. All rights reserved. 
-Redistribution and use in source and binary forms, with or without 
-modification, (subject to the limitations in the disclaimer below) 
-are permitted provided that the following conditions are met:
-- Redistributions of source code must retain the above copyright notice,
-this list of conditions and the following disclaimer.
-- Redistributions in binary form must reproduce the above copyright 
-notice, this list of conditions and the following disclaimer in the 
-documentation and/or other materials provided with the distribution.
-- Neither the name of Skype Limited, nor the names of specific 
-contributors, may be used to endorse or promote products derived from 
-this software without specific prior written permission.
-NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED 
-BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
-CONTRIBUTORS ''AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
-BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
-FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
-COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, 
-INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
-NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF 
-USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
-ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
-(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
-OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-***********************************************************************/
-
-/*                                                                      *
- * SKP_Silk_log2lin.c                                                 *
- *                                                                      *
- * Convert input to a linear scale                                      *
- *                                                                      *
- * Copyright 2006 (c), Skype Limited                                    *
- * Date: 060221                                                         *
- *                                                                      */
-#include "SKP_Silk_SigProc_FIX.h"
-
-/* Approximation of 2^() (very close inverse of SKP_Silk_lin2log()) */
-/* Convert input to a linear scale    */
-int32_t SKP_Silk_log2lin(const int32_t inLog_Q7)
-{				/* I:    Input on log scale */
-	int32_t out, frac_Q7;
-
-	if (inLog_Q7 < 0) {
-		return 0;
-	}
-
-	out = SKP_LSHIFT(1, SKP_RSHIFT(inLog_Q7, 7));
-	frac_Q7 = inLog_Q7 & 0x7F;
-	if (inLog_Q7 < 2048) {
-		/* Piece-wise parabolic approximation */
-		out =
-		    SKP_ADD_RSHIFT(out,
-				   SKP_MUL(out,
-					   SKP_SMLAWB(frac_Q7,
-						      SKP_MUL(frac_Q7,
-							      128 - frac_Q7),
-						      -174)), 7);
-	} else {
-		/* Piece-wise parabolic approximation */
-		out =
-		    SKP_MLA(out, SKP_RSHIFT(out, 7),
-			    SKP_SMLAWB(frac_Q7, SKP_MUL(frac_Q7, 128 - frac_Q7),
-				       -174));
-	}
-	return out;
-}
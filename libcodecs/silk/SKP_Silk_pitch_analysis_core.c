@@ -1,843 +0,0 @@
-/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
-
-/***********************************************************************
-Copyright (c) 2006-2010, Skype Limited. All rights reserved. 
-Redistribution and use in source and binary forms, with or without 
-modification, (subject to the limitations in the disclaimer below) 
-are permitted provided that the following conditions are met:
-- Redistributions of source code must retain the above copyright notice,
-this list of conditions and the following disclaimer.
-- Redistributions in binary form must reproduce the above copyright 
-notice, this list of conditions and the following disclaimer in the 
-documentation and/or other materials provided with the distribution.
-- Neither the name of Skype Limited, nor the names of specific 
-contributors, may be used to endorse or promote products derived from 
-this software without specific prior written permission.
-NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED 
-BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
-CONTRIBUTORS ''AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
-BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
-FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
-COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, 
-INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
-NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF 
-USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
-ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
-(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
-OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-***********************************************************************/
-
-/***********************************************************
-* Pitch analyser function
-********************************************************** */
-#include "SKP_Silk_SigProc_FIX.h"
-#include "SKP_Silk_pitch_est_defines.h"
-#include "SKP_Silk_resample_rom.h"
-
-#define SCRATCH_SIZE    22
-
-/************************************************************/
-/* Internally used functions                                */
-/************************************************************/
-void SKP_FIX_P_Ana_calc_corr_st3(int32_t cross_corr_st3[PITCH_EST_NB_SUBFR][PITCH_EST_NB_CBKS_STAGE3_MAX][PITCH_EST_NB_STAGE3_LAGS],	/* (O) 3 DIM correlation array */
-				 const int16_t signal[],	/* I vector to correlate         */
-				 int start_lag,	/* I lag offset to search around */
-				 int sf_length,	/* I length of a 5 ms subframe   */
-				 int complexity	/* I Complexity setting          */
-    );
-
-void SKP_FIX_P_Ana_calc_energy_st3(int32_t energies_st3[PITCH_EST_NB_SUBFR][PITCH_EST_NB_CBKS_STAGE3_MAX][PITCH_EST_NB_STAGE3_LAGS],	/* (O) 3 DIM energy array */
-				   const int16_t signal[],	/* I vector to calc energy in    */
-				   int start_lag,	/* I lag offset to search around */
-				   int sf_length,	/* I length of one 5 ms subframe */
-				   int complexity	/* I Complexity setting          */
-    );
-
-int32_t SKP_FIX_P_Ana_find_scaling(const int16_t * signal,
-				   const int signal_length,
-				   const int sum_sqr_len);
-
-void SKP_Silk_decode_pitch(int lagIndex,	/* I                             */
-			   int contourIndex,	/* O                             */
-			   int pitch_lags[],	/* O 4 pitch values              */
-			   int Fs_kHz	/* I sampling frequency (kHz)    */
-    )
-{
-	int lag, i, min_lag;
-
-	min_lag = SKP_SMULBB(PITCH_EST_MIN_LAG_MS, Fs_kHz);
-
-	/* Only for 24 / 16 kHz version for now */
-	lag = min_lag + lagIndex;
-	if (Fs_kHz == 8) {
-		/* Only a small codebook for 8 khz */
-		for (i = 0; i < PITCH_EST_NB_SUBFR; i++) {
-			pitch_lags[i] =
-			    lag + SKP_Silk_CB_lags_stage2[i][contourIndex];
-		}
-	} else {
-		for (i = 0; i < PITCH_EST_NB_SUBFR; i++) {
-			pitch_lags[i] =
-			    lag + SKP_Silk_CB_lags_stage3[i][contourIndex];
-		}
-	}
-}
-
-/*************************************************************/
-/*      FIXED POINT CORE PITCH ANALYSIS FUNCTION             */
-/*************************************************************/
-int SKP_Silk_pitch_analysis_core(	/* O    Voicing estimate: 0 voiced, 1 unvoiced                      */
-					const int16_t * signal,	/* I    Signal of length PITCH_EST_FRAME_LENGTH_MS*Fs_kHz           */
-					int *pitch_out,	/* O    4 pitch lag values                                          */
-					int *lagIndex,	/* O    Lag Index                                                   */
-					int *contourIndex,	/* O    Pitch contour Index                                         */
-					int *LTPCorr_Q15,	/* I/O  Normalized correlation; input: value from previous frame    */
-					int prevLag,	/* I    Last lag of previous frame; set to zero is unvoiced         */
-					const int32_t search_thres1_Q16,	/* I    First stage threshold for lag candidates 0 - 1              */
-					const int search_thres2_Q15,	/* I    Final threshold for lag candidates 0 - 1                    */
-					const int Fs_kHz,	/* I    Sample frequency (kHz)                                      */
-					const int complexity	/* I    Complexity setting, 0-2, where 2 is highest                 */
-    ) {
-	int16_t signal_8kHz[PITCH_EST_MAX_FRAME_LENGTH_ST_2];
-	int16_t signal_4kHz[PITCH_EST_MAX_FRAME_LENGTH_ST_1];
-	int32_t scratch_mem[3 * PITCH_EST_MAX_FRAME_LENGTH];
-	int16_t *input_signal_ptr;
-	int32_t filt_state[PITCH_EST_MAX_DECIMATE_STATE_LENGTH];
-	int i, k, d, j;
-	int16_t C[PITCH_EST_NB_SUBFR][(PITCH_EST_MAX_LAG >> 1) + 5];
-	const int16_t *target_ptr, *basis_ptr;
-	int32_t cross_corr, normalizer, energy, shift, energy_basis,
-	    energy_target;
-	int d_srch[PITCH_EST_D_SRCH_LENGTH];
-	int16_t d_comp[(PITCH_EST_MAX_LAG >> 1) + 5];
-	int Cmax, length_d_srch, length_d_comp;
-	int32_t sum, threshold, temp32;
-	int CBimax, CBimax_new, CBimax_old, lag, start_lag, end_lag, lag_new;
-	int32_t CC[PITCH_EST_NB_CBKS_STAGE2_EXT], CCmax, CCmax_b, CCmax_new_b,
-	    CCmax_new;
-	int32_t
-	    energies_st3[PITCH_EST_NB_SUBFR][PITCH_EST_NB_CBKS_STAGE3_MAX]
-	    [PITCH_EST_NB_STAGE3_LAGS];
-	int32_t
-	    crosscorr_st3[PITCH_EST_NB_SUBFR][PITCH_EST_NB_CBKS_STAGE3_MAX]
-	    [PITCH_EST_NB_STAGE3_LAGS];
-	int32_t lag_counter;
-	int frame_length, frame_length_8kHz, frame_length_4kHz,
-	    max_sum_sq_length;
-	int sf_length, sf_length_8kHz;
-	int min_lag, min_lag_8kHz, min_lag_4kHz;
-	int max_lag, max_lag_8kHz, max_lag_4kHz;
-	int32_t contour_bias, diff;
-	int32_t lz, lshift;
-	int cbk_offset, cbk_size, nb_cbks_stage2;
-	int32_t delta_lag_log2_sqr_Q7, lag_log2_Q7, prevLag_log2_Q7,
-	    prev_lag_bias_Q15, corr_thres_Q15;
-
-	/* Check for valid sampling frequency */
-	assert(Fs_kHz == 8 || Fs_kHz == 12 || Fs_kHz == 16 || Fs_kHz == 24);
-
-	/* Check for valid complexity setting */
-	assert(complexity >= SigProc_PITCH_EST_MIN_COMPLEX);
-	assert(complexity <= SigProc_PITCH_EST_MAX_COMPLEX);
-
-	assert(search_thres1_Q16 >= 0 && search_thres1_Q16 <= (1 << 16));
-	assert(search_thres2_Q15 >= 0 && search_thres2_Q15 <= (1 << 15));
-
-	/* Setup frame lengths max / min lag for the sampling frequency */
-	frame_length = PITCH_EST_FRAME_LENGTH_MS * Fs_kHz;
-	frame_length_4kHz = PITCH_EST_FRAME_LENGTH_MS * 4;
-	frame_length_8kHz = PITCH_EST_FRAME_LENGTH_MS * 8;
-	sf_length = SKP_RSHIFT(frame_length, 3);
-	sf_length_8kHz = SKP_RSHIFT(frame_length_8kHz, 3);
-	min_lag = PITCH_EST_MIN_LAG_MS * Fs_kHz;
-	min_lag_4kHz = PITCH_EST_MIN_LAG_MS * 4;
-	min_lag_8kHz = PITCH_EST_MIN_LAG_MS * 8;
-	max_lag = PITCH_EST_MAX_LAG_MS * Fs_kHz;
-	max_lag_4kHz = PITCH_EST_MAX_LAG_MS * 4;
-	max_lag_8kHz = PITCH_EST_MAX_LAG_MS * 8;
-
-	SKP_memset(C, 0,
-		   sizeof(int16_t) * PITCH_EST_NB_SUBFR *
-		   ((PITCH_EST_MAX_LAG >> 1) + 5));
-
-	/* Resample from input sampled at Fs_kHz to 8 kHz */
-	if (Fs_kHz == 12) {
-		int16_t R23[SigProc_Resample_2_3_coarsest_NUM_FIR_COEFS - 1];
-		SKP_memset(R23, 0,
-			   (SigProc_Resample_2_3_coarsest_NUM_FIR_COEFS -
-			    1) * sizeof(int16_t));
-
-		SKP_Silk_resample_2_3_coarsest(signal_8kHz, R23, signal,
-					       PITCH_EST_FRAME_LENGTH_MS * 12,
-					       (int16_t *) scratch_mem);
-	} else if (Fs_kHz == 16) {
-		if (complexity == SigProc_PITCH_EST_MAX_COMPLEX) {
-			assert(4 <= PITCH_EST_MAX_DECIMATE_STATE_LENGTH);
-			SKP_memset(filt_state, 0, 4 * sizeof(int32_t));
-
-			SKP_Silk_resample_1_2_coarse(signal, filt_state,
-						     signal_8kHz, scratch_mem,
-						     frame_length_8kHz);
-		} else {
-			assert(2 <= PITCH_EST_MAX_DECIMATE_STATE_LENGTH);
-			SKP_memset(filt_state, 0, 2 * sizeof(int32_t));
-
-			SKP_Silk_resample_1_2_coarsest(signal, filt_state,
-						       signal_8kHz, scratch_mem,
-						       frame_length_8kHz);
-		}
-	} else if (Fs_kHz == 24) {
-		/* Resample to 24 -> 8 khz */
-		assert(7 <= PITCH_EST_MAX_DECIMATE_STATE_LENGTH);
-		SKP_memset(filt_state, 0, 7 * sizeof(int32_t));
-
-		SKP_Silk_resample_1_3(signal_8kHz, filt_state, signal,
-				      24 * PITCH_EST_FRAME_LENGTH_MS);
-
-	} else {
-		assert(Fs_kHz == 8);
-		SKP_memcpy(signal_8kHz, signal,
-			   frame_length_8kHz * sizeof(int16_t));
-	}
-
-	/* Decimate again to 4 kHz. Set mem to zero */
-	if (complexity == SigProc_PITCH_EST_MAX_COMPLEX) {
-		assert(4 <= PITCH_EST_MAX_DECIMATE_STATE_LENGTH);
-		SKP_memset(filt_state, 0, 4 * sizeof(int32_t));
-		SKP_Silk_resample_1_2_coarse(signal_8kHz, filt_state,
-					     signal_4kHz, scratch_mem,
-					     frame_length_4kHz);
-	} else {
-		assert(2 <= PITCH_EST_MAX_DECIMATE_STATE_LENGTH);
-		SKP_memset(filt_state, 0, 2 * sizeof(int32_t));
-		SKP_Silk_resample_1_2_coarsest(signal_8kHz, filt_state,
-					       signal_4kHz, scratch_mem,
-					       frame_length_4kHz);
-	}
-
-	/* Low-pass filter */
-	for (i = frame_length_4kHz - 1; i > 0; i--) {
-		signal_4kHz[i] =
-		    SKP_ADD_SAT16(signal_4kHz[i], signal_4kHz[i - 1]);
-	}
-
-    /*******************************************************************************
-    ** Scale 4 kHz signal down to prevent correlations measures from overflowing
-    ** find scaling as max scaling for each 8kHz(?) subframe
-    *******************************************************************************/
-
-	/* Inner product is calculated with different lengths, so scale for the worst case */
-	max_sum_sq_length =
-	    SKP_max_32(sf_length_8kHz, SKP_RSHIFT(frame_length_4kHz, 1));
-	shift =
-	    SKP_FIX_P_Ana_find_scaling(signal_4kHz, frame_length_4kHz,
-				       max_sum_sq_length);
-	if (shift > 0) {
-		for (i = 0; i < frame_length_4kHz; i++) {
-			signal_4kHz[i] = SKP_RSHIFT(signal_4kHz[i], shift);
-		}
-	}
-
-    /******************************************************************************
-    * FIRST STAGE, operating in 4 khz
-    ******************************************************************************/
-	target_ptr = &signal_4kHz[SKP_RSHIFT(frame_length_4kHz, 1)];
-	for (k = 0; k < 2; k++) {
-		/* Check that we are within range of the array */
-		assert(target_ptr >= signal_4kHz);
-		assert(target_ptr + sf_length_8kHz <=
-			   signal_4kHz + frame_length_4kHz);
-
-		basis_ptr = target_ptr - min_lag_4kHz;
-
-		/* Check that we are within range of the array */
-		assert(basis_ptr >= signal_4kHz);
-		assert(basis_ptr + sf_length_8kHz <=
-			   signal_4kHz + frame_length_4kHz);
-
-		/* Calculate first vector products before loop */
-		cross_corr =
-		    SKP_Silk_inner_prod_aligned(target_ptr, basis_ptr,
-						sf_length_8kHz);
-		normalizer =
-		    SKP_Silk_inner_prod_aligned(basis_ptr, basis_ptr,
-						sf_length_8kHz);
-		normalizer = SKP_ADD_SAT32(normalizer, 1000);
-
-		temp32 =
-		    SKP_DIV32(cross_corr, SKP_Silk_SQRT_APPROX(normalizer) + 1);
-		C[k][min_lag_4kHz] = (int16_t) SKP_SAT16(temp32);	/* Q0 */
-
-		/* From now on normalizer is computed recursively */
-		for (d = min_lag_4kHz + 1; d <= max_lag_4kHz; d++) {
-			basis_ptr--;
-
-			/* Check that we are within range of the array */
-			assert(basis_ptr >= signal_4kHz);
-			assert(basis_ptr + sf_length_8kHz <=
-				   signal_4kHz + frame_length_4kHz);
-
-			cross_corr =
-			    SKP_Silk_inner_prod_aligned(target_ptr, basis_ptr,
-							sf_length_8kHz);
-
-			/* Add contribution of new sample and remove contribution from oldest sample */
-			normalizer +=
-			    SKP_SMULBB(basis_ptr[0], basis_ptr[0]) -
-			    SKP_SMULBB(basis_ptr[sf_length_8kHz],
-				       basis_ptr[sf_length_8kHz]);
-
-			temp32 =
-			    SKP_DIV32(cross_corr,
-				      SKP_Silk_SQRT_APPROX(normalizer) + 1);
-			C[k][d] = (int16_t) SKP_SAT16(temp32);	/* Q0 */
-		}
-		/* Update target pointer */
-		target_ptr += sf_length_8kHz;
-	}
-
-	/* Combine two subframes into single correlation measure and apply short-lag bias */
-	for (i = max_lag_4kHz; i >= min_lag_4kHz; i--) {
-		sum = (int32_t) C[0][i] + (int32_t) C[1][i];	/* Q0 */
-		assert(SKP_RSHIFT(sum, 1) == SKP_SAT16(SKP_RSHIFT(sum, 1)));
-		sum = SKP_RSHIFT(sum, 1);	/* Q-1 */
-		assert(SKP_LSHIFT((int32_t) - i, 4) ==
-			   SKP_SAT16(SKP_LSHIFT((int32_t) - i, 4)));
-		sum = SKP_SMLAWB(sum, sum, SKP_LSHIFT(-i, 4));	/* Q-1 */
-		assert(sum == SKP_SAT16(sum));
-		C[0][i] = (int16_t) sum;	/* Q-1 */
-	}
-
-	/* Sort */
-	length_d_srch = 5 + complexity;
-	assert(length_d_srch <= PITCH_EST_D_SRCH_LENGTH);
-	SKP_Silk_insertion_sort_decreasing_int16(&C[0][min_lag_4kHz], d_srch,
-						 max_lag_4kHz - min_lag_4kHz +
-						 1, length_d_srch);
-
-	/* Escape if correlation is very low already here */
-	target_ptr = &signal_4kHz[SKP_RSHIFT(frame_length_4kHz, 1)];
-	energy =
-	    SKP_Silk_inner_prod_aligned(target_ptr, target_ptr,
-					SKP_RSHIFT(frame_length_4kHz, 1));
-	energy = SKP_ADD_SAT32(energy, 1000);	/* Q0 */
-	Cmax = (int)C[0][min_lag_4kHz];	/* Q-1 */
-	threshold = SKP_SMULBB(Cmax, Cmax);	/* Q-2 */
-	/* Compare in Q-2 domain */
-	if (SKP_RSHIFT(energy, 4 + 2) > threshold) {
-		SKP_memset(pitch_out, 0, PITCH_EST_NB_SUBFR * sizeof(int));
-		*LTPCorr_Q15 = 0;
-		*lagIndex = 0;
-		*contourIndex = 0;
-		return 1;
-	}
-
-	threshold = SKP_SMULWB(search_thres1_Q16, Cmax);
-	for (i = 0; i < length_d_srch; i++) {
-		/* Convert to 8 kHz indices for the sorted correlation that exceeds the threshold */
-		if (C[0][min_lag_4kHz + i] > threshold) {
-			d_srch[i] = SKP_LSHIFT(d_srch[i] + min_lag_4kHz, 1);
-		} else {
-			length_d_srch = i;
-			break;
-		}
-	}
-	assert(length_d_srch > 0);
-
-	for (i = min_lag_8kHz - 5; i < max_lag_8kHz + 5; i++) {
-		d_comp[i] = 0;
-	}
-	for (i = 0; i < length_d_srch; i++) {
-		d_comp[d_srch[i]] = 1;
-	}
-
-	/* Convolution */
-	for (i = max_lag_8kHz + 3; i >= min_lag_8kHz; i--) {
-		d_comp[i] += d_comp[i - 1] + d_comp[i - 2];
-	}
-
-	length_d_srch = 0;
-	for (i = min_lag_8kHz; i < max_lag_8kHz + 1; i++) {
-		if (d_comp[i + 1] > 0) {
-			d_srch[length_d_srch] = i;
-			length_d_srch++;
-		}
-	}
-
-	/* Convolution */
-	for (i = max_lag_8kHz + 3; i >= min_lag_8kHz; i--) {
-		d_comp[i] += d_comp[i - 1] + d_comp[i - 2] + d_comp[i - 3];
-	}
-
-	length_d_comp = 0;
-	for (i = min_lag_8kHz; i < max_lag_8kHz + 4; i++) {
-		if (d_comp[i] > 0) {
-			d_comp[length_d_comp] = i - 2;
-			length_d_comp++;
-		}
-	}
-
-    /**********************************************************************************
-    ** SECOND STAGE, operating at 8 kHz, on lag sections with high correlation
-    *************************************************************************************/
-
-    /******************************************************************************
-    ** Scale signal down to avoid correlations measures from overflowing
-    *******************************************************************************/
-	/* find scaling as max scaling for each subframe */
-	shift =
-	    SKP_FIX_P_Ana_find_scaling(signal_8kHz, frame_length_8kHz,
-				       sf_length_8kHz);
-	if (shift > 0) {
-		for (i = 0; i < frame_length_8kHz; i++) {
-			signal_8kHz[i] = SKP_RSHIFT(signal_8kHz[i], shift);
-		}
-	}
-
-    /********************************************************************************* 
-    * Find energy of each subframe projected onto its history, for a range of delays
-    *********************************************************************************/
-	SKP_memset(C, 0,
-		   PITCH_EST_NB_SUBFR * ((PITCH_EST_MAX_LAG >> 1) +
-					 5) * sizeof(int16_t));
-
-	target_ptr = &signal_8kHz[frame_length_4kHz];	/* point to middle of frame */
-	for (k = 0; k < PITCH_EST_NB_SUBFR; k++) {
-
-		/* Check that we are within range of the array */
-		assert(target_ptr >= signal_8kHz);
-		assert(target_ptr + sf_length_8kHz <=
-			   signal_8kHz + frame_length_8kHz);
-
-		energy_target =
-		    SKP_Silk_inner_prod_aligned(target_ptr, target_ptr,
-						sf_length_8kHz);
-		// ToDo: Calculate 1 / energy_target here and save one division inside next for loop
-		for (j = 0; j < length_d_comp; j++) {
-			d = d_comp[j];
-			basis_ptr = target_ptr - d;
-
-			/* Check that we are within range of the array */
-			assert(basis_ptr >= signal_8kHz);
-			assert(basis_ptr + sf_length_8kHz <=
-				   signal_8kHz + frame_length_8kHz);
-
-			cross_corr =
-			    SKP_Silk_inner_prod_aligned(target_ptr, basis_ptr,
-							sf_length_8kHz);
-			energy_basis =
-			    SKP_Silk_inner_prod_aligned(basis_ptr, basis_ptr,
-							sf_length_8kHz);
-			if (cross_corr > 0) {
-				energy = SKP_max(energy_target, energy_basis);	/* Find max to make sure first division < 1.0 */
-				lz = SKP_Silk_CLZ32(cross_corr);
-				lshift = SKP_LIMIT(lz - 1, 0, 15);
-				temp32 = SKP_DIV32(SKP_LSHIFT(cross_corr, lshift), SKP_RSHIFT(energy, 15 - lshift) + 1);	/* Q15 */
-				assert(temp32 == SKP_SAT16(temp32));
-				temp32 = SKP_SMULWB(cross_corr, temp32);	/* Q(-1), cc * ( cc / max(b, t) ) */
-				temp32 = SKP_ADD_SAT32(temp32, temp32);	/* Q(0) */
-				lz = SKP_Silk_CLZ32(temp32);
-				lshift = SKP_LIMIT(lz - 1, 0, 15);
-				energy = SKP_min(energy_target, energy_basis);
-				C[k][d] = SKP_DIV32(SKP_LSHIFT(temp32, lshift), SKP_RSHIFT(energy, 15 - lshift) + 1);	// Q15
-			} else {
-				C[k][d] = 0;
-			}
-		}
-		target_ptr += sf_length_8kHz;
-	}
-
-	/* search over lag range and lags codebook */
-	/* scale factor for lag codebook, as a function of center lag */
-
-	CCmax = int32_t_MIN;
-	CCmax_b = int32_t_MIN;
-
-	CBimax = 0;		/* To avoid returning undefined lag values */
-	lag = -1;		/* To check if lag with strong enough correlation has been found */
-
-	if (prevLag > 0) {
-		if (Fs_kHz == 12) {
-			prevLag = SKP_DIV32_16(SKP_LSHIFT(prevLag, 1), 3);
-		} else if (Fs_kHz == 16) {
-			prevLag = SKP_RSHIFT(prevLag, 1);
-		} else if (Fs_kHz == 24) {
-			prevLag = SKP_DIV32_16(prevLag, 3);
-		}
-		prevLag_log2_Q7 = SKP_Silk_lin2log((int32_t) prevLag);
-	} else {
-		prevLag_log2_Q7 = 0;
-	}
-	assert(search_thres2_Q15 == SKP_SAT16(search_thres2_Q15));
-	corr_thres_Q15 =
-	    SKP_RSHIFT(SKP_SMULBB(search_thres2_Q15, search_thres2_Q15), 13);
-
-	/* If input is 8 khz use a larger codebook here because it is last stage */
-	if (Fs_kHz == 8 && complexity > SigProc_PITCH_EST_MIN_COMPLEX) {
-		nb_cbks_stage2 = PITCH_EST_NB_CBKS_STAGE2_EXT;
-	} else {
-		nb_cbks_stage2 = PITCH_EST_NB_CBKS_STAGE2;
-	}
-
-	for (k = 0; k < length_d_srch; k++) {
-		d = d_srch[k];
-		for (j = 0; j < nb_cbks_stage2; j++) {
-			CC[j] = 0;
-			for (i = 0; i < PITCH_EST_NB_SUBFR; i++) {
-				/* Try all codebooks */
-				CC[j] =
-				    CC[j] + (int32_t) C[i][d +
-							   SKP_Silk_CB_lags_stage2
-							   [i][j]];
-			}
-		}
-		/* Find best codebook */
-		CCmax_new = int32_t_MIN;
-		CBimax_new = 0;
-		for (i = 0; i < nb_cbks_stage2; i++) {
-			if (CC[i] > CCmax_new) {
-				CCmax_new = CC[i];
-				CBimax_new = i;
-			}
-		}
-
-		/* Bias towards shorter lags */
-		lag_log2_Q7 = SKP_Silk_lin2log((int32_t) d);	/* Q7 */
-		assert(lag_log2_Q7 == SKP_SAT16(lag_log2_Q7));
-		assert(PITCH_EST_NB_SUBFR * PITCH_EST_SHORTLAG_BIAS_Q15 ==
-			   SKP_SAT16(PITCH_EST_NB_SUBFR *
-				     PITCH_EST_SHORTLAG_BIAS_Q15));
-		CCmax_new_b = CCmax_new - SKP_RSHIFT(SKP_SMULBB(PITCH_EST_NB_SUBFR * PITCH_EST_SHORTLAG_BIAS_Q15, lag_log2_Q7), 7);	/* Q15 */
-
-		/* Bias towards previous lag */
-		assert(PITCH_EST_NB_SUBFR * PITCH_EST_PREVLAG_BIAS_Q15 ==
-			   SKP_SAT16(PITCH_EST_NB_SUBFR *
-				     PITCH_EST_PREVLAG_BIAS_Q15));
-		if (prevLag > 0) {
-			delta_lag_log2_sqr_Q7 = lag_log2_Q7 - prevLag_log2_Q7;
-			assert(delta_lag_log2_sqr_Q7 ==
-				   SKP_SAT16(delta_lag_log2_sqr_Q7));
-			delta_lag_log2_sqr_Q7 =
-			    SKP_RSHIFT(SKP_SMULBB
-				       (delta_lag_log2_sqr_Q7,
-					delta_lag_log2_sqr_Q7), 7);
-			prev_lag_bias_Q15 = SKP_RSHIFT(SKP_SMULBB(PITCH_EST_NB_SUBFR * PITCH_EST_PREVLAG_BIAS_Q15, (*LTPCorr_Q15)), 15);	/* Q15 */
-			prev_lag_bias_Q15 =
-			    SKP_DIV32(SKP_MUL
-				      (prev_lag_bias_Q15,
-				       delta_lag_log2_sqr_Q7),
-				      delta_lag_log2_sqr_Q7 + (1 << 6));
-			CCmax_new_b -= prev_lag_bias_Q15;	/* Q15 */
-		}
-
-		if (CCmax_new_b > CCmax_b && CCmax_new > corr_thres_Q15) {
-			CCmax_b = CCmax_new_b;
-			CCmax = CCmax_new;
-			lag = d;
-			CBimax = CBimax_new;
-		}
-	}
-
-	if (lag == -1) {
-		/* No suitable candidate found */
-		SKP_memset(pitch_out, 0, PITCH_EST_NB_SUBFR * sizeof(int));
-		*LTPCorr_Q15 = 0;
-		*lagIndex = 0;
-		*contourIndex = 0;
-		return 1;
-	}
-
-	if (Fs_kHz > 8) {
-
-	/******************************************************************************
-        ** Scale input signal down to avoid correlations measures from overflowing
-        *******************************************************************************/
-		/* find scaling as max scaling for each subframe */
-		shift =
-		    SKP_FIX_P_Ana_find_scaling(signal, frame_length, sf_length);
-		if (shift > 0) {
-			/* Move signal to scratch mem because the input signal should be unchanged */
-			/* Reuse the 32 bit scratch mem vector, use a 16 bit pointer from now */
-			input_signal_ptr = (int16_t *) scratch_mem;
-			for (i = 0; i < frame_length; i++) {
-				input_signal_ptr[i] =
-				    SKP_RSHIFT(signal[i], shift);
-			}
-		} else {
-			input_signal_ptr = (int16_t *) signal;
-		}
-	/*********************************************************************************/
-
-		/* Search in original signal */
-
-		CBimax_old = CBimax;
-		/* Compensate for decimation */
-		assert(lag == SKP_SAT16(lag));
-		if (Fs_kHz == 12) {
-			lag = SKP_RSHIFT(SKP_SMULBB(lag, 3), 1);
-		} else if (Fs_kHz == 16) {
-			lag = SKP_LSHIFT(lag, 1);
-		} else {
-			lag = SKP_SMULBB(lag, 3);
-		}
-
-		lag = SKP_LIMIT(lag, min_lag, max_lag);
-		start_lag = SKP_max_int(lag - 2, min_lag);
-		end_lag = SKP_min_int(lag + 2, max_lag);
-		lag_new = lag;	/* to avoid undefined lag */
-		CBimax = 0;	/* to avoid undefined lag */
-		assert(SKP_LSHIFT(CCmax, 13) >= 0);
-		*LTPCorr_Q15 = (int)SKP_Silk_SQRT_APPROX(SKP_LSHIFT(CCmax, 13));	/* Output normalized correlation */
-
-		CCmax = int32_t_MIN;
-		/* pitch lags according to second stage */
-		for (k = 0; k < PITCH_EST_NB_SUBFR; k++) {
-			pitch_out[k] =
-			    lag + 2 * SKP_Silk_CB_lags_stage2[k][CBimax_old];
-		}
-		/* Calculate the correlations and energies needed in stage 3 */
-		SKP_FIX_P_Ana_calc_corr_st3(crosscorr_st3, input_signal_ptr,
-					    start_lag, sf_length, complexity);
-		SKP_FIX_P_Ana_calc_energy_st3(energies_st3, input_signal_ptr,
-					      start_lag, sf_length, complexity);
-
-		lag_counter = 0;
-		assert(lag == SKP_SAT16(lag));
-		contour_bias =
-		    SKP_DIV32_16(PITCH_EST_FLATCONTOUR_BIAS_Q20, lag);
-
-		/* Setup cbk parameters acording to complexity setting */
-		cbk_size = (int)SKP_Silk_cbk_sizes_stage3[complexity];
-		cbk_offset = (int)SKP_Silk_cbk_offsets_stage3[complexity];
-
-		for (d = start_lag; d <= end_lag; d++) {
-			for (j = cbk_offset; j < (cbk_offset + cbk_size); j++) {
-				cross_corr = 0;
-				energy = 0;
-				for (k = 0; k < PITCH_EST_NB_SUBFR; k++) {
-					assert(PITCH_EST_NB_SUBFR == 4);
-					energy += SKP_RSHIFT(energies_st3[k][j][lag_counter], 2);	/* use mean, to avoid overflow */
-					assert(energy >= 0);
-					cross_corr += SKP_RSHIFT(crosscorr_st3[k][j][lag_counter], 2);	/* use mean, to avoid overflow */
-				}
-				if (cross_corr > 0) {
-					/* Divide cross_corr / energy and get result in Q15 */
-					lz = SKP_Silk_CLZ32(cross_corr);
-					/* Divide with result in Q13, cross_corr could be larger than energy */
-					lshift = SKP_LIMIT(lz - 1, 0, 13);
-					CCmax_new =
-					    SKP_DIV32(SKP_LSHIFT
-						      (cross_corr, lshift),
-						      SKP_RSHIFT(energy,
-								 13 - lshift) +
-						      1);
-					CCmax_new = SKP_SAT16(CCmax_new);
-					CCmax_new =
-					    SKP_SMULWB(cross_corr, CCmax_new);
-					/* Saturate */
-					if (CCmax_new >
-					    SKP_RSHIFT(int32_t_MAX, 3)) {
-						CCmax_new = int32_t_MAX;
-					} else {
-						CCmax_new =
-						    SKP_LSHIFT(CCmax_new, 3);
-					}
-					/* Reduce depending on flatness of contour */
-					diff =
-					    j -
-					    SKP_RSHIFT
-					    (PITCH_EST_NB_CBKS_STAGE3_MAX, 1);
-					diff = SKP_MUL(diff, diff);
-					diff = int16_t_MAX - SKP_RSHIFT(SKP_MUL(contour_bias, diff), 5);	/* Q20 -> Q15 */
-					assert(diff == SKP_SAT16(diff));
-					CCmax_new =
-					    SKP_LSHIFT(SKP_SMULWB
-						       (CCmax_new, diff), 1);
-				} else {
-					CCmax_new = 0;
-				}
-
-				if (CCmax_new > CCmax) {
-					CCmax = CCmax_new;
-					lag_new = d;
-					CBimax = j;
-				}
-			}
-			lag_counter++;
-		}
-
-		for (k = 0; k < PITCH_EST_NB_SUBFR; k++) {
-			pitch_out[k] =
-			    lag_new + SKP_Silk_CB_lags_stage3[k][CBimax];
-		}
-		*lagIndex = lag_new - min_lag;
-		*contourIndex = CBimax;
-	} else {
-		/* Save Lags and correlation */
-		CCmax = SKP_max(CCmax, 0);
-		*LTPCorr_Q15 = (int)SKP_Silk_SQRT_APPROX(SKP_LSHIFT(CCmax, 13));	/* Output normalized correlation */
-		for (k = 0; k < PITCH_EST_NB_SUBFR; k++) {
-			pitch_out[k] = lag + SKP_Silk_CB_lags_stage2[k][CBimax];
-		}
-		*lagIndex = lag - min_lag_8kHz;
-		*contourIndex = CBimax;
-	}
-	assert(*lagIndex >= 0);
-	/* return as voiced */
-	return 0;
-}
-
-/*************************************************************************/
-/* Calculates the correlations used in stage 3 search. In order to cover */
-/* the whole lag codebook for all the searched offset lags (lag +- 2),   */
-/*************************************************************************/
-void SKP_FIX_P_Ana_calc_corr_st3(int32_t cross_corr_st3[PITCH_EST_NB_SUBFR][PITCH_EST_NB_CBKS_STAGE3_MAX][PITCH_EST_NB_STAGE3_LAGS],	/* (O) 3 DIM correlation array */
-				 const int16_t signal[],	/* I vector to correlate         */
-				 int start_lag,	/* I lag offset to search around */
-				 int sf_length,	/* I length of a 5 ms subframe   */
-				 int complexity	/* I Complexity setting          */
-    )
-{
-	const int16_t *target_ptr, *basis_ptr;
-	int32_t cross_corr;
-	int i, j, k, lag_counter;
-	int cbk_offset, cbk_size, delta, idx;
-	int32_t scratch_mem[SCRATCH_SIZE];
-
-	assert(complexity >= SigProc_PITCH_EST_MIN_COMPLEX);
-	assert(complexity <= SigProc_PITCH_EST_MAX_COMPLEX);
-
-	cbk_offset = SKP_Silk_cbk_offsets_stage3[complexity];
-	cbk_size = SKP_Silk_cbk_sizes_stage3[complexity];
-
-	target_ptr = &signal[SKP_LSHIFT(sf_length, 2)];	/* Pointer to middle of frame */
-	for (k = 0; k < PITCH_EST_NB_SUBFR; k++) {
-		lag_counter = 0;
-
-		/* Calculate the correlations for each subframe */
-		for (j = SKP_Silk_Lag_range_stage3[complexity][k][0];
-		     j <= SKP_Silk_Lag_range_stage3[complexity][k][1]; j++) {
-			basis_ptr = target_ptr - (start_lag + j);
-			cross_corr =
-			    SKP_Silk_inner_prod_aligned((int16_t *) target_ptr,
-							(int16_t *) basis_ptr,
-							sf_length);
-			assert(lag_counter < SCRATCH_SIZE);
-			scratch_mem[lag_counter] = cross_corr;
-			lag_counter++;
-		}
-
-		delta = SKP_Silk_Lag_range_stage3[complexity][k][0];
-		for (i = cbk_offset; i < (cbk_offset + cbk_size); i++) {
-			/* Fill out the 3 dim array that stores the correlations for */
-			/* each code_book vector for each start lag */
-			idx = SKP_Silk_CB_lags_stage3[k][i] - delta;
-			for (j = 0; j < PITCH_EST_NB_STAGE3_LAGS; j++) {
-				assert(idx + j < SCRATCH_SIZE);
-				assert(idx + j < lag_counter);
-				cross_corr_st3[k][i][j] = scratch_mem[idx + j];
-			}
-		}
-		target_ptr += sf_length;
-	}
-}
-
-/********************************************************************/
-/* Calculate the energies for first two subframes. The energies are */
-/* calculated recursively.                                          */
-/********************************************************************/
-void SKP_FIX_P_Ana_calc_energy_st3(int32_t energies_st3[PITCH_EST_NB_SUBFR][PITCH_EST_NB_CBKS_STAGE3_MAX][PITCH_EST_NB_STAGE3_LAGS],	/* (O) 3 DIM energy array */
-				   const int16_t signal[],	/* I vector to calc energy in    */
-				   int start_lag,	/* I lag offset to search around */
-				   int sf_length,	/* I length of one 5 ms subframe */
-				   int complexity	/* I Complexity setting          */
-    )
-{
-	const int16_t *target_ptr, *basis_ptr;
-	int32_t energy;
-	int k, i, j, lag_counter;
-	int cbk_offset, cbk_size, delta, idx;
-	int32_t scratch_mem[SCRATCH_SIZE];
-
-	assert(complexity >= SigProc_PITCH_EST_MIN_COMPLEX);
-	assert(complexity <= SigProc_PITCH_EST_MAX_COMPLEX);
-
-	cbk_offset = SKP_Silk_cbk_offsets_stage3[complexity];
-	cbk_size = SKP_Silk_cbk_sizes_stage3[complexity];
-
-	target_ptr = &signal[SKP_LSHIFT(sf_length, 2)];
-	for (k = 0; k < PITCH_EST_NB_SUBFR; k++) {
-		lag_counter = 0;
-
-		/* Calculate the energy for first lag */
-		basis_ptr =
-		    target_ptr - (start_lag +
-				  SKP_Silk_Lag_range_stage3[complexity][k][0]);
-		energy =
-		    SKP_Silk_inner_prod_aligned(basis_ptr, basis_ptr,
-						sf_length);
-		assert(energy >= 0);
-		scratch_mem[lag_counter] = energy;
-		lag_counter++;
-
-		for (i = 1;
-		     i <
-		     (SKP_Silk_Lag_range_stage3[complexity][k][1] -
-		      SKP_Silk_Lag_range_stage3[complexity][k][0] + 1); i++) {
-			/* remove part outside new window */
-			energy -=
-			    SKP_SMULBB(basis_ptr[sf_length - i],
-				       basis_ptr[sf_length - i]);
-			assert(energy >= 0);
-
-			/* add part that comes into window */
-			energy =
-			    SKP_ADD_SAT32(energy,
-					  SKP_SMULBB(basis_ptr[-i],
-						     basis_ptr[-i]));
-			assert(energy >= 0);
-			assert(lag_counter < SCRATCH_SIZE);
-			scratch_mem[lag_counter] = energy;
-			lag_counter++;
-		}
-
-		delta = SKP_Silk_Lag_range_stage3[complexity][k][0];
-		for (i = cbk_offset; i < (cbk_offset + cbk_size); i++) {
-			/* Fill out the 3 dim array that stores the correlations for    */
-			/* each code_book vector for each start lag                        */
-			idx = SKP_Silk_CB_lags_stage3[k][i] - delta;
-			for (j = 0; j < PITCH_EST_NB_STAGE3_LAGS; j++) {
-				assert(idx + j < SCRATCH_SIZE);
-				assert(idx + j < lag_counter);
-				energies_st3[k][i][j] = scratch_mem[idx + j];
-				assert(energies_st3[k][i][j] >= 0.0f);
-			}
-		}
-		target_ptr += sf_length;
-	}
-}
-
-int32_t SKP_FIX_P_Ana_find_scaling(const int16_t * signal,
-				   const int signal_length,
-				   const int sum_sqr_len)
-{
-	int32_t nbits, x_max;
-
-	x_max = SKP_Silk_int16_array_maxabs(signal, signal_length);
-
-	if (x_max < int16_t_MAX) {
-		/* Number of bits needed for the sum of the squares */
-		nbits = 32 - SKP_Silk_CLZ32(SKP_SMULBB(x_max, x_max));
-	} else {
-		/* Here we don't know if x_max should have been int16_t_MAX + 1, so we expect the worst case */
-		nbits = 30;
-	}
-	nbits += 17 - SKP_Silk_CLZ16(sum_sqr_len);
-
-	/* Without a guarantee of saturation, we need to keep the 31st bit free */
-	if (nbits < 31) {
-		return 0;
-	} else {
-		return (nbits - 30);
-	}
-}
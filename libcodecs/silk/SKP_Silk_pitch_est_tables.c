@@ -1,94 +0,0 @@
-/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
-
-/***********************************************************************
-Copyright (c) 2006-2010, Skype Limited. All rights reserved. 
-Redistribution and use in source and binary forms, with or without 
-modification, (subject to the limitations in the disclaimer below) 
-are permitted provided that the following conditions are met:
-- Redistributions of source code must retain the above copyright notice,
-this list of conditions and the following disclaimer.
-- Redistributions in binary form must reproduce the above copyright 
-notice, this list of conditions and the following disclaimer in the 
-documentation and/or other materials provided with the distribution.
-- Neither the name of Skype Limited, nor the names of specific 
-contributors, may be used to endorse or promote products derived from 
-this software without specific prior written permission.
-NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED 
-BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
-CONTRIBUTORS ''AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
-BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
-FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
-COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, 
-INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
-NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF 
-USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
-ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
-(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
-OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-***********************************************************************/
-
-#include "SKP_Silk_typedef.h"
-#include "SKP_Silk_pitch_est_defines.h"
-
-/********************************************************/
-/* Auto Generated File from generate_pitch_est_tables.m */
-/********************************************************/
-
-const int16_t
-    SKP_Silk_CB_lags_stage2[PITCH_EST_NB_SUBFR][PITCH_EST_NB_CBKS_STAGE2_EXT] =
-{
-	{0, 2, -1, -1, -1, 0, 0, 1, 1, 0, 1},
-	{0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0},
-	{0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0},
-	{0, -1, 2, 1, 0, 1, 1, 0, 0, -1, -1}
-};
-
-const int16_t
-    SKP_Silk_CB_lags_stage3[PITCH_EST_NB_SUBFR][PITCH_EST_NB_CBKS_STAGE3_MAX] =
-{
-	{-9, -7, -6, -5, -5, -4, -4, -3, -3, -2, -2, -2, -1, -1, -1, 0, 0, 0, 1,
-	 1, 0, 1, 2, 2, 2, 3, 3, 4, 4, 5, 6, 5, 6, 8},
-	{-3, -2, -2, -2, -1, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, 0, 0, 0, 1, 0,
-	 0, 0, 1, 1, 0, 1, 1, 2, 1, 2, 2, 2, 2, 3},
-	{3, 3, 2, 2, 2, 2, 1, 2, 1, 1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
-	 -1, 0, 0, -1, -1, -1, -1, -1, -2, -2, -2},
-	{9, 8, 6, 5, 6, 5, 4, 4, 3, 3, 2, 2, 2, 1, 0, 1, 1, 0, 0, 0, -1, -1, -1,
-	 -2, -2, -2, -3, -3, -4, -4, -5, -5, -6, -7}
-};
-
-const int16_t SKP_Silk_Lag_range_stage3[SigProc_PITCH_EST_MAX_COMPLEX +
-					1][PITCH_EST_NB_SUBFR][2] = {
-	/* Lags to search for low number of stage3 cbks */
-	{
-	 {-2, 6},
-	 {-1, 5},
-	 {-1, 5},
-	 {-2, 7}
-	 },
-	/* Lags to search for middle number of stage3 cbks */
-	{
-	 {-4, 8},
-	 {-1, 6},
-	 {-1, 6},
-	 {-4, 9}
-	 },
-	/* Lags to search for max number of stage3 cbks */
-	{
-	 {-9, 12},
-	 {-3, 7},
-	 {-2, 7},
-	 {-7, 13}
-	 }
-};
-
-const int16_t SKP_Silk_cbk_sizes_stage3[SigProc_PITCH_EST_MAX_COMPLEX + 1] = {
-	PITCH_EST_NB_CBKS_STAGE3_MIN,
-	PITCH_EST_NB_CBKS_STAGE3_MID,
-	PITCH_EST_NB_CBKS_STAGE3_MAX
-};
-
-const int16_t SKP_Silk_cbk_offsets_stage3[SigProc_PITCH_EST_MAX_COMPLEX + 1] = {
-	((PITCH_EST_NB_CBKS_STAGE3_MAX - PITCH_EST_NB_CBKS_STAGE3_MIN) >> 1),
-	((PITCH_EST_NB_CBKS_STAGE3_MAX - PITCH_EST_NB_CBKS_STAGE3_MID) >> 1),
-	0
-};
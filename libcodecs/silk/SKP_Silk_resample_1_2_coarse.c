@@ -1,76 +0,0 @@
-/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
-
-/***********************************************************************
-Copyright (c) 2006-2010, Skype Limited. All rights reserved. 
-Redistribution and use in source and binary forms, with or without 
-modification, (subject to the limitations in the disclaimer below) 
-are permitted provided that the following conditions are met:
-- Redistributions of source code must retain the above copyright notice,
-this list of conditions and the following disclaimer.
-- Redistributions in binary form must reproduce the above copyright 
-notice, this list of conditions and the following disclaimer in the 
-documentation and/or other materials provided with the distribution.
-- Neither the name of Skype Limited, nor the names of specific 
-contributors, may be used to endorse or promote products derived from 
-this software without specific prior written permission.
-NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED 
-BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
-CONTRIBUTORS ''AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
-BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
-FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
-COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, 
-INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
-NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF 
-USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
-ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
-(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
-OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-***********************************************************************/
-
-/*                                                                      *
- * SKP_Silk_resample_1_2_coarse.c                                     *
- *                                                                      *
- * Downsample by a factor 2, coarser                                    *
- *                                                                      *
- * Copyright 2006 (c), Skype Limited                                    *
- * Date: 060221                                                         *
- *                                                                      */
-#include "SKP_Silk_SigProc_FIX.h"
-
-/* downsample by a factor 2, coarser */
-void SKP_Silk_resample_1_2_coarse(const int16_t * in,	/* I:   16 kHz signal [2*len]   */
-				  int32_t * S,	/* I/O: State vector [4]        */
-				  int16_t * out,	/* O:   8 kHz signal [len]      */
-				  int32_t * scratch,	/* I:   Scratch memory [3*len]  */
-				  const int32_t len	/* I:   Number of OUTPUT samples */
-    )
-{
-	int32_t k, idx;
-
-	/* Coefficients for coarser 2-fold resampling */
-	const int16_t A20c[2] = { 2119, 16663 };
-	const int16_t A21c[2] = { 8050, 26861 };
-
-	/* De-interleave allpass inputs, and convert Q15 -> Q25 */
-	for (k = 0; k < len; k++) {
-		idx = SKP_LSHIFT(k, 1);
-		scratch[k] = SKP_LSHIFT((int32_t) in[idx], 10);
-		scratch[k + len] = SKP_LSHIFT((int32_t) in[idx + 1], 10);
-	}
-
-	idx = SKP_LSHIFT(len, 1);
-	/* Allpass filters */
-	SKP_Silk_allpass_int(scratch, S, A21c[0], scratch + idx, len);
-	SKP_Silk_allpass_int(scratch + idx, S + 1, A21c[1], scratch, len);
-
-	SKP_Silk_allpass_int(scratch + len, S + 2, A20c[0], scratch + idx, len);
-	SKP_Silk_allpass_int(scratch + idx, S + 3, A20c[1], scratch + len, len);
-
-	/* Add two allpass outputs */
-	for (k = 0; k < len; k++) {
-		out[k] =
-		    (int16_t)
-		    SKP_SAT16(SKP_RSHIFT_ROUND
-			      (scratch[k] + scratch[k + len], 11));
-	}
-}
@@ -1,77 +0,0 @@
-/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
-
-/***********************************************************************
-Copyright (c) 2006-2010, Skype Limited. All rights reserved. 
-Redistribution and use in source and binary forms, with or without 
-modification, (subject to the limitations in the disclaimer below) 
-are permitted provided that the following conditions are met:
-- Redistributions of source code must retain the above copyright notice,
-this list of conditions and the following disclaimer.
-- Redistributions in binary form must reproduce the above copyright 
-notice, this list of conditions and the following disclaimer in the 
-documentation and/or other materials provided with the distribution.
-- Neither the name of Skype Limited, nor the names of specific 
-contributors, may be used to endorse or promote products derived from 
-this software without specific prior written permission.
-NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED 
-BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
-CONTRIBUTORS ''AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
-BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
-FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
-COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, 
-INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
-NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF 
-USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
-ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
-(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
-OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-***********************************************************************/
-
-/*                                                                      *
- * File Name:    SKP_Silk_resample_2_3.c                              *
- *                                                                      *
- * Resamples by a factor 2/3                                            *
- *                                                                      *
- * Copyright 2008 (c), Skype Limited                                    *
- * All rights reserved.                                                 *
- *                                                                      *
- * Date: 081113                                                         *
- *                                                                      */
-
-#include "SKP_Silk_SigProc_FIX.h"
-
-#define OUT_SUBFR_LEN        80
-
-/* Resamples by a factor 2/3 */
-void SKP_Silk_resample_2_3(int16_t * out,	/* O:   Fs_low signal    [inLen * 2/3]           */
-			   int32_t * S,	/* I/O: State vector     [7+4]                   */
-			   const int16_t * in,	/* I:   Fs_high signal   [inLen]                 */
-			   const int inLen	/* I:   Input length, must be a multiple of 3    */
-    )
-{
-	int outLen, LSubFrameIn, LSubFrameOut;
-	int16_t outH[3 * OUT_SUBFR_LEN];
-	int32_t scratch[(9 * OUT_SUBFR_LEN) / 2];
-
-	/* Check that input length is multiple of 3 */
-	assert(inLen % 3 == 0);
-
-	outLen = SKP_DIV32_16(SKP_LSHIFT(inLen, 1), 3);
-	while (outLen > 0) {
-		LSubFrameOut = SKP_min_int(OUT_SUBFR_LEN, outLen);
-		LSubFrameIn = SKP_SMULWB(98304, LSubFrameOut);	/* 98304_Q16 = 3/2_Q0 */
-
-		/* Upsample by a factor 2 */
-		/* Scratch size needs to be: 3 * LSubFrameIn * sizeof( int32_t ) */
-		SKP_Silk_resample_2_1_coarse(in, &S[0], outH, scratch,
-					     LSubFrameIn);
-
-		/* Downsample by a factor 3 */
-		SKP_Silk_resample_1_3(out, &S[4], outH,
-				      SKP_LSHIFT(LSubFrameIn, 1));
-
-		in += LSubFrameIn;
-		out += LSubFrameOut;
-		outLen -= LSubFrameOut;
-	}
-}
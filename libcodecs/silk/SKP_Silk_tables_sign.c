@@ -1,105 +0,0 @@
-/* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
-
-/***********************************************************************
-Copyright (c) 2006-2010, Skype Limited. All rights reserved. 
-Redistribution and use in source and binary forms, with or without 
-modification, (subject to the limitations in the disclaimer below) 
-are permitted provided that the following conditions are met:
-- Redistributions of source code must retain the above copyright notice,
-this list of conditions and the following disclaimer.
-- Redistributions in binary form must reproduce the above copyright 
-notice, this list of conditions and the following disclaimer in the 
-documentation and/or other materials provided with the distribution.
-- Neither the name of Skype Limited, nor the names of specific 
-contributors, may be used to endorse or promote products derived from 
-this software without specific prior written permission.
-NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED 
-BY THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
-CONTRIBUTORS ''AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING,
-BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND 
-FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
-COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, 
-INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
-NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF 
-USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON 
-ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT 
-(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE 
-OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-***********************************************************************/
-
-#include "SKP_Silk_tables.h"
-
-const uint16_t SKP_Silk_sign_CDF[36][3] = {
-	{
-	 0, 37840, 65535},
-	{
-	 0, 36944, 65535},
-	{
-	 0, 36251, 65535},
-	{
-	 0, 35304, 65535},
-	{
-	 0, 34715, 65535},
-	{
-	 0, 35503, 65535},
-	{
-	 0, 34529, 65535},
-	{
-	 0, 34296, 65535},
-	{
-	 0, 34016, 65535},
-	{
-	 0, 47659, 65535},
-	{
-	 0, 44945, 65535},
-	{
-	 0, 42503, 65535},
-	{
-	 0, 40235, 65535},
-	{
-	 0, 38569, 65535},
-	{
-	 0, 40254, 65535},
-	{
-	 0, 37851, 65535},
-	{
-	 0, 37243, 65535},
-	{
-	 0, 36595, 65535},
-	{
-	 0, 43410, 65535},
-	{
-	 0, 44121, 65535},
-	{
-	 0, 43127, 65535},
-	{
-	 0, 40978, 65535},
-	{
-	 0, 38845, 65535},
-	{
-	 0, 40433, 65535},
-	{
-	 0, 38252, 65535},
-	{
-	 0, 37795, 65535},
-	{
-	 0, 36637, 65535},
-	{
-	 0, 59159, 65535},
-	{
-	 0, 55630, 65535},
-	{
-	 0, 51806, 65535},
-	{
-	 0, 48073, 65535},
-	{
-	 0, 45036, 65535},
-	{
-	 0, 48416, 65535},
-	{
-	 0, 43857, 65535},
-	{
-	 0, 42678, 65535},
-	{
-	 0, 41146, 65535}
-};
@@ -1,120 +1,183 @@
 /* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
 
 
-#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 
-//Define codec specific settings 
-#define MAX_BYTES_ENC_PER_FRAME     64	// Equals peak bitrate of 25600 kbps: 576 bytes per packet maximum
-#define MAX_INPUT_FRAMES        5
+//Define codec specific settings
+#define MAX_BYTES_ENC_PER_FRAME     42	// 3 frames and header byte fit 7 bit packet length
+#define MAX_INPUT_FRAMES        3	// SILK payload carries up to 60 mS
 #define	MAX_FRAME			160
+#define	FRAME_MS			20	//frame duration
 
-#include "SKP_Silk_SDK_API.h"
-#include "SKP_Silk_SigProc_FIX.h"
+//payload header byte: bits 1-0 hold the number of 20 mS frames in the
+//payload, bits 7-2 are clear (the caller's packet type goes there and is
+//masked off again before decoding)
+#define HDR_FRAMES_MASK		0x03
+
+#include "API.h"
+#include "cpu_support.h"
 
 #include "libsilk.h"
 
-// encoder parameters
-static int32_t encSizeBytes;
-static void *psEnc = 0;
-static SKP_SILK_SDK_EncControlStruct encControl;
-
-  // default settings 
-
-static int skp_frames_pp = 1;	//Frames per packet
-static int packetSize_ms = 20;	//frame duration
-static int targetRate_bps = 10000;	//average bitrate
-static int compression = 2;	//Complexity
-static int packetLoss_perc = 0;	//redudant
-static int INBandFec_enabled = 0;	//redudant
-static int DTX_enabled = 0;	//DTX
-
-// decoder parameters 
-static int32_t decSizeBytes;
-static void *psDec = 0;
-static SKP_SILK_SDK_DecControlStruct DecControl;
-
-//initialize SILK codec 
-//sets number of 20mS(160 samples) frames per packet (1-5)
-void SILK8_open(int fpp)
+// default settings
+static const int targetRate_bps = 10000;	//average bitrate
+static const int compression = 2;	//Complexity
+static const int packetLoss_perc = 0;	//redudant
+static const int INBandFec_enabled = 0;	//redudant
+static const int DTX_enabled = 0;	//DTX
+
+//SILK8 complexity 0-2 to Opus SILK complexity 0-10: picks the settings
+//closest to the low, medium and high modes of the SKP SDK
+static const int silk_complexity[3] = { 2, 5, 10 };
+
+struct silk8 {
+	// encoder parameters
+	void *psEnc;
+	silk_EncControlStruct encControl;
+	int frames_pp;	//Frames per packet
+
+	// decoder parameters
+	void *psDec;
+	silk_DecControlStruct DecControl;
+};
+
+//create SILK codec instance
+//sets number of 20mS(160 samples) frames per packet (1-3)
+struct silk8 *SILK8_open(int fpp)
 {
-	//set number of 20 mS (160 samoles) frames per packet (1-5)
+	struct silk8 *st;
+	int encSizeBytes, decSizeBytes;
+
+	st = calloc(1, sizeof(struct silk8));
+	if (!st)
+		return 0;
+
+	//set number of 20 mS (160 samoles) frames per packet (1-3)
+	st->frames_pp = 1;
 	if ((fpp <= MAX_INPUT_FRAMES) && (fpp > 0))
-		skp_frames_pp = fpp;
-	packetSize_ms = skp_frames_pp * 20;
-
-	// Set the samplingrate that is requested for the output
-	DecControl.sampleRate = 8000;
-
-	// Create decoder 
-	SKP_Silk_SDK_Get_Decoder_Size(&decSizeBytes);
-	psDec = malloc(decSizeBytes);
-
-	// Reset decoder 
-	SKP_Silk_SDK_InitDecoder(psDec);
-
-	// Create Encoder 
-	SKP_Silk_SDK_Get_Encoder_Size(&encSizeBytes);
-	psEnc = malloc(encSizeBytes);
-
-	// Reset Encoder 
-	SKP_Silk_SDK_InitEncoder(psEnc, &encControl);
-
-	// Set Encoder parameters 
-	encControl.sampleRate = 8000;
-	encControl.packetSize = packetSize_ms * 8;	//samples per packet
-	encControl.packetLossPercentage = packetLoss_perc;
-	encControl.useInBandFEC = INBandFec_enabled;
-	encControl.useDTX = DTX_enabled;
-	encControl.complexity = compression;
-	encControl.bitRate = targetRate_bps;
+		st->frames_pp = fpp;
+
+	// Create decoder
+	silk_Get_Decoder_Size(&decSizeBytes);
+	st->psDec = malloc(decSizeBytes);
+
+	// Create Encoder
+	silk_Get_Encoder_Size(&encSizeBytes);
+	st->psEnc = malloc(encSizeBytes);
+
+	if (!st->psDec || !st->psEnc) {
+		SILK8_close(st);
+		return 0;
+	}
+
+	// Reset decoder
+	silk_InitDecoder(st->psDec);
+
+	// Mono narrowband in and out, SILK only
+	st->DecControl.nChannelsAPI = 1;
+	st->DecControl.nChannelsInternal = 1;
+	st->DecControl.API_sampleRate = 8000;
+	st->DecControl.internalSampleRate = 8000;
+	st->DecControl.payloadSize_ms = st->frames_pp * FRAME_MS;
+
+	// Reset Encoder
+	silk_InitEncoder(st->psEnc, opus_select_arch(), &st->encControl);
+
+	// Set Encoder parameters
+	st->encControl.nChannelsAPI = 1;
+	st->encControl.nChannelsInternal = 1;
+	st->encControl.API_sampleRate = 8000;
+	st->encControl.maxInternalSampleRate = 8000;
+	st->encControl.minInternalSampleRate = 8000;
+	st->encControl.desiredInternalSampleRate = 8000;
+	st->encControl.payloadSize_ms = st->frames_pp * FRAME_MS;
+	st->encControl.packetLossPercentage = packetLoss_perc;
+	st->encControl.useInBandFEC = INBandFec_enabled;
+	st->encControl.useDTX = DTX_enabled;
+	st->encControl.useCBR = 0;
+	st->encControl.maxBits = MAX_BYTES_ENC_PER_FRAME * st->frames_pp * 8;
+	st->encControl.toMono = 0;
+	st->encControl.opusCanSwitch = 0;
+	st->encControl.reducedDependency = 0;
+	st->encControl.complexity = silk_complexity[compression];
+	st->encControl.bitRate = targetRate_bps;
+	return st;
 }
 
 //encode frames_per_packet * 160 short samples to packet
-//returns total packet size in bytes
-int SILK8_encode(short *in, unsigned char *enc_payload) {
-
-	int i, frsz = MAX_FRAME;
-	int16_t nBytes;
-	unsigned int lin_pos = 0;
-
-	for (i = 0; i < skp_frames_pp; i++) {
-		// max payload size 
-		nBytes = MAX_BYTES_ENC_PER_FRAME * skp_frames_pp;
-		SKP_Silk_SDK_Encode(psEnc, &encControl, in + i * frsz,
-				    (int16_t) frsz,
-				    (uint8_t *) (enc_payload + lin_pos),
-				    &nBytes);
-		lin_pos += nBytes;
-	}
+//returns total packet size in bytes (header byte included)
+int SILK8_encode(struct silk8 *st, short *in, unsigned char *enc_payload) {
 
-	return lin_pos;
+	ec_enc enc;
+	int32_t nBytes;
+
+	enc_payload[0] = (unsigned char)st->frames_pp;
+
+	// max payload size
+	nBytes = MAX_BYTES_ENC_PER_FRAME * st->frames_pp;
+	ec_enc_init(&enc, enc_payload + 1, nBytes);
+	if (silk_Encode(st->psEnc, &st->encControl, in,
+			st->frames_pp * MAX_FRAME, &enc, &nBytes, 0) || !nBytes)
+		return 1;	//header only: decoded as a lost packet
+
+	nBytes = (ec_tell(&enc) + 7) >> 3;
+	ec_enc_done(&enc);
+
+	return 1 + nBytes;
 }
 
-//decode packet of size bytes in buffer to short samples output_buffer 
+//set encoder complexity: 0 (lowest) to 2 (highest)
+void SILK8_complexity(struct silk8 *st, int c)
+{
+	if (c < 0)
+		c = 0;
+	if (c > 2)
+		c = 2;
+	st->encControl.complexity = silk_complexity[c];
+}
+
+//decode packet of size bytes in buffer to short samples output_buffer
 //returns number of samples
-int SILK8_decode(short *output_buffer, unsigned char *buffer, int size) {
+int SILK8_decode(struct silk8 *st, short *output_buffer, unsigned char *buffer, int size) {
 
-	int16_t len;
+	ec_dec dec;
+	int32_t len;
 	int16_t *outPtr;
+	int frames, lost;
 
 	outPtr = output_buffer;
 
+	// payload without audio or with damaged header: conceal frames_pp frames
+	frames = size > 0 ? (buffer[0] & HDR_FRAMES_MASK) : 0;
+	if (size > 0 && (buffer[0] & ~HDR_FRAMES_MASK))
+		frames = 0;
+	lost = (size < 2) || !frames;
+	if (lost)
+		frames = st->frames_pp;
+	ec_dec_init(&dec, buffer + 1, lost ? 0 : size - 1);
+
+	st->DecControl.payloadSize_ms = frames * FRAME_MS;
+
 	do {
-		SKP_Silk_SDK_Decode(psDec, &DecControl, 0, (uint8_t *) buffer,
-				    size, outPtr, &len);
+		if (silk_Decode(st->psDec, &st->DecControl, lost,
+				outPtr == output_buffer, &dec, outPtr, &len)) {
+			len = MAX_FRAME;
+			memset(outPtr, 0, len * sizeof(*outPtr));
+		}
 		outPtr += len;
-	} while (DecControl.moreInternalDecoderFrames);
+	} while (outPtr - output_buffer < frames * MAX_FRAME);
 
 	return (int)(outPtr - output_buffer);	//number of samples
 }
 
-//free SILK memory
-void SILK8_close(void) {
-	// Free decoder 
-	free(psDec);
-	// Free Encoder 
-	free(psEnc);
+//free SILK instance
+void SILK8_close(struct silk8 *st) {
+	if (!st)
+		return;
+	// Free decoder
+	free(st->psDec);
+	// Free Encoder
+	free(st->psEnc);
+	free(st);
 }
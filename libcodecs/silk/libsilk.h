@@ -1,15 +1,24 @@
 /* vim: set tabstop=4:softtabstop=4:shiftwidth=4:noexpandtab */
 
-//initialize SILK codec for fpp frames per packet (1-5)
-void SILK8_open(int fpp);
+//SILK codec instance (encoder and decoder pair)
+struct silk8;
 
-//encode fpp * 160 short samples frames to packet
+//create SILK codec instance for fpp frames per packet (1-3)
+//returns 0 on allocation error
+struct silk8 *SILK8_open(int fpp);
+
+//encode fpp * 160 short samples frames to packet: one header byte with
+//bits 7-2 clear (free for type flags) followed by the Opus SILK payload.
+//Not compatible with the SKP SDK stream of older builds
 //returns packet size in bytes
-int SILK8_encode(short *in, unsigned char *enc_payload);
+int SILK8_encode(struct silk8 *st, short *in, unsigned char *enc_payload);
+
+//set encoder complexity: 0 (lowest) to 2 (highest, default)
+void SILK8_complexity(struct silk8 *st, int c);
 
 //decode packet of size bytes in buffer to short samples output_buffer 
 //returns number of samples
-int SILK8_decode(short *output_buffer, unsigned char *buffer, int size);
+int SILK8_decode(struct silk8 *st, short *output_buffer, unsigned char *buffer, int size);
 
-//free SILK memory
-void SILK8_close(void);
+//free SILK instance
+void SILK8_close(struct silk8 *st);
@@ -185,6 +185,11 @@ void *nb_encoder_init(const SpeexMode * m)
 	st->isWideband = 0;
 	st->highpass_enabled = 1;
 
+	st->shared = NULL;
+	st->an_count = 0;
+	st->an_seen = 0;
+	st->an_pitch = 0;
+
 	return st;
 }
 
@@ -414,6 +419,13 @@ int nb_encoder_ctl(void *state, int request, void *ptr)
 	case SPEEX_GET_STACK:
 		*((char **)ptr) = st->stack;
 		break;
+	case SPEEX_SET_ANALYSIS_SOURCE:
+		st->shared = (EncState *) ptr;
+		if (st->shared == st)
+			st->shared = NULL;
+		if (st->shared)
+			st->an_seen = st->shared->an_count;
+		break;
 	default:
 		speex_warning_int("Unknown nb_ctl request: ", request);
 		return -1;
@@ -428,6 +440,9 @@ int nb_encode(void *state, void *vin, SpeexBits * bits)
 	int ol_pitch;
 	spx_word16_t ol_pitch_coef;
 	spx_word32_t ol_gain;
+	spx_word16_t ol_rms;
+	int need_pitch;
+	EncState *src;
 	char *stack;
 
 	spx_word32_t ener = 0;
@@ -459,7 +474,28 @@ int nb_encode(void *state, void *vin, SpeexBits * bits)
 			  HIGHPASS_NARROWBAND)
 			 | HIGHPASS_INPUT, st->mem_hp);
 
-	{
+	need_pitch = !st->submodes[st->submodeID]
+	    || (st->complexity > 2 && SUBMODE(have_subframe_gain) < 3)
+	    || SUBMODE(forced_pitch_gain) || SUBMODE(lbr_pitch) != -1
+#ifndef DISABLE_VBR
+	    || st->vbr_enabled || st->vad_enabled
+#endif
+	    ;
+
+	/* Take the analysis from the source encoder if it has just encoded
+	   this frame, otherwise run our own */
+	src = st->shared;
+	if (src) {
+		if (src->an_count != st->an_seen + 1
+		    || (need_pitch && !src->an_pitch))
+			src = NULL;
+		st->an_seen = st->shared->an_count;
+	}
+
+	if (src) {
+		for (i = 0; i < NB_ORDER; i++)
+			lsp[i] = src->an_lsp[i];
+	} else {
 		spx_word16_t w_sig[NB_WINDOW_SIZE];
 		spx_word16_t autocorr[NB_ORDER + 1];
 		/* Window for analysis */
@@ -494,7 +530,11 @@ int nb_encode(void *state, void *vin, SpeexBits * bits)
 	}
 
 	/* Whole frame analysis (open-loop estimation of pitch and excitation gain) */
-	{
+	if (src) {
+		ol_pitch = need_pitch ? src->an_ol_pitch : 0;
+		ol_pitch_coef = need_pitch ? src->an_ol_pitch_coef : 0;
+		ol_rms = src->an_rms;
+	} else {
 		int diff = NB_WINDOW_SIZE - NB_FRAME_SIZE;
 		if (st->first)
 			for (i = 0; i < NB_ORDER; i++)
@@ -508,13 +548,7 @@ int nb_encode(void *state, void *vin, SpeexBits * bits)
 		lsp_to_lpc(interp_lsp, interp_lpc, NB_ORDER, stack);
 
 		/*Open-loop pitch */
-		if (!st->submodes[st->submodeID]
-		    || (st->complexity > 2 && SUBMODE(have_subframe_gain) < 3)
-		    || SUBMODE(forced_pitch_gain) || SUBMODE(lbr_pitch) != -1
-#ifndef DISABLE_VBR
-		    || st->vbr_enabled || st->vad_enabled
-#endif
-		    ) {
+		if (need_pitch) {
 			int nol_pitch[6];
 			spx_word16_t nol_pitch_coef[6];
 
@@ -567,29 +601,34 @@ int nb_encode(void *state, void *vin, SpeexBits * bits)
 		fir_mem16(in, interp_lpc, st->exc + diff, NB_FRAME_SIZE - diff,
 			  NB_ORDER, st->mem_exc, stack);
 
-		/* Compute open-loop excitation gain */
-		{
-			spx_word16_t g = compute_rms16(st->exc, NB_FRAME_SIZE);
-			if (st->submodeID != 1 && ol_pitch > 0)
-				ol_gain =
-				    MULT16_16(g,
-					      MULT16_16_Q14(QCONST16(1.1, 14),
-							    spx_sqrt(QCONST32
-								     (1.,
-								      28) -
-								     MULT16_32_Q15
-								     (QCONST16
-								      (.8, 15),
-								      SHL32
-								      (MULT16_16
-								       (ol_pitch_coef,
-									ol_pitch_coef),
-								       16)))));
-			else
-				ol_gain = SHL32(EXTEND32(g), SIG_SHIFT);
-		}
+		ol_rms = compute_rms16(st->exc, NB_FRAME_SIZE);
 	}
 
+	/* Keep the analysis for encoders sharing it */
+	for (i = 0; i < NB_ORDER; i++)
+		st->an_lsp[i] = lsp[i];
+	st->an_ol_pitch = ol_pitch;
+	st->an_ol_pitch_coef = ol_pitch_coef;
+	st->an_rms = ol_rms;
+	st->an_pitch = need_pitch;
+	st->an_count++;
+
+	/* Compute open-loop excitation gain */
+	if (st->submodeID != 1 && ol_pitch > 0)
+		ol_gain =
+		    MULT16_16(ol_rms,
+			      MULT16_16_Q14(QCONST16(1.1, 14),
+					    spx_sqrt(QCONST32(1., 28) -
+						     MULT16_32_Q15(QCONST16
+								   (.8, 15),
+								   SHL32
+								   (MULT16_16
+								    (ol_pitch_coef,
+								     ol_pitch_coef),
+								    16)))));
+	else
+		ol_gain = SHL32(EXTEND32(ol_rms), SIG_SHIFT);
+
 #ifdef VORBIS_PSYCHO
 	SPEEX_MOVE(st->psy_window, st->psy_window + NB_FRAME_SIZE,
 		   256 - NB_FRAME_SIZE);
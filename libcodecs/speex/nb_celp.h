@@ -124,6 +124,15 @@ typedef struct EncState {
 	int submodeSelect;	 /**< Mode chosen by the user (may differ from submodeID if VAD is on) */
 	int isWideband;		 /**< Is this used as part of the embedded wideband codec */
 	int highpass_enabled;	   /**< Is the input filter enabled */
+
+	struct EncState *shared; /**< Encoder whose front-end analysis is reused (NULL for none) */
+	int an_count;		 /**< Number of frames analysed by this encoder */
+	int an_seen;		 /**< Value of shared->an_count when last frame was encoded */
+	int an_pitch;		 /**< Was the open-loop pitch searched for the last frame? */
+	spx_lsp_t an_lsp[NB_ORDER];	  /**< Unquantized LSPs of the last frame */
+	int an_ol_pitch;	 /**< Open-loop pitch of the last frame */
+	spx_word16_t an_ol_pitch_coef;	  /**< Open-loop pitch gain of the last frame */
+	spx_word16_t an_rms;	 /**< RMS of the open-loop excitation of the last frame */
 } EncState;
 
 /**Structure representing the full state of the narrowband decoder*/
@@ -163,6 +163,11 @@ extern "C" {
     how much damage we cause if we remove the frame */
 #define SPEEX_GET_ACTIVITY 47
 
+/** Reuse the LPC/LSP and open-loop pitch analysis of another narrowband
+    encoder (pass its state, or NULL to stop). Frames must be encoded
+    by the other encoder first, interleaved one by one, on the same input */
+#define SPEEX_SET_ANALYSIS_SOURCE 48
+
 /* Preserving compatibility:*/
 /** Equivalent to SPEEX_SET_ENH */
 #define SPEEX_SET_PF 0
@@ -23,6 +23,8 @@
 #include "cntrls.h"
 #include "codecs.h"
 #include "tcp.h"
+#include "ophh_trace.h"
+#include "mixer.h"
 //#include "audio.h"
 
 #include <stdarg.h>
@@ -775,6 +777,26 @@ int parsecmd(void)
   }
   //enable notification of bufferig status (debug mode)
   else if(cmdbuf[2]=='B') sound_test=1;
+  //per-packet pipeline tracing: -RR start recording, -RD[file] stop and save
+  else if(cmdbuf[2]=='R')
+  {
+   ophh_trace_start();
+   web_printf("Tracing voice packets\r\n");
+  }
+  //conference hub: -RM shows legs, -RMleg:percent sets gain of participant
+  else if(cmdbuf[2]=='M')
+  {
+   char* p=strchr(cmdbuf+3, ':');
+   if(p) mix_gain(atoi(cmdbuf+3), atoi(p+1));
+   mix_status();
+  }
+  else if(cmdbuf[2]=='D')
+  {
+   if(!cmdbuf[3]) strcpy(cmdbuf+3, "trace.json");
+   i=ophh_trace_dump(cmdbuf+3);
+   if(i<0) web_printf("Cannot write trace to %s\r\n", cmdbuf+3);
+   else web_printf("%d trace events saved to %s\r\n", i, cmdbuf+3);
+  }
   //VAD mode
   else if(cmdbuf[2]=='A') go_vad();
   //voice transmission control
@@ -1145,7 +1167,7 @@ int gochar(int c)
 //read char from console input asynchronosly
 int do_char(void)
 {
- char c;
+ signed char c; //sign is tested below: char is unsigned on ARM
  int j = 0;
  
  //get char from raw terminal
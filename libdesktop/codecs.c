@@ -78,26 +78,30 @@
 
 #include "libcrp.h"
 #include "crypto.h"
+#include "tcp.h"
+#include "mixer.h"
+#include "dtx.h"
 #include "cntrls.h"
 #include "audio.h"
 #include "codecs.h"
 #include "ringwave.h"
+#include "ophh_thread.h"
+#include "ophh_trace.h"
 
 
-#define RAWBUFLEN 240 //samples in raw buffer for preprocessing
 //=============================Constants================================
 //Codec's names by type
 const char* cd_name[]={ "CODEC2_4","MELPE", "CODEC2_1","LPC10","MELP","CODEC2_2",
 		"CELP",	"AMR","LPC","GSM_HR","G723","G729","GSM_EFR","GSM_FR",
-		"ILBC","BV16","OPUS","SILK","SPEEX"}; 
+		"ILBC","BV16","OPUS","SILK","SPEEX","SKP"}; 
 //Codec's speech frame length (in 8 KHz short PCM samples)
 const int frm_len[24]={
 //	CODEC45	MELPE	CODEC21	LPC10	MELP	CODEC22	CELP	AMR0	LPC
     320,	540,	320,	180,	180,	160,	240,	160,	160,
 //	GSMH	G723	G729	GSME	GSM	ILBC	BV16		
 	160,	240,	80,	160,	160,	240,	40,	
-//	OPUS	SILK	SPEEX   AMRV
-	480,	480,	320,	160,	0,	0,	0, 	0	
+//	OPUS	SILK	SPEEX   SKP
+	480,	480,	320,	480,	0,	0,	0, 	0	
 };
 //Length of compressed frame in bytes
 const int buf_len[40]={
@@ -105,8 +109,8 @@ const int buf_len[40]={
     2,	10,	7,	7,	7,	8,	18,	12,	14,
 //	GSMH	G723	G729	GSME	GSM	ILBC	BV16
 	14,	24,	10,	31,	33,	50,	10,
-//	OPUS	SILK	SPEEX   AMRV
-	0,	0,	0,	12,	0,	0,	0,	0
+//	OPUS	SILK	SPEEX   SKP
+	0,	0,	0,	0,	0,	0,	0,	0
 };
 //Frames per packet
 const int frm_ppk[40]={
@@ -114,24 +118,30 @@ const int frm_ppk[40]={
     8,	5,	8,	11,	9,	9,	6,	10,	9,
 //	GSMH	G723	G729	GSME	GSM	ILBC	BV16	
 	8,	4,	11,	4,	3,	2,	8,
-//	OPUS	SILK	SPEEX   AMRV
-	2,	1,	1,	10,	0,	0,	0, 	0
+//	OPUS	SILK	SPEEX   SKP
+	2,	1,	1,	1,	0,	0,	0, 	0
 };
 
 //==========================Buffers definitions===================================
 #define MAX_FRM_LEN 544 //samples in frame (540 samples for melpe)
 #define MAX_SND_LEN 3200 //grabbed samples in input buffer 
 #define MAX_RDD_LEN 24 //length of speex redudant area in bytes
+#define AMR_FPP_MAX 10 //AMR frames in packet: 3 + 3 bits of header
+#define AMR_RDD_LEN 110 //class A bits of 10 AMR frames in largest mode
 #define MAX_RESAMPL_BUF 816 //1.5 * max_frame_length (540 samples for melpe)
 #define JIT_BUF_LEN 5*MAX_RESAMPL_BUF //5 frames per packet for melpe in jitter buffer
 #define DEFRATE 8000 //nominal samles rate
 #define MAX_PKT_LEN 128 //length of packet in bytes
 #define MAX_PKT 16 //number of packets in circular packets buffer
+#define ENC_JOBS 4 //packets in encoder pipeline (queued for worker + encoded)
+#if 2*AMR_FPP_MAX*180>JIT_BUF_LEN //AMR packet and lost one rebuilt, at up to 9 KHz
+#error AMR_FPP_MAX does not fit the decoding buffers
+#endif
+#define ENC_PKT_LEN 256 //encoder output area (packet is up to 127 bytes + codec overwrites)
 
 //-----------audio input--------------------------
 int enc_type=0; //encoder type
-short raw_buf[2*RAWBUFLEN]; //raw buffer for collect to 160 grabbed samples before preprocessing
-short l_raw=0; //actual number of samples in raw buffer
+short l_raw=0; //samples of the current frame already grabbed (frame is collected at in_buf+l_in)
 short in_buf[MAX_SND_LEN]; //input buffer to collect preprocessed samples before encoding
 short l_in=0; //actual number of samples in input buffer
 int snd_need=1440; //number of samples needed for encode compleet packet by specified codec
@@ -146,12 +156,83 @@ int sp_npp=1;		//noise reduction
 int sp_agc=1;		//mike auto gain
 int sp_voc=0;            //LPC vocoder type
 char speex_rs=1; //using of speex resampler
-char npp7=0; //using npp7 supressor
+char npp7=0; //using npp7 supressor: 1-floating point, 2-fixed point reference
 int RawBufSize=160; //samples for preprocessing
 int sp_jit=0; //specified fixed jitter compensation in mS (0 for auto, -1 for no buffer)
 int vad_signal=0; //length of noise signal transmitted after vad disabled
 int vad_level=0; //level of 3-tone signal (end of remote transmition) 
 int vad_tail=1; //number of transmitted inactive frames before squelch
+#define VAD_BLK 32 //frames in block of noise floor minimum statistics
+#define VAD_BLKS 8 //blocks in noise floor window (about 5 sec of 20 mS frames)
+static float vad_min[VAD_BLKS]; //minimal frame energies in last blocks
+static int vad_nfr=0; //frames processed by first tier of VAD
+float vad_floor=0; //noise floor (mean square) tracked by first tier of VAD
+static int vad_quiet=0; //clear silent frames in sequence (first tier)
+char sp_dtx=0; //generic DTX with comfort noise in continuous and PTT modes
+volatile char cd_vad=-1; //activity by codec's own VAD/DTX for last encoded frame (-1 if unknown)
+static char gsmhr_dtx=0; //GSM_HR runs with DTX (its VAD flag is valid)
+//-----------adaptive packetization---------------
+#define PK_MIN 40 //shortest packet on a fast direct path, mS
+#define PK_MAX 320 //longest packet (fewest packets over Tor), mS
+#if 9*PK_MAX>JIT_BUF_LEN //received packets up to PK_MAX played at up to 9 KHz
+#error PK_MAX does not fit the decoding buffers
+#endif
+#define PK_LOSSY 100 //longest packet on a path with losses over 10%, mS
+#define PK_CHECK 2000 //interval of adaptation, mS
+#define PK_PING 5000 //interval of round trip measuring, mS
+char pk_adapt=0; //adaptive frames per packet (remote must understand wrapped CBR packets)
+static int enc_fpp=0; //frames per packet chosen for encoder (0 for codec default)
+static unsigned int pk_check=0; //time of last adaptation, mS
+static unsigned int pk_ping=0; //time of last automatic ping, mS
+static unsigned int pk_rx=0; //expected incoming packets at last adaptation
+static unsigned int pk_lost=0; //lost incoming packets at last adaptation
+//-----------complexity governor------------------
+#define CX_LEVELS 5 //complexity levels of encoders (0 is the lightest)
+#define CX_DEFAULT 3 //level of codec's default settings
+#define CX_OVER 900 //encoding time of one packet stepping down at once, per mille of its duration
+#define CX_HIGH 600 //average encoding time stepping down, per mille of speech duration
+#define CX_LOW 250 //average encoding time allowing to step up, per mille of speech duration
+#define CX_CHECK 2000 //interval of averaging, mS
+#define CX_HOLD 3 //intervals with low load in sequence before stepping up
+static const char cx_opus[CX_LEVELS]={2, 5, 8, 10, 10}; //Opus complexity (0-10)
+static const char cx_silk[CX_LEVELS]={0, 1, 1, 2, 2}; //SILK complexity (0-2)
+static const char cx_speex[CX_LEVELS]={1, 1, 2, 2, 5}; //Speex complexity (1-10)
+char cx_auto=1; //govern complexity by encoding time (Complexity=auto in config)
+static volatile char cx_level=CX_DEFAULT; //actual complexity level
+static char cx_shown=-1; //level last reported
+static unsigned int cx_check=0; //start of averaging interval, mS
+static unsigned long long cx_busy=0; //encoding time in interval, nS
+static unsigned long long cx_span=0; //duration of speech encoded in interval, nS
+static int cx_quiet=0; //intervals with low load in sequence
+//-----------encoder pipeline---------------------
+typedef struct {
+ int cd;  //codec for encoding or -1 for ready packet
+ int fpp; //frames per packet (0 for codec default)
+ int len; //packet length after encoding
+ unsigned int id; //trace id of packet
+ short sp[MAX_SND_LEN]; //speech samples for packet
+ unsigned char pkt[ENC_PKT_LEN]; //encoded packet
+} EncJob;
+int enc_thread=0; //encode packets in worker thread (EncoderThread in config)
+static char enc_run=0; //worker is running
+static volatile char enc_stop=0; //request for worker to exit
+static ophh_thread_t enc_tid; //worker thread
+static ophh_mutex_t cd_lock; //codec states shared by worker and main thread
+static ophh_sem_t enc_free; //slots free for filling by main thread
+static ophh_sem_t enc_full; //slots filled, waiting for worker
+static ophh_sem_t enc_done; //slots encoded, waiting for sending
+static EncJob enc_job[ENC_JOBS]; //circular buffer of slots
+static int enc_put=0; //next slot to fill (main thread)
+static int enc_get=0; //next slot to send (main thread)
+static char enc_slot=0; //flag: main thread holds free slot reserved
+//-----------pipeline tracing---------------------
+unsigned int trc_tx=0; //trace id of outgoing packet collected now
+unsigned int trc_out=0; //trace id of last packet returned by do_snd
+unsigned int trc_rx=0; //trace id of last received packet (set by main loop)
+static unsigned int trc_pkt[MAX_PKT]; //trace ids of packets in packets buffer
+static unsigned int trc_dec=0; //trace id of packet decoding now
+static unsigned int trc_play=0; //trace id of last decoded packet
+static char trc_wait=0; //flag: samples of trc_play not passed to device yet
 //-----------audio output------------------------
 int dec_type=0; //decoder usefull for last incoming packet
 unsigned int rx_flg=0; //user id of last packet sender or 0 after alsa underrun
@@ -187,6 +268,9 @@ extern int cmdptr;  //actual number of chars in command strings buffer
 extern int rc_cnt; //onion counter (for test only) (from tcp.c)
 extern char sound_loop; //sound self-test mode flag (from ctrls.c)
 extern char crp_state; //crypto state (from crypto.c)
+extern int path_rtt; //round trip time of last ping, mS (from crypto.c)
+extern unsigned int rx_pkts; //expected incoming UDP packets (from crypto.c)
+extern unsigned int rx_lost; //lost incoming UDP packets (from crypto.c)
 //==========================Codec's states==============================
 //------------------------------SPEEX-------------------------------
 //encoder
@@ -205,6 +289,7 @@ int spx_frame_size=160;
 int spx_frames_per_packet=1;
 int spx_bitrate=5950;
 int spx_bitrate_r=2150; //bits per second for redundant frames
+static int spx_rdone=0; //redundant frames already encoded along with main frames
 int spx_vbr=1;
 static float spx_vbr_quality = 5;        //Speex vbr quality setting
 int speex_redundant=1;
@@ -228,11 +313,24 @@ static gsm gsmha; //encoders state
 static gsm gsmhs; //decoders state 
 //*/
 //------------------------------------------LPC---------------------------
+static struct lpcwork *lpca=0; //codec analyzer
+static struct lpcwork *lpcva=0; //vocoder analyzer
 static lpcstate_t lpcc; //codec state
 static lpcstate_t lpcv; //vocoder state
 //------------------------------------------LPC10-------------------------
 static struct lpc10_encoder_state* lpc10_enc_state;
 static struct lpc10_decoder_state* lpc10_dec_state;
+//------------------------------------------G723--------------------------
+static struct g723_enc *g723e=0; //encoder state
+static struct g723_dec *g723d=0; //decoder state
+//------------------------------------------G729--------------------------
+static struct g729_enc *g729e=0; //encoder state
+static struct g729_dec *g729d=0; //decoder state
+//------------------------------------------MELPE-------------------------
+static struct melpe_enc *melpee=0; //encoder state
+static struct melpe_dec *melped=0; //decoder state
+static struct melpe_npp *melpen=0; //noise preprocessor for other codecs
+static struct melpe_nppf *melpenf=0; //floating point one, any RawBufSize
 ///*
 //------------------------------------------ILBC-------------------------
 iLBC_Enc_Inst_t *Enc_Inst;
@@ -247,6 +345,11 @@ char amrcbr=0; //vbr active
 char amrfpp=10; //10 frames (200 mS) per packet
 char amrsid=0; //last frame type
 const char amr_block_size[8]={ 12, 13, 15, 17, 19, 20, 26, 31 }; //our format
+const char amr_rdd_size[8]={ 6, 7, 7, 8, 8, 10, 9, 11 }; //class A bits of frame
+char amrrdd=0; //add class A bits of previous packet (AMR_redundancy in config)
+static unsigned char amr_rb[AMR_RDD_LEN]; //class A bits of last speech frames sent
+static unsigned char amr_rn=0; //number of frames in amr_rb
+static unsigned char amr_rmd=0; //their mode
  
 ///*
 //------------------------------------------BV16--------------------------
@@ -260,6 +363,8 @@ struct CODEC2 *cd45; //450 bps
 //------------------------------------------OPUS--------------------------
 OpusEncoder *enc=NULL;
 OpusDecoder *dec=NULL;
+//------------------------------------------SILK--------------------------
+static struct silk8 *silk=0; //encoder and decoder
 
 //*/
 //=================================Codec's services============================
@@ -285,6 +390,8 @@ int speex_i(int squal, int svbr, int prepr, int sfpp)
   speex_bits_init(&spx_bits_r);
   spx_enc_state_r  = speex_encoder_init(&speex_nb_mode);
   speex_encoder_ctl(spx_enc_state_r, SPEEX_SET_BITRATE, &spx_bitrate_r); 
+  //redundant encoder takes LPC and pitch analysis from the main encoder
+  speex_encoder_ctl(spx_enc_state_r, SPEEX_SET_ANALYSIS_SOURCE, spx_enc_state);
   //Preprocess init
   if ((spx_denoise || spx_agc) && prepr)   {
     spx_preprocess = speex_preprocess_state_init(spx_frame_size, 8000);
@@ -307,18 +414,22 @@ int speex_i(int squal, int svbr, int prepr, int sfpp)
 
 //*****************************************************************************
 //Speex encode frames (160 short samples each) to buf
+//redundant frames are encoded right after each main frame for sharing analysis
 //return buf length in bytes
 int speex_e(unsigned char* buf, short* speech)
 {
  int i;
   // encode the frames 
     speex_bits_reset(&spx_bits);   
+    speex_bits_reset(&spx_bits_r);
     
     for (i=0;i<spx_frames_per_packet;i++)
     {
      if(spx_preprocess) speex_preprocess_run(spx_preprocess, speech+i*spx_frame_size);
      speex_encode_int(spx_enc_state, speech+i*spx_frame_size, &spx_bits);
+     speex_encode_int(spx_enc_state_r, speech+i*spx_frame_size, &spx_bits_r);
     }
+    spx_rdone=1; //speex_er only has to output them
     
     i=speex_bits_write(&spx_bits, (char*)buf, MAX_PKT_LEN);  
     return i;
@@ -330,13 +441,16 @@ int speex_e(unsigned char* buf, short* speech)
 int speex_er(unsigned char* buf, short* speech)
 {
  int i;
-  // encode the frames 
-    speex_bits_reset(&spx_bits_r);   
-    
-    for (i=0;i<spx_frames_per_packet;i++)
+  // encode the frames if speex_e has not done it for this speech
+    if(!spx_rdone)
     {
-     speex_encode_int(spx_enc_state_r, speech+i*spx_frame_size, &spx_bits_r);
+     speex_bits_reset(&spx_bits_r);   
+     for (i=0;i<spx_frames_per_packet;i++)
+     {
+      speex_encode_int(spx_enc_state_r, speech+i*spx_frame_size, &spx_bits_r);
+     }
     }
+    spx_rdone=0;
     
     i=speex_bits_write(&spx_bits_r, (char*)buf, MAX_RDD_LEN);  
     return i;
@@ -464,6 +578,7 @@ void amr_ini(int dtx)
 {
   amrenstate = Encoder_Interface_init(dtx);
   amrdestate = Decoder_Interface_init();
+  amr_rn=0;
 }
 //*****************************************************************************
 //AMR finalization
@@ -473,6 +588,110 @@ void amr_fin(void)
  if(amrdestate) Decoder_Interface_exit(amrdestate);
 }
 
+//*****************************************************************************
+//AMR partial redundancy: packet of len bytes in bf gets class A bits of the
+//trailing speech frames of previous packet (as many as fit in 127 data bytes)
+//and one last byte: bits 6-4 their mode, bits 3-0 their number.
+//Old decoders skip it as they stop after fpp frames.
+//Called only with AMR_redundancy on.
+//Keeps class A bits of this packet for the next one, returns new length
+static int amr_rdd(unsigned char* bf, int len)
+{
+ unsigned char rb[AMR_RDD_LEN]; //class A bits of this packet
+ unsigned char md=0x07&(bf[1]>>3); //mode of this packet
+ unsigned char* bp=bf+2; //first frame block
+ int n=0, sz=amr_rdd_size[md];
+
+ //class A bits of trailing speech frames of this packet
+ while(bp<bf+len)
+ {
+  if(1&bp[0]) //SID block breaks the speech
+  {
+   n=0;
+   bp+=5;
+  }
+  else
+  {
+   AMR_classA(md, bp, rb+n*sz);
+   n++;
+   bp+=amr_block_size[md];
+  }
+ }
+
+ //add kept frames of previous packet: the last ones are closest to this packet
+ if(amr_rn)
+ {
+  int i=(MAX_PKT_LEN-len-1)/amr_rdd_size[amr_rmd]; //frames fitting the packet
+  if(i>amr_rn) i=amr_rn;
+  if(i>0)
+  {
+   memcpy(bf+len, amr_rb+(amr_rn-i)*amr_rdd_size[amr_rmd], i*amr_rdd_size[amr_rmd]);
+   len+=i*amr_rdd_size[amr_rmd];
+   bf[len++]=(amr_rmd<<4)|i;
+  }
+ }
+
+ memcpy(amr_rb, rb, n*sz);
+ amr_rn=n;
+ amr_rmd=md;
+
+ bf[0]=len-1; //data length
+ return len;
+}
+
+//*****************************************************************************
+//AMR partial redundancy: previous packet was lost, decode its trailing
+//frames from class A bits carried in packet bf of fpp frames, conceal the
+//others. The lost packet is taken as long as this one or as the carried
+//frames if more (packet length could change between them).
+//returns number of outputted samples (0 if packet carries nothing)
+static int amr_rdd_dec(short* sp, unsigned char* bf, int fpp)
+{
+ unsigned char blk[32]; //rebuilt speech block
+ unsigned char md=0x07&(bf[1]>>3); //mode of this packet
+ unsigned char* bp=bf+2; //first frame block
+ unsigned char* end=bf+1+(0x7F&bf[0]); //end of packet data
+ int i, n, sz;
+ short* spr=sp;
+
+ //skip frames of this packet
+ for(i=0; i<fpp; )
+ {
+  if(bp>=end) return 0;
+  if(1&bp[0]) //SID block replayed by its counter
+  {
+   i+=((0x1F&bp[0])+1)>>1;
+   bp+=5;
+  }
+  else
+  {
+   i++;
+   bp+=amr_block_size[md];
+  }
+ }
+
+ //check the tail
+ if(bp>=end) return 0;
+ n=0x0F&end[-1];
+ md=0x07&(end[-1]>>4);
+ sz=amr_rdd_size[md];
+ if((!n)||(n>AMR_FPP_MAX)||(bp+n*sz+1!=end)) return 0;
+ if(fpp<n) fpp=n; //frames of lost packet
+
+ for(i=0; i<fpp; i++)
+ {
+  if(i<fpp-n) AMR_decode(amrdestate, md, 0, spp, 1); //no data: conceal
+  else
+  {
+   AMR_classA_serial(md, bp, blk);
+   AMR_decode(amrdestate, md, blk, spp, 2); //degraded
+   bp+=sz;
+  }
+  spr+=speex_r(spp, spr, 160, crate);
+ }
+ return spr-sp;
+}
+
 
 ///*
 //--------------------------------GSM_FR-----------------------------
@@ -506,6 +725,7 @@ void gsm_s(unsigned char *bf, short *sp)
 //initialisation GSM_HR codec
 void gsmhr_ini(short isDTX)
 { 
+ gsmhr_dtx=(isDTX!=0);
  gsmhd = gsmhr_init(isDTX);
 }
  //*****************************************************************************
@@ -623,7 +843,9 @@ void lpc10_d(unsigned char* in, short* out)
 // Initialise LPC codec
 void lpc_i(void)
 {
- if (!lpc_start()) 
+ lpca=lpc_start();
+ lpcva=lpc_start();
+ if((!lpca)||(!lpcva))
  {
   fprintf(stderr, "Cannot allocate LPC decoding memory.\n");
   return;
@@ -636,7 +858,7 @@ void lpc_i(void)
 void lpc_e(unsigned char* buf, short* speech)
 {
         lpcparams_t lp;   
-	lpc_analyze(speech, &lp);
+	lpc_analyze(lpca, speech, &lp);
         memcpy((char*)buf, &lp, LPCRECSIZE);
 }
 //*****************************************************************************
@@ -653,7 +875,7 @@ void lpc_v(short* speech, unsigned char mode)
  {
   lpcparams_t lp;
 
-  lpc_analyze(speech, &lp); //analyse speech
+  lpc_analyze(lpcva, speech, &lp); //analyse speech
   //change pitch descriptor
   if(mode==3) lp.period+=20; //pitch up
   else if(mode==2) lp.period-=20; //pitch down
@@ -666,7 +888,10 @@ void lpc_v(short* speech, unsigned char mode)
 //Finalize LPC 
 void lpc_f(void)
 {
- lpc_end();
+ lpc_end(lpca);
+ lpc_end(lpcva);
+ lpca=0;
+ lpcva=0;
 }
 //*****************************************************************************
 ///*
@@ -741,16 +966,22 @@ int codec_type(unsigned char* bf)
  
 //VBR CODECS: first byte is: bit7=0 and 7 bits is total data length,
 // checks second byte for VBR codec type:
-//SILK: 11 + 6_extra_data_bits
+//SKP: 11 + 6_extra_data_bits (SILK of older builds, not decoded)
 //OPUS: 10 + 6_bit_length_of_second_frame
 //AMR: 01 + 3 bits (mode) + 3 bits (fpp-3)
 //SPEEX: 00 + 00 + 4_extra_data_bits
+//CBR with adaptive frames per packet: 00 + 01 + 4_bits_codec_type
+//SILK: 00 + 10 + 2_reserved_bits + 2_bits_frames
+//DTX SID: 00 + 11 (see dtx.c)
+//older builds take SILK packets for SPEEX
  if(bf[1]&0x80) 
  {
-  if(bf[1]&0x40) return(CODEC_SILK); 
+  if(bf[1]&0x40) return(CODEC_SKP); 
   return(CODEC_OPUS);
  }
  if(bf[1]&0x40) return(CODEC_AMRV);
+ if((bf[1]&0x30)==0x10) return(bf[1]&0x0F);
+ if((bf[1]&0x30)==0x20) return(CODEC_SILK);
  return(CODEC_SPEEX);
 }
 
@@ -764,41 +995,85 @@ int codec_len(int cdk)
 
 
 //*****************************************************************************
-//encode speech to compleet internet packet
-//using global encoder settings
+//returns frames per packet of encoder for codec cd (fpp=0 for default)
+static int pk_fpp(int cd, int fpp)
+{
+ if(fpp>0) return fpp;
+ if(cd==CODEC_AMRV) return amrfpp;
+ return frm_ppk[cd];
+}
+
+
+//*****************************************************************************
+//returns frames in received packet of CBR codec cd wrapped to VBR form by
+//its data length, 0 if the sender could not produce it (longer than
+//PK_MAX, see pk_adjust) or codec is never wrapped
+static int wrap_fpp(int cd, unsigned char* bf)
+{
+ int fpp;
+
+ if(cd<CODEC_CODEC21) return 0; //codecs with extra bits in header byte are not wrapped
+ fpp=((0x7F&bf[0])-1)/buf_len[cd];
+ if(fpp*frm_len[cd]>8*PK_MAX) return 0;
+ return fpp;
+}
+
+
+//*****************************************************************************
+//returns speech length in samples of received voice packet
+static int pkt_len(unsigned char* bf)
+{
+ int cd=codec_type(bf);
+
+ if(cd==CODEC_AMRV) return 160*(3+(0x07&bf[1]));
+ //CBR codec wrapped to VBR form: frames number by data length
+ if((!(0x80&bf[0]))&&(cd<CODEC_OPUS)) return frm_len[cd]*wrap_fpp(cd, bf);
+ return codec_len(cd);
+}
+
+
+//*****************************************************************************
+//encode speech to compleet internet packet by codec cd with fpp frames
+//(0 for codec default) using global settings of this codec
 //returns buffer length in bytes including first type/len byte
-int sp_encode(short* sp, unsigned char* bf)
+static int sp_enc(int cd, int fpp, short* sp, unsigned char* bf)
 {
- int i, l, fpp;
+ int i, l;
  unsigned char dtxcnt=0;
  unsigned char* bp=bf+1; //pointer to encodec data ares
  
- bf[0]=0x80|((unsigned char)enc_type&0x0F); //set codec type for cbr
+ bf[0]=0x80|((unsigned char)cd&0x0F); //set codec type for cbr
  
- if(enc_type==CODEC_AMRV)
+ fpp=pk_fpp(cd, fpp); //frames in this packet
+ if(cd==CODEC_AMRV)
  {
-  fpp=amrfpp; //sets frame per packets for amr_vbr
   l=amr_block_size[(int)amrmode]; //set encode block size
-  bp[0] = 0x40 | (amrmode<<3) | (amrfpp-3); //first packets byte: flag, mode, fpp
+  bp[0] = 0x40 | (amrmode<<3) | (fpp-3); //first packets byte: flag, mode, fpp
   bp++; //amr data from next byte 
   bf[0]=1; //initialize length byte
  }
  else
  {
-  fpp=frm_ppk[enc_type]; //frames per packet for other cbr codecs
-  l=buf_len[enc_type]; //encoded frames fixed length for cbr or 0 for vbr
+  l=buf_len[cd]; //encoded frames fixed length for cbr or 0 for vbr
+  if(fpp!=frm_ppk[cd]) //adapted frames per packet: VBR form with codec type in second byte
+  {
+   bf[0]=1+fpp*l; //data length
+   bp[0]=0x10|cd;
+   bp++;
+  }
  }
 
  //process frames
  for(i=0; i<fpp; i++) 
  {
   //encode one frame
-  switch(enc_type)
+  switch(cd)
   {
    //adaptive
    case CODEC_AMRV:
 	{
 	 l=AMR_encode( amrenstate, amrmode, sp, bp, amrcbr );
+	 if(!amrcbr) cd_vad=(l!=5); //VAD1 decision with hangover
 	 if(l==5) //SID block
 	 {
 	  if(dtxcnt) bp-=5; //skip this block for SID_update
@@ -826,7 +1101,7 @@ int sp_encode(short* sp, unsigned char* bf)
 
    case CODEC_MELPE: 
 	{
-	 melpe_a(bp, sp); //result is 81 bits in 11 bytes
+	 melpe_a(melpee, bp, sp); //result is 81 bits in 11 bytes
 	 bf[0]<<=1;        //roll last bits of previous frames
 	 bf[0]|=bp[l];    //pack last bit to type byte
 	 bf[0]|=0xC0;	  //set melpe type flag  
@@ -848,14 +1123,18 @@ int sp_encode(short* sp, unsigned char* bf)
    case CODEC_LPC: lpc_e(bp, sp);
 	break;
    ///*
-   case CODEC_GSMH: gsmhr_a(sp, bp);
+   case CODEC_GSMH: 
+	 l=gsmhr_a(sp, bp); //3 for speech, VAD flag is forced without DTX
+	 if(gsmhr_dtx) cd_vad=(l==3);
+	 l=buf_len[cd];
 	break;
-   case CODEC_G723: g723_e(sp, bp);
+   case CODEC_G723: g723_e(g723e, sp, bp);
 	break;
-   case CODEC_G729: g729enc(sp, bp);
+   case CODEC_G729: g729enc(g729e, sp, bp);
 	break;
    //*/
-   case CODEC_GSME: gsmer_encode(bp, sp);        
+   case CODEC_GSME: 
+	 cd_vad=(gsmer_encode(bp, sp)==3); //VAD and SP flags set: speech
 	break;
    ///*
    case CODEC_GSM: gsm_a(sp, bp);
@@ -881,8 +1160,8 @@ int sp_encode(short* sp, unsigned char* bf)
 	break;
    case CODEC_SILK: //single frame 480 samples (60mS) to 42-96 bytes
 	{
-	 l=SILK8_encode (sp, bp); //once
-	 bp[0]|=0xC0; //set SILK type flag 11
+	 l=SILK8_encode (silk, sp, bp); //once
+	 bp[0]|=0x20; //set SILK type 0010
 	 bf[0]=l&0x7F; //frame length
 	}
 	break;
@@ -901,21 +1180,106 @@ int sp_encode(short* sp, unsigned char* bf)
   } //switch(cd)
   
   bp+=l; //add output data length to data pointer
-  sp+=frm_len[enc_type]; //add input frame length to speach pointer
+  sp+=frm_len[cd]; //add input frame length to speach pointer
  } //for(i
  
- return (int)(bp-bf); //return total packet length in bytes
+ l=(int)(bp-bf); //total packet length in bytes
+ if(cd==CODEC_AMRV) bf[0]=l-1; //data length (SID update overwrites SID block)
+ if((cd==CODEC_AMRV)&&amrrdd) l=amr_rdd(bf, l); //add class A bits of previous packet
+ else amr_rn=0; //redundancy is off or previous packet is not AMR
+ return l;
 } 
 
 
+//*****************************************************************************
+//set complexity of encoders for level (0 - CX_LEVELS-1)
+static void cx_apply(int lv)
+{
+ int i;
+
+ if(enc) opus_encoder_ctl(enc, OPUS_SET_COMPLEXITY(cx_opus[lv]));
+ if(silk) SILK8_complexity(silk, cx_silk[lv]);
+ i=cx_speex[lv];
+ if(spx_enc_state) speex_encoder_ctl(spx_enc_state, SPEEX_SET_COMPLEXITY, &i);
+ if(spx_enc_state_r) speex_encoder_ctl(spx_enc_state_r, SPEEX_SET_COMPLEXITY, &i);
+ cx_level=lv;
+}
+
+
+//*****************************************************************************
+//encode packet and govern complexity: encoding time is measured against the
+//duration of the packet (its capture deadline), complexity steps down on
+//overload and up after a few intervals with spare time
+static int cx_enc(int cd, int fpp, short* sp, unsigned char* bf)
+{
+ unsigned long long t, span;
+ unsigned int ms;
+ int l, lv;
+
+ if(!cx_auto) return sp_enc(cd, fpp, sp, bf);
+ t=ophh_trace_ns();
+ l=sp_enc(cd, fpp, sp, bf);
+ t=ophh_trace_ns()-t;
+ span=125000ULL*frm_len[cd]*pk_fpp(cd, fpp); //packet duration at 8 KHz, nS
+ cx_busy+=t;
+ cx_span+=span;
+
+ lv=cx_level;
+ ms=getms();
+ if(1000*t>CX_OVER*span) lv--; //deadline almost missed
+ else if((int)(ms-cx_check)>=CX_CHECK)
+ {
+  if(1000*cx_busy>CX_HIGH*cx_span) lv--;
+  else if(1000*cx_busy>=CX_LOW*cx_span) cx_quiet=0;
+  else if(++cx_quiet>=CX_HOLD) //spare time long enough
+  {
+   cx_quiet=0;
+   lv++;
+  }
+ }
+ else return l;
+
+ //new interval after each check or step
+ cx_check=ms;
+ cx_busy=0;
+ cx_span=0;
+ if(lv<0) lv=0;
+ if(lv>=CX_LEVELS) lv=CX_LEVELS-1;
+ if(lv<cx_level) cx_quiet=0;
+ if(lv!=cx_level) cx_apply(lv);
+ return l;
+}
+
+
+//*****************************************************************************
+//report complexity level after change
+static void cx_report(void)
+{
+ if(cx_shown==cx_level) return;
+ cx_shown=cx_level;
+ web_printf("Complexity=%d%s\r\n", cx_shown, cx_auto?" (auto)":"");
+}
+
+
+//*****************************************************************************
+//encode speech to compleet internet packet
+//using global encoder settings
+//returns buffer length in bytes including first type/len byte
+int sp_encode(short* sp, unsigned char* bf)
+{
+ return cx_enc(enc_type, enc_fpp, sp, bf);
+}
+
+
 //*****************************************************************************
 //decode buffer to speech: determine codec from packet but use global
 //settings for amr mode 
 //adjust rate of outputting using global crate setting
 //returns number of speech samples after rate adjusting
-int sp_decode(short* sp, unsigned char* bf)
+static int sp_dec(short* sp, unsigned char* bf)
 {
  int i, l, m, fpp;
+ unsigned long long t;
  unsigned char amrmd=0; //default mode for amc codec
  unsigned char* bp=bf+1; //pointer to codecs block (skip header byte)
  short* spr=sp; //pointer to ouputted speech block
@@ -930,6 +1294,18 @@ int sp_decode(short* sp, unsigned char* bf)
   l=amr_block_size[(int)amrmd]; ////encoded frames length for this mode 
   fpp = 3 + (0x07&bf[1]); //amr frames in packet
   bp++;
+  if(redundant) //single packet lost: play it from class A bits carried here
+  {
+   spr+=amr_rdd_dec(spr, bf, fpp);
+   redundant=0; //clear packetloss flag
+  }
+ }
+ else if((!(0x80&bf[0]))&&(cd<CODEC_OPUS)) //CBR codec wrapped to VBR form
+ {
+  fpp=wrap_fpp(cd, bf); //frames in packet by data length
+  if(!fpp) return 0;
+  l=buf_len[cd];
+  bp++;
  }
  else
  {
@@ -979,7 +1355,7 @@ int sp_decode(short* sp, unsigned char* bf)
 	{
 	 unsigned char t=bp[10]; //store first byte of next frame
 	 bp[10]=(bf[0]>>5)&1; //extract last bit of frame, place to last byte as bit 0
-     melpe_s(spp, bp); //decode 81bits in 11 bytes
+     melpe_s(melped, spp, bp); //decode 81bits in 11 bytes
 	 bp[10]=t; //restore first byte of next frame
 	 bf[0]<<=1; //roll frames last bits coneiner (byte 0 of packet)
 	}
@@ -1001,9 +1377,9 @@ int sp_decode(short* sp, unsigned char* bf)
    ///*
    case CODEC_GSMH: gsmhr_s(bp, spp);
 	break;
-   case CODEC_G723: g723_d(bp, spp);
+   case CODEC_G723: g723_d(g723d, bp, spp);
 	break;
-   case CODEC_G729: g729dec(bp, spp);
+   case CODEC_G729: g729dec(g729d, bp, spp);
 	break;
    //*/
    case CODEC_GSME: gsmer_decode(spp, bp);
@@ -1028,10 +1404,13 @@ int sp_decode(short* sp, unsigned char* bf)
    case CODEC_SILK: //one block for 60 mS speech
 	{
 	 l=bf[0]; //block length
-	 bp[0]&=0x3F; //mask SILK flag
- 	 SILK8_decode (spp, bp, l); //decode whole block
+	 bp[0]&=0x0F; //mask SILK type
+ 	 SILK8_decode (silk, spp, bp, l); //decode whole block
 	}
-  	break;       //SPEEX: one block for 40 ms redundant + one block for 40 ms speech
+  	break;
+   case CODEC_SKP: //SKP SDK stream of older builds: no decoder, silence
+	memset(spp, 0, frm_len[cd]*sizeof(short));
+	break;       //SPEEX: one block for 40 ms redundant + one block for 40 ms speech
 
    //*/
 
@@ -1059,13 +1438,32 @@ int sp_decode(short* sp, unsigned char* bf)
   }  
   bp+=l; //add data length (pointer to next data frame)
   //if(speex_rs)
+  t=OPHH_TRACE_T();
   m=speex_r(spp, spr, frm_len[cd], crate); //rate adjusting: return new speech length
+  OPHH_TRACE(trc_dec, OPHH_TR_RESAMPLE, t);
   //else m=RateChange(spp, spr, frm_len[cd], crate);
   spr+=m; //add speech length (pointer to next speech frame for output)
  }
  return spr-sp; //returns total number of outputted speech samples
 }
 //*****************************************************************************
+//decode buffer to speech (see sp_dec)
+//serialized with encoder worker: some codecs share states for both directions
+//caller sets trc_dec to trace id of the packet
+int sp_decode(short* sp, unsigned char* bf)
+{
+ int l;
+ unsigned long long t=OPHH_TRACE_T();
+
+ if(enc_run) ophh_mutex_lock(&cd_lock);
+ l=sp_dec(sp, bf);
+ if(enc_run) ophh_mutex_unlock(&cd_lock);
+ OPHH_TRACE(trc_dec, OPHH_TR_DECODE, t);
+ trc_play=trc_dec;
+ trc_wait=1;
+ return l;
+}
+//*****************************************************************************
 
 
 //-----------------------Jitter buffer----------------------------------
@@ -1090,6 +1488,21 @@ int playjit(void)
  //get number of unplayed samples in alsa buffer
  if(rx_flg1<50) sdelay=getdelay();
 
+ //Comfort noise fills pauses of remote DTX instead of underruns
+ if(rx_flg && (sdelay<chunk) && (!l_jit_buf))
+ {
+  i=2*chunk;
+  if(i<320) i=320;
+  if(i>JIT_BUF_LEN) i=JIT_BUF_LEN;
+  i=dtx_noise(jit_buf1, i);
+  if(i) 
+  {
+   i=soundplay(i, (unsigned char*)(jit_buf1));
+   if(i>0) sdelay+=i;
+   job=0x80;
+  }
+ }
+
  //Sound Underrun
 
  if(rx_flg && (sdelay<chunk))
@@ -1128,6 +1541,11 @@ int playjit(void)
  {
   i=soundplay(l_jit_buf, (unsigned char*)(p_jit_buf)); //returns number of played samples
   if(i) job+=0x200;
+  if(trc_wait && (i>0)) //first samples of decoded packet will be heard after device delay
+  {
+   if(ophh_trace_on) ophh_trace_mark(trc_play, OPHH_TR_PLAY, ophh_trace_ns()+125000ULL*sdelay);
+   trc_wait=0;
+  }
   if(i<=0) i=0; //must play againbif underrun (PTT mode etc.)
   l_jit_buf-=i; //number of unplayed samples
   p_jit_buf+=i; //pointer to unplayed samples
@@ -1168,6 +1586,67 @@ int vox(short* speech, int len, char level, char hist)
  return Vad_cnt;
 }
 
+//*****************************************************************************
+//First tier of VAD: frame energy against tracked noise floor and zero-crossings
+//returns 0 for clear silence, 1 for clear speech, -1 if undecided
+static int vad_cheap(short* speech, int len)
+{
+ int i, zc=0;
+ float e=0;
+
+ for(i=0;i<len;i++) e+=(float)speech[i]*speech[i];
+ for(i=1;i<len;i++) zc+=((speech[i]^speech[i-1])<0);
+ e/=len; //mean square
+ //noise floor: minimum of frame energies over the window
+ i=(vad_nfr/VAD_BLK)%VAD_BLKS; //current block
+ if((!(vad_nfr%VAD_BLK))||(e<vad_min[i])) vad_min[i]=e; //new block or new minimum
+ vad_nfr++;
+ if(vad_nfr>=2*VAD_BLK*VAD_BLKS) vad_nfr-=VAD_BLK*VAD_BLKS; //wrap keeping the window full
+ vad_floor=vad_min[0];
+ for(i=1;(i<VAD_BLKS)&&(i*VAD_BLK<vad_nfr);i++)
+  if(vad_min[i]<vad_floor) vad_floor=vad_min[i];
+ if(vad_floor<16) vad_floor=16; //digital silence
+ if(e<3*vad_floor) return 0; //less than 5dB over noise
+ //voiced speech: over 15dB and less than 1 crossing per 4 samples (2 kHz)
+ if((e>30*vad_floor)&&(4*zc<len)) return 1;
+ return -1; //weak or noise-like: let spectral stage decide
+}
+
+//*****************************************************************************
+//Tiered VAD and preprocess of the frame in place (send is nonzero if frame will be transmitted)
+//Full speex preprocessor runs only if frame needs denoise/agc or first tier is unsure.
+//Codec's own VAD is used instead of spectral stage while transmitting with DTX codecs
+//returns vad counter of previous inactive frames (0 if frame is active)
+static int vad_run(short* speech, int len, int send)
+{
+ int i;
+ char pp=(spx_denoise||spx_agc); //preprocessing of sended speech required
+
+ if(send && pp) return speex_n(speech, len); //preprocessor runs anyway
+ i=vad_cheap(speech, len);
+ if(i>0) //clear speech
+ {
+  vad_quiet=0;
+  if(pp) speex_n(speech, len); //frame will be transmitted: denoise it
+  Vad_cnt=0;
+  return 0;
+ }
+ if(!i) //clear silence
+ {
+  //keep noise estimation of preprocessor alive
+  if(pp && !(++vad_quiet&7)) speex_n(speech, len);
+  Vad_cnt++;
+  return Vad_cnt;
+ }
+ vad_quiet=0;
+ if(send && (cd_vad>=0)) //encoder's VAD/DTX knows better than the cheap one
+ {
+  if(cd_vad) Vad_cnt=0; else Vad_cnt++;
+  return Vad_cnt;
+ }
+ return speex_n(speech, len); //spectral stage
+}
+
 //*****************************************************************************
 
 
@@ -1252,6 +1731,129 @@ RateChange(short *src, short *dest, int srcLen, int destRate)
 
 
 
+//==================================================================================
+//                           Encoder pipeline
+//==================================================================================
+
+//Optional worker thread for packet encoding. Main thread reserves a slot,
+//copies speech of compleet packet to it and pass it to worker, then polls
+//for encoded packets and sends them in the same order. Slots circulate
+//free -> full -> done -> free, so queues are bounded by ENC_JOBS:
+//if all slots are busy main thread keeps samples in input buffer (back-pressure)
+
+//worker: encode queued packets
+static void enc_work(void* arg)
+{
+ int i=0;
+ EncJob* job;
+
+ (void)arg;
+ while(1)
+ {
+  ophh_sem_wait(&enc_full); //wait for packet
+  if(enc_stop) break;
+  job=enc_job+i;
+  if(job->cd>=0) //encode speech, ready packets pass as is
+  {
+   unsigned long long t=OPHH_TRACE_T();
+   ophh_mutex_lock(&cd_lock);
+   job->len=cx_enc(job->cd, job->fpp, job->sp, job->pkt);
+   ophh_mutex_unlock(&cd_lock);
+   OPHH_TRACE(job->id, OPHH_TR_ENCODE, t);
+  }
+  i=(i+1)%ENC_JOBS;
+  ophh_sem_post(&enc_done); //packet is ready for sending
+ }
+}
+
+
+//*****************************************************************************
+//start encoder worker if enabled in config
+static void enc_init(void)
+{
+ int i;
+
+ if(!enc_thread) return;
+ enc_stop=0;
+ enc_put=0;
+ enc_get=0;
+ enc_slot=0;
+ ophh_mutex_init(&cd_lock);
+ i=ophh_sem_init(&enc_free, ENC_JOBS);
+ if(!i) i=ophh_sem_init(&enc_full, 0);
+ if(!i) i=ophh_sem_init(&enc_done, 0);
+ if(!i) i=ophh_thread_start(&enc_tid, enc_work, 0);
+ if(i)
+ {
+  web_printf("Encoder thread not started, using main thread\r\n");
+  return;
+ }
+ enc_run=1;
+}
+
+
+//*****************************************************************************
+//stop encoder worker, unsended packets are dropped
+static void enc_fine(void)
+{
+ if(!enc_run) return;
+ enc_stop=1;
+ ophh_sem_post(&enc_full); //wake up worker
+ ophh_thread_join(&enc_tid);
+ enc_run=0;
+ ophh_sem_free(&enc_free);
+ ophh_sem_free(&enc_full);
+ ophh_sem_free(&enc_done);
+ ophh_mutex_free(&cd_lock);
+}
+
+
+//*****************************************************************************
+//reserve free slot for next packet, returns 0 if all slots are busy
+static int enc_reserve(void)
+{
+ if(!enc_slot) enc_slot=ophh_sem_trywait(&enc_free);
+ return enc_slot;
+}
+
+
+//*****************************************************************************
+//pass speech (cd>=0) or ready packet (cd<0) to reserved slot
+static void enc_submit(int cd, short* sp, unsigned char* pkt, int len)
+{
+ EncJob* job=enc_job+enc_put;
+
+ job->cd=cd;
+ job->id=trc_tx++;
+ job->fpp=enc_fpp;
+ if(cd>=0) memcpy(job->sp, sp, 2*frm_len[cd]*pk_fpp(cd, enc_fpp));
+ else
+ {
+  memcpy(job->pkt, pkt, len);
+  job->len=len;
+ }
+ enc_put=(enc_put+1)%ENC_JOBS;
+ enc_slot=0;
+ ophh_sem_post(&enc_full);
+}
+
+
+//*****************************************************************************
+//get next encoded packet, returns its length or 0 if no one is ready
+static int enc_receive(unsigned char* pkt)
+{
+ int l;
+
+ if(!ophh_sem_trywait(&enc_done)) return 0;
+ l=enc_job[enc_get].len;
+ trc_out=enc_job[enc_get].id;
+ memcpy(pkt, enc_job[enc_get].pkt, l);
+ enc_get=(enc_get+1)%ENC_JOBS;
+ ophh_sem_post(&enc_free);
+ return l;
+}
+
+
 //==================================================================================
 //                           Top level procedures
 //==================================================================================
@@ -1267,7 +1869,10 @@ void sp_init(void)
  cd21=codec2_create(CODEC2_MODE_1400);
  cd22=codec2_create(CODEC2_MODE_3200);
  //*/
- melpe_i();
+ melpee=melpe_enc_init();
+ melped=melpe_dec_init();
+ melpen=melpe_npp_init();
+ melpenf=melpe_nppf_init();
  ///*
  celp_init(0);
  lpc10_i();
@@ -1280,18 +1885,24 @@ void sp_init(void)
 
  lpc_i();
  ///*
- g729ini(1, 0); //rate: G729D(63)=0,G729(80)=1,G729E(118)=2, dtx: 0/1
- g723_i(0, 0);  //0-rate63, 1-rate53; dtx0/1
+ g729e=g729_enc_init(1, 0); //rate: G729D(63)=0,G729(80)=1,G729E(118)=2, dtx: 0/1
+ g729d=g729_dec_init(1, 0); //same rate and dtx as the encoder
+ g723e=g723_enc_init(0, 0);  //0-rate63, 1-rate53; dtx0/1
+ g723d=g723_dec_init();
  ilbc_i(1); //0-20mS/15.2kbps, 1-30mS/13.3kbps
  bv16_i();
  //*/
  gsmer_init(1); //dtx0/1
  ///*
- SILK8_open (3); //frames_per_packet (1-5)
+ silk=SILK8_open (3); //frames_per_packet (1-3)
  //*/
  speex_p(1,1); //set denoise and agc
 
  amr_ini(1); //dtx0/1
+
+ cx_apply(cx_level); //encoders complexity
+
+ enc_init(); //start encoder worker (if enabled)
 }
 
 
@@ -1299,6 +1910,7 @@ void sp_init(void)
 //group codecs finalization
 void sp_fine(void)
 {
+ enc_fine(); //stop encoder worker first
  ///*
  gsm_fin();
  gsmhr_fin();
@@ -1310,7 +1922,19 @@ void sp_fine(void)
  lpc_f();
  ///*
  ilbc_f();
- SILK8_close();
+ g723_enc_exit(g723e);
+ g723_dec_exit(g723d);
+ g723e=0; g723d=0;
+ g729_enc_exit(g729e);
+ g729_dec_exit(g729d);
+ g729e=0; g729d=0;
+ melpe_enc_exit(melpee);
+ melpe_dec_exit(melped);
+ melpe_npp_exit(melpen);
+ melpe_nppf_exit(melpenf);
+ melpee=0; melped=0; melpen=0; melpenf=0;
+ SILK8_close(silk);
+ silk=0;
  //*/
  amr_fin();
 }
@@ -1323,7 +1947,9 @@ int set_encoder(int cd)
  if((cd>=0)&&(cd<19))
  {
   enc_type=cd; //set internal encoder
+  enc_fpp=0; //default packetization until next adaptation
   snd_need=codec_len(enc_type); //samples needed for compleet packet
+  cd_vad=-1; //no own VAD decision from new encoder yet
  }
  web_printf("\r\nCoder=%s\r\n",cd_name[enc_type]); //notify encoder name
  return enc_type;
@@ -1431,6 +2057,7 @@ int go_snd(unsigned char* pkt)
  //if jitter buffer is empty and there is undecoded packet in packets buffer
  while((l_pkt[n_pkt])&&(!l_jit_buf))
  {
+  trc_dec=trc_pkt[n_pkt];
   l_jit_buf=sp_decode(jit_buf, pkt_buf[n_pkt]); //decode packet to jitter buffer
   p_jit_buf=jit_buf; //set popiter to start of buffer
   l_pkt_buf-=l_pkt[n_pkt]; //decrese average total nubber of samples in unplayed buffered packets
@@ -1448,6 +2075,13 @@ int go_snd(unsigned char* pkt)
   job+=0x40;
   //fixes user id of packets sender
   rx_flg=1;
+  //SID of remote DTX: only update comfort noise
+  if(dtx_is_sid(pkt))
+  {
+   dtx_rx(pkt);
+   return job;
+  }
+  dtx_off(); //voice or mute notification stops comfort noise
   //find codec type in received packet
   q2=codec_type(pkt);
   //notify if decoder changed
@@ -1568,6 +2202,7 @@ int go_snd(unsigned char* pkt)
    }
    else i=0; //flag for regullar packet
   //decode incoming packet to jitter buffer 
+   trc_dec=trc_rx;
    l_jit_buf=sp_decode(jit_buf, pkt); //decode new packet in jitter buffer
    if(i) //if first packet after inactivity
    {
@@ -1587,7 +2222,7 @@ int go_snd(unsigned char* pkt)
      if(l_pkt_buf<0) l_pkt_buf=0; //correct total
     }      
      //put undecoded packet to buffer    
-    l_pkt[j]=codec_len(dec_type); //average number of samples in this packet
+    l_pkt[j]=pkt_len(pkt); //number of samples in this packet
     l_pkt_buf+=l_pkt[j]; //add length to total number of buffered samples
  /*
     if(!cmdptr) //!!!!!!!!!!!!!!!debug only!!!!!!!!!!!!!!!!!
@@ -1599,6 +2234,8 @@ int go_snd(unsigned char* pkt)
     //length of added udecoded packet in bytes
     if(0x80&pkt[0]) i=1+frm_ppk[dec_type]*buf_len[dec_type]; else i=(1+pkt[0])&0x7F; 
     memcpy(pkt_buf[j], pkt, i); //copy packet to buffer's slot
+    trc_pkt[j]=trc_rx;
+    OPHH_TRACE(trc_rx, OPHH_TR_QUEUE, 0);
   }
  }
  return job;
@@ -1606,6 +2243,176 @@ int go_snd(unsigned char* pkt)
 
 
 
+//*****************************************************************************
+//adaptive packetization: choose frames per packet for encoder by round trip
+//and losses of the path, measure round trip by quiet pings periodically
+static void pk_adjust(void)
+{
+ unsigned char p[16];
+ unsigned int t, n, lost;
+ int cd=enc_type;
+ int d, fpp, min, max;
+
+ if((!pk_adapt)||(crp_state<3)) //no adaptation: back to codec default
+ {
+  if(enc_fpp)
+  {
+   enc_fpp=0;
+   snd_need=codec_len(enc_type);
+  }
+  return;
+ }
+ t=getms();
+ if((int)(t-pk_ping)>=PK_PING) //measure round trip
+ {
+  pk_ping=t;
+  p[0]=2; //quiet ping request
+  if(do_syn(p)>0) do_send(p, 9, p[0]);
+ }
+ if((int)(t-pk_check)<PK_CHECK) return;
+ pk_check=t;
+ n=rx_pkts-pk_rx; //incoming packets expected since last check
+ lost=rx_lost-pk_lost; //and lost from them
+ pk_rx=rx_pkts;
+ pk_lost=rx_lost;
+
+ //allowed frames per packet for this codec
+ if(cd==CODEC_AMRV)
+ {
+  min=3;
+  max=10;
+ }
+ else if((cd>=CODEC_CODEC21)&&(cd<CODEC_OPUS))
+ {
+  min=1;
+  max=125/buf_len[cd]; //wrapped packet up to 127 bytes with header
+ }
+ else return; //VBR codecs and codecs with extra bits in header byte
+ if(max*frm_len[cd]>8*PK_MAX) max=8*PK_MAX/frm_len[cd];
+
+ //packet duration: Tor prefers fewest cells, direct path follows round trip
+ d=path_kind();
+ if(d==2) d=PK_MAX;
+ else if((d<0)||(!path_rtt)) d=0; //not measured yet: codec default
+ else
+ {
+  d=path_rtt/2; //packetization delay not above one-way latency
+  if(d<PK_MIN) d=PK_MIN;
+  if(d>PK_MAX) d=PK_MAX;
+  if((10*lost>n)&&(d>PK_LOSSY)) d=PK_LOSSY; //lossy path: lose less speech per packet
+ }
+ if(d)
+ {
+  fpp=(8*d+frm_len[cd]/2)/frm_len[cd]; //frames for this duration
+  if(fpp<min) fpp=min;
+  if(fpp>max) fpp=max;
+  if(fpp==pk_fpp(cd, 0)) fpp=0; //default packets in legacy form
+ }
+ else fpp=0;
+
+ if(fpp!=enc_fpp)
+ {
+  enc_fpp=fpp;
+  snd_need=frm_len[cd]*pk_fpp(cd, fpp); //samples needed for next packet
+ }
+}
+
+
+//*****************************************************************************
+//Relay mode: decode packet of foreign codec at nominal rate, decoder of our
+//leg is not used for playing in relay mode. Returns number of samples
+static int bridge_dec(short* sp, unsigned char* pkt)
+{
+ int i, l;
+
+ i=crate;
+ crate=DEFRATE;
+ trc_dec=trc_tx;
+ l=sp_decode(sp, pkt);
+ crate=i;
+ return l;
+}
+
+
+//*****************************************************************************
+//Relay mode: collect speech for our codec and encode compleet packet,
+//returns packets length like do_snd
+static int bridge_enc(short* sp, int l, unsigned char* pkt)
+{
+ int i;
+
+ if(l<=0) return 0;
+ if(l>MAX_SND_LEN) l=MAX_SND_LEN;
+ //no room: drop oldest samples
+ if(l_in+l>MAX_SND_LEN)
+ {
+  i=l_in+l-MAX_SND_LEN;
+  l_in-=i;
+  memmove(in_buf, (char*)(in_buf+i), l_in<<1);
+ }
+ memcpy((char*)(in_buf+l_in), sp, l<<1);
+ l_in+=l;
+ if(l_in<snd_need) return -2; //more samples needed
+ i=sp_encode(in_buf, pkt);
+ l_in-=snd_need;
+ if(l_in) memmove(in_buf, (char*)(in_buf+snd_need), l_in<<1);
+ return i;
+}
+
+
+//*****************************************************************************
+//Relay mode: outgoing packet comes from other call leg (see bridge_init).
+//Packet encoded by our codec is passed as is, others are transcoded
+//to our codec. Returns packets length like do_snd
+static int bridge_pkt(unsigned char* pkt, int len)
+{
+ static short sp[JIT_BUF_LEN]; //decoded speech of foreign codec
+
+ if((pkt[0]==1)||dtx_is_sid(pkt)||(codec_type(pkt)==enc_type)) return len; //mute notify, SID or same codec: forward
+ return bridge_enc(sp, bridge_dec(sp, pkt), pkt);
+}
+
+
+//*****************************************************************************
+//Conference leg: encode mix of other participants received from hub
+//(len bytes of speech), keep hub informed about us while we get nothing
+static int bridge_mix(unsigned char* pkt, int len)
+{
+ static short sp[MIX_FRAME*2]; //aligned copy of speech
+ static unsigned int ka=0; //time of last datagram to hub
+ unsigned char c=0;
+ unsigned int now=getms();
+
+ if((int)(now-ka)>=1000) //keepalive (odd length)
+ {
+  bridge_send(&c, 1);
+  ka=now;
+ }
+ if((len<2)||(len&1)||(len>(int)sizeof(sp))) return 0;
+ memcpy(sp, pkt, len);
+ return bridge_enc(sp, len>>1, pkt);
+}
+
+
+//*****************************************************************************
+//Relay mode: pass voice packet received from our remote to other call leg,
+//as is or (conference leg) as decoded speech. Returns 0 if not in relay mode
+int bridge_voice(unsigned char* pkt, int len)
+{
+ static short sp[JIT_BUF_LEN]; //decoded speech
+ int i, l;
+
+ i=bridge_mode();
+ if(!i) return 0;
+ if(i==1) return bridge_send(pkt, len);
+ if((pkt[0]==1)||dtx_is_sid(pkt)) return 1; //remote muted or in DTX pause: it is silent for hub
+ l=bridge_dec(sp, pkt);
+ for(i=0;i<l;i+=MIX_FRAME) //datagrams of frames
+  bridge_send((unsigned char*)(sp+i), ((l-i<MIX_FRAME) ? l-i : MIX_FRAME)<<1);
+ return 1;
+}
+
+
 //*****************************************************************************
 //Grab and encode sound for outgoing packet:
 //Poll and grab alsa, preprocess 160 sampless, collect it for compleet 
@@ -1613,27 +2420,59 @@ int go_snd(unsigned char* pkt)
 int do_snd(unsigned char *pkt)
 {
  int i;
+ short* fr; //current frame: grabbed and preprocessed in place in the input buffer
+ unsigned long long t;
+ //pipelined encoding: send packets encoded by worker first
+ if(enc_run)
+ {
+  i=enc_receive(pkt);
+  if(i) return i;
+ }
+ //relay mode: sound device is not used for call
+ i=bridge_recv(pkt);
+ if(i>=0)
+ {
+  if(bridge_mode()>1) i=bridge_mix(pkt, i); //conference leg
+  else if(i) i=bridge_pkt(pkt, i);
+  if(i>1) trc_out=trc_tx++;
+  return i;
+ }
  //check state for activation of audio input
  soundrec((crp_state>2)||(sound_loop));
- //grab sound input device up to RawBufSize samples
- l_raw+=soundgrab((char*)(raw_buf+l_raw), RawBufSize-l_raw); //l_raw = actually grabbed samples
+ //pipeline is stuck: drop oldest samples for room to new frame
+ if(l_in+RawBufSize>MAX_SND_LEN)
+ {
+  i=(l_in>snd_need)?snd_need:l_in;
+  l_in-=i;
+  memmove(in_buf, (char*)(in_buf+i), (l_in+l_raw)<<1);
+ }
+ //grab sound input device up to RawBufSize samples directly behind collected ones
+ fr=in_buf+l_in;
+ l_raw+=soundgrab((char*)(fr+l_raw), RawBufSize-l_raw); //l_raw = actually grabbed samples
  if(l_raw<RawBufSize) return 0; //grab for RawBufSize samples (one frame ready for preprocessing)
- //now we have exectly RawBufSize samples in raw buffer
+ //now we have exectly RawBufSize samples in frame
  l_raw=0; //pass it to process
+ OPHH_TRACE(trc_tx, OPHH_TR_CAPTURE, 0);
  //we use alsa input clock for periodically playing buffered samles
  //go_snd(0); //periodically (every 20 mS) try to play buffered samples
  //now we have frame ready for preprocessing, check vad or randomize sprng if no TX 
  if(tx_flag||etx_flag||vad_t) //preprocess if actual or estimated tx flag or VAD active
  {
-  if((npp7)&&(enc_type!=CODEC_MELPE)) melpe_n(raw_buf);
-  if(!vox_level) i=speex_n(raw_buf, RawBufSize); //preprocess frame, returns vad counter of previous inactive frames (reset to 0 if frame is active)
-  else i=vox(raw_buf, RawBufSize, vox_level, vox_level/15); //alternative vox (by pcm level)
+  t=OPHH_TRACE_T();
+  if((npp7)&&(enc_type!=CODEC_MELPE)) //own instance, no lock
+  {
+   if(npp7==2) melpe_n(melpen, fr); //fixed point, 180 samples
+   else melpe_nf(melpenf, fr, RawBufSize);
+  }
+  if(!vox_level) i=vad_run(fr, RawBufSize, tx_flag||etx_flag); //preprocess frame, returns vad counter of previous inactive frames (reset to 0 if frame is active)
+  else i=vox(fr, RawBufSize, vox_level, vox_level/15); //alternative vox (by pcm level)
   if(i<vad_t)  etx_flag=TX_VAD; //set vad as active if current frame is active or if vad tail
+  OPHH_TRACE(trc_tx, OPHH_TR_PREPROC, t);
  }
  else
  {
   //feed SPRNG
-  randFeed((const uchar*)raw_buf, 2*RawBufSize);
+  randFeed((const uchar*)fr, 2*RawBufSize);
  }
  //change mode and notify
  if((tx_flag!=etx_flag) && etx_flag) //if active mode was setted while current mode was inactive
@@ -1647,7 +2486,9 @@ int do_snd(unsigned char *pkt)
    fflush(stdout);
   }
   tx_flag=etx_flag; //set currrent mode by estimated mode
+  if(l_in) memmove(in_buf, fr, 2*RawBufSize); //current frame is first in input buffer
   l_in=0; //no data in input buffer now, input started
+  fr=in_buf;
  }
  
  //check TX mode and not process frame if mode is not active
@@ -1657,21 +2498,34 @@ int do_snd(unsigned char *pkt)
  {
   l_in=0; //clear length of data in input buffer (reject it)
   if(!tx_note) return -1; //if remote notification required (this is a first skipped packet)
+  //keep order with voice packets still in pipeline
+  if(enc_run && (!enc_reserve())) return -2; //all pipeline slots are busy: notify next time
   tx_note=0; //clear notify flag
   //prepare notify packet
   pkt[0]=1;
   pkt[1]=0;
+  if(enc_run)
+  {
+   enc_submit(-1, 0, pkt, 2);
+   return -1;
+  }
+  trc_out=trc_tx++;
   return 2;
  }
 
  //apply vocoder
- if(sp_voc) lpc_v(raw_buf, sp_voc);
+ if(sp_voc)
+ {
+  if(enc_run) ophh_mutex_lock(&cd_lock);
+  lpc_v(fr, sp_voc);
+  if(enc_run) ophh_mutex_unlock(&cd_lock);
+ }
 
- //add preprocessed frame to input buffer
- memcpy((char*)(in_buf+l_in), raw_buf, 2*RawBufSize); //copy preprocessing samples from raw to input buffer
+ //preprocessed frame is already in place: add it to input buffer
  l_in+=RawBufSize; //total number of samples in input buffer now
  //check input buffer comleet for current encoder type
  if(l_in<snd_need) return -2; //more samles needed
+ if(enc_run && (!enc_reserve())) return -2; //all pipeline slots are busy: wait
  //input buffer ready to encode
  if(!etx_flag)  //check for tx mode was disabled by user and not enabled by vad
  { //only now we can disable transmission but current packet will be transmitted 
@@ -1689,10 +2543,42 @@ int do_snd(unsigned char *pkt)
   }
  }
  else if(etx_flag==TX_VAD) etx_flag=0; //clear etx_flag for next VAD detection in VAD mode
- i=sp_encode(in_buf, pkt); //encode voice to packet
+ //DTX: silent packet in continuous or PTT mode is replaced by rare SID
+ if(sp_dtx && (tx_flag>=TX_PTT))
+ {
+  i=dtx_tx(in_buf, snd_need, (Vad_cnt>=l_in/RawBufSize+CN_HANG), pkt);
+  if(i>=0) 
+  {
+   l_in-=snd_need; //packet is processed
+   if(l_in) memcpy(in_buf, (char*)(in_buf+snd_need), l_in<<1);
+   if(!i) return -2; //nothing to send now
+   //keep order with voice packets still in pipeline
+   if(enc_run)
+   {
+    enc_submit(-1, 0, pkt, i);
+    return -2;
+   }
+   trc_out=trc_tx++;
+   return i;
+  }
+ }
+ if(enc_run) //pass to worker, encoded packet will be returned later
+ {
+  enc_submit(enc_type, in_buf, 0, 0);
+  i=-2;
+ }
+ else
+ {
+  t=OPHH_TRACE_T();
+  i=sp_encode(in_buf, pkt); //encode voice to packet
+  OPHH_TRACE(trc_tx, OPHH_TR_ENCODE, t);
+  trc_out=trc_tx++;
+ }
  //if(i<2) i=-3; //edcoding error
  l_in-=snd_need;  //number residual (unencoded) samples in buffer(pass for next packet)
  if(l_in) memcpy(in_buf, (char*)(in_buf+snd_need), l_in<<1); //copy tail to start of buffer
+ pk_adjust(); //frames per packet for next packet
+ cx_report();
  return i; //returns packet's length in bytes
 }
 
@@ -1748,11 +2634,45 @@ void setaudio(void)
  strcpy(str, "SpeexResampler");
  if(parseconf(str)>0) speex_rs=atoi(str);
 
+ strcpy(str, "EncoderThread");
+ if(parseconf(str)>0) enc_thread=atoi(str); else enc_thread=0;
+
+ strcpy(str, "DTX");
+ if(parseconf(str)>0) sp_dtx=(atoi(str)!=0); else sp_dtx=0;
+
+ strcpy(str, "AdaptivePackets");
+ if(parseconf(str)>0) pk_adapt=(atoi(str)!=0); else pk_adapt=0;
+
+ strcpy(str, "AMR_redundancy");
+ if(parseconf(str)>0) amrrdd=(atoi(str)!=0); else amrrdd=0;
+
+ strcpy(str, "Complexity");
+ if((parseconf(str)>0)&&(str[0]>='0')&&(str[0]<='9'))
+ {
+  i=atoi(str);
+  if(i>=CX_LEVELS) i=CX_LEVELS-1;
+  cx_auto=0;
+ }
+ else
+ {
+  i=cx_level;
+  cx_auto=1;
+ }
+ if(enc_run) ophh_mutex_lock(&cd_lock);
+ cx_apply(i);
+ if(enc_run) ophh_mutex_unlock(&cd_lock);
+ cx_shown=-1; //report actual level
+
  strcpy(str, "NPP7");
  if(parseconf(str)>0) i=atoi(str); else i=0;
- if(i)
+ if(i==2) //fixed point reference works on 180 samples frames
  {
   RawBufSize=180;
+  npp7=2;
+ }
+ else if(i)
+ {
+  if(RawBufSize<128) RawBufSize=160; //floating point one takes 128-240 samples
   npp7=1;
  }
  else npp7=0;
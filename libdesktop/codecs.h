@@ -44,7 +44,9 @@ typedef enum{
 	//vbr codecs
 	CODEC_OPUS, //16: 6000vbr, 480sampl->25/61 bytes, 2fpp(120mS)39-122bytes
 	CODEC_SILK,//17: 10000vbr, 480samp->42->96 bytes, 1fpp(60mS)
-	CODEC_SPEEX //18: 15200vbr, 320 samp->11-75bytes, 1fpp(40mS) 22-86bytes
+	CODEC_SPEEX, //18: 15200vbr, 320 samp->11-75bytes, 1fpp(40mS) 22-86bytes
+	//receive only
+	CODEC_SKP //19: SILK of the SKP SDK (older builds), 480samp, played as silence
 }CodecSet;
 
 //transmit modes
@@ -121,6 +123,7 @@ void playring();
 
 int go_snd(unsigned char* pkt);
 int do_snd(unsigned char *pkt);
+int bridge_voice(unsigned char* pkt, int len);
 
 void setaudio(void);
 
@@ -30,6 +30,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 #include <time.h>
 #include <sys/time.h>
@@ -110,8 +111,8 @@ short pktlen[32]={
  //0 -> -2 -> 2 -> -4 -> 4 for acceptor
  char crp_state=0;
  char invite_tcp=0; //received invite with remote onion address
- unsigned int in_ctr=0; //counter of incoming packets
- unsigned int out_ctr=0; //counter of outgoing packets
+ uint32_t in_ctr=0; //counter of incoming packets (4 bytes on the wire)
+ uint32_t out_ctr=0; //counter of outgoing packets
  int udp_counter=0; //counter of TCP->UDP tries
 
  //from tcp.c
@@ -122,6 +123,10 @@ short pktlen[32]={
  int bad_mac=0; //counter of bad autentificating packets
 
  struct timeval TM;     //time fixation
+ static char syn_quiet=0; //last ping was sent by packetization control: don't print latency
+ int path_rtt=0;         //round trip time measured by last ping, mS (0 if not measured yet)
+ unsigned int rx_pkts=0; //UDP voice/data packets expected by incoming counter
+ unsigned int rx_lost=0; //UDP packets lost from them
  FILE* F=0;              //file for key reading/writing
  FILE* F1=0;
  KECCAK512_DATA spng;  //keccak state: global for perfomance
@@ -136,6 +141,15 @@ unsigned int getmsec(void)
 }
 //*****************************************************************************
 
+//returns timestamp: mS
+unsigned int getms(void)
+{
+     struct timeval tt1;
+     gettimeofday(&tt1, NULL);
+     return (unsigned int) ((tt1.tv_sec)*1000+(tt1.tv_usec)/1000);
+}
+//*****************************************************************************
+
 //returns timestamp: Sec
 int getsec(void)
 {
@@ -677,6 +691,7 @@ void psleep(int paus)
   xmemset(their_x, 0, 64); //clear session public keys
   xmemset(&spng, 0, sizeof(spng));
   xmemset(&TM, 0, sizeof(TM));
+  path_rtt=0; //path of next session is not measured yet
   xmemset(crp_temp, 0, 32);   //clear temporary storage
   crp_state=0;          //set initial state
   in_ctr=0;            //clear counter of incoming packets
@@ -1913,7 +1928,7 @@ void psleep(int paus)
   if(crp_state<3) return 0;
 
   //add packet counter to symmetric encryption key
-  memcpy(session_key+32, &out_ctr, 4);
+  memcpy(session_key+32, &out_ctr, sizeof(out_ctr));
   //add call originator flag (0-originator of call, 1-acceptor)
   if(crp_state==3) session_key[36]=0; else session_key[36]=1;
   //initialise sponge by key and counter  for encryption
@@ -1963,9 +1978,9 @@ void psleep(int paus)
  int go_data(unsigned char* pkt, short len)
  {
   unsigned char type=0;
-  char c=0;
+  signed char c=0; //counter delta, negative values are used (char is unsigned on ARM)
   unsigned char* buf=pkt+1;
-  unsigned int ctr=in_ctr; //current decryption counter
+  uint32_t ctr=in_ctr; //current decryption counter
   unsigned char mac[MACLEN];
 
   //check for incoming packet UDP or TCP (for TCP len<512)
@@ -1998,6 +2013,11 @@ void psleep(int paus)
    }
    //sync our incoming counter by their outgoing counter
    if(c==1) redundant=1; else redundant=0;
+   if(c>0) //count path losses for packetization control
+   {
+    rx_pkts+=c;
+    rx_lost+=c-1;
+   }
    ctr+=c;
   }
 
@@ -2024,7 +2044,7 @@ void psleep(int paus)
   if(crp_state<2) return 0;
 
   //add packet counter to symmetric encryption key
-  memcpy(session_key+32, &ctr, 4);
+  memcpy(session_key+32, &ctr, sizeof(ctr));
   //add originator flag
   if(crp_state==3) session_key[36]=1; else session_key[36]=0;
   Sponge_init(&spng, 0, 0, 0, 0);
@@ -2257,6 +2277,7 @@ void psleep(int paus)
   if( (0x1F&pkt[0])==TYPE_SYN ) pkt[0]|=(TYPE_SYN | 0xA0); //answer
   else if(pkt[0])
   {
+   syn_quiet=(pkt[0]==2); //2 for quiet request of packetization control
    pkt[0]=(TYPE_SYN | 0x80); //request
    gettimeofday(&TM, NULL); //save sending time
   }
@@ -2267,9 +2288,9 @@ void psleep(int paus)
   }
 
    //present our outgoing counter
-  memcpy(pkt+1, &out_ctr, 4);
+  memcpy(pkt+1, &out_ctr, sizeof(out_ctr));
   //add packet counter to symmetric encryption key
-  memcpy(session_key+32, &out_ctr, 4);
+  memcpy(session_key+32, &out_ctr, sizeof(out_ctr));
   //add originator info
   if(crp_state==4) session_key[36]=3; else session_key[36]=2;
   Sponge_init(&spng, 0, 0, 0, 0);
@@ -2296,7 +2317,7 @@ void psleep(int paus)
   //check for status
   if(crp_state<3) return -1;
   //add packet counter to symmetric encryption key
-  memcpy(session_key+32, pkt+1, 4);
+  memcpy(session_key+32, pkt+1, sizeof(uint32_t));
   //add originator info
   if(crp_state==4) session_key[36]=2; else session_key[36]=3;
   Sponge_init(&spng, 0, 0, 0, 0);
@@ -2309,10 +2330,12 @@ void psleep(int paus)
   //check mac
   if(!memcmp(pkt+5, pkt+1, 4))
   {
+   uint32_t ctr;
+
    //check presented conter is greater then our incoming counter
-   if(   (*(unsigned int*)(session_key+32))  >  in_ctr  )
+   memcpy(&ctr, session_key+32, sizeof(ctr));
    //correct out incoming counter for their outgoing counter
-   memcpy(&in_ctr, session_key+32, 4);
+   if(ctr>in_ctr) in_ctr=ctr;
   }
 
   //ckeck for finalize packet
@@ -2331,12 +2354,15 @@ void psleep(int paus)
    t=(int)(time1.tv_usec - TM.tv_usec); //microseconds
    if(t<0) //seconds bondaries
    {
-    t=1000000-t;
+    t+=1000000;
     time1.tv_sec--;
    }
    t/=1000; //to milliseconds
    t+=(1000*(time1.tv_sec-TM.tv_sec)); //add seconds
+   path_rtt=t; //keep two-way time for packetization control
+   if(!path_rtt) path_rtt=1; //measured
    t/=2; //one-way latency is a half of two-way
+   if(syn_quiet) return 0; //automatic ping
    web_printf("Latency is %d mS ", t);
    fflush(stdout);
    return 0; //no answer
@@ -2391,6 +2417,7 @@ void psleep(int paus)
   //wrap procedure for incoming packet type, returns length of our answer or 0
   if(  (type<=TYPE_SPEEX)||(type==TYPE_VBR) )
   {//voice processing
+   if(bridge_voice(pkt, len)) return 0; //relay mode: forwarded to other call leg
    go_snd(pkt); //pass packet to codec wrapper
    return 0;
   }
@@ -70,6 +70,7 @@ typedef enum{
 
  //time tools
  unsigned int getmsec(void);
+ unsigned int getms(void);
  int getsec(void);
  void psleep(int paus);
  //convert packet type and length
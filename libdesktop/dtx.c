@@ -0,0 +1,164 @@
+// Contact: <torfone@ukr.net>
+// Author: Van Gegel
+//
+// THIS IS A FREE SOFTWARE
+//
+// This software is released under GNU LGPL:
+//
+// * LGPL 3.0 <http://www.gnu.org/licenses/lgpl.html>
+//
+// You're free to copy, distribute and make commercial use
+// of this software under the following conditions:
+//
+// * You have to cite the author (and copyright owner): Van Gegel
+// * You have to provide a link to the author's Homepage: <http://torfone.org/>
+//
+///////////////////////////////////////////////
+
+//Codec independent DTX: while the packet to send is silent, no voice is
+//encoded. The first silent packet and then one per CN_UPDATE samples (or on
+//level change) are replaced by a short SID packet carrying level and
+//reflection coefficients of the noise. Receiver plays noise shaped by them
+//on underruns until voice or mute notification comes.
+//SID is a vbr packet of speex type with 0x30 in second byte (speex never
+//sets these bits there): [len=CN_SID_LEN][0x30][level dB][k1]..[k6]
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "crypto.h"
+#include "dtx.h"
+
+#define CN_MARK 0x30 //second byte of SID packet
+#define CN_UPDATE 4000 //samples of silence between SID updates (500 mS)
+#define CN_DELTA 6 //level change in dB forcing SID update
+#define CN_TIMEOUT 2000 //mS without SID before comfort noise stops
+
+//transmitter
+static int cn_lev=-1; //level of last sent SID in dB, -1 if no SID in this silence
+static int cn_wait=0; //samples of silence since last SID
+
+//receiver
+static float cn_a[CN_ORDER]; //synthesis filter of comfort noise
+static float cn_mem[CN_ORDER]; //filter memory
+static float cn_g=0; //actual excitation gain
+static float cn_gt=0; //excitation gain from last SID
+static unsigned int cn_time=0; //time of last SID, 0 if comfort noise is off
+
+//*****************************************************************************
+//Transmitter side: process speech packet of len samples
+//silent is nonzero if all frames of packet are inactive
+//returns -1 for voice (must be encoded), 0 for nothing to send or SID length in pkt
+int dtx_tx(short* sp, int len, int silent, unsigned char* pkt)
+{
+ int i, j, lev;
+ float r[CN_ORDER+1], a[CN_ORDER], t[CN_ORDER], k, e;
+
+ if(!silent)
+ {
+  cn_lev=-1; //next silence starts with SID
+  return -1;
+ }
+ cn_wait+=len;
+ //autocorrelation of whole packet
+ for(j=0;j<=CN_ORDER;j++)
+ {
+  e=0;
+  for(i=j;i<len;i++) e+=(float)sp[i]*sp[i-j];
+  r[j]=e;
+ }
+ e=r[0]/len; //mean square
+ lev=(int)(0.5+10*log10(e+1)); //0-91 dB
+ if((cn_lev>=0)&&(cn_wait<CN_UPDATE)&&(abs(lev-cn_lev)<CN_DELTA)) return 0;
+ cn_lev=lev;
+ cn_wait=0;
+ //Levinson-Durbin to reflection coefficients
+ pkt[0]=CN_SID_LEN;
+ pkt[1]=CN_MARK;
+ pkt[2]=(unsigned char)lev;
+ memset(a, 0, sizeof(a));
+ e=r[0]*1.0001+1; //white noise correction
+ for(i=0;i<CN_ORDER;i++)
+ {
+  k=r[i+1];
+  for(j=0;j<i;j++) k+=a[j]*r[i-j];
+  k=-k/e;
+  if(k>0.99) k=0.99;
+  if(k<-0.99) k=-0.99;
+  pkt[3+i]=(unsigned char)(signed char)floor(0.5+127*k);
+  for(j=0;j<i;j++) t[j]=a[j]+k*a[i-1-j];
+  for(j=0;j<i;j++) a[j]=t[j];
+  a[i]=k;
+  e*=(1-k*k);
+ }
+ return 1+CN_SID_LEN;
+}
+
+//*****************************************************************************
+//check decrypted voice packet for SID
+int dtx_is_sid(unsigned char* pkt)
+{
+ return ((pkt[0]==CN_SID_LEN)&&(pkt[1]==CN_MARK));
+}
+
+//*****************************************************************************
+//Receiver side: take parameters of comfort noise from SID
+void dtx_rx(unsigned char* pkt)
+{
+ int i, j;
+ float k, p=1, t[CN_ORDER];
+
+ //step-up reflection coefficients to synthesis filter (always stable)
+ for(i=0;i<CN_ORDER;i++)
+ {
+  k=(float)((signed char)pkt[3+i])/127;
+  for(j=0;j<i;j++) t[j]=cn_a[j]+k*cn_a[i-1-j];
+  for(j=0;j<i;j++) cn_a[j]=t[j];
+  cn_a[i]=k;
+  p*=(1-k*k); //normalized prediction error
+ }
+ //excitation is uniform noise with rms 1/sqrt(3)
+ cn_gt=sqrt(3*p*pow(10, 0.1*pkt[2]));
+ if(!cn_time)
+ {
+  memset(cn_mem, 0, sizeof(cn_mem));
+  cn_g=cn_gt;
+ }
+ cn_time=getms()|1;
+}
+
+//*****************************************************************************
+//stop comfort noise (voice or mute notification received)
+void dtx_off(void)
+{
+ cn_time=0;
+}
+
+//*****************************************************************************
+//synthesize len samples of comfort noise to sp
+//returns number of samples or 0 if comfort noise is off
+int dtx_noise(short* sp, int len)
+{
+ int i, j;
+ float x;
+
+ if(!cn_time) return 0;
+ if((int)(getms()-cn_time)>CN_TIMEOUT) //SID updates lost: remote is gone
+ {
+  cn_time=0;
+  return 0;
+ }
+ for(i=0;i<len;i++)
+ {
+  cn_g+=0.002*(cn_gt-cn_g); //smooth level changes (about 60 mS)
+  x=cn_g*((float)(rand()&0x7FFF)/16384-1);
+  for(j=0;j<CN_ORDER;j++) x-=cn_a[j]*cn_mem[j];
+  memmove(cn_mem+1, cn_mem, (CN_ORDER-1)*sizeof(float));
+  cn_mem[0]=x;
+  if(x>32767) x=32767;
+  if(x<-32767) x=-32767;
+  sp[i]=(short)x;
+ }
+ return len;
+}
@@ -0,0 +1,29 @@
+// Contact: <torfone@ukr.net>
+// Author: Van Gegel
+//
+// THIS IS A FREE SOFTWARE
+//
+// This software is released under GNU LGPL:
+//
+// * LGPL 3.0 <http://www.gnu.org/licenses/lgpl.html>
+//
+// You're free to copy, distribute and make commercial use
+// of this software under the following conditions:
+//
+// * You have to cite the author (and copyright owner): Van Gegel
+// * You have to provide a link to the author's Homepage: <http://torfone.org/>
+//
+///////////////////////////////////////////////
+
+// Generic DTX: SID packets with spectral envelope and level during silence
+// and comfort noise synthesized from them by receiver
+
+#define CN_ORDER 6 //order of spectral envelope of comfort noise
+#define CN_SID_LEN (2+CN_ORDER) //SID data: marker, level, reflection coefficients
+#define CN_HANG 4 //inactive frames over whole packet before it is treated as silence
+
+int dtx_tx(short* sp, int len, int silent, unsigned char* pkt);
+int dtx_is_sid(unsigned char* pkt);
+void dtx_rx(unsigned char* pkt);
+void dtx_off(void);
+int dtx_noise(short* sp, int len);
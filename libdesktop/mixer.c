@@ -0,0 +1,287 @@
+// Contact: <torfone@ukr.net>
+// Author: Van Gegel
+//
+// THIS IS A FREE SOFTWARE
+//
+// This software is released under GNU LGPL:
+//
+// * LGPL 3.0 <http://www.gnu.org/licenses/lgpl.html>
+//
+// You're free to copy, distribute and make commercial use
+// of this software under the following conditions:
+//
+// * You have to cite the author (and copyright owner): Van Gegel
+// * You have to provide a link to the author's Homepage: <http://torfone.org/>
+//
+///////////////////////////////////////////////
+
+//Conference hub: every call leg (oph instance in relay mode with
+//Bridge_pcm=1) sends decoded speech of its remote participant. Each
+//participant has its own jitter buffer here; every 20 mS the active ones
+//are scaled by their gain and summed, and each leg gets the sum without
+//its own contribution (N-1 mix). Legs of silent participants (VAD/DTX,
+//muted) send nothing and cost nothing; they all get the same full mix,
+//computed once.
+//Each leg is its own oph process holding one authenticated session and
+//one decoder, and encodes the mix it gets itself: legs using the same
+//codec do not share an encoder, so the mix is encoded once per leg rather
+//than once per codec.
+
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "crypto.h"
+#include "cntrls.h"
+#include "tcp.h"
+#include "mixer.h"
+
+#define MIX_FIFO 1600 //jitter buffer of participant: 200 mS
+#define MIX_START 320 //prebuffering before participant is mixed: 40 mS
+#define MIX_IDLE 5000 //mS without datagrams before leg is dropped
+#define MIX_Q 12 //fixed point of gains
+#define MIX_PKT 512 //max datagram
+
+typedef struct {
+ short fifo[MIX_FIFO]; //received speech
+ int len; //samples in fifo
+ char on; //leg is connected
+ char act; //participant is mixed now
+ unsigned int last; //time of last datagram
+} MixLeg;
+
+static MixLeg mix_leg[MIX_LEGS];
+static int mix_g[MIX_LEGS]; //gains (Q12)
+static char mix_ready=0; //gains are set
+static int mix_own[MIX_LEGS][MIX_FRAME]; //scaled frame of each speaker
+static int mix_sum[MIX_FRAME]; //sum of all speakers
+static unsigned int mix_next=0; //time of next tick
+
+
+//*****************************************************************************
+//unity gains for all legs at first use
+static void mix_ini(void)
+{
+ int i;
+
+ if(mix_ready) return;
+ for(i=0;i<MIX_LEGS;i++) mix_g[i]=1<<MIX_Q;
+ mix_ready=1;
+}
+
+
+//*****************************************************************************
+//own = x*g, sum += own
+static void mix_scale(int* own, int* sum, const short* x, int g, int n)
+{
+ int i=0;
+#if defined(__SSE2__)
+ __m128i vg=_mm_set1_epi16((short)g);
+ for(;i+8<=n;i+=8)
+ {
+  __m128i v=_mm_loadu_si128((const __m128i*)(x+i));
+  __m128i lo=_mm_mullo_epi16(v, vg);
+  __m128i hi=_mm_mulhi_epi16(v, vg);
+  __m128i p0=_mm_unpacklo_epi16(lo, hi);
+  __m128i p1=_mm_unpackhi_epi16(lo, hi);
+  _mm_storeu_si128((__m128i*)(own+i), p0);
+  _mm_storeu_si128((__m128i*)(own+i+4), p1);
+  _mm_storeu_si128((__m128i*)(sum+i), _mm_add_epi32(_mm_loadu_si128((__m128i*)(sum+i)), p0));
+  _mm_storeu_si128((__m128i*)(sum+i+4), _mm_add_epi32(_mm_loadu_si128((__m128i*)(sum+i+4)), p1));
+ }
+#elif defined(__ARM_NEON)
+ int16x4_t vg=vdup_n_s16((short)g);
+ for(;i+8<=n;i+=8)
+ {
+  int16x8_t v=vld1q_s16(x+i);
+  int32x4_t p0=vmull_s16(vget_low_s16(v), vg);
+  int32x4_t p1=vmull_s16(vget_high_s16(v), vg);
+  vst1q_s32(own+i, p0);
+  vst1q_s32(own+i+4, p1);
+  vst1q_s32(sum+i, vaddq_s32(vld1q_s32(sum+i), p0));
+  vst1q_s32(sum+i+4, vaddq_s32(vld1q_s32(sum+i+4), p1));
+ }
+#endif
+ for(;i<n;i++)
+ {
+  own[i]=x[i]*g;
+  sum[i]+=own[i];
+ }
+}
+
+
+//*****************************************************************************
+//out = sum - own with saturation to 16 bits (own==0: whole sum)
+static void mix_out(short* out, const int* sum, const int* own, int n)
+{
+ int i=0, s;
+#if defined(__SSE2__)
+ __m128i z=_mm_setzero_si128();
+ for(;i+8<=n;i+=8)
+ {
+  __m128i o0=own ? _mm_loadu_si128((const __m128i*)(own+i)) : z;
+  __m128i o1=own ? _mm_loadu_si128((const __m128i*)(own+i+4)) : z;
+  __m128i d0=_mm_srai_epi32(_mm_sub_epi32(_mm_loadu_si128((const __m128i*)(sum+i)), o0), MIX_Q);
+  __m128i d1=_mm_srai_epi32(_mm_sub_epi32(_mm_loadu_si128((const __m128i*)(sum+i+4)), o1), MIX_Q);
+  _mm_storeu_si128((__m128i*)(out+i), _mm_packs_epi32(d0, d1));
+ }
+#elif defined(__ARM_NEON)
+ int32x4_t z=vdupq_n_s32(0);
+ for(;i+8<=n;i+=8)
+ {
+  int32x4_t o0=own ? vld1q_s32(own+i) : z;
+  int32x4_t o1=own ? vld1q_s32(own+i+4) : z;
+  int32x4_t d0=vshrq_n_s32(vsubq_s32(vld1q_s32(sum+i), o0), MIX_Q);
+  int32x4_t d1=vshrq_n_s32(vsubq_s32(vld1q_s32(sum+i+4), o1), MIX_Q);
+  vst1q_s16(out+i, vcombine_s16(vqmovn_s32(d0), vqmovn_s32(d1)));
+ }
+#endif
+ for(;i<n;i++)
+ {
+  s=(sum[i]-(own ? own[i] : 0))>>MIX_Q;
+  if(s>32767) s=32767;
+  else if(s<-32768) s=-32768;
+  out[i]=(short)s;
+ }
+}
+
+
+//*****************************************************************************
+//mix one frame and send it to legs, returns number of speakers
+static int mix_tick(void)
+{
+ short out[MIX_FRAME];
+ short all[MIX_FRAME]; //mix for legs not speaking now
+ int i, n=0, a=0;
+ MixLeg* L;
+
+ memset(mix_sum, 0, sizeof(mix_sum));
+ for(i=0;i<MIX_LEGS;i++)
+ {
+  L=mix_leg+i;
+  if(!L->on) continue;
+  if((!L->act)&&(L->len>=MIX_START)) L->act=1; //prebuffered: start mixing
+  if(L->act&&(L->len<MIX_FRAME)) L->act=0; //underrun: participant is silent now
+  if(!L->act) continue;
+  mix_scale(mix_own[i], mix_sum, L->fifo, mix_g[i], MIX_FRAME);
+  L->len-=MIX_FRAME;
+  memmove(L->fifo, L->fifo+MIX_FRAME, L->len*sizeof(short));
+  n++;
+ }
+ if(!n) return 0; //nobody speaks: legs send nothing to their remotes
+
+ for(i=0;i<MIX_LEGS;i++)
+ {
+  L=mix_leg+i;
+  if(!L->on) continue;
+  if(L->act)
+  {
+   if(n==1) continue; //single speaker hears nobody
+   mix_out(out, mix_sum, mix_own[i], MIX_FRAME);
+   hub_send(i, (unsigned char*)out, sizeof(out));
+  }
+  else
+  {
+   if(!a) mix_out(all, mix_sum, 0, MIX_FRAME);
+   a=1;
+   hub_send(i, (unsigned char*)all, sizeof(all));
+  }
+ }
+ return n;
+}
+
+
+//*****************************************************************************
+//add received speech to jitter buffer of participant
+void mix_put(int leg, short* sp, int len)
+{
+ MixLeg* L=mix_leg+leg;
+ int i;
+
+ if(!L->on)
+ {
+  L->on=1;
+  L->len=0;
+  L->act=0;
+ }
+ L->last=getms();
+ if(len>MIX_FIFO)
+ {
+  sp+=len-MIX_FIFO;
+  len=MIX_FIFO;
+ }
+ i=L->len+len-MIX_FIFO; //overflow: drop oldest samples
+ if(i>0)
+ {
+  L->len-=i;
+  memmove(L->fifo, L->fifo+i, L->len*sizeof(short));
+ }
+ memcpy(L->fifo+L->len, sp, len*sizeof(short));
+ L->len+=len;
+}
+
+
+//*****************************************************************************
+//set gain of participant in percents (0-799)
+void mix_gain(int leg, int percent)
+{
+ if((leg<0)||(leg>=MIX_LEGS)) return;
+ mix_ini();
+ if(percent<0) percent=0;
+ if(percent>799) percent=799;
+ mix_g[leg]=(percent<<MIX_Q)/100;
+}
+
+
+//*****************************************************************************
+//print conference state
+void mix_status(void)
+{
+ int i;
+
+ for(i=0;i<MIX_LEGS;i++)
+ {
+  if(!mix_leg[i].on) continue;
+  web_printf("Leg %d: gain %d%%, %s, buffered %d mS\r\n", i,
+             (mix_g[i]*100+(1<<(MIX_Q-1)))>>MIX_Q,
+             mix_leg[i].act ? "speaks" : "silent", mix_leg[i].len/8);
+ }
+}
+
+
+//*****************************************************************************
+//poll conference hub: receive speech of legs and mix it every 20 mS
+//returns job flag
+int conf_hub(void)
+{
+ short buf[MIX_PKT/2];
+ int i, l, leg, job=0;
+ unsigned int now;
+
+ while((l=hub_recv((unsigned char*)buf, &leg))>0)
+ {
+  mix_ini();
+  mix_put(leg, buf, (l&1) ? 0 : l>>1); //odd length: keepalive of silent leg
+  job=1;
+ }
+ if(l<0) return 0; //not a hub
+ now=getms();
+ for(i=0;i<MIX_LEGS;i++) //forget legs gone
+  if(mix_leg[i].on && ((int)(now-mix_leg[i].last)>MIX_IDLE))
+  {
+   mix_leg[i].on=0;
+   hub_drop(i);
+  }
+ if((!mix_next)||((int)(now-mix_next)>200)) mix_next=now; //start or lost clock
+ while((int)(now-mix_next)>=0)
+ {
+  mix_tick();
+  mix_next+=20;
+  job=1;
+ }
+ return job;
+}
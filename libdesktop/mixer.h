@@ -0,0 +1,26 @@
+// Contact: <torfone@ukr.net>
+// Author: Van Gegel
+//
+// THIS IS A FREE SOFTWARE
+//
+// This software is released under GNU LGPL:
+//
+// * LGPL 3.0 <http://www.gnu.org/licenses/lgpl.html>
+//
+// You're free to copy, distribute and make commercial use
+// of this software under the following conditions:
+//
+// * You have to cite the author (and copyright owner): Van Gegel
+// * You have to provide a link to the author's Homepage: <http://torfone.org/>
+//
+///////////////////////////////////////////////
+
+// Conference hub: mixes speech of call legs (see hub_init in tcp.c)
+
+#define MIX_LEGS 8 //participants of conference
+#define MIX_FRAME 160 //samples mixed per 20 mS tick
+
+void mix_put(int leg, short* sp, int len);
+void mix_gain(int leg, int percent);
+void mix_status(void);
+int conf_hub(void);
@@ -24,9 +24,13 @@
 #include "cntrls.h"   //users interface (menu, commands etc.)
 #include "audio.h"    //audio low_level input/output: alsa for Linux, wave for Windows  
 #include "codecs.h"   //audio processing (codecs wrapper, packetizer, jitter buffer etc.)
+#include "mixer.h"    //conference hub
+#include "ophh_trace.h" //per-packet pipeline tracing
 
 extern char crp_state; //state of crypto protocol (from crypto.c)
 extern char sound_loop; //flag of sound selftest (from cntrls.c)
+extern unsigned int trc_out; //trace id of outgoing packet (from codecs.c)
+extern unsigned int trc_rx; //trace id of incoming packet (from codecs.c)
 
 //Main procedure is one-threaded (except wave thread for win32) cycle
 //asynchronosly poll sound input device, network sockets and keyboard input
@@ -37,6 +41,7 @@ int main(int argc, char **argv)
  unsigned char bbuf[540]; //work buffer
  int i, job=0;
  char c;
+ unsigned long long t; //trace stage start
 
  randInit(0, 0); //SPRNG initialization
  loadmenu(); //loading menu items from file
@@ -60,22 +65,41 @@ int main(int argc, char **argv)
   i=do_snd(bbuf); //check for sount packet ready
   if(i>1) //if sound packet encoded
   {
-   if(sound_loop) go_snd(bbuf); //sound self-test: decode and play packet
+   if(sound_loop) //sound self-test: decode and play packet
+   {
+    trc_rx=trc_out; //trace it as received
+    go_snd(bbuf);
+   }
    else if(crp_state>2) //or send sound to remote
    {
+    t=OPHH_TRACE_T();
     i=do_data(bbuf, (unsigned char*)&c); //encrypt packet, returns pkt len
+    OPHH_TRACE(trc_out, OPHH_TR_ENCRYPT, t);
+    t=OPHH_TRACE_T();
     if(i>0) do_send(bbuf, i, c); //send packet
+    OPHH_TRACE(trc_out, OPHH_TR_SEND, t);
    }
   }
   if(i) job=1; //set flag for audio job
   //process network input
+  t=OPHH_TRACE_T();
   i=do_read(bbuf); //read pkt from network, returns <0 if no pkt or pkt len
   if(i) job+=2;
-  if(i>0) i=go_data(bbuf, i); //decrypt pkt, specifies length for udp, returns data len
+  if(i>0)
+  {
+   trc_rx++;
+   OPHH_TRACE(trc_rx, OPHH_TR_RECV, t);
+   t=OPHH_TRACE_T();
+   i=go_data(bbuf, i); //decrypt pkt, specifies length for udp, returns data len
+   OPHH_TRACE(trc_rx, OPHH_TR_DECRYPT, t);
+  }
   if(i>0) i=go_pkt(bbuf, i); //process pkt, return data len of answer
   if(i>0) i=do_data(bbuf, (unsigned char*)&c); //encrypt answer, returns pkt len
   if(i>0) do_send(bbuf, i, c); //send answer
 
+  //conference hub: mix speech of call legs
+  if(conf_hub()) job+=8;
+
   //process console input
   i=do_char(); //process char or command
   if(i) job+=4;
@@ -71,6 +71,7 @@ char sock_buf[32768];   //WSA sockets buffer
 #endif
 
 #include <stdlib.h>
+#include <stdint.h>
 #include <errno.h>
 #include <time.h>
 #include <sys/time.h>
@@ -95,10 +96,17 @@ char sock_buf[32768];   //WSA sockets buffer
  #define SOCKET_ERROR -1
 #endif
 
+#ifdef _WIN32
+ typedef u_long ioctl_opt_t; //ioctlsocket() argument
+#else
+ typedef int ioctl_opt_t; //FIONBIO argument is int on Linux (not long)
+#endif
+
 
 
 #include "libcrp.h"
 #include "crypto.h"
+#include "mixer.h"
 #include "tcp.h"
 #include "cntrls.h"
 #include "codecs.h"
@@ -113,6 +121,11 @@ int tcp_insock=INVALID_SOCKET;  //tcp accepting socket (incoming)
 int tcp_outsock=INVALID_SOCKET; //tcp connected socket (outgoing)
 int udp_insock=INVALID_SOCKET;  //udp listening/incoming socket
 int udp_outsock=INVALID_SOCKET;  //udp created socket (outgoing)
+int brg_sock=INVALID_SOCKET;  //udp socket of relay bridge to other oph instance
+struct sockaddr_in brg_peer; //other instance bridge interface
+int brg_pcm=0; //bridge carries decoded speech (conference leg) instead of packets
+int hub_sock=INVALID_SOCKET; //udp socket of conference hub
+struct sockaddr_in hub_leg[MIX_LEGS]; //bridge interfaces of conference legs
 char tcp_insock_flag=0;  //status of tcp incoming connection
 char tcp_outsock_flag=0; //status of tcp outgoing connection
 char udp_insock_flag=0;  //status of tcp incomin connection/listener
@@ -149,30 +162,30 @@ short torbuflen=0; //length of stored request
 char msgbuf[264]; //work buffer
 char webmsgbuf[512]; //web message buffer
 
-unsigned long naddrUDPlistener=INADDR_NONE; //UDP listener if
+uint32_t naddrUDPlistener=INADDR_NONE; //UDP listener if
 unsigned short portUDPlistener=0;
-unsigned long naddrTCPlistener=INADDR_NONE; //TCP listener if
+uint32_t naddrTCPlistener=INADDR_NONE; //TCP listener if
 unsigned short portTCPlistener=0;
 
-unsigned long naddrTor=INADDR_NONE; //Tor interface from configuration file
+uint32_t naddrTor=INADDR_NONE; //Tor interface from configuration file
 unsigned short portTor=0;
-unsigned long naddrSTUN=INADDR_NONE; //STUN server interface for NAT traversal
+uint32_t naddrSTUN=INADDR_NONE; //STUN server interface for NAT traversal
 unsigned short portSTUN=0;
 
-unsigned long Their_naddrUDPint=INADDR_NONE; //Their local UDP interface for connection in local network
+uint32_t Their_naddrUDPint=INADDR_NONE; //Their local UDP interface for connection in local network
 unsigned short Their_portUDPint=0;
-unsigned long Their_naddrUDPext=INADDR_NONE; //Their external UDP interface for NAT traversal
+uint32_t Their_naddrUDPext=INADDR_NONE; //Their external UDP interface for NAT traversal
 unsigned short Their_portUDPext=0;
-unsigned long Our_naddrUDPint=INADDR_NONE; //Our local UDP interface for connection in local network
+uint32_t Our_naddrUDPint=INADDR_NONE; //Our local UDP interface for connection in local network
 unsigned short Our_portUDPint=0;
-unsigned long Our_naddrUDPext=INADDR_NONE; //Our external UDP interface for NAT traversal
+uint32_t Our_naddrUDPext=INADDR_NONE; //Our external UDP interface for NAT traversal
 unsigned short Our_portUDPext=0;
 
-unsigned long Our_naddrUDPloc=INADDR_NONE; //Our local system IP
+uint32_t Our_naddrUDPloc=INADDR_NONE; //Our local system IP
 unsigned short Our_portUDPloc=0; //Our UDP listener port
 
 extern char crp_state;      //status of connection crypto-handshake (crypto.c)
-extern unsigned int in_ctr; //counter of incoming packets (crypto.c)
+extern uint32_t in_ctr; //counter of incoming packets (crypto.c)
 extern char their_onion[32]; //remote onion adress (from connection command or from remote) (crypto.c)
 extern char our_onion[32];   //our onion adress (from connection command or conf file) (crypto.c)
 extern int bad_mac; //counter of bad autentificating packets (crypto.c)
@@ -212,10 +225,10 @@ int fndport(char* buf)
 //creates TCP and UDP listeners by configuration
 int sock_init(void)
 {
-   unsigned long opt = 1; //for ioctl
+   ioctl_opt_t opt = 1; //for ioctl
    int flag=1; //for setsockopt
    int ret = 0; //error code
-   unsigned long naddrTCP=0; //temporary IP adress
+   uint32_t naddrTCP=0; //temporary IP adress
    unsigned short port=0;      //temporary port
    
    //Inites WSA for Windows
@@ -417,10 +430,124 @@ trynext:
       }
   }
 
+  bridge_init(); //relay mode
+  hub_init(); //conference hub
   return ret; //listeners
 }
 
 
+//*****************************************************************************
+//returns 1 for address (network order) in 127.0.0.0/8
+static int is_loopback(uint32_t naddr)
+{
+ return ((ntohl(naddr)>>24)==127);
+}
+
+
+//*****************************************************************************
+//Relay mode: two oph instances bridge their calls by exchanging decrypted
+//voice packets over local udp (Bridge_interface is our end, Bridge_peer
+//is the other one). The bridge link is not encrypted so both ends must be
+//on loopback. Returns 1 if bridge is active
+int bridge_init(void)
+{
+ ioctl_opt_t opt = 1; //for ioctl
+ struct sockaddr_in saddr;
+ unsigned short port;
+
+ if(brg_sock!=(int)INVALID_SOCKET) close(brg_sock);
+ brg_sock=INVALID_SOCKET;
+ //conference leg: speech is exchanged with hub
+ strcpy(msgbuf, "Bridge_pcm");
+ brg_pcm=((parseconf(msgbuf)>0)&&(msgbuf[0]=='1'));
+ //peer interface
+ strcpy(msgbuf, "Bridge_peer");
+ if(parseconf(msgbuf)<=0) return 0; //relay mode not used
+ port=fndport(msgbuf);
+ memset(&brg_peer, 0, sizeof(brg_peer));
+ brg_peer.sin_family = AF_INET;
+ brg_peer.sin_port = htons(port);
+ brg_peer.sin_addr.s_addr=inet_addr(msgbuf);
+ //our interface
+ strcpy(msgbuf, "Bridge_interface");
+ if(parseconf(msgbuf)<=0) return 0;
+ port=fndport(msgbuf);
+ memset(&saddr, 0, sizeof(saddr));
+ saddr.sin_family = AF_INET;
+ saddr.sin_port = htons(port);
+ saddr.sin_addr.s_addr=inet_addr(msgbuf);
+ if((!port)||(!brg_peer.sin_port)||(saddr.sin_addr.s_addr==INADDR_NONE)||
+    (brg_peer.sin_addr.s_addr==INADDR_NONE))
+ {
+  printf("Bridge interfaces not valid\r\n");
+  return 0;
+ }
+ //decrypted voice must not leave this host
+ if((!is_loopback(saddr.sin_addr.s_addr))||(!is_loopback(brg_peer.sin_addr.s_addr)))
+ {
+  printf("Bridge interfaces must be on loopback (127.0.0.0/8)\r\n");
+  return 0;
+ }
+ if ((brg_sock = socket(AF_INET, SOCK_DGRAM, 0)) <0)
+ {
+  perror("Error Bridge");
+  brg_sock=INVALID_SOCKET;
+  return 0;
+ }
+ //unblock socket
+ ioctl(brg_sock, FIONBIO, &opt);
+ if (bind(brg_sock, (struct sockaddr*)&saddr, sizeof(saddr)) < 0)
+ {
+  perror("Error bind Bridge");
+  close(brg_sock);
+  brg_sock=INVALID_SOCKET;
+  return 0;
+ }
+ printf("Relay bridge %s:%d", inet_ntoa(saddr.sin_addr), port);
+ printf(" <-> %s:%d\r\n", inet_ntoa(brg_peer.sin_addr), ntohs(brg_peer.sin_port));
+ fflush(stdout);
+ return 1;
+}
+
+
+//*****************************************************************************
+//pass decrypted voice packet to other call leg, returns 0 if no bridge
+int bridge_send(unsigned char* pkt, int len)
+{
+ if(brg_sock==(int)INVALID_SOCKET) return 0;
+ sendto(brg_sock, (char*)pkt, len, 0, (struct sockaddr*)&brg_peer, sizeof(brg_peer));
+ return 1;
+}
+
+
+//*****************************************************************************
+//returns 2 if bridge carries speech, 1 if packets, 0 if there is no bridge
+int bridge_mode(void)
+{
+ if(brg_sock==(int)INVALID_SOCKET) return 0;
+ return 1+brg_pcm;
+}
+
+
+//*****************************************************************************
+//get voice packet from other call leg, returns its length or 0
+//(-1 if there is no bridge)
+int bridge_recv(unsigned char* pkt)
+{
+ struct sockaddr_in saddr;
+ socklen_t sl=sizeof(saddr);
+ int l;
+
+ if(brg_sock==(int)INVALID_SOCKET) return -1;
+ l=recvfrom(brg_sock, (char*)pkt, MAXTCPSIZE, 0, (struct sockaddr*)&saddr, &sl);
+ if(l<=0) return 0;
+ //accept packets of bridge peer only
+ if((saddr.sin_addr.s_addr!=brg_peer.sin_addr.s_addr)||
+    (saddr.sin_port!=brg_peer.sin_port)) return 0;
+ return l;
+}
+
+
 //*****************************************************************************
 int get_ipif(unsigned int ip, unsigned short port)
 {
@@ -708,10 +835,10 @@ int do_connect(char* conadr)
 //set udp_outsock_flag to SOCK_READY
 int connectudp(char* udpaddr)
 {
-  unsigned long opt = 1;  //for ioctl
+  ioctl_opt_t opt = 1;  //for ioctl
   int i;
   char c;
-  unsigned long naddrTCP=0;  //temporary address and port
+  uint32_t naddrTCP=0;  //temporary address and port
   unsigned short port=0;
   struct hostent *hh;  //for domain resolving
 
@@ -850,10 +977,10 @@ int connectudp(char* udpaddr)
 int connecttcp(char* tcpaddr)
 {
  struct hostent *hh; //for resolving
- unsigned long naddrTCP=0; //temporary IP, port
+ uint32_t naddrTCP=0; //temporary IP, port
  unsigned short port=0;
  int flag=1;
- unsigned long opt=1; //for ioctl
+ ioctl_opt_t opt=1; //for ioctl
  int i;
 
  //Check: remote address must be specified
@@ -942,7 +1069,7 @@ int connecttor(char* toraddr)
  unsigned short port=0;
  int flag=1;
  int i;
- unsigned long opt=1;
+ ioctl_opt_t opt=1;
 
  //Check for Tor interface exist (loded fron conf in sock_init
  if((naddrTor==INADDR_NONE)||(!portTor))
@@ -996,7 +1123,7 @@ int connecttor(char* toraddr)
  i=4; //IPv4 Len
  torbuf[3]=0x01; //for IPv4 socks request
  //check for adress string is IP, replace string by integer
- if(inet_addr((const char*)torbuf+5)!= INADDR_NONE) (*(unsigned int *)(torbuf+4)) = (unsigned int) inet_addr((const char*)torbuf+5);
+ if(inet_addr((const char*)torbuf+5)!= INADDR_NONE) { uint32_t a=inet_addr((const char*)torbuf+5); memcpy(torbuf+4, &a, sizeof(a)); }
  else
  {
   i=strlen((const char*)torbuf+5); //length of hostname string
@@ -1164,17 +1291,18 @@ int tcpaccept(void)
 {
  int flag=1;
  int ll;
+ socklen_t sl; //addr structure size
  int sTemp=INVALID_SOCKET; //accepted socket
  int oflag=0; //incoming from tor
- unsigned long opt=1;
+ ioctl_opt_t opt=1;
  //struct linger ling;
 
  if(tcp_listener==(int)INVALID_SOCKET) return 0;
- ll = sizeof(saddrTCP);
+ sl = sizeof(saddrTCP);
  //try accept incoming asynchronosly
- sTemp  = accept(tcp_listener, (struct sockaddr *) &saddrTCP, (socklen_t*)&ll);
+ sTemp  = accept(tcp_listener, (struct sockaddr *) &saddrTCP, &sl);
  if(sTemp<=0) return -1; //no incoming connections accepted
- if(saddrTCP.sin_addr.s_addr==0x0100007F) //if incoming from localhost (Tor)
+ if(saddrTCP.sin_addr.s_addr==htonl(INADDR_LOOPBACK)) //if incoming from localhost (Tor)
  {
   if(!crp_state) //only for initial incoming, not for doubling reconection
   web_printf("\r\nAccepted incoming from Tor\r\n");
@@ -1207,7 +1335,7 @@ if(ll) //send busy notification and close
   char buf[13];
   buf[0]=(char)(0x80|TYPE_INV);
   memset(buf+1,0, 12); //zeroed invite for busy notification
-  if(13!=send(sTemp, (char*)(&ll), 13, 0)) perror("Sending Busy");//send busy nitification
+  if(13!=send(sTemp, buf, 13, 0)) perror("Sending Busy");//send busy nitification
 
   //close socket
   //ling.l_onoff  = TRUE;
@@ -1235,6 +1363,18 @@ if(ll) //send busy notification and close
 }
 
 
+//******************************************************************************
+//returns kind of path do_send uses now: 0-UDP, 1-TCP, 2-TCP over Tor, -1-none
+int path_kind(void)
+{
+ if((udp_outsock!=(int)INVALID_SOCKET)&&(udp_outsock_flag==SOCK_INUSE)&&(saddrUDPTo.sin_port)) return 0;
+ if(((tcp_outsock!=(int)INVALID_SOCKET)&&(tcp_outsock_flag==SOCK_INUSE))||
+    ((tcp_insock!=(int)INVALID_SOCKET)&&(tcp_insock_flag==SOCK_INUSE))) return (onion_flag?2:1);
+ if((udp_insock!=(int)INVALID_SOCKET)&&(udp_insock_flag==SOCK_INUSE)&&(saddrUDPTo.sin_port)) return 0;
+ return -1;
+}
+
+
 //******************************************************************************
 //packets sending wrapper
 //c is char for replacing packets first byte
@@ -1292,10 +1432,11 @@ int readudpin(unsigned char* pkt)
 {
  int i; //data length or error code
  char b=0; //busy flag
- int l=sizeof(saddrTCP); //addr structure size
+ int l;
+ socklen_t sl=sizeof(saddrTCP); //addr structure size
 
  //try read socket asynchronosly
- i=recvfrom(udp_insock, (char*)pkt, MAXTCPSIZE, 0, (struct sockaddr*)&saddrTCP, (socklen_t*)&l);
+ i=recvfrom(udp_insock, (char*)pkt, MAXTCPSIZE, 0, (struct sockaddr*)&saddrTCP, &sl);
  if(i==SOCKET_ERROR) //error/no data
  {
   i=getsockerr();  //get error code
@@ -1321,9 +1462,9 @@ int readudpin(unsigned char* pkt)
    if((pkt[0]==1)&&(pkt[1]==1)&&(i>31)&&(saddrTCP.sin_port==htons(portSTUN)))
    {
     unsigned short Our_portUDP;
-    unsigned long Our_naddrUDP;
+    uint32_t Our_naddrUDP;
     Our_portUDP=htons(*(unsigned short*)(pkt+26)); //our external PORT reported by STUN
-    Our_naddrUDP=(*(unsigned int*)(pkt+28)); //our external IP reported by STUN
+    memcpy(&Our_naddrUDP, pkt+28, sizeof(Our_naddrUDP)); //our external IP reported by STUN
     saddrTCP.sin_addr.s_addr=Our_naddrUDP; //for convertion IP to strin
     web_printf("STUN  report: UDP listener on %s:%d\r\n",
     inet_ntoa(saddrTCP.sin_addr), Our_portUDP);
@@ -1400,11 +1541,11 @@ int readudpout(unsigned char* pkt)
 {
  int i; //data length or error code
  char c;
- int l=sizeof(saddrTCP); //addr structure size
+ socklen_t l=sizeof(saddrTCP); //addr structure size
 
 //===========================================
  //try read socket
- i=recvfrom(udp_outsock, (char*)pkt, MAXTCPSIZE, 0, (struct sockaddr*)&saddrTCP, (socklen_t*)&l);
+ i=recvfrom(udp_outsock, (char*)pkt, MAXTCPSIZE, 0, (struct sockaddr*)&saddrTCP, &l);
  if(i==SOCKET_ERROR) //error/no data
  {
   i=getsockerr();  //get error code
@@ -1444,7 +1585,7 @@ int readudpout(unsigned char* pkt)
    if(u_cnt&&(pkt[0]==1)&&(pkt[1]==1)&&(i>31)&&(saddrTCP.sin_port==htons(portSTUN)))
    {
     Our_portUDPext=htons(*(unsigned short*)(pkt+26)); //our external PORT reported by STUN
-    Our_naddrUDPext=(*(unsigned int*)(pkt+28)); //our external IP reported by STUN
+    memcpy(&Our_naddrUDPext, pkt+28, sizeof(Our_naddrUDPext)); //our external IP reported by STUN
     //make chat packet with own external IP:port reported by STUN
     pkt[0]=TYPE_CHAT|0x80; //chat packet header
     sprintf((char*)(pkt+1), "-S%d.%d.%d.%d:%d",
@@ -2287,7 +2428,7 @@ int setaddr(char* pkt)
  int i;
  int ext=0; //flag of external addresses invite received
  unsigned short port=0;
- unsigned long naddr=INADDR_NONE;
+ uint32_t naddr=INADDR_NONE;
 
   //parse remote addr:port from incoming chat UDP invite
   msgbuf[0]='U'; //search remote's local adress in commands string
@@ -2352,10 +2493,10 @@ void stopudp(void)
 
 //*****************************************************************************
 //returns local ip specified in config or discovered in system
-unsigned long get_local_if(void)
+uint32_t get_local_if(void)
 {
  char str[256];
- unsigned long our_ip=INADDR_NONE;
+ uint32_t our_ip=INADDR_NONE;
  int i;
  
  strcpy(str, "Local_interface"); //parameter name
@@ -2377,7 +2518,7 @@ unsigned long get_local_if(void)
      i=0;
      while(i<1) //check for mingw bag!!! bcb compiler OK!
      {
-      paddr.sin_addr.s_addr=*(unsigned long*)hh->h_addr_list[i++];
+      memcpy(&paddr.sin_addr.s_addr, hh->h_addr_list[i++], sizeof(paddr.sin_addr.s_addr));
       our_ip=paddr.sin_addr.s_addr; //for inet_ntoa only
       saddrTCP.sin_addr.s_addr=our_ip;
       web_printf("Local interface: %s\r\n", inet_ntoa(saddrTCP.sin_addr) ); //notify
@@ -2412,17 +2553,17 @@ unsigned long get_local_if(void)
 int webaccept(void)
 {
  int flag=1;
- int ll;
+ socklen_t sl; //addr structure size
  int sTemp=INVALID_SOCKET; //accepted socket
- unsigned long opt=1;
+ ioctl_opt_t opt=1;
  //struct linger ling;
 
  if(web_listener==(int)INVALID_SOCKET) return 0;
- ll = sizeof(saddrTCP);
+ sl = sizeof(saddrTCP);
  //try accept incoming asynchronosly
- sTemp  = accept(web_listener, (struct sockaddr *) &saddrTCP, (socklen_t*)&ll);
+ sTemp  = accept(web_listener, (struct sockaddr *) &saddrTCP, &sl);
  if(sTemp<=0) return -1; //no incoming connections accepted
- if(saddrTCP.sin_addr.s_addr!=0x0100007F) //if incoming not from localhost (Tor)
+ if(saddrTCP.sin_addr.s_addr!=htonl(INADDR_LOOPBACK)) //if incoming not from localhost (Tor)
  {
   printf("\r\nWarning: external control\r\n");
   //close(sTemp);
@@ -2525,15 +2666,15 @@ int readweb(void)
    i=0x7F&webmsgbuf[1];  //data length for short packet
    if(i>125) //this is a long packet
    {
-    i=webmsgbuf[3]<<(8+webmsgbuf[4]); //data length for long packet
+    i=((unsigned char)webmsgbuf[2]<<8)|(unsigned char)webmsgbuf[3]; //data length for long packet
     p+=2; //skip 2 byte length
    }
-   if(0x80&webmsgbuf[1]) //check for mask
+   if(0x80&webmsgbuf[1]) p+=4; //skip 4 mask bytes
+   if(l!=(p-webmsgbuf+i)) return 0; //check for actual length is correct
+   if(0x80&webmsgbuf[1]) //demask
    {
-    p+=4; //skip 4 mask bytes
-    for(j=0;j<i;j++) p[j]^=*(p-4+(j%4));  //demask
+    for(j=0;j<i;j++) p[j]^=*(p-4+(j%4));
    }
-   if(l!=(p-webmsgbuf+i)) return 0; //check for actual length is correct
    if((unsigned char)(webmsgbuf[0])==0x88) //check for close packet
    {
     webmsgbuf[1]=0;  //for our close packet to answer
@@ -2601,3 +2742,103 @@ int sendweb(char* str)
 }
 
 
+//*****************************************************************************
+//Conference hub: call legs (oph instances in relay mode with Bridge_pcm=1
+//and Bridge_peer set to Conference_interface) send decoded speech of their
+//remotes here and get back the mix of all others. Returns 1 if hub is active
+int hub_init(void)
+{
+ ioctl_opt_t opt = 1; //for ioctl
+ struct sockaddr_in saddr;
+ unsigned short port;
+
+ if(hub_sock!=(int)INVALID_SOCKET) close(hub_sock);
+ hub_sock=INVALID_SOCKET;
+ memset(hub_leg, 0, sizeof(hub_leg));
+ strcpy(msgbuf, "Conference_interface");
+ if(parseconf(msgbuf)<=0) return 0; //not a hub
+ port=fndport(msgbuf);
+ memset(&saddr, 0, sizeof(saddr));
+ saddr.sin_family = AF_INET;
+ saddr.sin_port = htons(port);
+ saddr.sin_addr.s_addr=inet_addr(msgbuf);
+ if((!port)||(saddr.sin_addr.s_addr==INADDR_NONE))
+ {
+  printf("Conference interface not valid\r\n");
+  return 0;
+ }
+ //legs exchange decrypted speech with the hub in the clear
+ if(!is_loopback(saddr.sin_addr.s_addr))
+ {
+  printf("Conference interface must be on loopback (127.0.0.0/8)\r\n");
+  return 0;
+ }
+ if ((hub_sock = socket(AF_INET, SOCK_DGRAM, 0)) <0)
+ {
+  perror("Error Conference");
+  hub_sock=INVALID_SOCKET;
+  return 0;
+ }
+ ioctl(hub_sock, FIONBIO, &opt);
+ if (bind(hub_sock, (struct sockaddr*)&saddr, sizeof(saddr)) < 0)
+ {
+  perror("Error bind Conference");
+  close(hub_sock);
+  hub_sock=INVALID_SOCKET;
+  return 0;
+ }
+ printf("Conference hub on %s:%d\r\n", inet_ntoa(saddr.sin_addr), port);
+ fflush(stdout);
+ return 1;
+}
+
+
+//*****************************************************************************
+//get speech from conference leg: returns number of bytes and sets leg
+//index (new legs are registered up to MIX_LEGS), 0 if nothing, -1 if no hub
+int hub_recv(unsigned char* buf, int* leg)
+{
+ struct sockaddr_in saddr;
+ socklen_t sl=sizeof(saddr);
+ int i, l, j=-1;
+
+ if(hub_sock==(int)INVALID_SOCKET) return -1;
+ l=recvfrom(hub_sock, (char*)buf, MAXTCPSIZE, 0, (struct sockaddr*)&saddr, &sl);
+ if(l<=0) return 0;
+ //hub serves legs on the same host only
+ if(!is_loopback(saddr.sin_addr.s_addr)) return 0;
+ for(i=0;i<MIX_LEGS;i++)
+ {
+  if((hub_leg[i].sin_port==saddr.sin_port)&&
+     (hub_leg[i].sin_addr.s_addr==saddr.sin_addr.s_addr)) break; //known leg
+  if((j<0)&&(!hub_leg[i].sin_port)) j=i; //first free slot
+ }
+ if(i==MIX_LEGS) //new leg
+ {
+  if(j<0) return 0; //conference is full
+  i=j;
+  hub_leg[i]=saddr;
+  web_printf("Conference leg %d joined\r\n", i);
+ }
+ *leg=i;
+ return l;
+}
+
+
+//*****************************************************************************
+//send mixed speech to conference leg
+void hub_send(int leg, unsigned char* buf, int len)
+{
+ if((hub_sock==(int)INVALID_SOCKET)||(!hub_leg[leg].sin_port)) return;
+ sendto(hub_sock, (char*)buf, len, 0, (struct sockaddr*)&hub_leg[leg], sizeof(hub_leg[leg]));
+}
+
+
+//*****************************************************************************
+//forget conference leg (gone silent for long time)
+void hub_drop(int leg)
+{
+ if(!hub_leg[leg].sin_port) return;
+ memset(&hub_leg[leg], 0, sizeof(hub_leg[leg]));
+ web_printf("Conference leg %d left\r\n", leg);
+}
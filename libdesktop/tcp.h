@@ -15,6 +15,8 @@
 //
 ///////////////////////////////////////////////
 
+#include <stdint.h>
+
 //sockets status
   typedef enum{
   SOCK_IDDL=0,  //0-no socket
@@ -32,7 +34,7 @@
   int get_ipif(unsigned int ip, unsigned short port);
   int get_sockstatus(void);
   //initialisation
-  unsigned long get_local_if(void);
+  uint32_t get_local_if(void);
   int sock_init(void);
   int disconnect(void);
   void sock_close(char direction);
@@ -56,12 +58,24 @@
   int tcpaccept(void);
   //sending
   int do_send(unsigned char* pkt, int len, char c);
+  int path_kind(void);
   //Onion to UDP swithcing
   void do_stun(char* cmd);
   void do_nat(char* cmd);
   void stopudp(void);
   int setaddr(char* pkt);
 
+  //relay bridge to other instance
+  int bridge_init(void);
+  int bridge_send(unsigned char* pkt, int len);
+  int bridge_recv(unsigned char* pkt);
+  int bridge_mode(void);
+  //conference hub
+  int hub_init(void);
+  int hub_recv(unsigned char* buf, int* leg);
+  void hub_send(int leg, unsigned char* buf, int len);
+  void hub_drop(int leg);
+
   //Web control interface
   int webaccept(void);
   int readweb(void);
@@ -0,0 +1,189 @@
+// Contact: <torfone@ukr.net>
+// Author: Van Gegel
+//
+// THIS IS A FREE SOFTWARE
+//
+// This software is released under GNU LGPL:
+//
+// * LGPL 3.0 <http://www.gnu.org/licenses/lgpl.html>
+//
+// You're free to copy, distribute and make commercial use
+// of this software under the following conditions:
+//
+// * You have to cite the author (and copyright owner): Van Gegel
+// * You have to provide a link to the author's Homepage: <http://torfone.org/>
+//
+///////////////////////////////////////////////
+
+//Noise preprocessor parity: the floating point preprocessor (melpe_nf) at
+//180 samples per frame must give the segmental SNR of the fixed point one
+//(melpe_n) within NPP_TOL dB. The synthetic speech is mixed with white,
+//pink, car and babble noise at 0, 5, 10 and 20 dB SNR, and both outputs
+//are compared with the clean speech.
+//The first SETTLE samples are not measured: the two take their initial
+//noise estimate from different look ahead (melpe_n reads a whole window
+//of its first frame), which the minimum statistics forget after
+//NUM_MINWIN*LEN_MINWIN frames. The car noise is a plain low pass: much
+//steeper spectra fall below the dynamic range of the fixed point FFT.
+//Usage: npp (prints one line per case, exits with 1 if one is off)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "testsig.h"
+#include "../libcodecs/melpe/melpe.h"
+
+#define SIG_LEN 97200 //12 seconds at 8 KHz, whole frames
+#define SETTLE 16200 //2 seconds: 90 frames
+#define FRM 180 //frame of the fixed point preprocessor
+#define DELAY (256-FRM) //of both outputs: window overlap
+#define NPP_TOL 0.1 //segmental SNR tolerance, dB
+#define SEG_MIN -10.0 //segmental SNR limits per frame, dB
+#define SEG_MAX 35.0
+
+static short clean[SIG_LEN]; //speech
+static short babble[SIG_LEN]; //speech of other talkers
+static float noise[SIG_LEN]; //noise of the current case
+static short outx[SIG_LEN]; //fixed point output
+static short outf[SIG_LEN]; //floating point output
+
+//*****************************************************************************
+//uniform noise -1..1
+static float rnd(uint32_t* seed)
+{
+ *seed=*seed*1664525+1013904223;
+ return (float)((int32_t)*seed)/2147483648.0f;
+}
+
+//*****************************************************************************
+//noise of type t to noise[]: white, pink, car or babble
+static void make_noise(int t)
+{
+ uint32_t seed=0x9E3779B9;
+ float w, b0=0, b1=0, b2=0;
+ int i;
+
+ for(i=0; i<SIG_LEN; i++)
+ {
+  w=rnd(&seed);
+  switch(t)
+  {
+   case 0: noise[i]=w;
+    break;
+   case 1: //pink: Paul Kellet's economy filter
+    b0=0.99765f*b0+w*0.0990460f;
+    b1=0.96300f*b1+w*0.2965164f;
+    b2=0.57000f*b2+w*1.0526913f;
+    noise[i]=b0+b1+b2+w*0.1848f;
+    break;
+   case 2: //car: one pole low pass at 130 Hz
+    b0+=0.1f*(w-b0);
+    noise[i]=b0;
+    break;
+   default: //babble: four talkers at different offsets
+    noise[i]=(float)babble[(i+3217)%SIG_LEN]+babble[(i+9973)%SIG_LEN]+
+     babble[(i+17011)%SIG_LEN]+babble[(i+25013)%SIG_LEN];
+  }
+ }
+}
+
+//*****************************************************************************
+//clean speech plus noise[] scaled to snr dB, to both outputs
+static void make_mix(double snr)
+{
+ double es=0, en=0, g, x;
+ int i;
+
+ for(i=0; i<SIG_LEN; i++)
+ {
+  es+=(double)clean[i]*clean[i];
+  en+=(double)noise[i]*noise[i];
+ }
+ g=sqrt(es/en/pow(10.0, snr/10));
+ for(i=0; i<SIG_LEN; i++)
+ {
+  x=clean[i]+g*noise[i];
+  if(x>32767) x=32767;
+  if(x<-32768) x=-32768;
+  outx[i]=(short)lrint(x);
+ }
+ memcpy(outf, outx, sizeof(outf));
+}
+
+//*****************************************************************************
+//run both preprocessors in place
+static void run(void)
+{
+ struct melpe_npp* nx=melpe_npp_init();
+ struct melpe_nppf* nf=melpe_nppf_init();
+ int i;
+
+ if(!nx || !nf)
+ {
+  fprintf(stderr, "npp: out of memory\n");
+  exit(2);
+ }
+ for(i=0; i<SIG_LEN; i+=FRM)
+ {
+  melpe_n(nx, outx+i);
+  melpe_nf(nf, outf+i, FRM);
+ }
+ melpe_npp_exit(nx);
+ melpe_nppf_exit(nf);
+}
+
+//*****************************************************************************
+//segmental SNR of out against the clean speech over frames with speech
+static double seg_snr(const short* out)
+{
+ double es, ee, d, s, sum=0;
+ int i, j, n=0;
+
+ for(i=SETTLE; i+FRM<=SIG_LEN-DELAY; i+=FRM)
+ {
+  es=ee=0;
+  for(j=i; j<i+FRM; j++)
+  {
+   d=(double)clean[j]-out[j+DELAY];
+   es+=(double)clean[j]*clean[j];
+   ee+=d*d;
+  }
+  if(es<FRM*100.0) continue; //pause
+  s=10*log10((es+1)/(ee+1));
+  if(s<SEG_MIN) s=SEG_MIN;
+  if(s>SEG_MAX) s=SEG_MAX;
+  sum+=s;
+  n++;
+ }
+ return n ? sum/n : 0;
+}
+
+//*****************************************************************************
+int main(void)
+{
+ static const char* name[4]={ "white", "pink", "car", "babble" };
+ static const double snr[4]={ 0, 5, 10, 20 };
+ double sx, sf;
+ int t, k, fail=0;
+
+ make_signal(clean, SIG_LEN, 0);
+ make_signal(babble, SIG_LEN, 1);
+ for(t=0; t<4; t++)
+ {
+  make_noise(t);
+  for(k=0; k<4; k++)
+  {
+   make_mix(snr[k]);
+   run();
+   sx=seg_snr(outx);
+   sf=seg_snr(outf);
+   printf("%-6s %2.0f dB: fixed %6.2f float %6.2f dB%s\n", name[t], snr[k],
+    sx, sf, (fabs(sf-sx)>NPP_TOL) ? " FAIL" : "");
+   if(fabs(sf-sx)>NPP_TOL) fail=1;
+  }
+ }
+ return fail;
+}
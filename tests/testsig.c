@@ -0,0 +1,70 @@
+// Contact: <torfone@ukr.net>
+// Author: Van Gegel
+//
+// THIS IS A FREE SOFTWARE
+//
+// This software is released under GNU LGPL:
+//
+// * LGPL 3.0 <http://www.gnu.org/licenses/lgpl.html>
+//
+// You're free to copy, distribute and make commercial use
+// of this software under the following conditions:
+//
+// * You have to cite the author (and copyright owner): Van Gegel
+// * You have to provide a link to the author's Homepage: <http://torfone.org/>
+//
+///////////////////////////////////////////////
+
+//Synthetic test signal shared by the test programs
+
+#include <stdint.h>
+
+#include "testsig.h"
+
+//*****************************************************************************
+//synthetic speech: pulse train or noise through three formant resonators,
+//in syllables of 300 mS with a pause after every third one; bgn adds the
+//background noise (pauses and between glottal pulses)
+void make_signal(short* sig, int len, int bgn)
+{
+ //resonators 700/1220/2600 Hz, Q14
+ static const int32_t a1[3]={ 26758, 17974, -13970 };
+ static const int32_t a2[3]={ 15028, 14910, 14449 };
+ int32_t y1[3]={0,0,0}, y2[3]={0,0,0};
+ uint32_t seed=0x12345678;
+ int i, j, syl, pos, period=64, next=0;
+ int32_t n, x, y, amp;
+
+ for(i=0; i<len; i++)
+ {
+  seed=seed*1664525+1013904223; //LCG noise
+  syl=i/2400;
+  pos=i%2400;
+  amp=(pos<1200) ? pos : 2400-pos; //triangular envelope
+  n=((int32_t)(seed>>20)-2048)>>4;
+  x=bgn ? n : 0; //background noise
+
+  if((syl&3)==3) x>>=2; //pause
+  else if((syl&3)==2) x=(n*amp)>>6; //unvoiced syllable
+  else if(i>=next) //voiced: glottal pulse, pitch glides 50..80 samples
+  {
+   x+=amp*48;
+   period+=((i/800)&1) ? 1 : -1;
+   if(period<50) period=50;
+   if(period>80) period=80;
+   next=i+period;
+  }
+
+  for(j=0; j<3; j++) //cascade of resonators
+  {
+   y=x+(int32_t)(((int64_t)a1[j]*y1[j]-(int64_t)a2[j]*y2[j])>>14);
+   y2[j]=y1[j];
+   y1[j]=y;
+   x=y>>1;
+  }
+
+  if(x>32767) x=32767;
+  if(x<-32768) x=-32768;
+  sig[i]=(short)x;
+ }
+}
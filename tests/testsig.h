@@ -0,0 +1,22 @@
+// Contact: <torfone@ukr.net>
+// Author: Van Gegel
+//
+// THIS IS A FREE SOFTWARE
+//
+// This software is released under GNU LGPL:
+//
+// * LGPL 3.0 <http://www.gnu.org/licenses/lgpl.html>
+//
+// You're free to copy, distribute and make commercial use
+// of this software under the following conditions:
+//
+// * You have to cite the author (and copyright owner): Van Gegel
+// * You have to provide a link to the author's Homepage: <http://torfone.org/>
+//
+///////////////////////////////////////////////
+
+//Synthetic test signal shared by the test programs
+
+//fill len samples of sig with synthetic speech at 8 KHz, bgn=1 adds
+//background noise; integer arithmetic only (same on every target)
+void make_signal(short* sig, int len, int bgn);
@@ -0,0 +1,608 @@
+// Contact: <torfone@ukr.net>
+// Author: Van Gegel
+//
+// THIS IS A FREE SOFTWARE
+//
+// This software is released under GNU LGPL:
+//
+// * LGPL 3.0 <http://www.gnu.org/licenses/lgpl.html>
+//
+// You're free to copy, distribute and make commercial use
+// of this software under the following conditions:
+//
+// * You have to cite the author (and copyright owner): Van Gegel
+// * You have to provide a link to the author's Homepage: <http://torfone.org/>
+//
+///////////////////////////////////////////////
+
+//Codec and crypto test vectors: runs the codecs and the crypto primitives
+//over a synthetic speech signal and prints FNV-1a digests of their output,
+//one line per test: name, bitstream digest, decoded speech digest.
+//The signal is built with integer arithmetic only, so the integer codecs
+//and the crypto library must print the same digests on every target
+//(vectors.txt). The float codecs only run when named: their digests depend
+//on the target and are kept per target (vectors-<target>.txt), and the SIMD
+//kernels must not change them, so 'make check' also compares them with a
+//plain C build of the same codecs (vectors_c).
+//Every test encodes a copy of each frame, as some encoders filter their
+//input in place: a test gives the same digests alone or after others.
+//Usage: vectors [test...] (all integer tests by default)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "libcrp.h"
+#include "testsig.h"
+
+#include "../libcodecs/gsm/inc/gsm.h"
+#include "../libcodecs/gsmer/gsme.h"
+#include "../libcodecs/gsmhr/gsmhr.h"
+#include "../libcodecs/g723/lbccodec.h"
+#include "../libcodecs/ilbc/ilbc.h"
+#include "../libcodecs/bv/bv16/bvcommon.h"
+#include "../libcodecs/bv/bv16/bv16cnst.h"
+#include "../libcodecs/bv/bv16/bv16strct.h"
+#include "../libcodecs/bv/bv16/bv16.h"
+#include "../libcodecs/bv/bv16/bitpack.h"
+#include "../libcodecs/melpe/melpe.h"
+#include "../libcodecs/silk/libsilk.h"
+#include "../libcodecs/amr/interf_enc.h"
+#include "../libcodecs/amr/interf_dec.h"
+#include "../libcodecs/celp/celp.h"
+#include "../libcodecs/g729/g729.h"
+#include "../libcodecs/opus/include/opus.h"
+#include "../libcodecs/speex/speex/speex.h"
+#include "../libcodecs/codec2/codec2.h"
+#include "../libcodecs/melp/melplib.h"
+#include "../libcodecs/lpc10/lpc10.h"
+#include "../libcodecs/lpc10/lpc10tools.h"
+#include "../libcodecs/lpc/lpc.h"
+
+#define SIG_LEN 32000 //4 seconds at 8 KHz
+#define FRM_MAX 540 //longest frame (MELPe)
+
+static short sig[SIG_LEN]; //test signal
+static short out[SIG_LEN]; //decoded speech
+static short in[FRM_MAX]; //frame passed to the encoder
+
+//*****************************************************************************
+//FNV-1a 64 bit digest of len bytes
+static uint64_t fnv(uint64_t h, const unsigned char* p, int len)
+{
+ while(len--)
+ {
+  h^=*p++;
+  h*=0x100000001B3ULL;
+ }
+ return h;
+}
+
+#define FNV_INIT 0xCBF29CE484222325ULL
+
+//*****************************************************************************
+//digest of n samples, little endian regardless of the target
+static uint64_t fnv_pcm(uint64_t h, const short* sp, int n)
+{
+ unsigned char b[2];
+
+ while(n--)
+ {
+  b[0]=(unsigned char)(*sp);
+  b[1]=(unsigned char)((unsigned short)(*sp++)>>8);
+  h=fnv(h, b, 2);
+ }
+ return h;
+}
+
+//*****************************************************************************
+//copy of n samples of the signal from i for the encoder to change
+static short* frame(int i, int n)
+{
+ memcpy(in, sig+i, n*sizeof(short));
+ return in;
+}
+
+//*****************************************************************************
+//Keccak sponge hash, authenticated stream and curve25519
+static void t_crypto(uint64_t* d1, uint64_t* d2)
+{
+ static const BYTE key[32]="OnionPhone test vectors key 0001";
+ KECCAK512_DATA spng;
+ unsigned char buf[2*SIG_LEN];
+ unsigned char tag[64];
+ unsigned char sec[32], pub[32], shr[32];
+ int i;
+
+ for(i=0; i<SIG_LEN; i++)
+ {
+  buf[2*i]=(unsigned char)sig[i];
+  buf[2*i+1]=(unsigned char)((unsigned short)sig[i]>>8);
+ }
+
+ //hash
+ Sponge_init(&spng, 0, 0, 0, 0);
+ Sponge_data(&spng, buf, sizeof(buf), 0, SP_NORMAL);
+ Sponge_finalize(&spng, tag, 64);
+ *d1=fnv(FNV_INIT, tag, 64);
+
+ //keyed duplex stream in packet sized pieces and its tag
+ Sponge_init(&spng, key, 32, (const BYTE*)"header", 6);
+ for(i=0; i<(int)sizeof(buf); i+=127) Sponge_data(&spng, buf+i, (sizeof(buf)-i<127) ? sizeof(buf)-i : 127, buf+i, SP_NOABS);
+ Sponge_finalize(&spng, tag, 16);
+ *d1=fnv(*d1, buf, sizeof(buf));
+ *d1=fnv(*d1, tag, 16);
+
+ //public keys and shared secrets
+ *d2=FNV_INIT;
+ for(i=0; i<8; i++)
+ {
+  memcpy(sec, key, 32);
+  sec[0]^=(unsigned char)i;
+  get_pubkey(pub, sec);
+  curve25519_donna(shr, sec, pub);
+  *d2=fnv(*d2, pub, 32);
+  *d2=fnv(*d2, shr, 32);
+ }
+}
+
+//*****************************************************************************
+//GSM 06.10 full rate
+static void t_gsm(uint64_t* d1, uint64_t* d2)
+{
+ gsm e=gsm_create();
+ gsm d=gsm_create();
+ unsigned char b[33];
+ int i;
+
+ *d1=FNV_INIT;
+ for(i=0; i+160<=SIG_LEN; i+=160)
+ {
+  gsm_encode(e, (gsm_signal*)frame(i, 160), (gsm_byte*)b);
+  gsm_decode(d, (gsm_byte*)b, (gsm_signal*)out+i);
+  *d1=fnv(*d1, b, 33);
+ }
+ *d2=fnv_pcm(FNV_INIT, out, i);
+ gsm_destroy(e);
+ gsm_destroy(d);
+}
+
+//*****************************************************************************
+//GSM 06.60 enhanced full rate with DTX
+static void t_gsme(uint64_t* d1, uint64_t* d2)
+{
+ unsigned char b[31];
+ int i;
+
+ gsmer_init(1);
+ *d1=FNV_INIT;
+ for(i=0; i+160<=SIG_LEN; i+=160)
+ {
+  gsmer_encode(b, frame(i, 160));
+  gsmer_decode(out+i, b);
+  *d1=fnv(*d1, b, 31);
+ }
+ *d2=fnv_pcm(FNV_INIT, out, i);
+}
+
+//*****************************************************************************
+//GSM 06.20 half rate
+static void t_gsmhr(uint64_t* d1, uint64_t* d2)
+{
+ struct gsmhr* e=gsmhr_init(0);
+ struct gsmhr* d=gsmhr_init(0);
+ unsigned char b[14];
+ int i;
+
+ *d1=FNV_INIT;
+ for(i=0; i+160<=SIG_LEN; i+=160)
+ {
+  gsmhr_encode(e, b, frame(i, 160));
+  gsmhr_decode(d, out+i, b);
+  *d1=fnv(*d1, b, 14);
+ }
+ *d2=fnv_pcm(FNV_INIT, out, i);
+ gsmhr_exit(e);
+ gsmhr_exit(d);
+}
+
+//*****************************************************************************
+//G.723.1 at 6.3 kbps
+static void t_g723(uint64_t* d1, uint64_t* d2)
+{
+ struct g723_enc* e=g723_enc_init(0, 0);
+ struct g723_dec* d=g723_dec_init();
+ unsigned char b[24];
+ int i;
+
+ *d1=FNV_INIT;
+ for(i=0; i+240<=SIG_LEN; i+=240)
+ {
+  g723_e(e, frame(i, 240), b);
+  g723_d(d, b, out+i);
+  *d1=fnv(*d1, b, 24);
+ }
+ *d2=fnv_pcm(FNV_INIT, out, i);
+ g723_enc_exit(e);
+ g723_dec_exit(d);
+}
+
+//*****************************************************************************
+//iLBC 30 mS frames
+static void t_ilbc(uint64_t* d1, uint64_t* d2)
+{
+ iLBC_Enc_Inst_t* e;
+ iLBC_Dec_Inst_t* d;
+ int16_t b[25];
+ int16_t type;
+ int i;
+
+ WebRtcIlbcfix_EncoderCreate(&e);
+ WebRtcIlbcfix_DecoderCreate(&d);
+ WebRtcIlbcfix_EncoderInit(e, 30);
+ WebRtcIlbcfix_DecoderInit(d, 30);
+ *d1=FNV_INIT;
+ for(i=0; i+240<=SIG_LEN; i+=240)
+ {
+  WebRtcIlbcfix_Encode(e, (int16_t*)frame(i, 240), 240, b);
+  WebRtcIlbcfix_Decode(d, b, 50, (int16_t*)out+i, &type);
+  *d1=fnv_pcm(*d1, b, 25); //16 bit words
+ }
+ *d2=fnv_pcm(FNV_INIT, out, i);
+ WebRtcIlbcfix_EncoderFree(e);
+ WebRtcIlbcfix_DecoderFree(d);
+}
+
+//*****************************************************************************
+//BroadVoice 16
+static void t_bv16(uint64_t* d1, uint64_t* d2)
+{
+ static struct BV16_Encoder_State es;
+ static struct BV16_Decoder_State ds;
+ struct BV16_Bit_Stream bs;
+ unsigned char b[10];
+ int i;
+
+ Reset_BV16_Encoder(&es);
+ Reset_BV16_Decoder(&ds);
+ *d1=FNV_INIT;
+ for(i=0; i+40<=SIG_LEN; i+=40)
+ {
+  BV16_Encode(&bs, &es, frame(i, 40));
+  BV16_BitPack(b, &bs);
+  BV16_BitUnPack(b, &bs);
+  BV16_Decode(&bs, &ds, out+i);
+  *d1=fnv(*d1, b, 10);
+ }
+ *d2=fnv_pcm(FNV_INIT, out, i);
+}
+
+//*****************************************************************************
+//MELPe 1200 bps
+static void t_melpe(uint64_t* d1, uint64_t* d2)
+{
+ struct melpe_enc* e=melpe_enc_init();
+ struct melpe_dec* d=melpe_dec_init();
+ unsigned char b[11];
+ int i;
+
+ *d1=FNV_INIT;
+ for(i=0; i+540<=SIG_LEN; i+=540)
+ {
+  memset(b, 0, sizeof(b));
+  melpe_a(e, b, frame(i, 540));
+  melpe_s(d, out+i, b);
+  *d1=fnv(*d1, b, 11);
+ }
+ *d2=fnv_pcm(FNV_INIT, out, i);
+ melpe_enc_exit(e);
+ melpe_dec_exit(d);
+}
+
+//*****************************************************************************
+//SILK 3 frames per packet
+static void t_silk(uint64_t* d1, uint64_t* d2)
+{
+ struct silk8* st=SILK8_open(3);
+ unsigned char b[128];
+ unsigned char l;
+ int i;
+
+ *d1=FNV_INIT;
+ for(i=0; i+480<=SIG_LEN; i+=480)
+ {
+  l=(unsigned char)SILK8_encode(st, frame(i, 480), b);
+  SILK8_decode(st, out+i, b, l);
+  *d1=fnv(*d1, &l, 1);
+  *d1=fnv(*d1, b, l);
+ }
+ *d2=fnv_pcm(FNV_INIT, out, i);
+ SILK8_close(st);
+}
+
+//*****************************************************************************
+//Opus (fixed point) at 6 kbps VBR, 60 mS frames, as set up in codecs.c
+static void t_opus(uint64_t* d1, uint64_t* d2)
+{
+ OpusEncoder* e;
+ OpusDecoder* d;
+ unsigned char b[64];
+ unsigned char l;
+ int i, err;
+
+ e=opus_encoder_create(8000, 1, OPUS_APPLICATION_VOIP, &err);
+ d=opus_decoder_create(8000, 1, &err);
+ opus_encoder_ctl(e, OPUS_SET_BITRATE(6000));
+ opus_encoder_ctl(e, OPUS_SET_MAX_BANDWIDTH(OPUS_BANDWIDTH_WIDEBAND));
+ opus_encoder_ctl(e, OPUS_SET_VBR(1));
+ opus_encoder_ctl(e, OPUS_SET_VBR_CONSTRAINT(1));
+ opus_encoder_ctl(e, OPUS_SET_COMPLEXITY(10));
+ opus_encoder_ctl(e, OPUS_SET_SIGNAL(OPUS_SIGNAL_VOICE));
+ opus_encoder_ctl(e, OPUS_SET_LSB_DEPTH(16));
+ *d1=*d2=FNV_INIT;
+ for(i=0; i+480<=SIG_LEN; i+=480)
+ {
+  l=(unsigned char)opus_encode(e, frame(i, 480), 480, b, 60);
+  if(opus_decode(d, b, l, out+i, 480, 0)!=480) *d2=~*d2; //breaks the digest
+  *d1=fnv(*d1, &l, 1);
+  *d1=fnv(*d1, b, l);
+ }
+ *d2=fnv_pcm(*d2, out, i);
+ opus_encoder_destroy(e);
+ opus_decoder_destroy(d);
+}
+
+//*****************************************************************************
+//Speex narrowband at 15 kbps
+static void t_speex(uint64_t* d1, uint64_t* d2)
+{
+ void* e=speex_encoder_init(&speex_nb_mode);
+ void* d=speex_decoder_init(&speex_nb_mode);
+ SpeexBits eb, db;
+ char b[64];
+ unsigned char l;
+ int i, rate=15000;
+
+ speex_encoder_ctl(e, SPEEX_SET_BITRATE, &rate);
+ speex_bits_init(&eb);
+ speex_bits_init(&db);
+ *d1=FNV_INIT;
+ for(i=0; i+160<=SIG_LEN; i+=160)
+ {
+  speex_bits_reset(&eb);
+  speex_encode_int(e, frame(i, 160), &eb);
+  l=(unsigned char)speex_bits_write(&eb, b, sizeof(b));
+  speex_bits_read_from(&db, b, l);
+  speex_decode_int(d, &db, out+i);
+  *d1=fnv(*d1, &l, 1);
+  *d1=fnv(*d1, (unsigned char*)b, l);
+ }
+ *d2=fnv_pcm(FNV_INIT, out, i);
+ speex_bits_destroy(&eb);
+ speex_bits_destroy(&db);
+ speex_encoder_destroy(e);
+ speex_decoder_destroy(d);
+}
+
+//*****************************************************************************
+//Codec2 at 3200, 1400 and 450 bps in turn over the whole signal
+static void t_codec2(uint64_t* d1, uint64_t* d2)
+{
+ static const int mode[3]={ CODEC2_MODE_3200, CODEC2_MODE_1400, CODEC2_MODE_450 };
+ static const int len[3]={ 160, 320, 320 }; //samples per frame
+ struct CODEC2* c;
+ unsigned char b[8];
+ int i, m, n;
+
+ *d1=*d2=FNV_INIT;
+ for(m=0; m<3; m++)
+ {
+  c=codec2_create(mode[m]);
+  n=(codec2_bits_per_frame(c)+7)>>3;
+  for(i=0; i+len[m]<=SIG_LEN; i+=len[m])
+  {
+   memset(b, 0, sizeof(b));
+   codec2_encode(c, b, frame(i, len[m]));
+   codec2_decode(c, out+i, b);
+   *d1=fnv(*d1, b, n);
+  }
+  *d2=fnv_pcm(*d2, out, i);
+  codec2_destroy(c);
+ }
+}
+
+//*****************************************************************************
+//MELP 2400 bps
+static void t_melp(uint64_t* d1, uint64_t* d2)
+{
+ unsigned char b[7];
+ int i;
+
+ melp_ini();
+ *d1=FNV_INIT;
+ for(i=0; i+180<=SIG_LEN; i+=180)
+ {
+  memset(b, 0, sizeof(b));
+  melp_enc(b, frame(i, 180));
+  melp_dec(out+i, b);
+  *d1=fnv(*d1, b, 7);
+ }
+ *d2=fnv_pcm(FNV_INIT, out, i);
+}
+
+//*****************************************************************************
+//LPC10 2400 bps, float samples scaled as in codecs.c
+static void t_lpc10(uint64_t* d1, uint64_t* d2)
+{
+ struct lpc10_encoder_state* e=create_lpc10_encoder_state();
+ struct lpc10_decoder_state* d=create_lpc10_decoder_state();
+ float sp[LPC10_SAMPLES_PER_FRAME];
+ int32_t bits[LPC10_BITS_IN_COMPRESSED_FRAME];
+ unsigned char b[7];
+ int i, j;
+
+ *d1=FNV_INIT;
+ for(i=0; i+LPC10_SAMPLES_PER_FRAME<=SIG_LEN; i+=LPC10_SAMPLES_PER_FRAME)
+ {
+  for(j=0; j<LPC10_SAMPLES_PER_FRAME; j++) sp[j]=(float)sig[i+j]/32768.0;
+  lpc10_encode(sp, bits, e);
+  memset(b, 0, sizeof(b));
+  lpc10_build_bits(b, bits);
+  lpc10_extract_bits(bits, b);
+  lpc10_decode(bits, sp, d);
+  for(j=0; j<LPC10_SAMPLES_PER_FRAME; j++) out[i+j]=(short)(sp[j]*32768.0);
+  *d1=fnv(*d1, b, 7);
+ }
+ *d2=fnv_pcm(FNV_INIT, out, i);
+ free(e);
+ free(d);
+}
+
+//*****************************************************************************
+//LPC 5600 bps
+static void t_lpc(uint64_t* d1, uint64_t* d2)
+{
+ struct lpcwork* w=lpc_start();
+ lpcstate_t st;
+ lpcparams_t lp;
+ unsigned char b[2];
+ int i;
+
+ lpc_init(&st);
+ *d1=FNV_INIT;
+ for(i=0; i+FRAMESIZE<=SIG_LEN; i+=FRAMESIZE)
+ {
+  lpc_analyze(w, frame(i, FRAMESIZE), &lp);
+  lpc_synthesize(out+i, &lp, &st);
+  b[0]=(unsigned char)lp.period; //fields in a fixed byte order
+  b[1]=(unsigned char)(lp.period>>8);
+  *d1=fnv(*d1, b, 2);
+  *d1=fnv(*d1, &lp.gain, 1);
+  *d1=fnv(*d1, (unsigned char*)lp.k, LPC_FILTORDER);
+ }
+ *d2=fnv_pcm(FNV_INIT, out, i);
+ lpc_end(w);
+}
+
+//*****************************************************************************
+//AMR float codec, the mode steps through all eight rates frame by frame
+static void t_amr(uint64_t* d1, uint64_t* d2)
+{
+ void* e=Encoder_Interface_init(0);
+ void* d=Decoder_Interface_init();
+ unsigned char b[32];
+ unsigned char l;
+ int i;
+
+ *d1=FNV_INIT;
+ for(i=0; i+160<=SIG_LEN; i+=160)
+ {
+  l=(unsigned char)AMR_encode(e, (uint8_t)((i/160)&7), frame(i, 160), b, 1);
+  AMR_decode(d, (uint8_t)((i/160)&7), b, out+i, 0);
+  *d1=fnv(*d1, &l, 1);
+  *d1=fnv(*d1, b, l);
+ }
+ *d2=fnv_pcm(FNV_INIT, out, i);
+ Encoder_Interface_exit(e);
+ Decoder_Interface_exit(d);
+}
+
+//*****************************************************************************
+//FS-1016 CELP 4800 bps
+static void t_celp(uint64_t* d1, uint64_t* d2)
+{
+ char b[144/8];
+ int i;
+
+ celp_init(0);
+ *d1=FNV_INIT;
+ for(i=0; i+240<=SIG_LEN; i+=240)
+ {
+  celp_encode(frame(i, 240), b);
+  celp_decode(b, out+i);
+  *d1=fnv(*d1, (unsigned char*)b, sizeof(b));
+ }
+ *d2=fnv_pcm(FNV_INIT, out, i);
+}
+
+//*****************************************************************************
+//G.729 annex D, base rate and annex E in turn over the whole signal
+static void t_g729(uint64_t* d1, uint64_t* d2)
+{
+ struct g729_enc* e;
+ struct g729_dec* d;
+ unsigned char b[16];
+ unsigned char l;
+ int i, rate;
+
+ *d1=*d2=FNV_INIT;
+ for(rate=0; rate<3; rate++)
+ {
+  e=g729_enc_init(rate, 0);
+  d=g729_dec_init(rate, 0);
+  for(i=0; i+80<=SIG_LEN; i+=80)
+  {
+   l=(unsigned char)g729enc(e, frame(i, 80), b);
+   g729dec(d, b, out+i);
+   *d1=fnv(*d1, &l, 1);
+   *d1=fnv(*d1, b, l);
+  }
+  *d2=fnv_pcm(*d2, out, i);
+  g729_enc_exit(e);
+  g729_dec_exit(d);
+ }
+}
+
+//*****************************************************************************
+static const struct
+{
+ const char* name;
+ void (*run)(uint64_t* d1, uint64_t* d2);
+ int flt; //float codec: run only when named
+} tests[]=
+{
+ { "crypto", t_crypto, 0 },
+ { "gsm", t_gsm, 0 },
+ { "gsme", t_gsme, 0 },
+ { "gsmhr", t_gsmhr, 0 },
+ { "g723", t_g723, 0 },
+ { "ilbc", t_ilbc, 0 },
+ { "bv16", t_bv16, 0 },
+ { "melpe", t_melpe, 0 },
+ { "silk", t_silk, 0 },
+ { "opus", t_opus, 0 },
+ { "amr", t_amr, 1 },
+ { "celp", t_celp, 1 },
+ { "g729", t_g729, 1 },
+ { "speex", t_speex, 1 },
+ { "codec2", t_codec2, 1 },
+ { "melp", t_melp, 1 },
+ { "lpc10", t_lpc10, 1 },
+ { "lpc", t_lpc, 1 },
+};
+
+#define NTESTS ((int)(sizeof(tests)/sizeof(tests[0])))
+
+//*****************************************************************************
+int main(int argc, char** argv)
+{
+ uint64_t d1, d2;
+ int i, j;
+
+ make_signal(sig, SIG_LEN, 1);
+ for(i=0; i<NTESTS; i++)
+ {
+  if(argc>1) //run only named tests
+  {
+   for(j=1; j<argc; j++) if(!strcmp(argv[j], tests[i].name)) break;
+   if(j==argc) continue;
+  }
+  else if(tests[i].flt) continue;
+  memset(out, 0, sizeof(out));
+  tests[i].run(&d1, &d2);
+  printf("%-8s %016" PRIx64 " %016" PRIx64 "\n", tests[i].name, d1, d2);
+ }
+ return 0;
+}